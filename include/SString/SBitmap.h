@@ -0,0 +1,45 @@
+/// \file SBitmap.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief 包含 SBitmap，列式批量操作的结果位图
+
+#pragma once
+#include <SString/SString.h>
+
+namespace sstr {
+
+    /// 定长位图，第 i 位对应第 i 行
+    class API SBitmap final {
+    public:
+        SBitmap() noexcept = default;
+        explicit SBitmap(size_t size);
+
+    public:
+        /// 位数
+        size_t size() const;
+        /// 置位个数
+        size_t count() const;
+
+        bool test(size_t index) const;
+        void set(size_t index);
+        void reset(size_t index);
+
+        /// 底层 64 位字，超出 size 的位恒为 0
+        const uint64_t *words() const;
+        uint64_t *words();
+        /// 64 位字个数
+        size_t wordCount() const;
+
+    public:
+        bool operator[](size_t index) const;
+        SBitmap operator&(const SBitmap &bitmap) const;
+        SBitmap operator|(const SBitmap &bitmap) const;
+        SBitmap operator~() const;
+
+    private:
+        std::vector<uint64_t> _words;
+        size_t _size = 0;
+    };
+
+}// namespace sstr
@@ -0,0 +1,259 @@
+/// \file SCharProperty.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief Unicode 字符属性：通用类别（General_Category）与文字（Script）
+
+#pragma once
+#include <cstdint>
+
+namespace sstr {
+
+    /// 通用类别，顺序与 UnicodeData.txt 的分组一致
+    enum class SCategory : uint8_t {
+        /// 字母
+        Lu,
+        Ll,
+        Lt,
+        Lm,
+        Lo,
+        /// 标记
+        Mn,
+        Mc,
+        Me,
+        /// 数字
+        Nd,
+        Nl,
+        No,
+        /// 标点
+        Pc,
+        Pd,
+        Ps,
+        Pe,
+        Pi,
+        Pf,
+        Po,
+        /// 符号
+        Sm,
+        Sc,
+        Sk,
+        So,
+        /// 分隔符
+        Zs,
+        Zl,
+        Zp,
+        /// 其他
+        Cc,
+        Cf,
+        Cs,
+        Co,
+        Cn,
+    };
+
+    /// 文字，取值为 Unicode 14.0 Script 属性的长名称
+    enum class SScript : uint8_t {
+        Unknown,
+        Common,
+        Inherited,
+        Adlam,
+        Ahom,
+        AnatolianHieroglyphs,
+        Arabic,
+        Armenian,
+        Avestan,
+        Balinese,
+        Bamum,
+        BassaVah,
+        Batak,
+        Bengali,
+        Bhaiksuki,
+        Bopomofo,
+        Brahmi,
+        Braille,
+        Buginese,
+        Buhid,
+        CanadianAboriginal,
+        Carian,
+        CaucasianAlbanian,
+        Chakma,
+        Cham,
+        Cherokee,
+        Chorasmian,
+        Coptic,
+        Cuneiform,
+        Cypriot,
+        CyproMinoan,
+        Cyrillic,
+        Deseret,
+        Devanagari,
+        DivesAkuru,
+        Dogra,
+        Duployan,
+        EgyptianHieroglyphs,
+        Elbasan,
+        Elymaic,
+        Ethiopic,
+        Georgian,
+        Glagolitic,
+        Gothic,
+        Grantha,
+        Greek,
+        Gujarati,
+        GunjalaGondi,
+        Gurmukhi,
+        Han,
+        Hangul,
+        HanifiRohingya,
+        Hanunoo,
+        Hatran,
+        Hebrew,
+        Hiragana,
+        ImperialAramaic,
+        InscriptionalPahlavi,
+        InscriptionalParthian,
+        Javanese,
+        Kaithi,
+        Kannada,
+        Katakana,
+        KayahLi,
+        Kharoshthi,
+        KhitanSmallScript,
+        Khmer,
+        Khojki,
+        Khudawadi,
+        Lao,
+        Latin,
+        Lepcha,
+        Limbu,
+        LinearA,
+        LinearB,
+        Lisu,
+        Lycian,
+        Lydian,
+        Mahajani,
+        Makasar,
+        Malayalam,
+        Mandaic,
+        Manichaean,
+        Marchen,
+        MasaramGondi,
+        Medefaidrin,
+        MeeteiMayek,
+        MendeKikakui,
+        MeroiticCursive,
+        MeroiticHieroglyphs,
+        Miao,
+        Modi,
+        Mongolian,
+        Mro,
+        Multani,
+        Myanmar,
+        Nabataean,
+        Nandinagari,
+        NewTaiLue,
+        Newa,
+        Nko,
+        Nushu,
+        NyiakengPuachueHmong,
+        Ogham,
+        OlChiki,
+        OldHungarian,
+        OldItalic,
+        OldNorthArabian,
+        OldPermic,
+        OldPersian,
+        OldSogdian,
+        OldSouthArabian,
+        OldTurkic,
+        OldUyghur,
+        Oriya,
+        Osage,
+        Osmanya,
+        PahawhHmong,
+        Palmyrene,
+        PauCinHau,
+        PhagsPa,
+        Phoenician,
+        PsalterPahlavi,
+        Rejang,
+        Runic,
+        Samaritan,
+        Saurashtra,
+        Sharada,
+        Shavian,
+        Siddham,
+        SignWriting,
+        Sinhala,
+        Sogdian,
+        SoraSompeng,
+        Soyombo,
+        Sundanese,
+        SylotiNagri,
+        Syriac,
+        Tagalog,
+        Tagbanwa,
+        TaiLe,
+        TaiTham,
+        TaiViet,
+        Takri,
+        Tamil,
+        Tangsa,
+        Tangut,
+        Telugu,
+        Thaana,
+        Thai,
+        Tibetan,
+        Tifinagh,
+        Tirhuta,
+        Toto,
+        Ugaritic,
+        Vai,
+        Vithkuqi,
+        Wancho,
+        WarangCiti,
+        Yezidi,
+        Yi,
+        ZanabazarSquare,
+    };
+
+    /// 获取类别对应的掩码位，可用于组合类别集合
+    constexpr uint32_t getCategoryBit(SCategory category) {
+        return 1u << (uint32_t) category;
+    }
+
+    /// 字母（L*）
+    constexpr uint32_t LetterMask = 0x1fu;
+    /// 标记（M*）
+    constexpr uint32_t MarkMask = 0x7u << 5;
+    /// 数字（N*）
+    constexpr uint32_t NumberMask = 0x7u << 8;
+    /// 标点（P*）
+    constexpr uint32_t PunctuationMask = 0x7fu << 11;
+    /// 符号（S*）
+    constexpr uint32_t SymbolMask = 0xfu << 18;
+    /// 分隔符（Z*）
+    constexpr uint32_t SeparatorMask = 0x7u << 22;
+    /// 其他（C*）
+    constexpr uint32_t OtherMask = 0x1fu << 25;
+
+    /// 获取 ASCII 字符的通用类别，可在编译期求值
+    /// \param ch ASCII 字符，不小于 0x80 时返回 Cn
+    constexpr SCategory getCategoryFromASCII(uint32_t ch) {
+        return ch >= 0x80                               ? SCategory::Cn
+               : ch < 0x20 || 0x7f == ch                ? SCategory::Cc
+               : ' ' == ch                              ? SCategory::Zs
+               : ch >= '0' && ch <= '9'                 ? SCategory::Nd
+               : ch >= 'A' && ch <= 'Z'                 ? SCategory::Lu
+               : ch >= 'a' && ch <= 'z'                 ? SCategory::Ll
+               : '(' == ch || '[' == ch || '{' == ch    ? SCategory::Ps
+               : ')' == ch || ']' == ch || '}' == ch    ? SCategory::Pe
+               : '+' == ch || '<' == ch || '=' == ch    ? SCategory::Sm
+               : '>' == ch || '|' == ch || '~' == ch    ? SCategory::Sm
+               : '$' == ch                              ? SCategory::Sc
+               : '^' == ch || '`' == ch                 ? SCategory::Sk
+               : '-' == ch                              ? SCategory::Pd
+               : '_' == ch                              ? SCategory::Pc
+                                                        : SCategory::Po;
+    }
+
+}// namespace sstr
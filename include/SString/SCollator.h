@@ -0,0 +1,69 @@
+/// \file SCollator.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief 包含 SCollator，基于 DUCET 的 Unicode 排序（UTS #10）与排序键生成
+
+#pragma once
+#include <SString/SString.h>
+#include <SString/SStringColumn.h>
+
+namespace sstr {
+
+    /// 排序比较的级别
+    enum class SCollationStrength : uint8_t {
+        /// 只比较基本字符，忽略重音与大小写
+        Primary = 1,
+        /// 区分重音
+        Secondary,
+        /// 区分大小写与字形变体
+        Tertiary,
+        /// 区分被 shifted 忽略的空白与标点，仅在 shifted 时有意义
+        Quaternary,
+    };
+
+    /// Unicode 排序
+    /// \note 排序键是字节串，键之间按字节比较（memcmp，较短的前缀更小）的结果与排序规则一致，
+    ///       生成一次后即可用字节序完成排序、二分查找或建立索引。
+    ///       输入先规范化为 NFD，缩约（含不连续缩约）、隐式权重与可变权重按 UTS #10 处理，
+    ///       不包含语言定制规则；非法 UTF-8 字节按 U+FFFD 处理
+    /// \code
+    /// SCollator collator;
+    /// auto a = collator.getSortKey(SStringView("résumé"));
+    /// auto b = collator.getSortKey(SStringView("Resume"));
+    /// // 键可直接按字节比较
+    /// \endcode
+    class API SCollator final {
+    public:
+        /// \param strength 比较级别
+        /// \param shifted 是否将空白与标点等可变字符降到第四级比较，使 "de luca" 与 "DeLuca" 相邻
+        explicit SCollator(SCollationStrength strength = SCollationStrength::Tertiary, bool shifted = false) noexcept;
+
+        /// 生成排序键
+        /// \param str 字符串
+        /// \return 排序键，可能包含 '\0'
+        SString getSortKey(const SStringView &str) const;
+
+        /// 生成排序键，结果覆盖 out，批量生成时可复用 out 的缓冲区
+        /// \param str 字符串，不能与 out 重叠
+        /// \param out 输出
+        void getSortKey(const SStringView &str, SString &out) const;
+
+        /// 为每行生成排序键
+        /// \param column 字符串列
+        /// \return 排序键列，每行的视图长度即键的长度；超出 SStringColumn 的容量上限时为空列
+        SStringColumn getSortKeys(const SStringColumn &column) const;
+
+        /// 比较两个字符串
+        /// \return 小于 0 表示 a 排在 b 前，等于 0 表示在当前级别下相等
+        int compare(const SStringView &a, const SStringView &b) const;
+
+        SCollationStrength strength() const;
+        bool shifted() const;
+
+    private:
+        SCollationStrength _strength;
+        bool _shifted;
+    };
+
+}// namespace sstr
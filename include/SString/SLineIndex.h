@@ -0,0 +1,85 @@
+/// \file SLineIndex.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief 包含 SLineIndex，偏移与行列互相换算的行索引
+
+#pragma once
+#include <SString/SString.h>
+#include <SString/SStringBuilder.h>
+#include <vector>
+
+namespace sstr {
+
+    /// 行索引，记录每行的起始偏移，以 '\n' 分行
+    /// \note 由 SStringView 建立时偏移以字节计，由 SStringBuilder 建立时以字符计，与其索引一致。
+    ///       建立时用 SIMD 扫描换行符，查询时二分查找行首；文本修改后调用 replace 或 append
+    ///       同步索引，只扫描新插入的文本，不必重建
+    /// \code
+    /// SLineIndex index(source);
+    /// size_t line, column;
+    /// if (index.getPosition(source, offset, line, column)) { ... }
+    /// \endcode
+    class API SLineIndex final {
+    public:
+        SLineIndex() = default;
+        explicit SLineIndex(const SStringView &str);
+        explicit SLineIndex(const SStringBuilder &builder);
+
+        /// 行数，空文本为 1 行，以 '\n' 结尾时最后一行为空行
+        size_t lineCount() const;
+        /// 文本长度，单位与偏移相同
+        size_t size() const;
+
+        /// 获取偏移所在的行
+        /// \param offset 偏移，可等于 size()
+        /// \return 行号（从 0 开始），offset 超出范围返回 -1
+        size_t getLine(size_t offset) const;
+        /// 获取行首偏移
+        /// \return 行号超出范围返回 -1
+        size_t getLineStart(size_t line) const;
+        /// 获取行尾偏移，不含 '\n'
+        /// \return 行号超出范围返回 -1
+        size_t getLineEnd(size_t line) const;
+
+        /// 偏移换算为行列，列的单位与偏移相同
+        /// \return offset 超出范围返回 false
+        bool getPosition(size_t offset, size_t &line, size_t &column) const;
+        /// 字节偏移换算为行列，列为行首到 offset 之间的字符数
+        /// \param str 建立索引所用的文本；由 SStringBuilder 建立时不使用
+        /// \return offset 超出范围返回 false
+        bool getPosition(const SStringView &str, size_t offset, size_t &line, size_t &column) const;
+
+        /// 行列换算为偏移，列的单位与偏移相同
+        /// \return 偏移，行号超出范围或列超出行尾返回 -1
+        size_t getOffset(size_t line, size_t column) const;
+        /// 行列换算为字节偏移，列以字符计
+        /// \param str 建立索引所用的文本；由 SStringBuilder 建立时不使用
+        /// \return 偏移，行号超出范围或列超出行尾返回 -1
+        size_t getOffset(const SStringView &str, size_t line, size_t column) const;
+
+        /// 文本中从 begin 起的 len 个单位被替换为 text 后更新索引
+        /// \note 只扫描 text，其后各行的行首整体平移；由 SStringBuilder 建立时按
+        ///       SStringBuilder::replace 的规则换算 text 的字符数
+        /// \param begin 起始偏移，不能超过 size()；由 SStringBuilder 建立时必须小于 size()
+        /// \param len 被替换的长度；SStringBuilder::replace 不会截断 len，因此不能超出末尾，
+        ///        由 SStringView 建立时超出末尾的部分被截断
+        /// \param text 新文本
+        /// \return begin 超出范围返回 false，此时索引不变
+        bool replace(size_t begin, size_t len, const SStringView &text);
+        /// 文本末尾追加 text 后更新索引
+        void append(const SStringView &text);
+
+    private:
+        /// 在 text 中查找换行符，把其后的位置加上 base 后写入 starts
+        /// \return text 的长度，单位与偏移相同
+        size_t scan(const SStringView &text, size_t base, std::vector<size_t> &starts) const;
+
+        /// 各行起始偏移，首项为 0
+        std::vector<size_t> _starts = {0};
+        size_t _size = 0;
+        /// 偏移是否以字符计
+        bool _chars = false;
+    };
+
+}// namespace sstr
@@ -0,0 +1,44 @@
+/// \file SMappedFile.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief 包含 SMappedFile，只读内存映射文件
+
+#pragma once
+#include <SString/SString.h>
+
+namespace sstr {
+
+    /// 只读内存映射文件
+    /// \note 映射起始地址按页对齐
+    class API SMappedFile final {
+        // 构造相关
+    public:
+        SMappedFile() noexcept = default;
+        SMappedFile(const SMappedFile &file) = delete;
+        SMappedFile(SMappedFile &&file) noexcept;
+        ~SMappedFile();
+
+        SMappedFile &operator=(const SMappedFile &file) = delete;
+        SMappedFile &operator=(SMappedFile &&file) noexcept;
+
+        // 基础功能
+    public:
+        /// 映射文件，已有映射会先被释放
+        /// \param path 文件路径
+        /// \return 是否成功，空文件视为失败
+        bool open(const char *path);
+        /// 释放映射
+        void close();
+
+        /// 是否未映射
+        bool null() const;
+        const char *data() const;
+        size_t size() const;
+
+    private:
+        const char *_data = nullptr;
+        size_t _size = 0;
+    };
+
+}// namespace sstr
@@ -0,0 +1,43 @@
+/// \file SNormalizer.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief 包含 SNormalizer，分段输入的流式 Unicode 规范化
+
+#pragma once
+#include <SString/SString.h>
+#include <vector>
+
+namespace sstr {
+
+    /// 流式规范化
+    /// \note 输入可以在任意字节处切分，结果与整体规范化一致。
+    ///       每次只保留末尾尚未确定的片段（最后一个可安全断开的起始字符之后的内容），
+    ///       内存占用与输入总长度无关
+    /// \code
+    /// SNormalizer normalizer(SNormalForm::NFC);
+    /// while (read(chunk)) normalizer.append(chunk, out);
+    /// normalizer.finish(out);
+    /// \endcode
+    class API SNormalizer final {
+    public:
+        explicit SNormalizer(SNormalForm form) noexcept;
+
+        /// 输入一段数据，已确定的结果追加到 out
+        /// \param chunk 数据片段
+        /// \param out 输出
+        void append(const SStringView &chunk, SString &out);
+
+        /// 结束输入，输出剩余结果，之后可继续用于新的输入
+        /// \param out 输出
+        void finish(SString &out);
+
+        SNormalForm form() const;
+
+    private:
+        SNormalForm _form;
+        /// 尚未确定的输入
+        std::vector<char> _pending;
+    };
+
+}// namespace sstr
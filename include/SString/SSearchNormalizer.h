@@ -0,0 +1,57 @@
+/// \file SSearchNormalizer.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief 包含 SSearchNormalizer，面向搜索索引的单遍文本规范化
+
+#pragma once
+#include <SString/SString.h>
+
+namespace sstr {
+
+    /// 搜索规范化的处理阶段，可按位组合
+    enum SSearchStage : uint32_t {
+        /// 完整大小写折叠（CaseFolding.txt 中的 C 与 F 映射），如 "Straße" -> "strasse"
+        SSearchCaseFold = 0x01,
+        /// NFKC 兼容规范化，如全角、连字、上标
+        SSearchNFKC = 0x02,
+        /// 规范分解后删除非间距组合符（Mn），如 "café" -> "cafe"
+        SSearchStripDiacritics = 0x04,
+        /// 连续的空白（White_Space）合并为一个空格，并去除首尾空白
+        SSearchCollapseWhitespace = 0x08,
+        /// 删除标点（P*）
+        SSearchStripPunctuation = 0x10,
+        SSearchAllStages = 0x1f,
+    };
+
+    /// 搜索规范化流水线
+    /// \note 所有阶段在一次遍历中完成：每个码点只解码一次，结果直接写入同一个输出缓冲区。
+    ///       同时启用大小写折叠与 NFKC 时结果为 NFKC(toCasefold(NFKD(x)))；
+    ///       非法 UTF-8 字节按 U+FFFD 处理
+    /// \code
+    /// SSearchNormalizer normalizer(SSearchCaseFold | SSearchStripDiacritics | SSearchCollapseWhitespace);
+    /// normalizer.normalize(SStringView("  Crème   Brûlée ")); // "creme brulee"
+    /// \endcode
+    class API SSearchNormalizer final {
+    public:
+        explicit SSearchNormalizer(uint32_t stages = SSearchAllStages) noexcept;
+
+        /// 规范化字符串
+        /// \param str 字符串
+        /// \return 结果
+        SString normalize(const SStringView &str) const;
+
+        /// 规范化字符串，结果覆盖 out，批量处理时可复用 out 的缓冲区
+        /// \param str 字符串，不能与 out 重叠
+        /// \param out 输出
+        void normalize(const SStringView &str, SString &out) const;
+
+        uint32_t stages() const;
+
+    private:
+        uint32_t _stages;
+        /// ASCII 字符的处理结果，由启用的阶段预先计算
+        uint8_t _ascii[128];
+    };
+
+}// namespace sstr
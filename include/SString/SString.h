@@ -5,6 +5,7 @@
 /// \brief 包含 SString 核心功能， SChar、SStringView 和 SString
 
 #pragma once
+#include <SString/SCharProperty.h>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -37,6 +38,29 @@ namespace sstr {
         SChar operator-(const SChar &ch) const;
 
         explicit operator uint32_t() const;
+
+        /// 是否为字母（通用类别 L*）
+        bool isAlpha() const;
+        /// 是否为十进制数字（通用类别 Nd）
+        bool isDigit() const;
+        /// 是否为空白字符（White_Space 属性）
+        bool isSpace() const;
+        /// 是否为标点（通用类别 P*）
+        bool isPunct() const;
+
+        /// 获取通用类别，超出 U+10FFFF 返回 Cn
+        SCategory category() const;
+        /// 获取所属文字，超出 U+10FFFF 返回 Unknown
+        SScript script() const;
+
+        /// 获取规范组合类（Canonical_Combining_Class），起始字符为 0
+        uint8_t combiningClass() const;
+
+        /// 获取终端显示宽度（UAX #11）
+        /// \note 组合符、格式字符、控制字符与韩文中声/终声为 0，East Asian Wide 与 Fullwidth 为 2
+        /// \param ambiguousWide 宽度不定（Ambiguous）的字符是否按 2 列计算，CJK 环境下通常为 true
+        /// \return 0、1 或 2
+        int width(bool ambiguousWide = false) const;
     };
 
     /// 获取 UTF-8 字符代码
@@ -70,6 +94,61 @@ namespace sstr {
     /// \return Unicode 字符
     extern API SChar getUnicodeCharFromUTF8Char(char size, const char *ch);
 
+    /// 校验字节串是否为合法 UTF-8
+    /// \note 拒绝过长编码、代理项以及超出 U+10FFFF 的字符
+    /// \param str 字节串
+    /// \param size 字节数
+    /// \return 是否合法
+    extern "C" API bool isValidUTF8String(const char *str, size_t size);
+
+    /// 计算字节串的 64 位哈希值（MurmurHash64A）
+    /// \param data 字节串
+    /// \param size 字节数
+    /// \param seed 种子
+    /// \return 哈希值
+    extern API uint64_t getHashFromBytes(const char *data, size_t size, uint64_t seed = 0);
+
+    /// 获取文字的名称，如 "Latin"
+    extern API const char *getScriptName(SScript script);
+
+    /// 获取文字的 ISO 15924 四字母代码，如 "Latn"
+    extern API const char *getScriptCode(SScript script);
+
+    /// 批量获取通用类别
+    /// \note 非法字节按单字节 Cn 处理
+    /// \param str 字节串
+    /// \param size 字节数
+    /// \param categories 输出，每个字符一项，需保证至少 size 项可用空间
+    /// \return 字符个数
+    extern API size_t getCategoriesFromUTF8String(const char *str, size_t size, SCategory *categories);
+
+    /// 批量获取所属文字
+    /// \param str 字节串
+    /// \param size 字节数
+    /// \param scripts 输出，每个字符一项，需保证至少 size 项可用空间
+    /// \return 字符个数
+    extern API size_t getScriptsFromUTF8String(const char *str, size_t size, SScript *scripts);
+
+    /// 获取字节串中出现过的通用类别集合
+    /// \param str 字节串
+    /// \param size 字节数
+    /// \return 以 getCategoryBit 组成的掩码
+    extern API uint32_t getCategoryMaskFromUTF8String(const char *str, size_t size);
+
+    /// 获取字节串的终端显示宽度
+    /// \note 非法字节按单字节 U+FFFD 处理
+    /// \param str 字节串
+    /// \param size 字节数
+    /// \param ambiguousWide 宽度不定的字符是否按 2 列计算
+    /// \return 显示列数
+    extern API size_t getDisplayWidthFromUTF8String(const char *str, size_t size, bool ambiguousWide = false);
+
+    /// 向缓冲区写入 Unicode 字符的 UTF-8 编码
+    /// \param ch Unicode 字符
+    /// \param destination 写入位置，需保证至少 4 字节可用空间
+    /// \return 写入字节数，非法字符返回 -1
+    extern API char putUTF8FromUnicodeChar(SChar ch, char *destination);
+
 #if (__cplusplus < 201703L && _HAS_CXX17 == 0)
     class API SStringIterator final : public std::iterator<std::forward_iterator_tag,
                                                        SChar,
@@ -101,10 +180,38 @@ namespace sstr {
 
     class API SString;
 
+    /// 文本统计结果
+    struct API SStringStats {
+        /// 字节数
+        size_t bytes = 0;
+        /// 字符数，即非续字节的个数
+        size_t chars = 0;
+        /// 行数，以 '\n' 分隔，最后一行不以 '\n' 结尾时同样计入
+        size_t lines = 0;
+        /// 单词数，与 splitWords 的结果个数相同
+        size_t words = 0;
+    };
+
+    /// Unicode 规范化形式（UAX #15）
+    enum class SNormalForm : uint8_t {
+        /// 规范分解后再规范组合
+        NFC,
+        /// 规范分解
+        NFD,
+        /// 兼容分解后再规范组合
+        NFKC,
+        /// 兼容分解
+        NFKD,
+    };
+
     class API SStringView {
     public:
         SStringView() noexcept = default;
         explicit SStringView(const char *u8str) noexcept;
+        /// 从指定范围构造，不要求以 '\0' 结尾
+        /// \param data 起始位置
+        /// \param size 字节数
+        SStringView(const char *data, size_t size) noexcept;
         virtual ~SStringView() = default;
 
 #if (__cplusplus < 201703L && _HAS_CXX17 == 0)
@@ -153,10 +260,47 @@ namespace sstr {
         /// \return 子串位置
         int32_t findByBytes(const char *bytes) const;
 
-        /// 除去字符串两端空格
-        /// \note 注意是空格
-        /// \return 处理后对象
-        SString trim() const;
+        /// 除去字符串两端的空白字符
+        /// \note 空白字符指 Unicode White_Space，结果引用原字符串，不发生分配
+        /// \return 处理后视图
+        SStringView trim() const;
+        /// 除去字符串两端属于 chars 的字符
+        /// \param chars 待去除的字符集合
+        /// \return 处理后视图
+        SStringView trim(const SStringView &chars) const;
+        /// 除去字符串头部的空白字符
+        SStringView trimStart() const;
+        SStringView trimStart(const SStringView &chars) const;
+        /// 除去字符串尾部的空白字符
+        /// \note 结果不以 '\0' 结尾
+        SStringView trimEnd() const;
+        SStringView trimEnd(const SStringView &chars) const;
+
+        /// 一次遍历统计字节数、字符数、行数与单词数
+        /// \note 每 32 字节用 SIMD 比较得到各类字节的掩码，字符与换行直接计数；
+        ///       纯 ASCII 的词按掩码判断 UAX #29 的连接规则，含非 ASCII 字节的词交给 getWordCount
+        /// \return 统计结果
+        SStringStats stats() const;
+        /// 多线程统计，适合内存映射的大文件
+        /// \note 按 ASCII 空白切分后各线程分别计数，结果与 stats 相同；每段不足 1MB 时减少线程
+        /// \param threads 线程数，0 表示使用硬件并发数
+        /// \return 统计结果
+        SStringStats statsParallel(size_t threads = 0) const;
+
+        /// 获取终端显示宽度，即占用的等宽列数
+        /// \param ambiguousWide 宽度不定的字符是否按 2 列计算
+        /// \return 显示列数
+        size_t displayWidth(bool ambiguousWide = false) const;
+        /// 截取显示宽度不超过 width 的前缀
+        /// \note 不会切断字符，末尾字符之后的零宽字符（如组合符）一并保留；结果引用原字符串
+        /// \param width 最大显示列数
+        /// \param ambiguousWide 宽度不定的字符是否按 2 列计算
+        /// \return 处理后视图
+        SStringView truncateWidth(size_t width, bool ambiguousWide = false) const;
+        /// 在尾部填充空格到指定显示宽度（左对齐），已达到时不截断
+        SString padWidthEnd(size_t width, bool ambiguousWide = false) const;
+        /// 在头部填充空格到指定显示宽度（右对齐），已达到时不截断
+        SString padWidthStart(size_t width, bool ambiguousWide = false) const;
 
         /// 反转字符串
         /// \return 反转后对象
@@ -205,6 +349,34 @@ namespace sstr {
         /// 创建字母转为全大写的副本
         SString toUpper() const;
 
+        /// 是否已是指定的规范化形式
+        /// \note 快速检查无法确定时会实际规范化后比较
+        bool isNormalized(SNormalForm form) const;
+        /// 创建规范化后的副本
+        /// \note 总会返回新的字符串，已是该形式时同样拷贝一份；避免分配请使用 normalize(form, out)
+        /// \param form 规范化形式
+        SString normalize(SNormalForm form) const;
+        /// 规范化到 out，快速检查确认已是该形式时不写入也不分配
+        /// \param form 规范化形式
+        /// \param out 输出目标，写入时原有内容会被覆盖
+        /// \retval true 已写入 out
+        /// \retval false 已是该形式，out 未改动，可直接使用原字符串
+        bool normalize(SNormalForm form, SString &out) const;
+
+        /// 按自然顺序比较，如 "item2" 排在 "item10" 前
+        /// \note 连续的 ASCII 数字按数值比较，数字段排在 '/' 与 ':' 之间，其余按字节（即码点）比较；
+        ///       数值相等时前导零少者在前。不发生分配
+        /// \param str 另一字符串
+        /// \return 小于 0、等于 0、大于 0 分别表示排在 str 前、相同、排在 str 后
+        int compareNatural(const SStringView &str) const;
+        /// 生成自然顺序排序键，键之间按字节比较（memcmp，较短的前缀更小）的结果与 compareNatural 一致
+        /// \note 数字段以位数加每字节两位的形式存储，键可能包含 '\0'
+        SString naturalSortKey() const;
+
+        /// 获取字符串内容的哈希值
+        /// \return 64 位哈希值
+        uint64_t hash() const;
+
         SChar at(size_t index) const;
         std::vector<SChar> toChars() const;
         std::string toString() const;
@@ -231,6 +403,7 @@ namespace sstr {
 
         explicit SString() noexcept;
         SString(const char *str, size_t size);
+        SString(const SStringView &str);
         SString(const SString &sString) noexcept;
         SString(SString &&sString) noexcept;
         ~SString() noexcept override;
@@ -248,19 +421,45 @@ namespace sstr {
         /// \return 缓冲区已用大小
         size_t size() const override;
 
+        /// 原地除去两端的空白字符
+        void trimInPlace();
+        void trimInPlace(const SStringView &chars);
+        /// 原地除去头部的空白字符
+        void trimStartInPlace();
+        void trimStartInPlace(const SStringView &chars);
+        /// 原地除去尾部的空白字符
+        void trimEndInPlace();
+        void trimEndInPlace(const SStringView &chars);
+
+        /// 原地 Unicode 规范化
+        /// \note 快速检查通过时直接返回，不会发生分配
+        /// \param form 规范化形式
+        void normalize(SNormalForm form);
+
         /// 将字符串转换为全小写的形式
         void toLower();
         /// 将字符串转换为全大写的形式
         void toUpper();
 
+        using SStringView::data;
+        using SStringView::normalize;
         /// \brief 获取 data 指针
         /// \deprecated 通常不应该使用该函数
         char *data();
         /// \brief 更新 size 属性
         /// \deprecated 通常不应该使用该函数
         void update();
+        /// \brief 调整字符串字节数，必要时扩容
+        /// \note 扩展部分内容未初始化，需通过 data() 写入
+        /// \param size 新的字节数
+        void resize(size_t size);
+        /// \brief 预留容量，不改变内容
+        /// \param size 预期的字节数
+        void reserve(size_t size);
 
     public:
+        SString &operator=(const SString &sString);
+        SString &operator=(SString &&sString) noexcept;
         void operator+=(const SStringView &str);
         void operator+=(const char *u8str);
 
@@ -0,0 +1,69 @@
+/// \file SStringBloomFilter.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief 包含 SStringBloomFilter，以字符串为键的分块布隆过滤器
+
+#pragma once
+#include <SString/SBitmap.h>
+#include <SString/SStringColumn.h>
+
+namespace sstr {
+
+    /// 分块布隆过滤器
+    /// \note 位数组按 64 字节（一个缓存行）分块，键的哈希先选定一块，其余各位都在块内，
+    ///       一次查询最多一次缓存未命中。键只用 getHashFromBytes 计算一次 64 位哈希，
+    ///       块号与块内各位由其高低位以双重哈希导出。不存在假阴性；不支持删除
+    /// \code
+    /// SStringBloomFilter filter(1000000, 0.01);
+    /// filter.insert(SStringView("key"));
+    /// if (filter.mayContain(SStringView("key"))) { ... }
+    /// \endcode
+    class API SStringBloomFilter final {
+    public:
+        /// \param expected 预计加入的键的个数
+        /// \param falsePositiveRate 期望的假阳性率，取值 (0, 1)
+        explicit SStringBloomFilter(size_t expected, double falsePositiveRate = 0.01);
+        /// 拷贝时按新缓冲区重新对齐块区
+        SStringBloomFilter(const SStringBloomFilter &filter);
+        SStringBloomFilter(SStringBloomFilter &&filter) noexcept = default;
+
+        SStringBloomFilter &operator=(const SStringBloomFilter &filter);
+        SStringBloomFilter &operator=(SStringBloomFilter &&filter) = default;
+
+        /// 位数
+        size_t bits() const;
+        /// 每个键置位的个数
+        int hashes() const;
+
+        void insert(const SStringView &key);
+        void insert(const SStringColumn &keys);
+
+        /// 键是否可能存在
+        /// \retval false 一定不存在
+        /// \retval true 可能存在
+        bool mayContain(const SStringView &key) const;
+
+        /// 批量查询
+        /// \note 先计算一批键的哈希并预取对应的块，再依次检查，使各次缓存未命中重叠
+        /// \return 第 i 位表示第 i 个键可能存在
+        SBitmap mayContain(const SStringColumn &keys) const;
+        SBitmap mayContain(const std::vector<SStringView> &keys) const;
+
+        void clear();
+
+    private:
+        /// 块号
+        size_t getBlock(uint64_t hash) const;
+        bool test(uint64_t hash) const;
+        /// 预取一组哈希对应的块后依次检查，结果写入 bits 的第 offset 位起
+        void testBatch(const uint64_t *hashes, size_t count, uint64_t *bits, size_t offset) const;
+
+        /// 每块 8 个 64 位字，块区从缓冲区中首个按 64 字节对齐的位置开始，
+        /// 对齐位置随缓冲区地址变化，不能逐字拷贝
+        std::vector<uint64_t> _words;
+        size_t _blocks;
+        int _hashes;
+    };
+
+}// namespace sstr
@@ -35,6 +35,7 @@ namespace sstr {
         int32_t find(const SStringView &str) const;
         void append(const char *str);
         void append(const SStringView &str);
+        void append(SChar ch);
         
         // 不会支持
         // std::vector<SString> split(const char *str) const;
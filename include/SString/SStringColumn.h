@@ -0,0 +1,97 @@
+/// \file SStringColumn.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief 包含 SStringColumn，连续存储的字符串列及其批量操作
+
+#pragma once
+#include <SString/SBitmap.h>
+#include <SString/SString.h>
+
+namespace sstr {
+
+    /// 字符串列
+    /// \note 所有值存放在一块连续缓冲区中，另以偏移数组记录每个值的起始位置；
+    ///       每个值后附带 '\0'，因此 at() 返回的视图可直接用于 SStringView 的全部操作。
+    ///       偏移使用 32 位，缓冲区总大小（含每行结尾的 '\0'）不能超过 4 GiB - 1，
+    ///       超出时 append 拒绝追加，生成副本的操作返回空列
+    class API SStringColumn final {
+        // 构造相关
+    public:
+        SStringColumn();
+        /// \note 缓冲区超出上限时，该行及其后各行不会加入
+        explicit SStringColumn(const std::vector<SString> &strings);
+
+        // 基础功能
+    public:
+        /// 行数
+        size_t size() const;
+        bool empty() const;
+        /// 缓冲区字节数（含每行结尾的 '\0'）
+        size_t bytes() const;
+
+        /// 预留空间
+        /// \param count 行数
+        /// \param bytes 字节数
+        void reserve(size_t count, size_t bytes);
+        /// 在末尾追加一行
+        /// \return 缓冲区超出上限时返回 false，列保持不变
+        bool append(const SStringView &str);
+        bool append(const char *u8str);
+        void clear();
+
+        SStringView at(size_t index) const;
+        /// 缓冲区指针
+        const char *data() const;
+        /// 偏移数组，共 size() + 1 项
+        const uint32_t *offsets() const;
+
+        // 批量操作
+    public:
+        /// 每行字符个数
+        std::vector<uint32_t> len() const;
+
+        /// 每行的终端显示宽度
+        /// \param ambiguousWide 宽度不定的字符是否按 2 列计算
+        std::vector<uint32_t> displayWidth(bool ambiguousWide = false) const;
+        /// 创建每行截断或以空格填充到恰好 width 列的副本，用于等宽排版
+        /// \note 截断处的宽字符放不下时以空格补齐
+        /// \param width 显示列数
+        /// \param ambiguousWide 宽度不定的字符是否按 2 列计算
+        SStringColumn fitWidth(size_t width, bool ambiguousWide = false) const;
+
+        /// 创建字母转为全小写的副本
+        SStringColumn toLower() const;
+        /// 创建字母转为全大写的副本
+        SStringColumn toUpper() const;
+
+        /// 在每行中查找子串，索引单位是字数
+        /// \param str 子串
+        /// \return 每行的子串位置，不存在为 -1
+        std::vector<int32_t> find(const SStringView &str) const;
+
+        /// 每行是否包含子串
+        SBitmap contains(const SStringView &str) const;
+
+        /// 每行是否等于给定值
+        SBitmap equals(const SStringView &str) const;
+
+        /// 每行的自然顺序排序键，见 SStringView::naturalSortKey
+        SStringColumn naturalSortKeys() const;
+        /// 按自然顺序稳定排序后的行号
+        /// \note 先生成紧凑的排序键，再按字节比较排序
+        std::vector<uint32_t> sortNatural() const;
+
+        /// 每行的哈希值
+        /// \param seed 种子
+        std::vector<uint64_t> hash(uint64_t seed = 0) const;
+
+    public:
+        SStringView operator[](size_t index) const;
+
+    private:
+        std::vector<char> _data;
+        std::vector<uint32_t> _offsets;
+    };
+
+}// namespace sstr
@@ -0,0 +1,115 @@
+/// \file SStringCompressedColumn.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief 包含 SStringSymbolTable 与 SStringCompressedColumn，基于静态符号表（FSST）的字符串压缩存储
+
+#pragma once
+#include <SString/SString.h>
+
+namespace sstr {
+
+    /// 静态符号表
+    /// \note 最多 255 个 1~8 字节的高频子串，编码 255 为转义符，其后跟随一个原始字节。
+    ///       编码总是贪心取最长匹配，因此相同字符串的编码结果一定相同
+    class API SStringSymbolTable final {
+    public:
+        SStringSymbolTable();
+
+        /// 从样本训练符号表
+        /// \param sample 样本字符串
+        /// \param rounds 迭代轮数
+        /// \return 训练得到的符号表
+        static SStringSymbolTable train(const std::vector<SStringView> &sample, int rounds = 5);
+        static SStringSymbolTable train(const std::vector<SString> &sample, int rounds = 5);
+
+    public:
+        /// 符号个数
+        size_t size() const;
+        /// 获取符号
+        SString symbol(size_t code) const;
+
+        /// 压缩
+        /// \param str 原始字符串
+        /// \param dst 写入位置，至少需要 2 * str.size() 字节
+        /// \return 压缩后字节数
+        size_t encode(const SStringView &str, uint8_t *dst) const;
+
+        /// 计算解压后的字节数
+        /// \param src 压缩数据
+        /// \param size 压缩字节数
+        size_t getDecodedSize(const uint8_t *src, size_t size) const;
+
+        /// 解压
+        /// \param src 压缩数据
+        /// \param size 压缩字节数
+        /// \param dst 写入位置，至少需要解压后字节数 + 8 字节
+        /// \return 解压后字节数
+        size_t decode(const uint8_t *src, size_t size, char *dst) const;
+
+    private:
+        /// 查找最长匹配的符号
+        /// \return 符号编码，无匹配返回 -1
+        int findLongest(const char *p, size_t n) const;
+        void add(uint64_t value, uint8_t len);
+        void build();
+
+        /// 符号内容，小端存放，不足 8 字节补 0
+        uint64_t _symbols[255];
+        uint8_t _lens[255];
+        size_t _size = 0;
+        /// 按首字节分组、组内按长度降序排列的符号编码
+        std::vector<uint8_t> _buckets[256];
+    };
+
+    /// 压缩字符串列
+    /// \note 每个字符串独立压缩，支持随机访问解压，以及在压缩形式上直接做相等比较
+    class API SStringCompressedColumn final {
+        // 构造相关
+    public:
+        explicit SStringCompressedColumn(const SStringSymbolTable &table);
+
+        // 基础功能
+    public:
+        /// 行数
+        size_t size() const;
+        bool empty() const;
+        /// 压缩后总字节数
+        size_t bytes() const;
+        const SStringSymbolTable &table() const;
+
+        void append(const SStringView &str);
+        void append(const char *u8str);
+        void clear();
+
+        /// 解压指定行
+        SString at(size_t index) const;
+
+        /// 解压指定行到缓冲区
+        /// \param index 行号
+        /// \param dst 写入位置，至少需要 size(index) + 8 字节
+        /// \return 解压后字节数
+        size_t decompress(size_t index, char *dst) const;
+
+        /// 获取指定行解压后的字节数
+        size_t size(size_t index) const;
+
+        // 压缩形式上的操作
+    public:
+        /// 指定行是否等于给定值
+        bool equals(size_t index, const SStringView &str) const;
+
+        /// 查找首个等于给定值的行
+        /// \return 行号，不存在返回 -1
+        int64_t find(const SStringView &str) const;
+
+    public:
+        SString operator[](size_t index) const;
+
+    private:
+        SStringSymbolTable _table;
+        std::vector<uint8_t> _data;
+        std::vector<uint32_t> _offsets;
+    };
+
+}// namespace sstr
@@ -0,0 +1,64 @@
+/// \file SStringCuckooFilter.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief 包含 SStringCuckooFilter，以字符串为键、支持删除的布谷鸟过滤器
+
+#pragma once
+#include <SString/SBitmap.h>
+#include <SString/SStringColumn.h>
+
+namespace sstr {
+
+    /// 布谷鸟过滤器
+    /// \note 每个桶 4 个 16 位指纹，恰好占一个 64 位字，桶内查找用按字并行的比较完成；
+    ///       键的两个候选桶由 getHashFromBytes 的一次哈希与指纹导出（部分键布谷鸟哈希），
+    ///       查询最多访问两个桶。假阳性率约 8 / 65536；与布隆过滤器相比可以删除，
+    ///       但只能删除确实加入过的键，装满时 insert 返回 false
+    class API SStringCuckooFilter final {
+    public:
+        /// \param capacity 预计容纳的键的个数
+        explicit SStringCuckooFilter(size_t capacity);
+
+        /// 已加入的键的个数
+        size_t size() const;
+        /// 指纹槽位总数
+        size_t capacity() const;
+
+        /// 加入键
+        /// \retval true 成功
+        /// \retval false 过滤器已满，之后的加入都会失败，已加入的键仍可查询
+        bool insert(const SStringView &key);
+
+        /// 删除一个加入过的键，同一个键加入多次时需删除同样次数
+        /// \return 是否找到
+        bool erase(const SStringView &key);
+
+        /// 键是否可能存在
+        bool mayContain(const SStringView &key) const;
+
+        /// 批量查询，一组键的候选桶预取后再检查
+        /// \return 第 i 位表示第 i 个键可能存在
+        SBitmap mayContain(const SStringColumn &keys) const;
+        SBitmap mayContain(const std::vector<SStringView> &keys) const;
+
+        void clear();
+
+    private:
+        /// 由哈希得到指纹与两个候选桶
+        void locate(uint64_t hash, uint16_t &fingerprint, size_t &first, size_t &second) const;
+        size_t getAlternate(size_t bucket, uint16_t fingerprint) const;
+        bool test(uint64_t hash) const;
+        void testBatch(const uint64_t *hashes, size_t count, uint64_t *bits, size_t offset) const;
+
+        /// 每个桶一个 64 位字，指纹 0 表示空位
+        std::vector<uint64_t> _buckets;
+        size_t _size = 0;
+        /// 踢出时选择槽位的随机数状态
+        uint64_t _random = 0x2545f4914f6cdd1dull;
+        /// 装满时无处安放的最后一个指纹
+        uint16_t _victim = 0;
+        size_t _victimBucket = 0;
+    };
+
+}// namespace sstr
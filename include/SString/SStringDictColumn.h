@@ -0,0 +1,87 @@
+/// \file SStringDictColumn.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief 包含 SStringDictColumn，低基数字符串列的字典编码
+
+#pragma once
+#include <SString/SStringColumn.h>
+
+namespace sstr {
+
+    /// 字典编码的字符串列
+    /// \note 不同的值只在字典中保存一次，每行只保存其编码；
+    ///       编码宽度随字典大小在 1、2、4 字节之间自动扩展，
+    ///       比较、过滤与分组均直接在编码上完成，不访问字符串内容
+    class API SStringDictColumn final {
+        // 构造相关
+    public:
+        SStringDictColumn();
+        explicit SStringDictColumn(const SStringColumn &column);
+        explicit SStringDictColumn(const std::vector<SString> &strings);
+
+        // 基础功能
+    public:
+        /// 行数
+        size_t size() const;
+        bool empty() const;
+        /// 编码宽度（字节）
+        size_t width() const;
+
+        void reserve(size_t count);
+        /// 在末尾追加一行
+        /// \return 字典缓冲区超出 SStringColumn 的上限时返回 false，列保持不变
+        bool append(const SStringView &str);
+        bool append(const char *u8str);
+        void clear();
+
+        SStringView at(size_t index) const;
+        /// 获取指定行的编码，越界返回 -1
+        int64_t codeAt(size_t index) const;
+        /// 获取值对应的编码，值不在字典中返回 -1
+        int64_t code(const SStringView &str) const;
+        /// 字典，第 i 项为编码 i 对应的值
+        const SStringColumn &dictionary() const;
+
+        // 批量操作
+    public:
+        /// 每行是否等于给定值
+        SBitmap equals(const SStringView &str) const;
+        /// 每行是否等于给定值之一
+        SBitmap in(const std::vector<SStringView> &values) const;
+        /// 每行是否等于给定编码
+        SBitmap equalsCode(uint32_t code) const;
+        /// 两行是否相等
+        bool equals(size_t i, size_t j) const;
+
+        /// 按编码分组计数
+        /// \return 第 i 项为编码 i 的行数
+        std::vector<size_t> countByCode() const;
+
+        /// 导出全部编码
+        std::vector<uint32_t> codes() const;
+
+    public:
+        SStringView operator[](size_t index) const;
+
+    private:
+        /// \return 编码，字典已满时返回 -1
+        uint32_t insertValue(const SStringView &str);
+        void rehash(size_t capacity);
+        void widen(size_t width);
+
+        /// 字典值
+        SStringColumn _dictionary;
+        /// 字典值的哈希，避免探测时比较字符串
+        std::vector<uint64_t> _hashes;
+        /// 开放寻址哈希表，保存编码，空槽为 UINT32_MAX
+        std::vector<uint32_t> _slots;
+        /// 行编码，按当前宽度只使用其中之一
+        std::vector<uint8_t> _codes8;
+        std::vector<uint16_t> _codes16;
+        std::vector<uint32_t> _codes32;
+        size_t _width = 1;
+        size_t _size = 0;
+    };
+
+}// namespace sstr
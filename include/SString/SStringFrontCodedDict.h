@@ -0,0 +1,104 @@
+/// \file SStringFrontCodedDict.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief 包含 SStringFrontCodedDict，前缀压缩的有序字符串字典
+
+#pragma once
+#include <SString/SMappedFile.h>
+#include <SString/SString.h>
+
+namespace sstr {
+
+    /// 前缀压缩（front coding）的不可变有序字典
+    /// \note 字符串按字节序分块，每块首个字符串完整保存，其余只保存与前一项的公共前缀长度和剩余后缀；
+    ///       块首偏移表用于二分查找。内存中的表示即序列化格式（本机字节序，8 字节对齐）：
+    ///       头部 32 字节 | uint64 块偏移表 blockCount + 1 项 | 块数据（长度均为 LEB128 变长整数）。
+    ///       整数按原样读写，在字节序不同的机器上 attach 会因版本号不符而返回 false
+    class API SStringFrontCodedDict final {
+        // 构造相关
+    public:
+        SStringFrontCodedDict() noexcept = default;
+        SStringFrontCodedDict(const SStringFrontCodedDict &dict) = delete;
+        SStringFrontCodedDict(SStringFrontCodedDict &&dict) noexcept;
+
+        SStringFrontCodedDict &operator=(const SStringFrontCodedDict &dict) = delete;
+        SStringFrontCodedDict &operator=(SStringFrontCodedDict &&dict) noexcept;
+
+        /// 从有序字符串构建
+        /// \param sorted 按字节序严格递增的字符串
+        /// \param blockSize 每块字符串个数
+        /// \return 是否成功，输入未严格递增时失败
+        bool build(const std::vector<SStringView> &sorted, uint32_t blockSize = 16);
+        bool build(const std::vector<SString> &sorted, uint32_t blockSize = 16);
+
+        // 序列化
+    public:
+        /// 获取序列化数据
+        SStringView image() const;
+        /// 写入文件
+        bool write(const char *path) const;
+
+        /// 直接引用内存中的序列化数据，不拷贝
+        /// \warning 调用方需保证数据在字典的生命周期内有效，且按 8 字节对齐
+        /// \param data 序列化数据
+        /// \param size 数据字节数
+        /// \param verify 是否校验 CRC32
+        /// \return 数据是否合法
+        bool open(const char *data, size_t size, bool verify = false);
+        /// 读取文件到一块连续缓冲区
+        bool load(const char *path, bool verify = false);
+        /// 以内存映射方式打开文件
+        bool map(const char *path, bool verify = false);
+        void close();
+
+        // 查询
+    public:
+        /// 字符串个数
+        size_t size() const;
+        bool empty() const;
+
+        /// 查找字符串编号
+        /// \param key 字符串
+        /// \return 编号，不存在返回 -1
+        int64_t lookup(const SStringView &key) const;
+
+        /// 获取指定编号的字符串
+        /// \param id 编号
+        /// \return 字符串，越界返回空字符串
+        SString locate(size_t id) const;
+
+        /// 第一个不小于 key 的编号
+        /// \return 编号，不存在返回 size()
+        size_t lowerBound(const SStringView &key) const;
+
+        /// 获取以 prefix 开头的编号区间 [begin, end)
+        /// \param prefix 前缀
+        /// \param begin 起始编号
+        /// \param end 结束编号
+        void prefixRange(const SStringView &prefix, size_t &begin, size_t &end) const;
+
+        /// 依次枚举以 prefix 开头的字符串
+        /// \param prefix 前缀
+        /// \param callback 回调，返回 false 时停止枚举；视图只在回调期间有效
+        void forEachPrefix(const SStringView &prefix, const std::function<bool(size_t, const SStringView &)> &callback) const;
+
+    private:
+        bool attach(const char *data, size_t size, bool verify);
+        SStringView firstOf(size_t block) const;
+        size_t findBlock(const SStringView &key) const;
+
+        const char *_base = nullptr;
+        size_t _bytes = 0;
+        const uint64_t *_blocks = nullptr;
+        const char *_strings = nullptr;
+        size_t _count = 0;
+        size_t _blockCount = 0;
+        uint32_t _blockSize = 0;
+        /// build 与 load 持有的数据
+        SString _buffer;
+        /// map 持有的映射
+        SMappedFile _file;
+    };
+
+}// namespace sstr
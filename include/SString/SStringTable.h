@@ -0,0 +1,105 @@
+/// \file SStringTable.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief 包含 SStringTable，字符串集合的紧凑二进制序列化格式
+
+#pragma once
+#include <SString/SMappedFile.h>
+#include <SString/SString.h>
+
+namespace sstr {
+
+    /// 字符串集合的只读表
+    /// \note 文件布局（本机字节序，8 字节对齐）：
+    ///       头部 24 字节 | uint64 偏移表 count + 1 项 | 字符串数据（每项以 '\0' 结尾）
+    ///       为了零拷贝访问，整数不做字节序转换；字节序不同的机器上版本号校验不通过，打开失败
+    ///       加载后通过 SStringView 零拷贝访问，整个表只占用一块连续内存
+    class API SStringTable final {
+        // 构造相关
+    public:
+        SStringTable() noexcept = default;
+        SStringTable(const SStringTable &table) = delete;
+        SStringTable(SStringTable &&table) noexcept;
+        ~SStringTable();
+
+        SStringTable &operator=(const SStringTable &table) = delete;
+        SStringTable &operator=(SStringTable &&table) noexcept;
+
+        // 序列化
+    public:
+        /// 序列化到内存
+        /// \param strings 字符串集合
+        /// \param checksum 是否写入 CRC32 校验和
+        /// \return 序列化结果，字符串超过 UINT32_MAX 个时为空
+        static SString serialize(const std::vector<SString> &strings, bool checksum = false);
+        static SString serialize(const std::vector<SStringView> &strings, bool checksum = false);
+
+        /// 序列化到文件
+        /// \param path 文件路径
+        /// \param strings 字符串集合
+        /// \param checksum 是否写入 CRC32 校验和
+        /// \return 是否成功，字符串超过 UINT32_MAX 个时失败
+        static bool write(const char *path, const std::vector<SString> &strings, bool checksum = false);
+        static bool write(const char *path, const std::vector<SStringView> &strings, bool checksum = false);
+
+        // 加载
+    public:
+        /// 直接引用内存中的序列化数据，不拷贝
+        /// \warning 调用方需保证数据在表的生命周期内有效，且按 8 字节对齐
+        /// \param data 序列化数据
+        /// \param size 数据字节数
+        /// \return 数据是否合法
+        bool open(const char *data, size_t size);
+
+        /// 读取文件到一块连续缓冲区
+        /// \param path 文件路径
+        /// \return 是否成功
+        bool load(const char *path);
+
+        /// 以内存映射方式打开文件，零拷贝访问
+        /// \param path 文件路径
+        /// \return 是否成功
+        bool map(const char *path);
+
+        /// 释放数据
+        void close();
+
+        // 访问
+    public:
+        /// 获取字符串个数
+        size_t size() const;
+        bool empty() const;
+        /// 是否带有校验和
+        bool checksummed() const;
+
+        /// 获取指定字符串，越界返回空视图
+        /// \note 返回的视图以 '\0' 结尾
+        SStringView at(size_t index) const;
+        SStringView operator[](size_t index) const;
+
+        /// 拷贝为独立的字符串集合
+        std::vector<SString> toVector() const;
+
+    private:
+        bool attach(const char *data, size_t size);
+
+        /// 数据起始位置
+        const char *_base = nullptr;
+        /// 数据字节数
+        size_t _bytes = 0;
+        /// 偏移表
+        const uint64_t *_offsets = nullptr;
+        /// 字符串数据区
+        const char *_strings = nullptr;
+        /// 字符串个数
+        size_t _count = 0;
+        /// 标志位
+        uint16_t _flags = 0;
+        /// load 持有的缓冲区
+        char *_buffer = nullptr;
+        /// map 持有的映射
+        SMappedFile _file;
+    };
+
+}// namespace sstr
@@ -0,0 +1,70 @@
+/// \file STransformView.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief 包含 STransformView，可组合的惰性字符串变换
+
+#pragma once
+#include <SString/SString.h>
+#include <functional>
+#include <vector>
+
+namespace sstr {
+
+    /// 惰性变换视图
+    /// \note 链式调用只记录变换步骤，不读取也不复制数据；迭代或生成结果时才对源字符串做一次遍历，
+    ///       每个字符依次经过全部步骤后直接写入最终缓冲区，不产生中间字符串。
+    ///       位于最前面的 trim 与 substring 直接收窄源字符串的范围，substring 取满后提前结束遍历。
+    ///       大小写转换与 SStringView::toLower 一致，只转换 ASCII 字母；非法 UTF-8 字节原样保留。
+    ///       源字符串、replace 与 filter 的参数需在视图使用期间保持有效
+    /// \code
+    /// auto title = STransformView(s).trim().toLower().substring(0, 64).materialize();
+    /// \endcode
+    class API STransformView final {
+    public:
+        explicit STransformView(const SStringView &source) noexcept;
+
+        /// 除去两端的空白字符（Unicode White_Space）
+        STransformView trim() const;
+        /// 字母转为全小写
+        STransformView toLower() const;
+        /// 字母转为全大写
+        STransformView toUpper() const;
+        /// 截取子串 [begin, begin + len - 1]，索引单位是字数
+        STransformView substring(size_t begin, size_t len = SIZE_MAX) const;
+        /// 从左到右替换所有不重叠的 from
+        /// \param from 被替换的字符串，为空时不做处理
+        /// \param to 替换为的字符串
+        STransformView replace(const SStringView &from, const SStringView &to) const;
+        /// 只保留 predicate 返回 true 的字符
+        /// \note 非法字节以 U+FFFD 传入
+        STransformView filter(const std::function<bool(SChar)> &predicate) const;
+
+        /// 依次访问结果中的每个字符
+        /// \param callback 返回 false 时停止
+        void forEach(const std::function<bool(SChar)> &callback) const;
+        /// 生成结果
+        SString materialize() const;
+        /// 生成结果，结果覆盖 out，批量处理时可复用 out 的缓冲区
+        /// \param out 输出，不能与源字符串重叠
+        void materialize(SString &out) const;
+
+        const SStringView &source() const;
+
+    private:
+        friend class STransformPipeline;
+
+        struct Step {
+            enum Type : uint8_t { Trim, Lower, Upper, Substring, Replace, Filter } type;
+            size_t begin, len;
+            SStringView from, to;
+            std::function<bool(SChar)> predicate;
+        };
+
+        STransformView append(Step step) const;
+
+        SStringView _source;
+        std::vector<Step> _steps;
+    };
+
+}// namespace sstr
@@ -9,6 +9,15 @@
 #include <cstdint>
 #include <vector>
 
+// x64 下 SSE2 必然可用，x86 视编译选项而定
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SSTR_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
 namespace sstr {
 
     struct SChar;
@@ -23,6 +32,121 @@ namespace sstr {
 
     extern int NORMAL(const char *str, const char *sub);
 
+    /// 在定长字节串中查找子串
+    /// \param str 字节串
+    /// \param size 字节数
+    /// \param sub 子串
+    /// \param subSize 子串字节数
+    /// \return 子串字节偏移，不存在返回 -1
+    extern int64_t FindBytes(const char *str, size_t size, const char *sub, size_t subSize);
+
+    /// 统计定长 UTF-8 字节串中的字符数（非续字节个数）
+    /// \param str 字节串
+    /// \param size 字节数
+    /// \return 字符数
+    extern size_t CountUTF8Chars(const char *str, size_t size);
+
+    /// 计算 CRC-32（IEEE 802.3）
+    /// \param data 数据
+    /// \param size 字节数
+    /// \param crc 上一段数据的结果，用于分段计算
+    /// \return 校验和
+    extern uint32_t CRC32(const void *data, size_t size, uint32_t crc = 0);
+
+    /// 自然顺序比较，连续的 ASCII 数字按数值比较，其余按字节比较
+    /// \return 小于 0、等于 0、大于 0 分别表示 a 在 b 前、相同、在 b 后
+    extern int CompareNatural(const char *a, size_t aSize, const char *b, size_t bSize);
+
+    /// 生成自然顺序排序键，键之间按字节比较的结果与 CompareNatural 一致
+    /// \param str 字节串
+    /// \param size 字节数
+    /// \param key 输出，需保证至少 size * 3 + 1 字节可用空间
+    /// \return 键的字节数
+    extern size_t NaturalSortKey(const char *str, size_t size, char *key);
+
+    /// 统计置位个数
+    inline int PopCount(uint32_t mask) {
+#ifdef _MSC_VER
+        return (int) __popcnt(mask);
+#else
+        return __builtin_popcount(mask);
+#endif
+    }
+
+    /// 统计低位连续 0 的个数
+    /// \param mask 非 0 掩码
+    /// \return 最低位 1 的位置
+    inline int CountTrailingZeros(uint32_t mask) {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return (int) index;
+#else
+        return __builtin_ctz(mask);
+#endif
+    }
+
+    /// 统计高位连续 0 的个数
+    /// \param mask 非 0 掩码
+    /// \return 31 减去最高位 1 的位置
+    inline int CountLeadingZeros(uint32_t mask) {
+#ifdef _MSC_VER
+        unsigned long index;
+        _BitScanReverse(&index, mask);
+        return 31 - (int) index;
+#else
+        return __builtin_clz(mask);
+#endif
+    }
+
+    /// 预取一个缓存行到各级缓存，不支持时为空操作
+    inline void Prefetch(const void *p) {
+#ifdef SSTR_SSE2
+        _mm_prefetch((const char *) p, _MM_HINT_T0);
+#elif defined(__GNUC__)
+        __builtin_prefetch(p);
+#else
+        (void) p;
+#endif
+    }
+
+    /// 解码一个 UTF-8 字符
+    /// \param p 起始位置
+    /// \param end 字节串结尾
+    /// \param n 该字符占用的字节数，非法或截断的序列按 1 字节处理
+    /// \return 码点，非法序列返回 U+FFFD；过长编码、代理项与超过 U+10FFFF 的序列同样视为非法
+    inline uint32_t DecodeUTF8(const char *p, const char *end, int &n) {
+        auto ch = (unsigned char) *p;
+        n = 1;
+        if (ch < 0x80) return ch;
+
+        int size;
+        uint32_t code;
+        if ((ch & 0xe0) == 0xc0) {
+            size = 2;
+            code = ch & 0x1f;
+        } else if ((ch & 0xf0) == 0xe0) {
+            size = 3;
+            code = ch & 0x0f;
+        } else if ((ch & 0xf8) == 0xf0) {
+            size = 4;
+            code = ch & 0x07;
+        } else {
+            return 0xfffd;
+        }
+        if (end - p < size) return 0xfffd;
+        for (int i = 1; i < size; i++) {
+            auto next = (unsigned char) p[i];
+            if ((next & 0xc0) != 0x80) return 0xfffd;
+            code = code << 6 | (next & 0x3f);
+        }
+        // 过长编码、代理项与超范围字符
+        static const uint32_t minimum[5] = {0, 0, 0x80, 0x800, 0x10000};
+        if (code < minimum[size] || (code >= 0xd800 && code <= 0xdfff) || code > 0x10ffff) return 0xfffd;
+        n = size;
+        return code;
+    }
+
     /// 对目标缓存的元素左移
     /// \warning 使用时务必判断数组是否可能越界
     /// \tparam T 元素类型
@@ -32,7 +156,7 @@ namespace sstr {
     /// \param count 移动距离
     template<typename T>
     inline void LeftShiftElement(T *header, size_t len, size_t begin, size_t count) {
-        for (size_t i = 0; i < len - begin; i++) {
+        for (size_t i = 0; i + count < len - begin; i++) {
             header[begin + i] = header[begin + count + i];
         }
     }
@@ -0,0 +1,52 @@
+/// \file diff.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief 基于 Myers O(ND) 算法的文本差异与编辑脚本
+
+#pragma once
+#include <SString/SString.h>
+#include <SString/SStringBuilder.h>
+#include <vector>
+
+namespace sstr {
+
+    /// 差异的比较单位
+    enum class SDiffUnit : uint8_t {
+        /// 逐字符（码点）比较
+        Char,
+        /// 逐行比较，行包含结尾的 '\n'
+        Line,
+    };
+
+    /// 一处编辑：将原文中从第 begin 个字符起的 len 个字符替换为 text
+    /// \note 索引单位是字数，与 SStringBuilder 一致；按行比较时同样换算为字符索引
+    struct API SEdit {
+        size_t begin = 0;
+        size_t len = 0;
+        SString text;
+    };
+
+    /// 计算把 from 变为 to 的编辑脚本
+    /// \note 每层递归先去除公共前缀与后缀，再用中间蛇（middle snake）二分，空间与输入长度成线性；
+    ///       结果按 begin 升序且互不重叠，相邻的删除与插入合并为一处替换。
+    ///       按行比较时相同的行先映射为同一编号，非法 UTF-8 字节按 U+FFFD 处理
+    /// \param from 原文
+    /// \param to 新文本
+    /// \param unit 比较单位
+    /// \return 编辑脚本，from 与 to 相同时为空
+    extern API std::vector<SEdit> getDiff(const SStringView &from, const SStringView &to, SDiffUnit unit = SDiffUnit::Char);
+    extern API std::vector<SEdit> getDiff(const SStringView &from, const SStringBuilder &to, SDiffUnit unit = SDiffUnit::Char);
+    extern API std::vector<SEdit> getDiff(const SStringBuilder &from, const SStringBuilder &to, SDiffUnit unit = SDiffUnit::Char);
+
+    /// 对 builder 应用编辑脚本
+    /// \note 从后向前依次调用 SStringBuilder::replace，位于末尾的插入使用 append
+    /// \param builder 内容需与计算脚本时的原文相同
+    /// \param edits getDiff 的结果
+    extern API void applyDiff(SStringBuilder &builder, const std::vector<SEdit> &edits);
+
+    /// 对字符串应用编辑脚本
+    /// \return 结果
+    extern API SString applyDiff(const SStringView &str, const std::vector<SEdit> &edits);
+
+}// namespace sstr
@@ -0,0 +1,61 @@
+/// \file encoding.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief Base64 与十六进制编解码
+
+#pragma once
+#include <SString/SString.h>
+
+namespace sstr {
+
+    /// 计算 Base64 编码后的字节数
+    /// \param size 原始字节数
+    /// \param padding 是否补齐 '='
+    /// \return 编码后字节数
+    extern API size_t getBase64EncodedSize(size_t size, bool padding = true);
+
+    /// 计算 Base64 解码后的字节数
+    /// \note 输入不含空白字符时结果精确，否则为上界
+    /// \param str 编码字符串
+    /// \return 解码后字节数
+    extern API size_t getBase64DecodedSize(const SStringView &str);
+
+    /// 标准 Base64 编码（RFC 4648 §4），补齐 '='
+    /// \param data 原始字节串
+    /// \return 编码结果
+    extern API SString base64Encode(const SStringView &data);
+
+    /// URL 安全 Base64 编码（RFC 4648 §5），不补齐 '='
+    /// \param data 原始字节串
+    /// \return 编码结果
+    extern API SString base64UrlEncode(const SStringView &data);
+
+    /// 标准 Base64 解码
+    /// \note 忽略空白字符，'=' 可省略
+    /// \param str 编码字符串
+    /// \param out 输出目标，原有内容会被覆盖
+    /// \return 是否成功
+    extern API bool base64Decode(const SStringView &str, SString &out);
+
+    /// URL 安全 Base64 解码
+    /// \note 忽略空白字符，'=' 可省略
+    /// \param str 编码字符串
+    /// \param out 输出目标，原有内容会被覆盖
+    /// \return 是否成功
+    extern API bool base64UrlDecode(const SStringView &str, SString &out);
+
+    /// 十六进制编码
+    /// \param data 原始字节串
+    /// \param upper 是否使用大写字母
+    /// \return 编码结果
+    extern API SString hexEncode(const SStringView &data, bool upper = false);
+
+    /// 十六进制解码，大小写均可
+    /// \note 忽略空白字符
+    /// \param str 编码字符串
+    /// \param out 输出目标，原有内容会被覆盖
+    /// \return 是否成功
+    extern API bool hexDecode(const SStringView &str, SString &out);
+
+}// namespace sstr
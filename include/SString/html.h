@@ -0,0 +1,40 @@
+/// \file html.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief HTML/XML 实体转义与反转义
+
+#pragma once
+#include <SString/SString.h>
+
+namespace sstr {
+
+    /// 计算 HTML 转义后的字节数
+    /// \param str 原始字符串
+    /// \return 转义后字节数，与原字节数相同即无需转义
+    extern API size_t getEscapedHtmlSize(const SStringView &str);
+
+    /// HTML 转义 '<'、'>'、'&'、'"'、'\''
+    /// \param str 原始字符串
+    /// \return 转义结果
+    extern API SString escapeHtml(const SStringView &str);
+
+    /// 原地 HTML 转义
+    /// \note 无需转义时不会发生分配
+    /// \param str 目标字符串
+    /// \return 内容是否发生变化
+    extern API bool escapeHtmlInPlace(SString &str);
+
+    /// HTML 反转义，支持 HTML 4 命名实体、&apos; 与数字实体
+    /// \note 无法识别的实体原样保留，非法码点替换为 U+FFFD
+    /// \param str 转义字符串
+    /// \return 反转义结果
+    extern API SString unescapeHtml(const SStringView &str);
+
+    /// 原地 HTML 反转义
+    /// \note 反转义结果不会变长，因此始终不会发生分配
+    /// \param str 目标字符串
+    /// \return 内容是否发生变化
+    extern API bool unescapeHtmlInPlace(SString &str);
+
+}// namespace sstr
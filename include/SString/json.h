@@ -0,0 +1,38 @@
+/// \file json.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief JSON 字符串转义与反转义
+
+#pragma once
+#include <SString/SString.h>
+#include <SString/SStringBuilder.h>
+
+namespace sstr {
+
+    /// 计算 JSON 转义后的字节数
+    /// \param str 原始字符串
+    /// \return 转义后字节数（不含两端引号），非法 UTF-8 字节按 U+FFFD 计算
+    extern API size_t getEscapedJsonSize(const SStringView &str);
+
+    /// JSON 字符串转义，不添加两端引号
+    /// \note 转义 '"'、'\\' 与控制字符，非 ASCII 字符原样保留；非法 UTF-8 字节（含过长编码、
+    ///       代理项与超过 U+10FFFF 的序列）逐字节替换为 U+FFFD，保证结果是合法的 JSON 字符串
+    /// \param str 原始字符串
+    /// \return 转义结果
+    extern API SString escapeJson(const SStringView &str);
+
+    /// JSON 字符串转义，结果尾加到 builder
+    /// \note 非法 UTF-8 字节的处理与 escapeJson(str) 相同
+    /// \param str 原始字符串
+    /// \param builder 输出目标
+    extern API void escapeJson(const SStringView &str, SStringBuilder &builder);
+
+    /// JSON 字符串反转义，支持 \\uXXXX 及代理对
+    /// \param str 转义字符串（不含两端引号）
+    /// \param out 输出目标，原有内容会被覆盖，失败时为空
+    /// \retval true 成功
+    /// \retval false 非法转义序列或孤立代理项
+    extern API bool unescapeJson(const SStringView &str, SString &out);
+
+}// namespace sstr
@@ -0,0 +1,88 @@
+/// \file rolling.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief 滚动哈希（Rabin-Karp、Gear）、内容定义分块与等长多模式查找
+
+#pragma once
+#include <SString/SString.h>
+#include <functional>
+#include <vector>
+
+namespace sstr {
+
+    /// 计算 Rabin-Karp 多项式哈希，与 getRollingHashes 中同内容窗口的结果相同
+    /// \note h = Σ b[i]·B^(n-1-i) mod 2^64，只用于快速比较，不具备抗碰撞能力
+    /// \param str 字节串
+    /// \return 哈希值
+    extern API uint64_t getRabinKarpHash(const SStringView &str);
+
+    /// 计算每个长度为 window 字节的窗口的 Rabin-Karp 哈希
+    /// \note 输入较长时分成 4 段各自滚动，各段相互独立，便于乘法流水并行与向量化
+    /// \param str 字节串
+    /// \param window 窗口字节数
+    /// \param hashes 输出，第 i 项为 [i, i + window) 的哈希，需保证至少 size - window + 1 项可用空间
+    /// \return 窗口个数，window 为 0 或大于字节数时为 0
+    extern API size_t getRollingHashes(const SStringView &str, size_t window, uint64_t *hashes);
+    extern API std::vector<uint64_t> getRollingHashes(const SStringView &str, size_t window);
+
+    /// 获取下一个内容定义分块（CDC）边界
+    /// \note 使用 Gear 滚动哈希与 FastCDC 的归一化分块：未达到 avgSize 时使用更严格的掩码，
+    ///       超过后放宽，使块长集中在 avgSize 附近。是否在某处断开只取决于其前 64 字节，
+    ///       插入或删除内容后，其后的边界会重新对齐，适合去重与增量同步
+    /// \param str 字节串
+    /// \param pos 当前块的起始字节位置
+    /// \param minSize 最小块长，其前不做判断
+    /// \param avgSize 期望块长，会向上取为 2 的幂
+    /// \param maxSize 最大块长，达到时强制断开
+    /// \return 下一个边界的字节位置，剩余不足一块时返回 str.size()
+    extern API size_t getNextChunkBoundary(const SStringView &str, size_t pos,
+                                           size_t minSize = 2048, size_t avgSize = 8192, size_t maxSize = 65536);
+
+    /// 按内容定义分块切分
+    /// \return 引用原字符串的视图
+    extern API std::vector<SStringView> splitChunks(const SStringView &str,
+                                                    size_t minSize = 2048, size_t avgSize = 8192, size_t maxSize = 65536);
+
+    /// 基于 Rabin-Karp 的等长多模式查找
+    /// \note 模式的哈希存入开放寻址表，文本的窗口哈希沿文本滚动计算后查表，命中时再逐字节确认；
+    ///       耗时与文本长度成正比，与窗口长度和模式个数基本无关，适合大量等长模式（如指纹、固定长度的片段）
+    /// \code
+    /// SRabinKarpMatcher matcher({SStringView("alpha"), SStringView("gamma")});
+    /// matcher.forEachMatch(text, [](size_t offset, uint32_t pattern) { ...; return true; });
+    /// \endcode
+    class API SRabinKarpMatcher final {
+    public:
+        /// \param patterns 模式，字节数必须相同且不为 0，否则 valid() 为 false；内容会被复制
+        explicit SRabinKarpMatcher(const std::vector<SStringView> &patterns);
+
+        /// 模式是否有效
+        bool valid() const;
+        /// 模式个数
+        size_t size() const;
+        /// 模式的字节数
+        size_t window() const;
+
+        /// 查找第一个匹配
+        /// \param text 文本
+        /// \param pos 起始字节位置
+        /// \param pattern 输出匹配的模式序号，可为 nullptr；内容相同的模式取序号最小者
+        /// \return 匹配的字节偏移，不存在返回 -1
+        int64_t find(const SStringView &text, size_t pos = 0, uint32_t *pattern = nullptr) const;
+
+        /// 依次访问所有匹配（可重叠），同一位置按模式序号从小到大
+        /// \param text 文本
+        /// \param callback 参数为字节偏移与模式序号，返回 false 时停止
+        void forEachMatch(const SStringView &text, const std::function<bool(size_t, uint32_t)> &callback) const;
+
+    private:
+        size_t _window = 0;
+        size_t _count = 0;
+        /// 模式内容，依次连续存放
+        std::vector<char> _patterns;
+        /// 开放寻址表，存放模式序号加 1，0 为空
+        std::vector<uint32_t> _slots;
+        std::vector<uint64_t> _hashes;
+    };
+
+}// namespace sstr
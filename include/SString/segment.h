@@ -0,0 +1,139 @@
+/// \file segment.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief 文本分段（UAX #29），字素簇、单词与句子的切分与迭代
+
+#pragma once
+#include <SString/SString.h>
+#include <vector>
+
+namespace sstr {
+
+    /// 获取下一个字素簇边界
+    /// \note 规则基于 Unicode 14.0 的 UAX #29 扩展字素簇，非法字节按单字节 U+FFFD 处理
+    /// \param str 字符串
+    /// \param pos 起始字节位置，需位于字素簇边界上
+    /// \return 下一个边界的字节位置，pos 已在末尾时返回 str.size()
+    extern API size_t getNextGraphemeBreak(const SStringView &str, size_t pos);
+
+    /// 获取字素簇个数，即用户感知的字符数
+    /// \param str 字符串
+    /// \return 字素簇个数
+    extern API size_t getGraphemeCount(const SStringView &str);
+
+    /// 截取前 count 个字素簇，不会切断组合字符或表情序列
+    /// \param str 字符串
+    /// \param count 字素簇个数
+    /// \return 引用原字符串的视图
+    extern API SStringView truncateGraphemes(const SStringView &str, size_t count);
+
+    /// 按字素簇反转字符串，簇内顺序保持不变
+    /// \param str 字符串
+    /// \return 反转结果
+    extern API SString reverseGraphemes(const SStringView &str);
+
+    /// 获取下一个单词边界
+    /// \note 空白与标点同样构成片段；汉字与平假名按 UAX #29 默认规则逐字断开
+    /// \param str 字符串
+    /// \param pos 起始字节位置，需位于单词边界上
+    /// \return 下一个边界的字节位置
+    extern API size_t getNextWordBreak(const SStringView &str, size_t pos);
+
+    /// 获取下一个句子边界
+    /// \param str 字符串
+    /// \param pos 起始字节位置，需位于句子边界上
+    /// \return 下一个边界的字节位置，句末空白与换行归入前一句
+    extern API size_t getNextSentenceBreak(const SStringView &str, size_t pos);
+
+    /// 按单词边界切分，只保留包含字母、数字或表意文字的片段
+    /// \param str 字符串
+    /// \return 引用原字符串的视图
+    extern API std::vector<SStringView> splitWords(const SStringView &str);
+
+    /// 获取单词个数，即 splitWords 的结果个数，不发生分配
+    /// \param str 字符串
+    /// \return 单词个数
+    extern API size_t getWordCount(const SStringView &str);
+
+    /// 字素簇迭代器，每次产生一个引用原字符串的视图
+    /// \code
+    /// for (auto cluster: SGraphemeIterator(str)) { ... }
+    /// \endcode
+    class API SGraphemeIterator final {
+    public:
+        explicit SGraphemeIterator(const SStringView &str, size_t pos = 0);
+
+        SGraphemeIterator &operator++();
+        SGraphemeIterator operator++(int);
+
+        bool operator==(const SGraphemeIterator &other) const;
+        bool operator!=(const SGraphemeIterator &other) const;
+        SStringView operator*() const;
+
+        SGraphemeIterator begin() const;
+        SGraphemeIterator end() const;
+
+        /// 当前字素簇的起始字节位置
+        size_t position() const;
+
+    private:
+        const char *_data = nullptr;
+        size_t _size = 0;
+        size_t _pos = 0;
+        size_t _next = 0;
+    };
+
+    /// 单词边界迭代器，产生包括空白与标点在内的全部片段
+    class API SWordIterator final {
+    public:
+        explicit SWordIterator(const SStringView &str, size_t pos = 0);
+
+        SWordIterator &operator++();
+        SWordIterator operator++(int);
+
+        bool operator==(const SWordIterator &other) const;
+        bool operator!=(const SWordIterator &other) const;
+        SStringView operator*() const;
+
+        SWordIterator begin() const;
+        SWordIterator end() const;
+
+        /// 当前片段的起始字节位置
+        size_t position() const;
+        /// 当前片段是否为单词，而非空白或标点
+        bool isWord() const;
+
+    private:
+        const char *_data = nullptr;
+        size_t _size = 0;
+        size_t _pos = 0;
+        size_t _next = 0;
+    };
+
+    /// 句子边界迭代器
+    class API SSentenceIterator final {
+    public:
+        explicit SSentenceIterator(const SStringView &str, size_t pos = 0);
+
+        SSentenceIterator &operator++();
+        SSentenceIterator operator++(int);
+
+        bool operator==(const SSentenceIterator &other) const;
+        bool operator!=(const SSentenceIterator &other) const;
+        SStringView operator*() const;
+
+        SSentenceIterator begin() const;
+        SSentenceIterator end() const;
+
+        /// 当前句子的起始字节位置
+        size_t position() const;
+
+    private:
+        const char *_data = nullptr;
+        size_t _size = 0;
+        size_t _pos = 0;
+        size_t _next = 0;
+    };
+
+}// namespace sstr
@@ -0,0 +1,87 @@
+/// \file similarity.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief 近似重复检测，SimHash、MinHash 签名与 LSH 分带索引
+
+#pragma once
+#include <SString/SString.h>
+#include <vector>
+
+namespace sstr {
+
+    /// 计算 SimHash 签名
+    /// \note 以连续 shingle 个码点为一个片段，片段直接引用原字符串计算哈希，不发生分配；
+    ///       不足 shingle 个码点时整个字符串作为一个片段，空字符串返回 0。
+    ///       相似文本的签名汉明距离小，常用阈值为 3
+    /// \param str 字符串
+    /// \param shingle 片段的码点个数
+    /// \return 64 位签名
+    extern API uint64_t getSimHash(const SStringView &str, size_t shingle = 3);
+
+    /// 两个 SimHash 签名的汉明距离
+    extern API int getSimHashDistance(uint64_t a, uint64_t b);
+
+    /// 计算 MinHash 签名
+    /// \note 片段与 getSimHash 相同；每个片段只计算一次哈希，再按块以 count 组乘加置换取最小值，
+    ///       内层循环没有分支，便于向量化。空字符串的签名全为 UINT64_MAX
+    /// \param str 字符串
+    /// \param signature 输出，需保证至少 count 项可用空间
+    /// \param count 置换个数，即签名长度
+    /// \param shingle 片段的码点个数
+    /// \param seed 种子，比较的签名需使用相同的种子
+    extern API void getMinHash(const SStringView &str, uint64_t *signature, size_t count, size_t shingle = 3, uint64_t seed = 0);
+    extern API std::vector<uint64_t> getMinHash(const SStringView &str, size_t count = 128, size_t shingle = 3, uint64_t seed = 0);
+
+    /// 由 MinHash 签名估计 Jaccard 相似度，即相同项所占比例
+    extern API double getMinHashSimilarity(const uint64_t *a, const uint64_t *b, size_t count);
+
+    /// MinHash 的 LSH 分带索引
+    /// \note 签名分为 bands 段，每段 rows 项；任一段完全相同的签名成为候选。
+    ///       Jaccard 相似度为 s 的两项成为候选的概率为 1 - (1 - s^rows)^bands。
+    ///       每段一个链式哈希表，表项只存段哈希与编号
+    /// \code
+    /// SLSHIndex index(16, 8);
+    /// auto id = index.insert(getMinHash(text, index.signatureSize()).data());
+    /// auto candidates = index.query(getMinHash(other, index.signatureSize()).data());
+    /// \endcode
+    class API SLSHIndex final {
+    public:
+        /// \param bands 段数
+        /// \param rows 每段的项数
+        SLSHIndex(size_t bands, size_t rows);
+
+        /// 签名长度，即 bands * rows
+        size_t signatureSize() const;
+        /// 已加入的签名个数
+        size_t size() const;
+
+        /// 加入签名
+        /// \param signature 签名，共 signatureSize() 项
+        /// \return 编号，从 0 开始依次递增
+        uint32_t insert(const uint64_t *signature);
+
+        /// 查找候选
+        /// \param signature 签名，共 signatureSize() 项
+        /// \return 升序且不重复的候选编号
+        std::vector<uint32_t> query(const uint64_t *signature) const;
+
+        void clear();
+
+    private:
+        struct Band {
+            /// 桶中第一项的下标加 1，0 为空
+            std::vector<uint32_t> heads;
+            /// 同一桶中下一项的下标加 1
+            std::vector<uint32_t> next;
+            std::vector<uint64_t> keys;
+        };
+
+        uint64_t getBandKey(const uint64_t *signature, size_t band) const;
+
+        size_t _bands;
+        size_t _rows;
+        std::vector<Band> _tables;
+    };
+
+}// namespace sstr
@@ -0,0 +1,52 @@
+/// \file url.h
+/// \date 2026-10-18
+/// \version 0.1
+/// \author kaoru
+/// \brief URL 百分号编码与解码
+
+#pragma once
+#include <SString/SString.h>
+
+namespace sstr {
+
+    /// 编码 URL 组件（查询参数键值等）
+    /// \note 仅保留 RFC 3986 非保留字符 A-Z a-z 0-9 - . _ ~
+    /// \param str 原始字符串
+    /// \return 编码结果
+    extern API SString urlEncode(const SStringView &str);
+
+    /// 编码 URL 路径
+    /// \note 额外保留 '/' 以及路径中合法的 ":@!$&'()*+,;="
+    /// \param str 原始路径
+    /// \return 编码结果
+    extern API SString urlEncodePath(const SStringView &str);
+
+    /// 解码 URL 组件，'+' 视为空格
+    /// \param str 编码字符串
+    /// \param out 输出目标，原有内容会被覆盖，失败时被清空
+    /// \param validate 是否校验解码结果为合法 UTF-8
+    /// \retval true 成功
+    /// \retval false 非法百分号序列或非法 UTF-8
+    extern API bool urlDecode(const SStringView &str, SString &out, bool validate = false);
+
+    /// 原地解码 URL 组件，'+' 视为空格
+    /// \note 失败时 str 的内容不确定
+    /// \param str 编码字符串
+    /// \param validate 是否校验解码结果为合法 UTF-8
+    /// \return 是否成功
+    extern API bool urlDecode(SString &str, bool validate = false);
+
+    /// 解码 URL 路径，'+' 原样保留
+    /// \param str 编码路径
+    /// \param out 输出目标，原有内容会被覆盖，失败时被清空
+    /// \param validate 是否校验解码结果为合法 UTF-8
+    /// \return 是否成功
+    extern API bool urlDecodePath(const SStringView &str, SString &out, bool validate = false);
+
+    /// 原地解码 URL 路径，'+' 原样保留
+    /// \param str 编码路径
+    /// \param validate 是否校验解码结果为合法 UTF-8
+    /// \return 是否成功
+    extern API bool urlDecodePath(SString &str, bool validate = false);
+
+}// namespace sstr
@@ -0,0 +1,87 @@
+#include <SString/SBitmap.h>
+
+using sstr::SBitmap;
+
+static inline size_t popcount(uint64_t x) {
+#ifdef _MSC_VER
+    x = x - ((x >> 1) & 0x5555555555555555ull);
+    x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0full;
+    return (size_t) ((x * 0x0101010101010101ull) >> 56);
+#else
+    return (size_t) __builtin_popcountll(x);
+#endif
+}
+
+SBitmap::SBitmap(size_t size) : _words((size + 63) / 64, 0), _size(size) {}
+
+size_t SBitmap::size() const {
+    return _size;
+}
+
+size_t SBitmap::count() const {
+    size_t n = 0;
+    for (auto word: _words) {
+        n += popcount(word);
+    }
+    return n;
+}
+
+bool SBitmap::test(size_t index) const {
+    if (index >= _size) return false;
+    return 0 != (_words[index / 64] >> (index % 64) & 1);
+}
+
+void SBitmap::set(size_t index) {
+    if (index >= _size) return;
+    _words[index / 64] |= 1ull << (index % 64);
+}
+
+void SBitmap::reset(size_t index) {
+    if (index >= _size) return;
+    _words[index / 64] &= ~(1ull << (index % 64));
+}
+
+const uint64_t *SBitmap::words() const {
+    return _words.data();
+}
+
+uint64_t *SBitmap::words() {
+    return _words.data();
+}
+
+size_t SBitmap::wordCount() const {
+    return _words.size();
+}
+
+bool SBitmap::operator[](size_t index) const {
+    return test(index);
+}
+
+SBitmap SBitmap::operator&(const SBitmap &bitmap) const {
+    SBitmap res(_size < bitmap._size ? _size : bitmap._size);
+    for (size_t i = 0; i < res._words.size(); i++) {
+        res._words[i] = _words[i] & bitmap._words[i];
+    }
+    return res;
+}
+
+SBitmap SBitmap::operator|(const SBitmap &bitmap) const {
+    SBitmap res(_size > bitmap._size ? _size : bitmap._size);
+    for (size_t i = 0; i < res._words.size(); i++) {
+        uint64_t a = i < _words.size() ? _words[i] : 0;
+        uint64_t b = i < bitmap._words.size() ? bitmap._words[i] : 0;
+        res._words[i] = a | b;
+    }
+    return res;
+}
+
+SBitmap SBitmap::operator~() const {
+    SBitmap res(_size);
+    for (size_t i = 0; i < _words.size(); i++) {
+        res._words[i] = ~_words[i];
+    }
+    // 清除超出 size 的位
+    if (_size % 64) res._words.back() &= (1ull << (_size % 64)) - 1;
+    return res;
+}
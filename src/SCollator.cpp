@@ -0,0 +1,7566 @@
+#include <SString/SCollator.h>
+#include <SString/algorithm.h>
+#include <algorithm>
+#include <cstring>
+#ifdef _WIN32
+#pragma warning(disable : 4267)
+#endif
+
+/// 同一字符的排序元素尚未结束
+#define CE_MORE 0x40
+/// 该字符是缩约的首字符
+#define CE_CONTRACTION 0x01
+/// 可变元素的最大 primary，可变元素均落在 (0, MAX_VARIABLE_PRIMARY] 内
+#define MAX_VARIABLE_PRIMARY 0x1f45
+/// 缩约的最大码点数
+#define MAX_CONTRACTION 3
+/// 已被不连续缩约使用的码点
+#define CODE_REMOVED 0xffffffff
+
+using sstr::SChar;
+using sstr::SCollationStrength;
+using sstr::SCollator;
+using sstr::SString;
+using sstr::SStringColumn;
+using sstr::SStringView;
+
+struct CollationContraction {
+    /// 不足 3 个码点时以 0 补齐
+    uint32_t codes[MAX_CONTRACTION];
+    /// 在 CollationElements 中的位置
+    uint16_t element;
+};
+
+#pragma region CollationTable
+
+// 由 DUCET 13.0（allkeys.txt）生成，韩文音节经 NFD 分解后按字母排序，
+// 表中不存在的字符使用隐式权重
+
+/// 排序元素，按 primary << 16 | secondary << 7 | 后续标志 << 6 | tertiary << 1 | 缩约首字符标志 打包
+static const uint32_t CollationElements[35386] = {
+        0x00000000, 0x02011004, 0x02021004, 0x02031004, 0x02041004, 0x02051004, 0x02091004, 0x02671004,
+        0x031d1004, 0x03ac1004, 0x1f641004, 0x03ad1004, 0x03a91004, 0x03161004, 0x03281004, 0x03291004,
+        0x03a11004, 0x06661004, 0x02231004, 0x020d1004, 0x027e1004, 0x03a61004, 0x1f981004, 0x1f991004,
+        0x1f9a1004, 0x1f9b1004, 0x1f9c1004, 0x1f9d1004, 0x1f9e1004, 0x1f9f1004, 0x1fa01004, 0x1fa11004,
+        0x02401004, 0x023a1004, 0x066a1004, 0x066b1004, 0x066c1004, 0x026d1004, 0x03a01004, 0x1fa21010,
+        0x1fbc1010, 0x1fd61010, 0x1feb1010, 0x20071010, 0x20421010, 0x20511010, 0x20751010, 0x20901010,
+        0x20ab1010, 0x20c41010, 0x20d61011, 0x21091010, 0x21181010, 0x213c1010, 0x216b1010, 0x21801010,
+        0x21931010, 0x21d21010, 0x21f71010, 0x22171010, 0x22471010, 0x22591010, 0x22641010, 0x22701010,
+        0x22861010, 0x032a1004, 0x03a71004, 0x032b1004, 0x04b71004, 0x020b1004, 0x04b41004, 0x1fa21004,
+        0x1fbc1004, 0x1fd61004, 0x1feb1004, 0x20071004, 0x20421004, 0x20511004, 0x20751004, 0x20901004,
+        0x20ab1004, 0x20c41004, 0x20d61005, 0x21091004, 0x21181004, 0x213c1004, 0x216b1004, 0x21801004,
+        0x21931004, 0x21d21004, 0x21f71004, 0x22171004, 0x22471004, 0x22591004, 0x22641004, 0x22701004,
+        0x22861004, 0x032c1004, 0x066e1004, 0x032d1004, 0x06701004, 0x02061004, 0x02091036, 0x02681004,
+        0x1f631004, 0x1f651004, 0x1f621004, 0x1f661004, 0x066f1004, 0x039a1004, 0x04bb1004, 0x05d21004,
+        0x1fa21028, 0x03261004, 0x066d1004, 0x05d41004, 0x04b81004, 0x052a1004, 0x06671004, 0x1f9a1028,
+        0x1f9b1028, 0x04b51004, 0x23301008, 0x039c1004, 0x02931004, 0x04be1004, 0x1f991028, 0x213c1028,
+        0x03271004, 0x1f99107c, 0x0676107c, 0x1f9c103c, 0x1f99107c, 0x0676107c, 0x1f9a103c, 0x1f9b107c,
+        0x0676107c, 0x1f9c103c, 0x026e1004, 0x1fa21050, 0x00001284, 0x1fa21050, 0x00001204, 0x1fa21050,
+        0x00001384, 0x1fa21050, 0x00001684, 0x1fa21050, 0x00001584, 0x1fa21050, 0x00001484, 0x1fa21054,
+        0x00008c48, 0x20071014, 0x1fd61050, 0x00001804, 0x20071050, 0x00001284, 0x20071050, 0x00001204,
+        0x20071050, 0x00001384, 0x20071050, 0x00001584, 0x20901050, 0x00001284, 0x20901050, 0x00001204,
+        0x20901050, 0x00001384, 0x20901050, 0x00001584, 0x1feb1054, 0x00008c08, 0x21181050, 0x00001684,
+        0x213c1050, 0x00001284, 0x213c1050, 0x00001204, 0x213c1050, 0x00001384, 0x213c1050, 0x00001684,
+        0x213c1050, 0x00001584, 0x06691004, 0x213c1050, 0x00001784, 0x22171050, 0x00001284, 0x22171050,
+        0x00001204, 0x22171050, 0x00001384, 0x22171050, 0x00001584, 0x22701050, 0x00001204, 0x22b51010,
+        0x21d21048, 0x00008c48, 0x21d21008, 0x1fa21044, 0x00001284, 0x1fa21044, 0x00001204, 0x1fa21044,
+        0x00001384, 0x1fa21044, 0x00001684, 0x1fa21044, 0x00001584, 0x1fa21044, 0x00001484, 0x1fa21048,
+        0x00008c48, 0x20071008, 0x1fd61044, 0x00001804, 0x20071044, 0x00001284, 0x20071044, 0x00001204,
+        0x20071044, 0x00001384, 0x20071044, 0x00001584, 0x20901044, 0x00001284, 0x20901044, 0x00001204,
+        0x20901044, 0x00001384, 0x20901044, 0x00001584, 0x1feb1048, 0x00008c08, 0x21181044, 0x00001684,
+        0x213c1044, 0x00001284, 0x213c1044, 0x00001204, 0x213c1044, 0x00001384, 0x213c1044, 0x00001684,
+        0x213c1044, 0x00001584, 0x06681004, 0x213c1044, 0x00001784, 0x22171044, 0x00001284, 0x22171044,
+        0x00001204, 0x22171044, 0x00001384, 0x22171044, 0x00001584, 0x22701044, 0x00001204, 0x22b51004,
+        0x22701044, 0x00001584, 0x1fa21050, 0x00001904, 0x1fa21044, 0x00001904, 0x1fa21050, 0x00001304,
+        0x1fa21044, 0x00001304, 0x1fa21050, 0x00001884, 0x1fa21044, 0x00001884, 0x1fd61050, 0x00001204,
+        0x1fd61044, 0x00001204, 0x1fd61050, 0x00001384, 0x1fd61044, 0x00001384, 0x1fd61050, 0x00001704,
+        0x1fd61044, 0x00001704, 0x1fd61050, 0x00001404, 0x1fd61044, 0x00001404, 0x1feb1050, 0x00001404,
+        0x1feb1044, 0x00001404, 0x1feb1050, 0x00001c84, 0x1feb1044, 0x00001c84, 0x20071050, 0x00001904,
+        0x20071044, 0x00001904, 0x20071050, 0x00001304, 0x20071044, 0x00001304, 0x20071050, 0x00001704,
+        0x20071044, 0x00001704, 0x20071050, 0x00001884, 0x20071044, 0x00001884, 0x20071050, 0x00001404,
+        0x20071044, 0x00001404, 0x20511050, 0x00001384, 0x20511044, 0x00001384, 0x20511050, 0x00001304,
+        0x20511044, 0x00001304, 0x20511050, 0x00001704, 0x20511044, 0x00001704, 0x20511050, 0x00001804,
+        0x20511044, 0x00001804, 0x20751050, 0x00001384, 0x20751044, 0x00001384, 0x20751050, 0x00001c84,
+        0x20751044, 0x00001c84, 0x20901050, 0x00001684, 0x20901044, 0x00001684, 0x20901050, 0x00001904,
+        0x20901044, 0x00001904, 0x20901050, 0x00001304, 0x20901044, 0x00001304, 0x20901050, 0x00001884,
+        0x20901044, 0x00001884, 0x20901050, 0x00001704, 0x20941004, 0x20901054, 0x20ab1014, 0x20901048,
+        0x20ab1008, 0x20ab1050, 0x00001384, 0x20ab1044, 0x00001384, 0x20c41050, 0x00001804, 0x20c41044,
+        0x00001804, 0x218f1004, 0x20d61050, 0x00001204, 0x20d61044, 0x00001204, 0x20d61050, 0x00001804,
+        0x20d61044, 0x00001804, 0x20d61050, 0x00001404, 0x20d61044, 0x00001404, 0x20d61050, 0x00008c04,
+        0x20d61044, 0x00008c04, 0x20d61050, 0x00001c84, 0x20d61044, 0x00001c84, 0x21181050, 0x00001204,
+        0x21181044, 0x00001204, 0x21181050, 0x00001804, 0x21181044, 0x00001804, 0x21181050, 0x00001404,
+        0x21181044, 0x00001404, 0x22e31048, 0x21181008, 0x21371010, 0x21371004, 0x213c1050, 0x00001904,
+        0x213c1044, 0x00001904, 0x213c1050, 0x00001304, 0x213c1044, 0x00001304, 0x213c1050, 0x00001604,
+        0x213c1044, 0x00001604, 0x213c1054, 0x00008c48, 0x20071014, 0x213c1048, 0x00008c48, 0x20071008,
+        0x21931050, 0x00001204, 0x21931044, 0x00001204, 0x21931050, 0x00001804, 0x21931044, 0x00001804,
+        0x21931050, 0x00001404, 0x21931044, 0x00001404, 0x21d21050, 0x00001204, 0x21d21044, 0x00001204,
+        0x21d21050, 0x00001384, 0x21d21044, 0x00001384, 0x21d21050, 0x00001804, 0x21d21044, 0x00001804,
+        0x21d21050, 0x00001404, 0x21d21044, 0x00001404, 0x21f71050, 0x00001804, 0x21f71044, 0x00001804,
+        0x21f71050, 0x00001404, 0x21f71044, 0x00001404, 0x21fc1010, 0x21fc1004, 0x22171050, 0x00001684,
+        0x22171044, 0x00001684, 0x22171050, 0x00001904, 0x22171044, 0x00001904, 0x22171050, 0x00001304,
+        0x22171044, 0x00001304, 0x22171050, 0x00001484, 0x22171044, 0x00001484, 0x22171050, 0x00001604,
+        0x22171044, 0x00001604, 0x22171050, 0x00001884, 0x22171044, 0x00001884, 0x22591050, 0x00001384,
+        0x22591044, 0x00001384, 0x22701050, 0x00001384, 0x22701044, 0x00001384, 0x22701050, 0x00001584,
+        0x22861050, 0x00001204, 0x22861044, 0x00001204, 0x22861050, 0x00001704, 0x22861044, 0x00001704,
+        0x22861050, 0x00001404, 0x22861044, 0x00001404, 0x21d21048, 0x00008c88, 0x1fc41004, 0x1fcd1010,
+        0x1fd11010, 0x1fd11004, 0x22d61010, 0x22d61004, 0x214f1010, 0x1fe11010, 0x1fe11004, 0x1ff41010,
+        0x1ff81010, 0x1ffd1010, 0x1ffd1004, 0x22861048, 0x22591008, 0x20151010, 0x201a1010, 0x201f1010,
+        0x204b1010, 0x204b1004, 0x20631010, 0x206d1010, 0x207d1004, 0x20a61010, 0x209f1010, 0x20ca1010,
+        0x20ca1004, 0x20e11004, 0x21011004, 0x22381010, 0x21231010, 0x21271004, 0x215c1010, 0x213c1050,
+        0x00001f84, 0x213c1044, 0x00001f84, 0x20711010, 0x20711004, 0x21741010, 0x21741004, 0x21981010,
+        0x22ce1010, 0x22ce1004, 0x21e41010, 0x21ea1004, 0x22021004, 0x22061010, 0x22061004, 0x220a1010,
+        0x22171050, 0x00001f84, 0x22171044, 0x00001f84, 0x22421010, 0x224e1010, 0x227c1010, 0x227c1004,
+        0x228b1010, 0x228b1004, 0x22a31010, 0x22a81010, 0x22a81004, 0x22ad1004, 0x22c71004, 0x22d21010,
+        0x22d21004, 0x21f71048, 0x21d21008, 0x22bb1004, 0x22fe1004, 0x23021004, 0x23061004, 0x230a1004,
+        0x1feb1054, 0x22861054, 0x00001408, 0x1feb1054, 0x22861048, 0x00001408, 0x1feb1048, 0x22861048,
+        0x00001408, 0x20d61054, 0x20ab1014, 0x20d61054, 0x20ab1008, 0x20d61048, 0x20ab1008, 0x21181054,
+        0x20ab1014, 0x21181054, 0x20ab1008, 0x21181048, 0x20ab1008, 0x1fa21050, 0x00001404, 0x1fa21044,
+        0x00001404, 0x20901050, 0x00001404, 0x20901044, 0x00001404, 0x213c1050, 0x00001404, 0x213c1044,
+        0x00001404, 0x22171050, 0x00001404, 0x22171044, 0x00001404, 0x22171050, 0x000015c4, 0x00001904,
+        0x22171044, 0x000015c4, 0x00001904, 0x22171050, 0x000015c4, 0x00001204, 0x22171044, 0x000015c4,
+        0x00001204, 0x22171050, 0x000015c4, 0x00001404, 0x22171044, 0x000015c4, 0x00001404, 0x22171050,
+        0x000015c4, 0x00001284, 0x22171044, 0x000015c4, 0x00001284, 0x20151004, 0x1fa21050, 0x000015c4,
+        0x00001904, 0x1fa21044, 0x000015c4, 0x00001904, 0x1fa21050, 0x00001744, 0x00001904, 0x1fa21044,
+        0x00001744, 0x00001904, 0x1fa21054, 0x00008c48, 0x20071054, 0x00001904, 0x1fa21048, 0x00008c48,
+        0x20071048, 0x00001904, 0x205e1010, 0x205e1004, 0x20511050, 0x00001404, 0x20511044, 0x00001404,
+        0x20c41050, 0x00001404, 0x20c41044, 0x00001404, 0x213c1050, 0x00001884, 0x213c1044, 0x00001884,
+        0x213c1050, 0x000018c4, 0x00001904, 0x213c1044, 0x000018c4, 0x00001904, 0x22a31050, 0x00001404,
+        0x22a31044, 0x00001404, 0x20ab1044, 0x00001404, 0x1feb1054, 0x22861014, 0x1feb1054, 0x22861008,
+        0x1feb1048, 0x22861008, 0x20511050, 0x00001204, 0x20511044, 0x00001204, 0x207d1010, 0x22bb1010,
+        0x21181050, 0x00001284, 0x21181044, 0x00001284, 0x1fa21050, 0x000014c4, 0x00001204, 0x1fa21044,
+        0x000014c4, 0x00001204, 0x1fa21054, 0x00008c48, 0x20071054, 0x00001204, 0x1fa21048, 0x00008c48,
+        0x20071048, 0x00001204, 0x213c1050, 0x000017c4, 0x00001204, 0x213c1044, 0x000017c4, 0x00001204,
+        0x1fa21050, 0x00001e04, 0x1fa21044, 0x00001e04, 0x1fa21050, 0x00001f04, 0x1fa21044, 0x00001f04,
+        0x20071050, 0x00001e04, 0x20071044, 0x00001e04, 0x20071050, 0x00001f04, 0x20071044, 0x00001f04,
+        0x20901050, 0x00001e04, 0x20901044, 0x00001e04, 0x20901050, 0x00001f04, 0x20901044, 0x00001f04,
+        0x213c1050, 0x00001e04, 0x213c1044, 0x00001e04, 0x213c1050, 0x00001f04, 0x213c1044, 0x00001f04,
+        0x21931050, 0x00001e04, 0x21931044, 0x00001e04, 0x21931050, 0x00001f04, 0x21931044, 0x00001f04,
+        0x22171050, 0x00001e04, 0x22171044, 0x00001e04, 0x22171050, 0x00001f04, 0x22171044, 0x00001f04,
+        0x21d21050, 0x00002284, 0x21d21044, 0x00002284, 0x21f71050, 0x00002284, 0x21f71044, 0x00002284,
+        0x22821010, 0x22821004, 0x20751050, 0x00001404, 0x20751044, 0x00001404, 0x21271010, 0x20011004,
+        0x21661010, 0x21661004, 0x22911010, 0x22911004, 0x1fa21050, 0x00001704, 0x1fa21044, 0x00001704,
+        0x20071050, 0x00001804, 0x20071044, 0x00001804, 0x213c1050, 0x000015c4, 0x00001904, 0x213c1044,
+        0x000015c4, 0x00001904, 0x213c1050, 0x000016c4, 0x00001904, 0x213c1044, 0x000016c4, 0x00001904,
+        0x213c1050, 0x00001704, 0x213c1044, 0x00001704, 0x213c1050, 0x00001744, 0x00001904, 0x213c1044,
+        0x00001744, 0x00001904, 0x22701050, 0x00001904, 0x22701044, 0x00001904, 0x20f71004, 0x21311004,
+        0x220e1004, 0x20af1004, 0x1feb1048, 0x1fbc1008, 0x21801048, 0x216b1008, 0x1fa71010, 0x1fdb1010,
+        0x1fdb1004, 0x20e11010, 0x22001010, 0x21de1004, 0x229d1004, 0x22de1010, 0x22de1004, 0x1fc41010,
+        0x22221010, 0x22551010, 0x200e1010, 0x200e1004, 0x20b41010, 0x20b41004, 0x218b1010, 0x218b1004,
+        0x219f1010, 0x219f1004, 0x22781010, 0x22781004, 0x1fad1004, 0x1fb11004, 0x1fb71004, 0x1fcd1004,
+        0x214f1004, 0x1fe51004, 0x1ff41004, 0x1ff81004, 0x20241004, 0x201a1004, 0x20281004, 0x201f1004,
+        0x202c1004, 0x20321004, 0x20361004, 0x20bc1004, 0x20631004, 0x20551004, 0x205a1004, 0x206d1004,
+        0x203e1004, 0x222c1004, 0x20821004, 0x208a1004, 0x209f1004, 0x20a61004, 0x20981004, 0x20e61004,
+        0x20ec1004, 0x20f21004, 0x20fc1004, 0x22381004, 0x223e1004, 0x21101004, 0x21231004, 0x212d1004,
+        0x211c1004, 0x215c1004, 0x21431004, 0x21611004, 0x217b1004, 0x21a41004, 0x21a91004, 0x21ae1004,
+        0x21b31004, 0x21b71004, 0x21bc1004, 0x21c11004, 0x21981004, 0x21ca1004, 0x21da1004, 0x21e41004,
+        0x20c01004, 0x21ee1004, 0x21f31004, 0x22131004, 0x220a1004, 0x22221004, 0x22421004, 0x224e1004,
+        0x22551004, 0x22601004, 0x21051004, 0x22741004, 0x22951004, 0x22991004, 0x22a31004, 0x22b11004,
+        0x22da1004, 0x22e91004, 0x22fa1004, 0x230e1004, 0x23121004, 0x1fc01004, 0x203a1004, 0x20671004,
+        0x20791004, 0x20b81004, 0x20d21004, 0x20da1004, 0x21871004, 0x22f21004, 0x22f61004, 0x1feb1048,
+        0x22a31008, 0x1feb1048, 0x22991008, 0x21f71048, 0x21e41008, 0x21f71048, 0x1fe51008, 0x20421048,
+        0x21371008, 0x20d61048, 0x21d21008, 0x20d61048, 0x22861008, 0x23161004, 0x231a1004, 0x22301004,
+        0x22341004, 0x20751028, 0x20821028, 0x20ab1028, 0x21931028, 0x21a41028, 0x21ae1028, 0x21ca1028,
+        0x22591028, 0x22701028, 0x04c51004, 0x04c71004, 0x208e1004, 0x22e31004, 0x208f1004, 0x22e51004,
+        0x22ed1004, 0x22e21004, 0x22ee1004, 0x04c81004, 0x04c91004, 0x04ca1004, 0x04cb1004, 0x04cc1004,
+        0x04cd1004, 0x04ce1004, 0x04cf1004, 0x04d01004, 0x04d11004, 0x04d21004, 0x04d31004, 0x04d41004,
+        0x04d51004, 0x1f461004, 0x1f471004, 0x04d61004, 0x04d71004, 0x04d81004, 0x04d91004, 0x04dc1004,
+        0x04dd1004, 0x04b91004, 0x04ba1004, 0x04bc1004, 0x04bf1004, 0x04b61004, 0x04bd1004, 0x04de1004,
+        0x04df1004, 0x206d1028, 0x20d61028, 0x21d21028, 0x22641028, 0x22e91028, 0x04e01004, 0x04e11004,
+        0x04e21004, 0x04e31004, 0x04e41004, 0x04e51004, 0x04e61004, 0x04e71004, 0x04e81004, 0x22e41004,
+        0x04e91004, 0x04ea1004, 0x04eb1004, 0x04ec1004, 0x04ed1004, 0x04ee1004, 0x04ef1004, 0x04f01004,
+        0x04f11004, 0x04f21004, 0x04f31004, 0x04f41004, 0x04f51004, 0x04f61004, 0x04f71004, 0x04f81004,
+        0x04f91004, 0x00001284, 0x00001204, 0x00001384, 0x00001684, 0x00001904, 0x00001d04, 0x00001304,
+        0x00001704, 0x00001584, 0x00001d84, 0x00001484, 0x00001604, 0x00001404, 0x00001984, 0x00001e04,
+        0x00001e84, 0x00001f04, 0x00001104, 0x00001184, 0x00001a04, 0x00001f84, 0x00002004, 0x00002084,
+        0x00002104, 0x00002184, 0x00002204, 0x00002284, 0x00001804, 0x00001884, 0x00002304, 0x00002384,
+        0x00002404, 0x00002484, 0x00001084, 0x00002504, 0x00001c84, 0x00001a84, 0x00001784, 0x00002584,
+        0x00001504, 0x000015c4, 0x00001204, 0x00002604, 0x00002684, 0x00002704, 0x00002784, 0x1fa21008,
+        0x20071008, 0x20901008, 0x213c1008, 0x22171008, 0x1fd61008, 0x1feb1008, 0x20751008, 0x21091008,
+        0x21931008, 0x21f71008, 0x22471008, 0x22641008, 0x23281010, 0x23281004, 0x23491010, 0x23491004,
+        0x04c61004, 0x23251010, 0x23251004, 0x232b1008, 0x233e1004, 0x233d1004, 0x233f1004, 0x232c1010,
+        0x04bb1044, 0x00001204, 0x231e1050, 0x00001204, 0x23231050, 0x00001204, 0x23291050, 0x00001204,
+        0x232b1050, 0x00001204, 0x23331050, 0x00001204, 0x23411050, 0x00001204, 0x23461050, 0x00001204,
+        0x232b1044, 0x000015c4, 0x00001204, 0x231e1010, 0x231f1010, 0x23201010, 0x23221010, 0x23231010,
+        0x23271010, 0x23291010, 0x232a1010, 0x232b1010, 0x232d1010, 0x232e1010, 0x23301010, 0x23311010,
+        0x23321010, 0x23331010, 0x23341010, 0x23391010, 0x233c1010, 0x23401010, 0x23411010, 0x23421010,
+        0x23431010, 0x23441010, 0x23461010, 0x232b1050, 0x00001584, 0x23411050, 0x00001584, 0x231e1044,
+        0x00001204, 0x23231044, 0x00001204, 0x23291044, 0x00001204, 0x232b1044, 0x00001204, 0x23411044,
+        0x000015c4, 0x00001204, 0x231e1004, 0x231f1004, 0x23201004, 0x23221004, 0x23231004, 0x23271004,
+        0x23291004, 0x232a1004, 0x232b1004, 0x232d1004, 0x232e1004, 0x23301004, 0x23311004, 0x23321004,
+        0x23331004, 0x23341004, 0x23391004, 0x233c1032, 0x233c1004, 0x23401004, 0x23411004, 0x23421004,
+        0x23431004, 0x23441004, 0x23461004, 0x232b1044, 0x00001584, 0x23411044, 0x00001584, 0x23331044,
+        0x00001204, 0x23411044, 0x00001204, 0x23461044, 0x00001204, 0x232d1054, 0x231e1048, 0x232b1008,
+        0x231f1008, 0x232a1008, 0x23411014, 0x23411054, 0x00001204, 0x23411054, 0x00001584, 0x23421008,
+        0x23341008, 0x232d1048, 0x231e1048, 0x232b1008, 0x23381010, 0x23381004, 0x23261010, 0x23261004,
+        0x23241010, 0x23241004, 0x23371010, 0x23371004, 0x23481010, 0x23481004, 0x236a1010, 0x236a1004,
+        0x236f1010, 0x236f1004, 0x23701010, 0x23701004, 0x23731010, 0x23731004, 0x237a1010, 0x237a1004,
+        0x237d1010, 0x237d1004, 0x23811010, 0x23811004, 0x232d1008, 0x23391008, 0x233c1008, 0x232c1004,
+        0x232a1014, 0x23231008, 0x06611004, 0x234a1010, 0x234a1004, 0x233c1014, 0x23361010, 0x23361004,
+        0x233b1004, 0x233e1010, 0x233d1010, 0x233f1010, 0x23bf1050, 0x00001284, 0x23bf1050, 0x00001584,
+        0x23b51010, 0x239b1050, 0x00001204, 0x23c31010, 0x23d91010, 0x23ed1010, 0x23ed1050, 0x00001584,
+        0x23f61010, 0x24211010, 0x24471010, 0x247e1010, 0x23fb1050, 0x00001204, 0x23e51050, 0x00001284,
+        0x24821050, 0x00001304, 0x24e41010, 0x23871010, 0x23931010, 0x23971010, 0x239b1010, 0x23af1010,
+        0x23bf1010, 0x23c71010, 0x23d11010, 0x23e51011, 0x23f21010, 0x23fb1010, 0x24151010, 0x24281010,
+        0x24311010, 0x244c1010, 0x24541010, 0x24611010, 0x246a1010, 0x24731010, 0x24821010, 0x24931010,
+        0x24971010, 0x24be1010, 0x24c91010, 0x24e81010, 0x24ed1010, 0x24f41010, 0x24f91010, 0x24fd1010,
+        0x250a1010, 0x250e1010, 0x25141010, 0x23871004, 0x23931004, 0x23971004, 0x239b1004, 0x23af1004,
+        0x23bf1004, 0x23c71004, 0x23d11004, 0x23e51005, 0x23f21004, 0x23fb1004, 0x24151004, 0x24281004,
+        0x24311004, 0x244c1004, 0x24541004, 0x24611004, 0x246a1004, 0x24731004, 0x24821004, 0x24931004,
+        0x24971004, 0x24be1004, 0x24c91004, 0x24e81004, 0x24ed1004, 0x24f41004, 0x24f91004, 0x24fd1004,
+        0x250a1004, 0x250e1004, 0x25141004, 0x23bf1044, 0x00001284, 0x23bf1044, 0x00001584, 0x23b51004,
+        0x239b1044, 0x00001204, 0x23c31004, 0x23d91004, 0x23ed1004, 0x23ed1044, 0x00001584, 0x23f61004,
+        0x24211004, 0x24471004, 0x247e1004, 0x23fb1044, 0x00001204, 0x23e51044, 0x00001284, 0x24821044,
+        0x00001304, 0x24e41004, 0x24ad1010, 0x24ad1004, 0x25051010, 0x25051004, 0x25191010, 0x25191004,
+        0x251d1010, 0x251d1004, 0x25271010, 0x25271004, 0x25221010, 0x25221004, 0x252c1010, 0x252c1004,
+        0x25301010, 0x25301004, 0x25341010, 0x25341004, 0x25381010, 0x25381004, 0x253c1010, 0x253c1004,
+        0x253c1050, 0x00001e04, 0x253c1044, 0x00001e04, 0x248f1010, 0x248f1004, 0x24ba1010, 0x24ba1004,
+        0x24b61010, 0x24b61004, 0x24b11010, 0x24b11004, 0x245d1010, 0x245d1004, 0x052b1004, 0x00002804,
+        0x23e91010, 0x23e91004, 0x25011010, 0x25011004, 0x24651010, 0x24651004, 0x239b1054, 0x00008c88,
+        0x239b1048, 0x00008c88, 0x239f1010, 0x239f1004, 0x23a71010, 0x23a71004, 0x23cd1010, 0x23cd1004,
+        0x23bb1010, 0x23bb1004, 0x23ff1010, 0x23ff1004, 0x240f1010, 0x240f1004, 0x240b1010, 0x240b1004,
+        0x24071010, 0x24071004, 0x243a1010, 0x243a1004, 0x24431010, 0x24431004, 0x24591010, 0x24591004,
+        0x25411010, 0x25411004, 0x246f1010, 0x246f1004, 0x24791010, 0x24791004, 0x24861010, 0x24861004,
+        0x248a1010, 0x248a1004, 0x24a31010, 0x24a31004, 0x24c41010, 0x24c41004, 0x24cf1010, 0x24cf1004,
+        0x24d71010, 0x24d71004, 0x24a71010, 0x24a71004, 0x24dc1010, 0x24dc1004, 0x24e01010, 0x24e01004,
+        0x25461010, 0x23c71050, 0x00001304, 0x23c71044, 0x00001304, 0x24031010, 0x24031004, 0x241a1010,
+        0x241a1004, 0x243e1010, 0x243e1004, 0x24361010, 0x24361004, 0x24d31010, 0x24d31004, 0x242c1010,
+        0x242c1004, 0x25461004, 0x23871050, 0x00001304, 0x23871044, 0x00001304, 0x23871050, 0x00001584,
+        0x23871044, 0x00001584, 0x238f1010, 0x238f1004, 0x23bf1050, 0x00001304, 0x23bf1044, 0x00001304,
+        0x238b1010, 0x238b1004, 0x238b1050, 0x00001584, 0x238b1044, 0x00001584, 0x23c71050, 0x00001584,
+        0x23c71044, 0x00001584, 0x23d11050, 0x00001584, 0x23d11044, 0x00001584, 0x23de1010, 0x23de1004,
+        0x23e51050, 0x00001904, 0x23e51044, 0x00001904, 0x23e51050, 0x00001584, 0x23e51044, 0x00001584,
+        0x244c1050, 0x00001584, 0x244c1044, 0x00001584, 0x24501010, 0x24501004, 0x24501050, 0x00001584,
+        0x24501044, 0x00001584, 0x250a1050, 0x00001584, 0x250a1044, 0x00001584, 0x24821050, 0x00001904,
+        0x24821044, 0x00001904, 0x24821050, 0x00001584, 0x24821044, 0x00001584, 0x24821050, 0x00001604,
+        0x24821044, 0x00001604, 0x24c91050, 0x00001584, 0x24c91044, 0x00001584, 0x23ab1010, 0x23ab1004,
+        0x24f91050, 0x00001584, 0x24f91044, 0x00001584, 0x23a31010, 0x23a31004, 0x249b1010, 0x249b1004,
+        0x249f1010, 0x249f1004, 0x23b31010, 0x23b31004, 0x23ba1010, 0x23ba1004, 0x23d61010, 0x23d61004,
+        0x23e31010, 0x23e31004, 0x24261010, 0x24261004, 0x244b1010, 0x244b1004, 0x246e1010, 0x246e1004,
+        0x24781010, 0x24781004, 0x23d71010, 0x23d71004, 0x241f1010, 0x241f1004, 0x24271010, 0x24271004,
+        0x24691010, 0x24691004, 0x25181010, 0x25181004, 0x24141010, 0x24141004, 0x25451010, 0x25451004,
+        0x24131010, 0x24131004, 0x24201010, 0x24201004, 0x24421010, 0x24421004, 0x24581010, 0x24581004,
+        0x24ab1010, 0x24ab1004, 0x24351010, 0x24351004, 0x23cb1010, 0x23cb1004, 0x24cd1010, 0x24cd1004,
+        0x241e1010, 0x241e1004, 0x25f51010, 0x25f71010, 0x25f81010, 0x25f91010, 0x25fa1010, 0x25fb1010,
+        0x25fc1010, 0x25fd1010, 0x25fe1010, 0x25ff1010, 0x26001010, 0x26011010, 0x26021010, 0x26031010,
+        0x26041010, 0x26051010, 0x26061010, 0x26071010, 0x26081010, 0x26091010, 0x260a1010, 0x260c1010,
+        0x260d1010, 0x260e1010, 0x260f1010, 0x26101010, 0x26111010, 0x26121010, 0x26131010, 0x26141010,
+        0x26151010, 0x26161010, 0x26171010, 0x26181010, 0x26191010, 0x261a1010, 0x261b1010, 0x261c1010,
+        0x261d1004, 0x03e41004, 0x03e51004, 0x02691004, 0x022a1004, 0x02701004, 0x03e61004, 0x25f61004,
+        0x25f51004, 0x25f71004, 0x25f81004, 0x25f91004, 0x25fa1004, 0x25fb1004, 0x25fc1004, 0x25fd1004,
+        0x25fe1004, 0x25ff1004, 0x26001004, 0x26011004, 0x26021004, 0x26031004, 0x26041004, 0x26051004,
+        0x26061004, 0x26071004, 0x26081004, 0x26091004, 0x260a1004, 0x260c1004, 0x260d1004, 0x260e1004,
+        0x260f1004, 0x26101004, 0x26111004, 0x26121004, 0x26131004, 0x26141004, 0x26151004, 0x26161004,
+        0x26171004, 0x26181004, 0x26191004, 0x261a1004, 0x261b1004, 0x261c1004, 0x25fa1048, 0x26181008,
+        0x260b1004, 0x02411004, 0x020e1004, 0x052c1004, 0x052d1004, 0x1f671004, 0x00002904, 0x00002984,
+        0x00002a04, 0x00002a84, 0x00002b04, 0x00002b84, 0x00002c04, 0x00002c84, 0x00002d04, 0x00002d84,
+        0x00002e04, 0x00002f84, 0x03e71004, 0x00003004, 0x03e81004, 0x00002f04, 0x00002e84, 0x03e91004,
+        0x03ea1004, 0x261e1004, 0x261f1004, 0x26201004, 0x26211004, 0x26221004, 0x26231004, 0x26241004,
+        0x26251004, 0x26261004, 0x26271004, 0x26281032, 0x26281004, 0x26291004, 0x262a1032, 0x262a1004,
+        0x262b1032, 0x262b1004, 0x262c1004, 0x262d1004, 0x262e1032, 0x262e1004, 0x262f1032, 0x262f1004,
+        0x26301004, 0x26311004, 0x26321004, 0x26331004, 0x26271048, 0x26221048, 0x26231048, 0x26221008,
+        0x26231048, 0x26231008, 0x26231048, 0x26271008, 0x26271048, 0x26271008, 0x03eb1004, 0x03ec1004,
+        0x067d1004, 0x067f1004, 0x052e1004, 0x03b01004, 0x03b21004, 0x1f681004, 0x022b1004, 0x022c1004,
+        0x05311004, 0x05321004, 0x023b1004, 0x02421004, 0x02711004, 0x27401004, 0x26641004, 0x26651004,
+        0x26661004, 0x26691004, 0x266a1004, 0x266e1004, 0x26721005, 0x26741004, 0x26841004, 0x26851004,
+        0x26861004, 0x268f1004, 0x26991004, 0x269a1004, 0x26a41004, 0x26a51004, 0x26b31004, 0x26b41004,
+        0x26c61004, 0x26c71004, 0x26d11004, 0x26d21004, 0x26d71004, 0x26d81004, 0x26db1004, 0x26dc1004,
+        0x27071004, 0x27081004, 0x273d1004, 0x273e1004, 0x273f1004, 0x26e41004, 0x26f01004, 0x26f61004,
+        0x270c1004, 0x27141004, 0x27181004, 0x27221004, 0x27281005, 0x27361004, 0x27371005, 0x00003684,
+        0x00003804, 0x00003984, 0x00003b04, 0x00003d04, 0x00003e84, 0x00004004, 0x00004084, 0x00004104,
+        0x00004184, 0x00004204, 0x00004304, 0x00004384, 0x00004404, 0x00004504, 0x00004584, 0x00004604,
+        0x00004684, 0x00004704, 0x00004784, 0x00004284, 0x03ae1004, 0x022d1004, 0x022e1004, 0x03a41004,
+        0x26731004, 0x26ef1004, 0x00004c04, 0x26681004, 0x26671004, 0x266b1004, 0x26641008, 0x26721048,
+        0x26641008, 0x27281048, 0x26641008, 0x272c1048, 0x26641008, 0x27371048, 0x26641008, 0x26871004,
+        0x26881004, 0x26751004, 0x26891004, 0x268a1004, 0x26761004, 0x268b1004, 0x26771004, 0x269b1004,
+        0x269c1004, 0x26901004, 0x26911004, 0x269d1004, 0x26921004, 0x26941004, 0x26a61004, 0x26a71004,
+        0x26a81004, 0x26a91004, 0x26aa1004, 0x26ab1004, 0x26ad1004, 0x26ae1004, 0x26af1004, 0x26b51004,
+        0x26b61004, 0x26b71004, 0x26b81004, 0x26b91004, 0x26ba1004, 0x26bb1004, 0x26bc1004, 0x26bd1004,
+        0x26c81004, 0x26c91004, 0x26ca1004, 0x26d31004, 0x26d51004, 0x26d91004, 0x26dd1004, 0x26e51004,
+        0x26e61004, 0x26e81004, 0x26e91004, 0x26eb1004, 0x26ec1004, 0x26f11004, 0x26f31004, 0x26f71004,
+        0x26f81004, 0x26f91004, 0x26fa1004, 0x26fc1004, 0x26fd1004, 0x26ff1004, 0x27011004, 0x27021004,
+        0x27031004, 0x27041004, 0x27051004, 0x270d1004, 0x270e1004, 0x270f1004, 0x27101004, 0x271e1004,
+        0x27191004, 0x271b1004, 0x271c1004, 0x271d1004, 0x27231004, 0x26931004, 0x27271044, 0x00004184,
+        0x27241004, 0x27241044, 0x00004184, 0x27251004, 0x27291004, 0x272a1004, 0x272b1004, 0x272c1004,
+        0x272d1004, 0x272e1004, 0x272f1004, 0x27301004, 0x27381004, 0x27391004, 0x273a1004, 0x27321004,
+        0x273b1004, 0x273c1004, 0x27451004, 0x27451044, 0x00004184, 0x02801004, 0x27271004, 0x05331004,
+        0x27281008, 0x27371008, 0x05341004, 0x26b01004, 0x26be1004, 0x26cb1004, 0x26d61004, 0x26df1004,
+        0x26641048, 0x00008c88, 0x27141048, 0x00008c88, 0x27261004, 0x02cd1004, 0x02811004, 0x02821004,
+        0x02431004, 0x02441004, 0x02451004, 0x02461004, 0x02471004, 0x02481004, 0x02721004, 0x03ed1004,
+        0x03ee1004, 0x03ef1004, 0x03f01004, 0x27481004, 0x00004c84, 0x27491004, 0x274a1004, 0x274a1048,
+        0x00008c88, 0x274c1004, 0x274b1004, 0x274d1004, 0x274e1004, 0x274f1004, 0x27511004, 0x27521004,
+        0x27521048, 0x00008c88, 0x27531004, 0x27541004, 0x27551004, 0x27571004, 0x27581004, 0x27591004,
+        0x275a1004, 0x275a1032, 0x275b1004, 0x275c1004, 0x275c1048, 0x00008c88, 0x275e1004, 0x275f1004,
+        0x27601004, 0x27611004, 0x27621004, 0x27491048, 0x00008d08, 0x274a1048, 0x00008d08, 0x274c1048,
+        0x00008d08, 0x00004d04, 0x00004d84, 0x00004e04, 0x00004e84, 0x00004f04, 0x00004f84, 0x00005004,
+        0x00005084, 0x00005104, 0x00005184, 0x00005204, 0x00005284, 0x00005304, 0x00005384, 0x00005404,
+        0x00005484, 0x27501004, 0x27561004, 0x275d1004, 0x26781004, 0x26791004, 0x267a1004, 0x267b1004,
+        0x267c1004, 0x267d1004, 0x267f1004, 0x269e1004, 0x269f1004, 0x26b11004, 0x26b21004, 0x26bf1004,
+        0x26cc1004, 0x26e01004, 0x26e11004, 0x26e21004, 0x26ed1004, 0x26ee1004, 0x27061004, 0x27091004,
+        0x270a1004, 0x27151004, 0x27161004, 0x271f1004, 0x27201004, 0x27211004, 0x27111004, 0x26c01004,
+        0x26c11004, 0x26cd1004, 0x26a01004, 0x26a11004, 0x26ce1004, 0x26c21004, 0x26a21004, 0x266c1004,
+        0x266d1004, 0x27411004, 0x27421004, 0x27431004, 0x27331004, 0x27341004, 0x27461004, 0x27471004,
+        0x26a31004, 0x26cf1004, 0x26d01004, 0x26fb1004, 0x27871004, 0x278a1004, 0x278b1004, 0x278c1004,
+        0x278e1004, 0x278f1004, 0x27901004, 0x27911004, 0x27941004, 0x27961004, 0x27971004, 0x27981004,
+        0x279a1004, 0x279e1004, 0x279f1004, 0x27a11004, 0x27a21004, 0x27a61004, 0x27a71004, 0x27a81004,
+        0x27a91004, 0x27aa1004, 0x27ab1004, 0x27ac1004, 0x279b1004, 0x27881004, 0x27891004, 0x27991004,
+        0x278d1004, 0x27a31004, 0x27a41004, 0x27a51004, 0x279c1004, 0x279d1004, 0x27921004, 0x27931004,
+        0x27a01004, 0x27951004, 0x27ae1004, 0x27af1004, 0x27b01004, 0x27b11004, 0x27b21004, 0x27b31004,
+        0x27b41004, 0x27b51004, 0x27b61004, 0x27b71004, 0x27b81004, 0x27ad1004, 0x27b91004, 0x27ba1004,
+        0x27bb1004, 0x27bc1004, 0x27bd1004, 0x27be1004, 0x27bf1004, 0x27c01004, 0x27c11004, 0x27c21004,
+        0x27c31004, 0x27c41004, 0x27c51004, 0x27c61004, 0x27c71004, 0x27c81004, 0x27c91004, 0x27ca1004,
+        0x27cb1004, 0x27cc1004, 0x27cd1004, 0x27ce1004, 0x27cf1004, 0x27d01004, 0x27d11004, 0x27d21004,
+        0x27d31004, 0x27d41004, 0x27d51004, 0x27d61004, 0x27c51048, 0x00008c08, 0x27c61048, 0x00008c08,
+        0x27c81048, 0x00008c08, 0x00005504, 0x00005584, 0x00005604, 0x00005684, 0x00005704, 0x00005784,
+        0x00005804, 0x00005884, 0x00005904, 0x27d71004, 0x27d81004, 0x05461004, 0x02ce1004, 0x022f1004,
+        0x026a1004, 0x1f691004, 0x1f6a1004, 0x264a1004, 0x264b1004, 0x264c1004, 0x264d1004, 0x264e1004,
+        0x264f1004, 0x26501004, 0x26511004, 0x26521004, 0x26531004, 0x26541004, 0x26551004, 0x26561004,
+        0x26571004, 0x26581004, 0x26591004, 0x265a1004, 0x265b1004, 0x265c1004, 0x265d1004, 0x265e1004,
+        0x265f1004, 0x26601004, 0x26611004, 0x00003504, 0x00003584, 0x26621004, 0x26631004, 0x00003104,
+        0x00003184, 0x00003204, 0x00003284, 0x00003304, 0x00003384, 0x00003404, 0x00003484, 0x00003604,
+        0x02491004, 0x024a1004, 0x024b1004, 0x024c1004, 0x024d1004, 0x024e1004, 0x024f1004, 0x02501004,
+        0x02511004, 0x02521004, 0x02531004, 0x02541004, 0x02551004, 0x02561004, 0x02571004, 0x276e1004,
+        0x276f1004, 0x27701004, 0x27711004, 0x27721004, 0x27731004, 0x27741004, 0x27751004, 0x27761004,
+        0x27771004, 0x27781004, 0x27791004, 0x277a1004, 0x277b1004, 0x277c1004, 0x277d1004, 0x277e1004,
+        0x277f1004, 0x27801004, 0x27811004, 0x27821004, 0x27831004, 0x27841004, 0x27851004, 0x27861004,
+        0x03f11004, 0x27631004, 0x27641004, 0x27651004, 0x27661004, 0x27671004, 0x27681004, 0x27691004,
+        0x276a1004, 0x276b1004, 0x276c1004, 0x276d1004, 0x267e1004, 0x26811004, 0x26951004, 0x26da1004,
+        0x26ea1004, 0x26f51004, 0x27121004, 0x27171004, 0x266f1004, 0x26701004, 0x26c31004, 0x27351004,
+        0x26711004, 0x26721008, 0x26ac1004, 0x26d41004, 0x27001004, 0x27311004, 0x26c41004, 0x26e31004,
+        0x26fe1004, 0x26821004, 0x26831004, 0x268c1004, 0x26c51004, 0x27441004, 0x26e71004, 0x26f21004,
+        0x271a1004, 0x26801004, 0x268d1004, 0x268e1004, 0x26961004, 0x270b1004, 0x26de1004, 0x26f41004,
+        0x26971004, 0x26981004, 0x27131004, 0x00004804, 0x00003b84, 0x00003d84, 0x00003f04, 0x00003784,
+        0x00003904, 0x00003a84, 0x00003704, 0x00003884, 0x00003a04, 0x00003c04, 0x00003c84, 0x00003f84,
+        0x00004884, 0x00004904, 0x00004b04, 0x00004b84, 0x00004a04, 0x00004a84, 0x00004984, 0x00003e04,
+        0x00004484, 0x00006184, 0x00006204, 0x00006284, 0x29da1004, 0x29db1004, 0x29dc1004, 0x29e21004,
+        0x29e31004, 0x29e41004, 0x29e51004, 0x29e61004, 0x29e81004, 0x29ea1004, 0x29eb1004, 0x29ec1004,
+        0x29ed1004, 0x29ef1004, 0x29f01004, 0x29f11004, 0x29f21004, 0x29f31004, 0x29f41004, 0x29f51004,
+        0x29f71004, 0x29f81004, 0x29f91004, 0x29fa1004, 0x29fb1004, 0x29fe1004, 0x29ff1004, 0x2a001004,
+        0x2a011004, 0x2a031004, 0x2a051004, 0x2a061004, 0x2a071004, 0x2a081004, 0x2a091004, 0x2a0a1004,
+        0x2a0b1004, 0x2a0b1044, 0x00006104, 0x2a0c1004, 0x2a0d1004, 0x2a0e1004, 0x2a101004, 0x2a111004,
+        0x2a121004, 0x2a141004, 0x2a141044, 0x00006104, 0x2a151004, 0x2a161004, 0x2a161044, 0x00006104,
+        0x2a171004, 0x2a181004, 0x2a191004, 0x2a1a1004, 0x2a1b1004, 0x2a241004, 0x2a251004, 0x00006104,
+        0x2a1c1004, 0x2a231004, 0x2a291004, 0x2a2a1004, 0x2a2b1004, 0x2a2c1004, 0x2a2d1004, 0x2a2e1004,
+        0x2a311004, 0x2a331004, 0x2a341004, 0x2a361004, 0x2a381004, 0x2a391004, 0x2a3a1004, 0x2a3b1004,
+        0x2a3c1004, 0x2a351004, 0x2a261004, 0x29d71004, 0x2a321004, 0x2a271004, 0x2a281004, 0x29f31044,
+        0x00006104, 0x29f41044, 0x00006104, 0x29f51044, 0x00006104, 0x29fb1044, 0x00006104, 0x2a031044,
+        0x00006104, 0x2a051044, 0x00006104, 0x2a0d1044, 0x00006104, 0x2a121044, 0x00006104, 0x29e71004,
+        0x29e91004, 0x2a2f1004, 0x2a301004, 0x02961004, 0x02971004, 0x04001004, 0x1f481004, 0x29d91004,
+        0x29dd1004, 0x29de1004, 0x29df1004, 0x29e01004, 0x29e11004, 0x2a021004, 0x29fc1004, 0x2a131004,
+        0x29f61004, 0x29fd1004, 0x2a1d1004, 0x2a041004, 0x2a0f1004, 0x2a3d1004, 0x2a3e1004, 0x2a3f1004,
+        0x2a401004, 0x2a411004, 0x2a421004, 0x2a431004, 0x2a441004, 0x2a461004, 0x2a481004, 0x2a491004,
+        0x2a4a1004, 0x2a4b1004, 0x2a4c1004, 0x2a4d1004, 0x2a4e1004, 0x2a4f1004, 0x2a501004, 0x2a511004,
+        0x2a521004, 0x2a531004, 0x2a541004, 0x2a551004, 0x2a561004, 0x2a571004, 0x2a581004, 0x2a591004,
+        0x2a5a1004, 0x2a5b1004, 0x2a5c1004, 0x2a5d1004, 0x2a5e1004, 0x2a5f1004, 0x2a601004, 0x2a611004,
+        0x2a621004, 0x2a631004, 0x2a641004, 0x2a651004, 0x2a661004, 0x2a681004, 0x2a6a1004, 0x2a6b1004,
+        0x2a6c1004, 0x2a6d1004, 0x2a6e1004, 0x2a6f1004, 0x2a701004, 0x2a711004, 0x2a721004, 0x2a731004,
+        0x2a741004, 0x2a751004, 0x2a781005, 0x2a791004, 0x2a7a1004, 0x2a7b1004, 0x2a7c1004, 0x2a5b1048,
+        0x2a7c1008, 0x2a7d1004, 0x2a581044, 0x00006104, 0x2a591044, 0x00006104, 0x2a651044, 0x00006104,
+        0x2a451004, 0x2a471004, 0x2a761004, 0x2a771004, 0x2a671004, 0x2a691004, 0x1f6b1004, 0x1f6c1004,
+        0x1d561004, 0x1d571004, 0x1d581004, 0x1d591004, 0x1d5a1004, 0x1d5b1004, 0x05471004, 0x1f6d1004,
+        0x2a7e1004, 0x04051004, 0x00006304, 0x2a841004, 0x2a851004, 0x2a891004, 0x2a8a1004, 0x2a811004,
+        0x2a821004, 0x2a8b1004, 0x2a861004, 0x2a831004, 0x2a871004, 0x2a8f1004, 0x2a901004, 0x2a911004,
+        0x2a921004, 0x2a931004, 0x2a941004, 0x2a951004, 0x2a961004, 0x2a971004, 0x2a981004, 0x2a991004,
+        0x2a9a1004, 0x2a9b1004, 0x2a9c1004, 0x2a9d1004, 0x2a9e1004, 0x2a9f1004, 0x2aa01004, 0x2aa11004,
+        0x2aa21004, 0x2aa31004, 0x2aa41004, 0x2aa51004, 0x2aa61004, 0x2aa71004, 0x2aa81004, 0x2aaa1004,
+        0x2aab1004, 0x2aab1044, 0x00006104, 0x2aac1004, 0x2a8c1044, 0x00006104, 0x2a8c1004, 0x2a8d1004,
+        0x2aae1004, 0x2aaf1004, 0x2ab01004, 0x2ab11004, 0x2ab21004, 0x2ab31004, 0x2ab41004, 0x2ab51004,
+        0x2ab61004, 0x2ab71004, 0x2a8e1004, 0x2a901044, 0x00006104, 0x2a911044, 0x00006104, 0x2a961044,
+        0x00006104, 0x2aad1004, 0x2aa41044, 0x00006104, 0x00006384, 0x00006404, 0x2a881004, 0x2a801004,
+        0x2a7f1004, 0x2aa91004, 0x04061004, 0x2ab91004, 0x2aba1004, 0x2abb1004, 0x2abc1004, 0x2abd1004,
+        0x2abe1004, 0x2abf1004, 0x2ac11004, 0x2ac31004, 0x2ac41004, 0x2ac51004, 0x2ac61004, 0x2ac71004,
+        0x2ac81004, 0x2ac91004, 0x2aca1004, 0x2acb1004, 0x2acc1004, 0x2acd1004, 0x2ace1004, 0x2acf1004,
+        0x2ad01004, 0x2ad21004, 0x2ad31004, 0x2ad41004, 0x2ad51004, 0x2ad61004, 0x2ad71004, 0x2ad81004,
+        0x2ad91004, 0x2ada1004, 0x2adb1004, 0x2adc1004, 0x2add1004, 0x2ade1004, 0x2adf1004, 0x2ae01004,
+        0x2ae11004, 0x2ae21004, 0x2ae31004, 0x2ae41004, 0x2ae51004, 0x2aeb1004, 0x2ae61004, 0x2ae71004,
+        0x2ae81004, 0x2ae91004, 0x2aea1004, 0x2aec1004, 0x2aed1004, 0x2aee1004, 0x2aef1004, 0x2af01004,
+        0x2af11004, 0x2af21004, 0x2af31004, 0x2af61004, 0x2af71004, 0x2af81004, 0x2af91004, 0x2afa1004,
+        0x2afb1004, 0x2afc1004, 0x2ab81004, 0x2ac01004, 0x2ac21004, 0x2af41004, 0x2af51004, 0x04071004,
+        0x1f6e1004, 0x2ad11004, 0x2afd1004, 0x2afe1004, 0x2aff1004, 0x2b001004, 0x2b011004, 0x2b021004,
+        0x2b031004, 0x2b051004, 0x2b071004, 0x2b081004, 0x2b091004, 0x2b0a1004, 0x2b0b1004, 0x2b0c1004,
+        0x2b0d1004, 0x2b0e1004, 0x2b0f1004, 0x2b101004, 0x2b111004, 0x2b121004, 0x2b131004, 0x2b141004,
+        0x2b151004, 0x2b161004, 0x2b171004, 0x2b181004, 0x2b191004, 0x2b1a1004, 0x2b1b1004, 0x2b1c1004,
+        0x2b1d1004, 0x2b1e1004, 0x2b1f1004, 0x2b201004, 0x2b211004, 0x2b221004, 0x2b231004, 0x2b241004,
+        0x2b261004, 0x2b271004, 0x2b281004, 0x2b291004, 0x2b2b1004, 0x2b2c1004, 0x2b2d1004, 0x2b2e1004,
+        0x2b2f1004, 0x2b301004, 0x2b311004, 0x2b321004, 0x2b331004, 0x2b341004, 0x2b351004, 0x2b361004,
+        0x2b391005, 0x2b3a1004, 0x2b3b1004, 0x2b3c1004, 0x2b3d1004, 0x2b3e1004, 0x2b3f1004, 0x2b171044,
+        0x00006104, 0x2b181044, 0x00006104, 0x2b251004, 0x2b041004, 0x2b061004, 0x2b371004, 0x2b381004,
+        0x05481004, 0x2b2a1004, 0x1d5c1004, 0x1d5d1004, 0x1d5e1004, 0x1d5f1004, 0x1d601004, 0x1d611004,
+        0x2b4d1004, 0x2b411004, 0x2b421004, 0x2b431004, 0x2b441004, 0x2b451004, 0x2b461004, 0x2b471004,
+        0x2b481004, 0x2b491004, 0x2b4a1005, 0x2b4b1004, 0x2b4c1004, 0x2b4e1004, 0x2b4f1004, 0x2b501004,
+        0x2b601004, 0x2b511004, 0x2b521004, 0x2b531004, 0x2b541004, 0x2b551004, 0x2b5f1004, 0x2b561004,
+        0x2b571004, 0x2b581004, 0x2b591004, 0x2b5e1004, 0x2b5a1004, 0x2b5d1004, 0x2b5c1004, 0x2b5b1004,
+        0x2b611004, 0x2b621004, 0x2b631004, 0x2b641004, 0x2b651004, 0x2b661004, 0x2b671004, 0x2b681004,
+        0x2b691004, 0x2b6a1005, 0x2b6b1005, 0x2b6c1004, 0x2b6d1004, 0x2b6e1004, 0x2b6f1004, 0x2b701004,
+        0x2b401004, 0x2b711004, 0x1d681004, 0x1d691004, 0x1d6a1004, 0x05491004, 0x054a1004, 0x054b1004,
+        0x054c1004, 0x054d1004, 0x054e1004, 0x1f701004, 0x054f1004, 0x2b721004, 0x2b731004, 0x2b741004,
+        0x2b751004, 0x2b761004, 0x2b771004, 0x2b781004, 0x2b7a1004, 0x2b7c1004, 0x2b7d1004, 0x2b7e1004,
+        0x2b7f1004, 0x2b801004, 0x2b811004, 0x2b821004, 0x2b831004, 0x2b841004, 0x2b851004, 0x2b861004,
+        0x2b871004, 0x2b891004, 0x2b8a1004, 0x2b8c1004, 0x2b8d1004, 0x2b8e1004, 0x2b8f1004, 0x2b901004,
+        0x2b911004, 0x2b921004, 0x2b931004, 0x2b941004, 0x2b951004, 0x2b961004, 0x2b971004, 0x2b981004,
+        0x2b991004, 0x2b9a1004, 0x2b9b1004, 0x2b9c1004, 0x2b9d1004, 0x2b9e1004, 0x2b9f1004, 0x2ba01004,
+        0x2ba61004, 0x2ba71004, 0x2ba11004, 0x2ba21004, 0x2ba31004, 0x2ba41004, 0x2ba51004, 0x2ba91004,
+        0x2baa1004, 0x2bab1004, 0x2bac1004, 0x2bad1004, 0x2bae1004, 0x2baf1004, 0x2bb01004, 0x2bb31005,
+        0x2bb41004, 0x2bb51004, 0x2bb61004, 0x2bb71004, 0x2bb81004, 0x2bb91004, 0x2bba1004, 0x2bbb1004,
+        0x2b881004, 0x2b8b1004, 0x2ba81004, 0x2b791004, 0x2b7b1004, 0x2bb11004, 0x2bb21004, 0x04081004,
+        0x05691004, 0x2bf31004, 0x04091004, 0x2bbc1004, 0x2bbd1004, 0x2bbe1004, 0x2bbf1004, 0x2bc01004,
+        0x2bc11004, 0x2bc21004, 0x2bc41004, 0x2bc61004, 0x2bc71004, 0x2bc81004, 0x2bc91004, 0x2bca1004,
+        0x2bcb1004, 0x2bcc1004, 0x2bcd1004, 0x2bce1004, 0x2bcf1004, 0x2bd01004, 0x2bd11004, 0x2bd21004,
+        0x2bd31004, 0x2bd41004, 0x2bd51004, 0x2bd61004, 0x2bd71004, 0x2bd81004, 0x2bd91004, 0x2bda1004,
+        0x2bdb1004, 0x2bdc1004, 0x2bdd1004, 0x2bde1004, 0x2bdf1004, 0x2be01004, 0x2be11004, 0x2be21004,
+        0x2be31004, 0x2be41004, 0x2be51004, 0x2be61004, 0x2be71004, 0x2be81004, 0x2bee1004, 0x2be91004,
+        0x2bea1004, 0x2beb1004, 0x2bec1004, 0x2bed1004, 0x2bf01004, 0x2bf41004, 0x2bf51005, 0x2bf61004,
+        0x2bf71004, 0x2bf81004, 0x2bf91004, 0x2bfa1004, 0x2bfd1005, 0x2bfe1004, 0x2bff1004, 0x2c001005,
+        0x2c011004, 0x2c021004, 0x2c031004, 0x2c041004, 0x2c051004, 0x2bef1004, 0x2bc31004, 0x2bc51004,
+        0x2bfb1004, 0x2bfc1004, 0x2bf11004, 0x2bf21004, 0x2c3e1004, 0x2c061004, 0x2c071004, 0x2c081004,
+        0x2c091004, 0x2c0b1004, 0x2c0c1004, 0x2c0d1004, 0x2c0f1004, 0x2c111004, 0x2c121004, 0x2c131004,
+        0x2c141004, 0x2c151004, 0x2c161004, 0x2c171004, 0x2c181004, 0x2c191004, 0x2c1a1004, 0x2c1b1004,
+        0x2c1c1004, 0x2c1d1004, 0x2c1e1004, 0x2c1f1004, 0x2c201004, 0x2c211004, 0x2c221004, 0x2c231004,
+        0x2c241004, 0x2c251004, 0x2c261004, 0x2c271004, 0x2c281004, 0x2c291004, 0x2c2a1004, 0x2c2b1004,
+        0x2c2c1004, 0x2c2d1004, 0x2c2e1004, 0x2c2f1004, 0x2c301004, 0x2c311004, 0x2c321004, 0x2c3b1004,
+        0x2c331004, 0x2c391004, 0x2c3a1004, 0x2c341004, 0x2c351004, 0x2c361004, 0x2c371004, 0x2c381004,
+        0x2c3c1004, 0x2c4f1008, 0x2c3d1004, 0x2c3f1004, 0x2c401004, 0x2c411004, 0x2c421004, 0x2c431004,
+        0x2c441004, 0x2c451004, 0x2c481005, 0x2c491005, 0x2c4a1004, 0x2c4b1004, 0x2c4c1004, 0x2c4d1004,
+        0x2c4f1004, 0x2c321048, 0x2c4f1008, 0x056a1004, 0x2c301048, 0x2c4f1008, 0x2c311048, 0x2c4f1008,
+        0x2c3a1048, 0x2c4f1008, 0x2c4e1004, 0x1d801004, 0x1d811004, 0x1d821004, 0x1d831004, 0x1d841004,
+        0x1d851004, 0x1d861004, 0x2c0a1004, 0x2c0e1004, 0x2c101004, 0x2c461004, 0x2c471004, 0x1d871004,
+        0x1d881004, 0x1d891004, 0x1d8a1004, 0x1d8b1004, 0x1d8c1004, 0x1d8d1004, 0x1d8e1004, 0x1d8f1004,
+        0x056b1004, 0x2c251048, 0x2c4f1008, 0x2c2a1048, 0x2c4f1008, 0x2c331048, 0x2c4f1008, 0x2c391048,
+        0x2c4f1008, 0x2c171048, 0x2c4f1008, 0x2c501004, 0x2c511004, 0x2c521004, 0x2c531004, 0x2c541004,
+        0x2c551004, 0x2c561004, 0x2c571004, 0x2c581004, 0x2c591004, 0x2c5a1004, 0x2c5b1004, 0x2c5c1004,
+        0x2c5d1004, 0x2c5e1004, 0x2c5f1004, 0x2c601004, 0x2c611004, 0x2c621004, 0x2c631004, 0x2c641004,
+        0x2c651004, 0x2c661004, 0x2c671004, 0x2c681004, 0x2c691004, 0x2c6a1004, 0x2c6b1004, 0x2c6c1004,
+        0x2c6d1004, 0x2c6e1004, 0x2c6f1004, 0x2c701004, 0x2c711004, 0x2c721004, 0x2c731004, 0x2c741004,
+        0x2c751004, 0x2c761004, 0x2c771004, 0x2c781004, 0x2c791004, 0x2c7a1004, 0x2c7b1004, 0x2c7c1004,
+        0x2c7d1004, 0x2c7e1004, 0x2c7f1004, 0x2c801004, 0x2c811004, 0x2c821004, 0x2c831004, 0x2c841004,
+        0x2c851004, 0x2c861004, 0x2c871004, 0x2c881004, 0x2c891004, 0x2c8a1004, 0x2c9c1004, 0x2c8b1004,
+        0x2c8c1004, 0x2c8d1004, 0x2c8e1004, 0x2c8f1004, 0x2c901004, 0x2c911004, 0x2c921004, 0x2c961005,
+        0x2c971004, 0x2c981004, 0x2c991005, 0x2c9a1004, 0x2c9b1004, 0x2c941004, 0x2c931004, 0x2c951004,
+        0x040a1004, 0x32171004, 0x32181004, 0x32191004, 0x321a1004, 0x321b1004, 0x321c1004, 0x321d1004,
+        0x321e1004, 0x321f1004, 0x32201004, 0x32211004, 0x32221004, 0x32231004, 0x32241004, 0x32251004,
+        0x32261004, 0x32271004, 0x32281004, 0x32291004, 0x322a1004, 0x322b1004, 0x322c1004, 0x322d1004,
+        0x322e1004, 0x322f1004, 0x32301004, 0x32311004, 0x32321004, 0x32331004, 0x32341004, 0x32351004,
+        0x32361004, 0x32371004, 0x32381004, 0x32391004, 0x323a1004, 0x323b1004, 0x323c1004, 0x323d1004,
+        0x323e1004, 0x323f1004, 0x32401004, 0x32411004, 0x32421004, 0x32431004, 0x32441004, 0x32451004,
+        0x32461004, 0x32471004, 0x32481004, 0x32491004, 0x324a1004, 0x324b1004, 0x324c1004, 0x324d1004,
+        0x324e1004, 0x324f1004, 0x32501004, 0x1f751004, 0x32511005, 0x32521005, 0x32531005, 0x32541005,
+        0x32551005, 0x32561004, 0x1f491004, 0x00006a04, 0x00006a84, 0x00006b04, 0x00006b84, 0x00006c04,
+        0x00006c84, 0x00006d05, 0x00006984, 0x040b1004, 0x040c1004, 0x040d1004, 0x32581004, 0x32591004,
+        0x325a1004, 0x325b1004, 0x325c1004, 0x325d1004, 0x325e1004, 0x32601004, 0x32611004, 0x32641004,
+        0x32621004, 0x32651004, 0x32661004, 0x32671004, 0x32681004, 0x32691004, 0x326a1004, 0x326b1004,
+        0x326c1004, 0x326d1004, 0x326e1004, 0x326f1004, 0x32701004, 0x32711004, 0x32721004, 0x32731004,
+        0x32741004, 0x32751004, 0x32761004, 0x32771004, 0x32781004, 0x32791004, 0x327a1004, 0x327b1004,
+        0x327c1004, 0x327d1004, 0x325f1004, 0x327e1004, 0x327f1004, 0x32801004, 0x32811004, 0x32821004,
+        0x32831004, 0x32841004, 0x32851004, 0x32861004, 0x32871004, 0x32881004, 0x32891004, 0x328a1004,
+        0x328b1004, 0x328c1004, 0x328d1004, 0x328e1004, 0x328f1004, 0x32901004, 0x32911005, 0x32921005,
+        0x32931005, 0x32941005, 0x32951005, 0x1f4a1004, 0x00006d84, 0x00006e04, 0x00006e84, 0x00006f04,
+        0x00006f84, 0x00007005, 0x327e1048, 0x326f1008, 0x327e1048, 0x32771008, 0x32571004, 0x32631004,
+        0x331f1048, 0x33361048, 0x00006208, 0x05731004, 0x05741004, 0x05751004, 0x04101004, 0x04111004,
+        0x04121004, 0x04131004, 0x04141004, 0x04151004, 0x04161004, 0x04191004, 0x04191036, 0x041a1004,
+        0x041b1004, 0x041c1004, 0x041d1004, 0x041e1004, 0x041f1004, 0x05761004, 0x025f1004, 0x05771004,
+        0x05781004, 0x05791004, 0x057a1004, 0x057b1004, 0x057c1004, 0x057d1004, 0x057e1004, 0x057f1004,
+        0x1f991008, 0x1f9a1008, 0x1f9b1008, 0x1f9c1008, 0x1f9d1008, 0x1f9e1008, 0x1f9f1008, 0x1fa01008,
+        0x1fa11008, 0x1f981008, 0x05801004, 0x05811004, 0x05821004, 0x00007184, 0x032e1004, 0x032f1004,
+        0x03301004, 0x03311004, 0x32d91004, 0x32dc1004, 0x32de1004, 0x32de1044, 0x331e1004, 0x32e01004,
+        0x32e21004, 0x32e41004, 0x32e61004, 0x32e81004, 0x32ea1004, 0x32ec1004, 0x32ee1004, 0x32ee1044,
+        0x331e1004, 0x32f01004, 0x32f21004, 0x32f41004, 0x32f61004, 0x32f61044, 0x331e1004, 0x32f81004,
+        0x32fa1004, 0x32fc1004, 0x32fe1004, 0x32fe1044, 0x331e1004, 0x33001004, 0x33021004, 0x33041004,
+        0x33061004, 0x33061044, 0x331e1004, 0x33081004, 0x330a1004, 0x330c1004, 0x330e1004, 0x33101004,
+        0x33121004, 0x33151004, 0x33171004, 0x33191004, 0x331b1004, 0x331d1004, 0x331f1004, 0x32d91044,
+        0x331a1004, 0x33121048, 0x00008c88, 0x32db1004, 0x33141004, 0x33291005, 0x332a1004, 0x332b1004,
+        0x332e1004, 0x332f1004, 0x33301004, 0x33311004, 0x33321004, 0x33331004, 0x33341004, 0x33351004,
+        0x33361004, 0x33371004, 0x332c1004, 0x332d1004, 0x33381004, 0x04201004, 0x33211004, 0x33231004,
+        0x33271004, 0x33281004, 0x33251004, 0x33221004, 0x33241004, 0x33261004, 0x32da1004, 0x32dd1004,
+        0x32df1004, 0x32df1044, 0x331e1004, 0x32e11004, 0x32e31004, 0x32e51004, 0x32e71004, 0x32e91004,
+        0x32eb1004, 0x32ed1004, 0x32ef1004, 0x32ef1044, 0x331e1004, 0x32f11004, 0x32f31004, 0x32f51004,
+        0x32f71004, 0x32f71044, 0x331e1004, 0x32f91004, 0x32fb1004, 0x32fd1004, 0x32ff1004, 0x32ff1044,
+        0x331e1004, 0x33011004, 0x33031004, 0x33051004, 0x33071004, 0x33071044, 0x331e1004, 0x33091004,
+        0x330b1004, 0x330d1004, 0x330f1004, 0x33111004, 0x33131005, 0x33161005, 0x33181004, 0x331a1004,
+        0x331c1004, 0x331e1004, 0x33201004, 0x32da1044, 0x331a1004, 0x33091048, 0x00008c88, 0x33111048,
+        0x00008c88, 0x33131048, 0x00008c88, 0x05831004, 0x05841004, 0x05851004, 0x05861004, 0x05871004,
+        0x05881004, 0x05891004, 0x058a1004, 0x058b1004, 0x058c1004, 0x058d1004, 0x058e1004, 0x058f1004,
+        0x05901004, 0x05911004, 0x05921004, 0x04171004, 0x04181004, 0x04211004, 0x04221004, 0x04231004,
+        0x05931004, 0x05941004, 0x05951004, 0x05961004, 0x04241004, 0x04251004, 0x356c1004, 0x356e1004,
+        0x35701004, 0x35741004, 0x35771004, 0x35791004, 0x357c1004, 0x35801004, 0x35851004, 0x358c1004,
+        0x35901004, 0x35911004, 0x35931004, 0x35951004, 0x35981004, 0x359b1004, 0x359f1004, 0x35a01004,
+        0x35a11004, 0x35a41004, 0x35a71004, 0x35ab1004, 0x35ac1004, 0x35b21004, 0x35b51004, 0x35b81004,
+        0x35ba1004, 0x35bc1004, 0x35c01004, 0x35c21004, 0x35c91004, 0x35cb1004, 0x35d11004, 0x35d81004,
+        0x35d91004, 0x35da1004, 0x35db1004, 0x35dc1005, 0x35dd1004, 0x35e21004, 0x35e31004, 0x35e41004,
+        0x35e51004, 0x35e61008, 0x35e61004, 0x35ea1004, 0x35ec1004, 0x35ee1004, 0x35f11004, 0x35f61004,
+        0x35fa1004, 0x35ed1004, 0x35fc1004, 0x35f81004, 0x00007384, 0x36021004, 0x36031004, 0x35bb1004,
+        0x35bf1004, 0x35c31004, 0x35ce1004, 0x35c91048, 0x36021048, 0x35c91008, 0x02a11004, 0x02a21004,
+        0x043b1004, 0x043c1004, 0x043d1004, 0x043e1004, 0x35c61004, 0x35c71004, 0x35de1004, 0x35df1004,
+        0x35e01004, 0x35e11004, 0x35f21004, 0x35f31004, 0x35f41004, 0x35f51004, 0x35781004, 0x35861004,
+        0x35d31004, 0x35d41004, 0x35aa1004, 0x35b91004, 0x35c11004, 0x358a1004, 0x35fd1004, 0x36041004,
+        0x36051004, 0x35c81004, 0x35d71004, 0x35fe1004, 0x35ff1004, 0x36061004, 0x36071004, 0x36081004,
+        0x36091004, 0x360a1004, 0x359c1004, 0x35d51004, 0x35d61004, 0x35eb1004, 0x35e81004, 0x35ef1004,
+        0x35f01004, 0x356d1004, 0x356f1004, 0x35711004, 0x357a1004, 0x35831004, 0x358d1004, 0x35a21004,
+        0x35a81004, 0x35ad1004, 0x35ae1004, 0x35b31004, 0x35c51004, 0x35cc1004, 0x35c41004, 0x35e71004,
+        0x35f71004, 0x35f91004, 0x36011004, 0x360b1004, 0x360d1004, 0x36101004, 0x36111004, 0x360c1004,
+        0x360e1004, 0x360f1004, 0x35b01004, 0x36121004, 0x36131004, 0x36141004, 0x35e91004, 0x35fb1004,
+        0x05991004, 0x059a1004, 0x25a01010, 0x25a21010, 0x25a41010, 0x25a61010, 0x25a81010, 0x25aa1010,
+        0x25ac1010, 0x25b01010, 0x25b21010, 0x25b41010, 0x25b61010, 0x25b81010, 0x25ba1010, 0x25be1010,
+        0x25c01010, 0x25c21010, 0x25c41010, 0x25c61010, 0x25c81010, 0x25cc1010, 0x25ce1010, 0x25d01010,
+        0x25d21010, 0x25d41010, 0x25d61010, 0x25d81010, 0x25da1010, 0x25dc1010, 0x25de1010, 0x25e01010,
+        0x25e21010, 0x25e61010, 0x25e81010, 0x25ae1010, 0x25bc1010, 0x25ca1010, 0x25e41010, 0x25ea1010,
+        0x25ed1010, 0x25f21010, 0x259f1004, 0x25a11004, 0x25a31004, 0x25a51004, 0x25a71004, 0x25a91004,
+        0x25ab1004, 0x25af1004, 0x25b11004, 0x25b31004, 0x25b51004, 0x25b71004, 0x25b91004, 0x25bd1004,
+        0x25bf1004, 0x25c11004, 0x25c31004, 0x25c51004, 0x25c71004, 0x25cb1004, 0x25cd1004, 0x25cf1004,
+        0x25d11004, 0x25d31004, 0x25d51004, 0x25d71004, 0x25d91004, 0x25db1004, 0x25dd1004, 0x25df1004,
+        0x25e11004, 0x25e51004, 0x25e71004, 0x25ad1004, 0x25bb1004, 0x25c91004, 0x25e31004, 0x25e91004,
+        0x25eb1004, 0x25ec1004, 0x25ee1004, 0x25ef1004, 0x25f01004, 0x02cf1004, 0x25b91028, 0x25f11004,
+        0x25f31004, 0x25f41004, 0x41751004, 0x41761004, 0x41771004, 0x41781004, 0x41791004, 0x417a1004,
+        0x417b1004, 0x417c1004, 0x417d1004, 0x417e1004, 0x417f1004, 0x41801004, 0x41811004, 0x41821004,
+        0x41831004, 0x41841004, 0x41851004, 0x41861004, 0x41871004, 0x41881004, 0x41891004, 0x418a1004,
+        0x418b1004, 0x418c1004, 0x418d1004, 0x418e1004, 0x418f1004, 0x41901004, 0x41911004, 0x41921004,
+        0x41931004, 0x41941004, 0x41951004, 0x41961004, 0x41971004, 0x41981004, 0x41991004, 0x419a1004,
+        0x419b1004, 0x419c1004, 0x419d1004, 0x419e1004, 0x419f1004, 0x41a01004, 0x41a11004, 0x41a21004,
+        0x41a31004, 0x41a41004, 0x41a51004, 0x41a61004, 0x41a71004, 0x41a81004, 0x41a91004, 0x41aa1004,
+        0x41ab1004, 0x41ac1004, 0x41ad1004, 0x41ae1004, 0x41af1004, 0x41b01004, 0x41b11004, 0x41b21004,
+        0x41b31004, 0x41b41004, 0x41b51004, 0x41b61004, 0x41b71004, 0x41b81004, 0x41b91004, 0x41ba1004,
+        0x41bb1004, 0x41bc1004, 0x41bd1004, 0x41be1004, 0x41bf1004, 0x41c01004, 0x41c11004, 0x41c21004,
+        0x41c31004, 0x41c41004, 0x41c51004, 0x41c61004, 0x41c71004, 0x41c81004, 0x41c91004, 0x41ca1004,
+        0x41cb1004, 0x41cc1004, 0x41cd1004, 0x41ce1004, 0x41cf1004, 0x41d01004, 0x41d11004, 0x41d21004,
+        0x41d31004, 0x41f11004, 0x41f21004, 0x41f31004, 0x41f41004, 0x41f51004, 0x41f61004, 0x41f71004,
+        0x41f81004, 0x41f91004, 0x41fa1004, 0x41fb1004, 0x41fc1004, 0x41fd1004, 0x41fe1004, 0x41ff1004,
+        0x42001004, 0x42011004, 0x42021004, 0x42031004, 0x42041004, 0x42051004, 0x42061004, 0x42071004,
+        0x42081004, 0x42091004, 0x420a1004, 0x420b1004, 0x420c1004, 0x420d1004, 0x420e1004, 0x420f1004,
+        0x42101004, 0x42111004, 0x42121004, 0x42131004, 0x42141004, 0x42151004, 0x42161004, 0x42171004,
+        0x42181004, 0x42191004, 0x421a1004, 0x421b1004, 0x421c1004, 0x421d1004, 0x421e1004, 0x421f1004,
+        0x42201004, 0x42211004, 0x42221004, 0x42231004, 0x42241004, 0x42251004, 0x42261004, 0x42271004,
+        0x42281004, 0x42291004, 0x422a1004, 0x422b1004, 0x422c1004, 0x422d1004, 0x422e1004, 0x422f1004,
+        0x42301004, 0x42311004, 0x42321004, 0x42331004, 0x42341004, 0x42351004, 0x42361004, 0x42371004,
+        0x42381004, 0x42391004, 0x42511004, 0x42521004, 0x42531004, 0x42541004, 0x42551004, 0x42561004,
+        0x42571004, 0x42581004, 0x42591004, 0x425a1004, 0x425b1004, 0x425c1004, 0x425d1004, 0x425e1004,
+        0x425f1004, 0x42601004, 0x42611004, 0x42621004, 0x42631004, 0x42641004, 0x42651004, 0x42661004,
+        0x42671004, 0x42681004, 0x42691004, 0x426a1004, 0x426b1004, 0x426c1004, 0x426d1004, 0x426e1004,
+        0x426f1004, 0x42701004, 0x42711004, 0x42721004, 0x42731004, 0x42741004, 0x42751004, 0x42761004,
+        0x42771004, 0x42781004, 0x42791004, 0x427a1004, 0x427b1004, 0x427c1004, 0x427d1004, 0x427e1004,
+        0x427f1004, 0x42801004, 0x42811004, 0x42821004, 0x42831004, 0x42841004, 0x42851004, 0x42861004,
+        0x42871004, 0x42881004, 0x42891004, 0x428a1004, 0x428b1004, 0x428c1004, 0x428d1004, 0x428e1004,
+        0x428f1004, 0x42901004, 0x42911004, 0x42921004, 0x42931004, 0x42941004, 0x42951004, 0x42961004,
+        0x42971004, 0x42981004, 0x42991004, 0x429a1004, 0x429b1004, 0x429c1004, 0x429d1004, 0x429e1004,
+        0x429f1004, 0x42a01004, 0x42a11004, 0x42a21004, 0x42a31004, 0x42a41004, 0x42a51004, 0x42a61004,
+        0x42a71004, 0x42a81004, 0x28121004, 0x28131004, 0x28141004, 0x28151004, 0x28161004, 0x28171004,
+        0x28181004, 0x28191004, 0x281a1004, 0x281b1004, 0x281c1004, 0x281d1004, 0x281e1004, 0x281f1004,
+        0x28201004, 0x28211004, 0x28231004, 0x28241004, 0x28251004, 0x28261004, 0x28271004, 0x28281004,
+        0x28291004, 0x282a1004, 0x282b1004, 0x282c1004, 0x282d1004, 0x282e1004, 0x282f1004, 0x28301004,
+        0x28311004, 0x28321004, 0x28381004, 0x28391004, 0x283a1004, 0x283b1004, 0x283c1004, 0x283d1004,
+        0x283e1004, 0x283f1004, 0x28401004, 0x28411004, 0x28421004, 0x28431004, 0x28441004, 0x28451004,
+        0x28461004, 0x28471004, 0x28491004, 0x284a1004, 0x284b1004, 0x284c1004, 0x284d1004, 0x284e1004,
+        0x284f1004, 0x28501004, 0x28581004, 0x28591004, 0x285a1004, 0x285b1004, 0x285c1004, 0x285d1004,
+        0x285e1004, 0x285f1004, 0x28611004, 0x28621004, 0x28631004, 0x28641004, 0x28651004, 0x28661004,
+        0x28671004, 0x28681004, 0x28691004, 0x286a1004, 0x286b1004, 0x286c1004, 0x286d1004, 0x286e1004,
+        0x286f1004, 0x28701004, 0x28711004, 0x28721004, 0x28731004, 0x28741004, 0x28751004, 0x28761004,
+        0x28771004, 0x28781004, 0x28791004, 0x287a1004, 0x287b1004, 0x287c1004, 0x287d1004, 0x287e1004,
+        0x287f1004, 0x28801004, 0x28811004, 0x28871004, 0x28881004, 0x28891004, 0x288a1004, 0x288b1004,
+        0x288c1004, 0x288d1004, 0x288e1004, 0x288f1004, 0x28901004, 0x28911004, 0x28921004, 0x28931004,
+        0x28941004, 0x28951004, 0x28961004, 0x28981004, 0x28991004, 0x289a1004, 0x289b1004, 0x289c1004,
+        0x289d1004, 0x289e1004, 0x289f1004, 0x28a11004, 0x28a21004, 0x28a31004, 0x28a41004, 0x28a51004,
+        0x28a61004, 0x28a71004, 0x28a81004, 0x28a91004, 0x28aa1004, 0x28ab1004, 0x28ac1004, 0x28ad1004,
+        0x28ae1004, 0x28af1004, 0x28b01004, 0x28b11004, 0x28b21004, 0x28b31004, 0x28b41004, 0x28b51004,
+        0x28b71004, 0x28b81004, 0x28b91004, 0x28ba1004, 0x28bb1004, 0x28bc1004, 0x28bd1004, 0x28be1004,
+        0x28c01004, 0x28c11004, 0x28c21004, 0x28c31004, 0x28c41004, 0x28c51004, 0x28c61004, 0x28c71004,
+        0x28c91004, 0x28ca1004, 0x28cb1004, 0x28cc1004, 0x28cd1004, 0x28ce1004, 0x28cf1004, 0x28d01004,
+        0x28d11004, 0x28d21004, 0x28d31004, 0x28d41004, 0x28d51004, 0x28d61004, 0x28d71004, 0x28d81004,
+        0x28d91004, 0x28da1004, 0x28db1004, 0x28dc1004, 0x28dd1004, 0x28de1004, 0x28df1004, 0x28e01004,
+        0x28e11004, 0x28e21004, 0x28e31004, 0x28e41004, 0x28e51004, 0x28e61004, 0x28e71004, 0x28e81004,
+        0x28e91004, 0x28ea1004, 0x28eb1004, 0x28ec1004, 0x28ed1004, 0x28ee1004, 0x28ef1004, 0x28f01004,
+        0x28f11004, 0x28f21004, 0x28f31004, 0x28f41004, 0x28f51004, 0x28f61004, 0x28f71004, 0x28f81004,
+        0x29001004, 0x29011004, 0x29021004, 0x29031004, 0x29041004, 0x29051004, 0x29061004, 0x29071004,
+        0x29081004, 0x29091004, 0x290a1004, 0x290b1004, 0x290c1004, 0x290d1004, 0x290e1004, 0x290f1004,
+        0x29101004, 0x29111004, 0x29121004, 0x29131004, 0x29141004, 0x29151004, 0x29161004, 0x29171004,
+        0x291f1004, 0x29201004, 0x29211004, 0x29221004, 0x29231004, 0x29241004, 0x29251004, 0x29261004,
+        0x29281004, 0x29291004, 0x292a1004, 0x292b1004, 0x292c1004, 0x292d1004, 0x292e1004, 0x292f1004,
+        0x29311004, 0x29321004, 0x29331004, 0x29341004, 0x29351004, 0x29361004, 0x29371004, 0x29381004,
+        0x29391004, 0x293a1004, 0x293b1004, 0x293c1004, 0x293d1004, 0x293e1004, 0x293f1004, 0x29401004,
+        0x29411004, 0x29421004, 0x29431004, 0x29441004, 0x29451004, 0x294a1004, 0x294b1004, 0x294c1004,
+        0x294d1004, 0x294e1004, 0x294f1004, 0x29501004, 0x29511004, 0x29531004, 0x29541004, 0x29551004,
+        0x29561004, 0x29571004, 0x29581004, 0x29591004, 0x295a1004, 0x29631004, 0x29641004, 0x29651004,
+        0x29661004, 0x29671004, 0x29681004, 0x29691004, 0x296a1004, 0x296c1004, 0x296d1004, 0x296e1004,
+        0x296f1004, 0x29701004, 0x29711004, 0x29721004, 0x29731004, 0x297b1004, 0x297c1004, 0x297d1004,
+        0x297e1004, 0x297f1004, 0x29801004, 0x29811004, 0x29821004, 0x29831004, 0x29841004, 0x29851004,
+        0x29861004, 0x29871004, 0x29881004, 0x29891004, 0x298a1004, 0x298f1004, 0x29901004, 0x29911004,
+        0x29921004, 0x29931004, 0x29941004, 0x29951004, 0x29961004, 0x299c1004, 0x299d1004, 0x299e1004,
+        0x00005a84, 0x00005a04, 0x00005984, 0x02d01004, 0x02581004, 0x02831004, 0x02591004, 0x025a1004,
+        0x025b1004, 0x025c1004, 0x02731004, 0x02d11004, 0x1d901004, 0x1d911004, 0x1d921004, 0x1d931004,
+        0x1d941004, 0x1d951004, 0x1d961004, 0x1d971004, 0x1d981004, 0x1d991004, 0x1d9a1004, 0x28331004,
+        0x28341004, 0x28351004, 0x28361004, 0x28821004, 0x28831004, 0x28841004, 0x28851004, 0x298b1004,
+        0x298c1004, 0x298d1004, 0x298e1004, 0x29971004, 0x29981004, 0x29991004, 0x299a1004, 0x04fa1004,
+        0x04fb1004, 0x04fc1004, 0x04fd1004, 0x04fe1004, 0x04ff1004, 0x05001004, 0x05011004, 0x05021004,
+        0x05031004, 0x38de1010, 0x38df1010, 0x38e01010, 0x38e11010, 0x38e21010, 0x38e31010, 0x38e41010,
+        0x38e51010, 0x38e61010, 0x38e71010, 0x38e81010, 0x38e91010, 0x38ea1010, 0x38eb1010, 0x38ec1010,
+        0x38ed1010, 0x38ee1010, 0x38ef1010, 0x38f01010, 0x38f11010, 0x38f21010, 0x38f31010, 0x38f41010,
+        0x38f51010, 0x38f61010, 0x38f71010, 0x38f81010, 0x38f91010, 0x38fa1010, 0x38fb1010, 0x38fc1010,
+        0x38fd1010, 0x38fe1010, 0x38ff1010, 0x39001010, 0x39011010, 0x39021010, 0x39031010, 0x39041010,
+        0x39051010, 0x39061010, 0x39071010, 0x39081010, 0x39091010, 0x390a1010, 0x390b1010, 0x390c1010,
+        0x390d1010, 0x390e1010, 0x390f1010, 0x39101010, 0x39111010, 0x39121010, 0x39131010, 0x39141010,
+        0x39151010, 0x39161010, 0x39171010, 0x39181010, 0x39191010, 0x391a1010, 0x391b1010, 0x391c1010,
+        0x391d1010, 0x391e1010, 0x391f1010, 0x39201010, 0x39211010, 0x39221010, 0x39231010, 0x39241010,
+        0x39251010, 0x39261010, 0x39271010, 0x39281010, 0x39291010, 0x392a1010, 0x392b1010, 0x392c1010,
+        0x392d1010, 0x392e1010, 0x392f1010, 0x39301010, 0x39311010, 0x39321010, 0x39331010, 0x392e1004,
+        0x392f1004, 0x39301004, 0x39311004, 0x39321004, 0x39331004, 0x020f1004, 0x39581004, 0x39591004,
+        0x395a1004, 0x395b1004, 0x395c1004, 0x395d1004, 0x395e1004, 0x395f1004, 0x39601004, 0x39611004,
+        0x39621004, 0x39631004, 0x39641004, 0x39651004, 0x39661004, 0x39671004, 0x39681004, 0x39691004,
+        0x396a1004, 0x396b1004, 0x396c1004, 0x396d1004, 0x396e1004, 0x396f1004, 0x39701004, 0x39711004,
+        0x39721004, 0x39731004, 0x39741004, 0x39751004, 0x39761004, 0x39771004, 0x39781004, 0x39791004,
+        0x397a1004, 0x397b1004, 0x397c1004, 0x397d1004, 0x397e1004, 0x397f1004, 0x39801004, 0x39811004,
+        0x39821004, 0x39831004, 0x39841004, 0x39851004, 0x39861004, 0x39871004, 0x39881004, 0x39891004,
+        0x398a1004, 0x398b1004, 0x398c1004, 0x398d1004, 0x398e1004, 0x398f1004, 0x39901004, 0x39911004,
+        0x39921004, 0x39931004, 0x39941004, 0x39951004, 0x39961004, 0x39971004, 0x39981004, 0x39991004,
+        0x399a1004, 0x399b1004, 0x399c1004, 0x399d1004, 0x399e1004, 0x399f1004, 0x39a01004, 0x39a11004,
+        0x39a21004, 0x39a31004, 0x39a41004, 0x39a51004, 0x39a61004, 0x39a71004, 0x39a81004, 0x39a91004,
+        0x39aa1004, 0x39ab1004, 0x39ac1004, 0x39ad1004, 0x39ae1004, 0x39af1004, 0x39b01004, 0x39b11004,
+        0x39b21004, 0x39b31004, 0x39b41004, 0x39b51004, 0x39b61004, 0x39b71004, 0x39b81004, 0x39b91004,
+        0x39ba1004, 0x39bb1004, 0x39bc1004, 0x39bd1004, 0x39be1004, 0x39bf1004, 0x39c01004, 0x39c11004,
+        0x39c21004, 0x39c31004, 0x39c41004, 0x39c51004, 0x39c61004, 0x39c71004, 0x39c81004, 0x39c91004,
+        0x39ca1004, 0x39cb1004, 0x39cc1004, 0x39cd1004, 0x39ce1004, 0x39cf1004, 0x39d01004, 0x39d11004,
+        0x39d21004, 0x39d31004, 0x39d41004, 0x39d51004, 0x39d61004, 0x39d71004, 0x39d81004, 0x39d91004,
+        0x39da1004, 0x39db1004, 0x39dc1004, 0x39dd1004, 0x39de1004, 0x39df1004, 0x39e01004, 0x39e11004,
+        0x39e21004, 0x39e31004, 0x39e41004, 0x39e51004, 0x39e61004, 0x39e71004, 0x39e81004, 0x39e91004,
+        0x39ea1004, 0x39eb1004, 0x39ec1004, 0x39ed1004, 0x39ee1004, 0x39ef1004, 0x39f01004, 0x39f11004,
+        0x39f21004, 0x39f31004, 0x39f41004, 0x39f51004, 0x39f61004, 0x39f71004, 0x39f81004, 0x39f91004,
+        0x39fa1004, 0x39fb1004, 0x39fc1004, 0x39fd1004, 0x39fe1004, 0x39ff1004, 0x3a001004, 0x3a011004,
+        0x3a021004, 0x3a031004, 0x3a041004, 0x3a051004, 0x3a061004, 0x3a071004, 0x3a081004, 0x3a091004,
+        0x3a0a1004, 0x3a0b1004, 0x3a0c1004, 0x3a0d1004, 0x3a0e1004, 0x3a0f1004, 0x3a101004, 0x3a111004,
+        0x3a121004, 0x3a131004, 0x3a141004, 0x3a151004, 0x3a161004, 0x3a171004, 0x3a181004, 0x3a191004,
+        0x3a1a1004, 0x3a1b1004, 0x3a1c1004, 0x3a1d1004, 0x3a1e1004, 0x3a1f1004, 0x3a201004, 0x3a211004,
+        0x3a221004, 0x3a231004, 0x3a241004, 0x3a251004, 0x3a261004, 0x3a271004, 0x3a281004, 0x3a291004,
+        0x3a2a1004, 0x3a2b1004, 0x3a2c1004, 0x3a2d1004, 0x3a2e1004, 0x3a2f1004, 0x3a301004, 0x3a311004,
+        0x3a321004, 0x3a331004, 0x3a341004, 0x3a351004, 0x3a361004, 0x3a371004, 0x3a381004, 0x3a391004,
+        0x3a3a1004, 0x3a3b1004, 0x3a3c1004, 0x3a3d1004, 0x3a3e1004, 0x3a3f1004, 0x3a401004, 0x3a411004,
+        0x3a421004, 0x3a431004, 0x3a441004, 0x3a451004, 0x3a461004, 0x3a471004, 0x3a481004, 0x3a491004,
+        0x3a4a1004, 0x3a4b1004, 0x3a4c1004, 0x3a4d1004, 0x3a4e1004, 0x3a4f1004, 0x3a501004, 0x3a511004,
+        0x3a521004, 0x3a531004, 0x3a541004, 0x3a551004, 0x3a561004, 0x3a571004, 0x3a581004, 0x3a591004,
+        0x3a5a1004, 0x3a5b1004, 0x3a5c1004, 0x3a5d1004, 0x3a5e1004, 0x3a5f1004, 0x3a601004, 0x3a611004,
+        0x3a621004, 0x3a631004, 0x3a641004, 0x3a651004, 0x3a661004, 0x3a671004, 0x3a681004, 0x3a691004,
+        0x3a6a1004, 0x3a6b1004, 0x3a6c1004, 0x3a6d1004, 0x3a6e1004, 0x3a6f1004, 0x3a701004, 0x3a711004,
+        0x3a721004, 0x3a731004, 0x3a741004, 0x3a751004, 0x3a761004, 0x3a771004, 0x3a781004, 0x3a791004,
+        0x3a7a1004, 0x3a7b1004, 0x3a7c1004, 0x3a7d1004, 0x3a7e1004, 0x3a7f1004, 0x3a801004, 0x3a811004,
+        0x3a821004, 0x3a831004, 0x3a841004, 0x3a851004, 0x3a861004, 0x3a871004, 0x3a881004, 0x3a891004,
+        0x3a8a1004, 0x3a8b1004, 0x3a8c1004, 0x3a8d1004, 0x3a8e1004, 0x3a8f1004, 0x3a901004, 0x3a911004,
+        0x3a921004, 0x3a931004, 0x3a941004, 0x3a951004, 0x3a961004, 0x3a971004, 0x3a981004, 0x3a991004,
+        0x3a9a1004, 0x3a9b1004, 0x3a9c1004, 0x3a9d1004, 0x3a9e1004, 0x3a9f1004, 0x3aa01004, 0x3aa11004,
+        0x3aa21004, 0x3aa31004, 0x3aa41004, 0x3aa51004, 0x3aa61004, 0x3aa71004, 0x3aa81004, 0x3aa91004,
+        0x3aaa1004, 0x3aab1004, 0x3aac1004, 0x3aad1004, 0x3aae1004, 0x3aaf1004, 0x3ab01004, 0x3ab11004,
+        0x3ab21004, 0x3ab31004, 0x3ab41004, 0x3ab51004, 0x3ab61004, 0x3ab71004, 0x3ab81004, 0x3ab91004,
+        0x3aba1004, 0x3abb1004, 0x3abc1004, 0x3abd1004, 0x3abe1004, 0x3abf1004, 0x3ac01004, 0x3ac11004,
+        0x3ac21004, 0x3ac31004, 0x3ac41004, 0x3ac51004, 0x3ac61004, 0x3ac71004, 0x3ac81004, 0x3ac91004,
+        0x3aca1004, 0x3acb1004, 0x3acc1004, 0x3acd1004, 0x3ace1004, 0x3acf1004, 0x3ad01004, 0x3ad11004,
+        0x3ad21004, 0x3b051004, 0x3ad31004, 0x3ad51004, 0x3ad61004, 0x3ad71004, 0x3ad81004, 0x3ad91004,
+        0x3ada1004, 0x3adb1004, 0x3adc1004, 0x3add1004, 0x3ade1004, 0x3adf1004, 0x3ae01004, 0x3ae11004,
+        0x3ae21004, 0x3ae31004, 0x3ae41004, 0x3ae61004, 0x3ae71004, 0x3ae81004, 0x3ae91004, 0x3aea1004,
+        0x3aeb1004, 0x3aec1004, 0x3aed1004, 0x3af41004, 0x3af51004, 0x3af61004, 0x3af71004, 0x3af81004,
+        0x3af91004, 0x3afa1004, 0x3afb1004, 0x3afc1004, 0x3afd1004, 0x3afe1004, 0x3aff1004, 0x3b001004,
+        0x3b011004, 0x3b021004, 0x3b031004, 0x3b041004, 0x3b061004, 0x3b071004, 0x3b081004, 0x3b091004,
+        0x3b0a1004, 0x3b0b1004, 0x3b0c1004, 0x3b0d1004, 0x3b0e1004, 0x3b0f1004, 0x3b101004, 0x3b111004,
+        0x3b121004, 0x3b131004, 0x3b141004, 0x3b151004, 0x3b161004, 0x3b171004, 0x3b181004, 0x3b191004,
+        0x3b1a1004, 0x3b1b1004, 0x3b1c1004, 0x3b1d1004, 0x3b1e1004, 0x3b1f1004, 0x3b201004, 0x3b211004,
+        0x3b221004, 0x3b231004, 0x3b241004, 0x3b251004, 0x3b261004, 0x3b271004, 0x3b281004, 0x3b291004,
+        0x3b2a1004, 0x3b2b1004, 0x3b2c1004, 0x3b2d1004, 0x3b2e1004, 0x3b2f1004, 0x3b301004, 0x3b311004,
+        0x3b321004, 0x3b331004, 0x3b341004, 0x3b351004, 0x3b361004, 0x3b371004, 0x3b381004, 0x3b391004,
+        0x3b3a1004, 0x3b3b1004, 0x3b3c1004, 0x3b3d1004, 0x3b3e1004, 0x3b3f1004, 0x3b401004, 0x3b411004,
+        0x3b421004, 0x3b431004, 0x3b441004, 0x3b451004, 0x3b461004, 0x3b471004, 0x3b481004, 0x3b491004,
+        0x3b4a1004, 0x3b4b1004, 0x3b4c1004, 0x3b4d1004, 0x3b4e1004, 0x3b4f1004, 0x3b501004, 0x3b511004,
+        0x3b521004, 0x3b531004, 0x3b541004, 0x3b551004, 0x3b561004, 0x3b571004, 0x3b581004, 0x3b591004,
+        0x3b5a1004, 0x3b5b1004, 0x3b5c1004, 0x3b5d1004, 0x3b5e1004, 0x3b5f1004, 0x3b601004, 0x3b611004,
+        0x3b621004, 0x3b631004, 0x3b641004, 0x3b651004, 0x3b661004, 0x3b671004, 0x3b681004, 0x3b691004,
+        0x3b6a1004, 0x3b6b1004, 0x3b6c1004, 0x3b6d1004, 0x3b6e1004, 0x3b6f1004, 0x3b701004, 0x3b711004,
+        0x3b721004, 0x3b731004, 0x3b741004, 0x3b751004, 0x3b761004, 0x3b771004, 0x3b781004, 0x3b791004,
+        0x3b7a1004, 0x3b7b1004, 0x3b7c1004, 0x3b7d1004, 0x3b7e1004, 0x3b7f1004, 0x3b801004, 0x3b811004,
+        0x3b821004, 0x3b831004, 0x3b841004, 0x3b851004, 0x3b861004, 0x3b871004, 0x3b881004, 0x3b891004,
+        0x3b8a1004, 0x3b8b1004, 0x3b8c1004, 0x3b8d1004, 0x3b8e1004, 0x3b8f1004, 0x3b901004, 0x3b911004,
+        0x3b921004, 0x3b931004, 0x3b941004, 0x3b951004, 0x3b961004, 0x3b971004, 0x3b981004, 0x3b991004,
+        0x3b9a1004, 0x3b9b1004, 0x3b9c1004, 0x3b9d1004, 0x3b9e1004, 0x3b9f1004, 0x3ba01004, 0x3ba11004,
+        0x3ba21004, 0x3ba31004, 0x3ba41004, 0x3ba51004, 0x3ba61004, 0x3ba71004, 0x3ba81004, 0x3ba91004,
+        0x3baa1004, 0x3bab1004, 0x3bac1004, 0x3bad1004, 0x3bae1004, 0x3baf1004, 0x3bb01004, 0x3bb11004,
+        0x3bb21004, 0x3bb31004, 0x3bb41004, 0x3bb51004, 0x3bb61004, 0x3bb71004, 0x3bb81004, 0x3bb91004,
+        0x3bba1004, 0x3bbb1004, 0x3bbc1004, 0x3bbd1004, 0x3bbe1004, 0x3bbf1004, 0x3bc01004, 0x3bc11004,
+        0x3bc21004, 0x3bc31004, 0x3bc41004, 0x3bc51004, 0x3bc61004, 0x3bc71004, 0x3bc81004, 0x3bc91004,
+        0x3bca1004, 0x3bcb1004, 0x05971004, 0x02861004, 0x3ad41004, 0x3ae51004, 0x3aee1004, 0x3aef1004,
+        0x3af01004, 0x3af11004, 0x3af21004, 0x3af31004, 0x3bcc1004, 0x3bcd1004, 0x3bce1004, 0x3bcf1004,
+        0x3bd01004, 0x3bd11004, 0x3bd21004, 0x3bd31004, 0x3bd41004, 0x02091008, 0x3c1b1004, 0x3c1c1004,
+        0x3c1d1004, 0x3c1e1004, 0x3c1f1004, 0x3c201004, 0x3c211004, 0x3c221004, 0x3c231004, 0x3c241004,
+        0x3c251004, 0x3c261004, 0x3c271004, 0x3c281004, 0x3c291004, 0x3c2a1004, 0x3c2b1004, 0x3c2c1004,
+        0x3c2d1004, 0x3c2e1004, 0x3c2f1004, 0x3c301004, 0x3c311004, 0x3c321004, 0x3c331004, 0x3c341004,
+        0x03321004, 0x03331004, 0x3c351004, 0x3c351048, 0x00008c08, 0x3c361004, 0x3c5a1004, 0x3c361048,
+        0x00008c08, 0x3c361048, 0x00008c88, 0x3c371004, 0x3c371048, 0x00008c08, 0x3c381004, 0x3c381048,
+        0x00008c08, 0x3c561004, 0x3c581004, 0x3c381048, 0x00008c88, 0x3c381048, 0x00008d08, 0x3c381048,
+        0x00008d88, 0x3c3a1004, 0x3c3b1004, 0x3c3c1004, 0x3c3d1004, 0x3c3d1048, 0x00008c08, 0x3c3d1048,
+        0x00008c88, 0x3c3d1048, 0x00008d08, 0x3c3d1048, 0x00008d88, 0x3c3f1004, 0x3c5d1004, 0x3c401004,
+        0x3c411004, 0x3c411048, 0x00008c08, 0x3c411048, 0x00008c88, 0x3c411048, 0x00008d08, 0x3c421004,
+        0x3c421048, 0x00008c08, 0x3c421048, 0x00008c88, 0x3c431004, 0x3c431048, 0x00008c08, 0x3c451004,
+        0x3c451048, 0x00008c08, 0x3c461004, 0x3c461048, 0x00008c08, 0x3c471004, 0x3c481004, 0x3c491004,
+        0x3c4a1004, 0x3c4a1048, 0x00008c08, 0x3c4a1048, 0x00008d08, 0x3c4a1048, 0x00008d88, 0x3c4a1048,
+        0x00008e08, 0x3c4c1004, 0x3c4c1048, 0x00008c08, 0x3c4c1048, 0x00008c88, 0x3c4d1004, 0x3c4d1048,
+        0x00008c08, 0x3c4d1048, 0x00008c88, 0x3c481048, 0x00008c08, 0x3c4e1004, 0x3c501004, 0x3c501048,
+        0x00008c08, 0x3c501048, 0x00008c88, 0x3c511004, 0x3c511048, 0x00008c08, 0x3c521004, 0x3c521048,
+        0x00008c08, 0x3c531004, 0x3c541004, 0x3c5b1004, 0x3c5f1004, 0x3c601004, 0x3c5c1004, 0x3c5e1004,
+        0x3c611004, 0x3c621004, 0x3c621048, 0x00008c08, 0x3c621048, 0x00008c88, 0x3c401048, 0x00008c08,
+        0x3c4a1048, 0x00008c88, 0x02631004, 0x02641004, 0x02651004, 0x3c461048, 0x3c511008, 0x3c501048,
+        0x00008c48, 0x3c501048, 0x00008c08, 0x3c371048, 0x3c371008, 0x3c3e1004, 0x3c4b1004, 0x3c551004,
+        0x3c391004, 0x3c441004, 0x3c4f1004, 0x3c571004, 0x3c591004, 0x34861004, 0x34871004, 0x34881004,
+        0x34891004, 0x348a1004, 0x348b1004, 0x348c1004, 0x348d1004, 0x348e1004, 0x348f1004, 0x34901004,
+        0x34911004, 0x34921004, 0x34931004, 0x34941004, 0x34951004, 0x34961004, 0x34971004, 0x34981004,
+        0x34991004, 0x349a1004, 0x349b1004, 0x349c1004, 0x349d1004, 0x349e1004, 0x349f1004, 0x34a01004,
+        0x34a11004, 0x34a21004, 0x34a31004, 0x34a41004, 0x34a51004, 0x34a61004, 0x34a71004, 0x34a81004,
+        0x34a91004, 0x34aa1004, 0x34ab1004, 0x34ac1004, 0x34ad1004, 0x34ae1004, 0x029e1004, 0x029f1004,
+        0x34af1004, 0x34b01004, 0x34b11004, 0x34b21004, 0x34b31004, 0x34b41004, 0x34b51004, 0x34b61004,
+        0x34b71004, 0x34b81004, 0x34b91004, 0x34ba1004, 0x34bb1004, 0x34bc1004, 0x34bd1004, 0x34be1004,
+        0x34bf1004, 0x34c01004, 0x34c11004, 0x34c21004, 0x34c31004, 0x34c41004, 0x34c51004, 0x34c61004,
+        0x34c71004, 0x34c81004, 0x34c91004, 0x34ca1004, 0x34cb1004, 0x34cc1004, 0x34cd1004, 0x34ce1004,
+        0x34cf1004, 0x34d01004, 0x34d11004, 0x34d21004, 0x34d31004, 0x34d41004, 0x36751004, 0x36761004,
+        0x36771004, 0x36781004, 0x36791004, 0x367a1004, 0x367b1004, 0x367c1004, 0x367d1004, 0x367e1004,
+        0x367f1004, 0x36801004, 0x36811004, 0x36821004, 0x36831004, 0x36841004, 0x36851004, 0x36861004,
+        0x36871004, 0x36881004, 0x36891004, 0x368a1004, 0x368b1004, 0x368c1004, 0x368d1004, 0x368e1004,
+        0x368f1004, 0x36901004, 0x36911004, 0x36921004, 0x36931004, 0x36941004, 0x36951004, 0x36961004,
+        0x36971004, 0x36991004, 0x369a1004, 0x369b1004, 0x369c1004, 0x369d1004, 0x369e1004, 0x369f1004,
+        0x36a01004, 0x36a11004, 0x36a21004, 0x36a31004, 0x36a41004, 0x36a51004, 0x36a61004, 0x36a71004,
+        0x36a81004, 0x36a91004, 0x36aa1004, 0x36ab1004, 0x36ac1004, 0x36ad1004, 0x36ae1004, 0x36af1004,
+        0x36b01004, 0x36b11004, 0x36b21004, 0x36b31004, 0x36b41004, 0x36b51004, 0x36b61004, 0x36b71004,
+        0x36b81004, 0x36b91004, 0x00007404, 0x00007484, 0x00007504, 0x36ba1004, 0x02a31004, 0x02a41004,
+        0x02601004, 0x1f4b1004, 0x043f1004, 0x04401004, 0x04411004, 0x1f761004, 0x36981004, 0x03f21004,
+        0x027f1004, 0x02301004, 0x02841004, 0x025d1004, 0x025e1004, 0x02111004, 0x02121004, 0x02311004,
+        0x02851004, 0x383e1004, 0x38401004, 0x38431004, 0x38491004, 0x384b1004, 0x384e1004, 0x38501004,
+        0x38531004, 0x38541004, 0x38551004, 0x385a1004, 0x385c1004, 0x385f1004, 0x38611004, 0x38661004,
+        0x38681004, 0x38691004, 0x386a1004, 0x38711004, 0x38741004, 0x38771004, 0x387d1004, 0x38811004,
+        0x38841004, 0x38861004, 0x38881004, 0x388b1004, 0x38901004, 0x38911004, 0x38941004, 0x38981004,
+        0x389b1004, 0x389c1004, 0x389d1004, 0x389e1004, 0x383d1004, 0x38411004, 0x38441004, 0x384a1004,
+        0x384c1004, 0x384f1004, 0x38511004, 0x38561004, 0x385b1004, 0x385d1004, 0x38601004, 0x38621004,
+        0x38671004, 0x38721004, 0x38751004, 0x38781004, 0x387e1004, 0x38921004, 0x38821004, 0x38871004,
+        0x388c1004, 0x38961004, 0x38991004, 0x389f1004, 0x38a01004, 0x387b1004, 0x38421004, 0x38451004,
+        0x38481004, 0x38521004, 0x384d1004, 0x38571004, 0x388d1004, 0x38631004, 0x38651004, 0x385e1004,
+        0x386b1004, 0x38731004, 0x38761004, 0x387f1004, 0x38891004, 0x38971004, 0x389a1004, 0x38931004,
+        0x38951004, 0x38a11004, 0x38791004, 0x38831004, 0x38461004, 0x388e1004, 0x38851004, 0x388a1004,
+        0x38801004, 0x387a1004, 0x38361004, 0x38371004, 0x38381004, 0x38391004, 0x383a1004, 0x383b1004,
+        0x383c1004, 0x383f1004, 0x38471004, 0x388f1004, 0x38581004, 0x387c1004, 0x38a21004, 0x38a41004,
+        0x38a51004, 0x38a71004, 0x38a81004, 0x38ab1004, 0x38ad1004, 0x38ae1004, 0x38b01004, 0x38b21004,
+        0x38b41004, 0x38b51004, 0x38a91004, 0x38b31004, 0x38641004, 0x38591004, 0x386c1004, 0x386d1004,
+        0x38a31004, 0x38a61004, 0x38aa1004, 0x38ac1004, 0x386e1004, 0x38b11004, 0x386f1004, 0x38701004,
+        0x38b61004, 0x38b71004, 0x38af1004, 0x38b91004, 0x38b81004, 0x3bd51004, 0x3bd61004, 0x3bd71004,
+        0x3bd81004, 0x3bd91004, 0x3bda1004, 0x3bdb1004, 0x3bdc1004, 0x3bdd1004, 0x3bde1004, 0x3bdf1004,
+        0x3be01004, 0x3be11004, 0x3be21004, 0x3be31004, 0x3be41004, 0x3be51004, 0x3be61004, 0x3be71004,
+        0x3be81004, 0x3be91004, 0x3bea1004, 0x3beb1004, 0x3bec1004, 0x3bed1004, 0x3bee1004, 0x3bef1004,
+        0x3bf01004, 0x3bf11004, 0x3bf21004, 0x3bf31004, 0x3bf41004, 0x3bf51004, 0x3bf61004, 0x3bf71004,
+        0x3bf81004, 0x3bf91004, 0x3bfa1004, 0x3bfb1004, 0x3bfc1004, 0x3bfd1004, 0x3bfe1004, 0x3bff1004,
+        0x3c001004, 0x3c011004, 0x3c021004, 0x3c031004, 0x3c041004, 0x3c051004, 0x3c061004, 0x3c071004,
+        0x3c081004, 0x3c091004, 0x3c0a1004, 0x3c0b1004, 0x3c0c1004, 0x3c0d1004, 0x3c0e1004, 0x3c0f1004,
+        0x3c101004, 0x3c111004, 0x3c121004, 0x3c131004, 0x3c141004, 0x3c151004, 0x3c161004, 0x3c171004,
+        0x3c181004, 0x3c191004, 0x3c1a1004, 0x34541004, 0x34551004, 0x34561004, 0x34571004, 0x34581004,
+        0x34591004, 0x345a1004, 0x345b1004, 0x345c1004, 0x345d1004, 0x345e1004, 0x345f1004, 0x34601004,
+        0x34611004, 0x34621004, 0x34631004, 0x34641004, 0x34651004, 0x34661004, 0x34671004, 0x34681004,
+        0x34691004, 0x346a1004, 0x346b1004, 0x346c1004, 0x346d1004, 0x346e1004, 0x346f1004, 0x34701004,
+        0x345c1048, 0x347a1008, 0x345f1048, 0x347b1008, 0x34711004, 0x34721004, 0x34731004, 0x34741004,
+        0x34751004, 0x34761004, 0x34771004, 0x34781004, 0x34791004, 0x347a1004, 0x347b1004, 0x347c1004,
+        0x347d1004, 0x347e1004, 0x347f1004, 0x34801004, 0x34811004, 0x34821004, 0x34831004, 0x34841004,
+        0x34851004, 0x00007984, 0x00007a04, 0x00007a84, 0x05981004, 0x026b1004, 0x02741004, 0x36bb1004,
+        0x36bc1004, 0x36bd1004, 0x36be1004, 0x36bf1004, 0x36c01004, 0x36c11004, 0x36c21004, 0x36c31004,
+        0x36c41004, 0x36c51004, 0x36c61004, 0x36c71004, 0x36c81004, 0x36c91004, 0x36ca1004, 0x36cb1004,
+        0x36cc1004, 0x36cd1004, 0x36ce1004, 0x36cf1004, 0x36d01004, 0x36d11004, 0x36d21004, 0x36d31004,
+        0x36d41004, 0x36d51004, 0x36d61004, 0x36d71004, 0x36d81004, 0x36d91004, 0x36da1004, 0x36db1004,
+        0x36dc1004, 0x36dd1004, 0x36de1004, 0x36df1004, 0x36e01004, 0x36e11004, 0x36e21004, 0x36e31004,
+        0x36e41004, 0x36e51004, 0x36e61004, 0x36e71004, 0x36e81004, 0x36e91004, 0x36ea1004, 0x36eb1004,
+        0x36ec1004, 0x36ed1004, 0x36ee1004, 0x36ef1004, 0x36f01004, 0x36f11004, 0x36f21004, 0x36f31004,
+        0x36f41004, 0x36f51004, 0x36f61004, 0x36f71004, 0x36f81004, 0x36f91004, 0x36fa1004, 0x36fb1004,
+        0x36fc1004, 0x36fd1004, 0x36fe1004, 0x36ff1004, 0x37001004, 0x37011004, 0x37021004, 0x37031004,
+        0x37041004, 0x37051004, 0x37061004, 0x37071004, 0x37081004, 0x37091004, 0x370a1004, 0x370b1004,
+        0x370c1004, 0x370d1004, 0x370e1004, 0x370f1005, 0x37101005, 0x37111005, 0x37121004, 0x37131004,
+        0x37141005, 0x37151004, 0x37161004, 0x37171004, 0x37181004, 0x37191004, 0x371a1004, 0x371b1004,
+        0x371c1004, 0x371d1004, 0x371e1004, 0x371f1004, 0x37201004, 0x37211004, 0x37221004, 0x37231004,
+        0x36fa1048, 0x37101008, 0x36fa1048, 0x37101048, 0x371b1008, 0x059f1004, 0x05a01004, 0x05a11004,
+        0x05a21004, 0x05a31004, 0x05a41004, 0x05a51004, 0x05a61004, 0x05a71004, 0x05a81004, 0x05a91004,
+        0x05aa1004, 0x05ab1004, 0x05ac1004, 0x05ad1004, 0x05ae1004, 0x05af1004, 0x05b01004, 0x05b11004,
+        0x05b21004, 0x05b31004, 0x05b41004, 0x05b51004, 0x05b61004, 0x05b71004, 0x05b81004, 0x05b91004,
+        0x05ba1004, 0x05bb1004, 0x05bc1004, 0x05bd1004, 0x05be1004, 0x34d51004, 0x34d61004, 0x34d71004,
+        0x34d81004, 0x34d91004, 0x34da1004, 0x34db1004, 0x34dc1004, 0x34dd1004, 0x34de1004, 0x34df1004,
+        0x34e01004, 0x34e11004, 0x34e21004, 0x34e31004, 0x34e41004, 0x34e51004, 0x34e61004, 0x34e71004,
+        0x34e81004, 0x34e91004, 0x34ea1004, 0x34eb1004, 0x34ec1004, 0x34ed1004, 0x34ee1004, 0x34ef1004,
+        0x34f01004, 0x02d21004, 0x02d31004, 0x37241004, 0x37251004, 0x37261004, 0x37271004, 0x37281004,
+        0x37291004, 0x372a1004, 0x372b1004, 0x372c1004, 0x372d1004, 0x372e1004, 0x372f1004, 0x37301004,
+        0x37311004, 0x37321004, 0x37331004, 0x37341004, 0x37351004, 0x37361004, 0x37371004, 0x37381004,
+        0x37391004, 0x373a1004, 0x373b1004, 0x373c1004, 0x373d1004, 0x373e1004, 0x373f1004, 0x37401004,
+        0x37411004, 0x37421004, 0x37431004, 0x37441004, 0x37451004, 0x37461004, 0x37471004, 0x37481004,
+        0x37491004, 0x374a1004, 0x374b1004, 0x374c1004, 0x374d1004, 0x374e1004, 0x374f1004, 0x37501004,
+        0x37591004, 0x375a1004, 0x375b1004, 0x375c1004, 0x375d1004, 0x375e1004, 0x37511004, 0x374a1048,
+        0x37701048, 0x374a1008, 0x37531004, 0x37541004, 0x37551004, 0x372a1008, 0x373f1008, 0x37561004,
+        0x37571004, 0x37581004, 0x37701004, 0x375f1004, 0x37611004, 0x37621004, 0x37621008, 0x37631004,
+        0x37641004, 0x37651004, 0x37661004, 0x37671004, 0x37681004, 0x37521004, 0x37601004, 0x376f1004,
+        0x37691004, 0x376a1004, 0x376c1004, 0x376d1004, 0x376e1004, 0x376b1004, 0x00007584, 0x00007604,
+        0x00007684, 0x00007704, 0x00007784, 0x00007804, 0x00007884, 0x00007904, 0x04421004, 0x04431004,
+        0x04441004, 0x04451004, 0x04461004, 0x04471004, 0x04481004, 0x1f4c1004, 0x02a51004, 0x02a61004,
+        0x02a71004, 0x02a81004, 0x04491004, 0x044a1004, 0x00001b04, 0x22591008, 0x22601008, 0x00006484,
+        0x37b61005, 0x37b71004, 0x37b81005, 0x37b91004, 0x37ba1005, 0x37bb1004, 0x37bc1005, 0x37bd1004,
+        0x37be1005, 0x37bf1004, 0x37c01004, 0x37c11004, 0x37c21005, 0x37c31004, 0x37c41004, 0x37c71004,
+        0x37c81004, 0x37c91004, 0x37ca1004, 0x37cb1004, 0x37cc1004, 0x37cd1004, 0x37ce1004, 0x37cf1004,
+        0x37d01004, 0x37d11004, 0x37d21004, 0x37d31004, 0x37d41004, 0x37d51004, 0x37d71004, 0x37d81004,
+        0x37d91004, 0x37da1004, 0x37db1004, 0x37dd1004, 0x37de1004, 0x37df1004, 0x37e01004, 0x37e11004,
+        0x37e21004, 0x37e31004, 0x37e41004, 0x37e61004, 0x37e71004, 0x37e81004, 0x37eb1004, 0x37ec1004,
+        0x37ed1004, 0x37ee1004, 0x37ef1004, 0x37f01004, 0x37f11005, 0x37f21004, 0x37f31005, 0x37f41004,
+        0x37f51005, 0x37f61005, 0x37f71004, 0x37f81004, 0x37f91005, 0x37fa1004, 0x37fb1004, 0x37c51004,
+        0x37c61004, 0x37d61004, 0x37dc1004, 0x37e51004, 0x37e91004, 0x37ea1004, 0x02d41004, 0x02d51004,
+        0x02871004, 0x02611004, 0x02a91004, 0x02aa1004, 0x02101004, 0x05bf1004, 0x05c01004, 0x05c11004,
+        0x05c21004, 0x05c31004, 0x05c41004, 0x05c51004, 0x05c61004, 0x05c71004, 0x05c81004, 0x05c91004,
+        0x05ca1004, 0x05cb1004, 0x05cc1004, 0x05cd1004, 0x05ce1004, 0x05cf1004, 0x05d01004, 0x05d11004,
+        0x00006584, 0x313a1004, 0x313b1004, 0x313c1004, 0x313d1004, 0x313e1004, 0x313f1004, 0x31401004,
+        0x31411004, 0x31431004, 0x31441004, 0x31451004, 0x31461004, 0x31471004, 0x31481004, 0x31491004,
+        0x314a1004, 0x314b1004, 0x314c1004, 0x314d1004, 0x314e1004, 0x314f1004, 0x31501004, 0x31521004,
+        0x31541004, 0x31561004, 0x31591004, 0x315c1004, 0x315e1004, 0x315f1004, 0x31611004, 0x31551004,
+        0x31571004, 0x315a1004, 0x31621004, 0x31631004, 0x31641004, 0x31651004, 0x31661004, 0x31671004,
+        0x31681004, 0x31691004, 0x31531004, 0x315d1004, 0x31421004, 0x31601004, 0x313a1008, 0x31581004,
+        0x315b1004, 0x31511004, 0x31411032, 0x31521032, 0x35081004, 0x35081008, 0x35091004, 0x35091008,
+        0x350a1004, 0x350a1008, 0x350b1004, 0x350b1008, 0x350c1004, 0x350c1008, 0x350d1004, 0x350d1008,
+        0x350e1004, 0x350e1008, 0x350f1004, 0x35101004, 0x35111004, 0x35111008, 0x35121004, 0x35121008,
+        0x35131004, 0x35131008, 0x35141004, 0x35141008, 0x35151004, 0x35151008, 0x35161004, 0x35171004,
+        0x35171008, 0x35181004, 0x35191004, 0x351a1004, 0x351b1004, 0x351c1004, 0x351d1004, 0x351e1004,
+        0x351e1008, 0x351f1004, 0x35201004, 0x35201008, 0x35211004, 0x35211008, 0x35221004, 0x35221008,
+        0x35231004, 0x35241004, 0x35251004, 0x35261004, 0x04561004, 0x04571004, 0x04581004, 0x04591004,
+        0x33e61004, 0x33e71004, 0x33e81004, 0x33e91004, 0x33ea1004, 0x33eb1004, 0x33ec1004, 0x33ed1004,
+        0x33ee1004, 0x33ef1004, 0x33f31004, 0x33f41004, 0x33f51004, 0x33f61004, 0x33f71004, 0x33f81004,
+        0x33f91004, 0x33fa1004, 0x33fb1004, 0x33fc1004, 0x33fd1004, 0x33fe1004, 0x33ff1004, 0x34001004,
+        0x34011004, 0x34021004, 0x34031004, 0x34051004, 0x34071004, 0x34081004, 0x34091004, 0x340a1004,
+        0x340b1004, 0x340c1004, 0x340d1004, 0x340e1004, 0x34041004, 0x34061004, 0x34101004, 0x34111004,
+        0x34121004, 0x34131004, 0x34141004, 0x34151004, 0x34161004, 0x34171004, 0x34181004, 0x34191004,
+        0x341a1004, 0x341b1004, 0x341c1004, 0x341d1004, 0x341e1004, 0x341f1004, 0x340f1004, 0x029a1004,
+        0x029b1004, 0x04381004, 0x04391004, 0x043a1004, 0x33f01004, 0x33f11004, 0x33f21004, 0x38ba1004,
+        0x38bb1004, 0x38bc1004, 0x38bd1004, 0x38be1004, 0x38bf1004, 0x38c01004, 0x38c11004, 0x38c21004,
+        0x38c31004, 0x38c41004, 0x38c51004, 0x38c61004, 0x38c71004, 0x38c81004, 0x38c91004, 0x38ca1004,
+        0x38cb1004, 0x38cc1004, 0x38cd1004, 0x38ce1004, 0x38cf1004, 0x38d01004, 0x38d11004, 0x38d21004,
+        0x38d31004, 0x38d41004, 0x38d51004, 0x38d61004, 0x38d71004, 0x38d81004, 0x38d91004, 0x38da1004,
+        0x38db1004, 0x38dc1004, 0x38dd1004, 0x02cb1004, 0x02cc1004, 0x23971008, 0x23af1008, 0x244c1008,
+        0x246a1008, 0x24731008, 0x24f41008, 0x25051008, 0x248e1008, 0x259f1010, 0x25a11010, 0x25a31010,
+        0x25a51010, 0x25a71010, 0x25a91010, 0x25ab1010, 0x25af1010, 0x25b11010, 0x25b31010, 0x25b51010,
+        0x25b71010, 0x25b91010, 0x25bd1010, 0x25bf1010, 0x25c11010, 0x25c31010, 0x25c51010, 0x25c71010,
+        0x25cb1010, 0x25cd1010, 0x25cf1010, 0x25d11010, 0x25d31010, 0x25d51010, 0x25d71010, 0x25d91010,
+        0x25db1010, 0x25dd1010, 0x25df1010, 0x25e11010, 0x25e51010, 0x25e71010, 0x25ad1010, 0x25bb1010,
+        0x25c91010, 0x25e31010, 0x25e91010, 0x25eb1010, 0x25ec1010, 0x25ee1010, 0x25ef1010, 0x25f01010,
+        0x25f11010, 0x25f31010, 0x25f41010, 0x044b1004, 0x044c1004, 0x044d1004, 0x044e1004, 0x044f1004,
+        0x04501004, 0x04511004, 0x04521004, 0x2a1e1004, 0x2a1e1008, 0x2a1f1004, 0x2a201004, 0x1fa61004,
+        0x1faa1004, 0x1fab1004, 0x1fc91004, 0x1fda1004, 0x1fef1004, 0x1ff01004, 0x200b1004, 0x20311004,
+        0x209e1004, 0x20b31004, 0x20c81004, 0x20df1004, 0x210d1004, 0x21211004, 0x21401004, 0x21531004,
+        0x21411004, 0x21541004, 0x214d1004, 0x21471004, 0x216a1004, 0x21591004, 0x215a1004, 0x216f1004,
+        0x219e1004, 0x21a81004, 0x21fb1004, 0x221b1004, 0x221d1004, 0x221e1004, 0x223d1004, 0x224b1004,
+        0x225d1004, 0x228a1004, 0x22a71004, 0x22ef1004, 0x22f01004, 0x23211004, 0x232f1004, 0x23351004,
+        0x233a1004, 0x23451004, 0x24191004, 0x1fa2103a, 0x1fa21068, 0x00008c68, 0x20071028, 0x1fbc103a,
+        0x1fc81004, 0x1feb103a, 0x2007103a, 0x2015103a, 0x2051103a, 0x2075103a, 0x2090103a, 0x20ab103a,
+        0x20c4103a, 0x20d6103a, 0x2109103a, 0x2118103a, 0x21201004, 0x213c103a, 0x2166103a, 0x216b103a,
+        0x2193103a, 0x21f7103a, 0x2217103a, 0x2259103a, 0x1fad1028, 0x1fb11028, 0x1fab1028, 0x1fbc1028,
+        0x1feb1028, 0x20071028, 0x201a1028, 0x201f1028, 0x20311028, 0x20511028, 0x209e1028, 0x20c41028,
+        0x21091028, 0x21371028, 0x214f1028, 0x21591028, 0x215a1028, 0x216b1028, 0x21f71028, 0x22171028,
+        0x221d1028, 0x22381028, 0x22471028, 0x22f01028, 0x231f1028, 0x23201028, 0x23221028, 0x23421028,
+        0x23431028, 0x2090102a, 0x2193102a, 0x2217102a, 0x2247102a, 0x231f102a, 0x2320102a, 0x2339102a,
+        0x2342102a, 0x2343102a, 0x221f1004, 0x1fca1004, 0x1ff21004, 0x20491004, 0x210e1004, 0x21221004,
+        0x21721004, 0x21a31004, 0x21c01004, 0x21d81004, 0x22011004, 0x228f1004, 0x206b1004, 0x24311028,
+        0x20511048, 0x00008c88, 0x21f71048, 0x00008c48, 0x20751008, 0x20a31004, 0x20aa1004, 0x21701004,
+        0x22281004, 0x22461004, 0x1fcc1004, 0x1ff31004, 0x204a1004, 0x20621004, 0x20c91004, 0x20f11004,
+        0x210f1004, 0x212c1004, 0x21731004, 0x21ad1004, 0x21d91004, 0x21e91004, 0x224d1004, 0x22681004,
+        0x22901004, 0x1fa81004, 0x1fb61004, 0x1ffc1004, 0x20121004, 0x20231004, 0x20301004, 0x201e1004,
+        0x20a41004, 0x21561004, 0x21f21004, 0x22291004, 0x22ac1004, 0x1fb71028, 0x1fd61028, 0x1fe51028,
+        0x1feb1068, 0x00008c28, 0x202c1028, 0x20421028, 0x20bc1028, 0x20551028, 0x222c1028, 0x209f1028,
+        0x20a61028, 0x20981028, 0x20a31028, 0x20b81028, 0x20f21028, 0x20f11028, 0x20da1028, 0x21101028,
+        0x223e1028, 0x21231028, 0x212d1028, 0x211c1028, 0x215c1028, 0x217b1028, 0x21da1028, 0x21e41028,
+        0x22021028, 0x22221028, 0x22421028, 0x221b1028, 0x224e1028, 0x22551028, 0x22861028, 0x22951028,
+        0x22991028, 0x22a31028, 0x232a1028, 0x22c51008, 0x1fa21048, 0x00008c08, 0x1fa21048, 0x213c1008,
+        0x1fa21048, 0x22471008, 0x1fd61048, 0x00001808, 0x1feb1048, 0x00008c88, 0x20511008, 0x205a1008,
+        0x20c41008, 0x20d61008, 0x20da1008, 0x210d1008, 0x21181008, 0x211c1008, 0x21981008, 0x219d1008,
+        0x21d21008, 0x22861008, 0x1fb11008, 0x1fbc1008, 0x1fd51008, 0x201a1008, 0x20421008, 0x20ea1008,
+        0x213c1048, 0x00001a08, 0x216b1008, 0x21e41008, 0x22171048, 0x00001a08, 0x1fa21048, 0x00001588,
+        0x213c1048, 0x00001588, 0x22171048, 0x00001588, 0x1fa21050, 0x00002204, 0x1fa21044, 0x00002204,
+        0x1fbc1050, 0x00001704, 0x1fbc1044, 0x00001704, 0x1fbc1050, 0x00002104, 0x1fbc1044, 0x00002104,
+        0x1fbc1050, 0x00002484, 0x1fbc1044, 0x00002484, 0x1fd61050, 0x00001844, 0x00001204, 0x1fd61044,
+        0x00001844, 0x00001204, 0x1feb1050, 0x00001704, 0x1feb1044, 0x00001704, 0x1feb1050, 0x00002104,
+        0x1feb1044, 0x00002104, 0x1feb1050, 0x00002484, 0x1feb1044, 0x00002484, 0x1feb1050, 0x00001804,
+        0x1feb1044, 0x00001804, 0x1feb1050, 0x00002304, 0x1feb1044, 0x00002304, 0x20071050, 0x00001944,
+        0x00001284, 0x20071044, 0x00001944, 0x00001284, 0x20071050, 0x00001944, 0x00001204, 0x20071044,
+        0x00001944, 0x00001204, 0x20071050, 0x00002304, 0x20071044, 0x00002304, 0x20071050, 0x00002404,
+        0x20071044, 0x00002404, 0x20071050, 0x00001844, 0x00001304, 0x20071044, 0x00001844, 0x00001304,
+        0x20421050, 0x00001704, 0x20421044, 0x00001704, 0x20511050, 0x00001904, 0x20511044, 0x00001904,
+        0x20751050, 0x00001704, 0x20751044, 0x00001704, 0x20751050, 0x00002104, 0x20751044, 0x00002104,
+        0x20751050, 0x00001584, 0x20751044, 0x00001584, 0x20751050, 0x00001804, 0x20751044, 0x00001804,
+        0x20751050, 0x00002384, 0x20751044, 0x00002384, 0x20901050, 0x00002404, 0x20901044, 0x00002404,
+        0x20901050, 0x000015c4, 0x00001204, 0x20901044, 0x000015c4, 0x00001204, 0x20c41050, 0x00001204,
+        0x20c41044, 0x00001204, 0x20c41050, 0x00002104, 0x20c41044, 0x00002104, 0x20c41050, 0x00002484,
+        0x20c41044, 0x00002484, 0x20d61050, 0x00002104, 0x20d61044, 0x00002104, 0x20d61050, 0x00002144,
+        0x00001904, 0x20d61044, 0x00002144, 0x00001904, 0x20d61050, 0x00002484, 0x20d61044, 0x00002484,
+        0x20d61050, 0x00002304, 0x20d61044, 0x00002304, 0x21091050, 0x00001204, 0x21091044, 0x00001204,
+        0x21091050, 0x00001704, 0x21091044, 0x00001704, 0x21091050, 0x00002104, 0x21091044, 0x00002104,
+        0x21181050, 0x00001704, 0x21181044, 0x00001704, 0x21181050, 0x00002104, 0x21181044, 0x00002104,
+        0x21181050, 0x00002484, 0x21181044, 0x00002484, 0x21181050, 0x00002304, 0x21181044, 0x00002304,
+        0x213c1050, 0x000016c4, 0x00001204, 0x213c1044, 0x000016c4, 0x00001204, 0x213c1050, 0x000016c4,
+        0x00001584, 0x213c1044, 0x000016c4, 0x00001584, 0x213c1050, 0x00001944, 0x00001284, 0x213c1044,
+        0x00001944, 0x00001284, 0x213c1050, 0x00001944, 0x00001204, 0x213c1044, 0x00001944, 0x00001204,
+        0x216b1050, 0x00001204, 0x216b1044, 0x00001204, 0x216b1050, 0x00001704, 0x216b1044, 0x00001704,
+        0x21931050, 0x00001704, 0x21931044, 0x00001704, 0x21931050, 0x00002104, 0x21931044, 0x00002104,
+        0x21931050, 0x00002144, 0x00001904, 0x21931044, 0x00002144, 0x00001904, 0x21931050, 0x00002484,
+        0x21931044, 0x00002484, 0x21d21050, 0x00001704, 0x21d21044, 0x00001704, 0x21d21050, 0x00002104,
+        0x21d21044, 0x00002104, 0x21d21050, 0x00001244, 0x00001704, 0x21d21044, 0x00001244, 0x00001704,
+        0x21d21050, 0x00001444, 0x00001704, 0x21d21044, 0x00001444, 0x00001704, 0x21d21050, 0x00002144,
+        0x00001704, 0x21d21044, 0x00002144, 0x00001704, 0x21f71050, 0x00001704, 0x21f71044, 0x00001704,
+        0x21f71050, 0x00002104, 0x21f71044, 0x00002104, 0x21f71050, 0x00002484, 0x21f71044, 0x00002484,
+        0x21f71050, 0x00002304, 0x21f71044, 0x00002304, 0x22171050, 0x00002184, 0x22171044, 0x00002184,
+        0x22171050, 0x00002404, 0x22171044, 0x00002404, 0x22171050, 0x00002304, 0x22171044, 0x00002304,
+        0x22171050, 0x000016c4, 0x00001204, 0x22171044, 0x000016c4, 0x00001204, 0x22171050, 0x00001944,
+        0x00001584, 0x22171044, 0x00001944, 0x00001584, 0x22471050, 0x00001684, 0x22471044, 0x00001684,
+        0x22471050, 0x00002104, 0x22471044, 0x00002104, 0x22591050, 0x00001284, 0x22591044, 0x00001284,
+        0x22591050, 0x00001204, 0x22591044, 0x00001204, 0x22591050, 0x00001584, 0x22591044, 0x00001584,
+        0x22591050, 0x00001704, 0x22591044, 0x00001704, 0x22591050, 0x00002104, 0x22591044, 0x00002104,
+        0x22641050, 0x00001704, 0x22641044, 0x00001704, 0x22641050, 0x00001584, 0x22641044, 0x00001584,
+        0x22701050, 0x00001704, 0x22701044, 0x00001704, 0x22861050, 0x00001384, 0x22861044, 0x00001384,
+        0x22861050, 0x00002104, 0x22861044, 0x00002104, 0x22861050, 0x00002484, 0x22861044, 0x00002484,
+        0x20751044, 0x00002484, 0x21f71044, 0x00001584, 0x22591044, 0x00001484, 0x22701044, 0x00001484,
+        0x1fa21048, 0x22e51008, 0x21d21048, 0x00008cc8, 0x00001704, 0x21e21004, 0x21e31004, 0x21d21054,
+        0x00008c48, 0x21d21014, 0x20061004, 0x1fa21050, 0x00002104, 0x1fa21044, 0x00002104, 0x1fa21050,
+        0x00001d84, 0x1fa21044, 0x00001d84, 0x1fa21050, 0x000013c4, 0x00001204, 0x1fa21044, 0x000013c4,
+        0x00001204, 0x1fa21050, 0x000013c4, 0x00001284, 0x1fa21044, 0x000013c4, 0x00001284, 0x1fa21050,
+        0x000013c4, 0x00001d84, 0x1fa21044, 0x000013c4, 0x00001d84, 0x1fa21050, 0x000013c4, 0x00001684,
+        0x1fa21044, 0x000013c4, 0x00001684, 0x1fa21050, 0x00002144, 0x00001384, 0x1fa21044, 0x00002144,
+        0x00001384, 0x1fa21050, 0x00001344, 0x00001204, 0x1fa21044, 0x00001344, 0x00001204, 0x1fa21050,
+        0x00001344, 0x00001284, 0x1fa21044, 0x00001344, 0x00001284, 0x1fa21050, 0x00001344, 0x00001d84,
+        0x1fa21044, 0x00001344, 0x00001d84, 0x1fa21050, 0x00001344, 0x00001684, 0x1fa21044, 0x00001344,
+        0x00001684, 0x1fa21050, 0x00002144, 0x00001304, 0x1fa21044, 0x00002144, 0x00001304, 0x20071050,
+        0x00002104, 0x20071044, 0x00002104, 0x20071050, 0x00001d84, 0x20071044, 0x00001d84, 0x20071050,
+        0x00001684, 0x20071044, 0x00001684, 0x20071050, 0x000013c4, 0x00001204, 0x20071044, 0x000013c4,
+        0x00001204, 0x20071050, 0x000013c4, 0x00001284, 0x20071044, 0x000013c4, 0x00001284, 0x20071050,
+        0x000013c4, 0x00001d84, 0x20071044, 0x000013c4, 0x00001d84, 0x20071050, 0x000013c4, 0x00001684,
+        0x20071044, 0x000013c4, 0x00001684, 0x20071050, 0x00002144, 0x00001384, 0x20071044, 0x00002144,
+        0x00001384, 0x20901050, 0x00001d84, 0x20901044, 0x00001d84, 0x20901050, 0x00002104, 0x20901044,
+        0x00002104, 0x213c1050, 0x00002104, 0x213c1044, 0x00002104, 0x213c1050, 0x00001d84, 0x213c1044,
+        0x00001d84, 0x213c1050, 0x000013c4, 0x00001204, 0x213c1044, 0x000013c4, 0x00001204, 0x213c1050,
+        0x000013c4, 0x00001284, 0x213c1044, 0x000013c4, 0x00001284, 0x213c1050, 0x000013c4, 0x00001d84,
+        0x213c1044, 0x000013c4, 0x00001d84, 0x213c1050, 0x000013c4, 0x00001684, 0x213c1044, 0x000013c4,
+        0x00001684, 0x213c1050, 0x00002144, 0x00001384, 0x213c1044, 0x00002144, 0x00001384, 0x213c1050,
+        0x00001fc4, 0x00001204, 0x213c1044, 0x00001fc4, 0x00001204, 0x213c1050, 0x00001fc4, 0x00001284,
+        0x213c1044, 0x00001fc4, 0x00001284, 0x213c1050, 0x00001fc4, 0x00001d84, 0x213c1044, 0x00001fc4,
+        0x00001d84, 0x213c1050, 0x00001fc4, 0x00001684, 0x213c1044, 0x00001fc4, 0x00001684, 0x213c1050,
+        0x00001fc4, 0x00002104, 0x213c1044, 0x00001fc4, 0x00002104, 0x22171050, 0x00002104, 0x22171044,
+        0x00002104, 0x22171050, 0x00001d84, 0x22171044, 0x00001d84, 0x22171050, 0x00001fc4, 0x00001204,
+        0x22171044, 0x00001fc4, 0x00001204, 0x22171050, 0x00001fc4, 0x00001284, 0x22171044, 0x00001fc4,
+        0x00001284, 0x22171050, 0x00001fc4, 0x00001d84, 0x22171044, 0x00001fc4, 0x00001d84, 0x22171050,
+        0x00001fc4, 0x00001684, 0x22171044, 0x00001fc4, 0x00001684, 0x22171050, 0x00001fc4, 0x00002104,
+        0x22171044, 0x00001fc4, 0x00002104, 0x22701050, 0x00001284, 0x22701044, 0x00001284, 0x22701050,
+        0x00002104, 0x22701044, 0x00002104, 0x22701050, 0x00001d84, 0x22701044, 0x00001d84, 0x22701050,
+        0x00001684, 0x22701044, 0x00001684, 0x20d61054, 0x20d61014, 0x20d61048, 0x20d61008, 0x22541010,
+        0x22541004, 0x22801010, 0x22801004, 0x231e1044, 0x00001104, 0x231e1044, 0x00001184, 0x231e1044,
+        0x00001144, 0x00001284, 0x231e1044, 0x000011c4, 0x00001284, 0x231e1044, 0x00001144, 0x00001204,
+        0x231e1044, 0x000011c4, 0x00001204, 0x231e1044, 0x00001144, 0x00001504, 0x231e1044, 0x000011c4,
+        0x00001504, 0x231e1050, 0x00001104, 0x231e1050, 0x00001184, 0x231e1050, 0x00001144, 0x00001284,
+        0x231e1050, 0x000011c4, 0x00001284, 0x231e1050, 0x00001144, 0x00001204, 0x231e1050, 0x000011c4,
+        0x00001204, 0x231e1050, 0x00001144, 0x00001504, 0x231e1050, 0x000011c4, 0x00001504, 0x23231044,
+        0x00001104, 0x23231044, 0x00001184, 0x23231044, 0x00001144, 0x00001284, 0x23231044, 0x000011c4,
+        0x00001284, 0x23231044, 0x00001144, 0x00001204, 0x23231044, 0x000011c4, 0x00001204, 0x23231050,
+        0x00001104, 0x23231050, 0x00001184, 0x23231050, 0x00001144, 0x00001284, 0x23231050, 0x000011c4,
+        0x00001284, 0x23231050, 0x00001144, 0x00001204, 0x23231050, 0x000011c4, 0x00001204, 0x23291044,
+        0x00001104, 0x23291044, 0x00001184, 0x23291044, 0x00001144, 0x00001284, 0x23291044, 0x000011c4,
+        0x00001284, 0x23291044, 0x00001144, 0x00001204, 0x23291044, 0x000011c4, 0x00001204, 0x23291044,
+        0x00001144, 0x00001504, 0x23291044, 0x000011c4, 0x00001504, 0x23291050, 0x00001104, 0x23291050,
+        0x00001184, 0x23291050, 0x00001144, 0x00001284, 0x23291050, 0x000011c4, 0x00001284, 0x23291050,
+        0x00001144, 0x00001204, 0x23291050, 0x000011c4, 0x00001204, 0x23291050, 0x00001144, 0x00001504,
+        0x23291050, 0x000011c4, 0x00001504, 0x232b1044, 0x00001104, 0x232b1044, 0x00001184, 0x232b1044,
+        0x00001144, 0x00001284, 0x232b1044, 0x000011c4, 0x00001284, 0x232b1044, 0x00001144, 0x00001204,
+        0x232b1044, 0x000011c4, 0x00001204, 0x232b1044, 0x00001144, 0x00001504, 0x232b1044, 0x000011c4,
+        0x00001504, 0x232b1050, 0x00001104, 0x232b1050, 0x00001184, 0x232b1050, 0x00001144, 0x00001284,
+        0x232b1050, 0x000011c4, 0x00001284, 0x232b1050, 0x00001144, 0x00001204, 0x232b1050, 0x000011c4,
+        0x00001204, 0x232b1050, 0x00001144, 0x00001504, 0x232b1050, 0x000011c4, 0x00001504, 0x23331044,
+        0x00001104, 0x23331044, 0x00001184, 0x23331044, 0x00001144, 0x00001284, 0x23331044, 0x000011c4,
+        0x00001284, 0x23331044, 0x00001144, 0x00001204, 0x23331044, 0x000011c4, 0x00001204, 0x23331050,
+        0x00001104, 0x23331050, 0x00001184, 0x23331050, 0x00001144, 0x00001284, 0x23331050, 0x000011c4,
+        0x00001284, 0x23331050, 0x00001144, 0x00001204, 0x23331050, 0x000011c4, 0x00001204, 0x23411044,
+        0x00001104, 0x23411044, 0x00001184, 0x23411044, 0x00001144, 0x00001284, 0x23411044, 0x000011c4,
+        0x00001284, 0x23411044, 0x00001144, 0x00001204, 0x23411044, 0x000011c4, 0x00001204, 0x23411044,
+        0x00001144, 0x00001504, 0x23411044, 0x000011c4, 0x00001504, 0x23411050, 0x00001184, 0x23411050,
+        0x000011c4, 0x00001284, 0x23411050, 0x000011c4, 0x00001204, 0x23411050, 0x000011c4, 0x00001504,
+        0x23461044, 0x00001104, 0x23461044, 0x00001184, 0x23461044, 0x00001144, 0x00001284, 0x23461044,
+        0x000011c4, 0x00001284, 0x23461044, 0x00001144, 0x00001204, 0x23461044, 0x000011c4, 0x00001204,
+        0x23461044, 0x00001144, 0x00001504, 0x23461044, 0x000011c4, 0x00001504, 0x23461050, 0x00001104,
+        0x23461050, 0x00001184, 0x23461050, 0x00001144, 0x00001284, 0x23461050, 0x000011c4, 0x00001284,
+        0x23461050, 0x00001144, 0x00001204, 0x23461050, 0x000011c4, 0x00001204, 0x23461050, 0x00001144,
+        0x00001504, 0x23461050, 0x000011c4, 0x00001504, 0x231e1044, 0x00001284, 0x23231044, 0x00001284,
+        0x23291044, 0x00001284, 0x232b1044, 0x00001284, 0x23331044, 0x00001284, 0x23411044, 0x00001284,
+        0x23461044, 0x00001284, 0x231e1044, 0x00001144, 0x00002604, 0x231e1044, 0x000011c4, 0x00002604,
+        0x231e1044, 0x00001144, 0x000012c4, 0x00002604, 0x231e1044, 0x000011c4, 0x000012c4, 0x00002604,
+        0x231e1044, 0x00001144, 0x00001244, 0x00002604, 0x231e1044, 0x000011c4, 0x00001244, 0x00002604,
+        0x231e1044, 0x00001144, 0x00001544, 0x00002604, 0x231e1044, 0x000011c4, 0x00001544, 0x00002604,
+        0x231e1050, 0x00001144, 0x00002604, 0x231e1050, 0x000011c4, 0x00002604, 0x231e1050, 0x00001144,
+        0x000012c4, 0x00002604, 0x231e1050, 0x000011c4, 0x000012c4, 0x00002604, 0x231e1050, 0x00001144,
+        0x00001244, 0x00002604, 0x231e1050, 0x000011c4, 0x00001244, 0x00002604, 0x231e1050, 0x00001144,
+        0x00001544, 0x00002604, 0x231e1050, 0x000011c4, 0x00001544, 0x00002604, 0x23291044, 0x00001144,
+        0x00002604, 0x23291044, 0x000011c4, 0x00002604, 0x23291044, 0x00001144, 0x000012c4, 0x00002604,
+        0x23291044, 0x000011c4, 0x000012c4, 0x00002604, 0x23291044, 0x00001144, 0x00001244, 0x00002604,
+        0x23291044, 0x000011c4, 0x00001244, 0x00002604, 0x23291044, 0x00001144, 0x00001544, 0x00002604,
+        0x23291044, 0x000011c4, 0x00001544, 0x00002604, 0x23291050, 0x00001144, 0x00002604, 0x23291050,
+        0x000011c4, 0x00002604, 0x23291050, 0x00001144, 0x000012c4, 0x00002604, 0x23291050, 0x000011c4,
+        0x000012c4, 0x00002604, 0x23291050, 0x00001144, 0x00001244, 0x00002604, 0x23291050, 0x000011c4,
+        0x00001244, 0x00002604, 0x23291050, 0x00001144, 0x00001544, 0x00002604, 0x23291050, 0x000011c4,
+        0x00001544, 0x00002604, 0x23461044, 0x00001144, 0x00002604, 0x23461044, 0x000011c4, 0x00002604,
+        0x23461044, 0x00001144, 0x000012c4, 0x00002604, 0x23461044, 0x000011c4, 0x000012c4, 0x00002604,
+        0x23461044, 0x00001144, 0x00001244, 0x00002604, 0x23461044, 0x000011c4, 0x00001244, 0x00002604,
+        0x23461044, 0x00001144, 0x00001544, 0x00002604, 0x23461044, 0x000011c4, 0x00001544, 0x00002604,
+        0x23461050, 0x00001144, 0x00002604, 0x23461050, 0x000011c4, 0x00002604, 0x23461050, 0x00001144,
+        0x000012c4, 0x00002604, 0x23461050, 0x000011c4, 0x000012c4, 0x00002604, 0x23461050, 0x00001144,
+        0x00001244, 0x00002604, 0x23461050, 0x000011c4, 0x00001244, 0x00002604, 0x23461050, 0x00001144,
+        0x00001544, 0x00002604, 0x23461050, 0x000011c4, 0x00001544, 0x00002604, 0x231e1044, 0x00001304,
+        0x231e1044, 0x00001904, 0x231e1044, 0x000012c4, 0x00002604, 0x231e1044, 0x00002604, 0x231e1044,
+        0x00001244, 0x00002604, 0x231e1044, 0x00001504, 0x231e1044, 0x00001544, 0x00002604, 0x231e1050,
+        0x00001304, 0x231e1050, 0x00001904, 0x231e1050, 0x00001284, 0x231e1050, 0x00002604, 0x04c01004,
+        0x04c21004, 0x04bb1044, 0x00001504, 0x23291044, 0x000012c4, 0x00002604, 0x23291044, 0x00002604,
+        0x23291044, 0x00001244, 0x00002604, 0x23291044, 0x00001504, 0x23291044, 0x00001544, 0x00002604,
+        0x23231050, 0x00001284, 0x23291050, 0x00001284, 0x23291050, 0x00002604, 0x04c01044, 0x00001284,
+        0x04c01044, 0x00001204, 0x04c01044, 0x00001504, 0x232b1044, 0x00001304, 0x232b1044, 0x00001904,
+        0x232b1044, 0x000015c4, 0x00001284, 0x232b1044, 0x00001504, 0x232b1044, 0x000015c4, 0x00001504,
+        0x232b1050, 0x00001304, 0x232b1050, 0x00001904, 0x232b1050, 0x00001284, 0x04c11044, 0x00001284,
+        0x04c11044, 0x00001204, 0x04c11044, 0x00001504, 0x23411044, 0x00001304, 0x23411044, 0x00001904,
+        0x23411044, 0x000015c4, 0x00001284, 0x23391044, 0x00001104, 0x23391044, 0x00001184, 0x23411044,
+        0x00001504, 0x23411044, 0x000015c4, 0x00001504, 0x23411050, 0x00001304, 0x23411050, 0x00001904,
+        0x23411050, 0x00001284, 0x23391050, 0x00001184, 0x04bb1044, 0x00001284, 0x23461044, 0x000012c4,
+        0x00002604, 0x23461044, 0x00002604, 0x23461044, 0x00001244, 0x00002604, 0x23461044, 0x00001504,
+        0x23461044, 0x00001544, 0x00002604, 0x23331050, 0x00001284, 0x23461050, 0x00001284, 0x23461050,
+        0x00002604, 0x04c11004, 0x02131004, 0x02131036, 0x02141004, 0x02151004, 0x02161004, 0x02171004,
+        0x03941004, 0x020c1004, 0x03171004, 0x03181004, 0x03191004, 0x031a1004, 0x031e1004, 0x031f1004,
+        0x03201004, 0x03211004, 0x03b31004, 0x03b41004, 0x03b91004, 0x03ba1004, 0x027e1008, 0x027e1048,
+        0x027e1008, 0x027e1048, 0x027e1048, 0x027e1008, 0x03bb1004, 0x02071004, 0x02081004, 0x03af1004,
+        0x03b11004, 0x03bf1004, 0x03bf1048, 0x03bf1008, 0x03bf1048, 0x03bf1048, 0x03bf1008, 0x03c01004,
+        0x03c01048, 0x03c01008, 0x03c01048, 0x03c01048, 0x03c01008, 0x03c31004, 0x031b1004, 0x031c1004,
+        0x03c41004, 0x02671048, 0x02671008, 0x027c1004, 0x020a1004, 0x03c51004, 0x03c71004, 0x03c91004,
+        0x03ca1004, 0x03bc1004, 0x06761004, 0x03341004, 0x03351004, 0x026d1048, 0x026d1008, 0x026d1048,
+        0x02671008, 0x02671048, 0x026d1008, 0x03aa1004, 0x039d1004, 0x03bd1004, 0x03be1004, 0x03a21004,
+        0x023c1004, 0x03c81004, 0x03a31004, 0x06721004, 0x021a1004, 0x03c61004, 0x02f91004, 0x02fa1004,
+        0x03bf1048, 0x03bf1048, 0x03bf1048, 0x03bf1008, 0x02fb1004, 0x02fc1004, 0x02fd1004, 0x02fe1004,
+        0x02ff1004, 0x03001004, 0x03011004, 0x1f981028, 0x20901028, 0x1f9c1028, 0x1f9d1028, 0x1f9e1028,
+        0x1f9f1028, 0x1fa01028, 0x1fa11028, 0x06661028, 0x06711028, 0x066b1028, 0x03281028, 0x03291028,
+        0x21181028, 0x1f98102a, 0x1f99102a, 0x1f9a102a, 0x1f9b102a, 0x1f9c102a, 0x1f9d102a, 0x1f9e102a,
+        0x1f9f102a, 0x1fa0102a, 0x1fa1102a, 0x0666102a, 0x0671102a, 0x066b102a, 0x0328102a, 0x0329102a,
+        0x1fa2102a, 0x2007102a, 0x213c102a, 0x2264102a, 0x201a102a, 0x2075102a, 0x20c4102a, 0x20d6102a,
+        0x2109102a, 0x2118102a, 0x216b102a, 0x21d2102a, 0x21f7102a, 0x1f781004, 0x1f791004, 0x1f7a1004,
+        0x1f7b1004, 0x1f7c1004, 0x1f7d1004, 0x1f7e1004, 0x1f7f1004, 0x21931054, 0x21d21008, 0x1f801004,
+        0x1f811004, 0x1f821004, 0x1f831004, 0x1f841004, 0x1f851004, 0x1f861004, 0x1f871004, 0x1f881004,
+        0x1f891004, 0x1f8a1004, 0x1f8b1004, 0x1f8c1004, 0x1f8d1004, 0x1f8e1004, 0x1f8f1004, 0x1f901004,
+        0x1f921004, 0x1f931004, 0x1f941004, 0x1f951004, 0x1f961004, 0x1f971004, 0x00008484, 0x00008504,
+        0x00008584, 0x00008604, 0x00008684, 0x00008704, 0x00008784, 0x00008804, 0x00008884, 0x00008904,
+        0x00008984, 0x00008a04, 0x00008a84, 0x00008b04, 0x1fa21048, 0x03a61048, 0x1fd61008, 0x1fa21048,
+        0x03a61048, 0x21d21008, 0x1fd61016, 0x052a1048, 0x1fd61014, 0x05d61004, 0x1fd61048, 0x03a61048,
+        0x213c1008, 0x1fd61048, 0x03a61048, 0x22171008, 0x201f1014, 0x05d71004, 0x052a1048, 0x20421014,
+        0x2051100a, 0x20751016, 0x2075100a, 0x20901016, 0x20d61016, 0x20d6100a, 0x05d81004, 0x21181016,
+        0x21181054, 0x213c1008, 0x05d91004, 0x05da1004, 0x216b1016, 0x21801016, 0x21931016, 0x05db1004,
+        0x05dc1004, 0x21d21068, 0x21091028, 0x21f71054, 0x20071054, 0x20d61014, 0x21f71068, 0x21091028,
+        0x05dd1004, 0x22861016, 0x05de1004, 0x05df1004, 0x05e01004, 0x1fbc1016, 0x05e11004, 0x2007100a,
+        0x20071016, 0x20421016, 0x204f1010, 0x21091016, 0x213c100a, 0x261e1008, 0x261f1008, 0x26201008,
+        0x26211008, 0x2090100a, 0x05e21004, 0x20421054, 0x1fa21054, 0x22641014, 0x2334100a, 0x2320100a,
+        0x23201016, 0x23341016, 0x0665100a, 0x05e31004, 0x05e41004, 0x05e51004, 0x05e61004, 0x1feb1016,
+        0x1feb100a, 0x20ab100a, 0x05e71004, 0x07011004, 0x05e81004, 0x1fa21054, 0x03a61048, 0x21d21014,
+        0x204f1004, 0x05e91004, 0x1f99107c, 0x0676107c, 0x1f9f103c, 0x1f99107c, 0x0676107c, 0x1fa1103c,
+        0x1f99107c, 0x0676107c, 0x1f99107c, 0x1f98103c, 0x1f99107c, 0x0676107c, 0x1f9b103c, 0x1f9a107c,
+        0x0676107c, 0x1f9b103c, 0x1f99107c, 0x0676107c, 0x1f9d103c, 0x1f9a107c, 0x0676107c, 0x1f9d103c,
+        0x1f9b107c, 0x0676107c, 0x1f9d103c, 0x1f9c107c, 0x0676107c, 0x1f9d103c, 0x1f99107c, 0x0676107c,
+        0x1f9e103c, 0x1f9d107c, 0x0676107c, 0x1f9e103c, 0x1f99107c, 0x0676107c, 0x1fa0103c, 0x1f9b107c,
+        0x0676107c, 0x1fa0103c, 0x1f9d107c, 0x0676107c, 0x1fa0103c, 0x1f9f107c, 0x0676107c, 0x1fa0103c,
+        0x1f99107c, 0x0676103c, 0x20901014, 0x20901054, 0x20901014, 0x20901054, 0x20901054, 0x20901014,
+        0x20901054, 0x22471014, 0x22471014, 0x22471054, 0x20901014, 0x22471054, 0x20901054, 0x20901014,
+        0x22471054, 0x20901054, 0x20901054, 0x20901014, 0x20901054, 0x22641014, 0x22641014, 0x22641054,
+        0x20901014, 0x22641054, 0x20901054, 0x20901014, 0x20d61014, 0x1fd61014, 0x1feb1014, 0x21091014,
+        0x20901048, 0x20901008, 0x20901048, 0x20901048, 0x20901008, 0x20901048, 0x22471008, 0x22471048,
+        0x20901008, 0x22471048, 0x20901048, 0x20901008, 0x22471048, 0x20901048, 0x20901048, 0x20901008,
+        0x20901048, 0x22641008, 0x22641048, 0x20901008, 0x22641048, 0x20901048, 0x20901008, 0x1d9b1004,
+        0x1d9c1004, 0x1d9d1004, 0x1fe91010, 0x1fe91004, 0x1d9e1004, 0x1d9f1004, 0x1da01004, 0x1f98107c,
+        0x0676107c, 0x1f9b103c, 0x05ea1004, 0x05eb1004, 0x05ec1004, 0x05ee1004, 0x05ed1004, 0x05ef1004,
+        0x05f01004, 0x05f11004, 0x05f21004, 0x05f31004, 0x05f41004, 0x05f51004, 0x05ec1044, 0x00001784,
+        0x05ed1044, 0x00001784, 0x05f61004, 0x05f71004, 0x05f81004, 0x05f91004, 0x05fa1004, 0x05fb1004,
+        0x05fc1004, 0x05fd1004, 0x05fe1004, 0x05ff1004, 0x06001004, 0x06011004, 0x06021004, 0x06031004,
+        0x06041004, 0x06051004, 0x06061004, 0x06071004, 0x05f01044, 0x00001784, 0x06081004, 0x06091004,
+        0x060a1004, 0x060b1004, 0x060c1004, 0x060d1004, 0x060e1004, 0x060f1004, 0x06101004, 0x06111004,
+        0x06121004, 0x06131004, 0x06141004, 0x06151004, 0x06161004, 0x06171004, 0x06181004, 0x06191004,
+        0x061a1004, 0x061b1004, 0x061c1004, 0x061d1004, 0x061e1004, 0x061f1004, 0x06201004, 0x06211004,
+        0x06221004, 0x06231004, 0x06241004, 0x06251004, 0x06261044, 0x00001784, 0x062a1044, 0x00001784,
+        0x06281044, 0x00001784, 0x06261004, 0x06271004, 0x06281004, 0x06291004, 0x062a1004, 0x062b1004,
+        0x062c1004, 0x062d1004, 0x062e1004, 0x062f1004, 0x06301004, 0x06311004, 0x06321004, 0x06331004,
+        0x06341004, 0x06351004, 0x06361004, 0x06371004, 0x06381004, 0x06391004, 0x063a1004, 0x063b1004,
+        0x063c1004, 0x063d1004, 0x063e1004, 0x063f1004, 0x06401004, 0x06411004, 0x06421004, 0x06431004,
+        0x06441004, 0x06451004, 0x06461004, 0x06471004, 0x06481004, 0x06491004, 0x064a1004, 0x064b1004,
+        0x064c1004, 0x064d1004, 0x064e1004, 0x064f1004, 0x06501004, 0x06511004, 0x06521004, 0x06531004,
+        0x06541004, 0x06551004, 0x06561004, 0x06571004, 0x06581004, 0x06591004, 0x06591044, 0x00001784,
+        0x065a1004, 0x065b1004, 0x065c1004, 0x065d1004, 0x065d1044, 0x00001784, 0x065e1004, 0x065f1004,
+        0x065f1044, 0x00001784, 0x06601004, 0x06621004, 0x06631004, 0x06641004, 0x06651004, 0x06711004,
+        0x06731004, 0x06741004, 0x06751004, 0x06771004, 0x06781004, 0x06791004, 0x067a1004, 0x067b1004,
+        0x067c1004, 0x067e1004, 0x06801004, 0x06811004, 0x06821004, 0x06831004, 0x06841004, 0x06851004,
+        0x06861004, 0x06861044, 0x00001784, 0x06871004, 0x06871044, 0x00001784, 0x06881004, 0x06891004,
+        0x068a1004, 0x068b1004, 0x068c1004, 0x068c1048, 0x068c1008, 0x068c1048, 0x068c1048, 0x068c1008,
+        0x068d1004, 0x068d1048, 0x068d1008, 0x068d1048, 0x068d1048, 0x068d1008, 0x068e1004, 0x068f1004,
+        0x06901004, 0x06911004, 0x06921004, 0x06931004, 0x06941004, 0x06951004, 0x06961004, 0x06971004,
+        0x06981004, 0x06991004, 0x069a1004, 0x069b1004, 0x069c1004, 0x069d1004, 0x06991044, 0x00001784,
+        0x069e1004, 0x069f1004, 0x069f1044, 0x00001784, 0x06a01004, 0x06a11004, 0x06a01044, 0x00001784,
+        0x06a21004, 0x06a21044, 0x00001784, 0x06a31004, 0x06a41004, 0x06a51004, 0x06a61004, 0x06a71004,
+        0x06a81004, 0x06a91004, 0x06aa1004, 0x06ab1004, 0x06ac1004, 0x06ad1004, 0x06ae1004, 0x06af1004,
+        0x06b01004, 0x06b11004, 0x06b21004, 0x06b31004, 0x06b41004, 0x06b51004, 0x06b61004, 0x06b71004,
+        0x06b81004, 0x066b1044, 0x00001784, 0x06b91004, 0x06b91044, 0x00001784, 0x06ba1004, 0x06bb1004,
+        0x06bc1004, 0x06bd1004, 0x06be1004, 0x06bf1004, 0x06c01004, 0x06c11004, 0x06c21004, 0x06c31004,
+        0x06a61044, 0x00001784, 0x066a1044, 0x00001784, 0x066c1044, 0x00001784, 0x06bb1044, 0x00001784,
+        0x06bc1044, 0x00001784, 0x06c41004, 0x06c51004, 0x06c41044, 0x00001784, 0x06c51044, 0x00001784,
+        0x06c61004, 0x06c71004, 0x06c61044, 0x00001784, 0x06c71044, 0x00001784, 0x06c81004, 0x06c91004,
+        0x06ca1004, 0x06cb1004, 0x06cc1004, 0x06cd1004, 0x06c81044, 0x00001784, 0x06c91044, 0x00001784,
+        0x06ce1004, 0x06cf1004, 0x06ce1044, 0x00001784, 0x06cf1044, 0x00001784, 0x06d01004, 0x06d11004,
+        0x06d01044, 0x00001784, 0x06d11044, 0x00001784, 0x06d21004, 0x06d31004, 0x06d41004, 0x06d51004,
+        0x06d61004, 0x06d71004, 0x06d81004, 0x06d91004, 0x06da1004, 0x06db1004, 0x06dc1004, 0x06dd1004,
+        0x06de1004, 0x06df1004, 0x06e01004, 0x06e11004, 0x06e21004, 0x06e31004, 0x06e41004, 0x06e51004,
+        0x06e61004, 0x06e71004, 0x06e81004, 0x06e91004, 0x06ea1004, 0x06eb1004, 0x06ec1004, 0x06ed1004,
+        0x06ee1004, 0x06ef1004, 0x06f01004, 0x06f11004, 0x06f21004, 0x06f31004, 0x06ea1044, 0x00001784,
+        0x06f01044, 0x00001784, 0x06f11044, 0x00001784, 0x06f31044, 0x00001784, 0x06f41004, 0x06f51004,
+        0x06f61004, 0x06f71004, 0x06f81004, 0x06f91004, 0x06fa1004, 0x06fb1004, 0x06fc1004, 0x06fd1004,
+        0x06fe1004, 0x06ff1004, 0x07001004, 0x07021004, 0x07031004, 0x07041004, 0x07051004, 0x07061004,
+        0x07071004, 0x07081004, 0x07091004, 0x070a1004, 0x070b1004, 0x070c1004, 0x070d1004, 0x070e1004,
+        0x070f1004, 0x07101004, 0x07111004, 0x07121004, 0x07131004, 0x07141004, 0x07151004, 0x07161004,
+        0x07171004, 0x07181004, 0x07191004, 0x071a1004, 0x071b1004, 0x071c1004, 0x071d1004, 0x071e1004,
+        0x071f1004, 0x07201004, 0x07211004, 0x07221004, 0x07231004, 0x07241004, 0x06ca1044, 0x00001784,
+        0x06cb1044, 0x00001784, 0x06d91044, 0x00001784, 0x06da1044, 0x00001784, 0x07251004, 0x07261004,
+        0x07271004, 0x07281004, 0x07291004, 0x072a1004, 0x06f61044, 0x00001784, 0x06f71044, 0x00001784,
+        0x06f81044, 0x00001784, 0x06f91044, 0x00001784, 0x072b1004, 0x072c1004, 0x072d1004, 0x072e1004,
+        0x072f1004, 0x07301004, 0x07311004, 0x07321004, 0x07331004, 0x07341004, 0x07351004, 0x07361004,
+        0x07371004, 0x07381004, 0x07391004, 0x073a1004, 0x073b1004, 0x073c1004, 0x073d1004, 0x073e1004,
+        0x073f1004, 0x07401004, 0x07411004, 0x07421004, 0x07431004, 0x07441004, 0x03361004, 0x03371004,
+        0x03381004, 0x03391004, 0x07451004, 0x07461004, 0x07471004, 0x07481004, 0x07491004, 0x074a1004,
+        0x074b1004, 0x074c1004, 0x074d1004, 0x074e1004, 0x074f1004, 0x07501004, 0x07511004, 0x07521004,
+        0x07531004, 0x07541004, 0x07551004, 0x07561004, 0x07571004, 0x07581004, 0x07591004, 0x075a1004,
+        0x075b1004, 0x075c1004, 0x075d1004, 0x075e1004, 0x075f1004, 0x07601004, 0x07611004, 0x03801004,
+        0x03811004, 0x07621004, 0x07631004, 0x07641004, 0x07651004, 0x07661004, 0x07671004, 0x07681004,
+        0x07691004, 0x076a1004, 0x076b1004, 0x076c1004, 0x076d1004, 0x076e1004, 0x076f1004, 0x07701004,
+        0x07711004, 0x07721004, 0x07731004, 0x07741004, 0x07751004, 0x07761004, 0x07771004, 0x07781004,
+        0x07791004, 0x077a1004, 0x077b1004, 0x077c1004, 0x077d1004, 0x077e1004, 0x077f1004, 0x07801004,
+        0x07811004, 0x07821004, 0x07831004, 0x07841004, 0x07851004, 0x07861004, 0x07871004, 0x07881004,
+        0x07891004, 0x078a1004, 0x078b1004, 0x078c1004, 0x078d1004, 0x078e1004, 0x078f1004, 0x07901004,
+        0x07911004, 0x07921004, 0x07931004, 0x07941004, 0x07951004, 0x07961004, 0x07971004, 0x07981004,
+        0x07991004, 0x079a1004, 0x079b1004, 0x079c1004, 0x079d1004, 0x079e1004, 0x079f1004, 0x07a01004,
+        0x07a11004, 0x07a21004, 0x07a31004, 0x07a41004, 0x07a51004, 0x07a61004, 0x07a71004, 0x07a81004,
+        0x07a91004, 0x07aa1004, 0x07ab1004, 0x07ac1004, 0x07ad1004, 0x07ae1004, 0x07af1004, 0x07b01004,
+        0x07b11004, 0x07b21004, 0x07b31004, 0x07b41004, 0x07b51004, 0x07b61004, 0x07b71004, 0x07b81004,
+        0x07b91004, 0x07ba1004, 0x07bb1004, 0x07bc1004, 0x07bd1004, 0x07be1004, 0x07bf1004, 0x07c01004,
+        0x07c11004, 0x07c21004, 0x07c31004, 0x07c41004, 0x07c51004, 0x07c61004, 0x07c71004, 0x07c81004,
+        0x07c91004, 0x07ca1004, 0x07cb1004, 0x07cc1004, 0x07cd1004, 0x07ce1004, 0x07cf1004, 0x07d01004,
+        0x07d11004, 0x07d21004, 0x07d31004, 0x07d41004, 0x07d51004, 0x07d61004, 0x07d71004, 0x07d81004,
+        0x07d91004, 0x07da1004, 0x07db1004, 0x07dc1004, 0x07dd1004, 0x07de1004, 0x07df1004, 0x07e01004,
+        0x07e11004, 0x07e21004, 0x07e31004, 0x07e41004, 0x07e51004, 0x07e61004, 0x07e71004, 0x07e81004,
+        0x07e91004, 0x07ea1004, 0x07eb1004, 0x07ec1004, 0x07ed1004, 0x07ee1004, 0x07ef1004, 0x07f01004,
+        0x07f11004, 0x07f21004, 0x07f31004, 0x07f41004, 0x07f51004, 0x07f61004, 0x07f71004, 0x07f81004,
+        0x07f91004, 0x07fa1004, 0x07fb1004, 0x07fc1004, 0x07fd1004, 0x07fe1004, 0x07ff1004, 0x08001004,
+        0x08011004, 0x08021004, 0x08031004, 0x08041004, 0x08051004, 0x08061004, 0x08071004, 0x08081004,
+        0x08091004, 0x080a1004, 0x080b1004, 0x080c1004, 0x080d1004, 0x080e1004, 0x080f1004, 0x08101004,
+        0x08111004, 0x08121004, 0x08131004, 0x08141004, 0x08151004, 0x08161004, 0x08171004, 0x08181004,
+        0x08191004, 0x081a1004, 0x081b1004, 0x081c1004, 0x081d1004, 0x081e1004, 0x081f1004, 0x08201004,
+        0x08211004, 0x08221004, 0x08231004, 0x08241004, 0x08251004, 0x08261004, 0x08271004, 0x08281004,
+        0x08291004, 0x082a1004, 0x082b1004, 0x082c1004, 0x082d1004, 0x082e1004, 0x082f1004, 0x08301004,
+        0x08311004, 0x08321004, 0x08331004, 0x08341004, 0x08351004, 0x08361004, 0x08371004, 0x08381004,
+        0x08391004, 0x083a1004, 0x083b1004, 0x083c1004, 0x083d1004, 0x083e1004, 0x083f1004, 0x08401004,
+        0x08411004, 0x08421004, 0x08431004, 0x08441004, 0x08451004, 0x08461004, 0x08471004, 0x08481004,
+        0x08491004, 0x084a1004, 0x084b1004, 0x084c1004, 0x084d1004, 0x084e1004, 0x084f1004, 0x08501004,
+        0x08511004, 0x08521004, 0x08531004, 0x08541004, 0x08551004, 0x08561004, 0x08571004, 0x08581004,
+        0x08591004, 0x085a1004, 0x085b1004, 0x085c1004, 0x085d1004, 0x085e1004, 0x085f1004, 0x08601004,
+        0x08611004, 0x08621004, 0x08631004, 0x08641004, 0x08651004, 0x08661004, 0x08671004, 0x08681004,
+        0x1f99100c, 0x1f9a100c, 0x1f9b100c, 0x1f9c100c, 0x1f9d100c, 0x1f9e100c, 0x1f9f100c, 0x1fa0100c,
+        0x1fa1100c, 0x1f99104c, 0x1f98100c, 0x1f99104c, 0x1f99100c, 0x1f99104c, 0x1f9a100c, 0x1f99104c,
+        0x1f9b100c, 0x1f99104c, 0x1f9c100c, 0x1f99104c, 0x1f9d100c, 0x1f99104c, 0x1f9e100c, 0x1f99104c,
+        0x1f9f100c, 0x1f99104c, 0x1fa0100c, 0x1f99104c, 0x1fa1100c, 0x1f9a104c, 0x1f98100c, 0x03281048,
+        0x1f991048, 0x03291008, 0x03281048, 0x1f9a1048, 0x03291008, 0x03281048, 0x1f9b1048, 0x03291008,
+        0x03281048, 0x1f9c1048, 0x03291008, 0x03281048, 0x1f9d1048, 0x03291008, 0x03281048, 0x1f9e1048,
+        0x03291008, 0x03281048, 0x1f9f1048, 0x03291008, 0x03281048, 0x1fa01048, 0x03291008, 0x03281048,
+        0x1fa11048, 0x03291008, 0x03281048, 0x1f991048, 0x1f981048, 0x03291008, 0x03281048, 0x1f991048,
+        0x1f991048, 0x03291008, 0x03281048, 0x1f991048, 0x1f9a1048, 0x03291008, 0x03281048, 0x1f991048,
+        0x1f9b1048, 0x03291008, 0x03281048, 0x1f991048, 0x1f9c1048, 0x03291008, 0x03281048, 0x1f991048,
+        0x1f9d1048, 0x03291008, 0x03281048, 0x1f991048, 0x1f9e1048, 0x03291008, 0x03281048, 0x1f991048,
+        0x1f9f1048, 0x03291008, 0x03281048, 0x1f991048, 0x1fa01048, 0x03291008, 0x03281048, 0x1f991048,
+        0x1fa11048, 0x03291008, 0x03281048, 0x1f9a1048, 0x1f981048, 0x03291008, 0x1f991048, 0x027e1008,
+        0x1f9a1048, 0x027e1008, 0x1f9b1048, 0x027e1008, 0x1f9c1048, 0x027e1008, 0x1f9d1048, 0x027e1008,
+        0x1f9e1048, 0x027e1008, 0x1f9f1048, 0x027e1008, 0x1fa01048, 0x027e1008, 0x1fa11048, 0x027e1008,
+        0x1f991048, 0x1f981048, 0x027e1008, 0x1f991048, 0x1f991048, 0x027e1008, 0x1f991048, 0x1f9a1048,
+        0x027e1008, 0x1f991048, 0x1f9b1048, 0x027e1008, 0x1f991048, 0x1f9c1048, 0x027e1008, 0x1f991048,
+        0x1f9d1048, 0x027e1008, 0x1f991048, 0x1f9e1048, 0x027e1008, 0x1f991048, 0x1f9f1048, 0x027e1008,
+        0x1f991048, 0x1fa01048, 0x027e1008, 0x1f991048, 0x1fa11048, 0x027e1008, 0x1f9a1048, 0x1f981048,
+        0x027e1008, 0x03281048, 0x1fa21048, 0x03291008, 0x03281048, 0x1fbc1048, 0x03291008, 0x03281048,
+        0x1fd61048, 0x03291008, 0x03281048, 0x1feb1048, 0x03291008, 0x03281048, 0x20071048, 0x03291008,
+        0x03281048, 0x20421048, 0x03291008, 0x03281048, 0x20511048, 0x03291008, 0x03281048, 0x20751048,
+        0x03291008, 0x03281048, 0x20901048, 0x03291008, 0x03281048, 0x20ab1048, 0x03291008, 0x03281048,
+        0x20c41048, 0x03291008, 0x03281048, 0x20d61048, 0x03291008, 0x03281048, 0x21091048, 0x03291008,
+        0x03281048, 0x21181048, 0x03291008, 0x03281048, 0x213c1048, 0x03291008, 0x03281048, 0x216b1048,
+        0x03291008, 0x03281048, 0x21801048, 0x03291008, 0x03281048, 0x21931048, 0x03291008, 0x03281048,
+        0x21d21048, 0x03291008, 0x03281048, 0x21f71048, 0x03291008, 0x03281048, 0x22171048, 0x03291008,
+        0x03281048, 0x22471048, 0x03291008, 0x03281048, 0x22591048, 0x03291008, 0x03281048, 0x22641048,
+        0x03291008, 0x03281048, 0x22701048, 0x03291008, 0x03281048, 0x22861048, 0x03291008, 0x1fa21018,
+        0x1fbc1018, 0x1fd61018, 0x1feb1018, 0x20071018, 0x20421018, 0x20511018, 0x20751018, 0x20901018,
+        0x20ab1018, 0x20c41018, 0x20d61018, 0x21091018, 0x21181018, 0x213c1018, 0x216b1018, 0x21801018,
+        0x21931018, 0x21d21018, 0x21f71018, 0x22171018, 0x22471018, 0x22591018, 0x22641018, 0x22701018,
+        0x22861018, 0x1fa2100c, 0x1fbc100c, 0x1fd6100c, 0x1feb100c, 0x2007100c, 0x2042100c, 0x2051100c,
+        0x2075100c, 0x2090100c, 0x20ab100c, 0x20c4100c, 0x20d6100c, 0x2109100c, 0x2118100c, 0x213c100c,
+        0x216b100c, 0x2180100c, 0x2193100c, 0x21d2100c, 0x21f7100c, 0x2217100c, 0x2247100c, 0x2259100c,
+        0x2264100c, 0x2270100c, 0x2286100c, 0x1f98100c, 0x08691004, 0x086a1004, 0x086b1004, 0x086c1004,
+        0x086d1004, 0x086e1004, 0x086f1004, 0x08701004, 0x08711004, 0x08721004, 0x08731004, 0x08741004,
+        0x08751004, 0x08761004, 0x08771004, 0x08781004, 0x08791004, 0x087a1004, 0x087b1004, 0x087c1004,
+        0x087d1004, 0x087e1004, 0x087f1004, 0x08801004, 0x08811004, 0x08821004, 0x08831004, 0x08841004,
+        0x08851004, 0x08861004, 0x08871004, 0x08881004, 0x08891004, 0x088a1004, 0x088b1004, 0x088c1004,
+        0x088d1004, 0x088e1004, 0x088f1004, 0x08901004, 0x08911004, 0x08921004, 0x08931004, 0x08941004,
+        0x08951004, 0x08961004, 0x08971004, 0x08981004, 0x08991004, 0x089a1004, 0x089b1004, 0x089c1004,
+        0x089d1004, 0x089e1004, 0x089f1004, 0x08a01004, 0x08a11004, 0x08a21004, 0x08a31004, 0x08a41004,
+        0x08a51004, 0x08a61004, 0x08a71004, 0x08a81004, 0x08a91004, 0x08aa1004, 0x08ab1004, 0x08ac1004,
+        0x08ad1004, 0x08ae1004, 0x08af1004, 0x08b01004, 0x08b11004, 0x08b21004, 0x08b31004, 0x08b41004,
+        0x08b51004, 0x08b61004, 0x08b71004, 0x08b81004, 0x08b91004, 0x08ba1004, 0x08bb1004, 0x08bc1004,
+        0x08bd1004, 0x08be1004, 0x08bf1004, 0x08c01004, 0x08c11004, 0x08c21004, 0x08c31004, 0x08c41004,
+        0x08c51004, 0x08c61004, 0x08c71004, 0x08c81004, 0x08c91004, 0x08ca1004, 0x08cb1004, 0x08cc1004,
+        0x08cd1004, 0x08ce1004, 0x08cf1004, 0x08d01004, 0x08d11004, 0x08d21004, 0x08d31004, 0x08d41004,
+        0x08d51004, 0x08d61004, 0x08d71004, 0x08d81004, 0x08d91004, 0x08da1004, 0x08db1004, 0x08dc1004,
+        0x08dd1004, 0x08de1004, 0x08df1004, 0x08e01004, 0x08e11004, 0x08e21004, 0x08e31004, 0x08e41004,
+        0x08e51004, 0x08e61004, 0x08e71004, 0x08e81004, 0x08e91004, 0x08ea1004, 0x08eb1004, 0x08ec1004,
+        0x08ed1004, 0x08ee1004, 0x08ef1004, 0x08f01004, 0x08f11004, 0x08f21004, 0x08f31004, 0x08f41004,
+        0x08f51004, 0x08f61004, 0x08f71004, 0x08f81004, 0x08f91004, 0x08fa1004, 0x08fb1004, 0x08fc1004,
+        0x08fd1004, 0x08fe1004, 0x08ff1004, 0x09001004, 0x09011004, 0x09021004, 0x09031004, 0x09041004,
+        0x09051004, 0x09061004, 0x09071004, 0x09081004, 0x09091004, 0x090a1004, 0x090b1004, 0x090c1004,
+        0x090d1004, 0x090e1004, 0x090f1004, 0x09101004, 0x09111004, 0x09121004, 0x09131004, 0x09141004,
+        0x09151004, 0x09161004, 0x09171004, 0x09181004, 0x09191004, 0x091a1004, 0x091b1004, 0x091c1004,
+        0x091d1004, 0x091e1004, 0x091f1004, 0x09201004, 0x09211004, 0x09221004, 0x09231004, 0x09241004,
+        0x09251004, 0x09261004, 0x09271004, 0x09281004, 0x09291004, 0x092a1004, 0x092b1004, 0x092c1004,
+        0x092d1004, 0x092e1004, 0x092f1004, 0x09301004, 0x09311004, 0x09321004, 0x09331004, 0x09341004,
+        0x09351004, 0x09361004, 0x09371004, 0x09381004, 0x09391004, 0x093a1004, 0x093b1004, 0x093c1004,
+        0x093d1004, 0x093e1004, 0x093f1004, 0x09401004, 0x09411004, 0x09421004, 0x09431004, 0x09441004,
+        0x09451004, 0x09461004, 0x09471004, 0x09481004, 0x09491004, 0x094a1004, 0x094b1004, 0x094c1004,
+        0x094d1004, 0x094e1004, 0x094f1004, 0x09501004, 0x09511004, 0x09521004, 0x09531004, 0x09541004,
+        0x09551004, 0x09561004, 0x09571004, 0x09581004, 0x09591004, 0x095a1004, 0x095b1004, 0x095c1004,
+        0x095d1004, 0x095e1004, 0x095f1004, 0x09601004, 0x09611004, 0x09621004, 0x09631004, 0x09641004,
+        0x09651004, 0x09661004, 0x09671004, 0x09681004, 0x0a331004, 0x0a341004, 0x0a351004, 0x0a361004,
+        0x0a371004, 0x0a381004, 0x0a391004, 0x0a3a1004, 0x0a3b1004, 0x0a3c1004, 0x0a3d1004, 0x0a3e1004,
+        0x0a3f1004, 0x0a401004, 0x0a411004, 0x0a421004, 0x0a431004, 0x0a441004, 0x0a451004, 0x0a461004,
+        0x0a471004, 0x0a481004, 0x0a491004, 0x0a4a1004, 0x0a4b1004, 0x0a4c1004, 0x0a4d1004, 0x0a4e1004,
+        0x0a4f1004, 0x0a501004, 0x0a511004, 0x0a521004, 0x0a531004, 0x0a541004, 0x0a551004, 0x0a561004,
+        0x0a571004, 0x0a581004, 0x0a591004, 0x0a5a1004, 0x0a5b1004, 0x0a5c1004, 0x0a5d1004, 0x0a5e1004,
+        0x0a5f1004, 0x0a601004, 0x0a611004, 0x0a621004, 0x0fee1004, 0x0fef1004, 0x0ff01004, 0x0ff11004,
+        0x0ff21004, 0x0ff31004, 0x0ff41004, 0x0ff51004, 0x0a631004, 0x0a641004, 0x0a651004, 0x0a661004,
+        0x0a671004, 0x0a681004, 0x0a691004, 0x0a6a1004, 0x0a6b1004, 0x0a6c1004, 0x0a6d1004, 0x0a6e1004,
+        0x0a6f1004, 0x0a701004, 0x0a711004, 0x0a721004, 0x0a731004, 0x0a741004, 0x0a751004, 0x0a761004,
+        0x0a771004, 0x0a781004, 0x0a791004, 0x0a7a1004, 0x0a7b1004, 0x0a7c1004, 0x0a7d1004, 0x0a7e1004,
+        0x0a7f1004, 0x0a801004, 0x0a811004, 0x0a821004, 0x0a831004, 0x0a841004, 0x0a851004, 0x0a861004,
+        0x0a871004, 0x0a881004, 0x0a891004, 0x0a8a1004, 0x0a8b1004, 0x0a8c1004, 0x0a8d1004, 0x0a8e1004,
+        0x0a8f1004, 0x0a901004, 0x0a911004, 0x0a921004, 0x0a931004, 0x0a941004, 0x0a951004, 0x0a961004,
+        0x0a971004, 0x12411004, 0x12421004, 0x12431004, 0x0a981004, 0x0a991004, 0x0a9a1004, 0x0a9b1004,
+        0x0a9c1004, 0x0a9d1004, 0x0a9e1004, 0x0a9f1004, 0x0aa01004, 0x0aa11004, 0x0aa21004, 0x0aa31004,
+        0x0aa41004, 0x0aa51004, 0x0aa61004, 0x0aa71004, 0x0aa81004, 0x0aa91004, 0x0aaa1004, 0x0aab1004,
+        0x0aac1004, 0x0aad1004, 0x0aae1004, 0x0aaf1004, 0x0ab01004, 0x0ab11004, 0x0fe81004, 0x0fe91004,
+        0x0fea1004, 0x0feb1004, 0x0fec1004, 0x0fed1004, 0x0ab21004, 0x0ab31004, 0x0ab41004, 0x0ab51004,
+        0x0ab61004, 0x0ab71004, 0x0ab81004, 0x0ab91004, 0x0aba1004, 0x0abb1004, 0x0abc1004, 0x0abd1004,
+        0x0abe1004, 0x0abf1004, 0x0ac01004, 0x0ac11004, 0x0ac21004, 0x0ac31004, 0x0ac41004, 0x0ac51004,
+        0x0ac61004, 0x0ac71004, 0x0ac81004, 0x0ac91004, 0x0aca1004, 0x0acb1004, 0x0acc1004, 0x0acd1004,
+        0x0ace1004, 0x0acf1004, 0x0ad01004, 0x0ad11004, 0x0ad21004, 0x0ad31004, 0x0ad41004, 0x0ad51004,
+        0x0ad61004, 0x0ad71004, 0x0ad81004, 0x0ad91004, 0x0ada1004, 0x0adb1004, 0x0adc1004, 0x0add1004,
+        0x0ade1004, 0x0adf1004, 0x0ae01004, 0x0ae11004, 0x0ae21004, 0x0ae31004, 0x0ae41004, 0x0ae51004,
+        0x0ae61004, 0x0ae71004, 0x0ae81004, 0x0ae91004, 0x0aea1004, 0x0aeb1004, 0x0aec1004, 0x0aed1004,
+        0x0aee1004, 0x0aef1004, 0x0af01004, 0x0af11004, 0x0af21004, 0x0af31004, 0x0af41004, 0x0af51004,
+        0x0af61004, 0x0af71004, 0x0af81004, 0x0af91004, 0x0afa1004, 0x0afb1004, 0x0afc1004, 0x0afd1004,
+        0x0afe1004, 0x0aff1004, 0x0b001004, 0x0b011004, 0x0b021004, 0x0b031004, 0x0b041004, 0x0b051004,
+        0x0b061004, 0x0b071004, 0x0b081004, 0x0b091004, 0x0b0a1004, 0x0b0b1004, 0x0b0c1004, 0x0b0d1004,
+        0x0b0e1004, 0x0b0f1004, 0x0b101004, 0x0b111004, 0x0b121004, 0x0b131004, 0x0b141004, 0x0b151004,
+        0x0b161004, 0x0b171004, 0x0b181004, 0x0b191004, 0x0b1a1004, 0x0b1b1004, 0x0b1c1004, 0x0b1d1004,
+        0x0b1e1004, 0x0b1f1004, 0x0b201004, 0x0b211004, 0x0b3c1004, 0x0b3d1004, 0x0b3e1004, 0x0b3f1004,
+        0x0b401004, 0x0b411004, 0x0b421004, 0x0b431004, 0x0b441004, 0x0b451004, 0x0b461004, 0x0b471004,
+        0x0b481004, 0x0b491004, 0x0b4a1004, 0x0b4b1004, 0x0b4c1004, 0x0b4d1004, 0x0b4e1004, 0x0b4f1004,
+        0x0b501004, 0x0b511004, 0x0b521004, 0x0b531004, 0x0b541004, 0x0b551004, 0x0b561004, 0x0b571004,
+        0x0b581004, 0x0b591004, 0x0b5a1004, 0x0b5b1004, 0x0b5c1004, 0x0b5f1004, 0x0b601004, 0x0b611004,
+        0x0b621004, 0x0b631004, 0x0b641004, 0x0b651004, 0x0b661004, 0x0b671004, 0x0b681004, 0x0b691004,
+        0x0b6a1004, 0x0b6b1004, 0x0b6c1004, 0x0b6d1004, 0x0b6e1004, 0x0b6f1004, 0x0b701004, 0x0b711004,
+        0x0b721004, 0x0b731004, 0x0b741004, 0x0b751004, 0x0b761004, 0x0b771004, 0x0b781004, 0x0b791004,
+        0x0b7a1004, 0x0b7b1004, 0x0b7c1004, 0x0b7d1004, 0x0b7e1004, 0x0b7f1004, 0x0b801004, 0x0b811004,
+        0x0b821004, 0x0b831004, 0x0b841004, 0x0b851004, 0x0b861004, 0x0b871004, 0x0b881004, 0x0b891004,
+        0x0b8a1004, 0x0b8b1004, 0x0b8c1004, 0x0b8d1004, 0x0b8e1004, 0x0b8f1004, 0x0b901004, 0x0b911004,
+        0x0b921004, 0x0b931004, 0x0b941004, 0x0b951004, 0x0b961004, 0x0b971004, 0x0b981004, 0x0b991004,
+        0x0b9a1004, 0x0b9b1004, 0x0b9c1004, 0x0b9d1004, 0x0b9e1004, 0x0b9f1004, 0x0ba01004, 0x0ba11004,
+        0x0ba21004, 0x0ba31004, 0x0ba41004, 0x0ba51004, 0x035e1004, 0x035f1004, 0x03601004, 0x03611004,
+        0x03621004, 0x03631004, 0x03641004, 0x03651004, 0x03661004, 0x03671004, 0x03681004, 0x03691004,
+        0x036a1004, 0x036b1004, 0x0ba61004, 0x0ba71004, 0x0ba81004, 0x0ba91004, 0x0baa1004, 0x0bab1004,
+        0x0bac1004, 0x0bad1004, 0x0bae1004, 0x0baf1004, 0x0bb01004, 0x0bb11004, 0x0bb21004, 0x0bb31004,
+        0x0bb41004, 0x0bb51004, 0x0bb61004, 0x0bb71004, 0x0bb81004, 0x0bb91004, 0x0bba1004, 0x0bbb1004,
+        0x0bbc1004, 0x0bbd1004, 0x0bbe1004, 0x0bbf1004, 0x0bc01004, 0x0bc11004, 0x0bc21004, 0x0bc31004,
+        0x0bc41004, 0x0bc51004, 0x0bc61004, 0x0bc71004, 0x0bc81004, 0x0bc91004, 0x0bca1004, 0x0bcb1004,
+        0x0bcc1004, 0x0bcd1004, 0x0bce1004, 0x0bcf1004, 0x0bd01004, 0x0bd11004, 0x0bd21004, 0x0bd31004,
+        0x0bd41004, 0x0bd51004, 0x0bd61004, 0x03521004, 0x03531004, 0x0bd71004, 0x0bd81004, 0x0bd91004,
+        0x0bda1004, 0x0bdb1004, 0x0bdc1004, 0x0bdd1004, 0x0bde1004, 0x0bdf1004, 0x0be01004, 0x0be11004,
+        0x0be21004, 0x0be31004, 0x0be41004, 0x0be51004, 0x0be61004, 0x0be71004, 0x0be81004, 0x0be91004,
+        0x0bea1004, 0x0beb1004, 0x0bec1004, 0x0bed1004, 0x0bee1004, 0x0bef1004, 0x0bf01004, 0x0bf11004,
+        0x0bf21004, 0x0bf31004, 0x0bf41004, 0x0bf51004, 0x03541004, 0x03551004, 0x03561004, 0x03571004,
+        0x03581004, 0x03591004, 0x035a1004, 0x035b1004, 0x035c1004, 0x035d1004, 0x0bf61004, 0x0bf71004,
+        0x0bf81004, 0x0bf91004, 0x0bfa1004, 0x0bfb1004, 0x0bfc1004, 0x0bfd1004, 0x0bfe1004, 0x0bff1004,
+        0x0c001004, 0x0c011004, 0x0c021004, 0x0c031004, 0x0c041004, 0x0c051004, 0x0ee81004, 0x0ee91004,
+        0x0eea1004, 0x0eeb1004, 0x0eec1004, 0x0eed1004, 0x0eee1004, 0x0eef1004, 0x0ef01004, 0x0ef11004,
+        0x0ef21004, 0x0ef31004, 0x0ef41004, 0x0ef51004, 0x0ef61004, 0x0ef71004, 0x0ef81004, 0x0ef91004,
+        0x0efa1004, 0x0efb1004, 0x0efc1004, 0x0efd1004, 0x0efe1004, 0x0eff1004, 0x0f001004, 0x0f011004,
+        0x0f021004, 0x0f031004, 0x0f041004, 0x0f051004, 0x0f061004, 0x0f071004, 0x0f081004, 0x0f091004,
+        0x0f0a1004, 0x0f0b1004, 0x0f0c1004, 0x0f0d1004, 0x0f0e1004, 0x0f0f1004, 0x0f101004, 0x0f111004,
+        0x0f121004, 0x0f131004, 0x0f141004, 0x0f151004, 0x0f161004, 0x0f171004, 0x0f181004, 0x0f191004,
+        0x0f1a1004, 0x0f1b1004, 0x0f1c1004, 0x0f1d1004, 0x0f1e1004, 0x0f1f1004, 0x0f201004, 0x0f211004,
+        0x0f221004, 0x0f231004, 0x0f241004, 0x0f251004, 0x0f261004, 0x0f271004, 0x0f281004, 0x0f291004,
+        0x0f2a1004, 0x0f2b1004, 0x0f2c1004, 0x0f2d1004, 0x0f2e1004, 0x0f2f1004, 0x0f301004, 0x0f311004,
+        0x0f321004, 0x0f331004, 0x0f341004, 0x0f351004, 0x0f361004, 0x0f371004, 0x0f381004, 0x0f391004,
+        0x0f3a1004, 0x0f3b1004, 0x0f3c1004, 0x0f3d1004, 0x0f3e1004, 0x0f3f1004, 0x0f401004, 0x0f411004,
+        0x0f421004, 0x0f431004, 0x0f441004, 0x0f451004, 0x0f461004, 0x0f471004, 0x0f481004, 0x0f491004,
+        0x0f4a1004, 0x0f4b1004, 0x0f4c1004, 0x0f4d1004, 0x0f4e1004, 0x0f4f1004, 0x0f501004, 0x0f511004,
+        0x0f521004, 0x0f531004, 0x0f541004, 0x0f551004, 0x0f561004, 0x0f571004, 0x0f581004, 0x0f591004,
+        0x0f5a1004, 0x0f5b1004, 0x0f5c1004, 0x0f5d1004, 0x0f5e1004, 0x0f5f1004, 0x0f601004, 0x0f611004,
+        0x0f621004, 0x0f631004, 0x0f641004, 0x0f651004, 0x0f661004, 0x0f671004, 0x0f681004, 0x0f691004,
+        0x0f6a1004, 0x0f6b1004, 0x0f6c1004, 0x0f6d1004, 0x0f6e1004, 0x0f6f1004, 0x0f701004, 0x0f711004,
+        0x0f721004, 0x0f731004, 0x0f741004, 0x0f751004, 0x0f761004, 0x0f771004, 0x0f781004, 0x0f791004,
+        0x0f7a1004, 0x0f7b1004, 0x0f7c1004, 0x0f7d1004, 0x0f7e1004, 0x0f7f1004, 0x0f801004, 0x0f811004,
+        0x0f821004, 0x0f831004, 0x0f841004, 0x0f851004, 0x0f861004, 0x0f871004, 0x0f881004, 0x0f891004,
+        0x0f8a1004, 0x0f8b1004, 0x0f8c1004, 0x0f8d1004, 0x0f8e1004, 0x0f8f1004, 0x0f901004, 0x0f911004,
+        0x0f921004, 0x0f931004, 0x0f941004, 0x0f951004, 0x0f961004, 0x0f971004, 0x0f981004, 0x0f991004,
+        0x0f9a1004, 0x0f9b1004, 0x0f9c1004, 0x0f9d1004, 0x0f9e1004, 0x0f9f1004, 0x0fa01004, 0x0fa11004,
+        0x0fa21004, 0x0fa31004, 0x0fa41004, 0x0fa51004, 0x0fa61004, 0x0fa71004, 0x0fa81004, 0x0fa91004,
+        0x0faa1004, 0x0fab1004, 0x0fac1004, 0x0fad1004, 0x0fae1004, 0x0faf1004, 0x0fb01004, 0x0fb11004,
+        0x0fb21004, 0x0fb31004, 0x0fb41004, 0x0fb51004, 0x0fb61004, 0x0fb71004, 0x0fb81004, 0x0fb91004,
+        0x0fba1004, 0x0fbb1004, 0x0fbc1004, 0x0fbd1004, 0x0fbe1004, 0x0fbf1004, 0x0fc01004, 0x0fc11004,
+        0x0fc21004, 0x0fc31004, 0x0fc41004, 0x0fc51004, 0x0fc61004, 0x0fc71004, 0x0fc81004, 0x0fc91004,
+        0x0fca1004, 0x0fcb1004, 0x0fcc1004, 0x0fcd1004, 0x0fce1004, 0x0fcf1004, 0x0fd01004, 0x0fd11004,
+        0x0fd21004, 0x0fd31004, 0x0fd41004, 0x0fd51004, 0x0fd61004, 0x0fd71004, 0x0fd81004, 0x0fd91004,
+        0x0fda1004, 0x0fdb1004, 0x0fdc1004, 0x0fdd1004, 0x0fde1004, 0x0fdf1004, 0x0fe01004, 0x0fe11004,
+        0x0fe21004, 0x0fe31004, 0x0fe41004, 0x0fe51004, 0x0fe61004, 0x0fe71004, 0x0c061004, 0x0c071004,
+        0x0c081004, 0x0c091004, 0x0c0a1004, 0x0c0b1004, 0x0c0c1004, 0x0c0d1004, 0x0c0e1004, 0x0c0f1004,
+        0x0c101004, 0x0c111004, 0x0c121004, 0x0c131004, 0x0c141004, 0x0c151004, 0x0c161004, 0x0c171004,
+        0x0c181004, 0x0c191004, 0x0c1a1004, 0x0c1b1004, 0x0c1c1004, 0x0c1d1004, 0x0c1e1004, 0x0c1f1004,
+        0x0c201004, 0x0c211004, 0x0c221004, 0x0c231004, 0x0c241004, 0x0c251004, 0x0c261004, 0x0c271004,
+        0x0c281004, 0x0c291004, 0x0c2a1004, 0x0c2b1004, 0x0c2c1004, 0x0c2d1004, 0x0c2e1004, 0x0c2f1004,
+        0x0c301004, 0x0c311004, 0x0c321004, 0x0c331004, 0x0c341004, 0x0c351004, 0x0c361004, 0x0c371004,
+        0x0c381004, 0x0c391004, 0x0c3a1004, 0x0c3b1004, 0x0c3c1004, 0x0c3d1004, 0x0c3e1004, 0x0c3f1004,
+        0x0c401004, 0x0c411004, 0x0c421004, 0x0c431004, 0x0c441004, 0x0c451004, 0x0c461004, 0x0c471004,
+        0x0c481004, 0x0c491004, 0x0c4a1004, 0x0c4b1004, 0x0c4c1004, 0x0c4d1004, 0x0c4e1004, 0x0c4f1004,
+        0x0c501004, 0x0c511004, 0x0c521004, 0x0c531004, 0x0c541004, 0x0c551004, 0x0c561004, 0x0c571004,
+        0x0c581004, 0x0c591004, 0x0c5a1004, 0x0c5b1004, 0x0c5c1004, 0x0c5d1004, 0x0c5e1004, 0x0c5f1004,
+        0x0c601004, 0x0c611004, 0x0c621004, 0x0c631004, 0x0c641004, 0x0c651004, 0x0c661004, 0x0c671004,
+        0x0c681004, 0x0c691004, 0x0c6a1004, 0x0c6b1004, 0x0c6c1004, 0x0c6d1004, 0x0c6e1004, 0x0c6f1004,
+        0x0c701004, 0x0c711004, 0x0c721004, 0x0c731004, 0x0c741004, 0x0c751004, 0x0c761004, 0x0c771004,
+        0x0c781004, 0x0c791004, 0x0c7a1004, 0x0c7b1004, 0x0c7c1004, 0x0c7d1004, 0x0c7e1004, 0x0c7f1004,
+        0x0c801004, 0x0c811004, 0x0c821004, 0x0c831004, 0x0c841004, 0x0c851004, 0x0c861004, 0x0c871004,
+        0x0c881004, 0x033c1004, 0x033d1004, 0x033e1004, 0x033f1004, 0x03401004, 0x03411004, 0x03421004,
+        0x03431004, 0x03441004, 0x03451004, 0x03461004, 0x03471004, 0x03481004, 0x03491004, 0x034a1004,
+        0x034b1004, 0x034c1004, 0x034d1004, 0x034e1004, 0x034f1004, 0x03501004, 0x03511004, 0x0c891004,
+        0x0c8a1004, 0x0c8b1004, 0x0c8c1004, 0x0c8d1004, 0x0c8e1004, 0x0c8f1004, 0x0c901004, 0x0c911004,
+        0x0c921004, 0x0c931004, 0x0c941004, 0x0c951004, 0x0c961004, 0x0c971004, 0x0c981004, 0x0c991004,
+        0x0c9a1004, 0x0c9b1004, 0x0c9c1004, 0x0c9d1004, 0x0c9e1004, 0x0c9f1004, 0x0ca01004, 0x0ca11004,
+        0x0ca21004, 0x0ca31004, 0x0ca41004, 0x0ca51004, 0x0ca61004, 0x0ca71004, 0x0ca81004, 0x0ca91004,
+        0x0caa1004, 0x0cab1004, 0x0cac1004, 0x0cad1004, 0x0cae1004, 0x0caf1004, 0x0cb01004, 0x0cb11004,
+        0x0cb21004, 0x0cb31004, 0x0cb41004, 0x0cb51004, 0x0cb61004, 0x0cb71004, 0x0cb81004, 0x0cb91004,
+        0x0cba1004, 0x0cbb1004, 0x0cbc1004, 0x0cbd1004, 0x0cbe1004, 0x0cbf1004, 0x0cc01004, 0x0cc11004,
+        0x0cc21004, 0x0cc31004, 0x0cc41004, 0x0cc51004, 0x0cc61004, 0x0cc71004, 0x03961004, 0x03971004,
+        0x03981004, 0x03991004, 0x0cc81004, 0x0cc91004, 0x0cca1004, 0x0ccb1004, 0x0ccc1004, 0x0ccd1004,
+        0x0cce1004, 0x0ccf1004, 0x0cd01004, 0x0cd11004, 0x0cd21004, 0x0cd31004, 0x0cd41004, 0x0cd51004,
+        0x0cd61004, 0x0cd71004, 0x0cd81004, 0x0cd91004, 0x0cda1004, 0x0cdb1004, 0x0cdc1004, 0x0cdd1004,
+        0x0cde1004, 0x0cdf1004, 0x0ce01004, 0x0ce11004, 0x0ce21004, 0x0ce31004, 0x0ce41004, 0x0ce51004,
+        0x0ce61004, 0x0ce71004, 0x033a1004, 0x033b1004, 0x0ce81004, 0x0ce91004, 0x0cea1004, 0x0ceb1004,
+        0x0cec1004, 0x0ced1004, 0x0cee1004, 0x0cef1004, 0x0cf01004, 0x0cf11004, 0x0cf21004, 0x0cf31004,
+        0x0cf41004, 0x0cf51004, 0x068c1048, 0x068c1048, 0x068c1048, 0x068c1008, 0x0cf61004, 0x0cf71004,
+        0x0cf81004, 0x0cf91004, 0x0cfa1004, 0x0cfb1004, 0x0cfc1004, 0x0cfd1004, 0x0cfe1004, 0x0cff1004,
+        0x0d001004, 0x0d011004, 0x0d021004, 0x0d031004, 0x0d041004, 0x0d051004, 0x0d061004, 0x0d071004,
+        0x0d081004, 0x0d091004, 0x0d0a1004, 0x0d0b1004, 0x0d0c1004, 0x0d0d1004, 0x0d0e1004, 0x0d0f1004,
+        0x0d101004, 0x0d111004, 0x0d121004, 0x0d131004, 0x0d141004, 0x0d151004, 0x0d161004, 0x0d171004,
+        0x0d181004, 0x0d191004, 0x0d1a1004, 0x0d1b1004, 0x0d1c1004, 0x0d1d1004, 0x0d1e1004, 0x0d1f1004,
+        0x0d201004, 0x0d211004, 0x0d221004, 0x0d231004, 0x0d241004, 0x0d251004, 0x0d261004, 0x0d271004,
+        0x0d281004, 0x0d291004, 0x0d2a1004, 0x0d2b1004, 0x0d2c1004, 0x0d2d1004, 0x0d2e1004, 0x0d2f1004,
+        0x0d301004, 0x0d311004, 0x0d321004, 0x0d331004, 0x0d341004, 0x0d351004, 0x0d361004, 0x0d371004,
+        0x0d381004, 0x0d391004, 0x0d3a1004, 0x0d3b1004, 0x0d3c1004, 0x0d3d1004, 0x0d3e1004, 0x0d3f1004,
+        0x0d401004, 0x0d411004, 0x0d421004, 0x0d431004, 0x0d441004, 0x0d451004, 0x0d461004, 0x0d471004,
+        0x0d481004, 0x0d491004, 0x0d4a1004, 0x0d4b1004, 0x0d4c1004, 0x0d4d1004, 0x0d4e1004, 0x0d4f1004,
+        0x0d501004, 0x0d511004, 0x0d521004, 0x0d531004, 0x0d541004, 0x0d551004, 0x0d561004, 0x0d571004,
+        0x0d581004, 0x0d591004, 0x0d5a1004, 0x0d5b1004, 0x0d5c1004, 0x02401048, 0x02401048, 0x066b1008,
+        0x066b1048, 0x066b1008, 0x066b1048, 0x066b1048, 0x066b1008, 0x0d5d1004, 0x0d5e1004, 0x0d5f1004,
+        0x0d601004, 0x0d611004, 0x0d621004, 0x0d631004, 0x0d641004, 0x0d651004, 0x0d661004, 0x0d671004,
+        0x0d681004, 0x0d691004, 0x0d6a1004, 0x0d6b1004, 0x0d6c1004, 0x0d6d1004, 0x0d6e1004, 0x0d6f1004,
+        0x0d701004, 0x0d711004, 0x0d721004, 0x0d731004, 0x0d741004, 0x0d751004, 0x0d761004, 0x0d771004,
+        0x0d781004, 0x0d791004, 0x0d7a1004, 0x0d7b1004, 0x0d7c1004, 0x0d7d1004, 0x0d7e1004, 0x0d7f1004,
+        0x0d801004, 0x0d811004, 0x0d821004, 0x0d831004, 0x0d841004, 0x0d851004, 0x0d861004, 0x0d871004,
+        0x0d881004, 0x0d891004, 0x0d8a1004, 0x0d8b1004, 0x0d8c1004, 0x0d8d1004, 0x0d8e1004, 0x0d8f1004,
+        0x0d901004, 0x0d911004, 0x0d921004, 0x0d931004, 0x0d941004, 0x0d951004, 0x0d961004, 0x0d971004,
+        0x0d981004, 0x0d991004, 0x0d9a1004, 0x0d9b1004, 0x0d9c1004, 0x0d9d1004, 0x0d9e1004, 0x0d9f1004,
+        0x0da01004, 0x0da11004, 0x0da21004, 0x0da31004, 0x0da41004, 0x0da51004, 0x0da61004, 0x0da71004,
+        0x0da81004, 0x0da91004, 0x0daa1004, 0x0dab1004, 0x0dac1004, 0x0dad1004, 0x0dae1004, 0x0daf1004,
+        0x0db01004, 0x0db11004, 0x0db21004, 0x0db31004, 0x0db41004, 0x0db51004, 0x0db61004, 0x0db71004,
+        0x0db81004, 0x0db91004, 0x0dba1004, 0x0dbb1004, 0x0dbc1004, 0x0dbd1004, 0x0dbe1004, 0x0dbf1004,
+        0x0dc01004, 0x0dc11004, 0x0dc21044, 0x00001784, 0x0dc21004, 0x0dc31004, 0x0dc41004, 0x0dc51004,
+        0x0dc61004, 0x0dc71004, 0x0dc81004, 0x0dc91004, 0x0dca1004, 0x0dcb1004, 0x0dcc1004, 0x0dcd1004,
+        0x0dce1004, 0x0dcf1004, 0x0dd01004, 0x0dd11004, 0x0dd21004, 0x0dd31004, 0x0dd41004, 0x0dd51004,
+        0x0dd61004, 0x0dd71004, 0x0dd81004, 0x0dd91004, 0x0dda1004, 0x0ddb1004, 0x0ddc1004, 0x0ddd1004,
+        0x0dde1004, 0x0ddf1004, 0x0de01004, 0x0de11004, 0x0de21004, 0x0de31004, 0x0de41004, 0x0de51004,
+        0x0de61004, 0x0de71004, 0x0de81004, 0x0de91004, 0x0dea1004, 0x0deb1004, 0x0dec1004, 0x0ded1004,
+        0x0dee1004, 0x0def1004, 0x0df01004, 0x0df11004, 0x0df21004, 0x0df31004, 0x0df41004, 0x0df51004,
+        0x0df61004, 0x0df71004, 0x0df81004, 0x0df91004, 0x0dfa1004, 0x0dfb1004, 0x0dfc1004, 0x0dfd1004,
+        0x0dfe1004, 0x0dff1004, 0x0e001004, 0x0e011004, 0x0e021004, 0x0e031004, 0x0e041004, 0x0e051004,
+        0x0e061004, 0x0e071004, 0x0e081004, 0x0e091004, 0x0e0a1004, 0x0e0b1004, 0x0e0c1004, 0x0e0d1004,
+        0x0e0e1004, 0x0e0f1004, 0x0e101004, 0x0e111004, 0x0e121004, 0x0e131004, 0x0e141004, 0x0e151004,
+        0x0e161004, 0x0e171004, 0x0e181004, 0x0e191004, 0x0e1a1004, 0x0e1b1004, 0x0e1c1004, 0x0e1d1004,
+        0x0e1e1004, 0x0e1f1004, 0x0e201004, 0x0e211004, 0x0e221004, 0x0e231004, 0x0e241004, 0x0e251004,
+        0x0e261004, 0x0e271004, 0x0e281004, 0x0e291004, 0x0e2a1004, 0x0e2b1004, 0x0e2c1004, 0x0e2d1004,
+        0x0e2e1004, 0x0e2f1004, 0x0e301004, 0x0e311004, 0x0e321004, 0x0e331004, 0x0e341004, 0x0e351004,
+        0x0e361004, 0x0e371004, 0x0e381004, 0x0e391004, 0x0e3a1004, 0x0e3b1004, 0x0e3c1004, 0x0e3d1004,
+        0x0e3e1004, 0x0e3f1004, 0x0e401004, 0x0e411004, 0x0e421004, 0x0e431004, 0x0e441004, 0x0e451004,
+        0x0e461004, 0x0e471004, 0x0e481004, 0x0e491004, 0x0e4a1004, 0x0e4b1004, 0x0e4c1004, 0x0e4d1004,
+        0x0e4e1004, 0x0e4f1004, 0x0e501004, 0x0e511004, 0x0e521004, 0x0e531004, 0x0e541004, 0x0e551004,
+        0x0e561004, 0x0e571004, 0x0e581004, 0x0e591004, 0x0e5a1004, 0x0e5b1004, 0x0e5c1004, 0x0e5d1004,
+        0x0e5e1004, 0x0e5f1004, 0x0e601004, 0x0e611004, 0x0e621004, 0x0e631004, 0x0e641004, 0x0e651004,
+        0x0e661004, 0x0e671004, 0x0e681004, 0x0e691004, 0x0e6a1004, 0x0e6b1004, 0x0e6c1004, 0x0e6d1004,
+        0x0e6e1004, 0x0e6f1004, 0x0e701004, 0x0e711004, 0x0e721004, 0x0e731004, 0x0e741004, 0x0e751004,
+        0x0e761004, 0x0e771004, 0x0e781004, 0x0e791004, 0x0e7a1004, 0x0e7b1004, 0x0e7c1004, 0x0e7d1004,
+        0x0e7e1004, 0x0e7f1004, 0x0e801004, 0x0e811004, 0x0e821004, 0x0e831004, 0x0e841004, 0x0e851004,
+        0x0e861004, 0x0e871004, 0x0e881004, 0x0e891004, 0x0e8a1004, 0x0e8b1004, 0x0e8c1004, 0x0e8d1004,
+        0x0e8e1004, 0x0e8f1004, 0x0e901004, 0x0e911004, 0x0e921004, 0x0e931004, 0x0e941004, 0x0e951004,
+        0x0e961004, 0x0e971004, 0x0e981004, 0x0e991004, 0x0e9a1004, 0x0e9b1004, 0x0e9c1004, 0x0e9d1004,
+        0x0e9e1004, 0x0e9f1004, 0x0ea01004, 0x0ea11004, 0x0ea21004, 0x0ea31004, 0x0ea41004, 0x0ea51004,
+        0x0ea61004, 0x0ea71004, 0x0ea81004, 0x0ea91004, 0x0eaa1004, 0x0eab1004, 0x0eac1004, 0x0ead1004,
+        0x0eae1004, 0x0eaf1004, 0x0eb01004, 0x0eb11004, 0x0eb21004, 0x0eb31004, 0x0eb41004, 0x0eb51004,
+        0x0eb61004, 0x0eb71004, 0x0eb81004, 0x0eb91004, 0x0eba1004, 0x0ebb1004, 0x0ebc1004, 0x0ebd1004,
+        0x0ebe1004, 0x0ebf1004, 0x0ec01004, 0x0ec11004, 0x0ec21004, 0x0ec31004, 0x0ec41004, 0x0ec51004,
+        0x0ec61004, 0x0ec71004, 0x0ec81004, 0x0ec91004, 0x0eca1004, 0x0ecb1004, 0x0ecc1004, 0x0ecd1004,
+        0x0ece1004, 0x0ecf1004, 0x0ed01004, 0x0ed11004, 0x0ed21004, 0x0ed31004, 0x0ed41004, 0x0ed51004,
+        0x0ed61004, 0x0ed71004, 0x0ed81004, 0x0ed91004, 0x0eda1004, 0x0edb1004, 0x0edc1004, 0x0edd1004,
+        0x0ede1004, 0x0edf1004, 0x0ee01004, 0x0ee11004, 0x254a1010, 0x254b1010, 0x254c1010, 0x254d1010,
+        0x254e1010, 0x254f1010, 0x25501010, 0x25511010, 0x25521010, 0x25531010, 0x25541010, 0x25551010,
+        0x25561010, 0x25571010, 0x25581010, 0x25591010, 0x255a1010, 0x255b1010, 0x255c1010, 0x255d1010,
+        0x255e1010, 0x255f1010, 0x25601010, 0x25611010, 0x25621010, 0x25631010, 0x25641010, 0x25651010,
+        0x25661010, 0x25671010, 0x25681010, 0x25691010, 0x256a1010, 0x256b1010, 0x256c1010, 0x256d1010,
+        0x256e1010, 0x256f1010, 0x25701010, 0x25711010, 0x25721010, 0x25731010, 0x25741010, 0x25751010,
+        0x25761010, 0x25771010, 0x25781010, 0x254a1004, 0x254b1004, 0x254c1004, 0x254d1004, 0x254e1004,
+        0x254f1004, 0x25501004, 0x25511004, 0x25521004, 0x25531004, 0x25541004, 0x25551004, 0x25561004,
+        0x25571004, 0x25581004, 0x25591004, 0x255a1004, 0x255b1004, 0x255c1004, 0x255d1004, 0x255e1004,
+        0x255f1004, 0x25601004, 0x25611004, 0x25621004, 0x25631004, 0x25641004, 0x25651004, 0x25661004,
+        0x25671004, 0x25681004, 0x25691004, 0x256a1004, 0x256b1004, 0x256c1004, 0x256d1004, 0x256e1004,
+        0x256f1004, 0x25701004, 0x25711004, 0x25721004, 0x25731004, 0x25741004, 0x25751004, 0x25761004,
+        0x25771004, 0x25781004, 0x20e51010, 0x20e51004, 0x20e61010, 0x21701010, 0x21b71010, 0x1fa71004,
+        0x22001004, 0x20861010, 0x20861004, 0x20ce1010, 0x20ce1004, 0x22a11010, 0x22a11004, 0x1fb11010,
+        0x21101010, 0x1fad1010, 0x1fb71010, 0x22521004, 0x225f1010, 0x225f1004, 0x22531004, 0x20871010,
+        0x20871004, 0x217f1004, 0x20141004, 0x21b21004, 0x215b1004, 0x20191004, 0x20ab102a, 0x2247103a,
+        0x21de1010, 0x229d1010, 0x234b1010, 0x234b1004, 0x234c1010, 0x234c1004, 0x234d1010, 0x234d1004,
+        0x234e1010, 0x234e1004, 0x234f1010, 0x234f1004, 0x23511010, 0x23511004, 0x23521010, 0x23521004,
+        0x23531010, 0x23531004, 0x23541010, 0x23541004, 0x23551010, 0x23551004, 0x23561010, 0x23561004,
+        0x23581010, 0x23581004, 0x23591010, 0x23591004, 0x235a1010, 0x235a1004, 0x235d1010, 0x235d1004,
+        0x235e1010, 0x235e1004, 0x235f1010, 0x235f1004, 0x23601010, 0x23601004, 0x23611010, 0x23611004,
+        0x23621010, 0x23621004, 0x23631010, 0x23631004, 0x23641010, 0x23641004, 0x23651010, 0x23651004,
+        0x23661010, 0x23661004, 0x23671010, 0x23671004, 0x23821010, 0x23821004, 0x23831010, 0x23831004,
+        0x23501010, 0x23501004, 0x23571010, 0x23571004, 0x235b1010, 0x235b1004, 0x235c1010, 0x235c1004,
+        0x23681010, 0x23681004, 0x23691010, 0x23691004, 0x236c1010, 0x236c1004, 0x236d1010, 0x236d1004,
+        0x236e1010, 0x236e1004, 0x23721010, 0x23721004, 0x23741010, 0x23741004, 0x23751010, 0x23751004,
+        0x23761010, 0x23761004, 0x23771010, 0x23771004, 0x23781010, 0x23781004, 0x23791010, 0x23791004,
+        0x237c1010, 0x237c1004, 0x237e1010, 0x237e1004, 0x237f1010, 0x237f1004, 0x23801010, 0x23801004,
+        0x23841010, 0x23841004, 0x23851010, 0x23851004, 0x23861010, 0x23861004, 0x23561048, 0x234b1048,
+        0x23551008, 0x0ee21004, 0x0ee31004, 0x0ee41004, 0x0ee51004, 0x0ee61004, 0x0ee71004, 0x236b1010,
+        0x236b1004, 0x237b1010, 0x237b1004, 0x23711010, 0x23711004, 0x02881004, 0x02751004, 0x02761004,
+        0x03071004, 0x1db71004, 0x02891004, 0x03081004, 0x25a01004, 0x25a21004, 0x25a41004, 0x25a61004,
+        0x25a81004, 0x25aa1004, 0x25ac1004, 0x25b01004, 0x25b21004, 0x25b41004, 0x25b61004, 0x25b81004,
+        0x25ba1004, 0x25be1004, 0x25c01004, 0x25c21004, 0x25c41004, 0x25c61004, 0x25c81004, 0x25cc1004,
+        0x25ce1004, 0x25d01004, 0x25d21004, 0x25d41004, 0x25d61004, 0x25d81004, 0x25da1004, 0x25dc1004,
+        0x25de1004, 0x25e01004, 0x25e21004, 0x25e61004, 0x25e81004, 0x25ae1004, 0x25bc1004, 0x25ca1004,
+        0x25e41004, 0x25ea1004, 0x25ed1004, 0x25f21004, 0x27d91004, 0x27da1004, 0x27db1004, 0x27dc1004,
+        0x27dd1004, 0x27de1004, 0x27df1004, 0x27e01004, 0x27e11004, 0x27e21004, 0x27e31004, 0x27e41004,
+        0x27e61004, 0x27e71004, 0x27e81004, 0x27e91004, 0x27ea1004, 0x27eb1004, 0x27ec1004, 0x27ed1004,
+        0x27ee1004, 0x27ef1004, 0x27f01004, 0x27f11004, 0x27f21004, 0x27f31004, 0x27f41004, 0x27f51004,
+        0x27f61004, 0x27f71004, 0x27f81004, 0x27f91004, 0x27fa1004, 0x27fb1004, 0x27fc1004, 0x27fd1004,
+        0x27ff1004, 0x28001004, 0x28011004, 0x28021004, 0x28031004, 0x28041004, 0x28051004, 0x28061004,
+        0x28071004, 0x28081004, 0x28091004, 0x280a1004, 0x280b1004, 0x280c1004, 0x280d1004, 0x280e1004,
+        0x280f1004, 0x28101004, 0x27e51004, 0x27fe1004, 0x28111004, 0x04531004, 0x28221004, 0x28371004,
+        0x28481004, 0x28511004, 0x28601004, 0x28861004, 0x28971004, 0x28a01004, 0x28b61004, 0x28bf1004,
+        0x28c81004, 0x28f91004, 0x29181004, 0x29271004, 0x29301004, 0x29521004, 0x295b1004, 0x296b1004,
+        0x299b1004, 0x29461004, 0x29471004, 0x29481004, 0x29491004, 0x299f1004, 0x29a01004, 0x29a11004,
+        0x29a21004, 0x29a31004, 0x29a41004, 0x29a51004, 0x29a61004, 0x29a71004, 0x29a81004, 0x29a91004,
+        0x29aa1004, 0x29ab1004, 0x29ac1004, 0x29ad1004, 0x29ae1004, 0x29af1004, 0x29b01004, 0x29b11004,
+        0x29b21004, 0x29b31004, 0x29b41004, 0x29b51004, 0x29b61004, 0x29b71004, 0x29b81004, 0x29b91004,
+        0x29ba1004, 0x29bb1004, 0x29bc1004, 0x29bd1004, 0x29be1004, 0x29bf1004, 0x29c01004, 0x29c11004,
+        0x29c21004, 0x29c31004, 0x29c41004, 0x29c51004, 0x29c61004, 0x29c71004, 0x29c81004, 0x29c91004,
+        0x29ca1004, 0x29cb1004, 0x29cc1004, 0x29cd1004, 0x29ce1004, 0x29cf1004, 0x29d01004, 0x29d11004,
+        0x29d21004, 0x29d31004, 0x29d41004, 0x29d51004, 0x29d61004, 0x23931008, 0x239b1008, 0x23c71008,
+        0x23d11008, 0x23fb1008, 0x24151008, 0x24281008, 0x24311008, 0x24541008, 0x24611008, 0x24971008,
+        0x24be1008, 0x24c91008, 0x24e81008, 0x24ed1008, 0x25381008, 0x246a1048, 0x24731008, 0x23871008,
+        0x23bf1008, 0x23fa1008, 0x250e1008, 0x25131008, 0x251d1008, 0x25221008, 0x252c1008, 0x03cb1004,
+        0x03cc1004, 0x036c1004, 0x036d1004, 0x036e1004, 0x036f1004, 0x03cd1004, 0x03ce1004, 0x03cf1004,
+        0x03701004, 0x03711004, 0x03d01004, 0x03721004, 0x03731004, 0x03d11004, 0x03d21004, 0x03d31004,
+        0x03d41004, 0x03d51004, 0x03d61004, 0x03d71004, 0x03d81004, 0x03d91004, 0x021c1004, 0x027d1004,
+        0x03091004, 0x03da1004, 0x03db1004, 0x03741004, 0x03751004, 0x03dc1004, 0x03dd1004, 0x03761004,
+        0x03771004, 0x03781004, 0x03791004, 0x037a1004, 0x037b1004, 0x037c1004, 0x037d1004, 0x037e1004,
+        0x037f1004, 0x03021004, 0x03031004, 0x03041004, 0x03051004, 0x026f1004, 0x24f21004, 0x028a1004,
+        0x02941004, 0x02251004, 0x02951004, 0x02241004, 0x023d1004, 0x03b51004, 0x03b61004, 0x03b71004,
+        0x039b1004, 0x02181004, 0x02191004, 0x028b1004, 0x03061004, 0x03951004, 0x039f1004, 0x021d1004,
+        0x02261004, 0x03221004, 0x021b1004, 0x03de1004, 0x03df1004, 0x03e01004, 0x03e11004, 0x03e21004,
+        0x023f1004, 0x03a81004, 0x03b81004, 0x02271004, 0x039e1004, 0x02281004, 0x02291004, 0x0b5d1004,
+        0x0b5e1004, 0x03ab1004, 0xfb401048, 0xce360040, 0x00008c08, 0xfb401048, 0xd3820040, 0x00008c08,
+        0xfb401048, 0xce5b0000, 0xfb401048, 0xce5a0000, 0xfb401048, 0xce590040, 0x00008c08, 0xfb401048,
+        0xcebb0000, 0xfb401048, 0xd1820040, 0x00008c08, 0xfb401048, 0xd1e00040, 0x00008c08, 0xfb401048,
+        0xd2000040, 0x00008c08, 0xfb401048, 0xd2020000, 0xfb401048, 0xd35c0040, 0x00008c08, 0xfb401048,
+        0xd3690040, 0x00008c08, 0xfb401048, 0xdc0f0040, 0x00008c08, 0xfb401048, 0xdc0f0040, 0x00008c88,
+        0xfb401048, 0xdc220040, 0x00008c08, 0xfb401048, 0xdc230000, 0xfb401048, 0xdc220000, 0xfb401048,
+        0xdc230040, 0x00008c08, 0xfb401048, 0xddf30000, 0xfb401048, 0xde7a0000, 0xfb401048, 0xdf510000,
+        0xfb401048, 0xdf500040, 0x00008c08, 0xfb401048, 0xdfc40000, 0xfb401048, 0xdfc30040, 0x00008c08,
+        0xfb401048, 0xe24c0000, 0xfb401048, 0xe5350000, 0xfb401048, 0xe5e10000, 0xfb401048, 0xe5e50040,
+        0x00008c08, 0xfb401048, 0xe7080040, 0x00008c08, 0xfb401048, 0xeb7a0040, 0x00008c08, 0xfb401048,
+        0xebcd0000, 0xfb401048, 0xec110000, 0xfb401048, 0xec350000, 0xfb401048, 0xec3a0000, 0xfb401048,
+        0xf06c0000, 0xfb401048, 0xf22b0000, 0xfb401048, 0xf22b0040, 0x00008c08, 0xfb401048, 0xce2c0000,
+        0xfb401048, 0xf25b0040, 0x00008c08, 0xfb401048, 0xf2ad0000, 0xfb401048, 0xf38b0040, 0x00008c08,
+        0xfb401048, 0xf58b0040, 0x00008c08, 0xfb401048, 0xf6ee0040, 0x00008c08, 0xfb401048, 0xf93a0040,
+        0x00008c08, 0xfb401048, 0xf93b0000, 0xfb401048, 0xfaf90040, 0x00008c08, 0xfb401048, 0xfcf90000,
+        0xfb401048, 0xfe9f0000, 0xfb401048, 0xff530000, 0xfb401048, 0xff520000, 0xfb401048, 0xff530040,
+        0x00008c08, 0xfb401048, 0xff530040, 0x00008c88, 0xfb401048, 0xff520040, 0x00008c08, 0xfb401048,
+        0xff8a0040, 0x00008c08, 0xfb401048, 0xff8a0040, 0x00008c88, 0xfb401048, 0xff8b0000, 0xfb411048,
+        0x80020000, 0xfb411048, 0x80800000, 0xfb411048, 0x807f0040, 0x00008c08, 0xfb411048, 0x80890040,
+        0x00008c08, 0xfb411048, 0x81fc0040, 0x00008c08, 0xfb411048, 0x82790000, 0xfb411048, 0x82790040,
+        0x00008c08, 0xfb411048, 0x82790040, 0x00008c88, 0xfb411048, 0x864e0000, 0xfb411048, 0x88640000,
+        0xfb411048, 0x89800000, 0xfb411048, 0x897f0000, 0xfb411048, 0x89c10000, 0xfb411048, 0x89d20000,
+        0xfb411048, 0x89d20040, 0x00008c08, 0xfb411048, 0x8ba00000, 0xfb411048, 0x8d1d0000, 0xfb411048,
+        0x8db30040, 0x00008c08, 0xfb411048, 0x8f660000, 0xfb411048, 0x8fb60000, 0xfb411048, 0x8fb60040,
+        0x00008c08, 0xfb411048, 0x8fb60040, 0x00008c88, 0xfb411048, 0x90910040, 0x00008c08, 0xfb411048,
+        0x94850000, 0xfb411048, 0x95770000, 0xfb411048, 0x95780000, 0xfb411048, 0x957f0000, 0xfb411048,
+        0x95e80000, 0xfb411048, 0x961c0040, 0x00008c08, 0xfb411048, 0x961d0000, 0xfb411048, 0x96e80040,
+        0x00008c08, 0xfb411048, 0x97520000, 0xfb411048, 0x97e60000, 0xfb411048, 0x98750000, 0xfb411048,
+        0x98ce0000, 0xfb411048, 0x98de0000, 0xfb411048, 0x98df0000, 0xfb411048, 0x98e00040, 0x00008c08,
+        0xfb411048, 0x98e00000, 0xfb411048, 0x99630000, 0xfb411048, 0x99960040, 0x00008c08, 0xfb411048,
+        0x9a6c0000, 0xfb411048, 0x9aa80040, 0x00008c08, 0xfb411048, 0x9b3c0040, 0x00008c08, 0xfb411048,
+        0x9c7c0000, 0xfb411048, 0x9e1f0000, 0xfb411048, 0x9e750040, 0x00008c08, 0xfb411048, 0x9ea60000,
+        0xfb411048, 0x9ec40000, 0xfb411048, 0x9efe0000, 0xfb411048, 0x9f4a0040, 0x00008c08, 0xfb411048,
+        0x9f500000, 0xfb411048, 0x9f520040, 0x00008c08, 0xfb411048, 0x9f7f0000, 0xfb411048, 0x9f8d0040,
+        0x00008c08, 0xfb411048, 0x9f990000, 0xfb411048, 0x9f9c0040, 0x00008c08, 0xfb411048, 0x9f9c0040,
+        0x00008c88, 0xfb411048, 0x9f9f0000, 0xfb401048, 0xce000000, 0xfb401048, 0xce280000, 0xfb401048,
+        0xce360000, 0xfb401048, 0xce3f0000, 0xfb401048, 0xce590000, 0xfb401048, 0xce850000, 0xfb401048,
+        0xce8c0000, 0xfb401048, 0xcea00000, 0xfb401048, 0xceba0000, 0xfb401048, 0xd13f0000, 0xfb401048,
+        0xd1650000, 0xfb401048, 0xd16b0000, 0xfb401048, 0xd1820000, 0xfb401048, 0xd1960000, 0xfb401048,
+        0xd1ab0000, 0xfb401048, 0xd1e00000, 0xfb401048, 0xd1f50000, 0xfb401048, 0xd2000000, 0xfb401048,
+        0xd29b0000, 0xfb401048, 0xd2f90000, 0xfb401048, 0xd3150000, 0xfb401048, 0xd31a0000, 0xfb401048,
+        0xd3380000, 0xfb401048, 0xd3410000, 0xfb401048, 0xd35c0000, 0xfb401048, 0xd3690000, 0xfb401048,
+        0xd3820000, 0xfb401048, 0xd3b60000, 0xfb401048, 0xd3c80000, 0xfb401048, 0xd3e30000, 0xfb401048,
+        0xd6d70000, 0xfb401048, 0xd71f0000, 0xfb401048, 0xd8eb0000, 0xfb401048, 0xd9020000, 0xfb401048,
+        0xd90a0000, 0xfb401048, 0xd9150000, 0xfb401048, 0xd9270000, 0xfb401048, 0xd9730000, 0xfb401048,
+        0xdb500000, 0xfb401048, 0xdb800000, 0xfb401048, 0xdbf80000, 0xfb401048, 0xdc0f0000, 0xfb401048,
+        0xdc380000, 0xfb401048, 0xdc6e0000, 0xfb401048, 0xdc710000, 0xfb401048, 0xdddb0000, 0xfb401048,
+        0xdde50000, 0xfb401048, 0xddf10000, 0xfb401048, 0xddfe0000, 0xfb401048, 0xde720000, 0xfb401048,
+        0xde7f0000, 0xfb401048, 0xdef40000, 0xfb401048, 0xdefe0000, 0xfb401048, 0xdf0b0000, 0xfb401048,
+        0xdf130000, 0xfb401048, 0xdf500000, 0xfb401048, 0xdf610000, 0xfb401048, 0xdf730000, 0xfb401048,
+        0xdfc30000, 0xfb401048, 0xe2080000, 0xfb401048, 0xe2360000, 0xfb401048, 0xe24b0000, 0xfb401048,
+        0xe52f0000, 0xfb401048, 0xe5340000, 0xfb401048, 0xe5870000, 0xfb401048, 0xe5970000, 0xfb401048,
+        0xe5a40000, 0xfb401048, 0xe5b90000, 0xfb401048, 0xe5e00000, 0xfb401048, 0xe5e50000, 0xfb401048,
+        0xe6f00000, 0xfb401048, 0xe7080000, 0xfb401048, 0xe7280000, 0xfb401048, 0xeb200000, 0xfb401048,
+        0xeb620000, 0xfb401048, 0xeb790000, 0xfb401048, 0xebb30000, 0xfb401048, 0xebcb0000, 0xfb401048,
+        0xebd40000, 0xfb401048, 0xebdb0000, 0xfb401048, 0xec0f0000, 0xfb401048, 0xec140000, 0xfb401048,
+        0xec340000, 0xfb401048, 0xf06b0000, 0xfb401048, 0xf22a0000, 0xfb401048, 0xf2360000, 0xfb401048,
+        0xf23b0000, 0xfb401048, 0xf23f0000, 0xfb401048, 0xf2470000, 0xfb401048, 0xf2590000, 0xfb401048,
+        0xf25b0000, 0xfb401048, 0xf2ac0000, 0xfb401048, 0xf3840000, 0xfb401048, 0xf3890000, 0xfb401048,
+        0xf4dc0000, 0xfb401048, 0xf4e60000, 0xfb401048, 0xf5180000, 0xfb401048, 0xf51f0000, 0xfb401048,
+        0xf5280000, 0xfb401048, 0xf5300000, 0xfb401048, 0xf58b0000, 0xfb401048, 0xf5920000, 0xfb401048,
+        0xf6760000, 0xfb401048, 0xf67d0000, 0xfb401048, 0xf6ae0000, 0xfb401048, 0xf6bf0000, 0xfb401048,
+        0xf6ee0000, 0xfb401048, 0xf7db0000, 0xfb401048, 0xf7e20000, 0xfb401048, 0xf7f30000, 0xfb401048,
+        0xf93a0000, 0xfb401048, 0xf9b80000, 0xfb401048, 0xf9be0000, 0xfb401048, 0xfa740000, 0xfb401048,
+        0xfacb0000, 0xfb401048, 0xfaf90000, 0xfb401048, 0xfc730000, 0xfb401048, 0xfcf80000, 0xfb401048,
+        0xff360000, 0xfb401048, 0xff510000, 0xfb401048, 0xff8a0000, 0xfb401048, 0xffbd0000, 0xfb411048,
+        0x80010000, 0xfb411048, 0x800c0000, 0xfb411048, 0x80120000, 0xfb411048, 0x80330000, 0xfb411048,
+        0x807f0000, 0xfb411048, 0x80890000, 0xfb411048, 0x81e30000, 0xfb411048, 0x81ea0000, 0xfb411048,
+        0x81f30000, 0xfb411048, 0x81fc0000, 0xfb411048, 0x820c0000, 0xfb411048, 0x821b0000, 0xfb411048,
+        0x821f0000, 0xfb411048, 0x826e0000, 0xfb411048, 0x82720000, 0xfb411048, 0x82780000, 0xfb411048,
+        0x864d0000, 0xfb411048, 0x866b0000, 0xfb411048, 0x88400000, 0xfb411048, 0x884c0000, 0xfb411048,
+        0x88630000, 0xfb411048, 0x897e0000, 0xfb411048, 0x898b0000, 0xfb411048, 0x8a000000, 0xfb411048,
+        0x8c370000, 0xfb411048, 0x8c460000, 0xfb411048, 0x8c550000, 0xfb411048, 0x8c780000, 0xfb411048,
+        0x8c9d0000, 0xfb411048, 0x8d640000, 0xfb411048, 0x8d700000, 0xfb411048, 0x8db30000, 0xfb411048,
+        0x8eab0000, 0xfb411048, 0x8eca0000, 0xfb411048, 0x8f9b0000, 0xfb411048, 0x8fb00000, 0xfb411048,
+        0x8fb50000, 0xfb411048, 0x90910000, 0xfb411048, 0x91490000, 0xfb411048, 0x91c60000, 0xfb411048,
+        0x91cc0000, 0xfb411048, 0x91d10000, 0xfb411048, 0x95800000, 0xfb411048, 0x961c0000, 0xfb411048,
+        0x96b60000, 0xfb411048, 0x96b90000, 0xfb411048, 0x96e80000, 0xfb411048, 0x97510000, 0xfb411048,
+        0x975e0000, 0xfb411048, 0x97620000, 0xfb411048, 0x97690000, 0xfb411048, 0x97cb0000, 0xfb411048,
+        0x97ed0000, 0xfb411048, 0x97f30000, 0xfb411048, 0x98010000, 0xfb411048, 0x98a80000, 0xfb411048,
+        0x98db0000, 0xfb411048, 0x99960000, 0xfb411048, 0x99990000, 0xfb411048, 0x99ac0000, 0xfb411048,
+        0x9aa80000, 0xfb411048, 0x9ad80000, 0xfb411048, 0x9adf0000, 0xfb411048, 0x9b250000, 0xfb411048,
+        0x9b2f0000, 0xfb411048, 0x9b320000, 0xfb411048, 0x9b3c0000, 0xfb411048, 0x9b5a0000, 0xfb411048,
+        0x9ce50000, 0xfb411048, 0x9e750000, 0xfb411048, 0x9e7f0000, 0xfb411048, 0x9ea50000, 0xfb411048,
+        0x9ebb0000, 0xfb411048, 0x9ec30000, 0xfb411048, 0x9ecd0000, 0xfb411048, 0x9ed10000, 0xfb411048,
+        0x9ef90000, 0xfb411048, 0x9efd0000, 0xfb411048, 0x9f0e0000, 0xfb411048, 0x9f130000, 0xfb411048,
+        0x9f200000, 0xfb411048, 0x9f3b0000, 0xfb411048, 0x9f4a0000, 0xfb411048, 0x9f520000, 0xfb411048,
+        0x9f8d0000, 0xfb411048, 0x9f9c0000, 0xfb411048, 0x9fa00000, 0x1d1b1004, 0x1d1c1004, 0x1d1d1004,
+        0x1d1e1004, 0x1d1f1004, 0x1d201004, 0x1d211004, 0x1d221004, 0x1d231004, 0x1d241004, 0x1d251004,
+        0x1d261004, 0x02091006, 0x02361004, 0x02921004, 0x03c11004, 0x1d4b1004, 0x1f571004, 0x42e61048,
+        0x42fc1008, 0x03821004, 0x03831004, 0x03841004, 0x03851004, 0x03861004, 0x03871004, 0x03881004,
+        0x03891004, 0x1d4c1004, 0x1d4d1004, 0x038a1004, 0x038b1004, 0x038c1004, 0x038d1004, 0x038e1004,
+        0x038f1004, 0x03901004, 0x03911004, 0x021e1004, 0x03231004, 0x03241004, 0x03251004, 0x1d4e1004,
+        0x00008084, 0x00008104, 0x00008184, 0x00008204, 0x00008284, 0x00008304, 0x021f1004, 0x1f5c1004,
+        0x1f5c1044, 0x00001b84, 0x1f5d1004, 0x1f5d1044, 0x00001b84, 0x1f5e1004, 0x1d4c1008, 0x1d4f1004,
+        0xfb401048, 0xd3440000, 0xfb401048, 0xd3450000, 0x1f581004, 0x42f91048, 0x42e71008, 0x03c21004,
+        0x1d501004, 0x1d511004, 0x42da101a, 0x42da101c, 0x42db101a, 0x42db101c, 0x42dc101a, 0x42dc101c,
+        0x42de101a, 0x42de101c, 0x42df101a, 0x42df101c, 0x42e0101c, 0x42e0105c, 0x00001b84, 0x42e1101c,
+        0x42e1105c, 0x00001b84, 0x42e2101c, 0x42e2105c, 0x00001b84, 0x42e3101c, 0x42e3105c, 0x00001b84,
+        0x42e4101c, 0x42e4105c, 0x00001b84, 0x42e5101c, 0x42e5105c, 0x00001b84, 0x42e6101c, 0x42e6105c,
+        0x00001b84, 0x42e7101c, 0x42e7105c, 0x00001b84, 0x42e8101c, 0x42e8105c, 0x00001b84, 0x42e9101c,
+        0x42e9105c, 0x00001b84, 0x42ea101c, 0x42ea105c, 0x00001b84, 0x42eb101c, 0x42eb105c, 0x00001b84,
+        0x42ec101a, 0x42ec101c, 0x42ec105c, 0x00001b84, 0x42ed101c, 0x42ed105c, 0x00001b84, 0x42ee101c,
+        0x42ee105c, 0x00001b84, 0x42ef101c, 0x42f0101c, 0x42f1101c, 0x42f2101c, 0x42f3101c, 0x42f4101c,
+        0x42f4105c, 0x00001b84, 0x42f4105c, 0x00001c04, 0x42f5101c, 0x42f5105c, 0x00001b84, 0x42f5105c,
+        0x00001c04, 0x42f6101c, 0x42f6105c, 0x00001b84, 0x42f6105c, 0x00001c04, 0x42f7101c, 0x42f7105c,
+        0x00001b84, 0x42f7105c, 0x00001c04, 0x42f8101c, 0x42f8105c, 0x00001b84, 0x42f8105c, 0x00001c04,
+        0x42f9101c, 0x42fa101c, 0x42fb101c, 0x42fc101c, 0x42fd101c, 0x42fe101a, 0x42fe101c, 0x42ff101a,
+        0x42ff101c, 0x4300101a, 0x4300101c, 0x4301101c, 0x4302101c, 0x4303101c, 0x4304101c, 0x4305101c,
+        0x4306101a, 0x4306101c, 0x4307101c, 0x4308101c, 0x4309101c, 0x430a101c, 0x42dc105c, 0x00001b84,
+        0x42e0101a, 0x42e3101a, 0x00001b84, 0x00001c04, 0x04c31004, 0x04c41004, 0x1f5f1004, 0x1f5f1044,
+        0x00001b84, 0x4300106c, 0x4302102c, 0x02201004, 0x42da101e, 0x42da1022, 0x42db101e, 0x42db1022,
+        0x42dc101e, 0x42dc1022, 0x42de101e, 0x42de1022, 0x42df101e, 0x42df1022, 0x42e01022, 0x42e01062,
+        0x00001b84, 0x42e11022, 0x42e11062, 0x00001b84, 0x42e21022, 0x42e21062, 0x00001b84, 0x42e31022,
+        0x42e31062, 0x00001b84, 0x42e41022, 0x42e41062, 0x00001b84, 0x42e51022, 0x42e51062, 0x00001b84,
+        0x42e61022, 0x42e61062, 0x00001b84, 0x42e71022, 0x42e71062, 0x00001b84, 0x42e81022, 0x42e81062,
+        0x00001b84, 0x42e91022, 0x42e91062, 0x00001b84, 0x42ea1022, 0x42ea1062, 0x00001b84, 0x42eb1022,
+        0x42eb1062, 0x00001b84, 0x42ec101e, 0x42ec1022, 0x42ec1062, 0x00001b84, 0x42ed1022, 0x42ed1062,
+        0x00001b84, 0x42ee1022, 0x42ee1062, 0x00001b84, 0x42ef1022, 0x42f01022, 0x42f11022, 0x42f21022,
+        0x42f31022, 0x42f41022, 0x42f41062, 0x00001b84, 0x42f41062, 0x00001c04, 0x42f51022, 0x42f51062,
+        0x00001b84, 0x42f51062, 0x00001c04, 0x42f61022, 0x42f61062, 0x00001b84, 0x42f61062, 0x00001c04,
+        0x42f71022, 0x42f71062, 0x00001b84, 0x42f71062, 0x00001c04, 0x42f81022, 0x42f81062, 0x00001b84,
+        0x42f81062, 0x00001c04, 0x42f91022, 0x42fa1022, 0x42fb1022, 0x42fc1022, 0x42fd1022, 0x42fe101e,
+        0x42fe1022, 0x42ff101e, 0x42ff1022, 0x4300101e, 0x43001022, 0x43011022, 0x43021022, 0x43031022,
+        0x43041022, 0x43051022, 0x4306101e, 0x43061022, 0x43071022, 0x43081022, 0x43091022, 0x430a1022,
+        0x42dc1062, 0x00001b84, 0x42e0101e, 0x42e3101e, 0x43061062, 0x00001b84, 0x43071062, 0x00001b84,
+        0x43081062, 0x00001b84, 0x43091062, 0x00001b84, 0x02211004, 0x1f601004, 0x1f611004, 0x1f611044,
+        0x00001b84, 0x42e4106c, 0x42ee102c, 0x44291004, 0x442a1004, 0x442b1004, 0x442d1004, 0x442f1004,
+        0x44301004, 0x44311004, 0x44331004, 0x44341004, 0x44351004, 0x44381004, 0x44391004, 0x443a1004,
+        0x443b1004, 0x443f1004, 0x44401004, 0x44411004, 0x44421004, 0x44431004, 0x44441004, 0x44451004,
+        0x44491004, 0x444a1004, 0x444c1004, 0x444d1004, 0x444f1004, 0x44501004, 0x44511004, 0x44521004,
+        0x44531004, 0x44541004, 0x44551004, 0x44571004, 0x445a1004, 0x445b1004, 0x445c1004, 0x445d1004,
+        0x442e1004, 0x44361004, 0x443c1004, 0x445e1004, 0x444c1008, 0x44321004, 0x41751008, 0x41761008,
+        0x42531008, 0x41771008, 0x42551008, 0x42561008, 0x41781008, 0x41791008, 0x417a1008, 0x42591008,
+        0x425a1008, 0x425b1008, 0x425c1008, 0x425d1008, 0x425e1008, 0x418f1008, 0x417b1008, 0x417c1008,
+        0x417d1008, 0x41961008, 0x417e1008, 0x417f1008, 0x41801008, 0x41811008, 0x41821008, 0x41831008,
+        0x41841008, 0x41851008, 0x41861008, 0x41871008, 0x41f31008, 0x41f41008, 0x41f51008, 0x41f61008,
+        0x41f71008, 0x41f81008, 0x41f91008, 0x41fa1008, 0x41fb1008, 0x41fc1008, 0x41fd1008, 0x41fe1008,
+        0x41ff1008, 0x42001008, 0x42011008, 0x42021008, 0x42031008, 0x42041008, 0x42051008, 0x42061008,
+        0x42071008, 0x41f21008, 0x41891008, 0x418a1008, 0x42701008, 0x42711008, 0x42751008, 0x42771008,
+        0x427c1008, 0x42801008, 0x42821008, 0x41911008, 0x42861008, 0x42881008, 0x41921008, 0x41931008,
+        0x41951008, 0x41971008, 0x41981008, 0x419c1008, 0x419e1008, 0x41a01008, 0x41a11008, 0x41a21008,
+        0x41a31008, 0x41a41008, 0x41a71008, 0x41ab1008, 0x41b51008, 0x41bc1008, 0x41c11008, 0x429a1008,
+        0x429b1008, 0x41cc1008, 0x41cd1008, 0x41ce1008, 0x42161008, 0x42171008, 0x421a1008, 0x42231008,
+        0x42241008, 0x42261008, 0x42301008, 0x42331008, 0x1d521004, 0x1d531004, 0xfb401068, 0xce000000,
+        0xfb401068, 0xce8c0000, 0xfb401068, 0xce090000, 0xfb401068, 0xd6db0000, 0xfb401068, 0xce0a0000,
+        0xfb401068, 0xce2d0000, 0xfb401068, 0xce0b0000, 0xfb401068, 0xf5320000, 0xfb401068, 0xce590000,
+        0xfb401068, 0xce190000, 0xfb401068, 0xce010000, 0xfb401068, 0xd9290000, 0xfb401068, 0xd7300000,
+        0xfb401068, 0xceba0000, 0x44291048, 0x00008c88, 0x44431048, 0x00008c88, 0x44391048, 0x00008c88,
+        0x44341048, 0x00008c88, 0x444e1004, 0x444e1048, 0x00008c88, 0x444b1004, 0x444a1048, 0x00008c88,
+        0x445c1048, 0x00008d08, 0x44491048, 0x00008c88, 0x445b1048, 0x00008c88, 0x445c1048, 0x00008c88,
+        0x442c1004, 0x44371004, 0x444f1048, 0x00008c88, 0x44511048, 0x00008c88, 0x44581004, 0x44591004,
+        0x44561004, 0x445b106c, 0x00008cac, 0x442a1032, 0x44301032, 0x44351032, 0x44381032, 0x44461004,
+        0x44471004, 0x44481004, 0x44341032, 0x443d1004, 0x443e1004, 0x445f1004, 0x44601004, 0x1d271004,
+        0x1d281004, 0x1d291004, 0x1d2a1004, 0x1d2b1004, 0x1d2c1004, 0x1d2d1004, 0x1d2e1004, 0x1d2f1004,
+        0x1d301004, 0x1d311004, 0x1d321004, 0x1d331004, 0x1d341004, 0x1d351004, 0x1d361004, 0x1d371004,
+        0x1d381004, 0x1d391004, 0x1d3a1004, 0x1d3b1004, 0x1d3c1004, 0x1d3d1004, 0x1d3e1004, 0x1d3f1004,
+        0x1d401004, 0x1d411004, 0x1d421004, 0x1d431004, 0x1d441004, 0x1d451004, 0x1d461004, 0x1d471004,
+        0x1d481004, 0x1d491004, 0x1d4a1004, 0x42e2101e, 0x42e6101e, 0x42e7101e, 0x42ee101e, 0x42f1101e,
+        0x42f4101e, 0x42f5101e, 0x42f6101e, 0x42f7101e, 0x42f8101e, 0x42fb101e, 0x4301101e, 0x4302101e,
+        0x4303101e, 0x4304101e, 0x4305101e, 0x03281048, 0x41751048, 0x03291008, 0x03281048, 0x41771048,
+        0x03291008, 0x03281048, 0x41781048, 0x03291008, 0x03281048, 0x417a1048, 0x03291008, 0x03281048,
+        0x417b1048, 0x03291008, 0x03281048, 0x417c1048, 0x03291008, 0x03281048, 0x417e1048, 0x03291008,
+        0x03281048, 0x41801048, 0x03291008, 0x03281048, 0x41811048, 0x03291008, 0x03281048, 0x41831048,
+        0x03291008, 0x03281048, 0x41841048, 0x03291008, 0x03281048, 0x41851048, 0x03291008, 0x03281048,
+        0x41861048, 0x03291008, 0x03281048, 0x41871048, 0x03291008, 0x03281048, 0x41751048, 0x41f31048,
+        0x03291008, 0x03281048, 0x41771048, 0x41f31048, 0x03291008, 0x03281048, 0x41781048, 0x41f31048,
+        0x03291008, 0x03281048, 0x417a1048, 0x41f31048, 0x03291008, 0x03281048, 0x417b1048, 0x41f31048,
+        0x03291008, 0x03281048, 0x417c1048, 0x41f31048, 0x03291008, 0x03281048, 0x417e1048, 0x41f31048,
+        0x03291008, 0x03281048, 0x41801048, 0x41f31048, 0x03291008, 0x03281048, 0x41811048, 0x41f31048,
+        0x03291008, 0x03281048, 0x41831048, 0x41f31048, 0x03291008, 0x03281048, 0x41841048, 0x41f31048,
+        0x03291008, 0x03281048, 0x41851048, 0x41f31048, 0x03291008, 0x03281048, 0x41861048, 0x41f31048,
+        0x03291008, 0x03281048, 0x41871048, 0x41f31048, 0x03291008, 0x03281048, 0x41811048, 0x42001048,
+        0x03291008, 0x03281048, 0x41801048, 0x41fb1048, 0x41811048, 0x41f71048, 0x42541048, 0x03291008,
+        0x03281048, 0x41801048, 0x41fb1048, 0x41871048, 0x42001048, 0x03291008, 0x03281048, 0xfb401048,
+        0xce000040, 0x03291008, 0x03281048, 0xfb401048, 0xce8c0040, 0x03291008, 0x03281048, 0xfb401048,
+        0xce090040, 0x03291008, 0x03281048, 0xfb401048, 0xd6db0040, 0x03291008, 0x03281048, 0xfb401048,
+        0xce940040, 0x03291008, 0x03281048, 0xfb401048, 0xd16d0040, 0x03291008, 0x03281048, 0xfb401048,
+        0xce030040, 0x03291008, 0x03281048, 0xfb401048, 0xd16b0040, 0x03291008, 0x03281048, 0xfb401048,
+        0xce5d0040, 0x03291008, 0x03281048, 0xfb401048, 0xd3410040, 0x03291008, 0x03281048, 0xfb401048,
+        0xe7080040, 0x03291008, 0x03281048, 0xfb401048, 0xf06b0040, 0x03291008, 0x03281048, 0xfb401048,
+        0xec340040, 0x03291008, 0x03281048, 0xfb401048, 0xe7280040, 0x03291008, 0x03281048, 0xfb411048,
+        0x91d10040, 0x03291008, 0x03281048, 0xfb401048, 0xd71f0040, 0x03291008, 0x03281048, 0xfb401048,
+        0xe5e50040, 0x03291008, 0x03281048, 0xfb401048, 0xe82a0040, 0x03291008, 0x03281048, 0xfb401048,
+        0xe7090040, 0x03291008, 0x03281048, 0xfb401048, 0xf93e0040, 0x03291008, 0x03281048, 0xfb401048,
+        0xd40d0040, 0x03291008, 0x03281048, 0xfb401048, 0xf2790040, 0x03291008, 0x03281048, 0xfb411048,
+        0x8ca10040, 0x03291008, 0x03281048, 0xfb401048, 0xf95d0040, 0x03291008, 0x03281048, 0xfb401048,
+        0xd2b40040, 0x03291008, 0x03281048, 0xfb401048, 0xcee30040, 0x03291008, 0x03281048, 0xfb401048,
+        0xd47c0040, 0x03291008, 0x03281048, 0xfb401048, 0xdb660040, 0x03291008, 0x03281048, 0xfb401048,
+        0xf6e30040, 0x03291008, 0x03281048, 0xfb401048, 0xcf010040, 0x03291008, 0x03281048, 0xfb411048,
+        0x8cc70040, 0x03291008, 0x03281048, 0xfb401048, 0xd3540040, 0x03291008, 0x03281048, 0xfb401048,
+        0xf96d0040, 0x03291008, 0x03281048, 0xfb401048, 0xcf110040, 0x03291008, 0x03281048, 0xfb411048,
+        0x81ea0040, 0x03291008, 0x03281048, 0xfb411048, 0x81f30040, 0x03291008, 0xfb40104c, 0xd54f0000,
+        0xfb40104c, 0xde7c0000, 0xfb40104c, 0xe5870000, 0xfb40104c, 0xfb8f0000, 0x1f9b104c, 0x1f98100c,
+        0x1f9c104c, 0x1f98100c, 0x1f9d104c, 0x1f98100c, 0x1f9e104c, 0x1f98100c, 0x1f9f104c, 0x1f98100c,
+        0x1fa0104c, 0x1f98100c, 0x216b107a, 0x21f7107a, 0x2007103a, 0x1f9a104c, 0x1f99100c, 0x1f9a104c,
+        0x1f9a100c, 0x1f9a104c, 0x1f9b100c, 0x1f9a104c, 0x1f9c100c, 0x1f9a104c, 0x1f9d100c, 0x1f9a104c,
+        0x1f9e100c, 0x1f9a104c, 0x1f9f100c, 0x1f9a104c, 0x1fa0100c, 0x1f9a104c, 0x1fa1100c, 0x1f9b104c,
+        0x1f99100c, 0x1f9b104c, 0x1f9a100c, 0x1f9b104c, 0x1f9b100c, 0x1f9b104c, 0x1f9c100c, 0x1f9b104c,
+        0x1f9d100c, 0x4175100c, 0x4177100c, 0x4178100c, 0x417a100c, 0x417b100c, 0x417c100c, 0x417e100c,
+        0x4180100c, 0x4181100c, 0x4183100c, 0x4184100c, 0x4185100c, 0x4186100c, 0x4187100c, 0x4175104c,
+        0x41f3100c, 0x4177104c, 0x41f3100c, 0x4178104c, 0x41f3100c, 0x417a104c, 0x41f3100c, 0x417b104c,
+        0x41f3100c, 0x417c104c, 0x41f3100c, 0x417e104c, 0x41f3100c, 0x4180104c, 0x41f3100c, 0x4181104c,
+        0x41f3100c, 0x4183104c, 0x41f3100c, 0x4184104c, 0x41f3100c, 0x4185104c, 0x41f3100c, 0x4186104c,
+        0x41f3100c, 0x4187104c, 0x41f3100c, 0x4183104c, 0x41f3104c, 0x4260104c, 0x4175104c, 0x41fb100c,
+        0x4181104c, 0x4200104c, 0x4180104c, 0x4206100c, 0x4180104c, 0x4200100c, 0x1d541004, 0xfb40104c,
+        0xce000000, 0xfb40104c, 0xce8c0000, 0xfb40104c, 0xce090000, 0xfb40104c, 0xd6db0000, 0xfb40104c,
+        0xce940000, 0xfb40104c, 0xd16d0000, 0xfb40104c, 0xce030000, 0xfb40104c, 0xd16b0000, 0xfb40104c,
+        0xce5d0000, 0xfb40104c, 0xd3410000, 0xfb40104c, 0xe7080000, 0xfb40104c, 0xf06b0000, 0xfb40104c,
+        0xec340000, 0xfb40104c, 0xe7280000, 0xfb41104c, 0x91d10000, 0xfb40104c, 0xd71f0000, 0xfb40104c,
+        0xe5e50000, 0xfb40104c, 0xe82a0000, 0xfb40104c, 0xe7090000, 0xfb40104c, 0xf93e0000, 0xfb40104c,
+        0xd40d0000, 0xfb40104c, 0xf2790000, 0xfb41104c, 0x8ca10000, 0xfb40104c, 0xf95d0000, 0xfb40104c,
+        0xd2b40000, 0xfb40104c, 0xf9d80000, 0xfb40104c, 0xf5370000, 0xfb40104c, 0xd9730000, 0xfb41104c,
+        0x90690000, 0xfb40104c, 0xd12a0000, 0xfb40104c, 0xd3700000, 0xfb40104c, 0xece80000, 0xfb41104c,
+        0x98050000, 0xfb40104c, 0xcf110000, 0xfb40104c, 0xd1990000, 0xfb40104c, 0xeb630000, 0xfb40104c,
+        0xce0a0000, 0xfb40104c, 0xce2d0000, 0xfb40104c, 0xce0b0000, 0xfb40104c, 0xdde60000, 0xfb40104c,
+        0xd3f30000, 0xfb40104c, 0xd33b0000, 0xfb40104c, 0xdb970000, 0xfb40104c, 0xdb660000, 0xfb40104c,
+        0xf6e30000, 0xfb40104c, 0xcf010000, 0xfb41104c, 0x8cc70000, 0xfb40104c, 0xd3540000, 0xfb40104c,
+        0xd91c0000, 0x1f9b104c, 0x1f9e100c, 0x1f9b104c, 0x1f9f100c, 0x1f9b104c, 0x1fa0100c, 0x1f9b104c,
+        0x1fa1100c, 0x1f9c104c, 0x1f99100c, 0x1f9c104c, 0x1f9a100c, 0x1f9c104c, 0x1f9b100c, 0x1f9c104c,
+        0x1f9c100c, 0x1f9c104c, 0x1f9d100c, 0x1f9c104c, 0x1f9e100c, 0x1f9c104c, 0x1f9f100c, 0x1f9c104c,
+        0x1fa0100c, 0x1f9c104c, 0x1fa1100c, 0x1f991048, 0xfb401048, 0xe7080000, 0x1f9a1048, 0xfb401048,
+        0xe7080000, 0x1f9b1048, 0xfb401048, 0xe7080000, 0x1f9c1048, 0xfb401048, 0xe7080000, 0x1f9d1048,
+        0xfb401048, 0xe7080000, 0x1f9e1048, 0xfb401048, 0xe7080000, 0x1f9f1048, 0xfb401048, 0xe7080000,
+        0x1fa01048, 0xfb401048, 0xe7080000, 0x1fa11048, 0xfb401048, 0xe7080000, 0x1f991048, 0x1f981048,
+        0xfb401048, 0xe7080000, 0x1f991048, 0x1f991048, 0xfb401048, 0xe7080000, 0x1f991048, 0x1f9a1048,
+        0xfb401048, 0xe7080000, 0x2075107a, 0x20511038, 0x20071078, 0x21931078, 0x20511038, 0x20071078,
+        0x2247103a, 0x20d6107a, 0x21f7107a, 0x1feb103a, 0x42da1026, 0x42db1026, 0x42dc1026, 0x42de1026,
+        0x42df1026, 0x42e01026, 0x42e11026, 0x42e21026, 0x42e31026, 0x42e41026, 0x42e51026, 0x42e61026,
+        0x42e71026, 0x42e81026, 0x42e91026, 0x42ea1026, 0x42eb1026, 0x42ec1026, 0x42ed1026, 0x42ee1026,
+        0x42ef1026, 0x42f01026, 0x42f11026, 0x42f21026, 0x42f31026, 0x42f41026, 0x42f51026, 0x42f61026,
+        0x42f71026, 0x42f81026, 0x42f91026, 0x42fa1026, 0x42fb1026, 0x42fc1026, 0x42fd1026, 0x42fe1026,
+        0x42ff1026, 0x43001026, 0x43011026, 0x43021026, 0x43031026, 0x43041026, 0x43051026, 0x43061026,
+        0x43071026, 0x43081026, 0x43091026, 0xfb401078, 0xcee40040, 0xfb401078, 0xd48c0000, 0x42da1078,
+        0x42f41078, 0x00001c78, 0x1f601078, 0x42ee1038, 0x42da1078, 0x43031078, 0x42f61078, 0x42da1038,
+        0x42da1078, 0x430a1078, 0x42f71078, 0x00001c78, 0x42da1038, 0x42da1078, 0x1f601078, 0x43031038,
+        0x42db1078, 0x42f01078, 0x430a1078, 0x42e21078, 0x00001bb8, 0x42db1078, 0x430a1078, 0x42eb1038,
+        0x42dc1078, 0x42df1078, 0x430a1038, 0x42de1078, 0x42e71078, 0x42e21078, 0x1f601078, 0x42ee1078,
+        0x00001bb8, 0x42de1078, 0x1f601078, 0x42e01078, 0x1f601038, 0x42df1078, 0x430a1078, 0x42e71038,
+        0x42df1078, 0x1f601078, 0x42fb1038, 0x42e01078, 0x42db1078, 0x43021038, 0x42e01078, 0x43011078,
+        0x42ec1078, 0x42ee1038, 0x42e01078, 0x43051078, 0x43021078, 0x1f601038, 0x42e01078, 0x00001bf8,
+        0x43051078, 0x430a1038, 0x42e01078, 0x00001bf8, 0x430a1078, 0x42f91038, 0x42e11078, 0x00001bf8,
+        0x42e01078, 0x00001bb8, 0x42e11078, 0x00001bf8, 0x42f01078, 0x1f601038, 0x42e11078, 0x42ff1078,
+        0x43021078, 0x1f601038, 0x42e11078, 0x00001bf8, 0x43031078, 0x42ea1078, 0x00001bf8, 0x1f601038,
+        0x42e11078, 0x43051038, 0x42e11078, 0x43051078, 0x42e21078, 0x00001bf8, 0x43011078, 0x42fb1038,
+        0x42e11078, 0x43051078, 0x42fc1078, 0x1f601078, 0x42ee1078, 0x43031038, 0x42e11078, 0x43051078,
+        0x43061078, 0x42ec1078, 0x42ee1038, 0x42e21078, 0x00001bf8, 0x43011078, 0x42fb1038, 0x42e21078,
+        0x00001bf8, 0x43011078, 0x42fb1078, 0x42ee1078, 0x430a1038, 0x42e21078, 0x43031078, 0x42e81078,
+        0x00001bf8, 0x42db1078, 0x43051038, 0x42e21078, 0x43051078, 0x1f601078, 0x42f21038, 0x42e31078,
+        0x1f601078, 0x42e71038, 0x42e41078, 0x43031078, 0x42ef1038, 0x42e41078, 0x1f601078, 0x42f81078,
+        0x00001c38, 0x42e51078, 0x42db1078, 0x42e21078, 0x43031038, 0x42e51078, 0x430a1078, 0x42eb1078,
+        0x1f601078, 0x42fb1038, 0x42e61078, 0x43021078, 0x430a1078, 0x42e21078, 0x00001bb8, 0x42e81078,
+        0x430a1078, 0x42eb1038, 0x42e81078, 0x430a1078, 0x42ee1038, 0x42ea1078, 0x00001bf8, 0x1f601078,
+        0x42e71038, 0x42ed1078, 0x00001bf8, 0x42e61038, 0x42ee1078, 0x00001bf8, 0x43031038, 0x42ee1078,
+        0x430a1038, 0x42ef1078, 0x42f31038, 0x42f31078, 0x42ec1078, 0x42ee1038, 0x42f41078, 0x42db1078,
+        0x42ec1038, 0x42f41078, 0x00001c78, 0x1f601078, 0x42e81078, 0x430a1078, 0x42ee1038, 0x42f41078,
+        0x00001c78, 0x1f601078, 0x42ec1038, 0x42f41078, 0x00001bf8, 0x1f601078, 0x43041078, 0x43031038,
+        0x42f51078, 0x00001c78, 0x42da1078, 0x42e71078, 0x42ee1078, 0x43031038, 0x42f51078, 0x00001c78,
+        0x42e21078, 0x43031038, 0x42f51078, 0x00001c78, 0x42e41038, 0x42f51078, 0x00001bf8, 0x43031038,
+        0x42f61078, 0x42da1078, 0x43011078, 0x42ec1078, 0x42ee1078, 0x00001bb8, 0x42f61078, 0x42db1078,
+        0x1f601078, 0x42ee1038, 0x42f61078, 0x00001bf8, 0x42ec1078, 0x42e61078, 0x42de1078, 0x43031038,
+        0x42f61078, 0x43011078, 0x430a1038, 0x42f71078, 0x42e21078, 0x42ea1078, 0x1f601078, 0x43031038,
+        0x42f71078, 0x00001c78, 0x42e91038, 0x42f71078, 0x00001c78, 0x42f01078, 0x42f51038, 0x42f71078,
+        0x43031078, 0x42ec1038, 0x42f71078, 0x00001c78, 0x430a1078, 0x42e71038, 0x42f71078, 0x00001c78,
+        0x1f601078, 0x42e61078, 0x00001bb8, 0x42f71078, 0x00001bf8, 0x1f601078, 0x42ea1038, 0x42f81078,
+        0x00001c78, 0x42db1078, 0x430a1078, 0x42ee1038, 0x42f81078, 0x00001bf8, 0x43031078, 0x42ee1038,
+        0x42f81078, 0x430a1038, 0x42f81078, 0x00001c78, 0x430a1078, 0x42ee1078, 0x00001bb8, 0x42f81078,
+        0x1f601078, 0x43031038, 0x42f81078, 0x1f601078, 0x430a1038, 0x42f91078, 0x42db1078, 0x42e21078,
+        0x43051038, 0x42f91078, 0x42db1078, 0x43031038, 0x42f91078, 0x42ec1078, 0x42f41038, 0x42f91078,
+        0x43031078, 0x42e21038, 0x42f91078, 0x430a1078, 0x42e61078, 0x43001078, 0x430a1038, 0x42fa1078,
+        0x42e21078, 0x43051078, 0x430a1038, 0x42fa1078, 0x43021038, 0x42fa1078, 0x43021078, 0x42f41078,
+        0x00001bf8, 0x1f601078, 0x43031038, 0x42fc1078, 0x42e01078, 0x00001bb8, 0x42fc1078, 0x42e01078,
+        0x00001bf8, 0x42ee1078, 0x430a1038, 0x42fc1078, 0x1f601078, 0x42ee1078, 0x43031038, 0x42fe1078,
+        0x1f601078, 0x42ee1078, 0x00001bb8, 0x42fe1078, 0x1f601078, 0x43031038, 0x42ff1078, 0x42da1078,
+        0x430a1038, 0x43021078, 0x42ec1078, 0x42ee1078, 0x43031038, 0x43021078, 0x43011038, 0x43031078,
+        0x42f51078, 0x00001c78, 0x1f601038, 0x43031078, 0x1f601078, 0x42f61078, 0x00001bf8, 0x43031038,
+        0x43041078, 0x42fb1038, 0x43041078, 0x430a1078, 0x42ee1078, 0x42e31078, 0x00001bf8, 0x430a1038,
+        0x43061078, 0x42ec1078, 0x42ee1038, 0x1f981048, 0xfb401048, 0xf0b90000, 0x1f991048, 0xfb401048,
+        0xf0b90000, 0x1f9a1048, 0xfb401048, 0xf0b90000, 0x1f9b1048, 0xfb401048, 0xf0b90000, 0x1f9c1048,
+        0xfb401048, 0xf0b90000, 0x1f9d1048, 0xfb401048, 0xf0b90000, 0x1f9e1048, 0xfb401048, 0xf0b90000,
+        0x1f9f1048, 0xfb401048, 0xf0b90000, 0x1fa01048, 0xfb401048, 0xf0b90000, 0x1fa11048, 0xfb401048,
+        0xf0b90000, 0x1f991048, 0x1f981048, 0xfb401048, 0xf0b90000, 0x1f991048, 0x1f991048, 0xfb401048,
+        0xf0b90000, 0x1f991048, 0x1f9a1048, 0xfb401048, 0xf0b90000, 0x1f991048, 0x1f9b1048, 0xfb401048,
+        0xf0b90000, 0x1f991048, 0x1f9c1048, 0xfb401048, 0xf0b90000, 0x1f991048, 0x1f9d1048, 0xfb401048,
+        0xf0b90000, 0x1f991048, 0x1f9e1048, 0xfb401048, 0xf0b90000, 0x1f991048, 0x1f9f1048, 0xfb401048,
+        0xf0b90000, 0x1f991048, 0x1fa01048, 0xfb401048, 0xf0b90000, 0x1f991048, 0x1fa11048, 0xfb401048,
+        0xf0b90000, 0x1f9a1048, 0x1f981048, 0xfb401048, 0xf0b90000, 0x1f9a1048, 0x1f991048, 0xfb401048,
+        0xf0b90000, 0x1f9a1048, 0x1f9a1048, 0xfb401048, 0xf0b90000, 0x1f9a1048, 0x1f9b1048, 0xfb401048,
+        0xf0b90000, 0x1f9a1048, 0x1f9c1048, 0xfb401048, 0xf0b90000, 0x20751078, 0x216b107a, 0x1fa21038,
+        0x1feb1078, 0x1fa21038, 0x1fa2107a, 0x2217103a, 0x1fbc1078, 0x1fa21078, 0x21931038, 0x213c1078,
+        0x2247103a, 0x216b1078, 0x1fd61038, 0x1feb1078, 0x21091038, 0x1feb1078, 0x21091078, 0x1f9a1038,
+        0x1feb1078, 0x21091078, 0x1f9b1038, 0x2090107a, 0x2217103a, 0xfb401078, 0xde730040, 0xfb401078,
+        0xe2100000, 0xfb401078, 0xe62d0040, 0xfb401078, 0xd48c0000, 0xfb401078, 0xd9270040, 0xfb401078,
+        0xeb630000, 0xfb401078, 0xe60e0040, 0xfb401078, 0xecbb0000, 0xfb401078, 0xe82a0040, 0xfb401078,
+        0xdf0f0040, 0xfb401078, 0xcf1a0040, 0xfb401078, 0xf93e0000, 0x216b1078, 0x1fa2103a, 0x21181078,
+        0x1fa2103a, 0x23301078, 0x1fa2103a, 0x21091078, 0x1fa2103a, 0x20c41078, 0x1fa2103a, 0x20c4107a,
+        0x1fbc103a, 0x2109107a, 0x1fbc103a, 0x2051107a, 0x1fbc103a, 0x1fd61078, 0x1fa21078, 0x20d61038,
+        0x20c41078, 0x1fd61078, 0x1fa21078, 0x20d61038, 0x216b1078, 0x2042103a, 0x21181078, 0x2042103a,
+        0x23301078, 0x2042103a, 0x23301078, 0x20511038, 0x21091078, 0x20511038, 0x20c41078, 0x20511038,
+        0x2075107a, 0x22861038, 0x20c41078, 0x2075107a, 0x22861038, 0x2109107a, 0x2075107a, 0x22861038,
+        0x2051107a, 0x2075107a, 0x22861038, 0x21f7107a, 0x2075107a, 0x22861038, 0x23301078, 0x20d61038,
+        0x21091078, 0x20d61038, 0x1feb1078, 0x20d61038, 0x20c41078, 0x20d61038, 0x20421078, 0x21091038,
+        0x21181078, 0x21091038, 0x23301078, 0x21091038, 0x21091078, 0x21091038, 0x1fd61078, 0x21091038,
+        0x20c41078, 0x21091038, 0x21091078, 0x21091078, 0x1f9a1038, 0x1fd61078, 0x21091078, 0x1f9a1038,
+        0x21091078, 0x1f9a1038, 0x20c41078, 0x21091078, 0x1f9a1038, 0x21091078, 0x21091078, 0x1f9b1038,
+        0x1fd61078, 0x21091078, 0x1f9b1038, 0x21091078, 0x1f9b1038, 0x20c41078, 0x21091078, 0x1f9b1038,
+        0x21091078, 0x06751078, 0x21d21038, 0x21091078, 0x06751078, 0x21d21078, 0x1f9a1038, 0x216b107a,
+        0x1fa21038, 0x20c41078, 0x216b107a, 0x1fa21038, 0x2109107a, 0x216b107a, 0x1fa21038, 0x2051107a,
+        0x216b107a, 0x1fa21038, 0x21931078, 0x1fa21078, 0x1feb1038, 0x21931078, 0x1fa21078, 0x1feb1078,
+        0x06751078, 0x21d21038, 0x21931078, 0x1fa21078, 0x1feb1078, 0x06751078, 0x21d21078, 0x1f9a1038,
+        0x216b1078, 0x21d21038, 0x21181078, 0x21d21038, 0x23301078, 0x21d21038, 0x21091078, 0x21d21038,
+        0x216b1078, 0x2247103a, 0x21181078, 0x2247103a, 0x23301078, 0x2247103a, 0x21091078, 0x2247103a,
+        0x20c41078, 0x2247103a, 0x2109107a, 0x2247103a, 0x216b1078, 0x2259103a, 0x21181078, 0x2259103a,
+        0x23301078, 0x2259103a, 0x21091078, 0x2259103a, 0x20c41078, 0x2259103a, 0x2109107a, 0x2259103a,
+        0x20c41078, 0x2346103a, 0x2109107a, 0x2346103a, 0x1fa21078, 0x027e1078, 0x21091078, 0x027e1038,
+        0x1fbc107a, 0x21801038, 0x1fd61078, 0x1fd61038, 0x1fd61078, 0x1feb1038, 0x1fd6107a, 0x06751078,
+        0x20c41078, 0x20511038, 0x1fd6107a, 0x213c1078, 0x027e1038, 0x1feb1078, 0x1fbc103a, 0x2051107a,
+        0x22701038, 0x20751078, 0x1fa21038, 0x2075107a, 0x216b103a, 0x20901078, 0x21181038, 0x20c4107a,
+        0x20c4103a, 0x20c4107a, 0x2109103a, 0x20c41078, 0x21f71038, 0x20d61078, 0x21091038, 0x20d61078,
+        0x21181038, 0x20d61078, 0x213c1078, 0x20511038, 0x20d61078, 0x22641038, 0x21091078, 0x1fbc1038,
+        0x21091078, 0x20901078, 0x20d61038, 0x21091078, 0x213c1078, 0x20d61038, 0x216b107a, 0x2075103a,
+        0x216b1078, 0x027e1078, 0x21091078, 0x027e1038, 0x216b107a, 0x216b107a, 0x2109103a, 0x216b107a,
+        0x2193103a, 0x21d21078, 0x21931038, 0x21d2107a, 0x22471038, 0x2259107a, 0x1fbc1038, 0x2247107a,
+        0x06751078, 0x21091038, 0x1fa2107a, 0x06751078, 0x21091038, 0x1f991048, 0xfb401048, 0xe5e50000,
+        0x1f9a1048, 0xfb401048, 0xe5e50000, 0x1f9b1048, 0xfb401048, 0xe5e50000, 0x1f9c1048, 0xfb401048,
+        0xe5e50000, 0x1f9d1048, 0xfb401048, 0xe5e50000, 0x1f9e1048, 0xfb401048, 0xe5e50000, 0x1f9f1048,
+        0xfb401048, 0xe5e50000, 0x1fa01048, 0xfb401048, 0xe5e50000, 0x1fa11048, 0xfb401048, 0xe5e50000,
+        0x1f991048, 0x1f981048, 0xfb401048, 0xe5e50000, 0x1f991048, 0x1f991048, 0xfb401048, 0xe5e50000,
+        0x1f991048, 0x1f9a1048, 0xfb401048, 0xe5e50000, 0x1f991048, 0x1f9b1048, 0xfb401048, 0xe5e50000,
+        0x1f991048, 0x1f9c1048, 0xfb401048, 0xe5e50000, 0x1f991048, 0x1f9d1048, 0xfb401048, 0xe5e50000,
+        0x1f991048, 0x1f9e1048, 0xfb401048, 0xe5e50000, 0x1f991048, 0x1f9f1048, 0xfb401048, 0xe5e50000,
+        0x1f991048, 0x1fa01048, 0xfb401048, 0xe5e50000, 0x1f991048, 0x1fa11048, 0xfb401048, 0xe5e50000,
+        0x1f9a1048, 0x1f981048, 0xfb401048, 0xe5e50000, 0x1f9a1048, 0x1f991048, 0xfb401048, 0xe5e50000,
+        0x1f9a1048, 0x1f9a1048, 0xfb401048, 0xe5e50000, 0x1f9a1048, 0x1f9b1048, 0xfb401048, 0xe5e50000,
+        0x1f9a1048, 0x1f9c1048, 0xfb401048, 0xe5e50000, 0x1f9a1048, 0x1f9d1048, 0xfb401048, 0xe5e50000,
+        0x1f9a1048, 0x1f9e1048, 0xfb401048, 0xe5e50000, 0x1f9a1048, 0x1f9f1048, 0xfb401048, 0xe5e50000,
+        0x1f9a1048, 0x1fa01048, 0xfb401048, 0xe5e50000, 0x1f9a1048, 0x1fa11048, 0xfb401048, 0xe5e50000,
+        0x1f9b1048, 0x1f981048, 0xfb401048, 0xe5e50000, 0x1f9b1048, 0x1f991048, 0xfb401048, 0xe5e50000,
+        0x20511078, 0x1fa21078, 0x20d61038, 0x0ff61004, 0x0ff71004, 0x0ff81004, 0x0ff91004, 0x0ffa1004,
+        0x0ffb1004, 0x0ffc1004, 0x0ffd1004, 0x0ffe1004, 0x0fff1004, 0x10001004, 0x10011004, 0x10021004,
+        0x10031004, 0x10041004, 0x10051004, 0x10061004, 0x10071004, 0x10081004, 0x10091004, 0x100a1004,
+        0x100b1004, 0x100c1004, 0x100d1004, 0x100e1004, 0x100f1004, 0x10101004, 0x10111004, 0x10121004,
+        0x10131004, 0x10141004, 0x10151004, 0x10161004, 0x10171004, 0x10181004, 0x10191004, 0x101a1004,
+        0x101b1004, 0x101c1004, 0x101d1004, 0x101e1004, 0x101f1004, 0x10201004, 0x10211004, 0x10221004,
+        0x10231004, 0x10241004, 0x10251004, 0x10261004, 0x10271004, 0x10281004, 0x10291004, 0x102a1004,
+        0x102b1004, 0x102c1004, 0x102d1004, 0x102e1004, 0x102f1004, 0x10301004, 0x10311004, 0x10321004,
+        0x10331004, 0x10341004, 0x10351004, 0x44611004, 0x44621004, 0x44631004, 0x44641004, 0x44651004,
+        0x44661004, 0x44671004, 0x44681004, 0x44691004, 0x446a1004, 0x446b1004, 0x446c1004, 0x446d1004,
+        0x446e1004, 0x446f1004, 0x44701004, 0x44711004, 0x44721004, 0x44731004, 0x44741004, 0x44751004,
+        0x44761004, 0x44771004, 0x44781004, 0x44791004, 0x447a1004, 0x447b1004, 0x447c1004, 0x447d1004,
+        0x447e1004, 0x447f1004, 0x44801004, 0x44811004, 0x44821004, 0x44831004, 0x44841004, 0x44851004,
+        0x44861004, 0x44871004, 0x44881004, 0x44891004, 0x448a1004, 0x448b1004, 0x448c1004, 0x448d1004,
+        0x448e1004, 0x448f1004, 0x44901004, 0x44911004, 0x44921004, 0x44931004, 0x44941004, 0x44951004,
+        0x44961004, 0x44971004, 0x44981004, 0x44991004, 0x449a1004, 0x449b1004, 0x449c1004, 0x449d1004,
+        0x449e1004, 0x449f1004, 0x44a01004, 0x44a11004, 0x44a21004, 0x44a31004, 0x44a41004, 0x44a51004,
+        0x44a61004, 0x44a71004, 0x44a81004, 0x44a91004, 0x44aa1004, 0x44ab1004, 0x44ac1004, 0x44ad1004,
+        0x44ae1004, 0x44af1004, 0x44b01004, 0x44b11004, 0x44b21004, 0x44b31004, 0x44b41004, 0x44b51004,
+        0x44b61004, 0x44b71004, 0x44b81004, 0x44b91004, 0x44ba1004, 0x44bb1004, 0x44bc1004, 0x44bd1004,
+        0x44be1004, 0x44bf1004, 0x44c01004, 0x44c11004, 0x44c21004, 0x44c31004, 0x44c41004, 0x44c51004,
+        0x44c61004, 0x44c71004, 0x44c81004, 0x44c91004, 0x44ca1004, 0x44cb1004, 0x44cc1004, 0x44cd1004,
+        0x44ce1004, 0x44cf1004, 0x44d01004, 0x44d11004, 0x44d21004, 0x44d31004, 0x44d41004, 0x44d51004,
+        0x44d61004, 0x44d71004, 0x44d81004, 0x44d91004, 0x44da1004, 0x44db1004, 0x44dc1004, 0x44dd1004,
+        0x44de1004, 0x44df1004, 0x44e01004, 0x44e11004, 0x44e21004, 0x44e31004, 0x44e41004, 0x44e51004,
+        0x44e61004, 0x44e71004, 0x44e81004, 0x44e91004, 0x44ea1004, 0x44eb1004, 0x44ec1004, 0x44ed1004,
+        0x44ee1004, 0x44ef1004, 0x44f01004, 0x44f11004, 0x44f21004, 0x44f31004, 0x44f41004, 0x44f51004,
+        0x44f61004, 0x44f71004, 0x44f81004, 0x44f91004, 0x44fa1004, 0x44fb1004, 0x44fc1004, 0x44fd1004,
+        0x44fe1004, 0x44ff1004, 0x45001004, 0x45011004, 0x45021004, 0x45031004, 0x45041004, 0x45051004,
+        0x45061004, 0x45071004, 0x45081004, 0x45091004, 0x450a1004, 0x450b1004, 0x450c1004, 0x450d1004,
+        0x450e1004, 0x450f1004, 0x45101004, 0x45111004, 0x45121004, 0x45131004, 0x45141004, 0x45151004,
+        0x45161004, 0x45171004, 0x45181004, 0x45191004, 0x451a1004, 0x451b1004, 0x451c1004, 0x451d1004,
+        0x451e1004, 0x451f1004, 0x45201004, 0x45211004, 0x45221004, 0x45231004, 0x45241004, 0x45251004,
+        0x45261004, 0x45271004, 0x45281004, 0x45291004, 0x452a1004, 0x452b1004, 0x452c1004, 0x452d1004,
+        0x452e1004, 0x452f1004, 0x45301004, 0x45311004, 0x45321004, 0x45331004, 0x45341004, 0x45351004,
+        0x45361004, 0x45371004, 0x45381004, 0x45391004, 0x453a1004, 0x453b1004, 0x453c1004, 0x453d1004,
+        0x453e1004, 0x453f1004, 0x45401004, 0x45411004, 0x45421004, 0x45431004, 0x45441004, 0x45451004,
+        0x45461004, 0x45471004, 0x45481004, 0x45491004, 0x454a1004, 0x454b1004, 0x454c1004, 0x454d1004,
+        0x454e1004, 0x454f1004, 0x45501004, 0x45511004, 0x45521004, 0x45531004, 0x45541004, 0x45551004,
+        0x45561004, 0x45571004, 0x45581004, 0x45591004, 0x455a1004, 0x455b1004, 0x455c1004, 0x455d1004,
+        0x455e1004, 0x455f1004, 0x45601004, 0x45611004, 0x45621004, 0x45631004, 0x45641004, 0x45651004,
+        0x45661004, 0x45671004, 0x45681004, 0x45691004, 0x456a1004, 0x456b1004, 0x456c1004, 0x456d1004,
+        0x456e1004, 0x456f1004, 0x45701004, 0x45711004, 0x45721004, 0x45731004, 0x45741004, 0x45751004,
+        0x45761004, 0x45771004, 0x45781004, 0x45791004, 0x457a1004, 0x457b1004, 0x457c1004, 0x457d1004,
+        0x457e1004, 0x457f1004, 0x45801004, 0x45811004, 0x45821004, 0x45831004, 0x45841004, 0x45851004,
+        0x45861004, 0x45871004, 0x45881004, 0x45891004, 0x458a1004, 0x458b1004, 0x458c1004, 0x458d1004,
+        0x458e1004, 0x458f1004, 0x45901004, 0x45911004, 0x45921004, 0x45931004, 0x45941004, 0x45951004,
+        0x45961004, 0x45971004, 0x45981004, 0x45991004, 0x459a1004, 0x459b1004, 0x459c1004, 0x459d1004,
+        0x459e1004, 0x459f1004, 0x45a01004, 0x45a11004, 0x45a21004, 0x45a31004, 0x45a41004, 0x45a51004,
+        0x45a61004, 0x45a71004, 0x45a81004, 0x45a91004, 0x45aa1004, 0x45ab1004, 0x45ac1004, 0x45ad1004,
+        0x45ae1004, 0x45af1004, 0x45b01004, 0x45b11004, 0x45b21004, 0x45b31004, 0x45b41004, 0x45b51004,
+        0x45b61004, 0x45b71004, 0x45b81004, 0x45b91004, 0x45ba1004, 0x45bb1004, 0x45bc1004, 0x45bd1004,
+        0x45be1004, 0x45bf1004, 0x45c01004, 0x45c11004, 0x45c21004, 0x45c31004, 0x45c41004, 0x45c51004,
+        0x45c61004, 0x45c71004, 0x45c81004, 0x45c91004, 0x45ca1004, 0x45cb1004, 0x45cc1004, 0x45cd1004,
+        0x45ce1004, 0x45cf1004, 0x45d01004, 0x45d11004, 0x45d21004, 0x45d31004, 0x45d41004, 0x45d51004,
+        0x45d61004, 0x45d71004, 0x45d81004, 0x45d91004, 0x45da1004, 0x45db1004, 0x45dc1004, 0x45dd1004,
+        0x45de1004, 0x45df1004, 0x45e01004, 0x45e11004, 0x45e21004, 0x45e31004, 0x45e41004, 0x45e51004,
+        0x45e61004, 0x45e71004, 0x45e81004, 0x45e91004, 0x45ea1004, 0x45eb1004, 0x45ec1004, 0x45ed1004,
+        0x45ee1004, 0x45ef1004, 0x45f01004, 0x45f11004, 0x45f21004, 0x45f31004, 0x45f41004, 0x45f51004,
+        0x45f61004, 0x45f71004, 0x45f81004, 0x45f91004, 0x45fa1004, 0x45fb1004, 0x45fc1004, 0x45fd1004,
+        0x45fe1004, 0x45ff1004, 0x46001004, 0x46011004, 0x46021004, 0x46031004, 0x46041004, 0x46051004,
+        0x46061004, 0x46071004, 0x46081004, 0x46091004, 0x460a1004, 0x460b1004, 0x460c1004, 0x460d1004,
+        0x460e1004, 0x460f1004, 0x46101004, 0x46111004, 0x46121004, 0x46131004, 0x46141004, 0x46151004,
+        0x46161004, 0x46171004, 0x46181004, 0x46191004, 0x461a1004, 0x461b1004, 0x461c1004, 0x461d1004,
+        0x461e1004, 0x461f1004, 0x46201004, 0x46211004, 0x46221004, 0x46231004, 0x46241004, 0x46251004,
+        0x46261004, 0x46271004, 0x46281004, 0x46291004, 0x462a1004, 0x462b1004, 0x462c1004, 0x462d1004,
+        0x462e1004, 0x462f1004, 0x46301004, 0x46311004, 0x46321004, 0x46331004, 0x46341004, 0x46351004,
+        0x46361004, 0x46371004, 0x46381004, 0x46391004, 0x463a1004, 0x463b1004, 0x463c1004, 0x463d1004,
+        0x463e1004, 0x463f1004, 0x46401004, 0x46411004, 0x46421004, 0x46431004, 0x46441004, 0x46451004,
+        0x46461004, 0x46471004, 0x46481004, 0x46491004, 0x464a1004, 0x464b1004, 0x464c1004, 0x464d1004,
+        0x464e1004, 0x464f1004, 0x46501004, 0x46511004, 0x46521004, 0x46531004, 0x46541004, 0x46551004,
+        0x46561004, 0x46571004, 0x46581004, 0x46591004, 0x465a1004, 0x465b1004, 0x465c1004, 0x465d1004,
+        0x465e1004, 0x465f1004, 0x46601004, 0x46611004, 0x46621004, 0x46631004, 0x46641004, 0x46651004,
+        0x46661004, 0x46671004, 0x46681004, 0x46691004, 0x466a1004, 0x466b1004, 0x466c1004, 0x466d1004,
+        0x466e1004, 0x466f1004, 0x46701004, 0x46711004, 0x46721004, 0x46731004, 0x46741004, 0x46751004,
+        0x46761004, 0x46771004, 0x46781004, 0x46791004, 0x467a1004, 0x467b1004, 0x467c1004, 0x467d1004,
+        0x467e1004, 0x467f1004, 0x46801004, 0x46811004, 0x46821004, 0x46831004, 0x46841004, 0x46851004,
+        0x46861004, 0x46871004, 0x46881004, 0x46891004, 0x468a1004, 0x468b1004, 0x468c1004, 0x468d1004,
+        0x468e1004, 0x468f1004, 0x46901004, 0x46911004, 0x46921004, 0x46931004, 0x46941004, 0x46951004,
+        0x46961004, 0x46971004, 0x46981004, 0x46991004, 0x469a1004, 0x469b1004, 0x469c1004, 0x469d1004,
+        0x469e1004, 0x469f1004, 0x46a01004, 0x46a11004, 0x46a21004, 0x46a31004, 0x46a41004, 0x46a51004,
+        0x46a61004, 0x46a71004, 0x46a81004, 0x46a91004, 0x46aa1004, 0x46ab1004, 0x46ac1004, 0x46ad1004,
+        0x46ae1004, 0x46af1004, 0x46b01004, 0x46b11004, 0x46b21004, 0x46b31004, 0x46b41004, 0x46b51004,
+        0x46b61004, 0x46b71004, 0x46b81004, 0x46b91004, 0x46ba1004, 0x46bb1004, 0x46bc1004, 0x46bd1004,
+        0x46be1004, 0x46bf1004, 0x46c01004, 0x46c11004, 0x46c21004, 0x46c31004, 0x46c41004, 0x46c51004,
+        0x46c61004, 0x46c71004, 0x46c81004, 0x46c91004, 0x46ca1004, 0x46cb1004, 0x46cc1004, 0x46cd1004,
+        0x46ce1004, 0x46cf1004, 0x46d01004, 0x46d11004, 0x46d21004, 0x46d31004, 0x46d41004, 0x46d51004,
+        0x46d61004, 0x46d71004, 0x46d81004, 0x46d91004, 0x46da1004, 0x46db1004, 0x46dc1004, 0x46dd1004,
+        0x46de1004, 0x46df1004, 0x46e01004, 0x46e11004, 0x46e21004, 0x46e31004, 0x46e41004, 0x46e51004,
+        0x46e61004, 0x46e71004, 0x46e81004, 0x46e91004, 0x46ea1004, 0x46eb1004, 0x46ec1004, 0x46ed1004,
+        0x46ee1004, 0x46ef1004, 0x46f01004, 0x46f11004, 0x46f21004, 0x46f31004, 0x46f41004, 0x46f51004,
+        0x46f61004, 0x46f71004, 0x46f81004, 0x46f91004, 0x46fa1004, 0x46fb1004, 0x46fc1004, 0x46fd1004,
+        0x46fe1004, 0x46ff1004, 0x47001004, 0x47011004, 0x47021004, 0x47031004, 0x47041004, 0x47051004,
+        0x47061004, 0x47071004, 0x47081004, 0x47091004, 0x470a1004, 0x470b1004, 0x470c1004, 0x470d1004,
+        0x470e1004, 0x470f1004, 0x47101004, 0x47111004, 0x47121004, 0x47131004, 0x47141004, 0x47151004,
+        0x47161004, 0x47171004, 0x47181004, 0x47191004, 0x471a1004, 0x471b1004, 0x471c1004, 0x471d1004,
+        0x471e1004, 0x471f1004, 0x47201004, 0x47211004, 0x47221004, 0x47231004, 0x47241004, 0x47251004,
+        0x47261004, 0x47271004, 0x47281004, 0x47291004, 0x472a1004, 0x472b1004, 0x472c1004, 0x472d1004,
+        0x472e1004, 0x472f1004, 0x47301004, 0x47311004, 0x47321004, 0x47331004, 0x47341004, 0x47351004,
+        0x47361004, 0x47371004, 0x47381004, 0x47391004, 0x473a1004, 0x473b1004, 0x473c1004, 0x473d1004,
+        0x473e1004, 0x473f1004, 0x47401004, 0x47411004, 0x47421004, 0x47431004, 0x47441004, 0x47451004,
+        0x47461004, 0x47471004, 0x47481004, 0x47491004, 0x474a1004, 0x474b1004, 0x474c1004, 0x474d1004,
+        0x474e1004, 0x474f1004, 0x47501004, 0x47511004, 0x47521004, 0x47531004, 0x47541004, 0x47551004,
+        0x47561004, 0x47571004, 0x47581004, 0x47591004, 0x475a1004, 0x475b1004, 0x475c1004, 0x475d1004,
+        0x475e1004, 0x475f1004, 0x47601004, 0x47611004, 0x47621004, 0x47631004, 0x47641004, 0x47651004,
+        0x47661004, 0x47671004, 0x47681004, 0x47691004, 0x476a1004, 0x476b1004, 0x476c1004, 0x476d1004,
+        0x476e1004, 0x476f1004, 0x47701004, 0x47711004, 0x47721004, 0x47731004, 0x47741004, 0x47751004,
+        0x47761004, 0x47771004, 0x47781004, 0x47791004, 0x477a1004, 0x477b1004, 0x477c1004, 0x477d1004,
+        0x477e1004, 0x477f1004, 0x47801004, 0x47811004, 0x47821004, 0x47831004, 0x47841004, 0x47851004,
+        0x47861004, 0x47871004, 0x47881004, 0x47891004, 0x478a1004, 0x478b1004, 0x478c1004, 0x478d1004,
+        0x478e1004, 0x478f1004, 0x47901004, 0x47911004, 0x47921004, 0x47931004, 0x47941004, 0x47951004,
+        0x47961004, 0x47971004, 0x47981004, 0x47991004, 0x479a1004, 0x479b1004, 0x479c1004, 0x479d1004,
+        0x479e1004, 0x479f1004, 0x47a01004, 0x47a11004, 0x47a21004, 0x47a31004, 0x47a41004, 0x47a51004,
+        0x47a61004, 0x47a71004, 0x47a81004, 0x47a91004, 0x47aa1004, 0x47ab1004, 0x47ac1004, 0x47ad1004,
+        0x47ae1004, 0x47af1004, 0x47b01004, 0x47b11004, 0x47b21004, 0x47b31004, 0x47b41004, 0x47b51004,
+        0x47b61004, 0x47b71004, 0x47b81004, 0x47b91004, 0x47ba1004, 0x47bb1004, 0x47bc1004, 0x47bd1004,
+        0x47be1004, 0x47bf1004, 0x47c01004, 0x47c11004, 0x47c21004, 0x47c31004, 0x47c41004, 0x47c51004,
+        0x47c61004, 0x47c71004, 0x47c81004, 0x47c91004, 0x47ca1004, 0x47cb1004, 0x47cc1004, 0x47cd1004,
+        0x47ce1004, 0x47cf1004, 0x47d01004, 0x47d11004, 0x47d21004, 0x47d31004, 0x47d41004, 0x47d51004,
+        0x47d61004, 0x47d71004, 0x47d81004, 0x47d91004, 0x47da1004, 0x47db1004, 0x47dc1004, 0x47dd1004,
+        0x47de1004, 0x47df1004, 0x47e01004, 0x47e11004, 0x47e21004, 0x47e31004, 0x47e41004, 0x47e51004,
+        0x47e61004, 0x47e71004, 0x47e81004, 0x47e91004, 0x47ea1004, 0x47eb1004, 0x47ec1004, 0x47ed1004,
+        0x47ee1004, 0x47ef1004, 0x47f01004, 0x47f11004, 0x47f21004, 0x47f31004, 0x47f41004, 0x47f51004,
+        0x47f61004, 0x47f71004, 0x47f81004, 0x47f91004, 0x47fa1004, 0x47fb1004, 0x47fc1004, 0x47fd1004,
+        0x47fe1004, 0x47ff1004, 0x48001004, 0x48011004, 0x48021004, 0x48031004, 0x48041004, 0x48051004,
+        0x48061004, 0x48071004, 0x48081004, 0x48091004, 0x480a1004, 0x480b1004, 0x480c1004, 0x480d1004,
+        0x480e1004, 0x480f1004, 0x48101004, 0x48111004, 0x48121004, 0x48131004, 0x48141004, 0x48151004,
+        0x48161004, 0x48171004, 0x48181004, 0x48191004, 0x481a1004, 0x481b1004, 0x481c1004, 0x481d1004,
+        0x481e1004, 0x481f1004, 0x48201004, 0x48211004, 0x48221004, 0x48231004, 0x48241004, 0x48251004,
+        0x48261004, 0x48271004, 0x48281004, 0x48291004, 0x482a1004, 0x482b1004, 0x482c1004, 0x482d1004,
+        0x482e1004, 0x482f1004, 0x48301004, 0x48311004, 0x48321004, 0x48331004, 0x48341004, 0x48351004,
+        0x48361004, 0x48371004, 0x48381004, 0x48391004, 0x483a1004, 0x483b1004, 0x483c1004, 0x483d1004,
+        0x483e1004, 0x483f1004, 0x48401004, 0x48411004, 0x48421004, 0x48431004, 0x48441004, 0x48451004,
+        0x48461004, 0x48471004, 0x48481004, 0x48491004, 0x484a1004, 0x484b1004, 0x484c1004, 0x484d1004,
+        0x484e1004, 0x484f1004, 0x48501004, 0x48511004, 0x48521004, 0x48531004, 0x48541004, 0x48551004,
+        0x48561004, 0x48571004, 0x48581004, 0x48591004, 0x485a1004, 0x485b1004, 0x485c1004, 0x485d1004,
+        0x485e1004, 0x485f1004, 0x48601004, 0x48611004, 0x48621004, 0x48631004, 0x48641004, 0x48651004,
+        0x48661004, 0x48671004, 0x48681004, 0x48691004, 0x486a1004, 0x486b1004, 0x486c1004, 0x486d1004,
+        0x486e1004, 0x486f1004, 0x48701004, 0x48711004, 0x48721004, 0x48731004, 0x48741004, 0x48751004,
+        0x48761004, 0x48771004, 0x48781004, 0x48791004, 0x487a1004, 0x487b1004, 0x487c1004, 0x487d1004,
+        0x487e1004, 0x487f1004, 0x48801004, 0x48811004, 0x48821004, 0x48831004, 0x48841004, 0x48851004,
+        0x48861004, 0x48871004, 0x48881004, 0x48891004, 0x488a1004, 0x488b1004, 0x488c1004, 0x488d1004,
+        0x488e1004, 0x488f1004, 0x48901004, 0x48911004, 0x48921004, 0x48931004, 0x48941004, 0x48951004,
+        0x48961004, 0x48971004, 0x48981004, 0x48991004, 0x489a1004, 0x489b1004, 0x489c1004, 0x489d1004,
+        0x489e1004, 0x489f1004, 0x48a01004, 0x48a11004, 0x48a21004, 0x48a31004, 0x48a41004, 0x48a51004,
+        0x48a61004, 0x48a71004, 0x48a81004, 0x48a91004, 0x48aa1004, 0x48ab1004, 0x48ac1004, 0x48ad1004,
+        0x48ae1004, 0x48af1004, 0x48b01004, 0x48b11004, 0x48b21004, 0x48b31004, 0x48b41004, 0x48b51004,
+        0x48b61004, 0x48b71004, 0x48b81004, 0x48b91004, 0x48ba1004, 0x48bb1004, 0x48bc1004, 0x48bd1004,
+        0x48be1004, 0x48bf1004, 0x48c01004, 0x48c11004, 0x48c21004, 0x48c31004, 0x48c41004, 0x48c51004,
+        0x48c61004, 0x48c71004, 0x48c81004, 0x48c91004, 0x48ca1004, 0x48cb1004, 0x48cc1004, 0x48cd1004,
+        0x48ce1004, 0x48cf1004, 0x48d01004, 0x48d11004, 0x48d21004, 0x48d31004, 0x48d41004, 0x48d51004,
+        0x48d61004, 0x48d71004, 0x48d81004, 0x48d91004, 0x48da1004, 0x48db1004, 0x48dc1004, 0x48dd1004,
+        0x48de1004, 0x48df1004, 0x48e01004, 0x48e11004, 0x48e21004, 0x48e31004, 0x48e41004, 0x48e51004,
+        0x48e61004, 0x48e71004, 0x48e81004, 0x48e91004, 0x48ea1004, 0x48eb1004, 0x48ec1004, 0x48ed1004,
+        0x108d1004, 0x108e1004, 0x108f1004, 0x10901004, 0x10911004, 0x10921004, 0x10931004, 0x10941004,
+        0x10951004, 0x10961004, 0x10971004, 0x10981004, 0x10991004, 0x109a1004, 0x109b1004, 0x109c1004,
+        0x109d1004, 0x109e1004, 0x109f1004, 0x10a01004, 0x10a11004, 0x10a21004, 0x10a31004, 0x10a41004,
+        0x10a51004, 0x10a61004, 0x10a71004, 0x10a81004, 0x10a91004, 0x10aa1004, 0x10ab1004, 0x10ac1004,
+        0x10ad1004, 0x10ae1004, 0x10af1004, 0x10b01004, 0x10b11004, 0x10b21004, 0x10b31004, 0x10b41004,
+        0x10b51004, 0x10b61004, 0x10b71004, 0x10b81004, 0x10b91004, 0x10ba1004, 0x10bb1004, 0x10bc1004,
+        0x10bd1004, 0x10be1004, 0x10bf1004, 0x10c01004, 0x10c11004, 0x10c21004, 0x10c31004, 0x48f41004,
+        0x48f51004, 0x48f61004, 0x48f71004, 0x48f81004, 0x48f91004, 0x48fa1004, 0x48fb1004, 0x48fc1004,
+        0x48fd1004, 0x48fe1004, 0x48ff1004, 0x49001004, 0x49011004, 0x49021004, 0x49031004, 0x49041004,
+        0x49051004, 0x49061004, 0x49071004, 0x49081004, 0x49091004, 0x490a1004, 0x490b1004, 0x490c1004,
+        0x490d1004, 0x49101004, 0x490e1004, 0x49111004, 0x490f1004, 0x49131004, 0x49141004, 0x49151004,
+        0x49161004, 0x49171004, 0x49181004, 0x49191004, 0x491a1004, 0x491b1004, 0x491c1004, 0x48ee1004,
+        0x48ef1004, 0x48f01004, 0x48f11004, 0x48f31004, 0x48f21004, 0x02321004, 0x028c1004, 0x3cb91004,
+        0x3cba1004, 0x3cbb1004, 0x3cbc1004, 0x3cbd1004, 0x3cbe1004, 0x3cbf1004, 0x3cc01004, 0x3cc11004,
+        0x3cc21004, 0x3cc31004, 0x3cc41004, 0x3cc51004, 0x3cc61004, 0x3cc71004, 0x3cc81004, 0x3cc91004,
+        0x3cca1004, 0x3ccb1004, 0x3ccc1004, 0x3ccd1004, 0x3cce1004, 0x3ccf1004, 0x3cd01004, 0x3cd11004,
+        0x3cd21004, 0x3cd31004, 0x3cd41004, 0x3cd51004, 0x3cd61004, 0x3cd71004, 0x3cd81004, 0x3cd91004,
+        0x3cda1004, 0x3cdb1004, 0x3cdc1004, 0x3cdd1004, 0x3cde1004, 0x3cdf1004, 0x3ce01004, 0x3ce11004,
+        0x3ce21004, 0x3ce31004, 0x3ce41004, 0x3ce51004, 0x3ce61004, 0x3ce71004, 0x3ce81004, 0x3ce91004,
+        0x3cea1004, 0x3ceb1004, 0x3cec1004, 0x3ced1004, 0x3cee1004, 0x3cef1004, 0x3cf01004, 0x3cf11004,
+        0x3cf21004, 0x3cf31004, 0x3cf41004, 0x3cf51004, 0x3cf61004, 0x3cf71004, 0x3cf81004, 0x3cf91004,
+        0x3cfa1004, 0x3cfb1004, 0x3cfc1004, 0x3cfd1004, 0x3cfe1004, 0x3cff1004, 0x3d001004, 0x3d011004,
+        0x3d021004, 0x3d031004, 0x3d041004, 0x3d051004, 0x3d061004, 0x3d071004, 0x3d081004, 0x3d091004,
+        0x3d0a1004, 0x3d0b1004, 0x3d0c1004, 0x3d0d1004, 0x3d0e1004, 0x3d0f1004, 0x3d101004, 0x3d111004,
+        0x3d121004, 0x3d131004, 0x3d141004, 0x3d151004, 0x3d161004, 0x3d171004, 0x3d181004, 0x3d191004,
+        0x3d1a1004, 0x3d1b1004, 0x3d1c1004, 0x3d1d1004, 0x3d1e1004, 0x3d1f1004, 0x3d201004, 0x3d211004,
+        0x3d221004, 0x3d231004, 0x3d241004, 0x3d251004, 0x3d261004, 0x3d271004, 0x3d281004, 0x3d291004,
+        0x3d2a1004, 0x3d2b1004, 0x3d2c1004, 0x3d2d1004, 0x3d2e1004, 0x3d2f1004, 0x3d301004, 0x3d311004,
+        0x3d321004, 0x3d331004, 0x3d341004, 0x3d351004, 0x3d361004, 0x3d371004, 0x3d381004, 0x3d391004,
+        0x3d3a1004, 0x3d3b1004, 0x3d3c1004, 0x3d3d1004, 0x3d3e1004, 0x3d3f1004, 0x3d401004, 0x3d411004,
+        0x3d421004, 0x3d431004, 0x3d441004, 0x3d451004, 0x3d461004, 0x3d471004, 0x3d481004, 0x3d491004,
+        0x3d4a1004, 0x3d4b1004, 0x3d4c1004, 0x3d4d1004, 0x3d4e1004, 0x3d4f1004, 0x3d501004, 0x3d511004,
+        0x3d521004, 0x3d531004, 0x3d541004, 0x3d551004, 0x3d561004, 0x3d571004, 0x3d581004, 0x3d591004,
+        0x3d5a1004, 0x3d5b1004, 0x3d5c1004, 0x3d5d1004, 0x3d5e1004, 0x3d5f1004, 0x3d601004, 0x3d611004,
+        0x3d621004, 0x3d631004, 0x3d641004, 0x3d651004, 0x3d661004, 0x3d671004, 0x3d681004, 0x3d691004,
+        0x3d6a1004, 0x3d6b1004, 0x3d6c1004, 0x3d6d1004, 0x3d6e1004, 0x3d6f1004, 0x3d701004, 0x3d711004,
+        0x3d721004, 0x3d731004, 0x3d741004, 0x3d751004, 0x3d761004, 0x3d771004, 0x3d781004, 0x3d791004,
+        0x3d7a1004, 0x3d7b1004, 0x3d7c1004, 0x3d7d1004, 0x3d7e1004, 0x3d7f1004, 0x3d801004, 0x3d811004,
+        0x3d821004, 0x3d831004, 0x3d841004, 0x3d851004, 0x3d861004, 0x3d871004, 0x3d881004, 0x3d891004,
+        0x3d8a1004, 0x3d8b1004, 0x3d8c1004, 0x3d8d1004, 0x3d8e1004, 0x3d8f1004, 0x3d901004, 0x3d911004,
+        0x3d921004, 0x3d931004, 0x3d941004, 0x3d951004, 0x3d961004, 0x3d971004, 0x3d981004, 0x3d991004,
+        0x3d9a1004, 0x3d9b1004, 0x3d9c1004, 0x3d9d1004, 0x3d9e1004, 0x3d9f1004, 0x3da01004, 0x3da11004,
+        0x3da21004, 0x3da31004, 0x3da41004, 0x3da51004, 0x3da61004, 0x3da71004, 0x3da81004, 0x3da91004,
+        0x3daa1004, 0x3dab1004, 0x3dac1004, 0x3dad1004, 0x3dae1004, 0x3daf1004, 0x3db01004, 0x3db11004,
+        0x3db21004, 0x3db31004, 0x3db41004, 0x3db51004, 0x3db61004, 0x3db71004, 0x3db81004, 0x3db91004,
+        0x3dba1004, 0x3dbb1004, 0x3dbc1004, 0x3dbd1004, 0x3dbe1004, 0x3dbf1004, 0x3dc01004, 0x3dc11004,
+        0x3dc21004, 0x3dc31004, 0x3dc41004, 0x3dc51004, 0x02331004, 0x028d1004, 0x02771004, 0x3d111008,
+        0x3d231008, 0x3d401008, 0x3cc51048, 0x3dc41008, 0x3cd71048, 0x3dc41008, 0x3cec1048, 0x3dc41008,
+        0x3d001048, 0x3dc51008, 0x3d0b1048, 0x3dc41008, 0x3d111048, 0x3dc51008, 0x3d131048, 0x3dc51008,
+        0x3d191048, 0x3dc41008, 0x3d3e1048, 0x3dc41008, 0x3d6d1048, 0x3dc41008, 0x3d841048, 0x3dc41008,
+        0x3d8a1048, 0x3dc51008, 0x3d911048, 0x3dc41008, 0x3d271008, 0x3d8a1008, 0x23d51010, 0x23d51004,
+        0x23d81010, 0x23d81004, 0x23dd1010, 0x23dd1004, 0x23f11010, 0x23f11004, 0x23fa1010, 0x23fa1004,
+        0x248e1010, 0x248e1004, 0x24b51010, 0x24b51004, 0x24f11010, 0x24f11004, 0x24f81010, 0x24f81004,
+        0x25091010, 0x25091004, 0x25121010, 0x25121004, 0x25131010, 0x25131004, 0x25211010, 0x25211004,
+        0x25261010, 0x25261004, 0x252b1010, 0x252b1004, 0x25401010, 0x25401004, 0x24c21010, 0x24c21004,
+        0x23b91010, 0x23b91004, 0x24251010, 0x24251004, 0x24301010, 0x24301004, 0x244c1014, 0x00002884,
+        0x03a51004, 0x23c31008, 0x23e51008, 0x23ed1048, 0x00001588, 0x24821008, 0x24f91008, 0x24fd1008,
+        0x24ad1008, 0x03e31004, 0x24f31004, 0x23b41010, 0x23b41004, 0x23e41010, 0x23e41004, 0x23cc1010,
+        0x23cc1004, 0x24db1010, 0x24db1004, 0x23e21010, 0x23e21004, 0x247d1010, 0x247d1004, 0x24771010,
+        0x24771004, 0x24c31010, 0x24c31004, 0x24c81010, 0x24c81004, 0x24ce1010, 0x24ce1004, 0x24ac1010,
+        0x24ac1004, 0x24ec1010, 0x24ec1004, 0x24f41028, 0x24fd1028, 0x24931008, 0x25191008, 0x3dc61004,
+        0x3dc71004, 0x3dc81004, 0x3dc91004, 0x3dca1004, 0x3dcb1004, 0x3dcc1004, 0x3dcd1004, 0x3dce1004,
+        0x3dcf1004, 0x3dd01004, 0x3dd11004, 0x3dd21004, 0x3dd31004, 0x3dd41004, 0x3dd51004, 0x3dd61004,
+        0x3dd71004, 0x3dd81004, 0x3dd91004, 0x3dda1004, 0x3ddb1004, 0x3ddc1004, 0x3ddd1004, 0x3dde1004,
+        0x3ddf1004, 0x3de01004, 0x3de11004, 0x3de21004, 0x3de31004, 0x3de41004, 0x3de51004, 0x3de61004,
+        0x3de71004, 0x3de81004, 0x3de91004, 0x3dea1004, 0x3deb1004, 0x3dec1004, 0x3ded1004, 0x3dee1004,
+        0x3def1004, 0x3df01004, 0x3df11004, 0x3df21004, 0x3df31004, 0x3df41004, 0x3df51004, 0x3df61004,
+        0x3df71004, 0x3df81004, 0x3df91004, 0x3dfa1004, 0x3dfb1004, 0x3dfc1004, 0x3dfd1004, 0x3dfe1004,
+        0x3dff1004, 0x3e001004, 0x3e011004, 0x3e021004, 0x3e031004, 0x3e041004, 0x3e051004, 0x3e061004,
+        0x3e071004, 0x3e081004, 0x3e091004, 0x3e0a1004, 0x3e0b1004, 0x3e0c1004, 0x3e0d1004, 0x3e0e1004,
+        0x3e0f1004, 0x3e101004, 0x3e111004, 0x3e121004, 0x3e131004, 0x3e141004, 0x3e151004, 0x00005b04,
+        0x00005b84, 0x02e01004, 0x028e1004, 0x02661004, 0x02341004, 0x023e1004, 0x02781004, 0x05041004,
+        0x05051004, 0x05061004, 0x05071004, 0x05081004, 0x05091004, 0x050a1004, 0x050b1004, 0x050c1004,
+        0x050d1004, 0x050e1004, 0x050f1004, 0x05101004, 0x05111004, 0x05121004, 0x05131004, 0x05141004,
+        0x05151004, 0x05161004, 0x05171004, 0x05181004, 0x05191004, 0x051a1004, 0x051b1004, 0x051c1004,
+        0x051d1004, 0x051e1004, 0x051f1004, 0x05201004, 0x05211004, 0x05221004, 0x05231004, 0x05241004,
+        0x05251004, 0x22e61010, 0x22e61004, 0x22f11010, 0x22f11004, 0x20891010, 0x20891004, 0x21f71054,
+        0x22861008, 0x21f71048, 0x22861008, 0x22cb1010, 0x22cb1004, 0x22cc1010, 0x22cc1004, 0x22cd1010,
+        0x22cd1004, 0x20461004, 0x21d61004, 0x1fa21054, 0x1fa21014, 0x1fa21048, 0x1fa21008, 0x1fa21054,
+        0x213c1014, 0x1fa21054, 0x22171014, 0x1fa21048, 0x22171008, 0x1fa21054, 0x22471014, 0x1fa21054,
+        0x00008c48, 0x22471014, 0x1fa21048, 0x00008c48, 0x22471008, 0x1fa21054, 0x22701014, 0x1fa21048,
+        0x22701008, 0x1fea1010, 0x1fea1004, 0x20cf1010, 0x20cf1004, 0x20d01010, 0x20d01004, 0x20d11010,
+        0x20d11004, 0x20de1010, 0x20de1004, 0x20e01010, 0x20e01004, 0x21601010, 0x21601004, 0x21581010,
+        0x21581004, 0x213c1054, 0x213c1014, 0x213c1048, 0x213c1008, 0x21711010, 0x21711004, 0x21781010,
+        0x21781004, 0x21791010, 0x21791004, 0x21851010, 0x21851004, 0x21861010, 0x21861004, 0x219d1010,
+        0x219d1004, 0x21d11010, 0x21d11004, 0x224c1010, 0x224c1004, 0x22471054, 0x22701014, 0x22471048,
+        0x22701008, 0x22a21010, 0x22a21004, 0x22b91010, 0x22b91004, 0x22ba1010, 0x22ba1004, 0x22bf1010,
+        0x22bf1004, 0x22c31010, 0x22c31004, 0x22c41010, 0x22c41004, 0x22c51010, 0x22c51004, 0x22c51028,
+        0x20051004, 0x20fb1004, 0x21171004, 0x21361004, 0x21cf1004, 0x21d01004, 0x22121004, 0x22c61004,
+        0x1feb1054, 0x00008c88, 0x20421054, 0x00008c88, 0x20421048, 0x00008c88, 0x20511054, 0x00008c88,
+        0x206c1010, 0x206c1004, 0x21001010, 0x21001004, 0x21931054, 0x00008c88, 0x21931048, 0x00008c88,
+        0x21d21054, 0x00008c88, 0x21f71054, 0x00008c88, 0x21f71048, 0x00008c88, 0x05261004, 0x05271004,
+        0x05281004, 0x22e71010, 0x22e71004, 0x222c1010, 0x20f61004, 0x22e81004, 0x212b1010, 0x212b1004,
+        0x1fdf1010, 0x1fdf1004, 0x1fe01004, 0x20811004, 0x1fcb1010, 0x1fcb1004, 0x20481010, 0x20481004,
+        0x1fa21054, 0x00001588, 0x213c1054, 0x00001588, 0x22171054, 0x00001588, 0x20511054, 0x00001a88,
+        0x20511048, 0x00001a88, 0x20c41054, 0x00001a88, 0x20c41048, 0x00001a88, 0x21181054, 0x00001a88,
+        0x21181048, 0x00001a88, 0x21931054, 0x00001a88, 0x21931048, 0x00001a88, 0x21d21054, 0x00001a88,
+        0x21d21048, 0x00001a88, 0x20821010, 0x202c1010, 0x20551010, 0x20ec1010, 0x20981010, 0x21841004,
+        0x20d21010, 0x22131010, 0x20b81010, 0x226d1010, 0x1fd51010, 0x1fd51004, 0x21651010, 0x21651004,
+        0x22271010, 0x22271004, 0x1fa91010, 0x1fa91004, 0x20a51010, 0x20a51004, 0x222b1010, 0x222b1004,
+        0x225e1010, 0x225e1004, 0x1fe01010, 0x21da1010, 0x22901010, 0x1ff11010, 0x1ff11004, 0x21d71010,
+        0x21d71004, 0x20881010, 0x20881004, 0x209d1004, 0x20751068, 0x00001ca8, 0x213c1068, 0x00008c68,
+        0x20071028, 0x223c1004, 0x20501004, 0x217a1004, 0x21151004, 0x209c1004, 0x21161004, 0x2cdc1004,
+        0x2cdd1004, 0x2cde1004, 0x2cdf1004, 0x2ce01004, 0x2ce11004, 0x2ce21004, 0x2ce41004, 0x2ce51004,
+        0x2ce61004, 0x2ce71004, 0x2ce81004, 0x2ce91004, 0x2cea1004, 0x2ceb1004, 0x2cec1004, 0x2ced1004,
+        0x2cee1004, 0x2cef1004, 0x2cf01004, 0x2cf11004, 0x2cf21004, 0x2cf31004, 0x2cf41004, 0x2cf51004,
+        0x2cf61004, 0x2cf71004, 0x2cf81004, 0x2cf91004, 0x2cfa1004, 0x2cfb1004, 0x2cfc1004, 0x2cfd1004,
+        0x2cfe1004, 0x2cff1004, 0x2d001004, 0x2d011004, 0x2d021004, 0x2d031004, 0x056c1004, 0x056d1004,
+        0x056e1004, 0x056f1004, 0x2ce31004, 0x1d621004, 0x1d631004, 0x1d641004, 0x1d651004, 0x1d661004,
+        0x1d671004, 0x05701004, 0x05711004, 0x1f6f1004, 0x05721004, 0x34201004, 0x34211004, 0x34221004,
+        0x34231004, 0x34241004, 0x34251004, 0x34261004, 0x34271004, 0x342c1004, 0x342d1004, 0x342e1004,
+        0x342f1004, 0x34301004, 0x34311004, 0x34321004, 0x34331004, 0x34341004, 0x34351004, 0x34361004,
+        0x34371004, 0x34391004, 0x343a1004, 0x343b1004, 0x343c1004, 0x343f1004, 0x34421004, 0x34431004,
+        0x34451004, 0x34461004, 0x34491004, 0x344e1004, 0x344f1004, 0x34501004, 0x34511004, 0x344a1004,
+        0x344b1004, 0x344c1004, 0x344d1004, 0x34521004, 0x34381004, 0x343d1004, 0x34281004, 0x34291004,
+        0x342a1004, 0x342b1004, 0x343e1004, 0x34441004, 0x34471004, 0x34481004, 0x34401004, 0x34411004,
+        0x34531004, 0x04541004, 0x04551004, 0x029c1004, 0x029d1004, 0x2d041004, 0x2d051004, 0x2d061004,
+        0x2d071004, 0x2d081004, 0x2d091004, 0x2d0a1004, 0x2d0b1004, 0x2d0c1004, 0x2d0d1004, 0x2d0e1004,
+        0x2d0f1004, 0x2d101004, 0x2d111004, 0x2d121004, 0x2d131004, 0x2d141004, 0x2d151004, 0x2d161004,
+        0x2d171004, 0x2d181004, 0x2d191004, 0x2d1a1004, 0x2d1b1004, 0x2d1c1004, 0x2d1d1004, 0x2d1e1004,
+        0x2d1f1004, 0x2d201004, 0x2d211004, 0x2d221004, 0x2d231004, 0x2d241004, 0x2d251004, 0x2d261004,
+        0x2d271004, 0x2d281004, 0x2d291004, 0x2d2a1004, 0x2d2b1004, 0x2d2c1004, 0x2d2d1004, 0x2d2e1004,
+        0x2d2f1004, 0x2d301004, 0x2d311004, 0x2d321004, 0x2d331004, 0x2d341004, 0x2d351004, 0x2d361004,
+        0x2d371004, 0x2d381004, 0x2d391004, 0x2d3a1004, 0x2d3b1004, 0x2d3c1004, 0x2d3d1004, 0x2d3e1004,
+        0x2d3f1004, 0x2d401004, 0x2d411004, 0x2d421004, 0x2d431004, 0x2d441004, 0x2d451004, 0x2d461004,
+        0x02981004, 0x02991004, 0x2a211004, 0x2a211008, 0x04011004, 0x04021004, 0x04031004, 0x2a221004,
+        0x04041004, 0x29d81004, 0x29ee1004, 0x2a371004, 0x354b1004, 0x354c1004, 0x354d1004, 0x354e1004,
+        0x354f1004, 0x35501004, 0x35511004, 0x35521004, 0x35531004, 0x35541004, 0x35551004, 0x35561004,
+        0x35571004, 0x35581004, 0x35591004, 0x355a1004, 0x355b1004, 0x355c1004, 0x355d1004, 0x355e1004,
+        0x355f1004, 0x35601004, 0x35611004, 0x35621004, 0x35631004, 0x35641004, 0x35651004, 0x35661004,
+        0x35671004, 0x35681004, 0x35691004, 0x356a1004, 0x356b1004, 0x00007204, 0x00007284, 0x00007304,
+        0x045a1004, 0x02a01004, 0x35271004, 0x35281004, 0x35291004, 0x352a1004, 0x352b1004, 0x352c1004,
+        0x352d1004, 0x352e1004, 0x352f1004, 0x35301004, 0x35311004, 0x35321004, 0x35331004, 0x35341004,
+        0x35351004, 0x35361004, 0x35371004, 0x35381004, 0x35391004, 0x353a1004, 0x353b1004, 0x353c1004,
+        0x353d1004, 0x353e1004, 0x353f1004, 0x35401004, 0x35411004, 0x35421004, 0x35431004, 0x35441004,
+        0x35451004, 0x35461004, 0x35471004, 0x35481004, 0x35491004, 0x354a1004, 0x02e11004, 0x41d41004,
+        0x41d51004, 0x41d61004, 0x41d71004, 0x41d81004, 0x41d91004, 0x41da1004, 0x41db1004, 0x41dc1004,
+        0x41dd1004, 0x41de1004, 0x41df1004, 0x41e01004, 0x41e11004, 0x41e21004, 0x41e31004, 0x41e41004,
+        0x41e51004, 0x41e61004, 0x41e71004, 0x41e81004, 0x41e91004, 0x41ea1004, 0x41eb1004, 0x41ec1004,
+        0x41ed1004, 0x41ee1004, 0x41ef1004, 0x41f01004, 0x00006504, 0x37fc1004, 0x37fd1004, 0x37fe1004,
+        0x37ff1004, 0x38001004, 0x38011004, 0x38021004, 0x38031004, 0x38041004, 0x38051004, 0x38061004,
+        0x38071004, 0x38081004, 0x38091004, 0x380a1004, 0x380b1004, 0x380c1004, 0x380d1004, 0x380e1004,
+        0x380f1004, 0x38101004, 0x38111004, 0x38121004, 0x38131004, 0x38141004, 0x38151004, 0x38161004,
+        0x38171004, 0x38181004, 0x38191004, 0x381a1004, 0x381b1004, 0x381c1004, 0x381d1004, 0x381e1004,
+        0x381f1004, 0x38201004, 0x38211004, 0x38221004, 0x38241004, 0x38241008, 0x38261004, 0x38271004,
+        0x38281004, 0x38291004, 0x382a1004, 0x382b1004, 0x382c1004, 0x382c1008, 0x382e1004, 0x382f1004,
+        0x38301004, 0x38311004, 0x38331004, 0x38341004, 0x382d1004, 0x38321004, 0x38231004, 0x38251004,
+        0x38351004, 0x02d61004, 0x02d71004, 0x02d81004, 0x02d91004, 0x02da1004, 0x02db1004, 0x02621004,
+        0x02ab1004, 0x02ac1004, 0x02dc1004, 0x02dd1004, 0x02de1004, 0x02df1004, 0x1f4d1004, 0x045b1004,
+        0x045c1004, 0x35751004, 0x357d1004, 0x35871004, 0x359d1004, 0x35b61004, 0x36001004, 0x1f4e1004,
+        0x358f1004, 0x35b11004, 0x35731004, 0x35761004, 0x35821004, 0x35891004, 0x35971004, 0x359a1004,
+        0x359e1004, 0x35d21004, 0x35a31004, 0x35a61004, 0x35b41004, 0x35b71004, 0x37711004, 0x37721004,
+        0x37731004, 0x37741004, 0x37751004, 0x37761004, 0x37771004, 0x37781004, 0x37791004, 0x377a1004,
+        0x377b1004, 0x377c1004, 0x377d1004, 0x377e1004, 0x377f1004, 0x37801004, 0x37811004, 0x37821004,
+        0x37831004, 0x37841004, 0x37851004, 0x37861004, 0x37871004, 0x37881004, 0x37891004, 0x378a1004,
+        0x378b1004, 0x378c1004, 0x378d1004, 0x378e1004, 0x378f1004, 0x37901004, 0x37911004, 0x37921004,
+        0x37931004, 0x37941004, 0x37951004, 0x37961004, 0x37971004, 0x37981004, 0x37991004, 0x379e1004,
+        0x379f1004, 0x37a01004, 0x37a11004, 0x37a21004, 0x37a31004, 0x37a41004, 0x37a51004, 0x37a61004,
+        0x37a71004, 0x379a1004, 0x379b1004, 0x379c1004, 0x379d1004, 0x37a81004, 0x37a91004, 0x37aa1004,
+        0x37ab1004, 0x37ac1004, 0x37ad1004, 0x37ae1004, 0x37af1004, 0x37b01004, 0x37b11004, 0x37b21004,
+        0x37b31004, 0x37b41004, 0x37b51004, 0x045d1004, 0x02ad1004, 0x02ae1004, 0x02af1004, 0x35721004,
+        0x357b1004, 0x357e1004, 0x35811004, 0x35881004, 0x358e1004, 0x35921004, 0x35941004, 0x35961004,
+        0x35991004, 0x35a51004, 0x35a91004, 0x35ca1004, 0x35cd1004, 0x35cf1004, 0x35af1004, 0x1f4f1004,
+        0x35d01004, 0x35841004, 0x35bd1004, 0x36181004, 0x36191004, 0x361a1004, 0x059b1004, 0x059c1004,
+        0x059d1004, 0x35be1004, 0x36151004, 0x36161004, 0x36171004, 0x357f1004, 0x358b1004, 0x32961004,
+        0x32971004, 0x32981004, 0x32991004, 0x329a1004, 0x329b1004, 0x329c1004, 0x329d1004, 0x329e1004,
+        0x329f1004, 0x32a01004, 0x32a11004, 0x32a21004, 0x32a31004, 0x32a41004, 0x32a51004, 0x32a61004,
+        0x32a71004, 0x32a81004, 0x32a91004, 0x32aa1004, 0x32ab1004, 0x32ac1004, 0x32ad1004, 0x32ae1004,
+        0x32af1004, 0x32b01004, 0x32b11004, 0x32b21004, 0x32b31004, 0x32b41004, 0x32b51004, 0x32b61004,
+        0x32b71004, 0x32b81004, 0x32b91004, 0x32ba1004, 0x32bb1004, 0x32bc1004, 0x32bd1004, 0x32be1004,
+        0x32bf1004, 0x32c01004, 0x32c11004, 0x32c21004, 0x32c31004, 0x32c41004, 0x32c51004, 0x32c61004,
+        0x32c71004, 0x32c81004, 0x32c91004, 0x32ca1004, 0x32cb1005, 0x32cc1005, 0x32cd1004, 0x32ce1004,
+        0x32cf1005, 0x32d01004, 0x32d11005, 0x32d21005, 0x32d31004, 0x32d41004, 0x00007084, 0x32d51004,
+        0x00007104, 0x32d61004, 0x32d71004, 0x32d81004, 0x1f501004, 0x040e1004, 0x040f1004, 0x2cb91004,
+        0x2cba1004, 0x2cbb1004, 0x2cbc1004, 0x2cbd1004, 0x2cbe1004, 0x2cbf1004, 0x2cc01004, 0x2cc11004,
+        0x2cc21004, 0x2cc31004, 0x2ccc1004, 0x2ccd1004, 0x2cce1004, 0x2ccf1004, 0x2cd01004, 0x02b01004,
+        0x02791004, 0x2c9d1004, 0x1f511004, 0x1f521004, 0x2cd11004, 0x2cdb1004, 0x28521004, 0x28531004,
+        0x28541004, 0x28551004, 0x28561004, 0x28571004, 0x29191004, 0x291a1004, 0x291b1004, 0x291c1004,
+        0x291d1004, 0x291e1004, 0x28fa1004, 0x28fb1004, 0x28fc1004, 0x28fd1004, 0x28fe1004, 0x28ff1004,
+        0x295c1004, 0x295d1004, 0x295e1004, 0x295f1004, 0x29601004, 0x29611004, 0x29621004, 0x29741004,
+        0x29751004, 0x29761004, 0x29771004, 0x29781004, 0x29791004, 0x297a1004, 0x1fb51004, 0x1fac1004,
+        0x200c1004, 0x200d1004, 0x20131004, 0x20471004, 0x20591004, 0x20f01004, 0x20ea1004, 0x20eb1004,
+        0x21141004, 0x21351004, 0x213b1004, 0x21421004, 0x214e1004, 0x21551004, 0x214a1004, 0x21481004,
+        0x21491004, 0x214b1004, 0x214c1004, 0x21971004, 0x219c1004, 0x21c51004, 0x21c61004, 0x21bb1004,
+        0x21c71004, 0x21c81004, 0x21c91004, 0x21e81004, 0x221c1004, 0x22261004, 0x22201004, 0x22211004,
+        0x222a1004, 0x226d1004, 0x226e1004, 0x226f1004, 0x22691004, 0x226a1004, 0x226b1004, 0x226c1004,
+        0x22811004, 0x05291004, 0x20891028, 0x20f01028, 0x20e61028, 0x222a1028, 0x22c01004, 0x22c11004,
+        0x21571004, 0x22c21004, 0x1fbb1004, 0x23471004, 0x1feb1048, 0x22951008, 0x21f71048, 0x21da1008,
+        0x21ce1004, 0x22601028, 0x04da1004, 0x04db1004, 0x38de1004, 0x38df1004, 0x38e01004, 0x38e11004,
+        0x38e21004, 0x38e31004, 0x38e41004, 0x38e51004, 0x38e61004, 0x38e71004, 0x38e81004, 0x38e91004,
+        0x38ea1004, 0x38eb1004, 0x38ec1004, 0x38ed1004, 0x38ee1004, 0x38ef1004, 0x38f01004, 0x38f11004,
+        0x38f21004, 0x38f31004, 0x38f41004, 0x38f51004, 0x38f61004, 0x38f71004, 0x38f81004, 0x38f91004,
+        0x38fa1004, 0x38fb1004, 0x38fc1004, 0x38fd1004, 0x38fe1004, 0x38ff1004, 0x39001004, 0x39011004,
+        0x39021004, 0x39031004, 0x39041004, 0x39051004, 0x39061004, 0x39071004, 0x39081004, 0x39091004,
+        0x390a1004, 0x390b1004, 0x390c1004, 0x390d1004, 0x390e1004, 0x390f1004, 0x39101004, 0x39111004,
+        0x39121004, 0x39131004, 0x39141004, 0x39151004, 0x39161004, 0x39171004, 0x39181004, 0x39191004,
+        0x391a1004, 0x391b1004, 0x391c1004, 0x391d1004, 0x391e1004, 0x391f1004, 0x39201004, 0x39211004,
+        0x39221004, 0x39231004, 0x39241004, 0x39251004, 0x39261004, 0x39271004, 0x39281004, 0x39291004,
+        0x392a1004, 0x392b1004, 0x392c1004, 0x392d1004, 0x2c9e1004, 0x2c9f1004, 0x2ca01004, 0x2ca11004,
+        0x2ca21004, 0x2ca31004, 0x2ca41004, 0x2ca51004, 0x2ca61004, 0x2ca71004, 0x2ca81004, 0x2ca91004,
+        0x2caa1004, 0x2cab1004, 0x2cac1004, 0x2cad1004, 0x2cae1004, 0x2caf1004, 0x2cb01004, 0x2cb11004,
+        0x2cb21004, 0x2cb31004, 0x2cb41004, 0x2cb51004, 0x2cb61004, 0x2cb71004, 0x2cb81004, 0x2cd21004,
+        0x2cd31004, 0x2cd41004, 0x2cd51004, 0x2cd61004, 0x2cd71004, 0x2cd81004, 0x2cd91004, 0x2cc41004,
+        0x2cc51004, 0x2cc61004, 0x2cc71004, 0x2cc81004, 0x2cc91004, 0x2cca1004, 0x2ccb1004, 0x02b11004,
+        0x00006604, 0x2cda1004, 0x423a1004, 0x423b1004, 0x423c1004, 0x423d1004, 0x423e1004, 0x423f1004,
+        0x42401004, 0x42411004, 0x42421004, 0x42431004, 0x42441004, 0x42451004, 0x42461004, 0x42471004,
+        0x42481004, 0x42491004, 0x424a1004, 0x424b1004, 0x424c1004, 0x424d1004, 0x424e1004, 0x424f1004,
+        0x42501004, 0x42a91004, 0x42aa1004, 0x42ab1004, 0x42ac1004, 0x42ad1004, 0x42ae1004, 0x42af1004,
+        0x42b01004, 0x42b11004, 0x42b21004, 0x42b31004, 0x42b41004, 0x42b51004, 0x42b61004, 0x42b71004,
+        0x42b81004, 0x42b91004, 0x42ba1004, 0x42bb1004, 0x42bc1004, 0x42bd1004, 0x42be1004, 0x42bf1004,
+        0x42c01004, 0x42c11004, 0x42c21004, 0x42c31004, 0x42c41004, 0x42c51004, 0x42c61004, 0x42c71004,
+        0x42c81004, 0x42c91004, 0x42ca1004, 0x42cb1004, 0x42cc1004, 0x42cd1004, 0x42ce1004, 0x42cf1004,
+        0x42d01004, 0x42d11004, 0x42d21004, 0x42d31004, 0x42d41004, 0x42d51004, 0x42d61004, 0x42d71004,
+        0x42d81004, 0x42d91004, 0xfb411044, 0x8c480000, 0xfb401044, 0xe6f40000, 0xfb411044, 0x8eca0000,
+        0xfb411044, 0x8cc80000, 0xfb401044, 0xeed10000, 0xfb401044, 0xce320000, 0xfb401044, 0xd3e50000,
+        0xfb411044, 0x9f9c0000, 0xfb401044, 0xd9510000, 0xfb411044, 0x91d10000, 0xfb401044, 0xd5870000,
+        0xfb401044, 0xd9480000, 0xfb401044, 0xe1f60000, 0xfb401044, 0xf6690000, 0xfb401044, 0xff850000,
+        0xfb411044, 0x863f0000, 0xfb411044, 0x87ba0000, 0xfb411044, 0x88f80000, 0xfb411044, 0x908f0000,
+        0xfb401044, 0xea020000, 0xfb401044, 0xed1b0000, 0xfb401044, 0xf0d90000, 0xfb401044, 0xf3de0000,
+        0xfb411044, 0x843d0000, 0xfb411044, 0x916a0000, 0xfb411044, 0x99f10000, 0xfb401044, 0xce820000,
+        0xfb401044, 0xd3750000, 0xfb401044, 0xeb040000, 0xfb401044, 0xf21b0000, 0xfb411044, 0x862d0000,
+        0xfb411044, 0x9e1e0000, 0xfb401044, 0xdd500000, 0xfb401044, 0xefeb0000, 0xfb411044, 0x85cd0000,
+        0xfb411044, 0x89640000, 0xfb401044, 0xe2c90000, 0xfb411044, 0x81d80000, 0xfb411044, 0x881f0000,
+        0xfb401044, 0xdeca0000, 0xfb401044, 0xe7170000, 0xfb401044, 0xed6a0000, 0xfb401044, 0xf2fc0000,
+        0xfb411044, 0x90ce0000, 0xfb401044, 0xcf860000, 0xfb401044, 0xd1b70000, 0xfb401044, 0xd2de0000,
+        0xfb401044, 0xe4c40000, 0xfb401044, 0xead30000, 0xfb401044, 0xf2100000, 0xfb401044, 0xf6e70000,
+        0xfb411044, 0x80010000, 0xfb411044, 0x86060000, 0xfb411044, 0x865c0000, 0xfb411044, 0x8def0000,
+        0xfb411044, 0x97320000, 0xfb411044, 0x9b6f0000, 0xfb411044, 0x9dfa0000, 0xfb401044, 0xf88c0000,
+        0xfb401044, 0xf97f0000, 0xfb401044, 0xfda00000, 0xfb411044, 0x83c90000, 0xfb411044, 0x93040000,
+        0xfb411044, 0x9e7f0000, 0xfb411044, 0x8ad60000, 0xfb401044, 0xd8df0000, 0xfb401044, 0xdf040000,
+        0xfb401044, 0xfc600000, 0xfb411044, 0x807e0000, 0xfb401044, 0xf2620000, 0xfb401044, 0xf8ca0000,
+        0xfb411044, 0x8cc20000, 0xfb411044, 0x96f70000, 0xfb401044, 0xd8d80000, 0xfb401044, 0xdc620000,
+        0xfb401044, 0xea130000, 0xfb401044, 0xedda0000, 0xfb401044, 0xef0f0000, 0xfb401044, 0xfd2f0000,
+        0xfb401044, 0xfe370000, 0xfb411044, 0x964b0000, 0xfb401044, 0xd2d20000, 0xfb411044, 0x808b0000,
+        0xfb401044, 0xd1dc0000, 0xfb401044, 0xd1cc0000, 0xfb401044, 0xfa1c0000, 0xfb401044, 0xfdbe0000,
+        0xfb411044, 0x83f10000, 0xfb411044, 0x96750000, 0xfb411044, 0x8b800000, 0xfb401044, 0xe2cf0000,
+        0xfb411044, 0x8afe0000, 0xfb401044, 0xce390000, 0xfb401044, 0xdbe70000, 0xfb401044, 0xe0120000,
+        0xfb401044, 0xf3870000, 0xfb401044, 0xf5700000, 0xfb401044, 0xd3170000, 0xfb401044, 0xf8fb0000,
+        0xfb401044, 0xcfbf0000, 0xfb401044, 0xdfa90000, 0xfb401044, 0xce0d0000, 0xfb401044, 0xeccc0000,
+        0xfb401044, 0xe5780000, 0xfb401044, 0xfd220000, 0xfb401044, 0xd3c30000, 0xfb401044, 0xd85e0000,
+        0xfb401044, 0xf7010000, 0xfb411044, 0x84490000, 0xfb411044, 0x8aaa0000, 0xfb401044, 0xebba0000,
+        0xfb411044, 0x8fb00000, 0xfb401044, 0xec880000, 0xfb401044, 0xe2fe0000, 0xfb411044, 0x82e50000,
+        0xfb401044, 0xe3a00000, 0xfb401044, 0xf5650000, 0xfb401044, 0xceae0000, 0xfb401044, 0xd1690000,
+        0xfb401044, 0xd1c90000, 0xfb401044, 0xe8810000, 0xfb401044, 0xfce70000, 0xfb411044, 0x826f0000,
+        0xfb411044, 0x8ad20000, 0xfb411044, 0x91cf0000, 0xfb401044, 0xd2f50000, 0xfb401044, 0xd4420000,
+        0xfb401044, 0xd9730000, 0xfb401044, 0xdeec0000, 0xfb401044, 0xe5c50000, 0xfb401044, 0xeffe0000,
+        0xfb401044, 0xf92a0000, 0xfb411044, 0x95ad0000, 0xfb411044, 0x9a6a0000, 0xfb411044, 0x9e970000,
+        0xfb411044, 0x9ece0000, 0xfb401044, 0xd29b0000, 0xfb401044, 0xe6c60000, 0xfb401044, 0xeb770000,
+        0xfb411044, 0x8f620000, 0xfb401044, 0xde740000, 0xfb401044, 0xe1900000, 0xfb401044, 0xe2000000,
+        0xfb401044, 0xe49a0000, 0xfb401044, 0xef230000, 0xfb401044, 0xf1490000, 0xfb401044, 0xf4890000,
+        0xfb401044, 0xf9ca0000, 0xfb401044, 0xfdf40000, 0xfb411044, 0x806f0000, 0xfb411044, 0x8f260000,
+        0xfb411044, 0x84ee0000, 0xfb411044, 0x90230000, 0xfb411044, 0x934a0000, 0xfb401044, 0xd2170000,
+        0xfb401044, 0xd2a30000, 0xfb401044, 0xd4bd0000, 0xfb401044, 0xf0c80000, 0xfb411044, 0x88c20000,
+        0xfb401044, 0xdec90000, 0xfb401044, 0xdff50000, 0xfb401044, 0xe37b0000, 0xfb401044, 0xebae0000,
+        0xfb401044, 0xfc3e0000, 0xfb401044, 0xf3750000, 0xfb401044, 0xcee40000, 0xfb401044, 0xd6f90000,
+        0xfb401044, 0xddba0000, 0xfb401044, 0xe01c0000, 0xfb401044, 0xf3b20000, 0xfb401044, 0xf4690000,
+        0xfb401044, 0xff9a0000, 0xfb411044, 0x80460000, 0xfb411044, 0x92340000, 0xfb411044, 0x96f60000,
+        0xfb411044, 0x97480000, 0xfb411044, 0x98180000, 0xfb401044, 0xcf8b0000, 0xfb401044, 0xf9ae0000,
+        0xfb411044, 0x91b40000, 0xfb411044, 0x96b80000, 0xfb401044, 0xe0e10000, 0xfb401044, 0xce860000,
+        0xfb401044, 0xd0da0000, 0xfb401044, 0xdbee0000, 0xfb401044, 0xdc3f0000, 0xfb401044, 0xe5990000,
+        0xfb401044, 0xf1ce0000, 0xfb401044, 0xf6420000, 0xfb411044, 0x84fc0000, 0xfb411044, 0x907c0000,
+        0xfb411044, 0x9f8d0000, 0xfb401044, 0xe6880000, 0xfb411044, 0x962e0000, 0xfb401044, 0xd2890000,
+        0xfb401044, 0xe77b0000, 0xfb401044, 0xe7f30000, 0xfb401044, 0xed410000, 0xfb401044, 0xee9c0000,
+        0xfb401044, 0xf4090000, 0xfb401044, 0xf5590000, 0xfb401044, 0xf86b0000, 0xfb401044, 0xfd100000,
+        0xfb411044, 0x985e0000, 0xfb401044, 0xd16d0000, 0xfb401044, 0xe22e0000, 0xfb411044, 0x96780000,
+        0xfb401044, 0xd02b0000, 0xfb401044, 0xdd190000, 0xfb401044, 0xedea0000, 0xfb411044, 0x8f2a0000,
+        0xfb401044, 0xdf8b0000, 0xfb401044, 0xe1440000, 0xfb401044, 0xe8170000, 0xfb411044, 0x96860000,
+        0xfb401044, 0xd2290000, 0xfb401044, 0xd40f0000, 0xfb401044, 0xdc650000, 0xfb401044, 0xe6130000,
+        0xfb401044, 0xe74e0000, 0xfb401044, 0xe8a80000, 0xfb401044, 0xece50000, 0xfb401044, 0xf4060000,
+        0xfb401044, 0xf5e20000, 0xfb401044, 0xff790000, 0xfb411044, 0x88cf0000, 0xfb411044, 0x88e10000,
+        0xfb411044, 0x91cc0000, 0xfb411044, 0x96e20000, 0xfb401044, 0xd33f0000, 0xfb401044, 0xeeba0000,
+        0xfb401044, 0xd41d0000, 0xfb401044, 0xf1d00000, 0xfb401044, 0xf4980000, 0xfb411044, 0x85fa0000,
+        0xfb411044, 0x96a30000, 0xfb411044, 0x9c570000, 0xfb411044, 0x9e9f0000, 0xfb401044, 0xe7970000,
+        0xfb401044, 0xedcb0000, 0xfb411044, 0x81e80000, 0xfb401044, 0xfacb0000, 0xfb401044, 0xfb200000,
+        0xfb401044, 0xfc920000, 0xfb401044, 0xf2c00000, 0xfb401044, 0xf0990000, 0xfb411044, 0x8b580000,
+        0xfb401044, 0xcec00000, 0xfb411044, 0x83360000, 0xfb401044, 0xd23a0000, 0xfb401044, 0xd2070000,
+        0xfb401044, 0xdea60000, 0xfb401044, 0xe2d30000, 0xfb401044, 0xfcd60000, 0xfb401044, 0xdb850000,
+        0xfb401044, 0xed1e0000, 0xfb401044, 0xe6b40000, 0xfb411044, 0x8f3b0000, 0xfb411044, 0x884c0000,
+        0xfb411044, 0x964d0000, 0xfb411044, 0x898b0000, 0xfb401044, 0xded30000, 0xfb401044, 0xd1400000,
+        0xfb401044, 0xd5c00000, 0xfb411044, 0xfa0e0000, 0xfb411044, 0xfa0f0000, 0xfb401044, 0xd85a0000,
+        0xfb411044, 0xfa110000, 0xfb401044, 0xe6740000, 0xfb411044, 0xfa130000, 0xfb411044, 0xfa140000,
+        0xfb401044, 0xd1de0000, 0xfb401044, 0xf32a0000, 0xfb401044, 0xf6ca0000, 0xfb401044, 0xf93c0000,
+        0xfb401044, 0xf95e0000, 0xfb401044, 0xf9650000, 0xfb401044, 0xf98f0000, 0xfb411044, 0x97560000,
+        0xfb401044, 0xfcbe0000, 0xfb401044, 0xffbd0000, 0xfb411044, 0xfa1f0000, 0xfb411044, 0x86120000,
+        0xfb411044, 0xfa210000, 0xfb411044, 0x8af80000, 0xfb411044, 0xfa230000, 0xfb411044, 0xfa240000,
+        0xfb411044, 0x90380000, 0xfb411044, 0x90fd0000, 0xfb411044, 0xfa270000, 0xfb411044, 0xfa280000,
+        0xfb411044, 0xfa290000, 0xfb411044, 0x98ef0000, 0xfb411044, 0x98fc0000, 0xfb411044, 0x99280000,
+        0xfb411044, 0x9db40000, 0xfb411044, 0x90de0000, 0xfb411044, 0x96b70000, 0xfb401044, 0xcfae0000,
+        0xfb401044, 0xd0e70000, 0xfb401044, 0xd14d0000, 0xfb401044, 0xd2c90000, 0xfb401044, 0xd2e40000,
+        0xfb401044, 0xd3510000, 0xfb401044, 0xd59d0000, 0xfb401044, 0xd6060000, 0xfb401044, 0xd6680000,
+        0xfb401044, 0xd8400000, 0xfb401044, 0xd8a80000, 0xfb401044, 0xdc640000, 0xfb401044, 0xdc6e0000,
+        0xfb401044, 0xe0940000, 0xfb401044, 0xe1680000, 0xfb401044, 0xe18e0000, 0xfb401044, 0xe1f20000,
+        0xfb401044, 0xe54f0000, 0xfb401044, 0xe5e20000, 0xfb401044, 0xe6910000, 0xfb401044, 0xe8850000,
+        0xfb401044, 0xed770000, 0xfb401044, 0xee1a0000, 0xfb401044, 0xef220000, 0xfb401044, 0xf16e0000,
+        0xfb401044, 0xf22b0000, 0xfb401044, 0xf4220000, 0xfb401044, 0xf8910000, 0xfb401044, 0xf93e0000,
+        0xfb401044, 0xf9490000, 0xfb401044, 0xf9480000, 0xfb401044, 0xf9500000, 0xfb401044, 0xf9560000,
+        0xfb401044, 0xf95d0000, 0xfb401044, 0xf98d0000, 0xfb401044, 0xf98e0000, 0xfb401044, 0xfa400000,
+        0xfb401044, 0xfa810000, 0xfb401044, 0xfbc00000, 0xfb401044, 0xfe090000, 0xfb401044, 0xfe410000,
+        0xfb401044, 0xff720000, 0xfb411044, 0x80050000, 0xfb411044, 0x81ed0000, 0xfb411044, 0x82790000,
+        0xfb411044, 0x84570000, 0xfb411044, 0x89100000, 0xfb411044, 0x89960000, 0xfb411044, 0x8b010000,
+        0xfb411044, 0x8b390000, 0xfb411044, 0x8cd30000, 0xfb411044, 0x8d080000, 0xfb411044, 0x8fb60000,
+        0xfb411044, 0x96e30000, 0xfb411044, 0x97ff0000, 0xfb411044, 0x983b0000, 0xfb401044, 0xe0750000,
+        0xfb841044, 0xc2ee0000, 0xfb411044, 0x82180000, 0xfb401044, 0xce260000, 0xfb401044, 0xd1b50000,
+        0xfb401044, 0xd1680000, 0xfb401044, 0xcf800000, 0xfb401044, 0xd1450000, 0xfb401044, 0xd1800000,
+        0xfb401044, 0xd2c70000, 0xfb401044, 0xd2fa0000, 0xfb401044, 0xd5550000, 0xfb401044, 0xd5990000,
+        0xfb401044, 0xd5e20000, 0xfb401044, 0xd8b30000, 0xfb401044, 0xd9440000, 0xfb401044, 0xd9540000,
+        0xfb401044, 0xda620000, 0xfb401044, 0xdb280000, 0xfb401044, 0xded20000, 0xfb401044, 0xded90000,
+        0xfb401044, 0xdf690000, 0xfb401044, 0xdfad0000, 0xfb401044, 0xe0d80000, 0xfb401044, 0xe14e0000,
+        0xfb401044, 0xe1080000, 0xfb401044, 0xe1600000, 0xfb401044, 0xe2340000, 0xfb401044, 0xe3c40000,
+        0xfb401044, 0xe41c0000, 0xfb401044, 0xe4520000, 0xfb401044, 0xe5560000, 0xfb401044, 0xe71b0000,
+        0xfb401044, 0xe7560000, 0xfb401044, 0xeb790000, 0xfb401044, 0xeedb0000, 0xfb401044, 0xeecb0000,
+        0xfb401044, 0xf01e0000, 0xfb401044, 0xf7a70000, 0xfb401044, 0xf2350000, 0xfb401044, 0xf2af0000,
+        0xfb401044, 0xf4710000, 0xfb401044, 0xf5060000, 0xfb401044, 0xf53b0000, 0xfb401044, 0xf61d0000,
+        0xfb401044, 0xf61f0000, 0xfb401044, 0xf6db0000, 0xfb401044, 0xf6f40000, 0xfb401044, 0xf74a0000,
+        0xfb401044, 0xf7400000, 0xfb401044, 0xf8cc0000, 0xfb401044, 0xfab10000, 0xfb401044, 0xfc7b0000,
+        0xfb401044, 0xfd5b0000, 0xfb401044, 0xff3e0000, 0xfb411044, 0x83520000, 0xfb411044, 0x83ef0000,
+        0xfb411044, 0x87790000, 0xfb411044, 0x89410000, 0xfb411044, 0x89860000, 0xfb411044, 0x8abf0000,
+        0xfb411044, 0x8acb0000, 0xfb411044, 0x8aed0000, 0xfb411044, 0x8b8a0000, 0xfb411044, 0x8f380000,
+        0xfb411044, 0x90720000, 0xfb411044, 0x91990000, 0xfb411044, 0x92760000, 0xfb411044, 0x967c0000,
+        0xfb411044, 0x97db0000, 0xfb411044, 0x980b0000, 0xfb411044, 0x9b120000, 0xfb841044, 0xa84a0000,
+        0xfb841044, 0xa8440000, 0xfb841044, 0xb3d50000, 0xfb801044, 0xbb9d0000, 0xfb801044, 0xc0180000,
+        0xfb801044, 0xc0390000, 0xfb841044, 0xd2490000, 0xfb841044, 0xdcd00000, 0xfb841044, 0xfed30000,
+        0xfb411044, 0x9f430000, 0xfb411044, 0x9f8e0000, 0x20421048, 0x20421008, 0x20421048, 0x20901008,
+        0x20421048, 0x20d61008, 0x20421048, 0x20421048, 0x20901008, 0x20421048, 0x20421048, 0x20d61008,
+        0x21d21048, 0x00008cc8, 0x21f71008, 0x21d21048, 0x21f71008, 0x26091048, 0x260c1008, 0x26091048,
+        0x25fa1008, 0x26091048, 0x26001008, 0x26141048, 0x260c1008, 0x26091048, 0x26021008, 0x26271044,
+        0x00002b04, 0x00003084, 0x26271048, 0x26271048, 0x00002c84, 0x262d100a, 0x261e100a, 0x2621100a,
+        0x2622100a, 0x2628100a, 0x2629100a, 0x262a100a, 0x2631100a, 0x2633100a, 0x0666100a, 0x26321044,
+        0x00002f04, 0x26321044, 0x00002e84, 0x26321044, 0x00002fc4, 0x00002f04, 0x26321044, 0x00002fc4,
+        0x00002e84, 0x261e1044, 0x00002c84, 0x261e1044, 0x00002d04, 0x261e1044, 0x00002f84, 0x261f1044,
+        0x00002f84, 0x26201044, 0x00002f84, 0x26211044, 0x00002f84, 0x26221044, 0x00002f84, 0x26231044,
+        0x00002f84, 0x26241044, 0x00002f84, 0x26261044, 0x00002f84, 0x26271044, 0x00002f84, 0x26281072,
+        0x00002f84, 0x26281044, 0x00002f84, 0x26291044, 0x00002f84, 0x262a1044, 0x00002f84, 0x262b1044,
+        0x00002f84, 0x262c1044, 0x00002f84, 0x262e1072, 0x00002f84, 0x262e1044, 0x00002f84, 0x262f1044,
+        0x00002f84, 0x26301044, 0x00002f84, 0x26311044, 0x00002f84, 0x26321044, 0x00002f84, 0x26331044,
+        0x00002f84, 0x26231044, 0x00002d84, 0x261f1044, 0x00003004, 0x26281044, 0x00003004, 0x262e1044,
+        0x00003004, 0x261e1048, 0x26291008, 0x26681034, 0x26681032, 0x26751034, 0x26751032, 0x2675102e,
+        0x26751030, 0x26761034, 0x26761032, 0x2676102e, 0x26761030, 0x26771034, 0x26771032, 0x2677102e,
+        0x26771030, 0x26881034, 0x26881032, 0x2688102e, 0x26881030, 0x268b1034, 0x268b1032, 0x268b102e,
+        0x268b1030, 0x26871034, 0x26871032, 0x2687102e, 0x26871030, 0x26e91034, 0x26e91032, 0x26e9102e,
+        0x26e91030, 0x26ec1034, 0x26ec1032, 0x26ec102e, 0x26ec1030, 0x26911034, 0x26911032, 0x2691102e,
+        0x26911030, 0x26901034, 0x26901032, 0x2690102e, 0x26901030, 0x26921034, 0x26921032, 0x2692102e,
+        0x26921030, 0x26941034, 0x26941032, 0x2694102e, 0x26941030, 0x26ab1034, 0x26ab1032, 0x26aa1034,
+        0x26aa1032, 0x26ad1034, 0x26ad1032, 0x26a61034, 0x26a61032, 0x26bc1034, 0x26bc1032, 0x26b51034,
+        0x26b51032, 0x26f71034, 0x26f71032, 0x26f7102e, 0x26f71030, 0x26ff1034, 0x26ff1032, 0x26ff102e,
+        0x26ff1030, 0x27041034, 0x27041032, 0x2704102e, 0x27041030, 0x27021034, 0x27021032, 0x2702102e,
+        0x27021030, 0x27191034, 0x27191032, 0x271b1034, 0x271b1032, 0x271b102e, 0x271b1030, 0x27271074,
+        0x000041b4, 0x27271072, 0x000041b2, 0x27241034, 0x27241032, 0x2724102e, 0x27241030, 0x27231034,
+        0x27231032, 0x2723102e, 0x27231030, 0x27451034, 0x27451032, 0x27451074, 0x000041b4, 0x27451072,
+        0x000041b2, 0x05361004, 0x05371004, 0x05381004, 0x05391004, 0x053a1004, 0x053b1004, 0x053c1004,
+        0x053d1004, 0x053e1004, 0x053f1004, 0x05401004, 0x05411004, 0x05421004, 0x05431004, 0x05441004,
+        0x05451004, 0x26fc1034, 0x26fc1032, 0x26fc102e, 0x26fc1030, 0x272c1034, 0x272c1032, 0x272b1034,
+        0x272b1032, 0x272d1034, 0x272d1032, 0x272c1074, 0x26641034, 0x27301034, 0x27301032, 0x272a1034,
+        0x272a1032, 0x272e1034, 0x272e1032, 0x273b1034, 0x273b1032, 0x273b102e, 0x273b1030, 0x2736102e,
+        0x27361030, 0x266e1074, 0x26721034, 0x266e1072, 0x26721032, 0x266e1074, 0x27271034, 0x266e1072,
+        0x27271032, 0x266e1074, 0x27281034, 0x266e1072, 0x27281032, 0x266e1074, 0x272c1034, 0x266e1072,
+        0x272c1032, 0x266e1074, 0x272b1034, 0x266e1072, 0x272b1032, 0x266e1074, 0x272d1034, 0x266e1072,
+        0x272d1032, 0x266e1074, 0x273b1034, 0x266e1072, 0x273b1032, 0x266e106e, 0x273b102e, 0x266e1074,
+        0x27361034, 0x266e1072, 0x27361032, 0x266e106e, 0x2736102e, 0x27381034, 0x27381032, 0x2738102e,
+        0x27381030, 0x266e1074, 0x268f1034, 0x266e1074, 0x26991034, 0x266e1074, 0x27141034, 0x266e1074,
+        0x27371034, 0x26741074, 0x268f1034, 0x26741074, 0x26991034, 0x26741074, 0x269a1034, 0x26741074,
+        0x27141034, 0x26741074, 0x27361034, 0x26741074, 0x27371034, 0x26851074, 0x268f1034, 0x26851074,
+        0x26991034, 0x26851074, 0x269a1034, 0x26851074, 0x27141034, 0x26851074, 0x27361034, 0x26851074,
+        0x27371034, 0x26861074, 0x268f1034, 0x26861074, 0x27141034, 0x26861074, 0x27361034, 0x26861074,
+        0x27371034, 0x268f1074, 0x26991034, 0x268f1074, 0x27141034, 0x26991074, 0x268f1034, 0x26991074,
+        0x27141034, 0x269a1074, 0x268f1034, 0x269a1074, 0x26991034, 0x269a1074, 0x27141034, 0x26c61074,
+        0x268f1034, 0x26c61074, 0x26991034, 0x26c61074, 0x269a1034, 0x26c61074, 0x27141034, 0x26d11074,
+        0x26991034, 0x26d11074, 0x27141034, 0x26d21074, 0x268f1034, 0x26d21074, 0x26991034, 0x26d21074,
+        0x269a1034, 0x26d21074, 0x27141034, 0x26d71074, 0x26991034, 0x26d71074, 0x27141034, 0x26d81074,
+        0x27141034, 0x26db1074, 0x268f1034, 0x26db1074, 0x27141034, 0x26dc1074, 0x268f1034, 0x26dc1074,
+        0x27141034, 0x26e41074, 0x268f1034, 0x26e41074, 0x26991034, 0x26e41074, 0x269a1034, 0x26e41074,
+        0x27141034, 0x26e41074, 0x27361034, 0x26e41074, 0x27371034, 0x26f01074, 0x26991034, 0x26f01074,
+        0x27141034, 0x26f01074, 0x27361034, 0x26f01074, 0x27371034, 0x26f61074, 0x26721034, 0x26f61074,
+        0x268f1034, 0x26f61074, 0x26991034, 0x26f61074, 0x269a1034, 0x26f61074, 0x270c1034, 0x26f61074,
+        0x27141034, 0x26f61074, 0x27361034, 0x26f61074, 0x27371034, 0x270c1074, 0x268f1034, 0x270c1074,
+        0x26991034, 0x270c1074, 0x269a1034, 0x270c1074, 0x27141034, 0x270c1074, 0x27361034, 0x270c1074,
+        0x27371034, 0x27141074, 0x268f1034, 0x27141074, 0x26991034, 0x27141074, 0x269a1034, 0x27141074,
+        0x27141034, 0x27141074, 0x27361034, 0x27141074, 0x27371034, 0x27181074, 0x268f1034, 0x27181074,
+        0x26991034, 0x27181074, 0x269a1034, 0x27181074, 0x27141034, 0x27181074, 0x27361034, 0x27181074,
+        0x27371034, 0x27221074, 0x268f1034, 0x27221074, 0x27141034, 0x27221074, 0x27361034, 0x27221074,
+        0x27371034, 0x27371074, 0x268f1034, 0x27371074, 0x26991034, 0x27371074, 0x269a1034, 0x27371074,
+        0x27141034, 0x27371074, 0x27361034, 0x27371074, 0x27371034, 0x26a51074, 0x00004c34, 0x26b31074,
+        0x00004c34, 0x27361074, 0x00004c34, 0x00003874, 0x00004034, 0x000039f4, 0x00004034, 0x00003b74,
+        0x00004034, 0x00003d74, 0x00004034, 0x00003ef4, 0x00004034, 0x00004074, 0x00004c34, 0x266e1072,
+        0x26b31032, 0x266e1072, 0x26b41032, 0x266e1072, 0x27141032, 0x266e1072, 0x27181032, 0x266e1072,
+        0x27371032, 0x26741072, 0x26b31032, 0x26741072, 0x26b41032, 0x26741072, 0x27141032, 0x26741072,
+        0x27181032, 0x26741072, 0x27361032, 0x26741072, 0x27371032, 0x26851072, 0x26b31032, 0x26851072,
+        0x26b41032, 0x26851072, 0x27141032, 0x26851072, 0x27181032, 0x26851072, 0x27361032, 0x26851072,
+        0x27371032, 0x26861072, 0x26b31032, 0x26861072, 0x26b41032, 0x26861072, 0x27141032, 0x26861072,
+        0x27181032, 0x26861072, 0x27361032, 0x26861072, 0x27371032, 0x26e41072, 0x27361032, 0x26e41072,
+        0x27371032, 0x26f01072, 0x27361032, 0x26f01072, 0x27371032, 0x26f61072, 0x26721032, 0x26f61072,
+        0x270c1032, 0x26f61072, 0x27141032, 0x26f61072, 0x27361032, 0x26f61072, 0x27371032, 0x270c1072,
+        0x27141032, 0x270c1072, 0x27361032, 0x270c1072, 0x27371032, 0x27141072, 0x26721032, 0x27141072,
+        0x27141032, 0x27181072, 0x26b31032, 0x27181072, 0x26b41032, 0x27181072, 0x27141032, 0x27181072,
+        0x27181032, 0x27181072, 0x27361032, 0x27181072, 0x27371032, 0x27361072, 0x00004c32, 0x27371072,
+        0x26b31032, 0x27371072, 0x26b41032, 0x27371072, 0x27141032, 0x27371072, 0x27181032, 0x27371072,
+        0x27361032, 0x27371072, 0x27371032, 0x266e106e, 0x268f102e, 0x266e106e, 0x2699102e, 0x266e106e,
+        0x269a102e, 0x266e106e, 0x2714102e, 0x266e106e, 0x2722102e, 0x2674106e, 0x268f102e, 0x2674106e,
+        0x2699102e, 0x2674106e, 0x269a102e, 0x2674106e, 0x2714102e, 0x2674106e, 0x2722102e, 0x2685106e,
+        0x268f102e, 0x2685106e, 0x2699102e, 0x2685106e, 0x269a102e, 0x2685106e, 0x2714102e, 0x2685106e,
+        0x2722102e, 0x2686106e, 0x2714102e, 0x268f106e, 0x2699102e, 0x268f106e, 0x2714102e, 0x2699106e,
+        0x268f102e, 0x2699106e, 0x2714102e, 0x269a106e, 0x268f102e, 0x269a106e, 0x2714102e, 0x26c6106e,
+        0x268f102e, 0x26c6106e, 0x2699102e, 0x26c6106e, 0x269a102e, 0x26c6106e, 0x2714102e, 0x26d1106e,
+        0x2699102e, 0x26d1106e, 0x269a102e, 0x26d1106e, 0x2714102e, 0x26d2106e, 0x268f102e, 0x26d2106e,
+        0x2699102e, 0x26d2106e, 0x269a102e, 0x26d2106e, 0x2714102e, 0x26d7106e, 0x2699102e, 0x26d8106e,
+        0x2714102e, 0x26db106e, 0x268f102e, 0x26db106e, 0x2714102e, 0x26dc106e, 0x268f102e, 0x26dc106e,
+        0x2714102e, 0x26e4106e, 0x268f102e, 0x26e4106e, 0x2699102e, 0x26e4106e, 0x269a102e, 0x26e4106e,
+        0x2714102e, 0x26f0106e, 0x2699102e, 0x26f0106e, 0x2714102e, 0x26f6106e, 0x268f102e, 0x26f6106e,
+        0x2699102e, 0x26f6106e, 0x269a102e, 0x26f6106e, 0x270c102e, 0x26f6106e, 0x2714102e, 0x270c106e,
+        0x268f102e, 0x270c106e, 0x2699102e, 0x270c106e, 0x269a102e, 0x270c106e, 0x2714102e, 0x270c106e,
+        0x2722102e, 0x2714106e, 0x268f102e, 0x2714106e, 0x2699102e, 0x2714106e, 0x269a102e, 0x2714106e,
+        0x2714102e, 0x2718106e, 0x268f102e, 0x2718106e, 0x2699102e, 0x2718106e, 0x269a102e, 0x2718106e,
+        0x2714102e, 0x2718106e, 0x2722102e, 0x2722106e, 0x268f102e, 0x2722106e, 0x2714102e, 0x2722106e,
+        0x00004c2e, 0x2737106e, 0x268f102e, 0x2737106e, 0x2699102e, 0x2737106e, 0x269a102e, 0x2737106e,
+        0x2714102e, 0x2737106e, 0x2722102e, 0x266e1070, 0x27141030, 0x266e1070, 0x27221030, 0x26741070,
+        0x27141030, 0x26741070, 0x27221030, 0x26851070, 0x27141030, 0x26851070, 0x27221030, 0x26861070,
+        0x27141030, 0x26861070, 0x27221030, 0x26c61070, 0x27141030, 0x26c61070, 0x27221030, 0x26c71070,
+        0x27141030, 0x26c71070, 0x27221030, 0x26f61070, 0x270c1030, 0x26f61070, 0x27141030, 0x270c1070,
+        0x27141030, 0x27181070, 0x27141030, 0x27181070, 0x27221030, 0x27371070, 0x27141030, 0x27371070,
+        0x27221030, 0x00003b70, 0x00004030, 0x00003d70, 0x00004030, 0x00003ef0, 0x00004030, 0x26d71074,
+        0x27361034, 0x26d71074, 0x27371034, 0x26db1074, 0x27361034, 0x26db1074, 0x27371034, 0x26dc1074,
+        0x27361034, 0x26dc1074, 0x27371034, 0x26c61074, 0x27361034, 0x26c61074, 0x27371034, 0x26c71074,
+        0x27361034, 0x26c71074, 0x27371034, 0x26991074, 0x27361034, 0x26991074, 0x27371034, 0x268f1074,
+        0x27361034, 0x268f1074, 0x27371034, 0x269a1074, 0x27361034, 0x269a1074, 0x27371034, 0x26d11074,
+        0x27361034, 0x26d11074, 0x27371034, 0x26d21074, 0x27361034, 0x26d21074, 0x27371034, 0x26c71074,
+        0x268f1034, 0x26c71074, 0x26991034, 0x26c71074, 0x269a1034, 0x26c71074, 0x27141034, 0x26c71074,
+        0x26b31034, 0x26c61074, 0x26b31034, 0x26d11074, 0x26b31034, 0x26d21074, 0x26b31034, 0x26d71072,
+        0x27361032, 0x26d71072, 0x27371032, 0x26db1072, 0x27361032, 0x26db1072, 0x27371032, 0x26dc1072,
+        0x27361032, 0x26dc1072, 0x27371032, 0x26c61072, 0x27361032, 0x26c61072, 0x27371032, 0x26c71072,
+        0x27361032, 0x26c71072, 0x27371032, 0x26991072, 0x27361032, 0x26991072, 0x27371032, 0x268f1072,
+        0x27361032, 0x268f1072, 0x27371032, 0x269a1072, 0x27361032, 0x269a1072, 0x27371032, 0x26d11072,
+        0x27361032, 0x26d11072, 0x27371032, 0x26d21072, 0x27361032, 0x26d21072, 0x27371032, 0x26c71072,
+        0x268f1032, 0x26c71072, 0x26991032, 0x26c71072, 0x269a1032, 0x26c71072, 0x27141032, 0x26c71072,
+        0x26b31032, 0x26c61072, 0x26b31032, 0x26d11072, 0x26b31032, 0x26d21072, 0x26b31032, 0x26c7106e,
+        0x268f102e, 0x26c7106e, 0x2699102e, 0x26c7106e, 0x269a102e, 0x26c7106e, 0x2714102e, 0x26c6106e,
+        0x2722102e, 0x26c7106e, 0x2722102e, 0x26d7106e, 0x2714102e, 0x26c61070, 0x268f1030, 0x26c61070,
+        0x26991030, 0x26c61070, 0x269a1030, 0x26c71070, 0x268f1030, 0x26c71070, 0x26991030, 0x26c71070,
+        0x269a1030, 0x26d71070, 0x27141030, 0x26d81070, 0x27141030, 0x26721072, 0x000036b2, 0x26721074,
+        0x000036b4, 0x03921004, 0x03931004, 0x2685106e, 0x268f106e, 0x2714102e, 0x26851072, 0x26991072,
+        0x268f1032, 0x2685106e, 0x2699106e, 0x268f102e, 0x2685106e, 0x2699106e, 0x2714102e, 0x2685106e,
+        0x269a106e, 0x2714102e, 0x2685106e, 0x2714106e, 0x268f102e, 0x2685106e, 0x2714106e, 0x2699102e,
+        0x2685106e, 0x2714106e, 0x269a102e, 0x268f1072, 0x27141072, 0x26991032, 0x268f106e, 0x2714106e,
+        0x2699102e, 0x26991072, 0x27141072, 0x27371032, 0x26991072, 0x27141072, 0x27361032, 0x26c6106e,
+        0x2699106e, 0x268f102e, 0x26c6106e, 0x268f106e, 0x2699102e, 0x26c61072, 0x268f1072, 0x27361032,
+        0x26c61072, 0x27141072, 0x26991032, 0x26c6106e, 0x2714106e, 0x2699102e, 0x26c6106e, 0x2714106e,
+        0x268f102e, 0x26c61072, 0x27141072, 0x27141032, 0x26c6106e, 0x2714106e, 0x2714102e, 0x26d11072,
+        0x26991072, 0x26991032, 0x26d1106e, 0x2699106e, 0x2699102e, 0x26d11072, 0x27141072, 0x27141032,
+        0x26c71072, 0x26991072, 0x27141032, 0x26c7106e, 0x2699106e, 0x2714102e, 0x26c71072, 0x268f1072,
+        0x27371032, 0x26c71072, 0x27141072, 0x269a1032, 0x26c7106e, 0x2714106e, 0x269a102e, 0x26c71072,
+        0x27141072, 0x27141032, 0x26c7106e, 0x2714106e, 0x2714102e, 0x26d21072, 0x26991072, 0x27361032,
+        0x26d21072, 0x269a1072, 0x27141032, 0x26d2106e, 0x269a106e, 0x2714102e, 0x26d71072, 0x27141072,
+        0x26991032, 0x26d7106e, 0x2714106e, 0x2699102e, 0x26d7106e, 0x2714106e, 0x2714102e, 0x26d71072,
+        0x27141072, 0x27371032, 0x26db1072, 0x268f1072, 0x27141032, 0x26db1072, 0x27141072, 0x27141032,
+        0x26db106e, 0x2714106e, 0x2714102e, 0x26db1072, 0x27141072, 0x27361032, 0x26dc1072, 0x27141072,
+        0x27141032, 0x26dc1072, 0x27141072, 0x27371032, 0x26dc1072, 0x27141072, 0x27361032, 0x26e41072,
+        0x269a1072, 0x27141032, 0x26e4106e, 0x269a106e, 0x2714102e, 0x26f01072, 0x27141072, 0x26991032,
+        0x26f01072, 0x27141072, 0x27141032, 0x270c1072, 0x26991072, 0x27141032, 0x270c1072, 0x26991072,
+        0x27371032, 0x270c1072, 0x26991072, 0x27361032, 0x270c106e, 0x268f106e, 0x268f102e, 0x270c1072,
+        0x268f1072, 0x268f1032, 0x270c1072, 0x269a1072, 0x27141032, 0x270c106e, 0x269a106e, 0x2714102e,
+        0x270c1072, 0x27141072, 0x26991032, 0x270c106e, 0x2714106e, 0x2699102e, 0x2714106e, 0x2699106e,
+        0x268f102e, 0x2714106e, 0x2699106e, 0x2714102e, 0x27141072, 0x26991072, 0x27371032, 0x2714106e,
+        0x268f106e, 0x2699102e, 0x2714106e, 0x268f106e, 0x2714102e, 0x2714106e, 0x269a106e, 0x268f102e,
+        0x2714106e, 0x269a106e, 0x2714102e, 0x2714106e, 0x268f106e, 0x269a102e, 0x2722106e, 0x2714106e,
+        0x268f102e, 0x2722106e, 0x2714106e, 0x2714102e, 0x2718106e, 0x2699106e, 0x2714102e, 0x27181072,
+        0x26991072, 0x27361032, 0x27181072, 0x268f1072, 0x27141032, 0x2718106e, 0x268f106e, 0x2714102e,
+        0x27181072, 0x268f1072, 0x27361032, 0x27181072, 0x27141072, 0x27371032, 0x27181072, 0x27141072,
+        0x27361032, 0x27371072, 0x27141072, 0x27141032, 0x2737106e, 0x2714106e, 0x2714102e, 0x26741072,
+        0x269a1072, 0x27371032, 0x26851072, 0x268f1072, 0x27371032, 0x26851072, 0x268f1072, 0x27361032,
+        0x26851072, 0x269a1072, 0x27371032, 0x26851072, 0x269a1072, 0x27361032, 0x26851072, 0x27141072,
+        0x27371032, 0x26851072, 0x27141072, 0x27361032, 0x268f1072, 0x27141072, 0x27371032, 0x268f1072,
+        0x26991072, 0x27361032, 0x268f1072, 0x27141072, 0x27361032, 0x26c61072, 0x269a1072, 0x27361032,
+        0x26d11072, 0x26991072, 0x27371032, 0x26c71072, 0x26991072, 0x27371032, 0x26d21072, 0x26991072,
+        0x27371032, 0x270c1072, 0x268f1072, 0x27371032, 0x270c1072, 0x27141072, 0x27371032, 0x27371072,
+        0x26991072, 0x27371032, 0x27371072, 0x268f1072, 0x27371032, 0x27371072, 0x27141072, 0x27371032,
+        0x27141072, 0x27141072, 0x27371032, 0x26f01072, 0x27141072, 0x27371032, 0x27181072, 0x26991072,
+        0x27371032, 0x26f0106e, 0x2714106e, 0x2699102e, 0x270c106e, 0x2699106e, 0x2714102e, 0x26db1072,
+        0x27141072, 0x27371032, 0x26f61072, 0x27141072, 0x27371032, 0x2718106e, 0x268f106e, 0x2699102e,
+        0x27141072, 0x269a1072, 0x27371032, 0x270c106e, 0x268f106e, 0x2714102e, 0x26f61072, 0x27141072,
+        0x27141032, 0x270c1072, 0x268f1072, 0x27141032, 0x27181072, 0x268f1072, 0x26991032, 0x268f1072,
+        0x26991072, 0x27371032, 0x26991072, 0x268f1072, 0x27371032, 0x27141072, 0x268f1072, 0x27371032,
+        0x26e41072, 0x27141072, 0x27371032, 0x26741072, 0x26991072, 0x27371032, 0x26f6106e, 0x2714106e,
+        0x2714102e, 0x26db106e, 0x268f106e, 0x2714102e, 0x26d1106e, 0x2714106e, 0x2714102e, 0x26c61072,
+        0x269a1072, 0x27371032, 0x27181072, 0x268f1072, 0x27371032, 0x26d11074, 0x270c1074, 0x27451034,
+        0x26f01074, 0x270c1074, 0x27451034, 0x26721074, 0x270c1074, 0x270c1074, 0x27221034, 0x26721074,
+        0x26f61074, 0x26741074, 0x26b31034, 0x27141074, 0x26991074, 0x27141074, 0x26a41034, 0x26d11074,
+        0x270c1074, 0x26db1074, 0x27141034, 0x26b31074, 0x26c61074, 0x27281074, 0x270c1034, 0x26db1074,
+        0x270c1074, 0x27371074, 0x27221034, 0x27281074, 0x26c61074, 0x270c1074, 0x27141034, 0x26d11074,
+        0x270c1074, 0x27361034, 0x26d11074, 0x270c1074, 0x27361074, 0x02091074, 0x26721074, 0x270c1074,
+        0x270c1074, 0x27221074, 0x02091074, 0x26db1074, 0x270c1074, 0x27371074, 0x27221074, 0x02091074,
+        0x27281074, 0x26c61074, 0x270c1074, 0x27141034, 0x268f1074, 0x270c1074, 0x02091074, 0x268f1074,
+        0x270c1074, 0x26721074, 0x270c1074, 0x27221034, 0x26b31074, 0x27381074, 0x26721074, 0x270c1034,
+        0x05351004, 0x0223102c, 0x0236102c, 0x0292102c, 0x0240102c, 0x023a102c, 0x0267102c, 0x026d102c,
+        0x038c102c, 0x038d102c, 0x027e106c, 0x027e106c, 0x027e102c, 0x027e106c, 0x027e102c, 0x0216102c,
+        0x0215102c, 0x020b102c, 0x0328102c, 0x0329102c, 0x032c102c, 0x032d102c, 0x038a102c, 0x038b102c,
+        0x0388102c, 0x0389102c, 0x0382102c, 0x0383102c, 0x0380102c, 0x0381102c, 0x0384102c, 0x0385102c,
+        0x0386102c, 0x0387102c, 0x02371004, 0x02381004, 0x032a102c, 0x032b102c, 0x020a1008, 0x020b1008,
+        0x0223101e, 0x0236101e, 0x027e101e, 0x023a101e, 0x0240101e, 0x026d101e, 0x0267101e, 0x0216101e,
+        0x0328101e, 0x0329101e, 0x032c101e, 0x032d101e, 0x038a101e, 0x038b101e, 0x03ac101e, 0x03a9101e,
+        0x03a1101e, 0x0666101e, 0x020d101e, 0x066a101e, 0x066c101e, 0x066b101e, 0x03a7101e, 0x1f64101e,
+        0x03ad101e, 0x03a0101e, 0x000036b4, 0x000036b0, 0x00003834, 0x000039b4, 0x00003b34, 0x00003b30,
+        0x00003d34, 0x00003d30, 0x00003eb4, 0x00003eb0, 0x00004034, 0x00004030, 0x000040b4, 0x000040b0,
+        0x26641034, 0x26651034, 0x26651032, 0x26661034, 0x26661032, 0x26691034, 0x26691032, 0x266a1034,
+        0x266a1032, 0x266e1034, 0x266e1032, 0x266e102e, 0x266e1030, 0x26721034, 0x26721032, 0x26741034,
+        0x26741032, 0x2674102e, 0x26741030, 0x26841034, 0x26841032, 0x26851034, 0x26851032, 0x2685102e,
+        0x26851030, 0x26861034, 0x26861032, 0x2686102e, 0x26861030, 0x268f1034, 0x268f1032, 0x268f102e,
+        0x268f1030, 0x26991034, 0x26991032, 0x2699102e, 0x26991030, 0x269a1034, 0x269a1032, 0x269a102e,
+        0x269a1030, 0x26a41034, 0x26a41032, 0x26a51034, 0x26a51032, 0x26b31034, 0x26b31032, 0x26b41034,
+        0x26b41032, 0x26c61034, 0x26c61032, 0x26c6102e, 0x26c61030, 0x26c71034, 0x26c71032, 0x26c7102e,
+        0x26c71030, 0x26d11034, 0x26d11032, 0x26d1102e, 0x26d11030, 0x26d21034, 0x26d21032, 0x26d2102e,
+        0x26d21030, 0x26d71034, 0x26d71032, 0x26d7102e, 0x26d71030, 0x26d81034, 0x26d81032, 0x26d8102e,
+        0x26d81030, 0x26db1034, 0x26db1032, 0x26db102e, 0x26db1030, 0x26dc1034, 0x26dc1032, 0x26dc102e,
+        0x26dc1030, 0x26e41034, 0x26e41032, 0x26e4102e, 0x26e41030, 0x26f01034, 0x26f01032, 0x26f0102e,
+        0x26f01030, 0x26f61034, 0x26f61032, 0x26f6102e, 0x26f61030, 0x270c1034, 0x270c1032, 0x270c102e,
+        0x270c1030, 0x27141034, 0x27141032, 0x2714102e, 0x27141030, 0x27181034, 0x27181032, 0x2718102e,
+        0x27181030, 0x27221034, 0x27221032, 0x2722102e, 0x27221030, 0x27281034, 0x27281032, 0x27361034,
+        0x27361032, 0x27371034, 0x27371032, 0x2737102e, 0x27371030, 0x270c1074, 0x26651034, 0x270c1072,
+        0x26651032, 0x270c1074, 0x26661034, 0x270c1072, 0x26661032, 0x270c1074, 0x266a1034, 0x270c1072,
+        0x266a1032, 0x270c1074, 0x26721034, 0x270c1072, 0x26721032, 0x02671006, 0x031d1006, 0x03ac1006,
+        0x1f641006, 0x03ad1006, 0x03a91006, 0x03161006, 0x03281006, 0x03291006, 0x03a11006, 0x06661006,
+        0x02231006, 0x020d1006, 0x027e1006, 0x03a61006, 0x1f981006, 0x1f991006, 0x1f9a1006, 0x1f9b1006,
+        0x1f9c1006, 0x1f9d1006, 0x1f9e1006, 0x1f9f1006, 0x1fa01006, 0x1fa11006, 0x02401006, 0x023a1006,
+        0x066a1006, 0x066b1006, 0x066c1006, 0x026d1006, 0x03a01006, 0x1fa21012, 0x1fbc1012, 0x1fd61012,
+        0x1feb1012, 0x20071012, 0x20421012, 0x20511012, 0x20751012, 0x20901012, 0x20ab1012, 0x20c41012,
+        0x20d61012, 0x21091012, 0x21181012, 0x213c1012, 0x216b1012, 0x21801012, 0x21931012, 0x21d21012,
+        0x21f71012, 0x22171012, 0x22471012, 0x22591012, 0x22641012, 0x22701012, 0x22861012, 0x032a1006,
+        0x03a71006, 0x032b1006, 0x04b71006, 0x020b1006, 0x04b41006, 0x1fa21006, 0x1fbc1006, 0x1fd61006,
+        0x1feb1006, 0x20071006, 0x20421006, 0x20511006, 0x20751006, 0x20901006, 0x20ab1006, 0x20c41006,
+        0x20d61006, 0x21091006, 0x21181006, 0x213c1006, 0x216b1006, 0x21801006, 0x21931006, 0x21d21006,
+        0x21f71006, 0x22171006, 0x22471006, 0x22591006, 0x22641006, 0x22701006, 0x22861006, 0x032c1006,
+        0x066e1006, 0x032d1006, 0x06701006, 0x033e1006, 0x033f1006, 0x02921024, 0x03841024, 0x03851024,
+        0x02361024, 0x02211024, 0x43091024, 0x42da1020, 0x42db1020, 0x42dc1020, 0x42de1020, 0x42df1020,
+        0x42fe1020, 0x42ff1020, 0x43001020, 0x42ec1020, 0x1f601024, 0x42da1024, 0x42db1024, 0x42dc1024,
+        0x42de1024, 0x42df1024, 0x42e01024, 0x42e11024, 0x42e21024, 0x42e31024, 0x42e41024, 0x42e51024,
+        0x42e61024, 0x42e71024, 0x42e81024, 0x42e91024, 0x42ea1024, 0x42eb1024, 0x42ec1024, 0x42ed1024,
+        0x42ee1024, 0x42ef1024, 0x42f01024, 0x42f11024, 0x42f21024, 0x42f31024, 0x42f41024, 0x42f51024,
+        0x42f61024, 0x42f71024, 0x42f81024, 0x42f91024, 0x42fa1024, 0x42fb1024, 0x42fc1024, 0x42fd1024,
+        0x42fe1024, 0x42ff1024, 0x43001024, 0x43011024, 0x43021024, 0x43031024, 0x43041024, 0x43051024,
+        0x43061024, 0x430a1024, 0x00001ba4, 0x00001c24, 0x41f21024, 0x41751024, 0x41761024, 0x42531024,
+        0x41771024, 0x42551024, 0x42561024, 0x41781024, 0x41791024, 0x417a1024, 0x42591024, 0x425a1024,
+        0x425b1024, 0x425c1024, 0x425d1024, 0x425e1024, 0x418f1024, 0x417b1024, 0x417c1024, 0x417d1024,
+        0x41961024, 0x417e1024, 0x417f1024, 0x41801024, 0x41811024, 0x41821024, 0x41831024, 0x41841024,
+        0x41851024, 0x41861024, 0x41871024, 0x41f31024, 0x41f41024, 0x41f51024, 0x41f61024, 0x41f71024,
+        0x41f81024, 0x41f91024, 0x41fa1024, 0x41fb1024, 0x41fc1024, 0x41fd1024, 0x41fe1024, 0x41ff1024,
+        0x42001024, 0x42011024, 0x42021024, 0x42031024, 0x42041024, 0x42051024, 0x42061024, 0x42071024,
+        0x1f631006, 0x1f651006, 0x066d1006, 0x04b81006, 0x066f1006, 0x1f661006, 0x1f801006, 0x086b1024,
+        0x05ec1024, 0x05ee1024, 0x05ed1024, 0x05ef1024, 0x09091024, 0x09341024, 0x1d551004, 0xfffd1004,
+        0x4cfc1004, 0x4cfd1004, 0x4cfe1004, 0x4cff1004, 0x4d001004, 0x4d011004, 0x4d021004, 0x4d031004,
+        0x4d041004, 0x4d051004, 0x4d061004, 0x4d071004, 0x4d081004, 0x4d091004, 0x4d0a1004, 0x4d0b1004,
+        0x4d0c1004, 0x4d0d1004, 0x4d0e1004, 0x4d0f1004, 0x4d101004, 0x4d111004, 0x4d121004, 0x4d131004,
+        0x4d141004, 0x4d151004, 0x4d161004, 0x4d171004, 0x4d181004, 0x4d191004, 0x4d1a1004, 0x4d1b1004,
+        0x4d1c1004, 0x4d1d1004, 0x4d1e1004, 0x4d1f1004, 0x4d201004, 0x4d211004, 0x4d221004, 0x4d231004,
+        0x4d241004, 0x4d251004, 0x4d261004, 0x4d271004, 0x4d281004, 0x4d291004, 0x4d2a1004, 0x4d2b1004,
+        0x4d2c1004, 0x4d2d1004, 0x4d2e1004, 0x4d2f1004, 0x4d301004, 0x4d311004, 0x4d321004, 0x4d331004,
+        0x4d341004, 0x4d351004, 0x4d361004, 0x4d371004, 0x4d381004, 0x4d391004, 0x4d3a1004, 0x4d3b1004,
+        0x4d3c1004, 0x4d3d1004, 0x4d3e1004, 0x4d3f1004, 0x4d401004, 0x4d411004, 0x4d421004, 0x4d431004,
+        0x4d441004, 0x4d451004, 0x4d461004, 0x4d471004, 0x4d481004, 0x4d491004, 0x4d4a1004, 0x4d4b1004,
+        0x4d4c1004, 0x4d4d1004, 0x4d4e1004, 0x4d4f1004, 0x4d501004, 0x4d511004, 0x4d521004, 0x4d531004,
+        0x4d541004, 0x4d551004, 0x4d561004, 0x4d571004, 0x4d581004, 0x4d591004, 0x4d5a1004, 0x4d5b1004,
+        0x4d5c1004, 0x4d5d1004, 0x4d5e1004, 0x4d5f1004, 0x4d601004, 0x4d611004, 0x4d621004, 0x4d631004,
+        0x4d641004, 0x4d651004, 0x4d661004, 0x4d671004, 0x4d681004, 0x4d691004, 0x4d6a1004, 0x4d6b1004,
+        0x4d6c1004, 0x4d6d1004, 0x4d6e1004, 0x4d6f1004, 0x4d701004, 0x4d711004, 0x4d721004, 0x4d731004,
+        0x4d741004, 0x4d751004, 0x4d761004, 0x4d771004, 0x4d781004, 0x4d791004, 0x4d7a1004, 0x4d7b1004,
+        0x4d7c1004, 0x4d7d1004, 0x4d7e1004, 0x4d7f1004, 0x4d801004, 0x4d811004, 0x4d821004, 0x4d831004,
+        0x4d841004, 0x4d851004, 0x4d861004, 0x4d871004, 0x4d881004, 0x4d891004, 0x4d8a1004, 0x4d8b1004,
+        0x4d8c1004, 0x4d8d1004, 0x4d8e1004, 0x4d8f1004, 0x4d901004, 0x4d911004, 0x4d921004, 0x4d931004,
+        0x4d941004, 0x4d951004, 0x4d961004, 0x4d971004, 0x4d981004, 0x4d991004, 0x4d9a1004, 0x4d9b1004,
+        0x4d9c1004, 0x4d9d1004, 0x4d9e1004, 0x4d9f1004, 0x4da01004, 0x4da11004, 0x4da21004, 0x4da31004,
+        0x4da41004, 0x4da51004, 0x4da61004, 0x4da71004, 0x4da81004, 0x4da91004, 0x4daa1004, 0x4dab1004,
+        0x4dac1004, 0x4dad1004, 0x4dae1004, 0x4daf1004, 0x4db01004, 0x4db11004, 0x4db21004, 0x4db31004,
+        0x4db41004, 0x4db51004, 0x4db61004, 0x4db71004, 0x4db81004, 0x4db91004, 0x4dba1004, 0x4dbb1004,
+        0x4dbc1004, 0x4dbd1004, 0x4dbe1004, 0x4dbf1004, 0x4dc01004, 0x4dc11004, 0x4dc21004, 0x4dc31004,
+        0x4dc41004, 0x4dc51004, 0x4dc61004, 0x4dc71004, 0x4dc81004, 0x4dc91004, 0x4dca1004, 0x4dcb1004,
+        0x4dcc1004, 0x4dcd1004, 0x4dce1004, 0x030b1004, 0x030c1004, 0x030d1004, 0x1dbe1004, 0x1dbf1004,
+        0x1dc01004, 0x1dc11004, 0x1dc21004, 0x1dc31004, 0x1dc41004, 0x1dc51004, 0x1dc61004, 0x1dc71004,
+        0x1dc81004, 0x1dc91004, 0x1dca1004, 0x1dcb1004, 0x1dcc1004, 0x1dcd1004, 0x1dce1004, 0x1dcf1004,
+        0x1dd01004, 0x1dd11004, 0x1dd21004, 0x1dd31004, 0x1dd41004, 0x1dd51004, 0x1dd61004, 0x1dd71004,
+        0x1dd81004, 0x1dd91004, 0x1dda1004, 0x1ddb1004, 0x1ddc1004, 0x1ddd1004, 0x1dde1004, 0x1ddf1004,
+        0x1de01004, 0x1de11004, 0x10c41004, 0x10c51004, 0x10c61004, 0x10c71004, 0x10c81004, 0x10c91004,
+        0x10ca1004, 0x10cb1004, 0x10cc1004, 0x1de21004, 0x1de31004, 0x1de41004, 0x1de51004, 0x1de61004,
+        0x1de71004, 0x1de81004, 0x1de91004, 0x1dea1004, 0x1deb1004, 0x1dec1004, 0x1ded1004, 0x1dee1004,
+        0x1def1004, 0x1df01004, 0x1df11004, 0x1df21004, 0x1df31004, 0x1df41004, 0x1df51004, 0x1df61004,
+        0x1df71004, 0x1df81004, 0x1df91004, 0x1dfa1004, 0x1dfb1004, 0x1dfc1004, 0x1dfd1004, 0x1dfe1004,
+        0x1dff1004, 0x1e001004, 0x1e011004, 0x1e021004, 0x1e031004, 0x1e041004, 0x1e051004, 0x1e061004,
+        0x1e071004, 0x1e081004, 0x1e091004, 0x1e0a1004, 0x1e0b1004, 0x1e0c1004, 0x1e0d1004, 0x10cd1004,
+        0x10ce1004, 0x10cf1004, 0x10d01004, 0x10d11004, 0x10d21004, 0x10d31004, 0x10d41004, 0x10d51004,
+        0x10d61004, 0x10d71004, 0x10d81004, 0x10d91004, 0x10da1004, 0x10db1004, 0x10dc1004, 0x10dd1004,
+        0x1e0e1004, 0x10de1004, 0x10df1004, 0x10e01004, 0x10e11004, 0x10e21004, 0x10e31004, 0x10e41004,
+        0x10e51004, 0x10e61004, 0x10e71004, 0x10e81004, 0x10e91004, 0x10ea1004, 0x10eb1004, 0x10ec1004,
+        0x10ed1004, 0x10ee1004, 0x10ef1004, 0x10f01004, 0x10f11004, 0x10f21004, 0x10f31004, 0x10f41004,
+        0x10f51004, 0x10f61004, 0x10f71004, 0x10f81004, 0x10f91004, 0x10fa1004, 0x10fb1004, 0x10fc1004,
+        0x10fd1004, 0x10fe1004, 0x10ff1004, 0x11001004, 0x11011004, 0x11021004, 0x11031004, 0x11041004,
+        0x11051004, 0x11061004, 0x11071004, 0x11081004, 0x11091004, 0x110a1004, 0x110b1004, 0x110c1004,
+        0x110d1004, 0x110e1004, 0x110f1004, 0x11101004, 0x11111004, 0x11121004, 0x11131004, 0x11141004,
+        0x11151004, 0x11161004, 0x11171004, 0x11181004, 0x11191004, 0x111a1004, 0x111b1004, 0x00008b84,
+        0x4ac11004, 0x4ac21004, 0x4ac31004, 0x4ac41004, 0x4ac51004, 0x4ac61004, 0x4ac71004, 0x4ac81004,
+        0x4ac91004, 0x4aca1004, 0x4acb1004, 0x4acc1004, 0x4acd1004, 0x4ace1004, 0x4acf1004, 0x4ad01004,
+        0x4ad11004, 0x4ad21004, 0x4ad31004, 0x4ad41004, 0x4ad51004, 0x4ad61004, 0x4ad71004, 0x4ad81004,
+        0x4ad91004, 0x4ada1004, 0x4adb1004, 0x4adc1004, 0x4add1004, 0x4ade1004, 0x4adf1004, 0x4ae01004,
+        0x4ae11004, 0x4ae21004, 0x4ae31004, 0x4ae41004, 0x4ae51004, 0x4ae61004, 0x4ae71004, 0x4ae81004,
+        0x4ae91004, 0x4aea1004, 0x4aeb1004, 0x4aec1004, 0x4aed1004, 0x4aee1004, 0x4aef1004, 0x4af01004,
+        0x4af11004, 0x4af21004, 0x4af31004, 0x4af41004, 0x4af51004, 0x4af61004, 0x4af71004, 0x4af81004,
+        0x4af91004, 0x4afa1004, 0x4afb1004, 0x4afc1004, 0x4afd1004, 0x4afe1004, 0x4aff1004, 0x4b001004,
+        0x4b011004, 0x4b021004, 0x4b031004, 0x4b041004, 0x4b051004, 0x4b061004, 0x4b071004, 0x4b081004,
+        0x4b091004, 0x4b0a1004, 0x4b0b1004, 0x4b0c1004, 0x4b0d1004, 0x4b0e1004, 0x1e0f1004, 0x1e101004,
+        0x1e111004, 0x1e121004, 0x1e131004, 0x1e141004, 0x1e151004, 0x1e161004, 0x1e171004, 0x1e181004,
+        0x1e191004, 0x1e1a1004, 0x1e1b1004, 0x1e1c1004, 0x1e1d1004, 0x1e1e1004, 0x1e1f1004, 0x1e201004,
+        0x4b291004, 0x4b2a1004, 0x4b2b1004, 0x4b2c1004, 0x4b2d1004, 0x4b2e1004, 0x4b2f1004, 0x4b301004,
+        0x4b311004, 0x4b321004, 0x4b331004, 0x4b341004, 0x4b351004, 0x4b361004, 0x4b371004, 0x4b391004,
+        0x4b3a1004, 0x4b3b1004, 0x4b3c1004, 0x4b3d1004, 0x4b3e1004, 0x4b3f1004, 0x4b401004, 0x4b411004,
+        0x4b421004, 0x4b431004, 0x4b441004, 0x4b451004, 0x4b461004, 0x4b471004, 0x4b481004, 0x4b381004,
+        0x1db81004, 0x1db91004, 0x4b491004, 0x4b4a1004, 0x4b4b1004, 0x4b4c1004, 0x4b4d1004, 0x4b4e1004,
+        0x4b4f1004, 0x4b501004, 0x4b511004, 0x4b521004, 0x4b531004, 0x4b541004, 0x4b551004, 0x4b561004,
+        0x4b571004, 0x4b581004, 0x4b591004, 0x4b5a1004, 0x4b5b1004, 0x4b5c1004, 0x4b5d1004, 0x4b5e1004,
+        0x4b5f1004, 0x4b601004, 0x4b611004, 0x4b621004, 0x4b631004, 0x4b641004, 0x4b651004, 0x4b661004,
+        0x25791004, 0x257a1004, 0x257b1004, 0x257c1004, 0x257d1004, 0x257e1004, 0x257f1004, 0x25801004,
+        0x25811004, 0x25821004, 0x25831004, 0x25841004, 0x25851004, 0x25861004, 0x25871004, 0x25881004,
+        0x25891004, 0x258a1004, 0x258b1004, 0x258c1004, 0x258d1004, 0x258e1004, 0x258f1004, 0x25901004,
+        0x25911004, 0x25921004, 0x25931004, 0x25941004, 0x25951004, 0x25961004, 0x25971004, 0x25981004,
+        0x25991004, 0x259a1004, 0x259b1004, 0x259c1004, 0x259d1004, 0x259e1004, 0x25791008, 0x257c1008,
+        0x25801008, 0x25861008, 0x258a1008, 0x50ff1004, 0x51001004, 0x51011004, 0x51021004, 0x51031004,
+        0x51041004, 0x51051004, 0x51061004, 0x51071004, 0x51081004, 0x51091004, 0x510a1004, 0x510b1004,
+        0x510c1004, 0x510d1004, 0x510e1004, 0x510f1004, 0x51101004, 0x51111004, 0x51121004, 0x51131004,
+        0x51141004, 0x51151004, 0x51161004, 0x51171004, 0x51181004, 0x51191004, 0x511a1004, 0x511b1004,
+        0x511c1004, 0x030e1004, 0x511d1004, 0x511e1004, 0x511f1004, 0x51201004, 0x51211004, 0x51221004,
+        0x51231004, 0x51241004, 0x51251004, 0x51261004, 0x51271004, 0x51281004, 0x51291004, 0x512a1004,
+        0x512b1004, 0x512c1004, 0x512d1004, 0x512e1004, 0x512f1004, 0x51301004, 0x51311004, 0x51321004,
+        0x51331004, 0x51341004, 0x51351004, 0x51361004, 0x51371004, 0x51381004, 0x51391004, 0x513a1004,
+        0x513b1004, 0x513c1004, 0x513d1004, 0x513e1004, 0x513f1004, 0x51401004, 0x51411004, 0x51421004,
+        0x51431004, 0x51441004, 0x51451004, 0x51461004, 0x51471004, 0x51481004, 0x030f1004, 0x1e211004,
+        0x1e221004, 0x1e231004, 0x4b671010, 0x4b681010, 0x4b691010, 0x4b6a1010, 0x4b6b1010, 0x4b6c1010,
+        0x4b6d1010, 0x4b6e1010, 0x4b6f1010, 0x4b701010, 0x4b711010, 0x4b721010, 0x4b731010, 0x4b741010,
+        0x4b751010, 0x4b761010, 0x4b771010, 0x4b781010, 0x4b791010, 0x4b7a1010, 0x4b7b1010, 0x4b7c1010,
+        0x4b7d1010, 0x4b7e1010, 0x4b7f1010, 0x4b801010, 0x4b811010, 0x4b821010, 0x4b831010, 0x4b841010,
+        0x4b851010, 0x4b861010, 0x4b871010, 0x4b881010, 0x4b891010, 0x4b8a1010, 0x4b8b1010, 0x4b8c1010,
+        0x4b8d1010, 0x4b8e1010, 0x4b671004, 0x4b681004, 0x4b691004, 0x4b6a1004, 0x4b6b1004, 0x4b6c1004,
+        0x4b6d1004, 0x4b6e1004, 0x4b6f1004, 0x4b701004, 0x4b711004, 0x4b721004, 0x4b731004, 0x4b741004,
+        0x4b751004, 0x4b761004, 0x4b771004, 0x4b781004, 0x4b791004, 0x4b7a1004, 0x4b7b1004, 0x4b7c1004,
+        0x4b7d1004, 0x4b7e1004, 0x4b7f1004, 0x4b801004, 0x4b811004, 0x4b821004, 0x4b831004, 0x4b841004,
+        0x4b851004, 0x4b861004, 0x4b871004, 0x4b881004, 0x4b891004, 0x4b8a1004, 0x4b8b1004, 0x4b8c1004,
+        0x4b8d1004, 0x4b8e1004, 0x4b8f1004, 0x4b901004, 0x4b911004, 0x4b921004, 0x4b931004, 0x4b941004,
+        0x4b951004, 0x4b961004, 0x4b971004, 0x4b981004, 0x4b991004, 0x4b9a1004, 0x4b9b1004, 0x4b9c1004,
+        0x4b9d1004, 0x4b9e1004, 0x4b9f1004, 0x4ba01004, 0x4ba11004, 0x4ba21004, 0x4ba31004, 0x4ba41004,
+        0x4ba51004, 0x4ba61004, 0x4ba71004, 0x4ba81004, 0x4ba91004, 0x4baa1004, 0x4bab1004, 0x4bac1004,
+        0x4bad1004, 0x4bae1004, 0x4baf1004, 0x4bb01004, 0x4bb11004, 0x4bb21004, 0x4bb31004, 0x4bb41004,
+        0x4bb51004, 0x4bb61004, 0x4bb71004, 0x4bb81004, 0x4bb91004, 0x4bba1004, 0x4bbb1004, 0x4bbc1004,
+        0x4bbd1004, 0x4bbe1004, 0x4c4a1004, 0x4c4b1004, 0x4c4c1004, 0x4c4d1004, 0x4c4e1004, 0x4c4f1004,
+        0x4c501004, 0x4c511004, 0x4c521004, 0x4c531004, 0x4c541004, 0x4c551004, 0x4c561004, 0x4c571004,
+        0x4c581004, 0x4c591004, 0x4c5a1004, 0x4c5b1004, 0x4c5c1004, 0x4c5d1004, 0x4c5e1004, 0x4c5f1004,
+        0x4c601004, 0x4c611004, 0x4c621004, 0x4c631004, 0x4c641004, 0x4c651004, 0x4c661004, 0x4c671004,
+        0x39341010, 0x39351010, 0x39361010, 0x39371010, 0x39381010, 0x39391010, 0x393a1010, 0x393b1010,
+        0x393c1010, 0x393d1010, 0x393e1010, 0x393f1010, 0x39401010, 0x39411010, 0x39421010, 0x39431010,
+        0x39441010, 0x39451010, 0x39461010, 0x39471010, 0x39481010, 0x39491010, 0x394a1010, 0x394b1010,
+        0x394c1010, 0x394d1010, 0x394e1010, 0x394f1010, 0x39501010, 0x39511010, 0x39521010, 0x39531010,
+        0x39541010, 0x39551010, 0x39561010, 0x39571010, 0x39341004, 0x39351004, 0x39361004, 0x39371004,
+        0x39381004, 0x39391004, 0x393a1004, 0x393b1004, 0x393c1004, 0x393d1004, 0x393e1004, 0x393f1004,
+        0x39401004, 0x39411004, 0x39421004, 0x39431004, 0x39441004, 0x39451004, 0x39461004, 0x39471004,
+        0x39481004, 0x39491004, 0x394a1004, 0x394b1004, 0x394c1004, 0x394d1004, 0x394e1004, 0x394f1004,
+        0x39501004, 0x39511004, 0x39521004, 0x39531004, 0x39541004, 0x39551004, 0x39561004, 0x39571004,
+        0x4c681004, 0x4c691004, 0x4c6a1004, 0x4c6b1004, 0x4c6c1004, 0x4c6d1004, 0x4c6e1004, 0x4c6f1004,
+        0x4c701004, 0x4c711004, 0x4c721004, 0x4c731004, 0x4c741004, 0x4c751004, 0x4c761004, 0x4c771004,
+        0x4c781004, 0x4c791004, 0x4c7a1004, 0x4c7b1004, 0x4c7c1004, 0x4c7d1004, 0x4c7e1004, 0x4c7f1004,
+        0x4c801004, 0x4c811004, 0x4c821004, 0x4c831004, 0x4c841004, 0x4c851004, 0x4c861004, 0x4c871004,
+        0x4c881004, 0x4c891004, 0x4c8a1004, 0x4c8b1004, 0x4c8c1004, 0x4c8d1004, 0x4c8e1004, 0x4c8f1004,
+        0x4c901004, 0x4c911004, 0x4c921004, 0x4c931004, 0x4c941004, 0x4c951004, 0x4c961004, 0x4c971004,
+        0x4c981004, 0x4c991004, 0x4c9a1004, 0x4c9b1004, 0x4c9c1004, 0x4c9d1004, 0x4c9e1004, 0x4c9f1004,
+        0x4ca01004, 0x4ca11004, 0x4ca21004, 0x4ca31004, 0x4ca41004, 0x4ca51004, 0x4ca61004, 0x4ca71004,
+        0x4ca81004, 0x4ca91004, 0x4caa1004, 0x4cab1004, 0x4cac1004, 0x4cad1004, 0x4cae1004, 0x4caf1004,
+        0x4cb01004, 0x4cb11004, 0x4cb21004, 0x4cb31004, 0x4cb41004, 0x4cb51004, 0x4cb61004, 0x4cb71004,
+        0x4cb81004, 0x4cb91004, 0x4cba1004, 0x4cbb1004, 0x4cbc1004, 0x4cbd1004, 0x4cbe1004, 0x4cbf1004,
+        0x4cc01004, 0x4cc11004, 0x4cc21004, 0x4cc31004, 0x045e1004, 0x4dcf1004, 0x4dd01004, 0x4dd11004,
+        0x4dd21004, 0x4dd31004, 0x4dd41004, 0x4dd51004, 0x4dd61004, 0x4dd71004, 0x4dd81004, 0x4dd91004,
+        0x4dda1004, 0x4ddb1004, 0x4ddc1004, 0x4ddd1004, 0x4dde1004, 0x4ddf1004, 0x4de01004, 0x4de11004,
+        0x4de21004, 0x4de31004, 0x4de41004, 0x4de51004, 0x4de61004, 0x4de71004, 0x4de81004, 0x4de91004,
+        0x4dea1004, 0x4deb1004, 0x4dec1004, 0x4ded1004, 0x4dee1004, 0x4def1004, 0x4df01004, 0x4df11004,
+        0x4df21004, 0x4df31004, 0x4df41004, 0x4df51004, 0x4df61004, 0x4df71004, 0x4df81004, 0x4df91004,
+        0x4dfa1004, 0x4dfb1004, 0x4dfc1004, 0x4dfd1004, 0x4dfe1004, 0x4dff1004, 0x4e001004, 0x4e011004,
+        0x4e021004, 0x4e031004, 0x4e041004, 0x4e051004, 0x4e061004, 0x4e071004, 0x4e081004, 0x4e091004,
+        0x4e0a1004, 0x4e0b1004, 0x4e0c1004, 0x4e0d1004, 0x4e0e1004, 0x4e0f1004, 0x4e101004, 0x4e111004,
+        0x4e121004, 0x4e131004, 0x4e141004, 0x4e151004, 0x4e161004, 0x4e171004, 0x4e181004, 0x4e191004,
+        0x4e1a1004, 0x4e1b1004, 0x4e1c1004, 0x4e1d1004, 0x4e1e1004, 0x4e1f1004, 0x4e201004, 0x4e211004,
+        0x4e221004, 0x4e231004, 0x4e241004, 0x4e251004, 0x4e261004, 0x4e271004, 0x4e281004, 0x4e291004,
+        0x4e2a1004, 0x4e2b1004, 0x4e2c1004, 0x4e2d1004, 0x4e2e1004, 0x4e2f1004, 0x4e301004, 0x4e311004,
+        0x4e321004, 0x4e331004, 0x4e341004, 0x4e351004, 0x4e361004, 0x4e371004, 0x4e381004, 0x4e391004,
+        0x4e3a1004, 0x4e3b1004, 0x4e3c1004, 0x4e3d1004, 0x4e3e1004, 0x4e3f1004, 0x4e401004, 0x4e411004,
+        0x4e421004, 0x4e431004, 0x4e441004, 0x4e451004, 0x4e461004, 0x4e471004, 0x4e481004, 0x4e491004,
+        0x4e4a1004, 0x4e4b1004, 0x4e4c1004, 0x4e4d1004, 0x4e4e1004, 0x4e4f1004, 0x4e501004, 0x4e511004,
+        0x4e521004, 0x4e531004, 0x4e541004, 0x4e551004, 0x4e561004, 0x4e571004, 0x4e581004, 0x4e591004,
+        0x4e5a1004, 0x4e5b1004, 0x4e5c1004, 0x4e5d1004, 0x4e5e1004, 0x4e5f1004, 0x4e601004, 0x4e611004,
+        0x4e621004, 0x4e631004, 0x4e641004, 0x4e651004, 0x4e661004, 0x4e671004, 0x4e681004, 0x4e691004,
+        0x4e6a1004, 0x4e6b1004, 0x4e6c1004, 0x4e6d1004, 0x4e6e1004, 0x4e6f1004, 0x4e701004, 0x4e711004,
+        0x4e721004, 0x4e731004, 0x4e741004, 0x4e751004, 0x4e761004, 0x4e771004, 0x4e781004, 0x4e791004,
+        0x4e7a1004, 0x4e7b1004, 0x4e7c1004, 0x4e7d1004, 0x4e7e1004, 0x4e7f1004, 0x4e801004, 0x4e811004,
+        0x4e821004, 0x4e831004, 0x4e841004, 0x4e851004, 0x4e861004, 0x4e871004, 0x4e881004, 0x4e891004,
+        0x4e8a1004, 0x4e8b1004, 0x4e8c1004, 0x4e8d1004, 0x4e8e1004, 0x4e8f1004, 0x4e901004, 0x4e911004,
+        0x4e921004, 0x4e931004, 0x4e941004, 0x4e951004, 0x4e961004, 0x4e971004, 0x4e981004, 0x4e991004,
+        0x4e9a1004, 0x4e9b1004, 0x4e9c1004, 0x4e9d1004, 0x4e9e1004, 0x4e9f1004, 0x4ea01004, 0x4ea11004,
+        0x4ea21004, 0x4ea31004, 0x4ea41004, 0x4ea51004, 0x4ea61004, 0x4ea71004, 0x4ea81004, 0x4ea91004,
+        0x4eaa1004, 0x4eab1004, 0x4eac1004, 0x4ead1004, 0x4eae1004, 0x4eaf1004, 0x4eb01004, 0x4eb11004,
+        0x4eb21004, 0x4eb31004, 0x4eb41004, 0x4eb51004, 0x4eb61004, 0x4eb71004, 0x4eb81004, 0x4eb91004,
+        0x4eba1004, 0x4ebb1004, 0x4ebc1004, 0x4ebd1004, 0x4ebe1004, 0x4ebf1004, 0x4ec01004, 0x4ec11004,
+        0x4ec21004, 0x4ec31004, 0x4ec41004, 0x4ec51004, 0x4ec61004, 0x4ec71004, 0x4ec81004, 0x4ec91004,
+        0x4eca1004, 0x4ecb1004, 0x4ecc1004, 0x4ecd1004, 0x4ece1004, 0x4ecf1004, 0x4ed01004, 0x4ed11004,
+        0x4ed21004, 0x4ed31004, 0x4ed41004, 0x4ed51004, 0x4ed61004, 0x4ed71004, 0x4ed81004, 0x4ed91004,
+        0x4eda1004, 0x4edb1004, 0x4edc1004, 0x4edd1004, 0x4ede1004, 0x4edf1004, 0x4ee01004, 0x4ee11004,
+        0x4ee21004, 0x4ee31004, 0x4ee41004, 0x4ee51004, 0x4ee61004, 0x4ee71004, 0x4ee81004, 0x4ee91004,
+        0x4eea1004, 0x4eeb1004, 0x4eec1004, 0x4eed1004, 0x4eee1004, 0x4eef1004, 0x4ef01004, 0x4ef11004,
+        0x4ef21004, 0x4ef31004, 0x4ef41004, 0x4ef51004, 0x4ef61004, 0x4ef71004, 0x4ef81004, 0x4ef91004,
+        0x4efa1004, 0x4efb1004, 0x4efc1004, 0x4efd1004, 0x4efe1004, 0x4eff1004, 0x4f001004, 0x4f011004,
+        0x4f021004, 0x4f031004, 0x4f041004, 0x4f051004, 0x4f061004, 0x4f071004, 0x4f081004, 0x4f091004,
+        0x4f0a1004, 0x4f0b1004, 0x4f0c1004, 0x4f0d1004, 0x4f0e1004, 0x4f0f1004, 0x4f101004, 0x4f111004,
+        0x4f121004, 0x4f131004, 0x4f141004, 0x4f151004, 0x4f161004, 0x4f171004, 0x4f181004, 0x4f191004,
+        0x4f1a1004, 0x4f1b1004, 0x4f1c1004, 0x4f1d1004, 0x4f1e1004, 0x4f1f1004, 0x4f201004, 0x4f211004,
+        0x4f221004, 0x4f231004, 0x4f241004, 0x4f251004, 0x4f261004, 0x4f271004, 0x4f281004, 0x4f291004,
+        0x4f2a1004, 0x4f2b1004, 0x4f2c1004, 0x4f2d1004, 0x4f2e1004, 0x4f2f1004, 0x4f301004, 0x4f311004,
+        0x4f321004, 0x4f331004, 0x4f341004, 0x4f351004, 0x4f361004, 0x4f371004, 0x4f381004, 0x4f391004,
+        0x4f3a1004, 0x4f3b1004, 0x4f3c1004, 0x4f3d1004, 0x4f3e1004, 0x4f3f1004, 0x4f401004, 0x4f411004,
+        0x4f421004, 0x4f431004, 0x4f441004, 0x4f451004, 0x4f461004, 0x4f471004, 0x4f481004, 0x4f491004,
+        0x4f4a1004, 0x4f4b1004, 0x4f4c1004, 0x4f4d1004, 0x4f4e1004, 0x4f4f1004, 0x4f501004, 0x4f511004,
+        0x4f521004, 0x4f531004, 0x4f541004, 0x4f551004, 0x4f561004, 0x4f571004, 0x4f581004, 0x4f591004,
+        0x4f5a1004, 0x500b1004, 0x500c1004, 0x500d1004, 0x500e1004, 0x500f1004, 0x50101004, 0x50111004,
+        0x50121004, 0x50131004, 0x50141004, 0x50151004, 0x50161004, 0x50171004, 0x50181004, 0x50191004,
+        0x501a1004, 0x501b1004, 0x501c1004, 0x501d1004, 0x501e1004, 0x501f1004, 0x50201004, 0x02e21004,
+        0x1e331004, 0x1e341004, 0x1e351004, 0x1e361004, 0x1e371004, 0x4fca1004, 0x4fcb1004, 0x4fcc1004,
+        0x4fcd1004, 0x4fce1004, 0x4fcf1004, 0x4fd01004, 0x4fd11004, 0x4fd21004, 0x4fd31004, 0x4fd41004,
+        0x4fd51004, 0x4fd61004, 0x4fd71032, 0x4fd71004, 0x4fd81004, 0x4fd91004, 0x4fda1004, 0x4fdb1004,
+        0x4fdc1004, 0x4fdd1004, 0x4fde1004, 0x4fdf1004, 0x111c1004, 0x111d1004, 0x1e241004, 0x1e251004,
+        0x4fe01032, 0x4fe01004, 0x4fe11032, 0x4fe11004, 0x4fe21004, 0x4fe31004, 0x4fe41032, 0x4fe41004,
+        0x4fe51004, 0x4fe61004, 0x4fe71004, 0x4fe81004, 0x4fe91032, 0x4fe91004, 0x4fea1032, 0x4fea1004,
+        0x4feb1032, 0x4feb1004, 0x4fec1032, 0x4fec1004, 0x4fed1032, 0x4fed1004, 0x4fee1004, 0x4fef1004,
+        0x4ff01004, 0x4ff11004, 0x4ff21004, 0x4ff31004, 0x4ff41032, 0x4ff41004, 0x4ff51004, 0x1e261004,
+        0x1e271004, 0x1e281004, 0x4ff61004, 0x4ff71004, 0x4ff81004, 0x4ff91004, 0x4ffa1004, 0x4ffb1004,
+        0x4ffc1004, 0x4ffd1004, 0x4ffe1004, 0x4fff1004, 0x50001004, 0x50011004, 0x50021004, 0x50031004,
+        0x50041004, 0x50051004, 0x50061004, 0x50071004, 0x50081004, 0x50091004, 0x500a1004, 0x1e291004,
+        0x1e2a1004, 0x1e2b1004, 0x26341004, 0x26351004, 0x26361004, 0x26371004, 0x26381004, 0x26391004,
+        0x263a1004, 0x263b1004, 0x263c1004, 0x263d1004, 0x263e1004, 0x263f1004, 0x26401004, 0x26411004,
+        0x26421004, 0x26431004, 0x26441004, 0x26451004, 0x26461004, 0x26471004, 0x26481004, 0x26491004,
+        0x1e301004, 0x1e311004, 0x1e321004, 0x03101004, 0x4b0f1004, 0x4b101004, 0x4b111004, 0x4b121004,
+        0x4b131004, 0x4b141004, 0x4b151004, 0x4b161004, 0x4b171004, 0x4b181004, 0x4b191004, 0x4b1a1004,
+        0x4b1b1004, 0x4b1c1004, 0x4b1d1004, 0x4b1e1004, 0x4b1f1004, 0x4b201004, 0x4b211004, 0x4b221004,
+        0x4b231004, 0x4b241004, 0x4b251004, 0x4b261004, 0x4b271004, 0x4b281004, 0x030a1004, 0x59d61048,
+        0x00008c08, 0x59d71048, 0x00008c08, 0x59d81048, 0x00008c08, 0x59d91048, 0x00008c08, 0x59da1048,
+        0x00008c08, 0x59db1048, 0x00008c08, 0x59dc1048, 0x00008c08, 0x59dc1048, 0x00008c88, 0x59dd1048,
+        0x00008c08, 0x59de1048, 0x00008c08, 0x59df1048, 0x00008c08, 0x59df1048, 0x00008c88, 0x59e01048,
+        0x00008c08, 0x59e01048, 0x00008c88, 0x59e11048, 0x00008c08, 0x59e11048, 0x00008c88, 0x59e21048,
+        0x00008c08, 0x59e31048, 0x00008c08, 0x59e41048, 0x00008c08, 0x59e51048, 0x00008c88, 0x59e51048,
+        0x00008d08, 0x59e61048, 0x00008c08, 0x59e71048, 0x00008c08, 0x59e81048, 0x00008c08, 0x59e91048,
+        0x00008c08, 0x59e91048, 0x00008c88, 0x59ea1048, 0x00008c08, 0x59ea1048, 0x00008c88, 0x59eb1048,
+        0x00008c08, 0x59ec1048, 0x00008c08, 0x59ef1004, 0x59f01004, 0x59d61004, 0x59d71004, 0x59d81004,
+        0x59d91004, 0x59da1004, 0x59db1004, 0x59dc1004, 0x59dd1004, 0x59de1004, 0x59df1004, 0x59e01004,
+        0x59e11004, 0x59e21004, 0x59e31004, 0x59e41004, 0x59e51004, 0x59e51048, 0x00008c08, 0x59e61004,
+        0x59e71004, 0x59e81004, 0x59e91004, 0x59ea1004, 0x59eb1004, 0x59ec1004, 0x1f2b1004, 0x1f201004,
+        0x59ed1004, 0x59ee1004, 0x1ef51004, 0x1ef61004, 0x1ef71004, 0x1ef81004, 0x1ef91004, 0x1efa1004,
+        0x1efb1004, 0x1efc1004, 0x1efd1004, 0x1efe1004, 0x1eff1004, 0x1f001004, 0x1f011004, 0x1f021004,
+        0x1f031004, 0x1f041004, 0x1f051004, 0x1f061004, 0x1f071004, 0x1f081004, 0x1f091004, 0x1f0a1004,
+        0x1f0b1004, 0x1f0c1004, 0x1f0d1004, 0x1f0e1004, 0x1f0f1004, 0x1f101004, 0x1f111004, 0x1f121004,
+        0x1f131004, 0x1f141004, 0x1f151004, 0x1f161004, 0x1f171004, 0x1f181004, 0x1f191004, 0x1f1a1004,
+        0x1f1b1004, 0x1f1c1004, 0x1f1d1004, 0x1f1e1004, 0x1f1f1004, 0x1f211004, 0x1f221004, 0x1f231004,
+        0x1f241004, 0x1f251004, 0x1f261004, 0x1f271004, 0x1f281004, 0x1f291004, 0x1f2a1004, 0x31af1004,
+        0x31b01004, 0x31b11004, 0x31b21004, 0x31b31004, 0x31b41004, 0x31b51004, 0x31b61004, 0x31b81004,
+        0x31b91004, 0x31ba1004, 0x31bb1004, 0x31bc1004, 0x31bd1004, 0x31be1004, 0x31bf1004, 0x31c11004,
+        0x31c31004, 0x31c41004, 0x31c51004, 0x31c61004, 0x31c71004, 0x31c81004, 0x31c91004, 0x31ca1004,
+        0x31cb1004, 0x31cc1004, 0x31cd1004, 0x31ce1004, 0x31cf1004, 0x31d01004, 0x31d11004, 0x31d21004,
+        0x31d31004, 0x31d51004, 0x31d61004, 0x31d71004, 0x31d81004, 0x31d91004, 0x31b71004, 0x31c21004,
+        0x31c01004, 0x31d41004, 0x00006684, 0x00006704, 0x00006784, 0x31da1004, 0x1e5e1004, 0x1e5f1004,
+        0x1e601004, 0x1e611004, 0x1e621004, 0x04641004, 0x04651004, 0x04661004, 0x04671004, 0x04681004,
+        0x04691004, 0x02b21004, 0x02b31004, 0x046a1004, 0x4f5b1004, 0x4f5c1004, 0x4f5d1004, 0x4f5e1004,
+        0x4f5f1004, 0x4f601004, 0x4f611004, 0x4f621004, 0x4f631004, 0x4f641004, 0x4f651004, 0x4f661004,
+        0x4f671004, 0x4f681004, 0x4f691004, 0x4f6a1004, 0x4f6b1004, 0x4f6c1004, 0x4f6d1004, 0x4f6e1004,
+        0x4f6f1004, 0x4f701004, 0x4f711004, 0x4f721004, 0x4f731004, 0x4f741004, 0x4f751004, 0x4f761004,
+        0x4f771004, 0x1e2c1004, 0x1e2d1004, 0x4f781004, 0x4f791004, 0x4f7a1004, 0x4f7b1004, 0x4f7c1004,
+        0x4f7d1004, 0x4f7e1004, 0x4f7f1004, 0x4f801004, 0x4f811004, 0x4f821004, 0x4f831004, 0x4f841004,
+        0x4f851004, 0x4f861004, 0x4f871004, 0x4f881004, 0x4f891004, 0x4f8a1004, 0x4f8b1004, 0x4f8c1004,
+        0x4f8d1004, 0x4f8e1004, 0x4f8f1004, 0x4f901004, 0x4f911004, 0x4f921004, 0x4f931004, 0x4f941004,
+        0x1e2e1004, 0x1e2f1004, 0x50721004, 0x50731004, 0x50741004, 0x50751004, 0x50761004, 0x50771004,
+        0x50781004, 0x50791004, 0x50791048, 0x00008c88, 0x507a1004, 0x507b1004, 0x507c1004, 0x507d1004,
+        0x507e1004, 0x507f1004, 0x50801004, 0x50811004, 0x50821004, 0x50831004, 0x50841004, 0x50851004,
+        0x50861004, 0x50871004, 0x50881004, 0x50891004, 0x508a1004, 0x508b1004, 0x508c1004, 0x508d1004,
+        0x508e1004, 0x508f1004, 0x50901004, 0x50911004, 0x50921004, 0x50931004, 0x50941004, 0x50951004,
+        0x1e381004, 0x1e391004, 0x1e3a1004, 0x046f1004, 0x04701004, 0x04711004, 0x04721004, 0x04731004,
+        0x04741004, 0x04751004, 0x4f951004, 0x4f961004, 0x4f971004, 0x4f981004, 0x4f991004, 0x4f9a1004,
+        0x4f9b1004, 0x4f9c1004, 0x4f9d1004, 0x4f9e1004, 0x4f9f1004, 0x4fa01004, 0x4fa11004, 0x4fa21004,
+        0x4fa31004, 0x4fa41004, 0x4fa51004, 0x4fa61004, 0x4fa71004, 0x4fa81004, 0x4fa91004, 0x4faa1004,
+        0x4fab1004, 0x4fac1004, 0x4fad1004, 0x4fae1004, 0x4faf1004, 0x4fb01004, 0x4fb11004, 0x4fb21004,
+        0x4fb31004, 0x4fb41004, 0x4fb51004, 0x4fb61004, 0x4fb71004, 0x4fb81004, 0x4fb91004, 0x4fba1004,
+        0x4fbb1004, 0x4fbc1004, 0x4fbd1004, 0x4fbe1004, 0x4fbf1004, 0x4fc01004, 0x4fc11004, 0x4fc21004,
+        0x4fc21048, 0x00008c08, 0x4fc31004, 0x4fc41004, 0x4fc51004, 0x4fc61004, 0x4fc71004, 0x4fc81004,
+        0x4fc91004, 0x046e1004, 0x02e31004, 0x02e41004, 0x02e51004, 0x02e61004, 0x02e71004, 0x02e81004,
+        0x50211004, 0x50221004, 0x50231004, 0x50241004, 0x50251004, 0x50261004, 0x50271004, 0x50281004,
+        0x50291004, 0x502a1004, 0x502b1004, 0x502c1004, 0x502d1004, 0x502e1004, 0x502f1004, 0x50301004,
+        0x50311004, 0x50321004, 0x50331004, 0x50341004, 0x50351004, 0x50361004, 0x1e3b1004, 0x1e3c1004,
+        0x1e3d1004, 0x1e3e1004, 0x50371004, 0x50381004, 0x50391004, 0x503a1004, 0x503b1004, 0x503c1004,
+        0x503d1004, 0x503e1004, 0x503f1004, 0x50401004, 0x50411004, 0x50421004, 0x50431004, 0x50441004,
+        0x50451004, 0x50461004, 0x50471004, 0x50481004, 0x50491004, 0x1e3f1004, 0x1e401004, 0x1e411004,
+        0x1e421004, 0x504a1004, 0x504b1004, 0x504c1004, 0x504d1004, 0x504e1004, 0x504f1004, 0x50501004,
+        0x50511004, 0x50521004, 0x50531004, 0x50541004, 0x50551004, 0x50561004, 0x50571004, 0x50581004,
+        0x50591004, 0x505a1004, 0x505b1004, 0x04761004, 0x04771004, 0x04781004, 0x04791004, 0x1e431004,
+        0x1e441004, 0x1e451004, 0x3c8c1004, 0x3c8c1048, 0x00008c08, 0x3c8d1004, 0x3c8e1004, 0x3c8e1048,
+        0x00008c08, 0x3c8f1004, 0x3c901004, 0x3c911004, 0x3c911048, 0x00008c08, 0x3c921004, 0x3c921048,
+        0x00008c08, 0x3c931004, 0x3c931048, 0x00008c08, 0x3c941004, 0x3c941048, 0x00008c08, 0x3c951004,
+        0x3c951048, 0x00008c08, 0x3c961004, 0x3c961048, 0x00008c08, 0x3c971004, 0x3c981004, 0x3c981048,
+        0x00008c08, 0x3c991004, 0x3c991048, 0x00008c08, 0x3c9a1004, 0x3c9a1048, 0x00008c08, 0x3c9b1004,
+        0x3c9b1048, 0x00008c08, 0x3c9c1004, 0x3c9c1048, 0x00008c08, 0x3c9d1004, 0x3c9d1048, 0x00008c08,
+        0x3c9e1004, 0x3c9f1004, 0x3ca01004, 0x3ca11004, 0x3ca21004, 0x3ca21048, 0x00008c08, 0x3ca31004,
+        0x3ca31048, 0x00008c08, 0x3ca41004, 0x3ca41048, 0x00008c08, 0x3ca51004, 0x3ca51048, 0x00008c08,
+        0x3ca61004, 0x3ca71004, 0x3ca71048, 0x00008c08, 0x3ca81004, 0x3ca91004, 0x3caa1004, 0x3cab1004,
+        0x3cab1048, 0x00008c08, 0x3cac1004, 0x3cac1048, 0x00008c08, 0x3cad1004, 0x3cad1048, 0x00008c08,
+        0x3cae1004, 0x3cae1048, 0x00008c08, 0x3caf1004, 0x3caf1048, 0x00008c08, 0x3cb01004, 0x3cb11004,
+        0x3cb21004, 0x3cb31004, 0x3cb31048, 0x00008c08, 0x3cb41004, 0x3cb41048, 0x00008c08, 0x3cb51004,
+        0x3cb51048, 0x00008c08, 0x3cb61004, 0x3cb61048, 0x00008c08, 0x3cb71004, 0x3cb81004, 0x3c631010,
+        0x3c631054, 0x00008c08, 0x3c641010, 0x3c651010, 0x3c661010, 0x3c671010, 0x3c681010, 0x3c691010,
+        0x3c6a1010, 0x3c6b1010, 0x3c6b1054, 0x00008c08, 0x3c6b1054, 0x00008c88, 0x3c6c1010, 0x3c6d1010,
+        0x3c6e1010, 0x3c6f1010, 0x3c701010, 0x3c701054, 0x00008c08, 0x3c711010, 0x3c721010, 0x3c731010,
+        0x3c741010, 0x3c751010, 0x3c761010, 0x3c771010, 0x3c781010, 0x3c791010, 0x3c7a1010, 0x3c7a1054,
+        0x00008c08, 0x3c7b1010, 0x3c7b1054, 0x00008c08, 0x3c7b1054, 0x00008c88, 0x3c7c1010, 0x3c7d1010,
+        0x3c7e1010, 0x3c7e1054, 0x00008c08, 0x3c7f1010, 0x3c801010, 0x3c811010, 0x3c821010, 0x3c831010,
+        0x3c841010, 0x3c851010, 0x3c851054, 0x00008c08, 0x3c861010, 0x3c861054, 0x00008c08, 0x3c871010,
+        0x3c881010, 0x3c891010, 0x3c8a1010, 0x3c8b1010, 0x3c631004, 0x3c631048, 0x00008c08, 0x3c641004,
+        0x3c651004, 0x3c661004, 0x3c671004, 0x3c681004, 0x3c691004, 0x3c6a1004, 0x3c6b1004, 0x3c6b1048,
+        0x00008c08, 0x3c6b1048, 0x00008c88, 0x3c6c1004, 0x3c6d1004, 0x3c6e1004, 0x3c6f1004, 0x3c701004,
+        0x3c701048, 0x00008c08, 0x3c711004, 0x3c721004, 0x3c731004, 0x3c741004, 0x3c751004, 0x3c761004,
+        0x3c771004, 0x3c781004, 0x3c791004, 0x3c7a1004, 0x3c7a1048, 0x00008c08, 0x3c7b1004, 0x3c7b1048,
+        0x00008c08, 0x3c7b1048, 0x00008c88, 0x3c7c1004, 0x3c7d1004, 0x3c7e1004, 0x3c7e1048, 0x00008c08,
+        0x3c7f1004, 0x3c801004, 0x3c811004, 0x3c821004, 0x3c831004, 0x3c841004, 0x3c851004, 0x3c851048,
+        0x00008c08, 0x3c861004, 0x3c861048, 0x00008c08, 0x3c871004, 0x3c881004, 0x3c891004, 0x3c8a1004,
+        0x3c8b1004, 0x1dba1004, 0x1dbb1004, 0x1dbc1004, 0x1dbd1004, 0x361b1004, 0x36211004, 0x36221004,
+        0x36231004, 0x36241004, 0x36251004, 0x36261004, 0x36271004, 0x36281004, 0x36291004, 0x362a1004,
+        0x362b1004, 0x362c1004, 0x362d1004, 0x362e1004, 0x362f1004, 0x36301004, 0x36311004, 0x36321004,
+        0x36331004, 0x36341004, 0x36351004, 0x36361004, 0x36371004, 0x36381004, 0x36391004, 0x363a1004,
+        0x363b1004, 0x363c1004, 0x361c1004, 0x361d1004, 0x361e1004, 0x361f1004, 0x36201004, 0x363d1004,
+        0x363e1004, 0x1da11004, 0x1da21004, 0x1da31004, 0x1da41004, 0x1da51004, 0x1da61004, 0x1da71004,
+        0x1da81004, 0x1da91004, 0x1daa1004, 0x1dab1004, 0x1dac1004, 0x1dad1004, 0x1dae1004, 0x1daf1004,
+        0x1db01004, 0x1db11004, 0x1db21004, 0x1db31004, 0x1db41004, 0x1db51004, 0x1db61004, 0x50be1004,
+        0x50bf1004, 0x50c01004, 0x50c11004, 0x50c21004, 0x50c31004, 0x50c41004, 0x50c51004, 0x50c61004,
+        0x50c71004, 0x50c81004, 0x50c91004, 0x50ca1004, 0x50cb1004, 0x50cc1004, 0x50cd1004, 0x50ce1004,
+        0x50cf1004, 0x50d01004, 0x50d11004, 0x50d21004, 0x50d31004, 0x50d41004, 0x50d51004, 0x50d61004,
+        0x50d71004, 0x50d81004, 0x50d91004, 0x50da1004, 0x50db1004, 0x50dc1004, 0x50dd1004, 0x50de1004,
+        0x50e01004, 0x50e11004, 0x50e21004, 0x50e31004, 0x50e41004, 0x50e51004, 0x50e61004, 0x50e71004,
+        0x50e91004, 0x02221004, 0x50df1004, 0x50e81004, 0x50961004, 0x50961032, 0x50971004, 0x50971032,
+        0x50981004, 0x50991004, 0x50991032, 0x509a1004, 0x509b1004, 0x509c1004, 0x509d1004, 0x509e1004,
+        0x509f1004, 0x50a01004, 0x50a11004, 0x50a11032, 0x50a11048, 0x00008c88, 0x50a21004, 0x50a31004,
+        0x50a31048, 0x00008c88, 0x50a41004, 0x50a51004, 0x50a51032, 0x50a51048, 0x00008c88, 0x50a61004,
+        0x50a71004, 0x50a81004, 0x50a81032, 0x50a81048, 0x00008c88, 0x1e461004, 0x1e471004, 0x1e481004,
+        0x1e491004, 0x1e4a1004, 0x50a31048, 0x50a61008, 0x50a91004, 0x50aa1004, 0x50ab1004, 0x50ac1004,
+        0x50ad1004, 0x50ae1004, 0x50af1004, 0x50b01004, 0x50b11004, 0x50b21004, 0x50b31004, 0x50b41004,
+        0x50b51004, 0x50b61004, 0x50b71004, 0x50b81004, 0x50b91004, 0x50ba1004, 0x50bb1004, 0x50bc1004,
+        0x50bd1004, 0x50ba1048, 0x00008c88, 0x1e4b1004, 0x1e4c1004, 0x1e4d1004, 0x02e91004, 0x02ea1004,
+        0x02eb1004, 0x02ec1004, 0x02ed1004, 0x50ea1004, 0x50eb1004, 0x50ec1004, 0x50ed1004, 0x50ee1004,
+        0x50ef1004, 0x50f01004, 0x50f11004, 0x50f21004, 0x50f31004, 0x50f41004, 0x50f51004, 0x50f61004,
+        0x50f71004, 0x50f81004, 0x50f91004, 0x50fa1004, 0x50fb1004, 0x50fc1004, 0x50fd1004, 0x50fe1004,
+        0x1e4e1004, 0x1e4f1004, 0x1e501004, 0x505c1004, 0x505d1004, 0x505e1004, 0x505f1004, 0x50601004,
+        0x50611004, 0x50621004, 0x50631004, 0x50641004, 0x50651004, 0x50661004, 0x50671004, 0x50681004,
+        0x50691004, 0x506a1004, 0x506b1004, 0x506c1004, 0x506d1004, 0x506e1004, 0x506f1004, 0x50701004,
+        0x50711004, 0x50621048, 0x50651008, 0x31991004, 0x319a1004, 0x316a1004, 0x316b1004, 0x316c1004,
+        0x316d1004, 0x316e1004, 0x316f1004, 0x31701004, 0x31711004, 0x31721004, 0x31731004, 0x31741004,
+        0x31751004, 0x31761004, 0x31771004, 0x31781004, 0x31791004, 0x317a1004, 0x317b1004, 0x317c1004,
+        0x317d1004, 0x317e1004, 0x317f1004, 0x31801004, 0x31811004, 0x31821004, 0x31831004, 0x31841004,
+        0x31851004, 0x31861004, 0x31871004, 0x31881004, 0x31891004, 0x318a1004, 0x318b1004, 0x318c1004,
+        0x318d1004, 0x318e1004, 0x318f1004, 0x31901004, 0x31911004, 0x31921004, 0x31931004, 0x31941004,
+        0x31951004, 0x31961004, 0x31971004, 0x31981004, 0x319b1004, 0x319c1004, 0x319d1004, 0x319e1004,
+        0x319f1004, 0x31a01004, 0x31a11004, 0x31a21004, 0x31a31004, 0x31a41004, 0x31a51004, 0x31a61004,
+        0x31a71004, 0x31a81004, 0x31a91004, 0x31aa1004, 0x31ab1004, 0x31ac1004, 0x31ad1004, 0x02b41004,
+        0x02b51004, 0x045f1004, 0x04601004, 0x04611004, 0x04621004, 0x04631004, 0x1e531004, 0x1e541004,
+        0x1e551004, 0x1e561004, 0x1e571004, 0x1e581004, 0x1e591004, 0x1e5a1004, 0x1e5b1004, 0x1e5c1004,
+        0x1e5d1004, 0x31ae1004, 0x2d471004, 0x2d481004, 0x2d491004, 0x2d4a1004, 0x2d4b1004, 0x2d4c1004,
+        0x2d4d1004, 0x2d4e1004, 0x2d4f1004, 0x2d501004, 0x2d511004, 0x2d521004, 0x2d531004, 0x2d541004,
+        0x2d551004, 0x2d561004, 0x2d571004, 0x2d581004, 0x2d591004, 0x2d5a1004, 0x2d5b1004, 0x2d5c1004,
+        0x2d5d1004, 0x2d5d1044, 0x00006104, 0x2d5e1004, 0x2d5e1044, 0x00006104, 0x2d5f1004, 0x2d601004,
+        0x2d611004, 0x2d621004, 0x2d631004, 0x2d641004, 0x2d651004, 0x2d661004, 0x2d671004, 0x2d681004,
+        0x2d691004, 0x2d6a1004, 0x2d6b1004, 0x2d6c1004, 0x2d671044, 0x00006104, 0x2d6d1004, 0x2d6e1004,
+        0x2d6f1004, 0x2d701004, 0x2d711004, 0x2d721004, 0x2d731004, 0x2d741004, 0x2d751004, 0x2d761004,
+        0x2d771004, 0x2d781004, 0x2d791004, 0x2d7a1004, 0x047a1004, 0x047b1004, 0x02ee1004, 0x02ef1004,
+        0x02b61004, 0x02b71004, 0x4cc41004, 0x4cc51004, 0x4cc61004, 0x4cc71004, 0x4cc81004, 0x4cc91004,
+        0x4cca1004, 0x4ccb1004, 0x4ccc1004, 0x4ccd1004, 0x4cce1004, 0x4ccf1004, 0x4cd01004, 0x4cd11004,
+        0x4cd21004, 0x4cd31004, 0x4cd41004, 0x4cd51004, 0x4cd61004, 0x4cd71004, 0x4cd81004, 0x4cd91004,
+        0x4cda1004, 0x4cdb1004, 0x4cdc1004, 0x363f1004, 0x36401004, 0x36411004, 0x36421004, 0x36431004,
+        0x36441004, 0x36451004, 0x36461004, 0x36471004, 0x36481004, 0x36491004, 0x364a1004, 0x364b1004,
+        0x364c1004, 0x364d1004, 0x364e1004, 0x364f1004, 0x36501004, 0x36511004, 0x36521004, 0x36531004,
+        0x36541004, 0x36551004, 0x36561004, 0x36571004, 0x36581004, 0x36591004, 0x365a1004, 0x365b1004,
+        0x365c1004, 0x365d1004, 0x365e1004, 0x365f1004, 0x36611004, 0x36621004, 0x36631004, 0x36651004,
+        0x36661004, 0x36671004, 0x36681004, 0x36691004, 0x366a1004, 0x366b1004, 0x366c1004, 0x366d1004,
+        0x366e1004, 0x366f1005, 0x36701005, 0x36731004, 0x36741004, 0x02f01004, 0x02b81004, 0x02b91004,
+        0x027a1004, 0x36641004, 0x36711004, 0x36721004, 0x36601004, 0x2d7b1004, 0x2d7c1004, 0x2d7d1004,
+        0x2d7e1004, 0x2d7f1004, 0x2d801004, 0x2d811004, 0x2d821004, 0x2d831004, 0x2d841004, 0x2d851004,
+        0x2d861004, 0x2d871004, 0x2d881004, 0x2d891004, 0x2d8a1004, 0x2d8b1004, 0x2d8c1004, 0x2d8d1004,
+        0x2d8e1004, 0x2d8f1004, 0x2d901004, 0x2d911004, 0x2d921004, 0x2d931004, 0x2d941004, 0x2d951004,
+        0x2d961004, 0x2d971004, 0x2d981004, 0x2d991004, 0x2d9a1004, 0x2d9c1004, 0x2d9d1004, 0x2d9e1004,
+        0x047c1004, 0x047d1004, 0x2d9b1004, 0x2da11004, 0x2da21004, 0x2da31004, 0x2da41004, 0x2da51004,
+        0x2da61004, 0x2da71004, 0x2da81004, 0x2da91004, 0x2daa1004, 0x2dab1004, 0x2dac1004, 0x2dad1004,
+        0x2dae1004, 0x2daf1004, 0x2db01004, 0x2db11004, 0x2db21004, 0x2db31004, 0x2db41004, 0x2db51004,
+        0x2db61004, 0x2db71004, 0x2db81004, 0x2db91004, 0x2dba1004, 0x2dbb1004, 0x2dbc1004, 0x2dbd1004,
+        0x2dbe1004, 0x2dbf1004, 0x2dc01004, 0x2dc11004, 0x2dc21004, 0x2dc31004, 0x2dc41004, 0x2dc51004,
+        0x2dc61004, 0x2dc71004, 0x2dc81004, 0x2dc91004, 0x2dca1004, 0x2dcb1004, 0x2dcc1004, 0x2dcd1004,
+        0x2dce1004, 0x2dcf1004, 0x2dd01004, 0x2dd51004, 0x2dd61004, 0x2dd71004, 0x2dd81004, 0x2dd91004,
+        0x2dda1004, 0x2ddb1004, 0x2ddc1004, 0x2ddd1004, 0x2dde1004, 0x2de01004, 0x2de11004, 0x2de21004,
+        0x2de31004, 0x2dd11004, 0x2dd21004, 0x2dd31004, 0x2d9f1004, 0x02ba1004, 0x02bb1004, 0x047f1004,
+        0x02f11004, 0x00006804, 0x00006884, 0x047e1004, 0x2ddf1004, 0x2da01004, 0x04801004, 0x2dd41004,
+        0x04811004, 0x02f21004, 0x02f31004, 0x1e6d1004, 0x1e6e1004, 0x1e6f1004, 0x1e701004, 0x1e711004,
+        0x1e721004, 0x1e731004, 0x1e741004, 0x1e751004, 0x1e761004, 0x1e771004, 0x2de41004, 0x2de51004,
+        0x2de61004, 0x2de71004, 0x2de81004, 0x2de91004, 0x2dea1004, 0x2deb1004, 0x2dec1004, 0x2ded1004,
+        0x2dee1004, 0x2def1004, 0x2df01004, 0x2df11004, 0x2df21004, 0x2df31004, 0x2df41004, 0x2df51004,
+        0x2df61004, 0x2df71004, 0x2df81004, 0x2df91004, 0x2dfa1004, 0x2dfb1004, 0x2dfc1004, 0x2dfd1004,
+        0x2dfe1004, 0x2dff1004, 0x2e001004, 0x2e011004, 0x2e021004, 0x2e031004, 0x2e041004, 0x2e051004,
+        0x2e061004, 0x2e071004, 0x2e081004, 0x2e091004, 0x2e0a1004, 0x2e0b1004, 0x2e0c1004, 0x2e0d1004,
+        0x2e0e1004, 0x2e0f1004, 0x2e101004, 0x2e111004, 0x2e121004, 0x2e131004, 0x2e141004, 0x2e151004,
+        0x2e161004, 0x2e171004, 0x02bc1004, 0x02bd1004, 0x04821004, 0x04831004, 0x04841004, 0x04851004,
+        0x2e511004, 0x2e521004, 0x2e531004, 0x2e541004, 0x2e571004, 0x2e581004, 0x2e591004, 0x2e5a1004,
+        0x2e5b1004, 0x2e5c1004, 0x2e5d1004, 0x2e5e1004, 0x2e5f1004, 0x2e601004, 0x2e611004, 0x2e621004,
+        0x2e631004, 0x2e641004, 0x2e651004, 0x2e661004, 0x2e671004, 0x2e681004, 0x2e691004, 0x2e6a1004,
+        0x2e6b1004, 0x2e6c1004, 0x2e6d1004, 0x2e6e1004, 0x2e6f1004, 0x2e701004, 0x2e711004, 0x2e721004,
+        0x2e731004, 0x2e551004, 0x2e561004, 0x2e741004, 0x2e751004, 0x02f41004, 0x2e181004, 0x2e191004,
+        0x2e1a1004, 0x2e1b1004, 0x2e1c1004, 0x2e1d1004, 0x2e1e1004, 0x2e1f1004, 0x2e201004, 0x2e211004,
+        0x2e221004, 0x2e231004, 0x2e241004, 0x2e251004, 0x2e261004, 0x2e271004, 0x2e281004, 0x2e291004,
+        0x2e2a1004, 0x2e2b1004, 0x2e2c1004, 0x2e2d1004, 0x2e2e1004, 0x2e2f1004, 0x2e301004, 0x2e311004,
+        0x2e321004, 0x2e331004, 0x2e341004, 0x2e351004, 0x2e361004, 0x2e371004, 0x2e381004, 0x2e391004,
+        0x2e3a1004, 0x2e3b1004, 0x2e3c1004, 0x2e3d1004, 0x2e3e1004, 0x2e3f1004, 0x2e401004, 0x2e411004,
+        0x2e421004, 0x2e431004, 0x2e441004, 0x2e451004, 0x2e461004, 0x2e471004, 0x2e481004, 0x2e491004,
+        0x2e4a1004, 0x2e4b1004, 0x2e4c1004, 0x2e4d1004, 0x2e4e1004, 0x2e4f1004, 0x2e501004, 0x2e771004,
+        0x2e781004, 0x2e791004, 0x2e7a1004, 0x2e7b1004, 0x2e7c1004, 0x2e7d1004, 0x2e7f1004, 0x2e811004,
+        0x2e821004, 0x2e831004, 0x2e841004, 0x2e851004, 0x2e861004, 0x2e871004, 0x2e881004, 0x2e891004,
+        0x2e8a1004, 0x2e8b1004, 0x2e8c1004, 0x2e8d1004, 0x2e8e1004, 0x2e8f1004, 0x2e901004, 0x2e911004,
+        0x2e921004, 0x2e931004, 0x2e941004, 0x2e951004, 0x2e961004, 0x2e971004, 0x2e981004, 0x2e991004,
+        0x2e9a1004, 0x2e9b1004, 0x2e9c1004, 0x2e9d1004, 0x2e9e1004, 0x2e9f1004, 0x2ea01004, 0x2ea11004,
+        0x2ea21004, 0x2ea31004, 0x2ea41004, 0x2ea51004, 0x2ea61004, 0x2ea71004, 0x2eaa1004, 0x2eab1004,
+        0x2eac1004, 0x2ead1004, 0x2eae1004, 0x2eaf1004, 0x2eb01004, 0x2eb31005, 0x2eb41004, 0x2eb51004,
+        0x2eb61004, 0x2eb71004, 0x2e761004, 0x2eb81004, 0x2eb91004, 0x2ea81004, 0x2ea91004, 0x2e7e1004,
+        0x2e801004, 0x2eb11004, 0x2eb21004, 0x2ebc1004, 0x2ebd1004, 0x2ebe1004, 0x2ebf1004, 0x2ec01004,
+        0x2ec11004, 0x2ec21004, 0x2ec31004, 0x2ec41004, 0x2ec51004, 0x2ec61004, 0x2ec71004, 0x2ec81004,
+        0x2ec91004, 0x2eca1004, 0x2ecb1004, 0x2ecc1004, 0x2ecd1004, 0x2ece1004, 0x2ecf1004, 0x2ed01004,
+        0x2ed11004, 0x2ed21004, 0x2ed31004, 0x2ed41004, 0x2ed51004, 0x2ed61004, 0x2ed71004, 0x2ed81004,
+        0x2ed91004, 0x2eda1004, 0x2edb1004, 0x2edc1004, 0x2edd1004, 0x2ede1004, 0x2edf1004, 0x2ee01004,
+        0x2ee11004, 0x2ee21004, 0x2ee31004, 0x2ee41004, 0x2ee51004, 0x2ee61004, 0x2ee71004, 0x2ee81004,
+        0x2ee91004, 0x2eea1004, 0x2eeb1004, 0x2eec1004, 0x2eed1004, 0x2eee1004, 0x2eef1004, 0x2ef01004,
+        0x2ef61004, 0x2ef71004, 0x2ef81004, 0x2ef91004, 0x2efa1004, 0x2efb1004, 0x2efc1004, 0x2efd1004,
+        0x2efe1004, 0x2eff1004, 0x2f001004, 0x2f011004, 0x2f021004, 0x2f031004, 0x2ef11004, 0x2ef41004,
+        0x2eba1004, 0x2ebb1004, 0x02be1004, 0x02bf1004, 0x04861004, 0x04881004, 0x04891004, 0x04871004,
+        0x048a1004, 0x048b1004, 0x2ef51004, 0x2ef21004, 0x2ef31004, 0x2f051004, 0x2f061004, 0x2f071004,
+        0x2f081004, 0x2f091004, 0x2f0a1004, 0x2f0b1004, 0x2f0c1004, 0x2f0d1004, 0x2f0e1004, 0x2f0f1004,
+        0x2f101004, 0x2f111004, 0x2f121004, 0x2f131004, 0x2f141004, 0x2f151004, 0x2f161004, 0x2f171004,
+        0x2f181004, 0x2f191004, 0x2f1a1004, 0x2f1b1004, 0x2f1c1004, 0x2f1d1004, 0x2f1e1004, 0x2f1f1004,
+        0x2f201004, 0x2f211004, 0x2f221004, 0x2f231004, 0x2f241004, 0x2f251004, 0x2f261004, 0x2f271004,
+        0x2f281004, 0x2f291004, 0x2f2a1004, 0x2f2b1004, 0x2f2c1004, 0x2f2d1004, 0x2f2e1004, 0x2f2f1004,
+        0x2f301004, 0x2f311004, 0x2f321004, 0x2f331004, 0x2f341004, 0x2f371004, 0x2f381004, 0x2f391004,
+        0x2f3a1004, 0x2f3b1004, 0x2f3c1004, 0x2f3d1004, 0x2f3e1004, 0x2f3f1004, 0x2f401005, 0x2f411004,
+        0x2f421004, 0x2f431004, 0x2f441004, 0x2f451004, 0x2f461004, 0x2f351004, 0x2f361004, 0x048c1004,
+        0x2f041004, 0x2f471004, 0x2f481004, 0x2f491004, 0x2f4a1004, 0x2f4b1004, 0x2f4c1004, 0x2f4d1004,
+        0x2f4e1004, 0x2f4f1004, 0x2f501004, 0x2f511004, 0x2f521004, 0x2f531004, 0x2f541004, 0x2f551004,
+        0x2f561004, 0x2f571004, 0x2f581004, 0x2f591004, 0x2f5a1004, 0x2f5b1004, 0x2f5c1004, 0x2f5d1004,
+        0x2f5e1004, 0x2f5f1004, 0x2f601004, 0x2f611004, 0x2f621004, 0x2f631004, 0x2f641004, 0x2f651004,
+        0x2f661004, 0x2f671004, 0x2f681004, 0x2f691004, 0x2f6a1004, 0x2f6b1004, 0x2f6c1004, 0x2f6d1004,
+        0x2f6e1004, 0x2f6f1004, 0x2f701004, 0x2f711004, 0x2f721004, 0x2f731004, 0x2f741004, 0x2f751004,
+        0x2f761004, 0x2f771004, 0x2f781004, 0x2f791004, 0x2f7a1004, 0x2f7b1004, 0x2f7c1004, 0x2f7d1005,
+        0x2f7e1005, 0x2f7f1004, 0x2f801004, 0x2f811004, 0x048d1004, 0x02c01004, 0x02c11004, 0x048e1004,
+        0x048f1004, 0x04901004, 0x04911004, 0x04921004, 0x04931004, 0x04941004, 0x04951004, 0x04961004,
+        0x04971004, 0x04981004, 0x04991004, 0x049a1004, 0x049b1004, 0x049c1004, 0x049d1004, 0x049e1004,
+        0x049f1004, 0x04a01004, 0x04a11004, 0x2f491048, 0x00008c08, 0x2f491048, 0x00008c88, 0x2f4a1048,
+        0x00008c08, 0x2f4b1048, 0x00008c08, 0x2f791048, 0x00008c08, 0x2f7a1048, 0x00008c08, 0x2f821004,
+        0x2f831004, 0x2f841004, 0x2f851004, 0x2f861004, 0x2f871004, 0x2f881004, 0x2f891004, 0x2f8a1004,
+        0x2f8b1004, 0x2f8c1004, 0x2f8d1004, 0x2f8e1004, 0x2f8f1004, 0x2f901004, 0x2f911004, 0x2f921004,
+        0x2f931004, 0x2f941004, 0x2f951004, 0x2f961004, 0x2f971004, 0x2f981004, 0x2f991004, 0x2f9a1004,
+        0x2f9b1004, 0x2f9c1004, 0x2f9d1004, 0x2f9e1004, 0x2f9f1004, 0x2fa01004, 0x2fa11004, 0x2fa21004,
+        0x2fa31004, 0x2fa41004, 0x2fa51004, 0x2fa61004, 0x2fa71004, 0x2fa81004, 0x2fa91004, 0x2faa1004,
+        0x2fab1004, 0x2fac1004, 0x2fad1004, 0x2fae1004, 0x2faf1004, 0x2fb01004, 0x2fb11004, 0x2fb21004,
+        0x2fb31004, 0x2fb41004, 0x2fb51004, 0x2fb61004, 0x2fb71004, 0x2fb81004, 0x2fb91004, 0x2fba1004,
+        0x2fbb1004, 0x2fbc1004, 0x2fbd1004, 0x2fbe1004, 0x2fbf1004, 0x02c21004, 0x02c31004, 0x04a21004,
+        0x2fc01004, 0x03f31004, 0x03f41004, 0x03f51004, 0x03f61004, 0x03f71004, 0x03f81004, 0x03f91004,
+        0x03fa1004, 0x03fb1004, 0x03fc1004, 0x03fd1004, 0x03fe1004, 0x03ff1004, 0x2fc11004, 0x2fc21004,
+        0x2fc31004, 0x2fc41004, 0x2fc51004, 0x2fc61004, 0x2fc71004, 0x2fc81004, 0x2fc91004, 0x2fca1004,
+        0x2fce1004, 0x2fcf1004, 0x2fd11004, 0x2fd21004, 0x2fd31004, 0x2fd41004, 0x2fd51004, 0x2fd61004,
+        0x2fd71004, 0x2fd81004, 0x2fd91004, 0x2fda1004, 0x2fdb1004, 0x2fdc1004, 0x2fdd1004, 0x2fde1004,
+        0x2fdf1004, 0x2fe01004, 0x2fe11004, 0x2fe21004, 0x2fe31004, 0x2fe41004, 0x2fe51004, 0x2fe61004,
+        0x2fe71004, 0x2fe81004, 0x2fe91004, 0x2fea1004, 0x2feb1004, 0x2fcc1004, 0x2fcb1004, 0x2fcd1004,
+        0x2fec1004, 0x2fed1004, 0x2fee1004, 0x2fef1004, 0x2ff01004, 0x2ff11004, 0x2ff21004, 0x2ff31004,
+        0x2ff41004, 0x2ff51004, 0x2ff61004, 0x2fd01004, 0x30a51004, 0x30a61004, 0x30a71004, 0x30a81004,
+        0x30a91004, 0x30a91048, 0x00008c08, 0x30aa1004, 0x30ab1004, 0x30ac1004, 0x30ad1004, 0x30ae1004,
+        0x30af1004, 0x30b01004, 0x30b11004, 0x30b21004, 0x30b31004, 0x30b41004, 0x30b51004, 0x30b61004,
+        0x30b71004, 0x30b81004, 0x30b91004, 0x30b91048, 0x00008c08, 0x30ba1004, 0x30bb1004, 0x30bc1004,
+        0x30ac1048, 0x00008c08, 0x30c91004, 0x30ca1004, 0x30cb1004, 0x30bd1004, 0x30be1004, 0x30bf1004,
+        0x30c01004, 0x30c11004, 0x30c21004, 0x30c31004, 0x30c41004, 0x30c51004, 0x30c61004, 0x30c71004,
+        0x30c81004, 0x1e511004, 0x1e521004, 0x02c41004, 0x02c51004, 0x02f51004, 0x059e1004, 0x306d1004,
+        0x306e1004, 0x306f1004, 0x30701004, 0x30711004, 0x30721004, 0x30731004, 0x30741004, 0x30751004,
+        0x30761004, 0x30771004, 0x30781004, 0x30791004, 0x307a1004, 0x307b1004, 0x307c1004, 0x307d1004,
+        0x307e1004, 0x307f1004, 0x30801004, 0x30811004, 0x30821004, 0x30831004, 0x30841004, 0x30851004,
+        0x30861004, 0x30871004, 0x30881004, 0x30891004, 0x308a1004, 0x308b1004, 0x308c1004, 0x308d1004,
+        0x308e1004, 0x308f1004, 0x30901004, 0x30911004, 0x30921004, 0x30931004, 0x30941004, 0x30951004,
+        0x30961004, 0x30971004, 0x30981004, 0x30991004, 0x309a1004, 0x309b1004, 0x309c1004, 0x309d1004,
+        0x309e1004, 0x309f1004, 0x30a01004, 0x30a11004, 0x30a21004, 0x30a31004, 0x30a41004, 0x04a31004,
+        0x49af1010, 0x49b01010, 0x49b11010, 0x49b21010, 0x49b31010, 0x49b41010, 0x49b51010, 0x49b61010,
+        0x49b71010, 0x49b81010, 0x49b91010, 0x49ba1010, 0x49bb1010, 0x49bc1010, 0x49bd1010, 0x49be1010,
+        0x49bf1010, 0x49c01010, 0x49c11010, 0x49c21010, 0x49c31010, 0x49c41010, 0x49c51010, 0x49c61010,
+        0x49c71010, 0x49c81010, 0x49c91010, 0x49ca1010, 0x49cb1010, 0x49cc1010, 0x49cd1010, 0x49ce1010,
+        0x49af1004, 0x49b01004, 0x49b11004, 0x49b21004, 0x49b31004, 0x49b41004, 0x49b51004, 0x49b61004,
+        0x49b71004, 0x49b81004, 0x49b91004, 0x49ba1004, 0x49bb1004, 0x49bc1004, 0x49bd1004, 0x49be1004,
+        0x49bf1004, 0x49c01004, 0x49c11004, 0x49c21004, 0x49c31004, 0x49c41004, 0x49c51004, 0x49c61004,
+        0x49c71004, 0x49c81004, 0x49c91004, 0x49ca1004, 0x49cb1004, 0x49cc1004, 0x49cd1004, 0x49ce1004,
+        0x1e781004, 0x1e791004, 0x1e7a1004, 0x1e7b1004, 0x1e7c1004, 0x1e7d1004, 0x1e7e1004, 0x1e7f1004,
+        0x1e801004, 0x49ae1004, 0x2ff71004, 0x2ff81004, 0x2ff91004, 0x2ffa1004, 0x2ffb1004, 0x2ffc1004,
+        0x2ffd1004, 0x2ffe1004, 0x2fff1004, 0x30001004, 0x30011004, 0x30021004, 0x30031004, 0x30051004,
+        0x30061004, 0x30071004, 0x30081004, 0x30091004, 0x300a1004, 0x300b1004, 0x300c1004, 0x300d1004,
+        0x300e1004, 0x300f1004, 0x30101004, 0x30111004, 0x30121004, 0x30131004, 0x30141004, 0x30151004,
+        0x30161004, 0x30171004, 0x30191004, 0x301b1004, 0x301d1004, 0x301e1004, 0x301f1004, 0x30201004,
+        0x30211004, 0x30221004, 0x30231004, 0x30241004, 0x30251004, 0x30261004, 0x30271004, 0x30281004,
+        0x30291004, 0x302a1005, 0x302b1004, 0x302c1004, 0x302d1004, 0x302e1004, 0x30041004, 0x30181004,
+        0x301a1004, 0x301c1004, 0x02c61004, 0x04a41004, 0x02f61004, 0x302f1004, 0x30301004, 0x30311004,
+        0x30321004, 0x30331004, 0x30341004, 0x30351004, 0x30361004, 0x30371004, 0x30381004, 0x30391004,
+        0x303a1004, 0x303b1004, 0x303c1004, 0x303d1004, 0x303e1004, 0x303f1004, 0x30401004, 0x30411004,
+        0x30421004, 0x30431004, 0x30441004, 0x30451004, 0x30461004, 0x30471004, 0x30481004, 0x30491004,
+        0x304a1004, 0x304b1004, 0x304c1004, 0x304d1004, 0x304e1004, 0x304f1004, 0x30501004, 0x30511004,
+        0x30521004, 0x30531004, 0x30541004, 0x30551004, 0x30561004, 0x30571004, 0x30581004, 0x30591004,
+        0x305a1004, 0x305b1004, 0x305c1004, 0x305d1004, 0x30601004, 0x30611004, 0x30621004, 0x30631004,
+        0x30641004, 0x30651004, 0x30661004, 0x30671004, 0x30691004, 0x306a1004, 0x306b1004, 0x306c1004,
+        0x305e1004, 0x04a51004, 0x305f1004, 0x30681004, 0x33611004, 0x33621004, 0x33631004, 0x33641004,
+        0x33651004, 0x33661004, 0x33671004, 0x33681004, 0x33691004, 0x336a1004, 0x336b1004, 0x33391004,
+        0x333b1004, 0x333c1004, 0x333d1004, 0x333e1004, 0x333f1004, 0x33401004, 0x33411004, 0x33421004,
+        0x33431004, 0x33441004, 0x33451004, 0x33461004, 0x33471004, 0x33481004, 0x33491004, 0x334a1004,
+        0x334b1004, 0x334c1004, 0x334d1004, 0x334e1004, 0x334f1004, 0x33501004, 0x33511004, 0x33521004,
+        0x33531004, 0x33541004, 0x33551004, 0x33561004, 0x33571004, 0x33581004, 0x33591004, 0x335a1004,
+        0x335b1004, 0x335c1004, 0x335d1004, 0x335e1004, 0x335f1004, 0x33601004, 0x333a1004, 0x336c1004,
+        0x335a102e, 0x33591032, 0x335a1032, 0x335b1032, 0x335c1032, 0x04261004, 0x04271004, 0x04281004,
+        0x04291004, 0x042a1004, 0x042b1004, 0x042c1004, 0x042d1004, 0x336d1004, 0x336e1004, 0x336f1004,
+        0x33701004, 0x33711004, 0x33741004, 0x33761004, 0x33751004, 0x33771004, 0x33781004, 0x33721004,
+        0x33731004, 0x33791004, 0x337a1004, 0x337c1004, 0x337d1004, 0x337e1004, 0x337f1004, 0x33801004,
+        0x33811004, 0x33821004, 0x33831004, 0x33841004, 0x33851004, 0x33861004, 0x33871004, 0x33881004,
+        0x33891004, 0x338a1004, 0x338b1004, 0x338c1004, 0x338d1004, 0x338e1004, 0x338f1004, 0x33901004,
+        0x33911004, 0x33921004, 0x33931004, 0x33941004, 0x33951004, 0x33961004, 0x33971004, 0x33981004,
+        0x33991004, 0x339a1004, 0x339b1004, 0x339c1004, 0x339d1004, 0x339e1004, 0x339f1004, 0x33a01004,
+        0x33a11004, 0x337b1004, 0x33a21004, 0x33a31004, 0x339b102e, 0x339c102e, 0x339e102e, 0x33a0102e,
+        0x337a1032, 0x337c1032, 0x337f1032, 0x338a1032, 0x338e1032, 0x338f1032, 0x33931032, 0x339b1032,
+        0x339c1032, 0x339e1032, 0x33a01032, 0x33991032, 0x00006904, 0x33a41004, 0x042e1004, 0x042f1004,
+        0x04301004, 0x33a51004, 0x04311004, 0x04321004, 0x04331004, 0x04341004, 0x04351004, 0x49d61004,
+        0x49d71004, 0x49d81004, 0x49d91004, 0x49da1004, 0x49db1004, 0x49dc1004, 0x49dd1004, 0x49de1004,
+        0x49df1004, 0x49e01004, 0x49e11004, 0x49e21004, 0x49e31004, 0x49e41004, 0x49e51004, 0x49e61004,
+        0x49e71004, 0x49e81004, 0x49e91004, 0x49ea1004, 0x49cf1004, 0x49d01004, 0x49d11004, 0x49d21004,
+        0x49d31004, 0x49d41004, 0x49d51004, 0x49eb1004, 0x49ec1004, 0x49f21004, 0x49ed1004, 0x49ee1004,
+        0x49ef1004, 0x49f01004, 0x49f11004, 0x49f31004, 0x49f91004, 0x49f71004, 0x4a051004, 0x49fa1004,
+        0x49f81004, 0x4a061004, 0x4a011004, 0x49ff1004, 0x4a021004, 0x4a001004, 0x49f41004, 0x4a071004,
+        0x49f61004, 0x49f51004, 0x49fd1004, 0x49fb1004, 0x4a031004, 0x49fe1004, 0x49fc1004, 0x4a041004,
+        0x31db1004, 0x31dc1004, 0x31dd1004, 0x31de1004, 0x31df1004, 0x31e01004, 0x31e11004, 0x31e21004,
+        0x31e31004, 0x31e41004, 0x31e51004, 0x31e61004, 0x31e71004, 0x31e81004, 0x31e91004, 0x31ea1004,
+        0x31eb1004, 0x31ec1004, 0x31ed1004, 0x31ee1004, 0x31ef1004, 0x31f01004, 0x31f11004, 0x31f21004,
+        0x31f31004, 0x31f41004, 0x31f51004, 0x31f61004, 0x31f71004, 0x31f81004, 0x31f91004, 0x31fa1004,
+        0x31fb1004, 0x31fc1004, 0x31fd1004, 0x31fe1004, 0x31ff1004, 0x32001004, 0x32011004, 0x32021004,
+        0x32031004, 0x32041004, 0x32051004, 0x32061004, 0x32071004, 0x32081004, 0x320a1004, 0x320b1004,
+        0x320c1004, 0x320d1004, 0x320e1004, 0x320f1004, 0x32101004, 0x32111004, 0x32121004, 0x32131004,
+        0x32141004, 0x32151004, 0x32161004, 0x32091004, 0x02c71004, 0x02c81004, 0x046b1004, 0x046c1004,
+        0x046d1004, 0x1e631004, 0x1e641004, 0x1e651004, 0x1e661004, 0x1e671004, 0x1e681004, 0x1e691004,
+        0x1e6a1004, 0x1e6b1004, 0x1e6c1004, 0x04361004, 0x04371004, 0x33a61004, 0x33a81004, 0x33aa1004,
+        0x33ac1004, 0x33ae1004, 0x33b01004, 0x33b21004, 0x33b41004, 0x33b61004, 0x33b81004, 0x33ba1004,
+        0x33bc1004, 0x33be1004, 0x33c01004, 0x33c21004, 0x33c41004, 0x33c61004, 0x33c81004, 0x33ca1004,
+        0x33cc1004, 0x33ce1004, 0x33d01004, 0x33d21004, 0x33d31004, 0x33d51004, 0x33d71004, 0x33d91004,
+        0x33db1004, 0x33dd1004, 0x33df1004, 0x33a71004, 0x33a91004, 0x33ab1004, 0x33ad1004, 0x33af1004,
+        0x33b11004, 0x33b31004, 0x33b51004, 0x33b71004, 0x33b91004, 0x33bb1004, 0x33bd1004, 0x33bf1004,
+        0x33c11004, 0x33c31004, 0x33c51004, 0x33c71004, 0x33c91004, 0x33cb1004, 0x33cd1004, 0x33cf1004,
+        0x33d11004, 0x33d41004, 0x33d61004, 0x33d81004, 0x33da1004, 0x33dc1004, 0x33de1004, 0x33e01004,
+        0x33e11004, 0x33e21004, 0x33e31004, 0x33e41004, 0x33e51004, 0x30cc1004, 0x30cd1004, 0x30ce1004,
+        0x30cf1004, 0x30d01004, 0x30d11004, 0x30d21004, 0x30d31004, 0x30d41004, 0x30d51004, 0x30d61004,
+        0x30d71004, 0x30d81004, 0x30d91004, 0x30da1004, 0x30db1004, 0x30dc1004, 0x30dd1004, 0x30de1004,
+        0x30df1004, 0x30e01004, 0x30e11004, 0x30e21004, 0x30e31004, 0x30e41004, 0x30e51004, 0x30e61004,
+        0x30e71004, 0x30e81004, 0x30e91004, 0x30ea1004, 0x30eb1004, 0x30ec1004, 0x30ed1004, 0x30ee1004,
+        0x30ef1004, 0x30f01004, 0x30f11004, 0x30f21004, 0x30f31004, 0x30f41004, 0x30f51004, 0x30f61004,
+        0x30f71004, 0x30f81004, 0x30f91004, 0x30fa1004, 0x30fb1004, 0x30fc1004, 0x30fd1004, 0x30fe1004,
+        0x30ff1004, 0x31001004, 0x31011004, 0x31021004, 0x31031004, 0x31041004, 0x31051004, 0x31061004,
+        0x30f0102e, 0x30f01032, 0x31081004, 0x31091004, 0x310a1004, 0x310b1004, 0x310c1004, 0x310d1004,
+        0x310e1004, 0x310f1004, 0x31101004, 0x31111004, 0x31121004, 0x31131004, 0x31141004, 0x31151004,
+        0x31161004, 0x31171004, 0x31181004, 0x31191004, 0x311a1004, 0x311b1004, 0x311c1004, 0x311d1004,
+        0x311e1004, 0x311f1004, 0x31201004, 0x31211004, 0x31221004, 0x31231004, 0x31241004, 0x31251004,
+        0x31261004, 0x31271004, 0x31281004, 0x31291004, 0x312a1004, 0x312b1004, 0x312c1004, 0x312d1004,
+        0x312e1004, 0x312f1004, 0x31301004, 0x31311004, 0x31321004, 0x31331004, 0x31341004, 0x31351004,
+        0x31361004, 0x31371004, 0x31381004, 0x31391004, 0x31071004, 0x34f11004, 0x34f21004, 0x34f31004,
+        0x34f41004, 0x34f51004, 0x34f61004, 0x34f71004, 0x34f81004, 0x34f91004, 0x34fa1004, 0x34fb1004,
+        0x34fc1004, 0x34fd1004, 0x34fe1004, 0x34ff1004, 0x35001004, 0x35011004, 0x35021004, 0x35031004,
+        0x35041004, 0x35051004, 0x35061004, 0x35071004, 0x02f71004, 0x02f81004, 0x49121004, 0x1d6b1004,
+        0x1d6c1004, 0x1d6d1004, 0x1d6e1004, 0x1d6f1004, 0x1d701004, 0x1d711004, 0x1d721004, 0x1d731004,
+        0x1d741004, 0x1d751004, 0x1d761004, 0x1d771004, 0x1d781004, 0x1d791004, 0x1d7a1004, 0x1d7b1004,
+        0x1d7c1004, 0x1d7d1004, 0x1d7e1004, 0x1d7f1004, 0x05501004, 0x05511004, 0x05521004, 0x05531004,
+        0x05541004, 0x05551004, 0x05561004, 0x05571004, 0x1f711004, 0x1f721004, 0x1f731004, 0x1f741004,
+        0x05581004, 0x05591004, 0x055a1004, 0x055b1004, 0x055c1004, 0x055d1004, 0x055e1004, 0x055f1004,
+        0x05601004, 0x05611004, 0x05621004, 0x05631004, 0x05641004, 0x05651004, 0x05661004, 0x05671004,
+        0x05681004, 0x04a61004, 0x51491004, 0x514a1004, 0x514b1004, 0x514c1004, 0x514d1004, 0x514e1004,
+        0x514f1004, 0x51501004, 0x51511004, 0x51521004, 0x51531004, 0x51541004, 0x51551004, 0x51561004,
+        0x51571004, 0x51581004, 0x51591004, 0x515a1004, 0x515b1004, 0x515c1004, 0x515d1004, 0x515e1004,
+        0x515f1004, 0x51601004, 0x51611004, 0x51621004, 0x51631004, 0x51641004, 0x51651004, 0x51661004,
+        0x51671004, 0x51681004, 0x51691004, 0x516a1004, 0x516b1004, 0x516c1004, 0x516d1004, 0x516e1004,
+        0x516f1004, 0x51701004, 0x51711004, 0x51721004, 0x51731004, 0x51741004, 0x51751004, 0x51761004,
+        0x51771004, 0x51781004, 0x51791004, 0x517a1004, 0x517b1004, 0x517c1004, 0x517d1004, 0x517e1004,
+        0x517f1004, 0x51801004, 0x51811004, 0x51821004, 0x51831004, 0x51841004, 0x51851004, 0x51861004,
+        0x51871004, 0x51881004, 0x51891004, 0x518a1004, 0x518b1004, 0x518c1004, 0x518d1004, 0x518e1004,
+        0x518f1004, 0x51901004, 0x51911004, 0x51921004, 0x51931004, 0x51941004, 0x51951004, 0x51961004,
+        0x51971004, 0x51981004, 0x51991004, 0x519a1004, 0x519b1004, 0x519c1004, 0x519d1004, 0x519e1004,
+        0x519f1004, 0x51a01004, 0x51a11004, 0x51a21004, 0x51a31004, 0x51a41004, 0x51a51004, 0x51a61004,
+        0x51a71004, 0x51a81004, 0x51a91004, 0x51aa1004, 0x51ab1004, 0x51ac1004, 0x51ad1004, 0x51ae1004,
+        0x51af1004, 0x51b01004, 0x51b11004, 0x51b21004, 0x51b31004, 0x51b41004, 0x51b51004, 0x51b61004,
+        0x51b71004, 0x51b81004, 0x51b91004, 0x51ba1004, 0x51bb1004, 0x51bc1004, 0x51bd1004, 0x51be1004,
+        0x51bf1004, 0x51c01004, 0x51c11004, 0x51c21004, 0x51c31004, 0x51c41004, 0x51c51004, 0x51c61004,
+        0x51c71004, 0x51c81004, 0x51c91004, 0x51ca1004, 0x51cb1004, 0x51cc1004, 0x51cd1004, 0x51ce1004,
+        0x51cf1004, 0x51d01004, 0x51d11004, 0x51d21004, 0x51d31004, 0x51d41004, 0x51d51004, 0x51d61004,
+        0x51d71004, 0x51d81004, 0x51d91004, 0x51da1004, 0x51db1004, 0x51dc1004, 0x51dd1004, 0x51de1004,
+        0x51df1004, 0x51e01004, 0x51e11004, 0x51e21004, 0x51e31004, 0x51e41004, 0x51e51004, 0x51e61004,
+        0x51e71004, 0x51e81004, 0x51e91004, 0x51ea1004, 0x51eb1004, 0x51ec1004, 0x51ed1004, 0x51ee1004,
+        0x51ef1004, 0x51f01004, 0x51f11004, 0x51f21004, 0x51f31004, 0x51f41004, 0x51f51004, 0x51f61004,
+        0x51f71004, 0x51f81004, 0x51f91004, 0x51fa1004, 0x51fb1004, 0x51fc1004, 0x51fd1004, 0x51fe1004,
+        0x51ff1004, 0x52001004, 0x52011004, 0x52021004, 0x52031004, 0x52041004, 0x52051004, 0x52061004,
+        0x52071004, 0x52081004, 0x52091004, 0x520a1004, 0x520b1004, 0x520c1004, 0x520d1004, 0x520e1004,
+        0x520f1004, 0x52101004, 0x52111004, 0x52121004, 0x52131004, 0x52141004, 0x52151004, 0x52161004,
+        0x52171004, 0x52181004, 0x52191004, 0x521a1004, 0x521b1004, 0x521c1004, 0x521d1004, 0x521e1004,
+        0x521f1004, 0x52201004, 0x52211004, 0x52221004, 0x52231004, 0x52241004, 0x52251004, 0x52261004,
+        0x52271004, 0x52281004, 0x52291004, 0x522a1004, 0x522b1004, 0x522c1004, 0x522d1004, 0x522e1004,
+        0x522f1004, 0x52301004, 0x52311004, 0x52321004, 0x52331004, 0x52341004, 0x52351004, 0x52361004,
+        0x52371004, 0x52381004, 0x52391004, 0x523a1004, 0x523b1004, 0x523c1004, 0x523d1004, 0x523e1004,
+        0x523f1004, 0x52401004, 0x52411004, 0x52421004, 0x52431004, 0x52441004, 0x52451004, 0x52461004,
+        0x52471004, 0x52481004, 0x52491004, 0x524a1004, 0x524b1004, 0x524c1004, 0x524d1004, 0x524e1004,
+        0x524f1004, 0x52501004, 0x52511004, 0x52521004, 0x52531004, 0x52541004, 0x52551004, 0x52561004,
+        0x52571004, 0x52581004, 0x52591004, 0x525a1004, 0x525b1004, 0x525c1004, 0x525d1004, 0x525e1004,
+        0x525f1004, 0x52601004, 0x52611004, 0x52621004, 0x52631004, 0x52641004, 0x52651004, 0x52661004,
+        0x52671004, 0x52681004, 0x52691004, 0x526a1004, 0x526b1004, 0x526c1004, 0x526d1004, 0x526e1004,
+        0x526f1004, 0x52701004, 0x52711004, 0x52721004, 0x52731004, 0x52741004, 0x52751004, 0x52761004,
+        0x52771004, 0x52781004, 0x52791004, 0x527a1004, 0x527b1004, 0x527c1004, 0x527d1004, 0x527e1004,
+        0x527f1004, 0x52801004, 0x52811004, 0x52821004, 0x52831004, 0x52841004, 0x52851004, 0x52861004,
+        0x52871004, 0x52881004, 0x52891004, 0x528a1004, 0x528b1004, 0x528c1004, 0x528d1004, 0x528e1004,
+        0x528f1004, 0x52901004, 0x52911004, 0x52921004, 0x52931004, 0x52941004, 0x52951004, 0x52961004,
+        0x52971004, 0x52981004, 0x52991004, 0x529a1004, 0x529b1004, 0x529c1004, 0x529d1004, 0x529e1004,
+        0x529f1004, 0x52a01004, 0x52a11004, 0x52a21004, 0x52a31004, 0x52a41004, 0x52a51004, 0x52a61004,
+        0x52a71004, 0x52a81004, 0x52a91004, 0x52aa1004, 0x52ab1004, 0x52ac1004, 0x52ad1004, 0x52ae1004,
+        0x52af1004, 0x52b01004, 0x52b11004, 0x52b21004, 0x52b31004, 0x52b41004, 0x52b51004, 0x52b61004,
+        0x52b71004, 0x52b81004, 0x52b91004, 0x52ba1004, 0x52bb1004, 0x52bc1004, 0x52bd1004, 0x52be1004,
+        0x52bf1004, 0x52c01004, 0x52c11004, 0x52c21004, 0x52c31004, 0x52c41004, 0x52c51004, 0x52c61004,
+        0x52c71004, 0x52c81004, 0x52c91004, 0x52ca1004, 0x52cb1004, 0x52cc1004, 0x52cd1004, 0x52ce1004,
+        0x52cf1004, 0x52d01004, 0x52d11004, 0x52d21004, 0x52d31004, 0x52d41004, 0x52d51004, 0x52d61004,
+        0x52d71004, 0x52d81004, 0x52d91004, 0x52da1004, 0x52db1004, 0x52dc1004, 0x52dd1004, 0x52de1004,
+        0x52df1004, 0x52e01004, 0x52e11004, 0x52e21004, 0x52e31004, 0x52e41004, 0x52e51004, 0x52e61004,
+        0x52e71004, 0x52e81004, 0x52e91004, 0x52ea1004, 0x52eb1004, 0x52ec1004, 0x52ed1004, 0x52ee1004,
+        0x52ef1004, 0x52f01004, 0x52f11004, 0x52f21004, 0x52f31004, 0x52f41004, 0x52f51004, 0x52f61004,
+        0x52f71004, 0x52f81004, 0x52f91004, 0x52fa1004, 0x52fb1004, 0x52fc1004, 0x52fd1004, 0x52fe1004,
+        0x52ff1004, 0x53001004, 0x53011004, 0x53021004, 0x53031004, 0x53041004, 0x53051004, 0x53061004,
+        0x53071004, 0x53081004, 0x53091004, 0x530a1004, 0x530b1004, 0x530c1004, 0x530d1004, 0x530e1004,
+        0x530f1004, 0x53101004, 0x53111004, 0x53121004, 0x53131004, 0x53141004, 0x53151004, 0x53161004,
+        0x53171004, 0x53181004, 0x53191004, 0x531a1004, 0x531b1004, 0x531c1004, 0x531d1004, 0x531e1004,
+        0x531f1004, 0x53201004, 0x53211004, 0x53221004, 0x53231004, 0x53241004, 0x53251004, 0x53261004,
+        0x53271004, 0x53281004, 0x53291004, 0x532a1004, 0x532b1004, 0x532c1004, 0x532d1004, 0x532e1004,
+        0x532f1004, 0x53301004, 0x53311004, 0x53321004, 0x53331004, 0x53341004, 0x53351004, 0x53361004,
+        0x53371004, 0x53381004, 0x53391004, 0x533a1004, 0x533b1004, 0x533c1004, 0x533d1004, 0x533e1004,
+        0x533f1004, 0x53401004, 0x53411004, 0x53421004, 0x53431004, 0x53441004, 0x53451004, 0x53461004,
+        0x53471004, 0x53481004, 0x53491004, 0x534a1004, 0x534b1004, 0x534c1004, 0x534d1004, 0x534e1004,
+        0x534f1004, 0x53501004, 0x53511004, 0x53521004, 0x53531004, 0x53541004, 0x53551004, 0x53561004,
+        0x53571004, 0x53581004, 0x53591004, 0x535a1004, 0x535b1004, 0x535c1004, 0x535d1004, 0x535e1004,
+        0x535f1004, 0x53601004, 0x53611004, 0x53621004, 0x53631004, 0x53641004, 0x53651004, 0x53661004,
+        0x53671004, 0x53681004, 0x53691004, 0x536a1004, 0x536b1004, 0x536c1004, 0x536d1004, 0x536e1004,
+        0x536f1004, 0x53701004, 0x53711004, 0x53721004, 0x53731004, 0x53741004, 0x53751004, 0x53761004,
+        0x53771004, 0x53781004, 0x53791004, 0x537a1004, 0x537b1004, 0x537c1004, 0x537d1004, 0x537e1004,
+        0x537f1004, 0x53801004, 0x53811004, 0x53821004, 0x53831004, 0x53841004, 0x53851004, 0x53861004,
+        0x53871004, 0x53881004, 0x53891004, 0x538a1004, 0x538b1004, 0x538c1004, 0x538d1004, 0x538e1004,
+        0x538f1004, 0x53901004, 0x53911004, 0x53921004, 0x53931004, 0x53941004, 0x53951004, 0x53961004,
+        0x53971004, 0x53981004, 0x53991004, 0x539a1004, 0x539b1004, 0x539c1004, 0x539d1004, 0x539e1004,
+        0x539f1004, 0x53a01004, 0x53a11004, 0x53a21004, 0x53a31004, 0x53a41004, 0x53a51004, 0x53a61004,
+        0x53a71004, 0x53a81004, 0x53a91004, 0x53aa1004, 0x53ab1004, 0x53ae1004, 0x53af1004, 0x53b01004,
+        0x53b11004, 0x53b21004, 0x53b31004, 0x53b41004, 0x53b51004, 0x53b61004, 0x53b71004, 0x53b81004,
+        0x53b91004, 0x53ba1004, 0x53bb1004, 0x53bc1004, 0x53bd1004, 0x53be1004, 0x53bf1004, 0x53c01004,
+        0x53c11004, 0x53c21004, 0x53c31004, 0x53c41004, 0x53c51004, 0x53c61004, 0x53c71004, 0x53c81004,
+        0x53c91004, 0x53ca1004, 0x53cb1004, 0x53cc1004, 0x53cd1004, 0x53ce1004, 0x53cf1004, 0x53d01004,
+        0x53d11004, 0x53d21004, 0x53d31004, 0x53d41004, 0x53d51004, 0x53d61004, 0x53d71004, 0x53d81004,
+        0x53d91004, 0x53da1004, 0x53db1004, 0x53dc1004, 0x53dd1004, 0x53de1004, 0x53df1004, 0x53e01004,
+        0x53e11004, 0x53e21004, 0x53e31004, 0x53e41004, 0x53e51004, 0x53e61004, 0x53e71004, 0x53e81004,
+        0x53e91004, 0x53ea1004, 0x53eb1004, 0x53ec1004, 0x53ed1004, 0x53ee1004, 0x53ef1004, 0x53f01004,
+        0x53f11004, 0x53f21004, 0x53f31004, 0x53f41004, 0x53f51004, 0x53f61004, 0x53f71004, 0x53f81004,
+        0x53f91004, 0x53fa1004, 0x53fb1004, 0x53fc1004, 0x53fd1004, 0x53fe1004, 0x53ff1004, 0x54001004,
+        0x54011004, 0x54021004, 0x54031004, 0x54041004, 0x54051004, 0x54061004, 0x54071004, 0x54081004,
+        0x54091004, 0x540a1004, 0x540b1004, 0x540c1004, 0x540d1004, 0x540e1004, 0x540f1004, 0x54101004,
+        0x54111004, 0x54121004, 0x54131004, 0x54141004, 0x54151004, 0x54161004, 0x54171004, 0x54181004,
+        0x54191004, 0x541a1004, 0x541b1004, 0x541c1004, 0x541d1004, 0x541e1004, 0x53ac1004, 0x53ad1004,
+        0x541f1004, 0x54201004, 0x54211004, 0x54221004, 0x54231004, 0x54241004, 0x54251004, 0x54261004,
+        0x54271004, 0x54281004, 0x54291004, 0x542a1004, 0x542b1004, 0x542c1004, 0x542d1004, 0x542e1004,
+        0x542f1004, 0x54301004, 0x54311004, 0x54321004, 0x54331004, 0x54341004, 0x54351004, 0x54361004,
+        0x54371004, 0x54381004, 0x54391004, 0x543a1004, 0x543b1004, 0x543c1004, 0x543d1004, 0x543e1004,
+        0x543f1004, 0x54401004, 0x54411004, 0x54421004, 0x54431004, 0x54441004, 0x54451004, 0x54461004,
+        0x54471004, 0x54481004, 0x54491004, 0x544a1004, 0x544b1004, 0x544c1004, 0x544d1004, 0x544e1004,
+        0x544f1004, 0x54501004, 0x54511004, 0x54521004, 0x54531004, 0x54541004, 0x54551004, 0x54561004,
+        0x54571004, 0x54581004, 0x54591004, 0x545a1004, 0x545b1004, 0x545c1004, 0x545d1004, 0x545e1004,
+        0x545f1004, 0x54601004, 0x54611004, 0x54621004, 0x54631004, 0x54641004, 0x54651004, 0x54661004,
+        0x54671004, 0x54681004, 0x54691004, 0x546a1004, 0x546b1004, 0x546c1004, 0x546d1004, 0x546e1004,
+        0x546f1004, 0x54701004, 0x54711004, 0x54721004, 0x54731004, 0x54741004, 0x54751004, 0x54761004,
+        0x54771004, 0x54781004, 0x54791004, 0x547a1004, 0x547b1004, 0x547c1004, 0x547d1004, 0x547e1004,
+        0x547f1004, 0x54801004, 0x54811004, 0x54821004, 0x54831004, 0x54841004, 0x54851004, 0x54861004,
+        0x54871004, 0x54881004, 0x54891004, 0x548a1004, 0x548b1004, 0x548c1004, 0x548d1004, 0x548e1004,
+        0x548f1004, 0x54901004, 0x54911004, 0x54921004, 0x54931004, 0x54941004, 0x54951004, 0x54961004,
+        0x54971004, 0x54981004, 0x54991004, 0x549a1004, 0x549b1004, 0x549c1004, 0x549d1004, 0x549e1004,
+        0x549f1004, 0x54a01004, 0x54a11004, 0x54a21004, 0x54a31004, 0x54a41004, 0x54a51004, 0x54a61004,
+        0x54a71004, 0x54a81004, 0x54a91004, 0x54aa1004, 0x54ab1004, 0x54ac1004, 0x54ad1004, 0x54ae1004,
+        0x54af1004, 0x54b01004, 0x54b11004, 0x54b21004, 0x54b31004, 0x54b41004, 0x54b51004, 0x54b61004,
+        0x54b71004, 0x54b81004, 0x54b91004, 0x54ba1004, 0x54bb1004, 0x54bc1004, 0x54bd1004, 0x54be1004,
+        0x54bf1004, 0x54c01004, 0x54c11004, 0x54c21004, 0x54c31004, 0x54c41004, 0x54c51004, 0x54c61004,
+        0x54c71004, 0x54c81004, 0x54c91004, 0x54ca1004, 0x54cb1004, 0x54cc1004, 0x54cd1004, 0x54ce1004,
+        0x54cf1004, 0x54d01004, 0x54d11004, 0x54d21004, 0x54d31004, 0x54d41004, 0x54d51004, 0x54d61004,
+        0x54d71004, 0x54d81004, 0x54d91004, 0x54da1004, 0x54db1004, 0x54dc1004, 0x54dd1004, 0x54de1004,
+        0x54df1004, 0x54e01004, 0x54e11004, 0x54e21004, 0x1f2c1004, 0x1f2d1004, 0x1f2e1004, 0x1f2f1004,
+        0x1f301004, 0x1f311004, 0x1f321004, 0x1f331004, 0x1f341004, 0x1f351004, 0x1f361004, 0x1f371004,
+        0x1f381004, 0x1f391004, 0x1f3a1004, 0x1f3b1004, 0x1f3c1004, 0x03111004, 0x03121004, 0x03131004,
+        0x03141004, 0x03151004, 0x54e31004, 0x54e41004, 0x54e51004, 0x54e61004, 0x54e71004, 0x54e81004,
+        0x54e91004, 0x54ea1004, 0x54eb1004, 0x54ec1004, 0x54ed1004, 0x54ee1004, 0x54ef1004, 0x54f01004,
+        0x54f11004, 0x54f21004, 0x54f31004, 0x54f41004, 0x54f51004, 0x54f61004, 0x54f71004, 0x54f81004,
+        0x54f91004, 0x54fa1004, 0x54fb1004, 0x54fc1004, 0x54fd1004, 0x54fe1004, 0x54ff1004, 0x55001004,
+        0x55011004, 0x55021004, 0x55031004, 0x55041004, 0x55051004, 0x55061004, 0x55071004, 0x55081004,
+        0x55091004, 0x550a1004, 0x550b1004, 0x550c1004, 0x550d1004, 0x550e1004, 0x550f1004, 0x55101004,
+        0x55111004, 0x55121004, 0x55131004, 0x55141004, 0x55151004, 0x55161004, 0x55171004, 0x55181004,
+        0x55191004, 0x551a1004, 0x551b1004, 0x551c1004, 0x551d1004, 0x551e1004, 0x551f1004, 0x55201004,
+        0x55211004, 0x55221004, 0x55231004, 0x55241004, 0x55251004, 0x55261004, 0x55271004, 0x55281004,
+        0x55291004, 0x552a1004, 0x552b1004, 0x552c1004, 0x552d1004, 0x552e1004, 0x552f1004, 0x55301004,
+        0x55311004, 0x55321004, 0x55331004, 0x55341004, 0x55351004, 0x55361004, 0x55371004, 0x55381004,
+        0x55391004, 0x553a1004, 0x553b1004, 0x553c1004, 0x553d1004, 0x553e1004, 0x553f1004, 0x55401004,
+        0x55411004, 0x55421004, 0x55431004, 0x55441004, 0x55451004, 0x55461004, 0x55471004, 0x55481004,
+        0x55491004, 0x554a1004, 0x554b1004, 0x554c1004, 0x554d1004, 0x554e1004, 0x554f1004, 0x55501004,
+        0x55511004, 0x55521004, 0x55531004, 0x55541004, 0x55551004, 0x55561004, 0x55571004, 0x55581004,
+        0x55591004, 0x555a1004, 0x555b1004, 0x555c1004, 0x555d1004, 0x555e1004, 0x555f1004, 0x55601004,
+        0x55611004, 0x55621004, 0x55631004, 0x55641004, 0x55651004, 0x55661004, 0x55671004, 0x55681004,
+        0x55691004, 0x556a1004, 0x556b1004, 0x556c1004, 0x556d1004, 0x556e1004, 0x556f1004, 0x55701004,
+        0x55711004, 0x55721004, 0x55731004, 0x55741004, 0x55751004, 0x55761004, 0x55771004, 0x55781004,
+        0x55791004, 0x557a1004, 0x557b1004, 0x557c1004, 0x557d1004, 0x557e1004, 0x557f1004, 0x55801004,
+        0x55811004, 0x55821004, 0x55831004, 0x55841004, 0x55851004, 0x55861004, 0x55871004, 0x55881004,
+        0x55891004, 0x558a1004, 0x558b1004, 0x558c1004, 0x558d1004, 0x558e1004, 0x558f1004, 0x55901004,
+        0x55911004, 0x55921004, 0x55931004, 0x55941004, 0x55951004, 0x55961004, 0x55971004, 0x55981004,
+        0x55991004, 0x559a1004, 0x559b1004, 0x559c1004, 0x559d1004, 0x559e1004, 0x559f1004, 0x55a01004,
+        0x55a11004, 0x55a21004, 0x55a31004, 0x55a41004, 0x55a51004, 0x55a61004, 0x55a71004, 0x55a81004,
+        0x55a91004, 0x55aa1004, 0x55ab1004, 0x55ac1004, 0x55ad1004, 0x55ae1004, 0x55af1004, 0x55b01004,
+        0x55b11004, 0x55b21004, 0x55b31004, 0x55b41004, 0x55b51004, 0x55b61004, 0x55b71004, 0x55b81004,
+        0x55b91004, 0x55ba1004, 0x55bb1004, 0x55bc1004, 0x55bd1004, 0x55be1004, 0x55bf1004, 0x55c01004,
+        0x55c11004, 0x55c21004, 0x55c31004, 0x55c41004, 0x55c51004, 0x55c61004, 0x55c71004, 0x55c81004,
+        0x55c91004, 0x55ca1004, 0x55cb1004, 0x55cc1004, 0x55cd1004, 0x55ce1004, 0x55cf1004, 0x55d01004,
+        0x55d11004, 0x55d21004, 0x55d31004, 0x55d41004, 0x55d51004, 0x55d61004, 0x55d71004, 0x55d81004,
+        0x55d91004, 0x55da1004, 0x55db1004, 0x55dc1004, 0x55dd1004, 0x55de1004, 0x55df1004, 0x55e01004,
+        0x55e11004, 0x55e21004, 0x55e31004, 0x55e41004, 0x55e51004, 0x55e61004, 0x55e71004, 0x55e81004,
+        0x55e91004, 0x55ea1004, 0x55eb1004, 0x55ec1004, 0x55ed1004, 0x55ee1004, 0x55ef1004, 0x55f01004,
+        0x55f11004, 0x55f21004, 0x55f31004, 0x55f41004, 0x55f51004, 0x55f61004, 0x55f71004, 0x55f81004,
+        0x55f91004, 0x55fa1004, 0x55fb1004, 0x55fc1004, 0x55fd1004, 0x55fe1004, 0x55ff1004, 0x56001004,
+        0x56011004, 0x56021004, 0x56031004, 0x56041004, 0x56051004, 0x56061004, 0x56071004, 0x56081004,
+        0x56091004, 0x560a1004, 0x560b1004, 0x560c1004, 0x560d1004, 0x560e1004, 0x560f1004, 0x56101004,
+        0x56111004, 0x56121004, 0x56131004, 0x56141004, 0x56151004, 0x56161004, 0x56171004, 0x56181004,
+        0x56191004, 0x561a1004, 0x561b1004, 0x561c1004, 0x561d1004, 0x561e1004, 0x561f1004, 0x56201004,
+        0x56211004, 0x56221004, 0x56231004, 0x56241004, 0x56251004, 0x56261004, 0x56271004, 0x56281004,
+        0x56291004, 0x562a1004, 0x562b1004, 0x562c1004, 0x562d1004, 0x562e1004, 0x562f1004, 0x56301004,
+        0x56311004, 0x56321004, 0x56331004, 0x56341004, 0x56351004, 0x56361004, 0x56371004, 0x56381004,
+        0x56391004, 0x563a1004, 0x563b1004, 0x563c1004, 0x563d1004, 0x563e1004, 0x563f1004, 0x56401004,
+        0x56411004, 0x56421004, 0x56431004, 0x56441004, 0x56451004, 0x56461004, 0x56471004, 0x56481004,
+        0x56491004, 0x564a1004, 0x564b1004, 0x564c1004, 0x564d1004, 0x564e1004, 0x564f1004, 0x56501004,
+        0x56511004, 0x56521004, 0x56531004, 0x56541004, 0x56551004, 0x56561004, 0x56571004, 0x56581004,
+        0x56591004, 0x565a1004, 0x565b1004, 0x565c1004, 0x565d1004, 0x565e1004, 0x565f1004, 0x56601004,
+        0x56611004, 0x56621004, 0x56631004, 0x56641004, 0x56651004, 0x56661004, 0x56671004, 0x56681004,
+        0x56691004, 0x566a1004, 0x566b1004, 0x566c1004, 0x566d1004, 0x566e1004, 0x566f1004, 0x56701004,
+        0x56711004, 0x56721004, 0x56731004, 0x56741004, 0x56751004, 0x56761004, 0x56771004, 0x56781004,
+        0x56791004, 0x567a1004, 0x567b1004, 0x567c1004, 0x567d1004, 0x567e1004, 0x567f1004, 0x56801004,
+        0x56811004, 0x56821004, 0x56831004, 0x56841004, 0x56851004, 0x56861004, 0x56871004, 0x56881004,
+        0x56891004, 0x568a1004, 0x568b1004, 0x568c1004, 0x568d1004, 0x568e1004, 0x568f1004, 0x56901004,
+        0x56911004, 0x56921004, 0x56931004, 0x56941004, 0x56951004, 0x56961004, 0x56971004, 0x56981004,
+        0x56991004, 0x569a1004, 0x569b1004, 0x569c1004, 0x569d1004, 0x569e1004, 0x569f1004, 0x56a01004,
+        0x56a11004, 0x56a21004, 0x56a31004, 0x56a41004, 0x56a51004, 0x56a61004, 0x56a71004, 0x56a81004,
+        0x56a91004, 0x56aa1004, 0x56ab1004, 0x56ac1004, 0x56ad1004, 0x56ae1004, 0x56af1004, 0x56b01004,
+        0x56b11004, 0x56b21004, 0x56b31004, 0x56b41004, 0x56b51004, 0x56b61004, 0x56b71004, 0x56b81004,
+        0x56b91004, 0x56ba1004, 0x56bb1004, 0x56bc1004, 0x56bd1004, 0x56be1004, 0x56bf1004, 0x56c01004,
+        0x56c11004, 0x56c21004, 0x56c31004, 0x56c41004, 0x56c51004, 0x56c61004, 0x56c71004, 0x56c81004,
+        0x56c91004, 0x56ca1004, 0x56cb1004, 0x56cc1004, 0x56cd1004, 0x56ce1004, 0x56cf1004, 0x56d01004,
+        0x56d11004, 0x56d21004, 0x56d31004, 0x56d41004, 0x56d51004, 0x56d61004, 0x56d71004, 0x56d81004,
+        0x56d91004, 0x56da1004, 0x56db1004, 0x56dc1004, 0x56dd1004, 0x56de1004, 0x56df1004, 0x56e01004,
+        0x56e11004, 0x56e21004, 0x56e31004, 0x56e41004, 0x56e51004, 0x56e61004, 0x56e71004, 0x56e81004,
+        0x56e91004, 0x56ea1004, 0x56eb1004, 0x56ec1004, 0x56ed1004, 0x56ee1004, 0x56ef1004, 0x56f01004,
+        0x56f11004, 0x56f21004, 0x56f31004, 0x56f41004, 0x56f51004, 0x56f61004, 0x56f71004, 0x56f81004,
+        0x56f91004, 0x56fa1004, 0x56fb1004, 0x56fc1004, 0x56fd1004, 0x56fe1004, 0x56ff1004, 0x57001004,
+        0x57011004, 0x57021004, 0x57031004, 0x57041004, 0x57051004, 0x57061004, 0x57071004, 0x57081004,
+        0x57091004, 0x570a1004, 0x570b1004, 0x570c1004, 0x570d1004, 0x570e1004, 0x570f1004, 0x57101004,
+        0x57111004, 0x57121004, 0x57131004, 0x57141004, 0x57151004, 0x57161004, 0x57171004, 0x57181004,
+        0x57191004, 0x571a1004, 0x571b1004, 0x571c1004, 0x571d1004, 0x571e1004, 0x571f1004, 0x57201004,
+        0x57211004, 0x57221004, 0x57231004, 0x57241004, 0x57251004, 0x57261004, 0x57271004, 0x57281004,
+        0x57291004, 0x572a1004, 0x572b1004, 0x572c1004, 0x572d1004, 0x572e1004, 0x572f1004, 0x57301004,
+        0x57311004, 0x57321004, 0x57331004, 0x57341004, 0x57351004, 0x57361004, 0x57371004, 0x57381004,
+        0x57391004, 0x573a1004, 0x573b1004, 0x573c1004, 0x573d1004, 0x573e1004, 0x573f1004, 0x57401004,
+        0x57411004, 0x57421004, 0x57431004, 0x57441004, 0x57451004, 0x57461004, 0x57471004, 0x57481004,
+        0x57491004, 0x574a1004, 0x574b1004, 0x574c1004, 0x574d1004, 0x574e1004, 0x574f1004, 0x57501004,
+        0x57511004, 0x57521004, 0x57531004, 0x57541004, 0x57551004, 0x57561004, 0x57571004, 0x57581004,
+        0x57591004, 0x575a1004, 0x575b1004, 0x575c1004, 0x575d1004, 0x575e1004, 0x575f1004, 0x57601004,
+        0x57611004, 0x57621004, 0x57631004, 0x57641004, 0x57651004, 0x57661004, 0x57671004, 0x57681004,
+        0x57691004, 0x576a1004, 0x576b1004, 0x576c1004, 0x576d1004, 0x576e1004, 0x576f1004, 0x57701004,
+        0x57711004, 0x57721004, 0x57731004, 0x57741004, 0x57751004, 0x57761004, 0x57771004, 0x57781004,
+        0x57791004, 0x577a1004, 0x577b1004, 0x577c1004, 0x577d1004, 0x577e1004, 0x577f1004, 0x57801004,
+        0x57811004, 0x57821004, 0x57831004, 0x57841004, 0x57851004, 0x57861004, 0x57871004, 0x57881004,
+        0x57891004, 0x578a1004, 0x578b1004, 0x578c1004, 0x578d1004, 0x578e1004, 0x578f1004, 0x57901004,
+        0x57911004, 0x57921004, 0x57931004, 0x57941004, 0x57951004, 0x57961004, 0x57971004, 0x57981004,
+        0x57991004, 0x579a1004, 0x579b1004, 0x579c1004, 0x579d1004, 0x579e1004, 0x579f1004, 0x57a01004,
+        0x57a11004, 0x57a21004, 0x57a31004, 0x57a41004, 0x57a51004, 0x57a61004, 0x57a71004, 0x57a81004,
+        0x57a91004, 0x57aa1004, 0x57ab1004, 0x57ac1004, 0x57ad1004, 0x57ae1004, 0x57af1004, 0x57b01004,
+        0x57b11004, 0x57b21004, 0x57b31004, 0x57b41004, 0x57b51004, 0x57b61004, 0x57b71004, 0x57b81004,
+        0x57b91004, 0x57ba1004, 0x57bb1004, 0x57bc1004, 0x57bd1004, 0x57be1004, 0x57bf1004, 0x57c01004,
+        0x57c11004, 0x57c21004, 0x57c31004, 0x57c41004, 0x57c51004, 0x57c61004, 0x57c71004, 0x57c81004,
+        0x57c91004, 0x57ca1004, 0x57cb1004, 0x57cc1004, 0x57cd1004, 0x57ce1004, 0x57cf1004, 0x57d01004,
+        0x57d11004, 0x57d21004, 0x57d31004, 0x57d41004, 0x57d51004, 0x57d61004, 0x57d71004, 0x57d81004,
+        0x57d91004, 0x57da1004, 0x57db1004, 0x57dc1004, 0x57dd1004, 0x57de1004, 0x57df1004, 0x57e01004,
+        0x57e11004, 0x57e21004, 0x57e31004, 0x57e41004, 0x57e51004, 0x57e61004, 0x57e71004, 0x57e81004,
+        0x57e91004, 0x57ea1004, 0x57eb1004, 0x57ec1004, 0x57ed1004, 0x57ee1004, 0x57ef1004, 0x57f01004,
+        0x57f11004, 0x57f21004, 0x57f31004, 0x57f41004, 0x57f51004, 0x57f61004, 0x57f71004, 0x57f81004,
+        0x57f91004, 0x57fa1004, 0x57fb1004, 0x57fc1004, 0x57fd1004, 0x57fe1004, 0x57ff1004, 0x58001004,
+        0x58011004, 0x58021004, 0x58031004, 0x58041004, 0x58051004, 0x58061004, 0x58071004, 0x58081004,
+        0x58091004, 0x580a1004, 0x580b1004, 0x580c1004, 0x580d1004, 0x580e1004, 0x580f1004, 0x58101004,
+        0x58111004, 0x58121004, 0x58131004, 0x58141004, 0x58151004, 0x58161004, 0x58171004, 0x58181004,
+        0x58191004, 0x581a1004, 0x581b1004, 0x581c1004, 0x581d1004, 0x581e1004, 0x581f1004, 0x58201004,
+        0x58211004, 0x58221004, 0x58231004, 0x58241004, 0x58251004, 0x58261004, 0x58271004, 0x58281004,
+        0x58291004, 0x582a1004, 0x582b1004, 0x582c1004, 0x582d1004, 0x582e1004, 0x582f1004, 0x58301004,
+        0x58311004, 0x58321004, 0x58331004, 0x58341004, 0x58351004, 0x58361004, 0x58371004, 0x58381004,
+        0x58391004, 0x583a1004, 0x583b1004, 0x583c1004, 0x583d1004, 0x583e1004, 0x583f1004, 0x58401004,
+        0x58411004, 0x58421004, 0x58431004, 0x58441004, 0x58451004, 0x58461004, 0x58471004, 0x58481004,
+        0x58491004, 0x584a1004, 0x584b1004, 0x584c1004, 0x584d1004, 0x584e1004, 0x584f1004, 0x58501004,
+        0x58511004, 0x58521004, 0x58531004, 0x58541004, 0x58551004, 0x58561004, 0x58571004, 0x58581004,
+        0x58591004, 0x585a1004, 0x585b1004, 0x585c1004, 0x585d1004, 0x585e1004, 0x585f1004, 0x58601004,
+        0x58611004, 0x58621004, 0x58631004, 0x58641004, 0x58651004, 0x58661004, 0x58671004, 0x58681004,
+        0x58691004, 0x586a1004, 0x586b1004, 0x586c1004, 0x586d1004, 0x586e1004, 0x586f1004, 0x58701004,
+        0x58711004, 0x58721004, 0x58731004, 0x58741004, 0x58751004, 0x58761004, 0x58771004, 0x58781004,
+        0x58791004, 0x587a1004, 0x587b1004, 0x587c1004, 0x587d1004, 0x587e1004, 0x587f1004, 0x58801004,
+        0x58811004, 0x58821004, 0x58831004, 0x58841004, 0x58851004, 0x58861004, 0x58871004, 0x58881004,
+        0x58891004, 0x588a1004, 0x588b1004, 0x588c1004, 0x588d1004, 0x588e1004, 0x588f1004, 0x58901004,
+        0x58911004, 0x58921004, 0x58931004, 0x58941004, 0x58951004, 0x58961004, 0x58971004, 0x58981004,
+        0x58991004, 0x589a1004, 0x589b1004, 0x589c1004, 0x589d1004, 0x589e1004, 0x589f1004, 0x58a01004,
+        0x58a11004, 0x58a21004, 0x58a31004, 0x58a41004, 0x58a51004, 0x58a61004, 0x58a71004, 0x58a81004,
+        0x58a91004, 0x58aa1004, 0x58ab1004, 0x58ac1004, 0x58ad1004, 0x58ae1004, 0x58af1004, 0x58b01004,
+        0x58b11004, 0x58b21004, 0x58b31004, 0x58b41004, 0x58b51004, 0x58b61004, 0x58b71004, 0x58b81004,
+        0x58b91004, 0x58ba1004, 0x58bb1004, 0x58bc1004, 0x58bd1004, 0x58be1004, 0x58bf1004, 0x58c01004,
+        0x58c11004, 0x58c21004, 0x58c31004, 0x58c41004, 0x58c51004, 0x58c61004, 0x58c71004, 0x58c81004,
+        0x58c91004, 0x58ca1004, 0x58cb1004, 0x58cc1004, 0x58cd1004, 0x58ce1004, 0x58cf1004, 0x58d01004,
+        0x58d11004, 0x58d21004, 0x58d31004, 0x58d41004, 0x58d51004, 0x58d61004, 0x58d71004, 0x58d81004,
+        0x58d91004, 0x58da1004, 0x58db1004, 0x58dc1004, 0x58dd1004, 0x58de1004, 0x58df1004, 0x58e01004,
+        0x58e11004, 0x58e21004, 0x58e31004, 0x58e41004, 0x58e51004, 0x58e61004, 0x58e71004, 0x58e81004,
+        0x58e91004, 0x58ea1004, 0x58eb1004, 0x58ec1004, 0x58ed1004, 0x58ee1004, 0x58ef1004, 0x58f01004,
+        0x58f11004, 0x58f21004, 0x58f31004, 0x58f41004, 0x58f51004, 0x58f61004, 0x58f71004, 0x58f81004,
+        0x58f91004, 0x58fa1004, 0x58fb1004, 0x58fc1004, 0x58fd1004, 0x58fe1004, 0x58ff1004, 0x59001004,
+        0x59011004, 0x59021004, 0x59031004, 0x59041004, 0x59051004, 0x59061004, 0x59071004, 0x59081004,
+        0x59091004, 0x590a1004, 0x590b1004, 0x590c1004, 0x590d1004, 0x590e1004, 0x590f1004, 0x59101004,
+        0x59111004, 0x59121004, 0x59131004, 0x59141004, 0x59151004, 0x59161004, 0x59171004, 0x59181004,
+        0x59191004, 0x591a1004, 0x591b1004, 0x591c1004, 0x591d1004, 0x591e1004, 0x591f1004, 0x59201004,
+        0x59211004, 0x59221004, 0x59231004, 0x59241004, 0x59251004, 0x59261004, 0x59271004, 0x59281004,
+        0x59291004, 0x592a1004, 0x592b1004, 0x592c1004, 0x592d1004, 0x592e1004, 0x592f1004, 0x59301004,
+        0x59311004, 0x59321004, 0x59331004, 0x59341004, 0x59351004, 0x59361004, 0x59371004, 0x59381004,
+        0x59391004, 0x593a1004, 0x593b1004, 0x593c1004, 0x593d1004, 0x593e1004, 0x593f1004, 0x59401004,
+        0x59411004, 0x59421004, 0x59431004, 0x59441004, 0x59451004, 0x59461004, 0x59471004, 0x59481004,
+        0x59491004, 0x594a1004, 0x594b1004, 0x594c1004, 0x594d1004, 0x594e1004, 0x594f1004, 0x59501004,
+        0x59511004, 0x59521004, 0x59531004, 0x59541004, 0x59551004, 0x59561004, 0x59571004, 0x59581004,
+        0x59591004, 0x595a1004, 0x595b1004, 0x595c1004, 0x595d1004, 0x595e1004, 0x595f1004, 0x59601004,
+        0x59611004, 0x59621004, 0x59631004, 0x59641004, 0x59651004, 0x59661004, 0x59671004, 0x59681004,
+        0x59691004, 0x596a1004, 0x596b1004, 0x596c1004, 0x596d1004, 0x596e1004, 0x596f1004, 0x59701004,
+        0x59711004, 0x59721004, 0x59731004, 0x59741004, 0x59751004, 0x59761004, 0x59771004, 0x59781004,
+        0x59791004, 0x597a1004, 0x597b1004, 0x597c1004, 0x597d1004, 0x597e1004, 0x597f1004, 0x59801004,
+        0x59811004, 0x59821004, 0x59831004, 0x59841004, 0x59851004, 0x59861004, 0x59871004, 0x59881004,
+        0x59891004, 0x598a1004, 0x598b1004, 0x598c1004, 0x598d1004, 0x598e1004, 0x598f1004, 0x59901004,
+        0x59911004, 0x59921004, 0x59931004, 0x59941004, 0x59951004, 0x59961004, 0x59971004, 0x59981004,
+        0x59991004, 0x599a1004, 0x599b1004, 0x599c1004, 0x599d1004, 0x599e1004, 0x599f1004, 0x59a01004,
+        0x59a11004, 0x59a21004, 0x59a31004, 0x59a41004, 0x59a51004, 0x59a61004, 0x59a71004, 0x59a81004,
+        0x59a91004, 0x59aa1004, 0x59ab1004, 0x59ac1004, 0x59ad1004, 0x59ae1004, 0x59af1004, 0x59b01004,
+        0x59b11004, 0x59b21004, 0x59b31004, 0x59b41004, 0x59b51004, 0x59b61004, 0x59b71004, 0x59b81004,
+        0x59b91004, 0x59ba1004, 0x59bb1004, 0x59bc1004, 0x59bd1004, 0x59be1004, 0x59bf1004, 0x59c01004,
+        0x59c11004, 0x59c21004, 0x59c31004, 0x59c41004, 0x59c51004, 0x59c61004, 0x59c71004, 0x59c81004,
+        0x59c91004, 0x59ca1004, 0x59cb1004, 0x59cc1004, 0x59cd1004, 0x59ce1004, 0x59cf1004, 0x59d01004,
+        0x59d11004, 0x59d21004, 0x59d31004, 0x59d41004, 0x59d51004, 0x59f11004, 0x59f21004, 0x59f31004,
+        0x59f41004, 0x59f51004, 0x59f61004, 0x59f71004, 0x59f81004, 0x59f91004, 0x59fa1004, 0x59fb1004,
+        0x59fc1004, 0x59fd1004, 0x59fe1004, 0x59ff1004, 0x5a001004, 0x5a011004, 0x5a021004, 0x5a031004,
+        0x5a041004, 0x5a051004, 0x5a061004, 0x5a071004, 0x5a081004, 0x5a091004, 0x5a0a1004, 0x5a0b1004,
+        0x5a0c1004, 0x5a0d1004, 0x5a0e1004, 0x5a0f1004, 0x5a101004, 0x5a111004, 0x5a121004, 0x5a131004,
+        0x5a141004, 0x5a151004, 0x5a161004, 0x5a171004, 0x5a181004, 0x5a191004, 0x5a1a1004, 0x5a1b1004,
+        0x5a1c1004, 0x5a1d1004, 0x5a1e1004, 0x5a1f1004, 0x5a201004, 0x5a211004, 0x5a221004, 0x5a231004,
+        0x5a241004, 0x5a251004, 0x5a261004, 0x5a271004, 0x5a281004, 0x5a291004, 0x5a2a1004, 0x5a2b1004,
+        0x5a2c1004, 0x5a2d1004, 0x5a2e1004, 0x5a2f1004, 0x5a301004, 0x5a311004, 0x5a321004, 0x5a331004,
+        0x5a341004, 0x5a351004, 0x5a361004, 0x5a371004, 0x5a381004, 0x5a391004, 0x5a3a1004, 0x5a3b1004,
+        0x5a3c1004, 0x5a3d1004, 0x5a3e1004, 0x5a3f1004, 0x5a401004, 0x5a411004, 0x5a421004, 0x5a431004,
+        0x5a441004, 0x5a451004, 0x5a461004, 0x5a471004, 0x5a481004, 0x5a491004, 0x5a4a1004, 0x5a4b1004,
+        0x5a4c1004, 0x5a4d1004, 0x5a4e1004, 0x5a4f1004, 0x5a501004, 0x5a511004, 0x5a521004, 0x5a531004,
+        0x5a541004, 0x5a551004, 0x5a561004, 0x5a571004, 0x5a581004, 0x5a591004, 0x5a5a1004, 0x5a5b1004,
+        0x5a5c1004, 0x5a5d1004, 0x5a5e1004, 0x5a5f1004, 0x5a601004, 0x5a611004, 0x5a621004, 0x5a631004,
+        0x5a641004, 0x5a651004, 0x5a661004, 0x5a671004, 0x5a681004, 0x5a691004, 0x5a6a1004, 0x5a6b1004,
+        0x5a6c1004, 0x5a6d1004, 0x5a6e1004, 0x5a6f1004, 0x5a701004, 0x5a711004, 0x5a721004, 0x5a731004,
+        0x5a741004, 0x5a751004, 0x5a761004, 0x5a771004, 0x5a781004, 0x5a791004, 0x5a7a1004, 0x5a7b1004,
+        0x5a7c1004, 0x5a7d1004, 0x5a7e1004, 0x5a7f1004, 0x5a801004, 0x5a811004, 0x5a821004, 0x5a831004,
+        0x5a841004, 0x5a851004, 0x5a861004, 0x5a871004, 0x5a881004, 0x5a891004, 0x5a8a1004, 0x5a8b1004,
+        0x5a8c1004, 0x5a8d1004, 0x5a8e1004, 0x5a8f1004, 0x5a901004, 0x5a911004, 0x5a921004, 0x5a931004,
+        0x5a941004, 0x5a951004, 0x5a961004, 0x5a971004, 0x5a981004, 0x5a991004, 0x5a9a1004, 0x5a9b1004,
+        0x5a9c1004, 0x5a9d1004, 0x5a9e1004, 0x5a9f1004, 0x5aa01004, 0x5aa11004, 0x5aa21004, 0x5aa31004,
+        0x5aa41004, 0x5aa51004, 0x5aa61004, 0x5aa71004, 0x5aa81004, 0x5aa91004, 0x5aaa1004, 0x5aab1004,
+        0x5aac1004, 0x5aad1004, 0x5aae1004, 0x5aaf1004, 0x5ab01004, 0x5ab11004, 0x5ab21004, 0x5ab31004,
+        0x5ab41004, 0x5ab51004, 0x5ab61004, 0x5ab71004, 0x5ab81004, 0x5ab91004, 0x5aba1004, 0x5abb1004,
+        0x5abc1004, 0x5abd1004, 0x5abe1004, 0x5abf1004, 0x5ac01004, 0x5ac11004, 0x5ac21004, 0x5ac31004,
+        0x5ac41004, 0x5ac51004, 0x5ac61004, 0x5ac71004, 0x5ac81004, 0x5ac91004, 0x5aca1004, 0x5acb1004,
+        0x5acc1004, 0x5acd1004, 0x5ace1004, 0x5acf1004, 0x5ad01004, 0x5ad11004, 0x5ad21004, 0x5ad31004,
+        0x5ad41004, 0x5ad51004, 0x5ad61004, 0x5ad71004, 0x5ad81004, 0x5ad91004, 0x5ada1004, 0x5adb1004,
+        0x5adc1004, 0x5add1004, 0x5ade1004, 0x5adf1004, 0x5ae01004, 0x5ae11004, 0x5ae21004, 0x5ae31004,
+        0x5ae41004, 0x5ae51004, 0x5ae61004, 0x5ae71004, 0x5ae81004, 0x5ae91004, 0x5aea1004, 0x5aeb1004,
+        0x5aec1004, 0x5aed1004, 0x5aee1004, 0x5aef1004, 0x5af01004, 0x5af11004, 0x5af21004, 0x5af31004,
+        0x5af41004, 0x5af51004, 0x5af61004, 0x5af71004, 0x5af81004, 0x5af91004, 0x5afa1004, 0x5afb1004,
+        0x5afc1004, 0x5afd1004, 0x5afe1004, 0x5aff1004, 0x5b001004, 0x5b011004, 0x5b021004, 0x5b031004,
+        0x5b041004, 0x5b051004, 0x5b061004, 0x5b071004, 0x5b081004, 0x5b091004, 0x5b0a1004, 0x5b0b1004,
+        0x5b0c1004, 0x5b0d1004, 0x5b0e1004, 0x5b0f1004, 0x5b101004, 0x5b111004, 0x5b121004, 0x5b131004,
+        0x5b141004, 0x5b151004, 0x5b161004, 0x5b171004, 0x5b181004, 0x5b191004, 0x5b1a1004, 0x5b1b1004,
+        0x5b1c1004, 0x5b1d1004, 0x5b1e1004, 0x5b1f1004, 0x5b201004, 0x5b211004, 0x5b221004, 0x5b231004,
+        0x5b241004, 0x5b251004, 0x5b261004, 0x5b271004, 0x5b281004, 0x5b291004, 0x5b2a1004, 0x5b2b1004,
+        0x5b2c1004, 0x5b2d1004, 0x5b2e1004, 0x5b2f1004, 0x5b301004, 0x5b311004, 0x5b321004, 0x5b331004,
+        0x5b341004, 0x5b351004, 0x5b361004, 0x5b371004, 0x5b381004, 0x5b391004, 0x5b3a1004, 0x5b3b1004,
+        0x5b3c1004, 0x5b3d1004, 0x5b3e1004, 0x5b3f1004, 0x5b401004, 0x5b411004, 0x5b421004, 0x5b431004,
+        0x5b441004, 0x5b451004, 0x5b461004, 0x5b471004, 0x5b481004, 0x5b491004, 0x5b4a1004, 0x5b4b1004,
+        0x5b4c1004, 0x5b4d1004, 0x5b4e1004, 0x5b4f1004, 0x5b501004, 0x5b511004, 0x5b521004, 0x5b531004,
+        0x5b541004, 0x5b551004, 0x5b561004, 0x5b571004, 0x5b581004, 0x5b591004, 0x5b5a1004, 0x5b5b1004,
+        0x5b5c1004, 0x5b5d1004, 0x5b5e1004, 0x5b5f1004, 0x5b601004, 0x5b611004, 0x5b621004, 0x5b631004,
+        0x5b641004, 0x5b651004, 0x5b661004, 0x5b671004, 0x5b681004, 0x5b691004, 0x5b6a1004, 0x5b6b1004,
+        0x5b6c1004, 0x5b6d1004, 0x5b6e1004, 0x5b6f1004, 0x5b701004, 0x5b711004, 0x5b721004, 0x5b731004,
+        0x5b741004, 0x5b751004, 0x5b761004, 0x5b771004, 0x5b781004, 0x5b791004, 0x5b7a1004, 0x5b7b1004,
+        0x5b7c1004, 0x5b7d1004, 0x5b7e1004, 0x5b7f1004, 0x5b801004, 0x5b811004, 0x5b821004, 0x5b831004,
+        0x5b841004, 0x5b851004, 0x5b861004, 0x5b871004, 0x5b881004, 0x5b891004, 0x5b8a1004, 0x5b8b1004,
+        0x5b8c1004, 0x5b8d1004, 0x5b8e1004, 0x5b8f1004, 0x5b901004, 0x5b911004, 0x5b921004, 0x5b931004,
+        0x5b941004, 0x5b951004, 0x5b961004, 0x5b971004, 0x5b981004, 0x5b991004, 0x5b9a1004, 0x5b9b1004,
+        0x5b9c1004, 0x5b9d1004, 0x5b9e1004, 0x5b9f1004, 0x5ba01004, 0x5ba11004, 0x5ba21004, 0x5ba31004,
+        0x5ba41004, 0x5ba51004, 0x5ba61004, 0x5ba71004, 0x5ba81004, 0x5ba91004, 0x5baa1004, 0x5bab1004,
+        0x5bac1004, 0x5bad1004, 0x5bae1004, 0x5baf1004, 0x5bb01004, 0x5bb11004, 0x5bb21004, 0x5bb31004,
+        0x5bb41004, 0x5bb51004, 0x5bb61004, 0x5bb71004, 0x5bb81004, 0x5bb91004, 0x5bba1004, 0x5bbb1004,
+        0x5bbc1004, 0x5bbd1004, 0x5bbe1004, 0x5bbf1004, 0x5bc01004, 0x5bc11004, 0x5bc21004, 0x5bc31004,
+        0x5bc41004, 0x5bc51004, 0x5bc61004, 0x5bc71004, 0x5bc81004, 0x5bc91004, 0x5bca1004, 0x5bcb1004,
+        0x5bcc1004, 0x5bcd1004, 0x5bce1004, 0x5bcf1004, 0x5bd01004, 0x5bd11004, 0x5bd21004, 0x5bd31004,
+        0x5bd41004, 0x5bd51004, 0x5bd61004, 0x5bd71004, 0x5bd81004, 0x5bd91004, 0x5bda1004, 0x5bdb1004,
+        0x5bdc1004, 0x5bdd1004, 0x5bde1004, 0x5bdf1004, 0x5be01004, 0x5be11004, 0x5be21004, 0x5be31004,
+        0x5be41004, 0x5be51004, 0x5be61004, 0x5be71004, 0x5be81004, 0x5be91004, 0x5bea1004, 0x5beb1004,
+        0x5bec1004, 0x5bed1004, 0x5bee1004, 0x5bef1004, 0x5bf01004, 0x5bf11004, 0x5bf21004, 0x5bf31004,
+        0x5bf41004, 0x5bf51004, 0x5bf61004, 0x5bf71004, 0x5bf81004, 0x5bf91004, 0x5bfa1004, 0x5bfb1004,
+        0x5bfc1004, 0x5bfd1004, 0x5bfe1004, 0x5bff1004, 0x5c001004, 0x5c011004, 0x5c021004, 0x5c031004,
+        0x5c041004, 0x5c051004, 0x5c061004, 0x5c071004, 0x5c081004, 0x5c091004, 0x5c0a1004, 0x5c0b1004,
+        0x5c0c1004, 0x5c0d1004, 0x5c0e1004, 0x5c0f1004, 0x5c101004, 0x5c111004, 0x5c121004, 0x5c131004,
+        0x5c141004, 0x5c151004, 0x5c161004, 0x5c171004, 0x5c181004, 0x5c191004, 0x5c1a1004, 0x5c1b1004,
+        0x5c1c1004, 0x5c1d1004, 0x5c1e1004, 0x5c1f1004, 0x5c201004, 0x5c211004, 0x5c221004, 0x5c231004,
+        0x5c241004, 0x5c251004, 0x5c261004, 0x5c271004, 0x5c281004, 0x5c291004, 0x5c2a1004, 0x5c2b1004,
+        0x5c2c1004, 0x5c2d1004, 0x5c2e1004, 0x5c2f1004, 0x5c301004, 0x5c311004, 0x5c321004, 0x5c331004,
+        0x5c341004, 0x5c351004, 0x5c361004, 0x5c371004, 0x3e161004, 0x3e171004, 0x3e181004, 0x3e191004,
+        0x3e1a1004, 0x3e1b1004, 0x3e1c1004, 0x3e1d1004, 0x3e1e1004, 0x3e1f1004, 0x3e201004, 0x3e211004,
+        0x3e221004, 0x3e231004, 0x3e241004, 0x3e251004, 0x3e261004, 0x3e271004, 0x3e281004, 0x3e291004,
+        0x3e2a1004, 0x3e2b1004, 0x3e2c1004, 0x3e2d1004, 0x3e2e1004, 0x3e2f1004, 0x3e301004, 0x3e311004,
+        0x3e321004, 0x3e331004, 0x3e341004, 0x3e351004, 0x3e361004, 0x3e371004, 0x3e381004, 0x3e391004,
+        0x3e3a1004, 0x3e3b1004, 0x3e3c1004, 0x3e3d1004, 0x3e3e1004, 0x3e3f1004, 0x3e401004, 0x3e411004,
+        0x3e421004, 0x3e431004, 0x3e441004, 0x3e451004, 0x3e461004, 0x3e471004, 0x3e481004, 0x3e491004,
+        0x3e4a1004, 0x3e4b1004, 0x3e4c1004, 0x3e4d1004, 0x3e4e1004, 0x3e4f1004, 0x3e501004, 0x3e511004,
+        0x3e521004, 0x3e531004, 0x3e541004, 0x3e551004, 0x3e561004, 0x3e571004, 0x3e581004, 0x3e591004,
+        0x3e5a1004, 0x3e5b1004, 0x3e5c1004, 0x3e5d1004, 0x3e5e1004, 0x3e5f1004, 0x3e601004, 0x3e611004,
+        0x3e621004, 0x3e631004, 0x3e641004, 0x3e651004, 0x3e661004, 0x3e671004, 0x3e681004, 0x3e691004,
+        0x3e6a1004, 0x3e6b1004, 0x3e6c1004, 0x3e6d1004, 0x3e6e1004, 0x3e6f1004, 0x3e701004, 0x3e711004,
+        0x3e721004, 0x3e731004, 0x3e741004, 0x3e751004, 0x3e761004, 0x3e771004, 0x3e781004, 0x3e791004,
+        0x3e7a1004, 0x3e7b1004, 0x3e7c1004, 0x3e7d1004, 0x3e7e1004, 0x3e7f1004, 0x3e801004, 0x3e811004,
+        0x3e821004, 0x3e831004, 0x3e841004, 0x3e851004, 0x3e861004, 0x3e871004, 0x3e881004, 0x3e891004,
+        0x3e8a1004, 0x3e8b1004, 0x3e8c1004, 0x3e8d1004, 0x3e8e1004, 0x3e8f1004, 0x3e901004, 0x3e911004,
+        0x3e921004, 0x3e931004, 0x3e941004, 0x3e951004, 0x3e961004, 0x3e971004, 0x3e981004, 0x3e991004,
+        0x3e9a1004, 0x3e9b1004, 0x3e9c1004, 0x3e9d1004, 0x3e9e1004, 0x3e9f1004, 0x3ea01004, 0x3ea11004,
+        0x3ea21004, 0x3ea31004, 0x3ea41004, 0x3ea51004, 0x3ea61004, 0x3ea71004, 0x3ea81004, 0x3ea91004,
+        0x3eaa1004, 0x3eab1004, 0x3eac1004, 0x3ead1004, 0x3eae1004, 0x3eaf1004, 0x3eb01004, 0x3eb11004,
+        0x3eb21004, 0x3eb31004, 0x3eb41004, 0x3eb51004, 0x3eb61004, 0x3eb71004, 0x3eb81004, 0x3eb91004,
+        0x3eba1004, 0x3ebb1004, 0x3ebc1004, 0x3ebd1004, 0x3ebe1004, 0x3ebf1004, 0x3ec01004, 0x3ec11004,
+        0x3ec21004, 0x3ec31004, 0x3ec41004, 0x3ec51004, 0x3ec61004, 0x3ec71004, 0x3ec81004, 0x3ec91004,
+        0x3eca1004, 0x3ecb1004, 0x3ecc1004, 0x3ecd1004, 0x3ece1004, 0x3ecf1004, 0x3ed01004, 0x3ed11004,
+        0x3ed21004, 0x3ed31004, 0x3ed41004, 0x3ed51004, 0x3ed61004, 0x3ed71004, 0x3ed81004, 0x3ed91004,
+        0x3eda1004, 0x3edb1004, 0x3edc1004, 0x3edd1004, 0x3ede1004, 0x3edf1004, 0x3ee01004, 0x3ee11004,
+        0x3ee21004, 0x3ee31004, 0x3ee41004, 0x3ee51004, 0x3ee61004, 0x3ee71004, 0x3ee81004, 0x3ee91004,
+        0x3eea1004, 0x3eeb1004, 0x3eec1004, 0x3eed1004, 0x3eee1004, 0x3eef1004, 0x3ef01004, 0x3ef11004,
+        0x3ef21004, 0x3ef31004, 0x3ef41004, 0x3ef51004, 0x3ef61004, 0x3ef71004, 0x3ef81004, 0x3ef91004,
+        0x3efa1004, 0x3efb1004, 0x3efc1004, 0x3efd1004, 0x3efe1004, 0x3eff1004, 0x3f001004, 0x3f011004,
+        0x3f021004, 0x3f031004, 0x3f041004, 0x3f051004, 0x3f061004, 0x3f071004, 0x3f081004, 0x3f091004,
+        0x3f0a1004, 0x3f0b1004, 0x3f0c1004, 0x3f0d1004, 0x3f0e1004, 0x3f0f1004, 0x3f101004, 0x3f111004,
+        0x3f121004, 0x3f131004, 0x3f141004, 0x3f151004, 0x3f161004, 0x3f171004, 0x3f181004, 0x3f191004,
+        0x3f1a1004, 0x3f1b1004, 0x3f1c1004, 0x3f1d1004, 0x3f1e1004, 0x3f1f1004, 0x3f201004, 0x3f211004,
+        0x3f221004, 0x3f231004, 0x3f241004, 0x3f251004, 0x3f261004, 0x3f271004, 0x3f281004, 0x3f291004,
+        0x3f2a1004, 0x3f2b1004, 0x3f2c1004, 0x3f2d1004, 0x3f2e1004, 0x3f2f1004, 0x3f301004, 0x3f311004,
+        0x3f321004, 0x3f331004, 0x3f341004, 0x3f351004, 0x3f361004, 0x3f371004, 0x3f381004, 0x3f391004,
+        0x3f3a1004, 0x3f3b1004, 0x3f3c1004, 0x3f3d1004, 0x3f3e1004, 0x3f3f1004, 0x3f401004, 0x3f411004,
+        0x3f421004, 0x3f431004, 0x3f441004, 0x3f451004, 0x3f461004, 0x3f471004, 0x3f481004, 0x3f491004,
+        0x3f4a1004, 0x3f4b1004, 0x3f4c1004, 0x3f4d1004, 0x3f4e1004, 0x3f4f1004, 0x3f501004, 0x3f511004,
+        0x3f521004, 0x3f531004, 0x3f541004, 0x3f551004, 0x3f561004, 0x3f571004, 0x3f581004, 0x3f591004,
+        0x3f5a1004, 0x3f5b1004, 0x3f5c1004, 0x3f5d1004, 0x3f5e1004, 0x3f5f1004, 0x3f601004, 0x3f611004,
+        0x3f621004, 0x3f631004, 0x3f641004, 0x3f651004, 0x3f661004, 0x3f671004, 0x3f681004, 0x3f691004,
+        0x3f6a1004, 0x3f6b1004, 0x3f6c1004, 0x3f6d1004, 0x3f6e1004, 0x3f6f1004, 0x3f701004, 0x3f711004,
+        0x3f721004, 0x3f731004, 0x3f741004, 0x3f751004, 0x3f761004, 0x3f771004, 0x3f781004, 0x3f791004,
+        0x3f7a1004, 0x3f7b1004, 0x3f7c1004, 0x3f7d1004, 0x3f7e1004, 0x3f7f1004, 0x3f801004, 0x3f811004,
+        0x3f821004, 0x3f831004, 0x3f841004, 0x3f851004, 0x3f861004, 0x3f871004, 0x3f881004, 0x3f891004,
+        0x3f8a1004, 0x3f8b1004, 0x3f8c1004, 0x3f8d1004, 0x3f8e1004, 0x3f8f1004, 0x3f901004, 0x3f911004,
+        0x3f921004, 0x3f931004, 0x3f941004, 0x3f951004, 0x3f961004, 0x3f971004, 0x3f981004, 0x3f991004,
+        0x3f9a1004, 0x3f9b1004, 0x3f9c1004, 0x3f9d1004, 0x3f9e1004, 0x3f9f1004, 0x3fa01004, 0x3fa11004,
+        0x3fa21004, 0x3fa31004, 0x3fa41004, 0x3fa51004, 0x3fa61004, 0x3fa71004, 0x3fa81004, 0x3fa91004,
+        0x3faa1004, 0x3fab1004, 0x3fac1004, 0x3fad1004, 0x3fae1004, 0x3faf1004, 0x3fb01004, 0x3fb11004,
+        0x3fb21004, 0x3fb31004, 0x3fb41004, 0x3fb51004, 0x3fb61004, 0x3fb71004, 0x3fb81004, 0x3fb91004,
+        0x3fba1004, 0x3fbb1004, 0x3fbc1004, 0x3fbd1004, 0x3fbe1004, 0x3fbf1004, 0x3fc01004, 0x3fc11004,
+        0x3fc21004, 0x3fc31004, 0x3fc41004, 0x3fc51004, 0x3fc61004, 0x3fc71004, 0x3fc81004, 0x3fc91004,
+        0x3fca1004, 0x3fcb1004, 0x3fcc1004, 0x3fcd1004, 0x3fce1004, 0x3fcf1004, 0x3fd01004, 0x3fd11004,
+        0x3fd21004, 0x3fd31004, 0x3fd41004, 0x3fd51004, 0x3fd61004, 0x3fd71004, 0x3fd81004, 0x3fd91004,
+        0x3fda1004, 0x3fdb1004, 0x3fdc1004, 0x3fdd1004, 0x3fde1004, 0x3fdf1004, 0x3fe01004, 0x3fe11004,
+        0x3fe21004, 0x3fe31004, 0x3fe41004, 0x3fe51004, 0x3fe61004, 0x3fe71004, 0x3fe81004, 0x3fe91004,
+        0x3fea1004, 0x3feb1004, 0x3fec1004, 0x3fed1004, 0x3fee1004, 0x3fef1004, 0x3ff01004, 0x3ff11004,
+        0x3ff21004, 0x3ff31004, 0x3ff41004, 0x3ff51004, 0x3ff61004, 0x3ff71004, 0x3ff81004, 0x3ff91004,
+        0x3ffa1004, 0x3ffb1004, 0x3ffc1004, 0x3ffd1004, 0x3ffe1004, 0x3fff1004, 0x40001004, 0x40011004,
+        0x40021004, 0x40031004, 0x40041004, 0x40051004, 0x40061004, 0x40071004, 0x40081004, 0x40091004,
+        0x400a1004, 0x400b1004, 0x400c1004, 0x400d1004, 0x400e1004, 0x400f1004, 0x40101004, 0x40111004,
+        0x40121004, 0x40131004, 0x40141004, 0x40151004, 0x40161004, 0x40171004, 0x40181004, 0x40191004,
+        0x401a1004, 0x401b1004, 0x401c1004, 0x401d1004, 0x401e1004, 0x401f1004, 0x40201004, 0x40211004,
+        0x40221004, 0x40231004, 0x40241004, 0x40251004, 0x40261004, 0x40271004, 0x40281004, 0x40291004,
+        0x402a1004, 0x402b1004, 0x402c1004, 0x402d1004, 0x402e1004, 0x402f1004, 0x40301004, 0x40311004,
+        0x40321004, 0x40331004, 0x40341004, 0x40351004, 0x40361004, 0x40371004, 0x40381004, 0x40391004,
+        0x403a1004, 0x403b1004, 0x403c1004, 0x403d1004, 0x403e1004, 0x403f1004, 0x40401004, 0x40411004,
+        0x40421004, 0x40431004, 0x40441004, 0x40451004, 0x40461004, 0x40471004, 0x40481004, 0x40491004,
+        0x404a1004, 0x404b1004, 0x404c1004, 0x404d1004, 0x404e1004, 0x4cdd1004, 0x4cde1004, 0x4cdf1004,
+        0x4ce01004, 0x4ce11004, 0x4ce21004, 0x4ce31004, 0x4ce41004, 0x4ce51004, 0x4ce61004, 0x4ce71004,
+        0x4ce81004, 0x4ce91004, 0x4cea1004, 0x4ceb1004, 0x4cec1004, 0x4ced1004, 0x4cee1004, 0x4cef1004,
+        0x4cf01004, 0x4cf11004, 0x4cf21004, 0x4cf31004, 0x4cf41004, 0x4cf51004, 0x4cf61004, 0x4cf71004,
+        0x4cf81004, 0x4cf91004, 0x4cfa1004, 0x4cfb1004, 0x02c91004, 0x02ca1004, 0x404f1004, 0x40501004,
+        0x40511004, 0x40521004, 0x40531004, 0x40541004, 0x40551004, 0x40561004, 0x40571004, 0x40581004,
+        0x40591004, 0x405a1004, 0x405b1004, 0x405c1004, 0x405d1004, 0x405e1004, 0x405f1004, 0x40601004,
+        0x40611004, 0x40621004, 0x40631004, 0x40641004, 0x40651004, 0x40661004, 0x40671004, 0x40681004,
+        0x40691004, 0x406a1004, 0x406b1004, 0x406c1004, 0x00005c04, 0x00005c84, 0x00005d04, 0x00005d84,
+        0x00005e04, 0x028f1004, 0x4a081004, 0x4a091004, 0x4a0a1004, 0x4a0b1004, 0x4a0c1004, 0x4a0d1004,
+        0x4a0e1004, 0x4a0f1004, 0x4a101004, 0x4a111004, 0x4a121004, 0x4a131004, 0x4a141004, 0x4a151004,
+        0x4a161004, 0x4a171004, 0x4a181004, 0x4a191004, 0x4a1a1004, 0x4a1b1004, 0x4a1c1004, 0x4a1d1004,
+        0x4a1e1004, 0x4a1f1004, 0x4a201004, 0x4a211004, 0x4a221004, 0x4a231004, 0x4a241004, 0x4a251004,
+        0x4a261004, 0x4a271004, 0x4a281004, 0x4a291004, 0x4a2a1004, 0x4a2b1004, 0x4a2c1004, 0x4a2d1004,
+        0x4a2e1004, 0x4a2f1004, 0x4a301004, 0x4a311004, 0x4a321004, 0x4a331004, 0x4a341004, 0x4a351004,
+        0x4a361004, 0x4a371004, 0x00007b04, 0x00007b84, 0x00007c04, 0x00007c84, 0x00007d04, 0x00007d84,
+        0x00007e04, 0x04a71004, 0x04a81004, 0x04a91004, 0x04aa1004, 0x04ab1004, 0x111e1004, 0x111f1004,
+        0x11201004, 0x11211004, 0x4a381004, 0x4a391004, 0x1f531004, 0x1f541004, 0x04ac1004, 0x11221004,
+        0x1e811004, 0x1e821004, 0x1e831004, 0x1e841004, 0x1e851004, 0x1e861004, 0x1e871004, 0x4a3a1004,
+        0x4a3b1004, 0x4a3c1004, 0x4a3d1004, 0x4a3e1004, 0x4a3f1004, 0x4a401004, 0x4a411004, 0x4a421004,
+        0x4a431004, 0x4a441004, 0x4a451004, 0x4a461004, 0x4a471004, 0x4a481004, 0x4a491004, 0x4a4a1004,
+        0x4a4b1004, 0x4a4c1004, 0x4a4d1004, 0x4a4e1004, 0x4a4f1004, 0x4a501004, 0x4a511004, 0x4a521004,
+        0x4a531004, 0x4a541004, 0x4a551004, 0x4a561004, 0x4a571004, 0x4a581004, 0x4a591004, 0x4a5a1004,
+        0x4a5b1004, 0x4a5c1004, 0x4a5d1004, 0x4a5e1004, 0x4a5f1004, 0x4a601004, 0x4a611004, 0x41321010,
+        0x41331010, 0x41341010, 0x41351010, 0x41361010, 0x41371010, 0x41381010, 0x41391010, 0x413a1010,
+        0x413b1010, 0x413c1010, 0x413d1010, 0x413e1010, 0x413f1010, 0x41401010, 0x41411010, 0x41421010,
+        0x41431010, 0x41441010, 0x41451010, 0x41461010, 0x41471010, 0x41481010, 0x41491010, 0x414a1010,
+        0x414b1010, 0x414c1010, 0x414d1010, 0x414e1010, 0x414f1010, 0x41501010, 0x41511010, 0x41321004,
+        0x41331004, 0x41341004, 0x41351004, 0x41361004, 0x41371004, 0x41381004, 0x41391004, 0x413a1004,
+        0x413b1004, 0x413c1004, 0x413d1004, 0x413e1004, 0x413f1004, 0x41401004, 0x41411004, 0x41421004,
+        0x41431004, 0x41441004, 0x41451004, 0x41461004, 0x41471004, 0x41481004, 0x41491004, 0x414a1004,
+        0x414b1004, 0x414c1004, 0x414d1004, 0x414e1004, 0x414f1004, 0x41501004, 0x41511004, 0x1e881004,
+        0x1e891004, 0x1e8a1004, 0x1e8b1004, 0x1e8c1004, 0x1e8d1004, 0x1e8e1004, 0x1e8f1004, 0x1e901004,
+        0x1e911004, 0x1f991048, 0x00008c08, 0x1f9a1048, 0x00008c08, 0x1f9b1044, 0x00008c04, 0x02351004,
+        0x02901004, 0x04ad1004, 0x04ae1004, 0x491d1004, 0x491e1004, 0x491f1004, 0x49201004, 0x49221004,
+        0x49231004, 0x49221008, 0x49241004, 0x49251004, 0x49261004, 0x49271004, 0x49281004, 0x49291004,
+        0x492a1004, 0x492c1004, 0x492d1004, 0x492f1004, 0x49301004, 0x49311004, 0x492f1008, 0x49321004,
+        0x49331004, 0x49341004, 0x49351004, 0x49361004, 0x49371004, 0x49381004, 0x49391004, 0x493a1004,
+        0x493b1004, 0x493c1004, 0x493d1004, 0x493e1004, 0x493f1004, 0x49401004, 0x49411004, 0x49421004,
+        0x49411008, 0x49431004, 0x49441004, 0x49451004, 0x49461004, 0x49471004, 0x49481004, 0x49491004,
+        0x494a1004, 0x494b1004, 0x494c1004, 0x494d1004, 0x494e1004, 0x494f1004, 0x49511004, 0x49531004,
+        0x49541004, 0x49551004, 0x49561004, 0x49571004, 0x49581004, 0x495a1004, 0x495b1004, 0x495c1004,
+        0x495d1004, 0x495e1004, 0x495d1008, 0x495f1004, 0x49601004, 0x49611004, 0x49621004, 0x49631004,
+        0x49211004, 0x49521004, 0x49501004, 0x492b1004, 0x49591004, 0x492e1004, 0x49681004, 0x49641004,
+        0x49651004, 0x49661004, 0x49671004, 0x49691004, 0x496a1004, 0x496b1004, 0x496c1004, 0x496d1004,
+        0x496f1004, 0x49701004, 0x49711004, 0x49721004, 0x49741004, 0x49751004, 0x49761004, 0x49771004,
+        0x49791004, 0x497a1004, 0x497b1004, 0x497c1004, 0x497d1004, 0x497f1004, 0x49801004, 0x49811004,
+        0x49821004, 0x49831004, 0x49841004, 0x49851004, 0x49861004, 0x49891004, 0x498a1004, 0x498b1004,
+        0x498c1004, 0x498d1004, 0x498f1004, 0x49901004, 0x49931004, 0x49941004, 0x49951004, 0x49961004,
+        0x49971004, 0x49981004, 0x49991004, 0x499a1004, 0x499b1004, 0x499c1004, 0x49871004, 0x498e1004,
+        0x496e1004, 0x49921004, 0x49731004, 0x49781004, 0x49911004, 0x497e1004, 0x49881004, 0x499d1004,
+        0x499e1004, 0x499f1004, 0x49a01004, 0x49a11004, 0x49a21004, 0x49a31004, 0x49a41004, 0x49a51004,
+        0x49a61004, 0x49a71004, 0x49a81004, 0x49a91004, 0x49aa1004, 0x49ab1004, 0x49ac1004, 0x49ad1004,
+        0x1f591004, 0x1f5a1004, 0x02391004, 0x1f5b1004, 0x00008384, 0x00008404, 0x42dd1022, 0x43181004,
+        0x430b1004, 0x430c1004, 0x430d1004, 0x430e1004, 0x430f1004, 0x43101004, 0x43111004, 0x43121004,
+        0x43131004, 0x43141004, 0x43151004, 0x43161004, 0x43171004, 0x43191004, 0x431a1004, 0x431b1004,
+        0x431c1004, 0x431d1004, 0x431e1004, 0x431f1004, 0x43201004, 0x43211004, 0x43221004, 0x43231004,
+        0x43241004, 0x43251004, 0x43261004, 0x43271004, 0x43281004, 0x43291004, 0x432a1004, 0x432b1004,
+        0x432c1004, 0x432d1004, 0x432e1004, 0x432f1004, 0x43301004, 0x43311004, 0x43321004, 0x43331004,
+        0x43341004, 0x43351004, 0x43361004, 0x43371004, 0x43381004, 0x43391004, 0x433a1004, 0x433b1004,
+        0x433c1004, 0x433d1004, 0x433e1004, 0x433f1004, 0x43401004, 0x43411004, 0x43421004, 0x43431004,
+        0x43441004, 0x43451004, 0x43461004, 0x43471004, 0x43481004, 0x43491004, 0x434a1004, 0x434b1004,
+        0x434c1004, 0x434d1004, 0x434e1004, 0x434f1004, 0x43501004, 0x43511004, 0x43521004, 0x43531004,
+        0x43541004, 0x43551004, 0x43561004, 0x43571004, 0x43581004, 0x43591004, 0x435a1004, 0x435b1004,
+        0x435c1004, 0x435d1004, 0x435e1004, 0x435f1004, 0x43601004, 0x43611004, 0x43621004, 0x43631004,
+        0x43641004, 0x43651004, 0x43661004, 0x43671004, 0x43681004, 0x43691004, 0x436a1004, 0x436b1004,
+        0x436c1004, 0x436d1004, 0x436e1004, 0x436f1004, 0x43701004, 0x43711004, 0x43721004, 0x43731004,
+        0x43741004, 0x43751004, 0x43761004, 0x43771004, 0x43781004, 0x43791004, 0x437a1004, 0x437b1004,
+        0x437c1004, 0x437d1004, 0x437e1004, 0x437f1004, 0x43801004, 0x43811004, 0x43821004, 0x43831004,
+        0x43841004, 0x43851004, 0x43861004, 0x43871004, 0x43881004, 0x43891004, 0x438a1004, 0x438b1004,
+        0x438c1004, 0x438d1004, 0x438e1004, 0x438f1004, 0x43901004, 0x43911004, 0x43921004, 0x43931004,
+        0x43941004, 0x43951004, 0x43961004, 0x43971004, 0x43981004, 0x43991004, 0x439a1004, 0x439b1004,
+        0x439c1004, 0x439d1004, 0x439e1004, 0x439f1004, 0x43a01004, 0x43a11004, 0x43a21004, 0x43a31004,
+        0x43a41004, 0x43a51004, 0x43a61004, 0x43a71004, 0x43a81004, 0x43a91004, 0x43aa1004, 0x43ab1004,
+        0x43ac1004, 0x43ad1004, 0x43ae1004, 0x43af1004, 0x43b01004, 0x43b11004, 0x43b21004, 0x43b31004,
+        0x43b41004, 0x43b51004, 0x43b61004, 0x43b71004, 0x43b81004, 0x43b91004, 0x43ba1004, 0x43bb1004,
+        0x43bc1004, 0x43bd1004, 0x43be1004, 0x43bf1004, 0x43c01004, 0x43c11004, 0x43c21004, 0x43c31004,
+        0x43c41004, 0x43c51004, 0x43c61004, 0x43c71004, 0x43c81004, 0x43c91004, 0x43ca1004, 0x43cb1004,
+        0x43cc1004, 0x43cd1004, 0x43ce1004, 0x43cf1004, 0x43d01004, 0x43d11004, 0x43d21004, 0x43d31004,
+        0x43d41004, 0x43d51004, 0x43d61004, 0x43d71004, 0x43d81004, 0x43d91004, 0x43da1004, 0x43db1004,
+        0x43dc1004, 0x43dd1004, 0x43de1004, 0x43df1004, 0x43e01004, 0x43e11004, 0x43e21004, 0x43e31004,
+        0x43e41004, 0x43e51004, 0x43e61004, 0x43e71004, 0x43e81004, 0x43e91004, 0x43ea1004, 0x43eb1004,
+        0x43ec1004, 0x43ed1004, 0x43ee1004, 0x43ef1004, 0x43f01004, 0x43f11004, 0x43f21004, 0x43f31004,
+        0x43f41004, 0x43f51004, 0x43f61004, 0x43f71004, 0x43f81004, 0x43f91004, 0x43fa1004, 0x43fb1004,
+        0x43fc1004, 0x43fd1004, 0x43fe1004, 0x43ff1004, 0x44001004, 0x44011004, 0x44021004, 0x44031004,
+        0x44041004, 0x44051004, 0x44061004, 0x44071004, 0x44081004, 0x44091004, 0x440a1004, 0x440b1004,
+        0x440c1004, 0x440d1004, 0x440e1004, 0x440f1004, 0x44101004, 0x44111004, 0x44121004, 0x44131004,
+        0x44141004, 0x44151004, 0x44161004, 0x44171004, 0x44181004, 0x44191004, 0x441a1004, 0x441b1004,
+        0x441c1004, 0x441d1004, 0x441e1004, 0x441f1004, 0x44201004, 0x44211004, 0x44221004, 0x44231004,
+        0x44241004, 0x44251004, 0x44261004, 0x44271004, 0x44281004, 0x4307101a, 0x4308101a, 0x4309101a,
+        0x4307101e, 0x4308101e, 0x4309101e, 0x430a101e, 0x4bbf1004, 0x4bc01004, 0x4bc11004, 0x4bc21004,
+        0x4bc31004, 0x4bc41004, 0x4bc51004, 0x4bc61004, 0x4bc71004, 0x4bc81004, 0x4bc91004, 0x4bca1004,
+        0x4bcb1004, 0x4bcc1004, 0x4bcd1004, 0x4bce1004, 0x4bcf1004, 0x4bd01004, 0x4bd11004, 0x4bd21004,
+        0x4bd31004, 0x4bd41004, 0x4bd51004, 0x4bd61004, 0x4bd71004, 0x4bd81004, 0x4bd91004, 0x4bda1004,
+        0x4bdb1004, 0x4bdc1004, 0x4bdd1004, 0x4bde1004, 0x4bdf1004, 0x4be01004, 0x4be11004, 0x4be21004,
+        0x4be31004, 0x4be41004, 0x4be51004, 0x4be61004, 0x4be71004, 0x4be81004, 0x4be91004, 0x4bea1004,
+        0x4beb1004, 0x4bec1004, 0x4bed1004, 0x4bee1004, 0x4bef1004, 0x4bf01004, 0x4bf11004, 0x4bf21004,
+        0x4bf31004, 0x4bf41004, 0x4bf51004, 0x4bf61004, 0x4bf71004, 0x4bf81004, 0x4bf91004, 0x4bfa1004,
+        0x4bfb1004, 0x4bfc1004, 0x4bfd1004, 0x4bfe1004, 0x4bff1004, 0x4c001004, 0x4c011004, 0x4c021004,
+        0x4c031004, 0x4c041004, 0x4c051004, 0x4c061004, 0x4c071004, 0x4c081004, 0x4c091004, 0x4c0a1004,
+        0x4c0b1004, 0x4c0c1004, 0x4c0d1004, 0x4c0e1004, 0x4c0f1004, 0x4c101004, 0x4c111004, 0x4c121004,
+        0x4c131004, 0x4c141004, 0x4c151004, 0x4c161004, 0x4c171004, 0x4c181004, 0x4c191004, 0x4c1a1004,
+        0x4c1b1004, 0x4c1c1004, 0x4c1d1004, 0x4c1e1004, 0x4c1f1004, 0x4c201004, 0x4c211004, 0x4c221004,
+        0x4c231004, 0x4c241004, 0x4c251004, 0x4c261004, 0x4c271004, 0x4c281004, 0x4c291004, 0x4c2a1004,
+        0x4c2b1004, 0x4c2c1004, 0x4c2d1004, 0x4c2e1004, 0x4c2f1004, 0x4c301004, 0x4c311004, 0x4c321004,
+        0x4c331004, 0x4c341004, 0x4c351004, 0x4c361004, 0x4c371004, 0x4c381004, 0x4c391004, 0x4c3a1004,
+        0x4c3b1004, 0x4c3c1004, 0x4c3d1004, 0x4c3e1004, 0x4c3f1004, 0x4c401004, 0x4c411004, 0x4c421004,
+        0x4c431004, 0x4c441004, 0x4c451004, 0x4c461004, 0x4c471004, 0x4c481004, 0x4c491004, 0x13141004,
+        0x02911004, 0x11241004, 0x11251004, 0x11261004, 0x11271004, 0x11281004, 0x11291004, 0x112a1004,
+        0x112b1004, 0x112c1004, 0x112d1004, 0x112e1004, 0x112f1004, 0x11301004, 0x11311004, 0x11321004,
+        0x11331004, 0x11341004, 0x11351004, 0x11361004, 0x11371004, 0x11381004, 0x11391004, 0x113a1004,
+        0x113b1004, 0x113c1004, 0x113d1004, 0x113e1004, 0x113f1004, 0x11401004, 0x11411004, 0x11421004,
+        0x11431004, 0x11441004, 0x11451004, 0x11461004, 0x11471004, 0x11481004, 0x11491004, 0x114a1004,
+        0x114b1004, 0x114c1004, 0x114d1004, 0x114e1004, 0x114f1004, 0x11501004, 0x11511004, 0x11521004,
+        0x11531004, 0x11541004, 0x11551004, 0x11561004, 0x11571004, 0x11581004, 0x11591004, 0x115a1004,
+        0x115b1004, 0x115c1004, 0x115d1004, 0x115e1004, 0x115f1004, 0x11601004, 0x11611004, 0x11621004,
+        0x11631004, 0x11641004, 0x11651004, 0x11661004, 0x11671004, 0x11681004, 0x11691004, 0x116a1004,
+        0x116b1004, 0x116c1004, 0x116d1004, 0x116e1004, 0x116f1004, 0x11701004, 0x11711004, 0x11721004,
+        0x11731004, 0x11741004, 0x11751004, 0x11761004, 0x11771004, 0x11781004, 0x11791004, 0x117a1004,
+        0x117b1004, 0x117c1004, 0x117d1004, 0x117e1004, 0x117f1004, 0x11801004, 0x11811004, 0x11821004,
+        0x11831004, 0x11841004, 0x11851004, 0x11861004, 0x11871004, 0x11881004, 0x11891004, 0x118a1004,
+        0x118b1004, 0x118c1004, 0x118d1004, 0x118e1004, 0x118f1004, 0x11901004, 0x11911004, 0x11921004,
+        0x11931004, 0x11941004, 0x11951004, 0x11961004, 0x11971004, 0x11981004, 0x11991004, 0x119a1004,
+        0x119b1004, 0x119c1004, 0x119d1004, 0x119e1004, 0x119f1004, 0x11a01004, 0x11a11004, 0x11a21004,
+        0x11a31004, 0x11a41004, 0x11a51004, 0x11a61004, 0x11a71004, 0x11a81004, 0x11a91004, 0x11aa1004,
+        0x11ab1004, 0x11ac1004, 0x11ad1004, 0x11ae1004, 0x11af1004, 0x11b01004, 0x11b11004, 0x11b21004,
+        0x11b31004, 0x11b41004, 0x11b51004, 0x11b61004, 0x11b71004, 0x11b81004, 0x11b91004, 0x11ba1004,
+        0x11bb1004, 0x11bc1004, 0x11bd1004, 0x11be1004, 0x11bf1004, 0x11c01004, 0x11c11004, 0x11c21004,
+        0x11c31004, 0x11c41004, 0x11c51004, 0x11c61004, 0x11c71004, 0x11c81004, 0x11c91004, 0x11ca1004,
+        0x11cb1004, 0x11cc1004, 0x11cd1004, 0x11ce1004, 0x11cf1004, 0x11d01004, 0x11d11004, 0x11d21004,
+        0x11d31004, 0x11d41004, 0x11d51004, 0x11d61004, 0x11d71004, 0x11d81004, 0x11d91004, 0x11da1004,
+        0x11db1004, 0x11dc1004, 0x11dd1004, 0x11de1004, 0x11df1004, 0x11e01004, 0x11e11004, 0x11e21004,
+        0x11e31004, 0x11e41004, 0x11e51004, 0x11e61004, 0x11e71004, 0x11e81004, 0x11e91004, 0x11ea1004,
+        0x11eb1004, 0x11ec1004, 0x11ed1004, 0x11ee1004, 0x11ef1004, 0x11f01004, 0x11f11004, 0x11f21004,
+        0x11f31004, 0x11f41004, 0x11f51004, 0x11f61004, 0x11f71004, 0x11f81004, 0x11f91004, 0x11fa1004,
+        0x11fb1004, 0x11fc1004, 0x11fd1004, 0x11fe1004, 0x11ff1004, 0x12001004, 0x12011004, 0x12021004,
+        0x12031004, 0x12041004, 0x12051004, 0x12061004, 0x12071004, 0x12081004, 0x12091004, 0x120a1004,
+        0x120b1004, 0x120c1004, 0x120d1004, 0x120e1004, 0x120f1004, 0x12101004, 0x12111004, 0x12121004,
+        0x12131004, 0x12141004, 0x12151004, 0x12161004, 0x12171004, 0x12181004, 0x12191004, 0x121a1004,
+        0x121b1004, 0x121c1004, 0x121d1004, 0x121e1004, 0x121f1004, 0x12201004, 0x12211004, 0x12221004,
+        0x12231004, 0x12241004, 0x12251004, 0x12261004, 0x12271004, 0x12281004, 0x12291004, 0x122a1004,
+        0x122b1004, 0x122c1004, 0x122d1004, 0x122e1004, 0x122f1004, 0x12301004, 0x12311004, 0x12321004,
+        0x12331004, 0x12341004, 0x12351004, 0x12361004, 0x12371004, 0x12381004, 0x12391004, 0x123a1004,
+        0x123b1004, 0x123c1004, 0x123d1004, 0x123e1004, 0x123f1004, 0x12401004, 0x12541004, 0x12441004,
+        0x12451004, 0x12461004, 0x12471004, 0x12481004, 0x12491004, 0x124a1004, 0x124b1004, 0x124c1004,
+        0x124d1004, 0x124e1004, 0x124f1004, 0x12501004, 0x12511004, 0x12521004, 0x12531004, 0x12551004,
+        0x12561004, 0x12571004, 0x12581004, 0x12591004, 0x125a1004, 0x125b1004, 0x125c1004, 0x125d1004,
+        0x125e1004, 0x125f1004, 0x12601004, 0x12611004, 0x12621004, 0x12631004, 0x12641004, 0x12651004,
+        0x12661004, 0x12671004, 0x12681004, 0x12691004, 0x126a1004, 0x126b1004, 0x126c1004, 0x126d1004,
+        0x126e1004, 0x126f1004, 0x12701004, 0x12711004, 0x12721004, 0x12731004, 0x12741004, 0x12751004,
+        0x12761004, 0x12771004, 0x12781004, 0x12721044, 0x00000000, 0x12731044, 0x00000000, 0x12731044,
+        0x00000040, 0x00000000, 0x12791004, 0x127a1004, 0x127b1004, 0x127c1004, 0x127d1004, 0x127e1004,
+        0x127f1004, 0x12801004, 0x12811004, 0x12821004, 0x12831004, 0x12841004, 0x12851004, 0x12861004,
+        0x12871004, 0x12881004, 0x12891004, 0x128a1004, 0x128b1004, 0x128c1004, 0x128d1004, 0x128e1004,
+        0x128f1004, 0x12901004, 0x12911004, 0x12921004, 0x12931004, 0x12941004, 0x12951004, 0x12961004,
+        0x12971004, 0x12981004, 0x12991004, 0x129a1004, 0x129b1004, 0x129c1004, 0x129d1004, 0x129e1004,
+        0x129f1004, 0x12a01004, 0x12a11004, 0x12a21004, 0x12a31004, 0x12a41004, 0x12a51004, 0x12a61004,
+        0x12a71004, 0x12a81004, 0x12a71044, 0x00000000, 0x12a81044, 0x00000000, 0x12a71044, 0x00000040,
+        0x00000000, 0x12a81044, 0x00000040, 0x00000000, 0x12a91004, 0x12aa1004, 0x12ab1004, 0x12ac1004,
+        0x12ad1004, 0x12ae1004, 0x12af1004, 0x12b01004, 0x12b11004, 0x12b21004, 0x12b31004, 0x12b41004,
+        0x12b51004, 0x12b61004, 0x12b71004, 0x12b81004, 0x12b91004, 0x12ba1004, 0x12bb1004, 0x12bc1004,
+        0x12bd1004, 0x12be1004, 0x12bf1004, 0x12c01004, 0x12c11004, 0x12c21004, 0x12c31004, 0x12c41004,
+        0x12c51004, 0x12c61004, 0x12c71004, 0x12c81004, 0x12c91004, 0x12ca1004, 0x12cb1004, 0x12cc1004,
+        0x12cd1004, 0x12ce1004, 0x12cf1004, 0x12d01004, 0x12d11004, 0x12d21004, 0x12d31004, 0x12d41004,
+        0x12d51004, 0x12d61004, 0x12d71004, 0x12d81004, 0x12d91004, 0x12da1004, 0x12db1004, 0x12dc1004,
+        0x12dd1004, 0x12de1004, 0x12df1004, 0x12e01004, 0x12e11004, 0x12e21004, 0x12e31004, 0x12e41004,
+        0x12e51004, 0x12e61004, 0x12e71004, 0x12e81004, 0x12e91004, 0x12ea1004, 0x12eb1004, 0x12ec1004,
+        0x12ed1004, 0x12ee1004, 0x12ef1004, 0x12f01004, 0x12f11004, 0x12f21004, 0x12f31004, 0x12f41004,
+        0x12f51004, 0x12f61004, 0x12f71004, 0x12f81004, 0x12f91004, 0x12fa1004, 0x12fb1004, 0x12fc1004,
+        0x12fd1004, 0x12fe1004, 0x12ff1004, 0x13001004, 0x13011004, 0x13021004, 0x13031004, 0x13041004,
+        0x13051004, 0x13061004, 0x13071004, 0x13081004, 0x13091004, 0x130a1004, 0x130b1004, 0x130c1004,
+        0x130d1004, 0x130e1004, 0x130f1004, 0x13101004, 0x13111004, 0x13121004, 0x13131004, 0x1e921004,
+        0x1e931004, 0x1e941004, 0x1e951004, 0x1e961004, 0x1e971004, 0x1e981004, 0x1e991004, 0x1e9a1004,
+        0x1e9b1004, 0x10361004, 0x10371004, 0x10381004, 0x10391004, 0x103a1004, 0x103b1004, 0x103c1004,
+        0x103d1004, 0x103e1004, 0x103f1004, 0x10401004, 0x10411004, 0x10421004, 0x10431004, 0x10441004,
+        0x10451004, 0x10461004, 0x10471004, 0x10481004, 0x10491004, 0x104a1004, 0x104b1004, 0x104c1004,
+        0x104d1004, 0x104e1004, 0x104f1004, 0x10501004, 0x10511004, 0x10521004, 0x10531004, 0x10541004,
+        0x10551004, 0x10561004, 0x10571004, 0x10581004, 0x10591004, 0x105a1004, 0x105b1004, 0x105c1004,
+        0x105d1004, 0x105e1004, 0x105f1004, 0x10601004, 0x10611004, 0x10621004, 0x10631004, 0x10641004,
+        0x10651004, 0x10661004, 0x10671004, 0x10681004, 0x10691004, 0x106a1004, 0x106b1004, 0x106c1004,
+        0x106d1004, 0x106e1004, 0x106f1004, 0x10701004, 0x10711004, 0x10721004, 0x10731004, 0x10741004,
+        0x10751004, 0x10761004, 0x10771004, 0x10781004, 0x10791004, 0x107a1004, 0x107b1004, 0x107c1004,
+        0x107d1004, 0x107e1004, 0x107f1004, 0x10801004, 0x10811004, 0x10821004, 0x10831004, 0x10841004,
+        0x10851004, 0x10861004, 0x10871004, 0x10881004, 0x10891004, 0x108a1004, 0x108b1004, 0x108c1004,
+        0x1f3d1004, 0x1f3e1004, 0x1f3f1004, 0x1f401004, 0x1f411004, 0x1f421004, 0x1f431004, 0x1f441004,
+        0x1f451004, 0x1fa21016, 0x20511016, 0x20ab1016, 0x20c41016, 0x213c1016, 0x21d21016, 0x21f71016,
+        0x22171016, 0x22471016, 0x22591016, 0x22641016, 0x22701016, 0x1fa2100a, 0x1fbc100a, 0x1fd6100a,
+        0x2042100a, 0x20c4100a, 0x2109100a, 0x2118100a, 0x216b100a, 0x2180100a, 0x2193100a, 0x21d2100a,
+        0x21f7100a, 0x2217100a, 0x2247100a, 0x2259100a, 0x2264100a, 0x2270100a, 0x2286100a, 0x2094100a,
+        0x20af100a, 0x231e1016, 0x231f1016, 0x23221016, 0x23231016, 0x23271016, 0x23291016, 0x232a1016,
+        0x232b1016, 0x232d1016, 0x232e1016, 0x23301016, 0x23311016, 0x23321016, 0x23331016, 0x23391016,
+        0x233c1016, 0x23401016, 0x23411016, 0x23421016, 0x23431016, 0x23441016, 0x23461016, 0x065c100a,
+        0x231e100a, 0x231f100a, 0x2322100a, 0x2323100a, 0x2327100a, 0x2329100a, 0x232a100a, 0x232b100a,
+        0x232d100a, 0x232e100a, 0x2330100a, 0x2331100a, 0x2332100a, 0x2333100a, 0x2339100a, 0x233c100a,
+        0x2340100a, 0x2341100a, 0x2342100a, 0x2343100a, 0x2344100a, 0x2346100a, 0x0658100a, 0x23241016,
+        0x2324100a, 0x1f98100a, 0x1f99100a, 0x1f9a100a, 0x1f9b100a, 0x1f9c100a, 0x1f9d100a, 0x1f9e100a,
+        0x1f9f100a, 0x1fa0100a, 0x1fa1100a, 0x1aff1004, 0x1b001004, 0x1b011004, 0x1b021004, 0x1b031004,
+        0x1b041004, 0x1b051004, 0x1b061004, 0x1b071004, 0x1b081004, 0x1b091004, 0x1b0a1004, 0x1b0b1004,
+        0x1b0c1004, 0x1b0d1004, 0x1b0e1004, 0x1b0f1004, 0x1b101004, 0x1b111004, 0x1b121004, 0x1b131004,
+        0x1b141004, 0x1b151004, 0x1b161004, 0x1b171004, 0x1b181004, 0x1b191004, 0x1b1a1004, 0x1b1b1004,
+        0x1b1c1004, 0x1b1d1004, 0x1b1e1004, 0x1b1f1004, 0x1b201004, 0x1b211004, 0x1b221004, 0x1b231004,
+        0x1b241004, 0x1b251004, 0x1b261004, 0x1b271004, 0x1b281004, 0x1b291004, 0x1b2a1004, 0x1b2b1004,
+        0x1b2c1004, 0x1b2d1004, 0x1b2e1004, 0x1b2f1004, 0x1b301004, 0x1b311004, 0x1b321004, 0x1b331004,
+        0x1b341004, 0x1b351004, 0x1b361004, 0x1b371004, 0x1b381004, 0x1b391004, 0x1b3a1004, 0x1b3b1004,
+        0x1b3c1004, 0x1b3d1004, 0x1b3e1004, 0x1b3f1004, 0x1b401004, 0x1b411004, 0x1b421004, 0x1b431004,
+        0x1b441004, 0x1b451004, 0x1b461004, 0x1b471004, 0x1b481004, 0x1b491004, 0x1b4a1004, 0x1b4b1004,
+        0x1b4c1004, 0x1b4d1004, 0x1b4e1004, 0x1b4f1004, 0x1b501004, 0x1b511004, 0x1b521004, 0x1b531004,
+        0x1b541004, 0x1b551004, 0x1b561004, 0x1b571004, 0x1b581004, 0x1b591004, 0x1b5a1004, 0x1b5b1004,
+        0x1b5c1004, 0x1b5d1004, 0x1b5e1004, 0x1b5f1004, 0x1b601004, 0x1b611004, 0x1b621004, 0x1b631004,
+        0x1b641004, 0x1b651004, 0x1b661004, 0x1b671004, 0x1b681004, 0x1b691004, 0x1b6a1004, 0x1b6b1004,
+        0x1b6c1004, 0x1b6d1004, 0x1b6e1004, 0x1b6f1004, 0x1b701004, 0x1b711004, 0x1b721004, 0x1b731004,
+        0x1b741004, 0x1b751004, 0x1b761004, 0x1b771004, 0x1b781004, 0x1b791004, 0x1b7a1004, 0x1b7b1004,
+        0x1b7c1004, 0x1b7d1004, 0x1b7e1004, 0x1b7f1004, 0x1b801004, 0x1b811004, 0x1b821004, 0x1b831004,
+        0x1b841004, 0x1b851004, 0x1b861004, 0x1b871004, 0x1b881004, 0x1b891004, 0x1b8a1004, 0x1b8b1004,
+        0x1b8c1004, 0x1b8d1004, 0x1b8e1004, 0x1b8f1004, 0x1b901004, 0x1b911004, 0x1b921004, 0x1b931004,
+        0x1b941004, 0x1b951004, 0x1b961004, 0x1b971004, 0x1b981004, 0x1b991004, 0x1b9a1004, 0x1b9b1004,
+        0x1b9c1004, 0x1b9d1004, 0x1b9e1004, 0x1b9f1004, 0x1ba01004, 0x1ba11004, 0x1ba21004, 0x1ba31004,
+        0x1ba41004, 0x1ba51004, 0x1ba61004, 0x1ba71004, 0x1ba81004, 0x1ba91004, 0x1baa1004, 0x1bab1004,
+        0x1bac1004, 0x1bad1004, 0x1bae1004, 0x1baf1004, 0x1bb01004, 0x1bb11004, 0x1bb21004, 0x1bb31004,
+        0x1bb41004, 0x1bb51004, 0x1bb61004, 0x1bb71004, 0x1bb81004, 0x1bb91004, 0x1bba1004, 0x1bbb1004,
+        0x1bbc1004, 0x1bbd1004, 0x1bbe1004, 0x1bbf1004, 0x1bc01004, 0x1bc11004, 0x1bc21004, 0x1bc31004,
+        0x1bc41004, 0x1bc51004, 0x1bc61004, 0x1bc71004, 0x1bc81004, 0x1bc91004, 0x1bca1004, 0x1bcb1004,
+        0x1bcc1004, 0x1bcd1004, 0x1bce1004, 0x1bcf1004, 0x1bd01004, 0x1bd11004, 0x1bd21004, 0x1bd31004,
+        0x1bd41004, 0x1bd51004, 0x1bd61004, 0x1bd71004, 0x1bd81004, 0x1bd91004, 0x1bda1004, 0x1bdb1004,
+        0x1bdc1004, 0x1bdd1004, 0x1bde1004, 0x1bdf1004, 0x1be01004, 0x1be11004, 0x1be21004, 0x1be31004,
+        0x1be41004, 0x1be51004, 0x1be61004, 0x1be71004, 0x1be81004, 0x1be91004, 0x1bea1004, 0x1beb1004,
+        0x1bec1004, 0x1bed1004, 0x1bee1004, 0x1bef1004, 0x1bf01004, 0x1bf11004, 0x1bf21004, 0x1bf31004,
+        0x1bf41004, 0x1bf51004, 0x1bf61004, 0x1bf71004, 0x1bf81004, 0x1bf91004, 0x1bfa1004, 0x1bfb1004,
+        0x1bfc1004, 0x1bfd1004, 0x1bfe1004, 0x1bff1004, 0x1c001004, 0x1c011004, 0x1c021004, 0x1c031004,
+        0x1c041004, 0x1c051004, 0x1c061004, 0x1c071004, 0x1c081004, 0x1c091004, 0x1c0a1004, 0x1c0b1004,
+        0x1c0c1004, 0x1c0d1004, 0x1c0e1004, 0x1c0f1004, 0x1c101004, 0x1c111004, 0x1c121004, 0x1c131004,
+        0x1c141004, 0x1c151004, 0x1c161004, 0x1c171004, 0x1c181004, 0x1c191004, 0x1c1a1004, 0x1c1b1004,
+        0x1c1c1004, 0x1c1d1004, 0x1c1e1004, 0x1c1f1004, 0x1c201004, 0x1c211004, 0x1c221004, 0x1c231004,
+        0x1c241004, 0x1c251004, 0x1c261004, 0x1c271004, 0x1c281004, 0x1c291004, 0x1c2a1004, 0x1c2b1004,
+        0x1c2c1004, 0x1c2d1004, 0x1c2e1004, 0x1c2f1004, 0x1c301004, 0x1c311004, 0x1c321004, 0x1c331004,
+        0x1c341004, 0x1c351004, 0x1c361004, 0x1c371004, 0x1c381004, 0x1c391004, 0x1c3a1004, 0x1c3b1004,
+        0x1c3c1004, 0x1c3d1004, 0x1c3e1004, 0x1c3f1004, 0x1c401004, 0x1c411004, 0x1c421004, 0x1c431004,
+        0x1c441004, 0x1c451004, 0x1c461004, 0x1c471004, 0x1c481004, 0x1c491004, 0x1c4a1004, 0x1c4b1004,
+        0x1c4c1004, 0x1c4d1004, 0x1c4e1004, 0x1c4f1004, 0x1c501004, 0x1c511004, 0x1c521004, 0x1c531004,
+        0x1c541004, 0x1c551004, 0x1c561004, 0x1c571004, 0x1c581004, 0x1c591004, 0x1c5a1004, 0x1c5b1004,
+        0x1c5c1004, 0x1c5d1004, 0x1c5e1004, 0x1c5f1004, 0x1c601004, 0x1c611004, 0x1c621004, 0x1c631004,
+        0x1c641004, 0x1c651004, 0x1c661004, 0x1c671004, 0x1c681004, 0x1c691004, 0x1c6a1004, 0x1c6b1004,
+        0x1c6c1004, 0x1c6d1004, 0x1c6e1004, 0x1c6f1004, 0x1c701004, 0x1c711004, 0x1c721004, 0x1c731004,
+        0x1c741004, 0x1c751004, 0x1c761004, 0x1c771004, 0x1c781004, 0x1c791004, 0x1c7a1004, 0x1c7b1004,
+        0x1c7c1004, 0x1c7d1004, 0x1c7e1004, 0x1c7f1004, 0x1c801004, 0x1c811004, 0x1c821004, 0x1c831004,
+        0x1c841004, 0x1c851004, 0x1c861004, 0x1c871004, 0x1c881004, 0x1c891004, 0x1c8a1004, 0x1c8b1004,
+        0x1c8c1004, 0x1c8d1004, 0x1c8e1004, 0x1c8f1004, 0x1c901004, 0x1c911004, 0x1c921004, 0x1c931004,
+        0x1c941004, 0x1c951004, 0x1c961004, 0x1c971004, 0x1c981004, 0x1c991004, 0x1c9a1004, 0x1c9b1004,
+        0x1c9c1004, 0x1c9d1004, 0x1c9e1004, 0x1c9f1004, 0x1ca01004, 0x1ca11004, 0x1ca21004, 0x1ca31004,
+        0x1ca41004, 0x1ca51004, 0x1ca61004, 0x1ca71004, 0x1ca81004, 0x1ca91004, 0x1caa1004, 0x1cab1004,
+        0x1cac1004, 0x1cad1004, 0x1cae1004, 0x1caf1004, 0x1cb01004, 0x1cb11004, 0x1cb21004, 0x1cb31004,
+        0x1cb41004, 0x1cb51004, 0x1cb61004, 0x1cb71004, 0x1cb81004, 0x1cb91004, 0x1cba1004, 0x1cbb1004,
+        0x1cbc1004, 0x1cbd1004, 0x1cbe1004, 0x1cbf1004, 0x1cc01004, 0x1cc11004, 0x1cc21004, 0x1cc31004,
+        0x1cc41004, 0x1cc51004, 0x1cc61004, 0x1cc71004, 0x1cc81004, 0x1cc91004, 0x1cca1004, 0x1ccb1004,
+        0x1ccc1004, 0x1ccd1004, 0x1cce1004, 0x1ccf1004, 0x1cd01004, 0x1cd11004, 0x1cd21004, 0x1cd31004,
+        0x1cd41004, 0x1cd51004, 0x1cd61004, 0x1cd71004, 0x1cd81004, 0x1cd91004, 0x1cda1004, 0x1cdb1004,
+        0x1cdc1004, 0x1cdd1004, 0x1cde1004, 0x1cdf1004, 0x1ce01004, 0x1ce11004, 0x1ce21004, 0x1ce31004,
+        0x1ce41004, 0x1ce51004, 0x1ce61004, 0x1ce71004, 0x1ce81004, 0x1ce91004, 0x1cea1004, 0x1ceb1004,
+        0x1cec1004, 0x1ced1004, 0x1cee1004, 0x1cef1004, 0x1cf01004, 0x1cf11004, 0x1cf21004, 0x1cf31004,
+        0x1cf41004, 0x1cf51004, 0x1cf61004, 0x1cf71004, 0x1cf81004, 0x1cf91004, 0x1cfa1004, 0x1cfb1004,
+        0x1cfc1004, 0x1cfd1004, 0x1cfe1004, 0x1cff1004, 0x1d001004, 0x1d011004, 0x1d021004, 0x1d031004,
+        0x1d041004, 0x1d051004, 0x1d061004, 0x1d071004, 0x1d081004, 0x1d091004, 0x1d0a1004, 0x1d0b1004,
+        0x1d0c1004, 0x1d0d1004, 0x1d0e1004, 0x1d0f1004, 0x1d101004, 0x1d111004, 0x1d121004, 0x1d131004,
+        0x1d141004, 0x1d151004, 0x1d161004, 0x1d171004, 0x1d181004, 0x1d191004, 0x1d1a1004, 0x04af1004,
+        0x04b01004, 0x04b11004, 0x04b21004, 0x04b31004, 0x254a1008, 0x254b1008, 0x254c1008, 0x254d1008,
+        0x254e1008, 0x254f1008, 0x25501008, 0x25521008, 0x25531008, 0x25541008, 0x25551008, 0x25561008,
+        0x25571008, 0x25581008, 0x25591008, 0x255a1008, 0x255b1008, 0x255c1008, 0x255d1008, 0x255e1008,
+        0x255f1008, 0x25601008, 0x25611008, 0x25621008, 0x25651008, 0x25661008, 0x25671008, 0x25681008,
+        0x25691008, 0x256a1008, 0x256b1008, 0x256d1008, 0x256e1008, 0x25701008, 0x25711008, 0x25721008,
+        0x25731008, 0x25741008, 0x4a621004, 0x4a631004, 0x4a641004, 0x4a651004, 0x4a661004, 0x4a671004,
+        0x4a681004, 0x4a691004, 0x4a6a1004, 0x4a6b1004, 0x4a6c1004, 0x4a6d1004, 0x4a6e1004, 0x4a6f1004,
+        0x4a701004, 0x4a711004, 0x4a721004, 0x4a731004, 0x4a741004, 0x4a751004, 0x4a761004, 0x4a771004,
+        0x4a781004, 0x4a791004, 0x4a7a1004, 0x4a7b1004, 0x4a7c1004, 0x4a7d1004, 0x4a7e1004, 0x4a7f1004,
+        0x4a801004, 0x4a811004, 0x4a821004, 0x4a831004, 0x4a841004, 0x4a851004, 0x4a861004, 0x4a871004,
+        0x4a881004, 0x4a891004, 0x4a8a1004, 0x4a8b1004, 0x4a8c1004, 0x4a8d1004, 0x4a8e1004, 0x4a8f1004,
+        0x4a901004, 0x4a911004, 0x4a921004, 0x4a931004, 0x1f551004, 0x1f561004, 0x4a941004, 0x11231004,
+        0x4a951004, 0x4a961004, 0x4a971004, 0x4a981004, 0x4a991004, 0x4a9a1004, 0x4a9b1004, 0x4a9c1004,
+        0x4a9d1004, 0x4a9e1004, 0x4a9f1004, 0x4aa01004, 0x4aa11004, 0x4aa21004, 0x4aa31004, 0x4aa41004,
+        0x4aa51004, 0x4aa61004, 0x4aa71004, 0x4aa81004, 0x4aa91004, 0x4aaa1004, 0x4aab1004, 0x4aac1004,
+        0x4aad1004, 0x4aae1004, 0x4aaf1004, 0x4ab01004, 0x4ab11004, 0x4ab21004, 0x4ab31004, 0x4ab41004,
+        0x4ab51004, 0x4ab61004, 0x4ab71004, 0x4ab81004, 0x4ab91004, 0x4aba1004, 0x4abb1004, 0x4abc1004,
+        0x4abd1004, 0x4abe1004, 0x4abf1004, 0x4ac01004, 0x00007e84, 0x00007f04, 0x00007f84, 0x00008004,
+        0x1f771004, 0x406d1004, 0x406e1004, 0x406f1004, 0x40701004, 0x40711004, 0x40721004, 0x40731004,
+        0x40741004, 0x40751004, 0x40761004, 0x40771004, 0x40781004, 0x40791004, 0x407a1004, 0x407b1004,
+        0x407c1004, 0x407d1004, 0x407e1004, 0x407f1004, 0x40801004, 0x40811004, 0x40821004, 0x40831004,
+        0x40841004, 0x40851004, 0x40861004, 0x40871004, 0x40881004, 0x40891004, 0x408a1004, 0x408b1004,
+        0x408c1004, 0x408d1004, 0x408e1004, 0x408f1004, 0x40901004, 0x40911004, 0x40921004, 0x40931004,
+        0x40941004, 0x40951004, 0x40961004, 0x40971004, 0x40981004, 0x40991004, 0x409a1004, 0x409b1004,
+        0x409c1004, 0x409d1004, 0x409e1004, 0x409f1004, 0x40a01004, 0x40a11004, 0x40a21004, 0x40a31004,
+        0x40a41004, 0x40a51004, 0x40a61004, 0x40a71004, 0x40a81004, 0x40a91004, 0x40aa1004, 0x40ab1004,
+        0x40ac1004, 0x40ad1004, 0x40ae1004, 0x40af1004, 0x40b01004, 0x40b11004, 0x40b21004, 0x40b31004,
+        0x40b41004, 0x40b51004, 0x40b61004, 0x40b71004, 0x40b81004, 0x40b91004, 0x40ba1004, 0x40bb1004,
+        0x40bc1004, 0x40bd1004, 0x40be1004, 0x40bf1004, 0x40c01004, 0x40c11004, 0x40c21004, 0x40c31004,
+        0x40c41004, 0x40c51004, 0x40c61004, 0x40c71004, 0x40c81004, 0x40c91004, 0x40ca1004, 0x40cb1004,
+        0x40cc1004, 0x40cd1004, 0x40ce1004, 0x40cf1004, 0x40d01004, 0x40d11004, 0x40d21004, 0x40d31004,
+        0x40d41004, 0x40d51004, 0x40d61004, 0x40d71004, 0x40d81004, 0x40d91004, 0x40da1004, 0x40db1004,
+        0x40dc1004, 0x40dd1004, 0x40de1004, 0x40df1004, 0x40e01004, 0x40e11004, 0x40e21004, 0x40e31004,
+        0x40e41004, 0x40e51004, 0x40e61004, 0x40e71004, 0x40e81004, 0x40e91004, 0x40ea1004, 0x40eb1004,
+        0x40ec1004, 0x40ed1004, 0x40ee1004, 0x40ef1004, 0x40f01004, 0x40f11004, 0x40f21004, 0x40f31004,
+        0x40f41004, 0x40f51004, 0x40f61004, 0x40f71004, 0x40f81004, 0x40f91004, 0x40fa1004, 0x40fb1004,
+        0x40fc1004, 0x40fd1004, 0x40fe1004, 0x40ff1004, 0x41001004, 0x41011004, 0x41021004, 0x41031004,
+        0x41041004, 0x41051004, 0x41061004, 0x41071004, 0x41081004, 0x41091004, 0x410a1004, 0x410b1004,
+        0x410c1004, 0x410d1004, 0x410e1004, 0x410f1004, 0x41101004, 0x41111004, 0x41121004, 0x41131004,
+        0x41141004, 0x41151004, 0x41161004, 0x41171004, 0x41181004, 0x41191004, 0x411a1004, 0x411b1004,
+        0x411c1004, 0x411d1004, 0x411e1004, 0x411f1004, 0x41201004, 0x41211004, 0x41221004, 0x41231004,
+        0x41241004, 0x41251004, 0x41261004, 0x41271004, 0x41281004, 0x41291004, 0x412a1004, 0x412b1004,
+        0x412c1004, 0x412d1004, 0x412e1004, 0x412f1004, 0x41301004, 0x41311004, 0x41521010, 0x41531010,
+        0x41541010, 0x41551010, 0x41561010, 0x41571010, 0x41581010, 0x41591010, 0x415a1010, 0x415b1010,
+        0x415c1010, 0x415d1010, 0x415e1010, 0x415f1010, 0x41601010, 0x41611010, 0x41621010, 0x41631010,
+        0x41641010, 0x41651010, 0x41661010, 0x41671010, 0x41681010, 0x41691010, 0x416a1010, 0x416b1010,
+        0x416c1010, 0x416d1010, 0x416e1010, 0x416f1010, 0x41701010, 0x41711010, 0x41721010, 0x41731010,
+        0x41521004, 0x41531004, 0x41541004, 0x41551004, 0x41561004, 0x41571004, 0x41581004, 0x41591004,
+        0x415a1004, 0x415b1004, 0x415c1004, 0x415d1004, 0x415e1004, 0x415f1004, 0x41601004, 0x41611004,
+        0x41621004, 0x41631004, 0x41641004, 0x41651004, 0x41661004, 0x41671004, 0x41681004, 0x41691004,
+        0x416a1004, 0x416b1004, 0x416c1004, 0x416d1004, 0x416e1004, 0x416f1004, 0x41701004, 0x41711004,
+        0x41721004, 0x41731004, 0x00005e84, 0x00005f84, 0x00006004, 0x00006084, 0x00005f04, 0x41741004,
+        0x026c1004, 0x027b1004, 0x1e9c1004, 0x1e9d1004, 0x1e9e1004, 0x1e9f1004, 0x1ea01004, 0x1ea11004,
+        0x1ea21004, 0x1ea31004, 0x1ea41004, 0x1ea51004, 0x1ea61004, 0x1ea71004, 0x1ea81004, 0x1ea91004,
+        0x1eaa1004, 0x1eab1004, 0x1eac1004, 0x1ead1004, 0x1eae1004, 0x1eaf1004, 0x1eb01004, 0x1eb11004,
+        0x1eb21004, 0x1eb31004, 0x1eb41004, 0x1eb51004, 0x1eb61004, 0x1eb71004, 0x1eb81004, 0x1eb91004,
+        0x1eba1004, 0x1ebb1004, 0x1ebc1004, 0x1ebd1004, 0x1ebe1004, 0x1ebf1004, 0x1ec01004, 0x1ec11004,
+        0x1ec21004, 0x1ec31004, 0x1ec41004, 0x13151004, 0x1ec51004, 0x1ec61004, 0x1ec71004, 0x1f911004,
+        0x1ec81004, 0x1ec91004, 0x1eca1004, 0x1ecb1004, 0x1ecc1004, 0x1ecd1004, 0x1ece1004, 0x1ecf1004,
+        0x1ed01004, 0x1ed11004, 0x1ed21004, 0x1ed31004, 0x1ed41004, 0x1ed51004, 0x1ed61004, 0x1ed71004,
+        0x1ed81004, 0x1ed91004, 0x1eda1004, 0x1edb1004, 0x1edc1004, 0x1edd1004, 0x1ede1004, 0x1edf1004,
+        0x1ee01004, 0x1ee11004, 0x1ee21004, 0x1ee31004, 0x1ee41004, 0x1ee51004, 0x1ee61004, 0x1ee71004,
+        0x1ee81004, 0x1ee91004, 0x1eea1004, 0x1eeb1004, 0x1eec1004, 0x1eed1004, 0x13161004, 0x1f9b1048,
+        0x00008c08, 0x1f9c1048, 0x00008c08, 0x1f9d1048, 0x00008c08, 0x1f9e1048, 0x00008c08, 0x1f9f1048,
+        0x00008c08, 0x1fa01048, 0x00008c08, 0x1fa11048, 0x00008c08, 0x1eee1004, 0x1eef1004, 0x1ef01004,
+        0x1ef11004, 0x1ef21004, 0x1ef31004, 0x1ef41004, 0x2672100a, 0x2674100a, 0x268f100a, 0x26a4100a,
+        0x2728100a, 0x26b4100a, 0x2699100a, 0x26d7100a, 0x2737100a, 0x26f6100a, 0x270c100a, 0x2714100a,
+        0x2718100a, 0x26c6100a, 0x26db100a, 0x26e4100a, 0x26d1100a, 0x26f0100a, 0x26b3100a, 0x26c7100a,
+        0x2685100a, 0x2686100a, 0x269a100a, 0x26a5100a, 0x26d2100a, 0x26d8100a, 0x26dc100a, 0x2673100a,
+        0x2719100a, 0x26e5100a, 0x26ef100a, 0x2722100a, 0x052f1004, 0x05301004, 0x13171004, 0x13181004,
+        0x13191004, 0x131a1004, 0x131b1004, 0x131c1004, 0x131d1004, 0x131e1004, 0x131f1004, 0x13201004,
+        0x13211004, 0x13221004, 0x13231004, 0x13241004, 0x13251004, 0x13261004, 0x13271004, 0x13281004,
+        0x13291004, 0x132a1004, 0x132b1004, 0x132c1004, 0x132d1004, 0x132e1004, 0x132f1004, 0x13301004,
+        0x13311004, 0x13321004, 0x13331004, 0x13341004, 0x13351004, 0x13361004, 0x13371004, 0x13381004,
+        0x13391004, 0x133a1004, 0x133b1004, 0x133c1004, 0x133d1004, 0x133e1004, 0x133f1004, 0x13401004,
+        0x13411004, 0x13421004, 0x13431004, 0x13441004, 0x13451004, 0x13461004, 0x13471004, 0x13481004,
+        0x13491004, 0x134a1004, 0x134b1004, 0x134c1004, 0x134d1004, 0x134e1004, 0x134f1004, 0x13501004,
+        0x13511004, 0x13521004, 0x13531004, 0x13541004, 0x13551004, 0x13561004, 0x13571004, 0x13581004,
+        0x13591004, 0x135a1004, 0x135b1004, 0x135c1004, 0x135d1004, 0x135e1004, 0x135f1004, 0x13601004,
+        0x13611004, 0x13621004, 0x13631004, 0x13641004, 0x13651004, 0x13661004, 0x13671004, 0x13681004,
+        0x13691004, 0x136a1004, 0x136b1004, 0x136c1004, 0x136d1004, 0x136e1004, 0x136f1004, 0x13701004,
+        0x13711004, 0x13721004, 0x13731004, 0x13741004, 0x13751004, 0x13761004, 0x13771004, 0x13781004,
+        0x13791004, 0x137a1004, 0x137b1004, 0x137c1004, 0x137d1004, 0x137e1004, 0x137f1004, 0x13801004,
+        0x13811004, 0x13821004, 0x13831004, 0x13841004, 0x13851004, 0x13861004, 0x13871004, 0x13881004,
+        0x13891004, 0x138a1004, 0x138b1004, 0x138c1004, 0x138d1004, 0x138e1004, 0x138f1004, 0x13901004,
+        0x13911004, 0x13921004, 0x13931004, 0x13941004, 0x13951004, 0x13961004, 0x13971004, 0x13981004,
+        0x13991004, 0x139a1004, 0x139b1004, 0x139c1004, 0x139d1004, 0x139e1004, 0x139f1004, 0x13a01004,
+        0x13a11004, 0x13a21004, 0x13a31004, 0x13a41004, 0x13a51004, 0x13a61004, 0x13a71004, 0x13a81004,
+        0x13a91004, 0x13aa1004, 0x13ab1004, 0x13ac1004, 0x13ad1004, 0x13ae1004, 0x13af1004, 0x13b01004,
+        0x13b11004, 0x13b21004, 0x13b31004, 0x13b41004, 0x13b51004, 0x13b61004, 0x13b71004, 0x13b81004,
+        0x13b91004, 0x13ba1004, 0x13bb1004, 0x13bc1004, 0x13bd1004, 0x13be1004, 0x13bf1004, 0x13c01004,
+        0x13c11004, 0x13c21004, 0x13c31004, 0x13c41004, 0x13c51004, 0x13c61004, 0x13c71004, 0x13c81004,
+        0x13c91004, 0x13ca1004, 0x13cb1004, 0x13cc1004, 0x13cd1004, 0x13ce1004, 0x13cf1004, 0x13d01004,
+        0x13d11004, 0x13d21004, 0x13d31004, 0x13d41004, 0x13d51004, 0x13d61004, 0x13d71004, 0x13d81004,
+        0x13d91004, 0x13da1004, 0x13db1004, 0x13dc1004, 0x13dd1004, 0x13de1004, 0x13df1004, 0x13e01004,
+        0x13e11004, 0x13e21004, 0x13e31004, 0x13e41004, 0x13e51004, 0x13e61004, 0x13e71004, 0x13e81004,
+        0x13e91004, 0x13ea1004, 0x13eb1004, 0x13ec1004, 0x13ed1004, 0x13ee1004, 0x13ef1004, 0x13f01004,
+        0x13f11004, 0x13f21004, 0x13f31004, 0x13f41004, 0x13f51004, 0x13f61004, 0x13f71004, 0x13f81004,
+        0x1f981048, 0x027e1008, 0x1f981048, 0x02231008, 0x1f991048, 0x02231008, 0x1f9a1048, 0x02231008,
+        0x1f9b1048, 0x02231008, 0x1f9c1048, 0x02231008, 0x1f9d1048, 0x02231008, 0x1f9e1048, 0x02231008,
+        0x1f9f1048, 0x02231008, 0x1fa01048, 0x02231008, 0x1fa11048, 0x02231008, 0x145b1004, 0x145c1004,
+        0x145d1004, 0x03281048, 0x1fa21054, 0x03291008, 0x03281048, 0x1fbc1054, 0x03291008, 0x03281048,
+        0x1fd61054, 0x03291008, 0x03281048, 0x1feb1054, 0x03291008, 0x03281048, 0x20071054, 0x03291008,
+        0x03281048, 0x20421054, 0x03291008, 0x03281048, 0x20511054, 0x03291008, 0x03281048, 0x20751054,
+        0x03291008, 0x03281048, 0x20901054, 0x03291008, 0x03281048, 0x20ab1054, 0x03291008, 0x03281048,
+        0x20c41054, 0x03291008, 0x03281048, 0x20d61054, 0x03291008, 0x03281048, 0x21091054, 0x03291008,
+        0x03281048, 0x21181054, 0x03291008, 0x03281048, 0x213c1054, 0x03291008, 0x03281048, 0x216b1054,
+        0x03291008, 0x03281048, 0x21801054, 0x03291008, 0x03281048, 0x21931054, 0x03291008, 0x03281048,
+        0x21d21054, 0x03291008, 0x03281048, 0x21f71054, 0x03291008, 0x03281048, 0x22171054, 0x03291008,
+        0x03281048, 0x22471054, 0x03291008, 0x03281048, 0x22591054, 0x03291008, 0x03281048, 0x22641054,
+        0x03291008, 0x03281048, 0x22701054, 0x03291008, 0x03281048, 0x22861054, 0x03291008, 0x038a1048,
+        0x21d21054, 0x038b1008, 0x1fd61058, 0x1feb1018, 0x22591058, 0x22861018, 0x05d31004, 0x1fd6103a,
+        0x2042103a, 0x2180103a, 0x21d2103a, 0x2264103a, 0x2270103a, 0x2286103a, 0x2075107a, 0x2247103a,
+        0x21d2107a, 0x1feb103a, 0x21d2107a, 0x21d2103a, 0x216b107a, 0x216b107a, 0x2247103a, 0x2259107a,
+        0x1fd6103a, 0x21091068, 0x1fd61028, 0x21091068, 0x1feb1028, 0x21091068, 0x21931028, 0x145e1004,
+        0x145f1004, 0x14601004, 0x2090107a, 0x1fd6103a, 0x216b107a, 0x1fa2103a, 0x21d2107a, 0x1fa2103a,
+        0x1fa2107a, 0x1fbc103a, 0x1feb107a, 0x20ab103a, 0x1fd6107a, 0x20d6103a, 0x1fd6107a, 0x213c107a,
+        0x213c107a, 0x20d6103a, 0x2042107a, 0x2193107a, 0x2007107a, 0x2007103a, 0x2090107a, 0x1feb103a,
+        0x2118107a, 0x2007107a, 0x2259103a, 0x2118107a, 0x2051103a, 0x213c107a, 0x20c4103a, 0x21d2107a,
+        0x213c107a, 0x21d2103a, 0x2217107a, 0x216b107a, 0x02671038, 0x2247107a, 0x21d2103a, 0x1f9b1078,
+        0x1feb103a, 0x1f9a1078, 0x21181078, 0x1feb1078, 0x02091078, 0x21d2107a, 0x1fd61078, 0x21931038,
+        0x1f9a1078, 0x20c4103a, 0x1f9c1078, 0x20c4103a, 0x1fa01078, 0x20c4103a, 0x1f9d1078, 0x027e1078,
+        0x1f991038, 0x1f9f1078, 0x027e1078, 0x1f991038, 0x1f9a1078, 0x1f9a1078, 0x027e1078, 0x1f9a1038,
+        0x1f9e1078, 0x1f981078, 0x216b103a, 0x1f991078, 0x1f9a1078, 0x1f981078, 0x216b103a, 0x1feb1038,
+        0x2075107a, 0x1fd61038, 0x2075107a, 0x1feb1078, 0x2193103a, 0x2075107a, 0x20901078, 0x02091078,
+        0x2193107a, 0x20071078, 0x21d21038, 0x20d6107a, 0x213c1078, 0x21d21078, 0x21d21078, 0x20d61078,
+        0x20071078, 0x21d21078, 0x21d21038, 0x21d2107a, 0x2075107a, 0x2247103a, 0x2217107a, 0x2075107a,
+        0x1feb103a, 0x2247107a, 0x213c107a, 0x1feb103a, 0x05d51004, 0x0b221004, 0x0b231004, 0x0b241004,
+        0x0b251004, 0x0b261004, 0x0b271004, 0x0b281004, 0x0b291004, 0x0b2a1004, 0x0b2b1004, 0x0b2c1004,
+        0x0b2d1004, 0x0b2e1004, 0x0b2f1004, 0x0b301004, 0x0b311004, 0x0b321004, 0x0b331004, 0x0b341004,
+        0x0b351004, 0x0b361004, 0x0b371004, 0x0b381004, 0x0b391004, 0x0b3a1004, 0x0b3b1004, 0x42f81078,
+        0x42e01038, 0x42e41078, 0x42e41038, 0x42e51038, 0xfb401078, 0xe24b0000, 0xfb401078, 0xdb570000,
+        0xfb401078, 0xd3cc0000, 0x42ed1078, 0x00001bb8, 0xfb401078, 0xce8c0000, 0xfb401078, 0xd91a0000,
+        0xfb411078, 0x89e30000, 0xfb401078, 0xd9290000, 0xfb401078, 0xcea40000, 0xfb401078, 0xe6200000,
+        0xfb401078, 0xf1210000, 0xfb401078, 0xe5990000, 0xfb401078, 0xd24d0000, 0xfb401078, 0xdf8c0000,
+        0xfb401078, 0xd18d0000, 0xfb401078, 0xe5b00000, 0xfb401078, 0xd21d0000, 0xfb401078, 0xfd420000,
+        0xfb401078, 0xf51f0000, 0xfb411078, 0x8ca90000, 0xfb401078, 0xd8f00000, 0xfb401078, 0xd4390000,
+        0xfb401078, 0xef140000, 0xfb401078, 0xe2950000, 0xfb401078, 0xe3550000, 0xfb401078, 0xce000000,
+        0xfb401078, 0xce090000, 0xfb411078, 0x904a0000, 0xfb401078, 0xdde60000, 0xfb401078, 0xce2d0000,
+        0xfb401078, 0xd3f30000, 0xfb401078, 0xe3070000, 0xfb411078, 0x8d700000, 0xfb401078, 0xe2530000,
+        0xfb401078, 0xf9810000, 0xfb401078, 0xfa7a0000, 0xfb401078, 0xd4080000, 0xfb401078, 0xee800000,
+        0xfb401078, 0xe7090000, 0xfb401078, 0xe7080000, 0xfb401078, 0xf5330000, 0xfb401078, 0xd2720000,
+        0xfb401078, 0xd5b60000, 0xfb411078, 0x914d0000, 0x038a1048, 0xfb401048, 0xe72c0040, 0x038b1008,
+        0x038a1048, 0xfb401048, 0xce090040, 0x038b1008, 0x038a1048, 0xfb401048, 0xce8c0040, 0x038b1008,
+        0x038a1048, 0xfb401048, 0xdb890040, 0x038b1008, 0x038a1048, 0xfb401048, 0xf0b90040, 0x038b1008,
+        0x038a1048, 0xfb401048, 0xe2530040, 0x038b1008, 0x038a1048, 0xfb401048, 0xf6d70040, 0x038b1008,
+        0x038a1048, 0xfb401048, 0xd2dd0040, 0x038b1008, 0x038a1048, 0xfb401048, 0xe5570040, 0x038b1008,
+        0xfb40104c, 0xdf970000, 0xfb40104c, 0xd3ef0000, 0x14611004, 0x14621004, 0x14631004, 0x14641004,
+        0x14651004, 0x14661004, 0x14671004, 0x14681004, 0x14691004, 0x146a1004, 0x146b1004, 0x146c1004,
+        0x146d1004, 0x146e1004, 0x146f1004, 0x14701004, 0x14711004, 0x14721004, 0x14731004, 0x14741004,
+        0x14751004, 0x14761004, 0x14771004, 0x14781004, 0x14791004, 0x147a1004, 0x147b1004, 0x147c1004,
+        0x147d1004, 0x147e1004, 0x147f1004, 0x14801004, 0x14811004, 0x14821004, 0x14831004, 0x14841004,
+        0x14851004, 0x14861004, 0x14871004, 0x14881004, 0x14891004, 0x148a1004, 0x148b1004, 0x148c1004,
+        0x148d1004, 0x148e1004, 0x148f1004, 0x14901004, 0x14911004, 0x14921004, 0x14931004, 0x14941004,
+        0x14951004, 0x14961004, 0x14971004, 0x14981004, 0x14991004, 0x149a1004, 0x149b1004, 0x149c1004,
+        0x149d1004, 0x149e1004, 0x149f1004, 0x14a01004, 0x14a11004, 0x14a21004, 0x14a31004, 0x14a41004,
+        0x14a51004, 0x14a61004, 0x14a71004, 0x14a81004, 0x14a91004, 0x14aa1004, 0x14ab1004, 0x14ac1004,
+        0x14ad1004, 0x14ae1004, 0x14af1004, 0x14b01004, 0x14b11004, 0x14b21004, 0x14b31004, 0x14b41004,
+        0x14b51004, 0x14b61004, 0x14b71004, 0x14b81004, 0x14b91004, 0x14ba1004, 0x14bb1004, 0x14bc1004,
+        0x14bd1004, 0x14be1004, 0x14bf1004, 0x14c01004, 0x14c11004, 0x14c21004, 0x14c31004, 0x14c41004,
+        0x14c51004, 0x14c61004, 0x14c71004, 0x14c81004, 0x14c91004, 0x14ca1004, 0x14cb1004, 0x14cc1004,
+        0x14cd1004, 0x14ce1004, 0x14cf1004, 0x14d01004, 0x14d11004, 0x14d21004, 0x14d31004, 0x14d41004,
+        0x14d51004, 0x14d61004, 0x14d71004, 0x14d81004, 0x14d91004, 0x14da1004, 0x14db1004, 0x14dc1004,
+        0x14dd1004, 0x14de1004, 0x14df1004, 0x14e01004, 0x14e11004, 0x14e21004, 0x14e31004, 0x14e41004,
+        0x14e51004, 0x14e61004, 0x14e71004, 0x14e81004, 0x14e91004, 0x14ea1004, 0x14eb1004, 0x14ec1004,
+        0x14ed1004, 0x14ee1004, 0x14ef1004, 0x14f01004, 0x14f11004, 0x14f21004, 0x14f31004, 0x14f41004,
+        0x14f51004, 0x14f61004, 0x14f71004, 0x14f81004, 0x14f91004, 0x14fa1004, 0x14fb1004, 0x14fc1004,
+        0x14fd1004, 0x14fe1004, 0x14ff1004, 0x15001004, 0x15011004, 0x15021004, 0x15031004, 0x15041004,
+        0x15051004, 0x15061004, 0x15071004, 0x15081004, 0x15091004, 0x150a1004, 0x150b1004, 0x150c1004,
+        0x150d1004, 0x150e1004, 0x150f1004, 0x15101004, 0x15111004, 0x15121004, 0x15131004, 0x15141004,
+        0x15151004, 0x15161004, 0x15171004, 0x15181004, 0x15191004, 0x151a1004, 0x151b1004, 0x151c1004,
+        0x151d1004, 0x151e1004, 0x151f1004, 0x15201004, 0x15211004, 0x15221004, 0x15231004, 0x15241004,
+        0x15251004, 0x15261004, 0x15271004, 0x15281004, 0x15291004, 0x152a1004, 0x152b1004, 0x152c1004,
+        0x152d1004, 0x152e1004, 0x152f1004, 0x15301004, 0x15311004, 0x15321004, 0x15331004, 0x15341004,
+        0x15351004, 0x15361004, 0x15371004, 0x15381004, 0x15391004, 0x153a1004, 0x153b1004, 0x153c1004,
+        0x153d1004, 0x153e1004, 0x153f1004, 0x15401004, 0x15411004, 0x15421004, 0x15431004, 0x15441004,
+        0x15451004, 0x15461004, 0x15471004, 0x15481004, 0x15491004, 0x154a1004, 0x154b1004, 0x154c1004,
+        0x154d1004, 0x154e1004, 0x154f1004, 0x15501004, 0x15511004, 0x15521004, 0x15531004, 0x15541004,
+        0x15551004, 0x15561004, 0x15571004, 0x15581004, 0x15591004, 0x155a1004, 0x155b1004, 0x155c1004,
+        0x155d1004, 0x155e1004, 0x155f1004, 0x15601004, 0x15611004, 0x15621004, 0x15631004, 0x15641004,
+        0x15651004, 0x15661004, 0x15671004, 0x15681004, 0x15691004, 0x156a1004, 0x156b1004, 0x156c1004,
+        0x156d1004, 0x156e1004, 0x156f1004, 0x15701004, 0x15711004, 0x15721004, 0x15731004, 0x15741004,
+        0x15751004, 0x15761004, 0x15771004, 0x15781004, 0x15791004, 0x157a1004, 0x157b1004, 0x157c1004,
+        0x157d1004, 0x157e1004, 0x157f1004, 0x15801004, 0x15811004, 0x15821004, 0x15831004, 0x15841004,
+        0x15851004, 0x15861004, 0x15871004, 0x15881004, 0x15891004, 0x158a1004, 0x158b1004, 0x158c1004,
+        0x158d1004, 0x158e1004, 0x158f1004, 0x15901004, 0x15911004, 0x15921004, 0x15931004, 0x15941004,
+        0x15951004, 0x15961004, 0x15971004, 0x15981004, 0x15991004, 0x159a1004, 0x159b1004, 0x159c1004,
+        0x159d1004, 0x159e1004, 0x159f1004, 0x15a01004, 0x15a11004, 0x15a21004, 0x15a31004, 0x15a41004,
+        0x15a51004, 0x15a61004, 0x15a71004, 0x15a81004, 0x15a91004, 0x15aa1004, 0x15ab1004, 0x15ac1004,
+        0x15ad1004, 0x15ae1004, 0x15af1004, 0x15b01004, 0x15b11004, 0x15b21004, 0x15b31004, 0x15b41004,
+        0x15b51004, 0x15b61004, 0x15b71004, 0x15b81004, 0x15b91004, 0x15ba1004, 0x15bb1004, 0x15bc1004,
+        0x15bd1004, 0x15be1004, 0x15bf1004, 0x15c01004, 0x15c11004, 0x15c21004, 0x15c31004, 0x15c41004,
+        0x15c51004, 0x15c61004, 0x15c71004, 0x15c81004, 0x15c91004, 0x15ca1004, 0x15cb1004, 0x15cc1004,
+        0x15cd1004, 0x15ce1004, 0x15cf1004, 0x15d01004, 0x15d11004, 0x15d21004, 0x15d31004, 0x15d41004,
+        0x15d51004, 0x15d61004, 0x15d71004, 0x15d81004, 0x15d91004, 0x15da1004, 0x15db1004, 0x15dc1004,
+        0x15dd1004, 0x15de1004, 0x15df1004, 0x15e01004, 0x15e11004, 0x15e21004, 0x15e31004, 0x15e41004,
+        0x15e51004, 0x15e61004, 0x15e71004, 0x15e81004, 0x15e91004, 0x15ea1004, 0x15eb1004, 0x15ec1004,
+        0x15ed1004, 0x15ee1004, 0x15ef1004, 0x15f01004, 0x15f11004, 0x15f21004, 0x15f31004, 0x15f41004,
+        0x15f51004, 0x15f61004, 0x15f71004, 0x15f81004, 0x15f91004, 0x15fa1004, 0x15fb1004, 0x15fc1004,
+        0x15fd1004, 0x15fe1004, 0x15ff1004, 0x16001004, 0x16011004, 0x16021004, 0x16031004, 0x16041004,
+        0x16051004, 0x16061004, 0x16071004, 0x16081004, 0x16091004, 0x160a1004, 0x160b1004, 0x160c1004,
+        0x160d1004, 0x160e1004, 0x160f1004, 0x16101004, 0x16111004, 0x16121004, 0x16131004, 0x16141004,
+        0x16151004, 0x16161004, 0x16171004, 0x16181004, 0x16191004, 0x161a1004, 0x161b1004, 0x161c1004,
+        0x161d1004, 0x161e1004, 0x161f1004, 0x16201004, 0x16211004, 0x16221004, 0x16231004, 0x16241004,
+        0x16251004, 0x16261004, 0x16271004, 0x16281004, 0x16291004, 0x162a1004, 0x162b1004, 0x162c1004,
+        0x162d1004, 0x162e1004, 0x162f1004, 0x16301004, 0x16311004, 0x16321004, 0x16331004, 0x16341004,
+        0x16351004, 0x16361004, 0x16371004, 0x16381004, 0x16391004, 0x163a1004, 0x163b1004, 0x163c1004,
+        0x163d1004, 0x163e1004, 0x163f1004, 0x16401004, 0x16411004, 0x16421004, 0x16431004, 0x16441004,
+        0x16451004, 0x16461004, 0x16471004, 0x16481004, 0x16491004, 0x164a1004, 0x164b1004, 0x164c1004,
+        0x164d1004, 0x164e1004, 0x164f1004, 0x16501004, 0x16511004, 0x16521004, 0x16531004, 0x16541004,
+        0x16551004, 0x16561004, 0x16571004, 0x16581004, 0x16591004, 0x165a1004, 0x165b1004, 0x165c1004,
+        0x165d1004, 0x165e1004, 0x165f1004, 0x16601004, 0x16611004, 0x16621004, 0x16631004, 0x16641004,
+        0x16651004, 0x16661004, 0x16671004, 0x16681004, 0x16691004, 0x166a1004, 0x166b1004, 0x166c1004,
+        0x166d1004, 0x166e1004, 0x166f1004, 0x16701004, 0x16711004, 0x16721004, 0x16731004, 0x16741004,
+        0x16751004, 0x16761004, 0x16771004, 0x16781004, 0x16791004, 0x167a1004, 0x167b1004, 0x167c1004,
+        0x167d1004, 0x167e1004, 0x167f1004, 0x16801004, 0x16811004, 0x16821004, 0x16831004, 0x16841004,
+        0x16851004, 0x16861004, 0x16871004, 0x16881004, 0x16891004, 0x168a1004, 0x168b1004, 0x168c1004,
+        0x168d1004, 0x168e1004, 0x168f1004, 0x16901004, 0x16911004, 0x16921004, 0x16931004, 0x16941004,
+        0x16951004, 0x16961004, 0x16971004, 0x16981004, 0x16991004, 0x169a1004, 0x169b1004, 0x169c1004,
+        0x169d1004, 0x169e1004, 0x169f1004, 0x16a01004, 0x16a11004, 0x16a21004, 0x16a31004, 0x16a41004,
+        0x16a51004, 0x16a61004, 0x16a71004, 0x16a81004, 0x16a91004, 0x16aa1004, 0x16ab1004, 0x16ac1004,
+        0x16ad1004, 0x16ae1004, 0x16af1004, 0x16b01004, 0x16b11004, 0x16b21004, 0x16b31004, 0x16b41004,
+        0x16b51004, 0x16b61004, 0x16b71004, 0x16b81004, 0x16b91004, 0x16ba1004, 0x16bb1004, 0x16bc1004,
+        0x16bd1004, 0x16be1004, 0x16bf1004, 0x16c01004, 0x16c11004, 0x16c21004, 0x16c31004, 0x16c41004,
+        0x16c51004, 0x16c61004, 0x16c71004, 0x16c81004, 0x16c91004, 0x16ca1004, 0x16cb1004, 0x16cc1004,
+        0x16cd1004, 0x16ce1004, 0x16cf1004, 0x16d01004, 0x16d11004, 0x16d21004, 0x16d31004, 0x16d41004,
+        0x16d51004, 0x16d61004, 0x16d71004, 0x16d81004, 0x16d91004, 0x16da1004, 0x16db1004, 0x16dc1004,
+        0x16dd1004, 0x16de1004, 0x16df1004, 0x16e01004, 0x16e11004, 0x16e21004, 0x16e31004, 0x16e41004,
+        0x16e51004, 0x16e61004, 0x16e71004, 0x16e81004, 0x16e91004, 0x16ea1004, 0x16eb1004, 0x16ec1004,
+        0x16ed1004, 0x16ee1004, 0x16ef1004, 0x16f01004, 0x16f11004, 0x16f21004, 0x16f31004, 0x16f41004,
+        0x16f51004, 0x16f61004, 0x16f71004, 0x16f81004, 0x16f91004, 0x16fa1004, 0x16fb1004, 0x16fc1004,
+        0x16fd1004, 0x16fe1004, 0x16ff1004, 0x17001004, 0x17011004, 0x17021004, 0x17031004, 0x17041004,
+        0x17051004, 0x17061004, 0x17071004, 0x17081004, 0x17091004, 0x170a1004, 0x170b1004, 0x170c1004,
+        0x170d1004, 0x170e1004, 0x170f1004, 0x17101004, 0x17111004, 0x17121004, 0x17131004, 0x17141004,
+        0x17151004, 0x17161004, 0x17171004, 0x17181004, 0x17191004, 0x171a1004, 0x171b1004, 0x171c1004,
+        0x171d1004, 0x171e1004, 0x171f1004, 0x17201004, 0x17211004, 0x17221004, 0x17231004, 0x17241004,
+        0x17251004, 0x17261004, 0x17271004, 0x17281004, 0x17291004, 0x172a1004, 0x172b1004, 0x172c1004,
+        0x172d1004, 0x172e1004, 0x172f1004, 0x17301004, 0x17311004, 0x17321004, 0x17331004, 0x17341004,
+        0x17351004, 0x17361004, 0x17371004, 0x17381004, 0x17391004, 0x173a1004, 0x173b1004, 0x173c1004,
+        0x173d1004, 0x173e1004, 0x173f1004, 0x17401004, 0x17411004, 0x17421004, 0x17431004, 0x17441004,
+        0x17451004, 0x17461004, 0x17471004, 0x17481004, 0x17491004, 0x174a1004, 0x174b1004, 0x174c1004,
+        0x174d1004, 0x174e1004, 0x174f1004, 0x17501004, 0x17511004, 0x17521004, 0x17531004, 0x17541004,
+        0x17551004, 0x17561004, 0x17571004, 0x17581004, 0x17591004, 0x175a1004, 0x175b1004, 0x175c1004,
+        0x175d1004, 0x175e1004, 0x175f1004, 0x17601004, 0x17611004, 0x17621004, 0x17631004, 0x17641004,
+        0x17651004, 0x17661004, 0x189e1004, 0x189f1004, 0x18a01004, 0x18a11004, 0x18a21004, 0x18a31004,
+        0x18a41004, 0x18a51004, 0x18a61004, 0x18a71004, 0x18a81004, 0x18a91004, 0x18aa1004, 0x18ab1004,
+        0x18ac1004, 0x18ad1004, 0x18ae1004, 0x18af1004, 0x18b01004, 0x18b11004, 0x18b21004, 0x18b31004,
+        0x18b41004, 0x18b51004, 0x18b61004, 0x18b71004, 0x18b81004, 0x18b91004, 0x18ba1004, 0x18bb1004,
+        0x18bc1004, 0x18bd1004, 0x18be1004, 0x18bf1004, 0x18c01004, 0x18c11004, 0x18c21004, 0x18c31004,
+        0x18c41004, 0x18c51004, 0x18c61004, 0x18c71004, 0x18c81004, 0x18c91004, 0x18ca1004, 0x18cb1004,
+        0x18cc1004, 0x18cd1004, 0x18ce1004, 0x18cf1004, 0x18d01004, 0x18d11004, 0x18d21004, 0x18d31004,
+        0x18d41004, 0x18d51004, 0x18d61004, 0x18d71004, 0x18d81004, 0x18d91004, 0x18da1004, 0x18db1004,
+        0x18dc1004, 0x18dd1004, 0x18de1004, 0x18df1004, 0x18e01004, 0x18e11004, 0x18e21004, 0x18e31004,
+        0x18e41004, 0x18e51004, 0x18e61004, 0x18e71004, 0x18e81004, 0x18e91004, 0x18ea1004, 0x18eb1004,
+        0x18ec1004, 0x18ed1004, 0x18ee1004, 0x18ef1004, 0x18f01004, 0x18f11004, 0x18f21004, 0x18f31004,
+        0x18f41004, 0x18f51004, 0x18f61004, 0x18f71004, 0x18f81004, 0x18f91004, 0x18fa1004, 0x18fb1004,
+        0x18fc1004, 0x18fd1004, 0x18fe1004, 0x18ff1004, 0x19001004, 0x19011004, 0x19021004, 0x19031004,
+        0x19041004, 0x19051004, 0x19061004, 0x19071004, 0x19081004, 0x19091004, 0x190a1004, 0x190b1004,
+        0x190c1004, 0x190d1004, 0x190e1004, 0x190f1004, 0x19101004, 0x19111004, 0x19121004, 0x19131004,
+        0x19141004, 0x19151004, 0x19161004, 0x19171004, 0x19181004, 0x19191004, 0x191a1004, 0x191b1004,
+        0x191c1004, 0x191d1004, 0x191e1004, 0x191f1004, 0x19201004, 0x19211004, 0x19221004, 0x19231004,
+        0x19241004, 0x19251004, 0x19261004, 0x19271004, 0x19281004, 0x19291004, 0x192a1004, 0x192b1004,
+        0x192c1004, 0x192d1004, 0x192e1004, 0x192f1004, 0x19301004, 0x19311004, 0x19321004, 0x19331004,
+        0x19341004, 0x19351004, 0x19361004, 0x19371004, 0x19381004, 0x19391004, 0x193a1004, 0x193b1004,
+        0x193c1004, 0x193d1004, 0x193e1004, 0x193f1004, 0x19401004, 0x19411004, 0x19421004, 0x19431004,
+        0x19441004, 0x19451004, 0x19461004, 0x19471004, 0x19481004, 0x19491004, 0x194a1004, 0x194b1004,
+        0x194c1004, 0x194d1004, 0x194e1004, 0x194f1004, 0x19501004, 0x19511004, 0x19521004, 0x19531004,
+        0x19541004, 0x19551004, 0x19561004, 0x19571004, 0x19581004, 0x19591004, 0x195a1004, 0x195b1004,
+        0x195c1004, 0x195d1004, 0x195e1004, 0x195f1004, 0x19601004, 0x19611004, 0x19621004, 0x19631004,
+        0x19641004, 0x19651004, 0x19661004, 0x19671004, 0x19681004, 0x19691004, 0x196a1004, 0x196b1004,
+        0x196c1004, 0x196d1004, 0x196e1004, 0x196f1004, 0x19701004, 0x19711004, 0x19721004, 0x19731004,
+        0x19741004, 0x19751004, 0x19761004, 0x19771004, 0x19781004, 0x19791004, 0x197a1004, 0x197b1004,
+        0x197c1004, 0x197d1004, 0x197e1004, 0x197f1004, 0x19801004, 0x19811004, 0x19821004, 0x19831004,
+        0x19841004, 0x19851004, 0x19861004, 0x19871004, 0x19881004, 0x19891004, 0x198a1004, 0x198b1004,
+        0x198c1004, 0x198d1004, 0x198e1004, 0x198f1004, 0x19901004, 0x19911004, 0x19921004, 0x19931004,
+        0x19941004, 0x19951004, 0x19961004, 0x19971004, 0x19981004, 0x19991004, 0x199a1004, 0x199b1004,
+        0x199c1004, 0x199d1004, 0x199e1004, 0x199f1004, 0x19a01004, 0x19a11004, 0x19a21004, 0x19a31004,
+        0x19a41004, 0x19a51004, 0x19a61004, 0x19a71004, 0x19a81004, 0x19a91004, 0x19aa1004, 0x19ab1004,
+        0x19ac1004, 0x19ad1004, 0x19ae1004, 0x19af1004, 0x19b01004, 0x19b11004, 0x19b21004, 0x19b31004,
+        0x19b41004, 0x19b51004, 0x19b61004, 0x19b71004, 0x19b81004, 0x19b91004, 0x19ba1004, 0x19bb1004,
+        0x19bc1004, 0x19bd1004, 0x19be1004, 0x19bf1004, 0x19c01004, 0x19c11004, 0x19c21004, 0x19c31004,
+        0x19c41004, 0x19c51004, 0x19c61004, 0x19c71004, 0x19c81004, 0x19c91004, 0x19ca1004, 0x19cb1004,
+        0x19cc1004, 0x19cd1004, 0x19ce1004, 0x19cf1004, 0x19d01004, 0x19d11004, 0x19d21004, 0x19d31004,
+        0x19d41004, 0x19d51004, 0x19d61004, 0x19d71004, 0x19d81004, 0x19d91004, 0x19da1004, 0x19db1004,
+        0x19dc1004, 0x19dd1004, 0x19de1004, 0x19df1004, 0x19e01004, 0x19e11004, 0x19e21004, 0x19e31004,
+        0x19e41004, 0x19e51004, 0x19e61004, 0x19e71004, 0x19e81004, 0x19e91004, 0x19ea1004, 0x19eb1004,
+        0x19ec1004, 0x19ed1004, 0x19ee1004, 0x19ef1004, 0x19f01004, 0x19f11004, 0x19f21004, 0x19f31004,
+        0x19f41004, 0x19f51004, 0x19f61004, 0x19f71004, 0x19f81004, 0x19f91004, 0x19fa1004, 0x19fb1004,
+        0x19fc1004, 0x19fd1004, 0x19fe1004, 0x19ff1004, 0x1a001004, 0x1a011004, 0x1a021004, 0x1a031004,
+        0x1a041004, 0x1a051004, 0x1a061004, 0x1a071004, 0x1a081004, 0x1a091004, 0x1a0a1004, 0x1a0b1004,
+        0x1a0c1004, 0x1a0d1004, 0x1a0e1004, 0x1a0f1004, 0x1a101004, 0x1a111004, 0x1a121004, 0x1a131004,
+        0x1a141004, 0x1a151004, 0x1a161004, 0x1a171004, 0x1a181004, 0x1a191004, 0x1a1a1004, 0x1a1b1004,
+        0x1a1c1004, 0x1a1d1004, 0x1a1e1004, 0x1a1f1004, 0x1a201004, 0x1a211004, 0x1a221004, 0x1a231004,
+        0x1a241004, 0x1a251004, 0x1a261004, 0x1a271004, 0x1a281004, 0x1a291004, 0x1a2a1004, 0x1a2b1004,
+        0x1a2c1004, 0x1a2d1004, 0x1a2e1004, 0x1a2f1004, 0x1a301004, 0x1a311004, 0x1a321004, 0x1a331004,
+        0x1a341004, 0x1a351004, 0x1a361004, 0x1a371004, 0x1a381004, 0x1a391004, 0x1a3a1004, 0x1a3b1004,
+        0x1a3c1004, 0x1a3d1004, 0x1a3e1004, 0x1a3f1004, 0x1a401004, 0x1a411004, 0x1a421004, 0x1a431004,
+        0x1a441004, 0x1a451004, 0x1a461004, 0x1a471004, 0x1a481004, 0x1a491004, 0x1a4a1004, 0x1a4b1004,
+        0x1a4c1004, 0x1a4d1004, 0x1a4e1004, 0x1a4f1004, 0x1a501004, 0x1a511004, 0x1a521004, 0x1a531004,
+        0x1a541004, 0x1a551004, 0x1a561004, 0x1a571004, 0x1a581004, 0x1a591004, 0x1a5a1004, 0x1a5b1004,
+        0x1a5c1004, 0x1a5d1004, 0x1a5e1004, 0x1a5f1004, 0x1a601004, 0x1a611004, 0x1a621004, 0x1a631004,
+        0x1a641004, 0x1a651004, 0x1a661004, 0x1a671004, 0x1a681004, 0x1a691004, 0x1a6a1004, 0x1a6b1004,
+        0x1a6c1004, 0x1a6d1004, 0x1a6e1004, 0x1a6f1004, 0x1a701004, 0x1a711004, 0x1a721004, 0x1a731004,
+        0x1a741004, 0x1a751004, 0x1a761004, 0x1a771004, 0x1a781004, 0x1a791004, 0x1a7a1004, 0x1a7b1004,
+        0x1a7c1004, 0x1a7d1004, 0x1a7e1004, 0x1a7f1004, 0x1a801004, 0x1a811004, 0x1a821004, 0x1a831004,
+        0x1a841004, 0x1a851004, 0x1a861004, 0x1a871004, 0x1a881004, 0x1a891004, 0x1a8a1004, 0x1a8b1004,
+        0x1a8c1004, 0x1a8d1004, 0x1a8e1004, 0x1a8f1004, 0x1a901004, 0x1a911004, 0x1a921004, 0x1a931004,
+        0x1a941004, 0x1a951004, 0x1a961004, 0x1a971004, 0x1a981004, 0x1a991004, 0x1a9a1004, 0x1a9b1004,
+        0x1a9c1004, 0x1a9d1004, 0x1a9e1004, 0x1a9f1004, 0x1aa01004, 0x1aa11004, 0x1aa21004, 0x1aa31004,
+        0x1aa41004, 0x1aa51004, 0x1aa61004, 0x1aa71004, 0x1aa81004, 0x1aa91004, 0x1aaa1004, 0x1aab1004,
+        0x1aac1004, 0x1aad1004, 0x1aae1004, 0x1aaf1004, 0x1ab01004, 0x1ab11004, 0x1ab21004, 0x1ab31004,
+        0x1ab41004, 0x1ab51004, 0x1ab61004, 0x1ab71004, 0x1ab81004, 0x1ab91004, 0x1aba1004, 0x1abb1004,
+        0x1abc1004, 0x1abd1004, 0x1abe1004, 0x1abf1004, 0x1ac01004, 0x1ac11004, 0x1ac21004, 0x1ac31004,
+        0x1ac41004, 0x1ac51004, 0x1ac61004, 0x1ac71004, 0x1ac81004, 0x1ac91004, 0x1aca1004, 0x1acb1004,
+        0x1acc1004, 0x1acd1004, 0x1ace1004, 0x1acf1004, 0x1ad01004, 0x1ad11004, 0x1ad21004, 0x1ad31004,
+        0x1ad41004, 0x1ad51004, 0x1ad61004, 0x1ad71004, 0x1ad81004, 0x1ad91004, 0x1ada1004, 0x1adb1004,
+        0x1adc1004, 0x1add1004, 0x1ade1004, 0x1adf1004, 0x1ae01004, 0x1ae11004, 0x1ae21004, 0x1ae31004,
+        0x1ae41004, 0x1ae51004, 0x1ae61004, 0x1ae71004, 0x1ae81004, 0x1ae91004, 0x1aea1004, 0x1aeb1004,
+        0x1aec1004, 0x1aed1004, 0x1aee1004, 0x1aef1004, 0x1af01004, 0x1af11004, 0x1af21004, 0x1af31004,
+        0x1af41004, 0x1af51004, 0x1af61004, 0x1af71004, 0x1af81004, 0x1af91004, 0x1afa1004, 0x1afb1004,
+        0x1afc1004, 0x1afd1004, 0x1afe1004, 0x17671004, 0x17681004, 0x17691004, 0x176a1004, 0x176b1004,
+        0x176c1004, 0x176d1004, 0x176e1004, 0x176f1004, 0x17701004, 0x17711004, 0x17721004, 0x17731004,
+        0x17741004, 0x17751004, 0x17761004, 0x17771004, 0x17781004, 0x17791004, 0x177a1004, 0x177b1004,
+        0x177c1004, 0x177d1004, 0x177e1004, 0x177f1004, 0x17801004, 0x17811004, 0x17821004, 0x17831004,
+        0x17841004, 0x17851004, 0x17861004, 0x17871004, 0x17881004, 0x17891004, 0x178a1004, 0x178b1004,
+        0x178c1004, 0x178d1004, 0x178e1004, 0x178f1004, 0x17901004, 0x17911004, 0x17921004, 0x17931004,
+        0x17941004, 0x17951004, 0x17961004, 0x17971004, 0x17981004, 0x17991004, 0x179a1004, 0x179b1004,
+        0x179c1004, 0x179d1004, 0x179e1004, 0x179f1004, 0x17a01004, 0x17a11004, 0x17a21004, 0x17a31004,
+        0x17a41004, 0x17a51004, 0x17a61004, 0x17a71004, 0x17a81004, 0x17a91004, 0x17aa1004, 0x17ab1004,
+        0x17ac1004, 0x17ad1004, 0x17ae1004, 0x17af1004, 0x17b01004, 0x17b11004, 0x17b21004, 0x17b31004,
+        0x17b41004, 0x17b51004, 0x17b61004, 0x17b71004, 0x17b81004, 0x17b91004, 0x17ba1004, 0x17bb1004,
+        0x17bc1004, 0x17bd1004, 0x17be1004, 0x17bf1004, 0x17c01004, 0x17c11004, 0x17c21004, 0x17c31004,
+        0x17c41004, 0x17c51004, 0x17c61004, 0x17c71004, 0x17c81004, 0x17c91004, 0x17ca1004, 0x17cb1004,
+        0x17cc1004, 0x17cd1004, 0x17ce1004, 0x17cf1004, 0x17d01004, 0x17d11004, 0x17d21004, 0x17d31004,
+        0x17d41004, 0x17d51004, 0x17d61004, 0x17d71004, 0x17d81004, 0x17d91004, 0x17da1004, 0x17db1004,
+        0x17dc1004, 0x17dd1004, 0x17de1004, 0x17df1004, 0x17e01004, 0x17e11004, 0x17e21004, 0x17e31004,
+        0x17e41004, 0x17e51004, 0x17e61004, 0x17e71004, 0x17e81004, 0x17e91004, 0x17ea1004, 0x17eb1004,
+        0x17ec1004, 0x17ed1004, 0x17ee1004, 0x17ef1004, 0x17f01004, 0x17f11004, 0x17f21004, 0x17f31004,
+        0x17f41004, 0x17f51004, 0x17f61004, 0x17f71004, 0x17f81004, 0x17f91004, 0x17fa1004, 0x17fb1004,
+        0x17fc1004, 0x17fd1004, 0x17fe1004, 0x17ff1004, 0x18001004, 0x18011004, 0x18021004, 0x18031004,
+        0x18041004, 0x18051004, 0x18061004, 0x18071004, 0x18081004, 0x18091004, 0x180a1004, 0x180b1004,
+        0x180c1004, 0x180d1004, 0x180e1004, 0x180f1004, 0x18101004, 0x18111004, 0x18121004, 0x18131004,
+        0x18141004, 0x18151004, 0x18161004, 0x18171004, 0x18181004, 0x18191004, 0x181a1004, 0x181b1004,
+        0x181c1004, 0x181d1004, 0x181e1004, 0x181f1004, 0x18201004, 0x18211004, 0x18221004, 0x18231004,
+        0x18241004, 0x18251004, 0x18261004, 0x18271004, 0x18281004, 0x18291004, 0x182a1004, 0x182b1004,
+        0x182c1004, 0x182d1004, 0x182e1004, 0x182f1004, 0x18301004, 0x18311004, 0x18321004, 0x18331004,
+        0x18341004, 0x18351004, 0x18361004, 0x18371004, 0x18381004, 0x18391004, 0x183a1004, 0x183b1004,
+        0x183c1004, 0x183d1004, 0x183e1004, 0x183f1004, 0x18401004, 0x18411004, 0x18421004, 0x18431004,
+        0x18441004, 0x18451004, 0x18461004, 0x18471004, 0x18481004, 0x18491004, 0x184a1004, 0x184b1004,
+        0x184c1004, 0x184d1004, 0x184e1004, 0x184f1004, 0x18501004, 0x18511004, 0x18521004, 0x18531004,
+        0x18541004, 0x18551004, 0x18561004, 0x18571004, 0x18581004, 0x18591004, 0x185a1004, 0x185b1004,
+        0x185c1004, 0x185d1004, 0x185e1004, 0x185f1004, 0x18601004, 0x18611004, 0x18621004, 0x18631004,
+        0x18641004, 0x13f91004, 0x13fa1004, 0x13fb1004, 0x13fc1004, 0x13fd1004, 0x13fe1004, 0x13ff1004,
+        0x14001004, 0x14011004, 0x14021004, 0x14031004, 0x14041004, 0x14051004, 0x14061004, 0x14071004,
+        0x14081004, 0x14091004, 0x140a1004, 0x140b1004, 0x140c1004, 0x140d1004, 0x140e1004, 0x140f1004,
+        0x14101004, 0x14111004, 0x14121004, 0x14131004, 0x14141004, 0x14151004, 0x14161004, 0x14171004,
+        0x14181004, 0x14191004, 0x141a1004, 0x141b1004, 0x141c1004, 0x141d1004, 0x141e1004, 0x141f1004,
+        0x14201004, 0x14211004, 0x14221004, 0x14231004, 0x14241004, 0x14251004, 0x14261004, 0x14271004,
+        0x14281004, 0x14291004, 0x142a1004, 0x142b1004, 0x142c1004, 0x142d1004, 0x142e1004, 0x142f1004,
+        0x14301004, 0x14311004, 0x14321004, 0x14331004, 0x14341004, 0x14351004, 0x14361004, 0x14371004,
+        0x14381004, 0x14391004, 0x143a1004, 0x143b1004, 0x143c1004, 0x143d1004, 0x143e1004, 0x143f1004,
+        0x14401004, 0x14411004, 0x14421004, 0x14431004, 0x14441004, 0x14451004, 0x14461004, 0x14471004,
+        0x14481004, 0x14491004, 0x144a1004, 0x144b1004, 0x144c1004, 0x144d1004, 0x144e1004, 0x144f1004,
+        0x14501004, 0x14511004, 0x14521004, 0x14531004, 0x14541004, 0x14551004, 0x14561004, 0x14571004,
+        0x14581004, 0x14591004, 0x145a1004, 0x18651004, 0x18661004, 0x18671004, 0x18681004, 0x18691004,
+        0x186a1004, 0x186b1004, 0x186c1004, 0x186d1004, 0x186e1004, 0x186f1004, 0x18701004, 0x18711004,
+        0x18721004, 0x18731004, 0x18741004, 0x18751004, 0x18761004, 0x18771004, 0x18781004, 0x18791004,
+        0x187a1004, 0x187b1004, 0x187c1004, 0x187d1004, 0x187e1004, 0x187f1004, 0x18801004, 0x18811004,
+        0x18821004, 0x18831004, 0x18841004, 0x18851004, 0x18861004, 0x18871004, 0x18881004, 0x18891004,
+        0x188a1004, 0x188b1004, 0x188c1004, 0x188d1004, 0x188e1004, 0x188f1004, 0x18901004, 0x18911004,
+        0x18921004, 0x18931004, 0x18941004, 0x18951004, 0x18961004, 0x18971004, 0x18981004, 0x18991004,
+        0x189a1004, 0x189b1004, 0x189c1004, 0x189d1004, 0x09691004, 0x096a1004, 0x096b1004, 0x096c1004,
+        0x096d1004, 0x096e1004, 0x096f1004, 0x09701004, 0x09711004, 0x09721004, 0x09731004, 0x09741004,
+        0x09751004, 0x09761004, 0x09771004, 0x09781004, 0x09791004, 0x097a1004, 0x097b1004, 0x097c1004,
+        0x097d1004, 0x097e1004, 0x097f1004, 0x09801004, 0x09811004, 0x09821004, 0x09831004, 0x09841004,
+        0x09851004, 0x09861004, 0x09871004, 0x09881004, 0x09891004, 0x098a1004, 0x098b1004, 0x098c1004,
+        0x098d1004, 0x098e1004, 0x098f1004, 0x09901004, 0x09911004, 0x09921004, 0x09931004, 0x09941004,
+        0x09951004, 0x09961004, 0x09971004, 0x09981004, 0x09991004, 0x099a1004, 0x099b1004, 0x099c1004,
+        0x099d1004, 0x099e1004, 0x099f1004, 0x09a01004, 0x09a11004, 0x09a21004, 0x09a31004, 0x09a41004,
+        0x09a51004, 0x09a61004, 0x09a71004, 0x09a81004, 0x09a91004, 0x09aa1004, 0x09ab1004, 0x09ac1004,
+        0x09ad1004, 0x09ae1004, 0x09af1004, 0x09b01004, 0x09b11004, 0x09b21004, 0x09b31004, 0x09b41004,
+        0x09b51004, 0x09b61004, 0x09b71004, 0x09b81004, 0x09b91004, 0x09ba1004, 0x09bb1004, 0x09bc1004,
+        0x09bd1004, 0x09be1004, 0x09bf1004, 0x09c01004, 0x09c11004, 0x09c21004, 0x09c31004, 0x09c41004,
+        0x09c51004, 0x09c61004, 0x09c71004, 0x09c81004, 0x09c91004, 0x09ca1004, 0x09cb1004, 0x09cc1004,
+        0x09cd1004, 0x09ce1004, 0x09cf1004, 0x09d01004, 0x09d11004, 0x09d21004, 0x09d31004, 0x09d41004,
+        0x09d51004, 0x09d61004, 0x09d71004, 0x09d81004, 0x09d91004, 0x09da1004, 0x09db1004, 0x09dc1004,
+        0x09dd1004, 0x09de1004, 0x09df1004, 0x09e01004, 0x09e11004, 0x09e21004, 0x09e31004, 0x09e41004,
+        0x09e51004, 0x09e61004, 0x09e71004, 0x09e81004, 0x09e91004, 0x09ea1004, 0x09eb1004, 0x09ec1004,
+        0x09ed1004, 0x09ee1004, 0x09ef1004, 0x09f01004, 0x09f11004, 0x09f21004, 0x09f31004, 0x09f41004,
+        0x09f51004, 0x09f61004, 0x09f71004, 0x09f81004, 0x09f91004, 0x09fa1004, 0x09fb1004, 0x09fc1004,
+        0x09fd1004, 0x09fe1004, 0x09ff1004, 0x0a001004, 0x0a011004, 0x0a021004, 0x0a031004, 0x0a041004,
+        0x0a051004, 0x0a061004, 0x0a071004, 0x0a081004, 0x0a091004, 0x0a0a1004, 0x0a0b1004, 0x0a0c1004,
+        0x0a0d1004, 0x0a0e1004, 0x0a0f1004, 0x0a101004, 0x0a111004, 0x0a121004, 0x0a131004, 0x0a141004,
+        0x0a151004, 0x0a161004, 0x0a171004, 0x0a181004, 0x0a191004, 0x0a1a1004, 0x0a1b1004, 0x0a1c1004,
+        0x0a1d1004, 0x0a1e1004, 0x0a1f1004, 0x0a201004, 0x0a211004, 0x0a221004, 0x0a231004, 0x0a241004,
+        0x0a251004, 0x0a261004, 0x0a271004, 0x0a281004, 0x0a291004, 0x0a2a1004, 0x0a2b1004, 0x0a2c1004,
+        0x0a2d1004, 0x0a2e1004, 0x0a2f1004, 0x0a301004, 0x0a311004, 0x0a321004, 0xfb401044, 0xce3d0000,
+        0xfb401044, 0xce380000, 0xfb401044, 0xce410000, 0xfb841044, 0x81220000, 0xfb401044, 0xcf600000,
+        0xfb401044, 0xcfbb0000, 0xfb401044, 0xd0020000, 0xfb401044, 0xd07a0000, 0xfb401044, 0xd0990000,
+        0xfb401044, 0xd0cf0000, 0xfb801044, 0xb49e0000, 0xfb841044, 0x863a0000, 0xfb401044, 0xd1540000,
+        0xfb401044, 0xd1640000, 0xfb401044, 0xd1770000, 0xfb841044, 0x851c0000, 0xfb801044, 0xb4b90000,
+        0xfb401044, 0xd1670000, 0xfb401044, 0xd18d0000, 0xfb841044, 0x854b0000, 0xfb401044, 0xd1970000,
+        0xfb401044, 0xd1a40000, 0xfb401044, 0xcecc0000, 0xfb401044, 0xd1ac0000, 0xfb851044, 0x91df0000,
+        0xfb401044, 0xd1f50000, 0xfb401044, 0xd2030000, 0xfb801044, 0xb4df0000, 0xfb401044, 0xd23b0000,
+        0xfb401044, 0xd2460000, 0xfb401044, 0xd2720000, 0xfb401044, 0xd2770000, 0xfb801044, 0xb5150000,
+        0xfb401044, 0xd3050000, 0xfb401044, 0xd3060000, 0xfb401044, 0xd3490000, 0xfb401044, 0xd35a0000,
+        0xfb401044, 0xd3730000, 0xfb401044, 0xd37d0000, 0xfb401044, 0xd37f0000, 0xfb841044, 0x8a2c0000,
+        0xfb401044, 0xf0700000, 0xfb401044, 0xd3ca0000, 0xfb401044, 0xd3df0000, 0xfb841044, 0x8b630000,
+        0xfb401044, 0xd3eb0000, 0xfb401044, 0xd3f10000, 0xfb401044, 0xd4060000, 0xfb401044, 0xd49e0000,
+        0xfb401044, 0xd4380000, 0xfb401044, 0xd4480000, 0xfb401044, 0xd4680000, 0xfb401044, 0xd4a20000,
+        0xfb401044, 0xd4f60000, 0xfb401044, 0xd5100000, 0xfb401044, 0xd5530000, 0xfb401044, 0xd5630000,
+        0xfb401044, 0xd5840000, 0xfb401044, 0xd5ab0000, 0xfb401044, 0xd5b30000, 0xfb401044, 0xd5c20000,
+        0xfb401044, 0xd7160000, 0xfb401044, 0xd7170000, 0xfb401044, 0xd6510000, 0xfb401044, 0xd6740000,
+        0xfb401044, 0xd8ee0000, 0xfb401044, 0xd7ce0000, 0xfb401044, 0xd7f40000, 0xfb401044, 0xd80d0000,
+        0xfb401044, 0xd78b0000, 0xfb401044, 0xd8320000, 0xfb401044, 0xd8310000, 0xfb401044, 0xd8ac0000,
+        0xfb841044, 0x94e40000, 0xfb401044, 0xd8f20000, 0xfb401044, 0xd8f70000, 0xfb401044, 0xd9060000,
+        0xfb401044, 0xd91a0000, 0xfb401044, 0xd9220000, 0xfb401044, 0xd9620000, 0xfb841044, 0x96a80000,
+        0xfb841044, 0x96ea0000, 0xfb401044, 0xd9ec0000, 0xfb401044, 0xda1b0000, 0xfb401044, 0xda270000,
+        0xfb401044, 0xd9d80000, 0xfb401044, 0xda660000, 0xfb801044, 0xb6ee0000, 0xfb801044, 0xb6fc0000,
+        0xfb401044, 0xdb080000, 0xfb401044, 0xdb3e0000, 0xfb841044, 0x99c80000, 0xfb401044, 0xdbc30000,
+        0xfb401044, 0xdbd80000, 0xfb401044, 0xdbf30000, 0xfb841044, 0x9b180000, 0xfb401044, 0xdbff0000,
+        0xfb401044, 0xdc060000, 0xfb401044, 0xdf530000, 0xfb401044, 0xdc220000, 0xfb801044, 0xb7810000,
+        0xfb401044, 0xdc600000, 0xfb401044, 0xdcc00000, 0xfb401044, 0xdc8d0000, 0xfb841044, 0x9de40000,
+        0xfb401044, 0xdd430000, 0xfb841044, 0x9de60000, 0xfb401044, 0xdd6e0000, 0xfb401044, 0xdd6b0000,
+        0xfb401044, 0xdd7c0000, 0xfb401044, 0xdde10000, 0xfb401044, 0xdde20000, 0xfb801044, 0xb82f0000,
+        0xfb401044, 0xddfd0000, 0xfb401044, 0xde280000, 0xfb401044, 0xde3d0000, 0xfb401044, 0xde690000,
+        0xfb801044, 0xb8620000, 0xfb841044, 0xa1830000, 0xfb801044, 0xb87c0000, 0xfb401044, 0xdeb00000,
+        0xfb401044, 0xdeb30000, 0xfb401044, 0xdeb60000, 0xfb851044, 0xa3920000, 0xfb401044, 0xdefe0000,
+        0xfb841044, 0xa3310000, 0xfb411044, 0x82010000, 0xfb401044, 0xdf220000, 0xfb801044, 0xb8c70000,
+        0xfb841044, 0xb2b80000, 0xfb841044, 0xe1da0000, 0xfb401044, 0xdf620000, 0xfb401044, 0xdf6b0000,
+        0xfb801044, 0xb8e30000, 0xfb401044, 0xdf9a0000, 0xfb401044, 0xdfcd0000, 0xfb401044, 0xdfd70000,
+        0xfb401044, 0xdff90000, 0xfb401044, 0xe0810000, 0xfb801044, 0xb93a0000, 0xfb801044, 0xb91c0000,
+        0xfb841044, 0xa6d40000, 0xfb401044, 0xe0c70000, 0xfb401044, 0xe1480000, 0xfb401044, 0xe14c0000,
+        0xfb401044, 0xe17a0000, 0xfb401044, 0xe1b20000, 0xfb401044, 0xe1a40000, 0xfb401044, 0xe1af0000,
+        0xfb401044, 0xe1de0000, 0xfb401044, 0xe2100000, 0xfb401044, 0xe21b0000, 0xfb401044, 0xe25d0000,
+        0xfb401044, 0xe2b10000, 0xfb401044, 0xe2d40000, 0xfb401044, 0xe3500000, 0xfb841044, 0xab0c0000,
+        0xfb401044, 0xe33d0000, 0xfb401044, 0xe2fc0000, 0xfb401044, 0xe3680000, 0xfb401044, 0xe3830000,
+        0xfb401044, 0xe3e40000, 0xfb841044, 0xabf10000, 0xfb401044, 0xe4220000, 0xfb401044, 0xe3c50000,
+        0xfb401044, 0xe3a90000, 0xfb801044, 0xba2e0000, 0xfb401044, 0xe4690000, 0xfb401044, 0xe47e0000,
+        0xfb401044, 0xe49d0000, 0xfb401044, 0xe4770000, 0xfb801044, 0xba6c0000, 0xfb401044, 0xe56c0000,
+        0xfb841044, 0xb00a0000, 0xfb401044, 0xe5e30000, 0xfb401044, 0xe6f80000, 0xfb401044, 0xe6490000,
+        0xfb801044, 0xbb190000, 0xfb801044, 0xbb080000, 0xfb801044, 0xbae40000, 0xfb401044, 0xd1920000,
+        0xfb401044, 0xd1950000, 0xfb401044, 0xe7000000, 0xfb401044, 0xe69c0000, 0xfb411044, 0x80ad0000,
+        0xfb801044, 0xc3d90000, 0xfb401044, 0xe7210000, 0xfb401044, 0xe75e0000, 0xfb401044, 0xe7530000,
+        0xfb841044, 0xb3c30000, 0xfb801044, 0xbb490000, 0xfb401044, 0xe7fa0000, 0xfb401044, 0xe7850000,
+        0xfb401044, 0xe8520000, 0xfb841044, 0xb46d0000, 0xfb401044, 0xe88e0000, 0xfb401044, 0xe81f0000,
+        0xfb401044, 0xe9140000, 0xfb401044, 0xe9420000, 0xfb401044, 0xe9a30000, 0xfb401044, 0xe9ea0000,
+        0xfb401044, 0xeaa80000, 0xfb841044, 0xb6a30000, 0xfb401044, 0xeadb0000, 0xfb801044, 0xbc180000,
+        0xfb401044, 0xeb210000, 0xfb841044, 0xb8a70000, 0xfb401044, 0xeb540000, 0xfb801044, 0xbc4e0000,
+        0xfb401044, 0xeb720000, 0xfb401044, 0xeb9f0000, 0xfb401044, 0xebbb0000, 0xfb841044, 0xba8d0000,
+        0xfb841044, 0x9d0b0000, 0xfb841044, 0xbafa0000, 0xfb401044, 0xec4e0000, 0xfb841044, 0xbcbc0000,
+        0xfb401044, 0xecbf0000, 0xfb401044, 0xeccd0000, 0xfb401044, 0xec670000, 0xfb401044, 0xed160000,
+        0xfb401044, 0xed3e0000, 0xfb401044, 0xed690000, 0xfb401044, 0xed780000, 0xfb401044, 0xed850000,
+        0xfb841044, 0xbd1e0000, 0xfb401044, 0xed340000, 0xfb401044, 0xee2f0000, 0xfb401044, 0xee6e0000,
+        0xfb801044, 0xbd330000, 0xfb401044, 0xeec70000, 0xfb841044, 0xbed10000, 0xfb401044, 0xedf90000,
+        0xfb401044, 0xef6e0000, 0xfb841044, 0xbf5e0000, 0xfb841044, 0xbf8e0000, 0xfb401044, 0xefc60000,
+        0xfb401044, 0xf0390000, 0xfb401044, 0xf01b0000, 0xfb801044, 0xbd960000, 0xfb401044, 0xf04a0000,
+        0xfb401044, 0xf07d0000, 0xfb401044, 0xf0770000, 0xfb401044, 0xf0ad0000, 0xfb841044, 0x85250000,
+        0xfb401044, 0xf1450000, 0xfb841044, 0xc2630000, 0xfb401044, 0xf19c0000, 0xfb841044, 0xc3ab0000,
+        0xfb401044, 0xf2280000, 0xfb401044, 0xf2500000, 0xfb841044, 0xc6080000, 0xfb401044, 0xf2800000,
+        0xfb401044, 0xf2950000, 0xfb841044, 0xc7350000, 0xfb841044, 0xc8140000, 0xfb401044, 0xf37a0000,
+        0xfb401044, 0xf38b0000, 0xfb801044, 0xbeac0000, 0xfb401044, 0xf3a50000, 0xfb801044, 0xbeb80000,
+        0xfb401044, 0xf4470000, 0xfb401044, 0xf45c0000, 0xfb401044, 0xf4850000, 0xfb401044, 0xf4ca0000,
+        0xfb801044, 0xbf1b0000, 0xfb401044, 0xf5240000, 0xfb841044, 0xcc360000, 0xfb401044, 0xf53e0000,
+        0xfb841044, 0xcc920000, 0xfb841044, 0xa19f0000, 0xfb401044, 0xf6100000, 0xfb841044, 0xcfa10000,
+        0xfb841044, 0xcfb80000, 0xfb841044, 0xd0440000, 0xfb801044, 0xbffc0000, 0xfb801044, 0xc0080000,
+        0xfb841044, 0xd0f30000, 0xfb841044, 0xd0f20000, 0xfb841044, 0xd1190000, 0xfb841044, 0xd1330000,
+        0xfb401044, 0xf71e0000, 0xfb401044, 0xf71f0000, 0xfb401044, 0xf78b0000, 0xfb801044, 0xc0460000,
+        0xfb801044, 0xc0960000, 0xfb841044, 0xd41d0000, 0xfb401044, 0xf84e0000, 0xfb801044, 0xc0e30000,
+        0xfb841044, 0xd6260000, 0xfb841044, 0xd69a0000, 0xfb841044, 0xd6c50000, 0xfb401044, 0xf9eb0000,
+        0xfb801044, 0xc12f0000, 0xfb401044, 0xfa4a0000, 0xfb401044, 0xfa4f0000, 0xfb841044, 0xd97c0000,
+        0xfb841044, 0xdaa70000, 0xfb401044, 0xfaee0000, 0xfb801044, 0xc2020000, 0xfb841044, 0xdbab0000,
+        0xfb401044, 0xfbc60000, 0xfb401044, 0xfbc90000, 0xfb801044, 0xc2270000, 0xfb841044, 0xdc800000,
+        0xfb401044, 0xfcd20000, 0xfb801044, 0xc2a00000, 0xfb401044, 0xfce80000, 0xfb401044, 0xfce30000,
+        0xfb401044, 0xfd000000, 0xfb841044, 0xdf860000, 0xfb401044, 0xfd630000, 0xfb801044, 0xc3010000,
+        0xfb401044, 0xfdc70000, 0xfb401044, 0xfe020000, 0xfb401044, 0xfe450000, 0xfb801044, 0xc3340000,
+        0xfb841044, 0xe2280000, 0xfb841044, 0xe2470000, 0xfb801044, 0xc3590000, 0xfb841044, 0xe2d90000,
+        0xfb401044, 0xff7a0000, 0xfb841044, 0xe33e0000, 0xfb401044, 0xff950000, 0xfb401044, 0xfffa0000,
+        0xfb841044, 0xe4da0000, 0xfb841044, 0xe5230000, 0xfb411044, 0x80600000, 0xfb841044, 0xe5a80000,
+        0xfb411044, 0x80700000, 0xfb841044, 0xb35f0000, 0xfb801044, 0xc3d50000, 0xfb411044, 0x80b20000,
+        0xfb411044, 0x81030000, 0xfb801044, 0xc40b0000, 0xfb411044, 0x813e0000, 0xfb401044, 0xdab50000,
+        0xfb841044, 0xe7a70000, 0xfb841044, 0xe7b50000, 0xfb841044, 0xb3930000, 0xfb841044, 0xb39c0000,
+        0xfb411044, 0x82040000, 0xfb411044, 0x8f9e0000, 0xfb801044, 0xc46b0000, 0xfb411044, 0x82910000,
+        0xfb411044, 0x828b0000, 0xfb411044, 0x829d0000, 0xfb401044, 0xd2b30000, 0xfb411044, 0x82b10000,
+        0xfb411044, 0x82b30000, 0xfb411044, 0x82bd0000, 0xfb411044, 0x82e60000, 0xfb841044, 0xeb3c0000,
+        0xfb411044, 0x831d0000, 0xfb411044, 0x83630000, 0xfb411044, 0x83ad0000, 0xfb411044, 0x83230000,
+        0xfb411044, 0x83bd0000, 0xfb411044, 0x83e70000, 0xfb411044, 0x83530000, 0xfb411044, 0x83ca0000,
+        0xfb411044, 0x83cc0000, 0xfb411044, 0x83dc0000, 0xfb841044, 0xec360000, 0xfb841044, 0xed6b0000,
+        0xfb841044, 0xecd50000, 0xfb801044, 0xc52b0000, 0xfb411044, 0x84f10000, 0xfb411044, 0x84f30000,
+        0xfb411044, 0x85160000, 0xfb841044, 0xf3ca0000, 0xfb411044, 0x85640000, 0xfb841044, 0xef2c0000,
+        0xfb801044, 0xc55d0000, 0xfb801044, 0xc5610000, 0xfb841044, 0xefb10000, 0xfb841044, 0xf0d20000,
+        0xfb801044, 0xc56b0000, 0xfb411044, 0x86500000, 0xfb411044, 0x86670000, 0xfb411044, 0x86690000,
+        0xfb411044, 0x86a90000, 0xfb411044, 0x86880000, 0xfb411044, 0x870e0000, 0xfb411044, 0x86e20000,
+        0xfb411044, 0x87280000, 0xfb411044, 0x876b0000, 0xfb411044, 0x87860000, 0xfb801044, 0xc5d70000,
+        0xfb411044, 0x87e10000, 0xfb411044, 0x88010000, 0xfb801044, 0xc5f90000, 0xfb411044, 0x88600000,
+        0xfb411044, 0x88630000, 0xfb841044, 0xf6670000, 0xfb411044, 0x88d70000, 0xfb411044, 0x88de0000,
+        0xfb801044, 0xc6350000, 0xfb411044, 0x88fa0000, 0xfb801044, 0xb4bb0000, 0xfb841044, 0xf8ae0000,
+        0xfb841044, 0xf9660000, 0xfb801044, 0xc6be0000, 0xfb801044, 0xc6c70000, 0xfb411044, 0x8aa00000,
+        0xfb411044, 0x8c550000, 0xfb841044, 0xfca80000, 0xfb411044, 0x8cab0000, 0xfb411044, 0x8cc10000,
+        0xfb411044, 0x8d1b0000, 0xfb411044, 0x8d770000, 0xfb841044, 0xff2f0000, 0xfb841044, 0x88040000,
+        0xfb411044, 0x8dcb0000, 0xfb411044, 0x8dbc0000, 0xfb411044, 0x8df00000, 0xfb841044, 0x88de0000,
+        0xfb411044, 0x8ed40000, 0xfb851044, 0x85d20000, 0xfb851044, 0x85ed0000, 0xfb411044, 0x90940000,
+        0xfb411044, 0x90f10000, 0xfb411044, 0x91110000, 0xfb851044, 0x872e0000, 0xfb411044, 0x911b0000,
+        0xfb411044, 0x92380000, 0xfb411044, 0x92d70000, 0xfb411044, 0x92d80000, 0xfb411044, 0x927c0000,
+        0xfb411044, 0x93f90000, 0xfb411044, 0x94150000, 0xfb851044, 0x8bfa0000, 0xfb411044, 0x958b0000,
+        0xfb801044, 0xc9950000, 0xfb411044, 0x95b70000, 0xfb851044, 0x8d770000, 0xfb801044, 0xc9e60000,
+        0xfb411044, 0x96c30000, 0xfb401044, 0xddb20000, 0xfb411044, 0x97230000, 0xfb851044, 0x91450000,
+        0xfb851044, 0x921a0000, 0xfb801044, 0xca6e0000, 0xfb801044, 0xca760000, 0xfb411044, 0x97e00000,
+        0xfb851044, 0x940a0000, 0xfb801044, 0xcab20000, 0xfb851044, 0x94960000, 0xfb411044, 0x98290000,
+        0xfb851044, 0x95b60000, 0xfb411044, 0x98e20000, 0xfb801044, 0xcb330000, 0xfb411044, 0x99290000,
+        0xfb411044, 0x99a70000, 0xfb411044, 0x99c20000, 0xfb411044, 0x99fe0000, 0xfb801044, 0xcbce0000,
+        0xfb851044, 0x9b300000, 0xfb411044, 0x9c400000, 0xfb411044, 0x9cfd0000, 0xfb801044, 0xccce0000,
+        0xfb801044, 0xcced0000, 0xfb411044, 0x9d670000, 0xfb851044, 0xa0ce0000, 0xfb801044, 0xccf80000,
+        0xfb851044, 0xa1050000, 0xfb851044, 0xa20e0000, 0xfb851044, 0xa2910000, 0xfb411044, 0x9ebb0000,
+        0xfb801044, 0xcd560000, 0xfb411044, 0x9ef90000, 0xfb411044, 0x9efe0000, 0xfb411044, 0x9f050000,
+        0xfb411044, 0x9f0f0000, 0xfb411044, 0x9f160000, 0xfb411044, 0x9f3b0000, 0xfb851044, 0xa6000000,
+        0x2c001004, 0x2c991004, 0x32171044, 0x32511004, 0x32181044, 0x32511004, 0x32191044, 0x32511004,
+        0x321a1044, 0x32511004, 0x321b1044, 0x32511004, 0x321c1044, 0x32511004, 0x321d1044, 0x32511004,
+        0x321e1044, 0x32511004, 0x321f1044, 0x32511004, 0x32201044, 0x32511004, 0x32211044, 0x32511004,
+        0x32221044, 0x32511004, 0x32231044, 0x32511004, 0x32241044, 0x32511004, 0x32251044, 0x32511004,
+        0x32261044, 0x32511004, 0x32271044, 0x32511004, 0x32281044, 0x32511004, 0x32291044, 0x32511004,
+        0x322a1044, 0x32511004, 0x322b1044, 0x32511004, 0x322c1044, 0x32511004, 0x322d1044, 0x32511004,
+        0x322e1044, 0x32511004, 0x322f1044, 0x32511004, 0x32301044, 0x32511004, 0x32311044, 0x32511004,
+        0x32321044, 0x32511004, 0x32331044, 0x32511004, 0x32341044, 0x32511004, 0x32351044, 0x32511004,
+        0x32361044, 0x32511004, 0x32371044, 0x32511004, 0x32381044, 0x32511004, 0x32391044, 0x32511004,
+        0x323a1044, 0x32511004, 0x323b1044, 0x32511004, 0x323c1044, 0x32511004, 0x323d1044, 0x32511004,
+        0x323e1044, 0x32511004, 0x323f1044, 0x32511004, 0x32401044, 0x32511004, 0x32411044, 0x32511004,
+        0x32421044, 0x32511004, 0x32431044, 0x32511004, 0x32441044, 0x32511004, 0x32171044, 0x32521004,
+        0x32181044, 0x32521004, 0x32191044, 0x32521004, 0x321a1044, 0x32521004, 0x321b1044, 0x32521004,
+        0x321c1044, 0x32521004, 0x321d1044, 0x32521004, 0x321e1044, 0x32521004, 0x321f1044, 0x32521004,
+        0x32201044, 0x32521004, 0x32211044, 0x32521004, 0x32221044, 0x32521004, 0x32231044, 0x32521004,
+        0x32241044, 0x32521004, 0x32251044, 0x32521004, 0x32261044, 0x32521004, 0x32271044, 0x32521004,
+        0x32281044, 0x32521004, 0x32291044, 0x32521004, 0x322a1044, 0x32521004, 0x322b1044, 0x32521004,
+        0x322c1044, 0x32521004, 0x322d1044, 0x32521004, 0x322e1044, 0x32521004, 0x322f1044, 0x32521004,
+        0x32301044, 0x32521004, 0x32311044, 0x32521004, 0x32321044, 0x32521004, 0x32331044, 0x32521004,
+        0x32341044, 0x32521004, 0x32351044, 0x32521004, 0x32361044, 0x32521004, 0x32371044, 0x32521004,
+        0x32381044, 0x32521004, 0x32391044, 0x32521004, 0x323a1044, 0x32521004, 0x323b1044, 0x32521004,
+        0x323c1044, 0x32521004, 0x323d1044, 0x32521004, 0x323e1044, 0x32521004, 0x323f1044, 0x32521004,
+        0x32401044, 0x32521004, 0x32411044, 0x32521004, 0x32421044, 0x32521004, 0x32431044, 0x32521004,
+        0x32441044, 0x32521004, 0x32171044, 0x32531004, 0x32181044, 0x32531004, 0x32191044, 0x32531004,
+        0x321a1044, 0x32531004, 0x321b1044, 0x32531004, 0x321c1044, 0x32531004, 0x321d1044, 0x32531004,
+        0x321e1044, 0x32531004, 0x321f1044, 0x32531004, 0x32201044, 0x32531004, 0x32211044, 0x32531004,
+        0x32221044, 0x32531004, 0x32231044, 0x32531004, 0x32241044, 0x32531004, 0x32251044, 0x32531004,
+        0x32261044, 0x32531004, 0x32271044, 0x32531004, 0x32281044, 0x32531004, 0x32291044, 0x32531004,
+        0x322a1044, 0x32531004, 0x322b1044, 0x32531004, 0x322c1044, 0x32531004, 0x322d1044, 0x32531004,
+        0x322e1044, 0x32531004, 0x322f1044, 0x32531004, 0x32301044, 0x32531004, 0x32311044, 0x32531004,
+        0x32321044, 0x32531004, 0x32331044, 0x32531004, 0x32341044, 0x32531004, 0x32351044, 0x32531004,
+        0x32361044, 0x32531004, 0x32371044, 0x32531004, 0x32381044, 0x32531004, 0x32391044, 0x32531004,
+        0x323a1044, 0x32531004, 0x323b1044, 0x32531004, 0x323c1044, 0x32531004, 0x323d1044, 0x32531004,
+        0x323e1044, 0x32531004, 0x323f1044, 0x32531004, 0x32401044, 0x32531004, 0x32411044, 0x32531004,
+        0x32421044, 0x32531004, 0x32431044, 0x32531004, 0x32441044, 0x32531004, 0x32171044, 0x32541004,
+        0x32181044, 0x32541004, 0x32191044, 0x32541004, 0x321a1044, 0x32541004, 0x321b1044, 0x32541004,
+        0x321c1044, 0x32541004, 0x321d1044, 0x32541004, 0x321e1044, 0x32541004, 0x321f1044, 0x32541004,
+        0x32201044, 0x32541004, 0x32211044, 0x32541004, 0x32221044, 0x32541004, 0x32231044, 0x32541004,
+        0x32241044, 0x32541004, 0x32251044, 0x32541004, 0x32261044, 0x32541004, 0x32271044, 0x32541004,
+        0x32281044, 0x32541004, 0x32291044, 0x32541004, 0x322a1044, 0x32541004, 0x322b1044, 0x32541004,
+        0x322c1044, 0x32541004, 0x322d1044, 0x32541004, 0x322e1044, 0x32541004, 0x322f1044, 0x32541004,
+        0x32301044, 0x32541004, 0x32311044, 0x32541004, 0x32321044, 0x32541004, 0x32331044, 0x32541004,
+        0x32341044, 0x32541004, 0x32351044, 0x32541004, 0x32361044, 0x32541004, 0x32371044, 0x32541004,
+        0x32381044, 0x32541004, 0x32391044, 0x32541004, 0x323a1044, 0x32541004, 0x323b1044, 0x32541004,
+        0x323c1044, 0x32541004, 0x323d1044, 0x32541004, 0x323e1044, 0x32541004, 0x323f1044, 0x32541004,
+        0x32401044, 0x32541004, 0x32411044, 0x32541004, 0x32421044, 0x32541004, 0x32431044, 0x32541004,
+        0x32441044, 0x32541004, 0x32171044, 0x32551004, 0x32181044, 0x32551004, 0x32191044, 0x32551004,
+        0x321a1044, 0x32551004, 0x321b1044, 0x32551004, 0x321c1044, 0x32551004, 0x321d1044, 0x32551004,
+        0x321e1044, 0x32551004, 0x321f1044, 0x32551004, 0x32201044, 0x32551004, 0x32211044, 0x32551004,
+        0x32221044, 0x32551004, 0x32231044, 0x32551004, 0x32241044, 0x32551004, 0x32251044, 0x32551004,
+        0x32261044, 0x32551004, 0x32271044, 0x32551004, 0x32281044, 0x32551004, 0x32291044, 0x32551004,
+        0x322a1044, 0x32551004, 0x322b1044, 0x32551004, 0x322c1044, 0x32551004, 0x322d1044, 0x32551004,
+        0x322e1044, 0x32551004, 0x322f1044, 0x32551004, 0x32301044, 0x32551004, 0x32311044, 0x32551004,
+        0x32321044, 0x32551004, 0x32331044, 0x32551004, 0x32341044, 0x32551004, 0x32351044, 0x32551004,
+        0x32361044, 0x32551004, 0x32371044, 0x32551004, 0x32381044, 0x32551004, 0x32391044, 0x32551004,
+        0x323a1044, 0x32551004, 0x323b1044, 0x32551004, 0x323c1044, 0x32551004, 0x323d1044, 0x32551004,
+        0x323e1044, 0x32551004, 0x323f1044, 0x32551004, 0x32401044, 0x32551004, 0x32411044, 0x32551004,
+        0x32421044, 0x32551004, 0x32431044, 0x32551004, 0x32441044, 0x32551004, 0x32581044, 0x32911004,
+        0x32591044, 0x32911004, 0x325a1044, 0x32911004, 0x325b1044, 0x32911004, 0x325c1044, 0x32911004,
+        0x325d1044, 0x32911004, 0x325e1044, 0x32911004, 0x32601044, 0x32911004, 0x32611044, 0x32911004,
+        0x32641044, 0x32911004, 0x32621044, 0x32911004, 0x32651044, 0x32911004, 0x32661044, 0x32911004,
+        0x32671044, 0x32911004, 0x32681044, 0x32911004, 0x32691044, 0x32911004, 0x326a1044, 0x32911004,
+        0x326b1044, 0x32911004, 0x326c1044, 0x32911004, 0x326d1044, 0x32911004, 0x326e1044, 0x32911004,
+        0x326f1044, 0x32911004, 0x32701044, 0x32911004, 0x32711044, 0x32911004, 0x32721044, 0x32911004,
+        0x32731044, 0x32911004, 0x32741044, 0x32911004, 0x32751044, 0x32911004, 0x32761044, 0x32911004,
+        0x32771044, 0x32911004, 0x32781044, 0x32911004, 0x32791044, 0x32911004, 0x327a1044, 0x32911004,
+        0x327b1044, 0x32911004, 0x327c1044, 0x32911004, 0x327d1044, 0x32911004, 0x325f1044, 0x32911004,
+        0x327e1044, 0x32911004, 0x327f1044, 0x32911004, 0x32801044, 0x32911004, 0x32811044, 0x32911004,
+        0x327e1048, 0x326f1048, 0x32911004, 0x327e1048, 0x32771048, 0x32911004, 0x32571044, 0x32911004,
+        0x32631044, 0x32911004, 0x32581044, 0x32921004, 0x32591044, 0x32921004, 0x325a1044, 0x32921004,
+        0x325b1044, 0x32921004, 0x325c1044, 0x32921004, 0x325d1044, 0x32921004, 0x325e1044, 0x32921004,
+        0x32601044, 0x32921004, 0x32611044, 0x32921004, 0x32641044, 0x32921004, 0x32621044, 0x32921004,
+        0x32651044, 0x32921004, 0x32661044, 0x32921004, 0x32671044, 0x32921004, 0x32681044, 0x32921004,
+        0x32691044, 0x32921004, 0x326a1044, 0x32921004, 0x326b1044, 0x32921004, 0x326c1044, 0x32921004,
+        0x326d1044, 0x32921004, 0x326e1044, 0x32921004, 0x326f1044, 0x32921004, 0x32701044, 0x32921004,
+        0x32711044, 0x32921004, 0x32721044, 0x32921004, 0x32731044, 0x32921004, 0x32741044, 0x32921004,
+        0x32751044, 0x32921004, 0x32761044, 0x32921004, 0x32771044, 0x32921004, 0x32781044, 0x32921004,
+        0x32791044, 0x32921004, 0x327a1044, 0x32921004, 0x327b1044, 0x32921004, 0x327c1044, 0x32921004,
+        0x327d1044, 0x32921004, 0x325f1044, 0x32921004, 0x327e1044, 0x32921004, 0x327f1044, 0x32921004,
+        0x32801044, 0x32921004, 0x32811044, 0x32921004, 0x327e1048, 0x326f1048, 0x32921004, 0x327e1048,
+        0x32771048, 0x32921004, 0x32571044, 0x32921004, 0x32631044, 0x32921004, 0x32581044, 0x32931004,
+        0x32591044, 0x32931004, 0x325a1044, 0x32931004, 0x325b1044, 0x32931004, 0x325c1044, 0x32931004,
+        0x325d1044, 0x32931004, 0x325e1044, 0x32931004, 0x32601044, 0x32931004, 0x32611044, 0x32931004,
+        0x32641044, 0x32931004, 0x32621044, 0x32931004, 0x32651044, 0x32931004, 0x32661044, 0x32931004,
+        0x32671044, 0x32931004, 0x32681044, 0x32931004, 0x32691044, 0x32931004, 0x326a1044, 0x32931004,
+        0x326b1044, 0x32931004, 0x326c1044, 0x32931004, 0x326d1044, 0x32931004, 0x326e1044, 0x32931004,
+        0x326f1044, 0x32931004, 0x32701044, 0x32931004, 0x32711044, 0x32931004, 0x32721044, 0x32931004,
+        0x32731044, 0x32931004, 0x32741044, 0x32931004, 0x32751044, 0x32931004, 0x32761044, 0x32931004,
+        0x32771044, 0x32931004, 0x32781044, 0x32931004, 0x32791044, 0x32931004, 0x327a1044, 0x32931004,
+        0x327b1044, 0x32931004, 0x327c1044, 0x32931004, 0x327d1044, 0x32931004, 0x325f1044, 0x32931004,
+        0x327e1044, 0x32931004, 0x327f1044, 0x32931004, 0x32801044, 0x32931004, 0x32811044, 0x32931004,
+        0x327e1048, 0x326f1048, 0x32931004, 0x327e1048, 0x32771048, 0x32931004, 0x32571044, 0x32931004,
+        0x32631044, 0x32931004, 0x32581044, 0x32941004, 0x32591044, 0x32941004, 0x325a1044, 0x32941004,
+        0x325b1044, 0x32941004, 0x325c1044, 0x32941004, 0x325d1044, 0x32941004, 0x325e1044, 0x32941004,
+        0x32601044, 0x32941004, 0x32611044, 0x32941004, 0x32641044, 0x32941004, 0x32621044, 0x32941004,
+        0x32651044, 0x32941004, 0x32661044, 0x32941004, 0x32671044, 0x32941004, 0x32681044, 0x32941004,
+        0x32691044, 0x32941004, 0x326a1044, 0x32941004, 0x326b1044, 0x32941004, 0x326c1044, 0x32941004,
+        0x326d1044, 0x32941004, 0x326e1044, 0x32941004, 0x326f1044, 0x32941004, 0x32701044, 0x32941004,
+        0x32711044, 0x32941004, 0x32721044, 0x32941004, 0x32731044, 0x32941004, 0x32741044, 0x32941004,
+        0x32751044, 0x32941004, 0x32761044, 0x32941004, 0x32771044, 0x32941004, 0x32781044, 0x32941004,
+        0x32791044, 0x32941004, 0x327a1044, 0x32941004, 0x327b1044, 0x32941004, 0x327c1044, 0x32941004,
+        0x327d1044, 0x32941004, 0x325f1044, 0x32941004, 0x327e1044, 0x32941004, 0x327f1044, 0x32941004,
+        0x32801044, 0x32941004, 0x32811044, 0x32941004, 0x327e1048, 0x326f1048, 0x32941004, 0x327e1048,
+        0x32771048, 0x32941004, 0x32571044, 0x32941004, 0x32631044, 0x32941004, 0x32581044, 0x32951004,
+        0x32591044, 0x32951004, 0x325a1044, 0x32951004, 0x325b1044, 0x32951004, 0x325c1044, 0x32951004,
+        0x325d1044, 0x32951004, 0x325e1044, 0x32951004, 0x32601044, 0x32951004, 0x32611044, 0x32951004,
+        0x32641044, 0x32951004, 0x32621044, 0x32951004, 0x32651044, 0x32951004, 0x32661044, 0x32951004,
+        0x32671044, 0x32951004, 0x32681044, 0x32951004, 0x32691044, 0x32951004, 0x326a1044, 0x32951004,
+        0x326b1044, 0x32951004, 0x326c1044, 0x32951004, 0x326d1044, 0x32951004, 0x326e1044, 0x32951004,
+        0x326f1044, 0x32951004, 0x32701044, 0x32951004, 0x32711044, 0x32951004, 0x32721044, 0x32951004,
+        0x32731044, 0x32951004, 0x32741044, 0x32951004, 0x32751044, 0x32951004, 0x32761044, 0x32951004,
+        0x32771044, 0x32951004, 0x32781044, 0x32951004, 0x32791044, 0x32951004, 0x327a1044, 0x32951004,
+        0x327b1044, 0x32951004, 0x327c1044, 0x32951004, 0x327d1044, 0x32951004, 0x325f1044, 0x32951004,
+        0x327e1044, 0x32951004, 0x327f1044, 0x32951004, 0x32801044, 0x32951004, 0x32811044, 0x32951004,
+        0x327e1048, 0x326f1048, 0x32951004, 0x327e1048, 0x32771048, 0x32951004, 0x32571044, 0x32951004,
+        0x32631044, 0x32951004, 0x36de1044, 0x370f1004, 0x36df1044, 0x370f1004, 0x36e01044, 0x370f1004,
+        0x36e11044, 0x370f1004, 0x36e21044, 0x370f1004, 0x36e31044, 0x370f1004, 0x36e41044, 0x370f1004,
+        0x36e51044, 0x370f1004, 0x36e61044, 0x370f1004, 0x36e71044, 0x370f1004, 0x36e81044, 0x370f1004,
+        0x36e91044, 0x370f1004, 0x36ea1044, 0x370f1004, 0x36eb1044, 0x370f1004, 0x36ec1044, 0x370f1004,
+        0x36ed1044, 0x370f1004, 0x36ee1044, 0x370f1004, 0x36ef1044, 0x370f1004, 0x36f01044, 0x370f1004,
+        0x36f11044, 0x370f1004, 0x36f21044, 0x370f1004, 0x36f31044, 0x370f1004, 0x36f41044, 0x370f1004,
+        0x36f51044, 0x370f1004, 0x36f61044, 0x370f1004, 0x36f71044, 0x370f1004, 0x36f81044, 0x370f1004,
+        0x36f91044, 0x370f1004, 0x36fa1044, 0x370f1004, 0x36fb1044, 0x370f1004, 0x36fc1044, 0x370f1004,
+        0x36fd1044, 0x370f1004, 0x36fe1044, 0x370f1004, 0x36ff1044, 0x370f1004, 0x37001044, 0x370f1004,
+        0x37011044, 0x370f1004, 0x37021044, 0x370f1004, 0x37031044, 0x370f1004, 0x37041044, 0x370f1004,
+        0x37051044, 0x370f1004, 0x37061044, 0x370f1004, 0x37071044, 0x370f1004, 0x37081044, 0x370f1004,
+        0x37091044, 0x370f1004, 0x36de1044, 0x37101004, 0x36df1044, 0x37101004, 0x36e01044, 0x37101004,
+        0x36e11044, 0x37101004, 0x36e21044, 0x37101004, 0x36e31044, 0x37101004, 0x36e41044, 0x37101004,
+        0x36e51044, 0x37101004, 0x36e61044, 0x37101004, 0x36e71044, 0x37101004, 0x36e81044, 0x37101004,
+        0x36e91044, 0x37101004, 0x36ea1044, 0x37101004, 0x36eb1044, 0x37101004, 0x36ec1044, 0x37101004,
+        0x36ed1044, 0x37101004, 0x36ee1044, 0x37101004, 0x36ef1044, 0x37101004, 0x36f01044, 0x37101004,
+        0x36f11044, 0x37101004, 0x36f21044, 0x37101004, 0x36f31044, 0x37101004, 0x36f41044, 0x37101004,
+        0x36f51044, 0x37101004, 0x36f61044, 0x37101004, 0x36f71044, 0x37101004, 0x36f81044, 0x37101004,
+        0x36f91044, 0x37101004, 0x36fa1044, 0x37101004, 0x36fb1044, 0x37101004, 0x36fc1044, 0x37101004,
+        0x36fd1044, 0x37101004, 0x36fe1044, 0x37101004, 0x36ff1044, 0x37101004, 0x37001044, 0x37101004,
+        0x37011044, 0x37101004, 0x37021044, 0x37101004, 0x37031044, 0x37101004, 0x37041044, 0x37101004,
+        0x37051044, 0x37101004, 0x37061044, 0x37101004, 0x37071044, 0x37101004, 0x37081044, 0x37101004,
+        0x37091044, 0x37101004, 0x36de1044, 0x37111004, 0x36df1044, 0x37111004, 0x36e01044, 0x37111004,
+        0x36e11044, 0x37111004, 0x36e21044, 0x37111004, 0x36e31044, 0x37111004, 0x36e41044, 0x37111004,
+        0x36e51044, 0x37111004, 0x36e61044, 0x37111004, 0x36e71044, 0x37111004, 0x36e81044, 0x37111004,
+        0x36e91044, 0x37111004, 0x36ea1044, 0x37111004, 0x36eb1044, 0x37111004, 0x36ec1044, 0x37111004,
+        0x36ed1044, 0x37111004, 0x36ee1044, 0x37111004, 0x36ef1044, 0x37111004, 0x36f01044, 0x37111004,
+        0x36f11044, 0x37111004, 0x36f21044, 0x37111004, 0x36f31044, 0x37111004, 0x36f41044, 0x37111004,
+        0x36f51044, 0x37111004, 0x36f61044, 0x37111004, 0x36f71044, 0x37111004, 0x36f81044, 0x37111004,
+        0x36f91044, 0x37111004, 0x36fa1044, 0x37111004, 0x36fb1044, 0x37111004, 0x36fc1044, 0x37111004,
+        0x36fd1044, 0x37111004, 0x36fe1044, 0x37111004, 0x36ff1044, 0x37111004, 0x37001044, 0x37111004,
+        0x37011044, 0x37111004, 0x37021044, 0x37111004, 0x37031044, 0x37111004, 0x37041044, 0x37111004,
+        0x37051044, 0x37111004, 0x37061044, 0x37111004, 0x37071044, 0x37111004, 0x37081044, 0x37111004,
+        0x37091044, 0x37111004, 0x36de1044, 0x37141004, 0x36df1044, 0x37141004, 0x36e01044, 0x37141004,
+        0x36e11044, 0x37141004, 0x36e21044, 0x37141004, 0x36e31044, 0x37141004, 0x36e41044, 0x37141004,
+        0x36e51044, 0x37141004, 0x36e61044, 0x37141004, 0x36e71044, 0x37141004, 0x36e81044, 0x37141004,
+        0x36e91044, 0x37141004, 0x36ea1044, 0x37141004, 0x36eb1044, 0x37141004, 0x36ec1044, 0x37141004,
+        0x36ed1044, 0x37141004, 0x36ee1044, 0x37141004, 0x36ef1044, 0x37141004, 0x36f01044, 0x37141004,
+        0x36f11044, 0x37141004, 0x36f21044, 0x37141004, 0x36f31044, 0x37141004, 0x36f41044, 0x37141004,
+        0x36f51044, 0x37141004, 0x36f61044, 0x37141004, 0x36f71044, 0x37141004, 0x36f81044, 0x37141004,
+        0x36f91044, 0x37141004, 0x36fa1044, 0x37141004, 0x36fb1044, 0x37141004, 0x36fc1044, 0x37141004,
+        0x36fd1044, 0x37141004, 0x36fe1044, 0x37141004, 0x36ff1044, 0x37141004, 0x37001044, 0x37141004,
+        0x37011044, 0x37141004, 0x37021044, 0x37141004, 0x37031044, 0x37141004, 0x37041044, 0x37141004,
+        0x37051044, 0x37141004, 0x37061044, 0x37141004, 0x37071044, 0x37141004, 0x37081044, 0x37141004,
+        0x37091044, 0x37141004, 0x32961044, 0x32cb1004, 0x32971044, 0x32cb1004, 0x32981044, 0x32cb1004,
+        0x32991044, 0x32cb1004, 0x329a1044, 0x32cb1004, 0x329b1044, 0x32cb1004, 0x329c1044, 0x32cb1004,
+        0x329d1044, 0x32cb1004, 0x329e1044, 0x32cb1004, 0x329f1044, 0x32cb1004, 0x32a01044, 0x32cb1004,
+        0x32a11044, 0x32cb1004, 0x32a21044, 0x32cb1004, 0x32a31044, 0x32cb1004, 0x32a41044, 0x32cb1004,
+        0x32a51044, 0x32cb1004, 0x32a61044, 0x32cb1004, 0x32a71044, 0x32cb1004, 0x32a81044, 0x32cb1004,
+        0x32a91044, 0x32cb1004, 0x32aa1044, 0x32cb1004, 0x32ab1044, 0x32cb1004, 0x32ac1044, 0x32cb1004,
+        0x32ad1044, 0x32cb1004, 0x32ae1044, 0x32cb1004, 0x32af1044, 0x32cb1004, 0x32b01044, 0x32cb1004,
+        0x32b11044, 0x32cb1004, 0x32b21044, 0x32cb1004, 0x32b31044, 0x32cb1004, 0x32b41044, 0x32cb1004,
+        0x32b51044, 0x32cb1004, 0x32b61044, 0x32cb1004, 0x32b71044, 0x32cb1004, 0x32b81044, 0x32cb1004,
+        0x32b91044, 0x32cb1004, 0x32ba1044, 0x32cb1004, 0x32bb1044, 0x32cb1004, 0x32bc1044, 0x32cb1004,
+        0x32bd1044, 0x32cb1004, 0x32be1044, 0x32cb1004, 0x32bf1044, 0x32cb1004, 0x32c01044, 0x32cb1004,
+        0x32c11044, 0x32cb1004, 0x32c21044, 0x32cb1004, 0x32c31044, 0x32cb1004, 0x32c41044, 0x32cb1004,
+        0x32c51044, 0x32cb1004, 0x32961044, 0x32cc1004, 0x32971044, 0x32cc1004, 0x32981044, 0x32cc1004,
+        0x32991044, 0x32cc1004, 0x329a1044, 0x32cc1004, 0x329b1044, 0x32cc1004, 0x329c1044, 0x32cc1004,
+        0x329d1044, 0x32cc1004, 0x329e1044, 0x32cc1004, 0x329f1044, 0x32cc1004, 0x32a01044, 0x32cc1004,
+        0x32a11044, 0x32cc1004, 0x32a21044, 0x32cc1004, 0x32a31044, 0x32cc1004, 0x32a41044, 0x32cc1004,
+        0x32a51044, 0x32cc1004, 0x32a61044, 0x32cc1004, 0x32a71044, 0x32cc1004, 0x32a81044, 0x32cc1004,
+        0x32a91044, 0x32cc1004, 0x32aa1044, 0x32cc1004, 0x32ab1044, 0x32cc1004, 0x32ac1044, 0x32cc1004,
+        0x32ad1044, 0x32cc1004, 0x32ae1044, 0x32cc1004, 0x32af1044, 0x32cc1004, 0x32b01044, 0x32cc1004,
+        0x32b11044, 0x32cc1004, 0x32b21044, 0x32cc1004, 0x32b31044, 0x32cc1004, 0x32b41044, 0x32cc1004,
+        0x32b51044, 0x32cc1004, 0x32b61044, 0x32cc1004, 0x32b71044, 0x32cc1004, 0x32b81044, 0x32cc1004,
+        0x32b91044, 0x32cc1004, 0x32ba1044, 0x32cc1004, 0x32bb1044, 0x32cc1004, 0x32bc1044, 0x32cc1004,
+        0x32bd1044, 0x32cc1004, 0x32be1044, 0x32cc1004, 0x32bf1044, 0x32cc1004, 0x32c01044, 0x32cc1004,
+        0x32c11044, 0x32cc1004, 0x32c21044, 0x32cc1004, 0x32c31044, 0x32cc1004, 0x32c41044, 0x32cc1004,
+        0x32c51044, 0x32cc1004, 0x32961044, 0x32cf1004, 0x32971044, 0x32cf1004, 0x32981044, 0x32cf1004,
+        0x32991044, 0x32cf1004, 0x329a1044, 0x32cf1004, 0x329b1044, 0x32cf1004, 0x329c1044, 0x32cf1004,
+        0x329d1044, 0x32cf1004, 0x329e1044, 0x32cf1004, 0x329f1044, 0x32cf1004, 0x32a01044, 0x32cf1004,
+        0x32a11044, 0x32cf1004, 0x32a21044, 0x32cf1004, 0x32a31044, 0x32cf1004, 0x32a41044, 0x32cf1004,
+        0x32a51044, 0x32cf1004, 0x32a61044, 0x32cf1004, 0x32a71044, 0x32cf1004, 0x32a81044, 0x32cf1004,
+        0x32a91044, 0x32cf1004, 0x32aa1044, 0x32cf1004, 0x32ab1044, 0x32cf1004, 0x32ac1044, 0x32cf1004,
+        0x32ad1044, 0x32cf1004, 0x32ae1044, 0x32cf1004, 0x32af1044, 0x32cf1004, 0x32b01044, 0x32cf1004,
+        0x32b11044, 0x32cf1004, 0x32b21044, 0x32cf1004, 0x32b31044, 0x32cf1004, 0x32b41044, 0x32cf1004,
+        0x32b51044, 0x32cf1004, 0x32b61044, 0x32cf1004, 0x32b71044, 0x32cf1004, 0x32b81044, 0x32cf1004,
+        0x32b91044, 0x32cf1004, 0x32ba1044, 0x32cf1004, 0x32bb1044, 0x32cf1004, 0x32bc1044, 0x32cf1004,
+        0x32bd1044, 0x32cf1004, 0x32be1044, 0x32cf1004, 0x32bf1044, 0x32cf1004, 0x32c01044, 0x32cf1004,
+        0x32c11044, 0x32cf1004, 0x32c21044, 0x32cf1004, 0x32c31044, 0x32cf1004, 0x32c41044, 0x32cf1004,
+        0x32c51044, 0x32cf1004, 0x32961044, 0x32d11004, 0x32971044, 0x32d11004, 0x32981044, 0x32d11004,
+        0x32991044, 0x32d11004, 0x329a1044, 0x32d11004, 0x329b1044, 0x32d11004, 0x329c1044, 0x32d11004,
+        0x329d1044, 0x32d11004, 0x329e1044, 0x32d11004, 0x329f1044, 0x32d11004, 0x32a01044, 0x32d11004,
+        0x32a11044, 0x32d11004, 0x32a21044, 0x32d11004, 0x32a31044, 0x32d11004, 0x32a41044, 0x32d11004,
+        0x32a51044, 0x32d11004, 0x32a61044, 0x32d11004, 0x32a71044, 0x32d11004, 0x32a81044, 0x32d11004,
+        0x32a91044, 0x32d11004, 0x32aa1044, 0x32d11004, 0x32ab1044, 0x32d11004, 0x32ac1044, 0x32d11004,
+        0x32ad1044, 0x32d11004, 0x32ae1044, 0x32d11004, 0x32af1044, 0x32d11004, 0x32b01044, 0x32d11004,
+        0x32b11044, 0x32d11004, 0x32b21044, 0x32d11004, 0x32b31044, 0x32d11004, 0x32b41044, 0x32d11004,
+        0x32b51044, 0x32d11004, 0x32b61044, 0x32d11004, 0x32b71044, 0x32d11004, 0x32b81044, 0x32d11004,
+        0x32b91044, 0x32d11004, 0x32ba1044, 0x32d11004, 0x32bb1044, 0x32d11004, 0x32bc1044, 0x32d11004,
+        0x32bd1044, 0x32d11004, 0x32be1044, 0x32d11004, 0x32bf1044, 0x32d11004, 0x32c01044, 0x32d11004,
+        0x32c11044, 0x32d11004, 0x32c21044, 0x32d11004, 0x32c31044, 0x32d11004, 0x32c41044, 0x32d11004,
+        0x32c51044, 0x32d11004, 0x32961044, 0x32d21004, 0x32971044, 0x32d21004, 0x32981044, 0x32d21004,
+        0x32991044, 0x32d21004, 0x329a1044, 0x32d21004, 0x329b1044, 0x32d21004, 0x329c1044, 0x32d21004,
+        0x329d1044, 0x32d21004, 0x329e1044, 0x32d21004, 0x329f1044, 0x32d21004, 0x32a01044, 0x32d21004,
+        0x32a11044, 0x32d21004, 0x32a21044, 0x32d21004, 0x32a31044, 0x32d21004, 0x32a41044, 0x32d21004,
+        0x32a51044, 0x32d21004, 0x32a61044, 0x32d21004, 0x32a71044, 0x32d21004, 0x32a81044, 0x32d21004,
+        0x32a91044, 0x32d21004, 0x32aa1044, 0x32d21004, 0x32ab1044, 0x32d21004, 0x32ac1044, 0x32d21004,
+        0x32ad1044, 0x32d21004, 0x32ae1044, 0x32d21004, 0x32af1044, 0x32d21004, 0x32b01044, 0x32d21004,
+        0x32b11044, 0x32d21004, 0x32b21044, 0x32d21004, 0x32b31044, 0x32d21004, 0x32b41044, 0x32d21004,
+        0x32b51044, 0x32d21004, 0x32b61044, 0x32d21004, 0x32b71044, 0x32d21004, 0x32b81044, 0x32d21004,
+        0x32b91044, 0x32d21004, 0x32ba1044, 0x32d21004, 0x32bb1044, 0x32d21004, 0x32bc1044, 0x32d21004,
+        0x32bd1044, 0x32d21004, 0x32be1044, 0x32d21004, 0x32bf1044, 0x32d21004, 0x32c01044, 0x32d21004,
+        0x32c11044, 0x32d21004, 0x32c21044, 0x32d21004, 0x32c31044, 0x32d21004, 0x32c41044, 0x32d21004,
+        0x32c51044, 0x32d21004,
+};
+
+/// 一级表，按 cp >> 10 索引
+static const uint8_t CollationStage1[1088] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 13, 13,
+        13, 13, 13, 14, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 15, 16, 17, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 18, 13, 13, 13, 13, 13, 13, 13, 13, 19, 20,
+        21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 13, 13, 31, 32, 13, 13,
+        13, 33, 13, 13, 13, 13, 13, 13, 13, 13, 34, 35, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 36, 13, 13, 37,
+        13, 13, 13, 13, 38, 39, 40, 13, 41, 13, 42, 43, 44, 45, 46, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 47, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        48, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+};
+
+/// 二级表，每块 64 项，按 (cp >> 4) & 63 索引
+static const uint16_t CollationStage2[3136] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 1, 9, 10, 11, 12, 13, 14,
+        15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+        31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46,
+        47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62,
+        63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78,
+        79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 1, 89, 90, 91, 92, 93,
+        94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
+        110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125,
+        126, 127, 128, 129, 130, 131, 132, 133, 133, 133, 134, 135, 136, 137, 138, 139,
+        140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155,
+        156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171,
+        172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 162, 186,
+        187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202,
+        203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 162, 217,
+        218, 219, 220, 221, 222, 223, 133, 133, 224, 225, 226, 227, 228, 229, 133, 133,
+        230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 133, 133,
+        244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259,
+        260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275,
+        276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291,
+        292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307,
+        308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 320, 321, 322, 323,
+        324, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339,
+        340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355,
+        356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 370,
+        371, 370, 372, 373, 374, 375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385,
+        386, 387, 388, 389, 390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401,
+        402, 403, 404, 405, 406, 407, 408, 409, 370, 370, 410, 411, 412, 133, 133, 133,
+        413, 414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 427, 428,
+        429, 430, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 1, 442, 443,
+        444, 445, 446, 447, 448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459,
+        460, 461, 462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475,
+        476, 477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 488, 489, 490, 491,
+        492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 133, 504, 505, 506,
+        507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520, 521, 522,
+        523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535, 536, 537, 538,
+        539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 552, 553, 554,
+        555, 556, 557, 133, 558, 133, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568,
+        569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584,
+        585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 599, 600,
+        601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616,
+        617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629, 630, 631, 632,
+        633, 634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647, 648,
+        649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659, 660, 661, 662, 663, 664,
+        665, 666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680,
+        681, 682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695, 696,
+        697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711, 712,
+        713, 714, 715, 716, 717, 718, 133, 133, 719, 720, 721, 722, 723, 724, 725, 726,
+        727, 728, 729, 730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 740, 133, 741,
+        742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753, 754, 755, 756, 757,
+        758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769, 770, 771, 772, 773,
+        774, 775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785, 786, 787, 788, 789,
+        790, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 806, 807, 808, 809,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825,
+        826, 827, 828, 829, 830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841,
+        842, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855, 856, 857,
+        858, 859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 871, 872, 873,
+        874, 875, 876, 877, 878, 879, 880, 881, 882, 883, 884, 885, 886, 887, 888, 889,
+        890, 891, 892, 893, 894, 895, 896, 897, 898, 899, 900, 901, 902, 903, 904, 905,
+        906, 907, 908, 133, 909, 910, 911, 912, 913, 914, 915, 916, 917, 918, 919, 920,
+        921, 922, 923, 924, 925, 926, 927, 928, 929, 930, 931, 932, 933, 133, 133, 934,
+        935, 936, 937, 938, 939, 940, 941, 942, 943, 944, 945, 946, 947, 370, 1, 948,
+        949, 950, 951, 952, 953, 954, 955, 956, 957, 958, 959, 960, 961, 962, 963, 964,
+        965, 966, 967, 968, 969, 970, 971, 972, 973, 974, 975, 976, 977, 978, 979, 980,
+        981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 991, 992, 993, 994, 995, 370,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 996, 997, 998, 999, 1000,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016,
+        1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 133, 133,
+        1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046,
+        1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062,
+        1063, 1064, 1065, 1066, 133, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 133, 133, 1075,
+        1, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090,
+        1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106,
+        1107, 1108, 1109, 1110, 1111, 1112, 133, 133, 1113, 1114, 1115, 1116, 1117, 1118, 1119, 1120,
+        1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 133, 133, 1132, 1133, 1134,
+        133, 133, 133, 133, 133, 133, 133, 133, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142,
+        1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 133, 133,
+        1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 370, 1167, 1168, 1169, 1170, 1171,
+        1172, 1173, 1174, 1175, 1176, 1177, 1178, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194,
+        1195, 1196, 1197, 1198, 1199, 1200, 1201, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 133, 133, 133, 1213, 1214,
+        1215, 1216, 1217, 1218, 133, 133, 133, 133, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226,
+        1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 133, 133, 1237, 1238, 1239, 1240,
+        1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 133, 133, 133, 133, 133,
+        1252, 1253, 1254, 1255, 1256, 133, 133, 133, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264,
+        1265, 1266, 1267, 370, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 1268, 1269, 1270, 1271, 1272, 1273, 133, 133, 133, 133,
+        1274, 1275, 1276, 1277, 1278, 1279, 133, 133, 133, 133, 133, 1280, 1281, 133, 1282, 1283,
+        1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 370,
+        1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314,
+        1315, 1316, 1317, 1318, 133, 133, 133, 133, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 370,
+        1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333, 133, 133, 133, 133, 133, 133, 133, 133,
+        1334, 1335, 1336, 1337, 1338, 1339, 1340, 133, 1341, 1342, 1343, 1344, 1345, 370, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 1346, 1347, 1348, 1349, 1350, 1351, 133, 133,
+        1352, 1353, 1354, 1355, 1356, 370, 1357, 133, 1358, 1359, 1360, 1361, 370, 133, 133, 133,
+        1362, 1363, 1364, 1365, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        1366, 1367, 1368, 1369, 133, 133, 133, 133, 133, 133, 1370, 1371, 1372, 1373, 1374, 1375,
+        1376, 1377, 1378, 1379, 1380, 370, 133, 133, 133, 133, 1381, 1382, 1383, 1384, 1385, 133,
+        1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 133, 1397, 1398, 1399, 1400,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 133, 133, 133, 133,
+        1413, 1414, 1415, 1416, 1417, 370, 1418, 1419, 1420, 1421, 370, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 1422, 1423,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 1424, 1425, 1426, 1427, 1428,
+        1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444,
+        1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460,
+        1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476,
+        1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 133, 133, 133, 133, 133, 133,
+        1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502,
+        1503, 1504, 1505, 1506, 1507, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523,
+        1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539,
+        1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555,
+        1556, 1557, 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571,
+        1572, 1573, 1574, 1575, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591,
+        1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604, 1605, 1606, 1607,
+        1608, 1609, 1610, 1611, 1612, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628,
+        1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644,
+        1645, 1646, 1647, 1648, 1649, 1650, 1651, 133, 133, 133, 133, 133, 133, 1652, 1653, 1654,
+        1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 1664, 1665, 1666, 1667, 1668, 1669, 133, 133, 133, 133, 133, 133,
+        1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679, 133, 133, 133, 133, 1680, 1681,
+        1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696, 1697,
+        1698, 1699, 133, 133, 133, 1700, 1701, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728,
+        1729, 1730, 1731, 1732, 1733, 1734, 1735, 1, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 133,
+        1743, 1744, 1745, 1746, 1747, 133, 133, 133, 133, 133, 133, 133, 133, 133, 1748, 1749,
+        1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 133, 133, 133, 133, 133, 133, 133, 133,
+        1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1758, 1759, 1760,
+        1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780, 1758, 1759, 1760, 1761, 1762, 1773,
+        1764, 1765, 1766, 1777, 1778, 1779, 1780, 1758, 1759, 1760, 1781, 1782, 1783, 1784, 1785, 1786,
+        1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802,
+        1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818,
+        1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834,
+        1, 1, 1, 1835, 1, 1, 1836, 1837, 1838, 1839, 88, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        1840, 1841, 1842, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        1843, 1844, 1845, 1846, 1847, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 1848, 1849, 1850, 1851,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 133, 133,
+        1866, 1867, 1868, 1869, 1870, 1871, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 1872, 1873, 1874, 1875, 1876, 133, 133, 133, 133,
+        1877, 1878, 1879, 1880, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1890, 133, 133, 133, 1892,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908,
+        1909, 1910, 1911, 1912, 1913, 1914, 1915, 1912, 1916, 1917, 1918, 133, 133, 133, 1919, 1920,
+        1921, 1922, 1923, 1924, 1925, 1926, 1927, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943,
+        1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959,
+        1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975,
+        1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991,
+        1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 133,
+        2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 133, 133, 133, 133,
+        2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034,
+        2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048, 133, 133,
+        2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 133, 133, 2062,
+        2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077, 2078,
+        2079, 2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094,
+        2095, 2096, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        2097, 133, 1, 1, 1, 1, 1, 1, 133, 133, 133, 133, 133, 133, 133, 133,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+        133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+};
+
+/// 三级表，每块 16 个码点，值为 CollationElements 中的位置加 1，0 表示使用隐式权重
+static const uint16_t CollationStage3[33568] = {
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 4, 5, 6, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+        39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54,
+        55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70,
+        71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86,
+        87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 1,
+        1, 1, 1, 1, 1, 102, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 1, 116, 117,
+        118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 133, 136, 139,
+        140, 142, 144, 146, 148, 150, 152, 155, 157, 159, 161, 163, 165, 167, 169, 171,
+        173, 175, 177, 179, 181, 183, 185, 187, 188, 190, 192, 194, 196, 198, 200, 201,
+        204, 206, 208, 210, 212, 214, 216, 219, 221, 223, 225, 227, 229, 231, 233, 235,
+        237, 239, 241, 243, 245, 247, 249, 251, 252, 254, 256, 258, 260, 262, 264, 265,
+        267, 269, 271, 273, 275, 277, 279, 281, 283, 285, 287, 289, 291, 293, 295, 297,
+        299, 301, 303, 305, 307, 309, 311, 313, 315, 317, 319, 321, 323, 325, 327, 329,
+        331, 333, 335, 337, 339, 341, 343, 345, 347, 349, 351, 353, 355, 357, 359, 361,
+        363, 365, 366, 368, 370, 372, 374, 376, 378, 379, 381, 383, 385, 387, 389, 391,
+        393, 395, 397, 399, 401, 403, 405, 407, 409, 411, 413, 414, 415, 417, 419, 421,
+        423, 425, 427, 430, 433, 435, 437, 439, 441, 443, 445, 447, 449, 451, 453, 455,
+        457, 459, 461, 463, 465, 467, 469, 470, 471, 473, 475, 477, 479, 481, 483, 485,
+        487, 489, 491, 493, 495, 497, 499, 501, 503, 505, 507, 509, 511, 513, 515, 517,
+        519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 534, 535,
+        536, 537, 538, 539, 540, 541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551,
+        552, 554, 556, 557, 558, 559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569,
+        571, 573, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 588,
+        589, 590, 591, 592, 593, 596, 599, 602, 604, 606, 608, 610, 612, 614, 616, 618,
+        620, 622, 624, 626, 628, 630, 633, 636, 639, 642, 645, 648, 651, 654, 655, 658,
+        661, 664, 667, 671, 675, 676, 677, 679, 681, 683, 685, 687, 689, 692, 695, 697,
+        699, 701, 703, 705, 707, 709, 711, 712, 713, 715, 717, 720, 723, 727, 731, 734,
+        737, 739, 741, 743, 745, 747, 749, 751, 753, 755, 757, 759, 761, 763, 765, 767,
+        769, 771, 773, 775, 777, 779, 781, 783, 785, 787, 789, 791, 793, 794, 795, 797,
+        799, 800, 801, 802, 803, 804, 805, 807, 809, 811, 813, 816, 819, 822, 825, 827,
+        829, 832, 835, 837, 839, 840, 841, 842, 843, 845, 847, 848, 849, 850, 851, 852,
+        853, 854, 855, 856, 857, 858, 859, 860, 861, 862, 863, 864, 865, 866, 867, 868,
+        869, 870, 871, 872, 873, 874, 875, 876, 877, 878, 879, 880, 881, 882, 883, 884,
+        885, 886, 887, 888, 889, 890, 891, 892, 893, 894, 895, 896, 897, 898, 899, 900,
+        901, 902, 903, 904, 905, 906, 907, 908, 909, 910, 911, 912, 913, 914, 915, 916,
+        917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 930, 931, 932,
+        933, 934, 935, 936, 937, 938, 939, 940, 941, 942, 943, 944, 945, 946, 947, 948,
+        949, 950, 951, 705, 952, 954, 586, 956, 958, 960, 962, 964, 966, 967, 968, 969,
+        970, 971, 972, 973, 974, 975, 976, 977, 978, 979, 980, 981, 982, 983, 984, 985,
+        986, 987, 988, 989, 990, 991, 992, 993, 994, 995, 996, 997, 998, 999, 1000, 1001,
+        1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017,
+        1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033,
+        1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049,
+        1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1063, 1064,
+        1065, 1066, 1063, 1067, 1068, 1063, 1069, 1069, 1069, 1069, 1063, 1070, 1069, 1069, 1069, 1069,
+        1069, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1069, 1069, 1069, 1069, 1079, 1080, 1069,
+        1081, 1082, 1083, 1069, 1084, 1085, 1086, 1086, 1087, 1088, 1069, 1069, 1069, 1063, 1063, 1063,
+        1050, 1051, 1089, 1067, 1090, 1092, 1063, 1069, 1069, 1069, 1063, 1063, 1063, 1069, 1069, 1,
+        1063, 1063, 1063, 1069, 1069, 1069, 1069, 1063, 1093, 1069, 1069, 1063, 1069, 1063, 1063, 1069,
+        1094, 1095, 1069, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108,
+        1109, 1110, 1111, 1112, 979, 1113, 1114, 1115, 0, 0, 1116, 1117, 1118, 1119, 34, 1120,
+        0, 0, 0, 0, 122, 1121, 1123, 125, 1125, 1127, 1129, 0, 1131, 0, 1133, 1135,
+        1137, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154,
+        1155, 1156, 0, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1166, 1168, 1170, 1172, 1174,
+        1176, 1179, 1180, 1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193,
+        1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1206, 1208, 1210, 1212, 1214,
+        1217, 1218, 1219, 1220, 1222, 1224, 1225, 1226, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236,
+        1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252,
+        1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268,
+        1269, 1271, 1273, 1274, 1276, 1277, 1278, 1279, 1281, 1282, 1283, 1284, 1285, 1287, 1289, 1291,
+        1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307,
+        1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323,
+        1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339,
+        1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355,
+        1356, 1358, 1360, 1361, 1363, 1364, 1365, 1366, 1368, 1369, 1370, 1371, 1372, 1374, 1376, 1378,
+        1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394,
+        1395, 1396, 1397, 1398, 1399, 1400, 1401, 1403, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412,
+        1413, 1414, 1415, 1416, 1063, 1068, 1067, 1063, 1, 1, 1417, 1418, 1419, 1420, 1421, 1422,
+        1423, 1425, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440,
+        1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456,
+        1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472,
+        1473, 1474, 1476, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490,
+        1491, 1493, 1495, 1497, 1499, 1500, 1501, 1503, 1505, 1506, 1507, 1509, 1511, 1513, 1515, 1517,
+        1519, 1520, 1521, 1523, 1525, 1527, 1529, 1531, 1533, 1534, 1535, 1537, 1539, 1541, 1543, 1545,
+        1547, 1549, 1551, 1553, 1555, 1557, 1559, 1560, 1561, 1563, 1565, 1566, 1567, 1568, 1569, 1570,
+        1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586,
+        1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602,
+        1603, 1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618,
+        0, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633,
+        1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649,
+        1650, 1651, 1652, 1653, 1654, 1655, 1656, 0, 0, 1657, 1658, 1659, 1660, 1661, 1662, 1663,
+        1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679,
+        1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695,
+        1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1705, 1706, 1707, 0, 0, 1708, 1709, 1710,
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720, 1720, 1721, 1722, 1, 1723, 1724,
+        1725, 1726, 1727, 1728, 1, 1, 1729, 1719, 0, 0, 0, 0, 0, 0, 0, 0,
+        1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745,
+        1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 0, 0, 0, 0, 1757,
+        1761, 1763, 1765, 1767, 1768, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1779, 1, 0, 1780, 1781,
+        1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797,
+        1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813,
+        1, 1814, 1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828,
+        1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 1845, 1846, 1847, 1848, 1849, 1850,
+        1851, 1852, 1853, 1854, 1855, 1856, 1858, 1860, 1862, 1864, 1865, 1866, 1867, 1868, 1869, 1870,
+        1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886,
+        1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902,
+        1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918,
+        1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934,
+        1935, 1937, 1938, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952,
+        1953, 1954, 1955, 1956, 1958, 1959, 1, 1, 1, 1, 1, 1, 1, 1, 1960, 1,
+        1, 1, 1, 1, 1, 1961, 1962, 1, 1, 1963, 1, 1, 1, 1, 1964, 1965,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 1966, 1967, 1968, 1969, 1971, 1973,
+        1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 0, 1,
+        1988, 1989, 1990, 1991, 1992, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2003, 2004, 2005,
+        2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2015, 2016, 2017, 2018, 2019, 2020, 2022, 2024,
+        2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041,
+        1, 1063, 1069, 1, 1, 1063, 1069, 1, 1, 1, 1, 0, 0, 2042, 2043, 2044,
+        2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060,
+        2061, 2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076,
+        2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092,
+        2093, 2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108,
+        2109, 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124,
+        2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140,
+        2141, 2142, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 2143, 2144, 2145, 2146, 2147, 2148,
+        2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164,
+        2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2175, 2177, 2179, 2180, 2181, 2182, 2183,
+        2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 1, 0, 0, 1069, 2194, 2195,
+        2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203, 2204, 2205, 2206, 2207, 2208, 2209, 2210, 2211,
+        2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220, 2221, 2222, 2223, 2224, 2224, 2225, 2225,
+        2225, 2226, 2226, 2226, 2227, 2227, 2228, 2228, 2229, 2229, 2229, 2230, 2231, 2232, 0, 0,
+        2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247, 0,
+        2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263,
+        2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 1069, 1069, 1069, 0, 0, 2273, 0,
+        2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299, 2300,
+        2301, 2302, 2303, 2304, 2305, 0, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315,
+        2316, 2317, 2318, 2319, 2320, 2321, 2322, 2323, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 2324, 2325, 2326, 2327, 2328, 2329, 2330, 1, 1, 1, 1, 1, 1,
+        2331, 2332, 2333, 1, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345,
+        2346, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360,
+        2361, 2362, 2363, 2364, 2365, 2366, 2367, 2368, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376,
+        2377, 2378, 2379, 2380, 2381, 2382, 2383, 2384, 2385, 2386, 2388, 2389, 2390, 2391, 2392, 2393,
+        2394, 2395, 2397, 2398, 2399, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411,
+        2412, 2413, 2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426, 2427,
+        2428, 1, 1, 1050, 1051, 2429, 2430, 2431, 2432, 2434, 2436, 2438, 2440, 2442, 2444, 2446,
+        2448, 2449, 2450, 2451, 2452, 2453, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+        2454, 2455, 2456, 2457, 2458, 2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469,
+        2470, 2346, 2347, 2348, 0, 2471, 2472, 2473, 2474, 2475, 2476, 2477, 2478, 0, 0, 2479,
+        2480, 0, 0, 2481, 2482, 2483, 2484, 2485, 2486, 2487, 2488, 2489, 2490, 2491, 2492, 2493,
+        2494, 2495, 2496, 2497, 2498, 2499, 2500, 2501, 2502, 0, 2503, 2504, 2505, 2506, 2507, 2508,
+        2509, 0, 2510, 0, 0, 0, 2511, 2512, 2513, 2514, 0, 0, 2408, 2515, 2516, 2517,
+        2518, 2519, 2520, 2521, 2522, 0, 0, 2523, 2524, 0, 0, 2525, 2526, 2527, 2528, 0,
+        0, 0, 0, 0, 0, 0, 0, 2530, 0, 0, 0, 0, 2531, 2533, 0, 2535,
+        2537, 2538, 2539, 2540, 0, 0, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+        2541, 2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553, 2554, 2555, 0,
+        0, 2346, 2347, 2348, 0, 2556, 2557, 2558, 2559, 2560, 2561, 0, 0, 0, 0, 2562,
+        2563, 0, 0, 2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575, 2576,
+        2577, 2578, 2579, 2580, 2581, 2582, 2583, 2584, 2585, 0, 2586, 2587, 2588, 2589, 2590, 2591,
+        2592, 0, 2593, 2594, 0, 2596, 2597, 0, 2599, 2600, 0, 0, 2408, 0, 2601, 2602,
+        2603, 2604, 2605, 0, 0, 0, 0, 2606, 2607, 0, 0, 2608, 2609, 2610, 0, 0,
+        0, 2611, 0, 0, 0, 0, 0, 0, 0, 2612, 2614, 2616, 2618, 0, 2619, 0,
+        0, 0, 0, 0, 0, 0, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+        2621, 2622, 2623, 2624, 2625, 2626, 2627, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 2346, 2347, 2348, 0, 2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635, 2636, 0, 2637,
+        2638, 2639, 0, 2640, 2641, 2642, 2643, 2644, 2645, 2646, 2647, 2648, 2649, 2650, 2651, 2652,
+        2653, 2654, 2655, 2656, 2657, 2658, 2659, 2660, 2661, 0, 2662, 2663, 2664, 2665, 2666, 2667,
+        2668, 0, 2669, 2670, 0, 2671, 2672, 2673, 2674, 2675, 0, 0, 2408, 2676, 2677, 2678,
+        2679, 2680, 2681, 2682, 2683, 2684, 0, 2685, 2686, 2687, 0, 2688, 2689, 2690, 0, 0,
+        2691, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2692, 2693, 2694, 2695, 0, 0, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+        2696, 2697, 0, 0, 0, 0, 0, 0, 0, 2698, 1831, 1830, 1832, 2408, 2408, 2408,
+        0, 2346, 2347, 2348, 0, 2699, 2700, 2701, 2702, 2703, 2704, 2705, 2706, 0, 0, 2707,
+        2708, 0, 0, 2709, 2710, 2711, 2712, 2713, 2714, 2715, 2716, 2717, 2718, 2719, 2720, 2721,
+        2722, 2723, 2724, 2725, 2726, 2727, 2728, 2729, 2730, 0, 2731, 2732, 2733, 2734, 2735, 2736,
+        2737, 0, 2738, 2739, 0, 2740, 2741, 2742, 2743, 2744, 0, 0, 2408, 2745, 2746, 2747,
+        2748, 2749, 2750, 2751, 2752, 0, 0, 2753, 2754, 0, 0, 2755, 2756, 2757, 0, 0,
+        0, 0, 0, 0, 0, 1063, 2758, 2759, 0, 0, 0, 0, 2760, 2762, 0, 2764,
+        2765, 2766, 2767, 2768, 0, 0, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+        2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 2347, 2777, 0, 2778, 2779, 2780, 2781, 2782, 2783, 0, 0, 0, 2784, 2785,
+        2786, 0, 2787, 2788, 2789, 2790, 0, 0, 0, 2791, 2792, 0, 2793, 0, 2794, 2795,
+        0, 0, 0, 2796, 2797, 0, 0, 0, 2798, 2799, 2800, 0, 0, 0, 2801, 2802,
+        2803, 2804, 2805, 2806, 2807, 2808, 2809, 2810, 2811, 2812, 0, 0, 0, 0, 2813, 2814,
+        2815, 2816, 2817, 0, 0, 0, 2818, 2819, 2820, 0, 2821, 2822, 2823, 2824, 0, 0,
+        2825, 0, 0, 0, 0, 0, 0, 2826, 0, 0, 0, 0, 0, 0, 0, 0,
+        2827, 2828, 2829, 2830, 2831, 2832, 2833, 2834, 2835, 2836, 2837, 0, 0, 0, 0, 0,
+        2346, 2346, 2347, 2348, 2347, 2838, 2839, 2840, 2841, 2842, 2843, 2844, 2845, 0, 2846, 2847,
+        2848, 0, 2849, 2850, 2851, 2852, 2853, 2854, 2855, 2856, 2857, 2858, 2859, 2860, 2861, 2862,
+        2863, 2864, 2865, 2866, 2867, 2868, 2869, 2870, 2871, 0, 2872, 2873, 2874, 2875, 2876, 2877,
+        2878, 2879, 2880, 2881, 2882, 2883, 2884, 2885, 2886, 2887, 0, 0, 0, 2888, 2889, 2890,
+        2891, 2892, 2893, 2894, 2895, 0, 2896, 2897, 2898, 0, 2899, 2900, 2901, 2902, 0, 0,
+        0, 0, 0, 0, 0, 2903, 2904, 0, 2905, 2906, 2907, 0, 0, 0, 0, 0,
+        2908, 2909, 2910, 2911, 0, 0, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+        0, 0, 0, 0, 0, 0, 0, 2912, 23, 24, 25, 26, 24, 25, 26, 2913,
+        2914, 2346, 2347, 2348, 2915, 2916, 2917, 2918, 2919, 2920, 2921, 2922, 2923, 0, 2924, 2925,
+        2926, 0, 2927, 2928, 2929, 2930, 2931, 2932, 2933, 2934, 2935, 2936, 2937, 2938, 2939, 2940,
+        2941, 2942, 2943, 2944, 2945, 2946, 2947, 2948, 2949, 0, 2950, 2951, 2952, 2953, 2954, 2955,
+        2956, 2957, 2958, 2959, 0, 2960, 2961, 2962, 2963, 2964, 0, 0, 2408, 2965, 2966, 2967,
+        2968, 2969, 2970, 2971, 2972, 0, 2973, 2974, 2975, 0, 2976, 2977, 2978, 2979, 0, 0,
+        0, 0, 0, 0, 0, 2980, 2981, 0, 0, 0, 0, 0, 0, 0, 2982, 0,
+        2983, 2984, 2985, 2986, 0, 0, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+        0, 2987, 2988, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2347, 2346, 2347, 2348, 2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997, 0, 2998, 2999,
+        3000, 0, 3001, 3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014,
+        3015, 3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030,
+        3031, 3032, 3033, 3034, 3035, 3036, 3037, 3038, 3039, 3040, 3041, 3042, 3042, 3043, 3044, 3045,
+        3046, 3047, 3048, 3049, 3050, 0, 3051, 3052, 3053, 0, 3054, 3055, 3056, 3057, 3058, 3060,
+        0, 0, 0, 0, 3061, 3063, 3065, 3067, 3068, 3069, 3070, 3071, 3072, 3073, 3074, 3075,
+        3076, 3077, 3078, 3079, 0, 0, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+        3080, 3081, 3082, 3083, 3084, 3085, 3086, 3087, 3088, 3089, 3090, 3092, 3058, 3094, 3096, 3098,
+        0, 2346, 2347, 2348, 0, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107, 3108, 3109, 3110,
+        3111, 3112, 3113, 3114, 3115, 3116, 3117, 0, 0, 0, 3118, 3119, 3120, 3121, 3122, 3123,
+        3124, 3125, 3126, 3127, 3128, 3129, 3130, 3131, 3132, 3133, 3134, 3135, 3136, 3137, 3138, 3139,
+        3140, 3141, 0, 3142, 3143, 3144, 3145, 3146, 3147, 3148, 3149, 3150, 0, 3151, 0, 0,
+        3152, 3153, 3154, 3155, 3156, 3157, 3158, 0, 0, 0, 3159, 0, 0, 0, 0, 3160,
+        3161, 3162, 3163, 3164, 3165, 0, 3166, 0, 3167, 3168, 3169, 3170, 3171, 3172, 3173, 3174,
+        0, 0, 3175, 3176, 3177, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 3178, 3179, 3180, 3181, 3182, 3183, 3184, 3185, 3186, 3187, 3188, 3189, 3190, 3191, 3192,
+        3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 3201, 3202, 3203, 3204, 3205, 3206, 3207, 3208,
+        3209, 3210, 3211, 3212, 3213, 3214, 3215, 3216, 3217, 3218, 3219, 3220, 3221, 3222, 3223, 3224,
+        3225, 3226, 3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234, 3235, 0, 0, 0, 0, 3236,
+        3237, 3238, 3239, 3240, 3241, 3242, 3243, 3244, 3245, 3246, 3247, 3248, 3249, 3250, 3251, 3252,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 3253, 3254, 0, 0, 0, 0,
+        0, 3255, 3256, 0, 3257, 0, 3258, 3259, 3260, 3261, 3262, 0, 3263, 3264, 3265, 3266,
+        3267, 3268, 3269, 3270, 3271, 3272, 3273, 3274, 3275, 3276, 3277, 3278, 3279, 3280, 3281, 3282,
+        3283, 3284, 3285, 3286, 0, 3287, 0, 3288, 3289, 3290, 3291, 3292, 3293, 3294, 3295, 3296,
+        3297, 3298, 3299, 3300, 3301, 3302, 3303, 3304, 3305, 3306, 3307, 3308, 3309, 3310, 0, 0,
+        3311, 3312, 3313, 3314, 3315, 0, 3316, 0, 3317, 3318, 3319, 3320, 3321, 3322, 0, 0,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 0, 0, 3323, 3325, 3327, 3328,
+        3329, 3332, 3333, 3334, 3335, 3336, 3337, 3338, 3339, 3340, 3341, 3342, 3343, 3344, 3345, 3346,
+        3347, 3348, 3349, 3350, 3351, 3352, 3353, 3354, 1, 1, 3355, 3356, 3357, 3358, 3359, 3360,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 3361, 3362, 3363, 3364, 3365, 3366,
+        3367, 3368, 3369, 3370, 3371, 1, 3372, 1, 3373, 3374, 3375, 3376, 3377, 3378, 1, 1,
+        3379, 3380, 3381, 3382, 3384, 3385, 3386, 3387, 0, 3388, 3389, 3390, 3391, 3392, 3394, 3395,
+        3396, 3397, 3398, 3400, 3401, 3402, 3403, 3404, 3406, 3407, 3408, 3409, 3410, 3412, 3413, 3414,
+        3415, 3416, 3417, 3418, 3419, 3420, 3421, 3422, 3423, 3424, 3426, 3428, 3429, 0, 0, 0,
+        0, 3430, 3431, 3432, 3433, 3434, 3435, 3436, 3437, 3438, 3439, 3440, 3441, 3442, 2347, 2348,
+        3443, 3444, 1, 1, 3445, 3446, 1, 1, 3447, 3448, 3449, 3450, 3451, 3452, 3453, 3454,
+        3455, 3456, 3457, 3458, 3460, 3461, 3462, 3463, 0, 3464, 3465, 3466, 3467, 3468, 3470, 3471,
+        3472, 3473, 3474, 3476, 3477, 3478, 3479, 3480, 3482, 3483, 3484, 3485, 3486, 3488, 3489, 3490,
+        3491, 3492, 3493, 3494, 3495, 3496, 3497, 3498, 3499, 3500, 3502, 3504, 3506, 0, 3508, 3509,
+        3510, 3511, 3512, 3513, 3514, 3515, 1, 3516, 3517, 3518, 3519, 3520, 3521, 0, 3522, 3523,
+        3524, 3525, 3526, 3527, 3528, 3529, 3530, 3531, 3532, 3533, 3534, 0, 0, 0, 0, 0,
+        3535, 3536, 3537, 3538, 3539, 3540, 3541, 3542, 3543, 3544, 3545, 3546, 3547, 3548, 3549, 3550,
+        3551, 3552, 3553, 3554, 3555, 3556, 3557, 3558, 3559, 3560, 3561, 3562, 3563, 3564, 3565, 3566,
+        3567, 3568, 3569, 3570, 3571, 3572, 3573, 3574, 3575, 3576, 3577, 3578, 3579, 3580, 3581, 3582,
+        3583, 3584, 3585, 3586, 3587, 3588, 2347, 3589, 2348, 3590, 3591, 3592, 3593, 3594, 3595, 3596,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 3599, 3600, 3601, 3602, 3603, 3604,
+        3605, 3606, 3607, 3608, 3609, 3610, 3611, 3612, 3613, 3614, 3615, 3616, 3617, 3618, 3619, 3620,
+        3621, 3622, 3623, 3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631, 3632, 3633, 3634, 3635, 3636,
+        3637, 3638, 3639, 3640, 3641, 3642, 3643, 3644, 3645, 3646, 3647, 3648, 3649, 3650, 3651, 3652,
+        3653, 3654, 3655, 3656, 3657, 3658, 3659, 3660, 3661, 3662, 3663, 3664, 3665, 3666, 3667, 3668,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 3669, 3670, 3671, 3672, 3673, 3674,
+        3675, 3676, 3677, 3678, 3679, 3680, 3681, 3682, 3683, 3684, 3685, 3686, 3687, 3688, 3689, 3690,
+        3691, 3692, 3693, 3694, 3695, 3696, 3697, 3698, 3699, 3700, 3701, 3702, 3703, 3704, 3705, 3706,
+        3707, 3708, 3709, 3710, 3711, 3712, 0, 3713, 0, 0, 0, 0, 0, 3714, 0, 0,
+        3715, 3716, 3717, 3718, 3719, 3720, 3721, 3722, 3723, 3724, 3725, 3726, 3727, 3728, 3729, 3730,
+        3731, 3732, 3733, 3734, 3735, 3736, 3737, 3738, 3739, 3740, 3741, 3742, 3743, 3744, 3745, 3746,
+        3747, 3748, 3749, 3750, 3751, 3752, 3753, 3754, 3755, 3756, 3757, 3758, 3759, 3760, 3761, 3762,
+        3763, 3764, 3765, 3766, 3767, 3768, 3769, 3770, 3771, 3772, 3773, 3774, 3775, 3776, 3777, 3778,
+        3779, 3780, 3781, 3782, 3783, 3784, 3785, 3786, 3787, 3788, 3789, 3790, 3791, 3792, 3793, 3794,
+        3795, 3796, 3797, 3798, 3799, 3800, 3801, 3802, 3803, 3804, 3805, 3806, 3807, 3808, 3809, 3810,
+        3811, 3812, 3813, 3814, 3815, 3816, 3817, 3818, 3819, 3820, 3821, 3822, 3823, 3824, 3825, 3826,
+        3827, 3828, 3829, 3830, 3831, 3832, 3833, 3834, 3835, 3836, 3837, 3838, 3839, 3840, 3841, 3842,
+        3843, 3844, 3845, 3846, 3847, 3848, 3849, 3850, 3851, 3852, 3853, 3854, 3855, 3856, 3857, 3858,
+        3859, 3860, 3861, 3862, 3863, 3864, 3865, 3866, 3867, 3868, 3869, 3870, 3871, 3872, 3873, 3874,
+        3875, 3876, 3877, 3878, 3879, 3880, 3881, 3882, 3883, 3884, 3885, 3886, 3887, 3888, 3889, 3890,
+        3891, 3892, 3893, 3894, 3895, 3896, 3897, 3898, 3899, 3900, 3901, 3902, 3903, 3904, 3905, 3906,
+        3907, 3908, 3909, 3910, 3911, 3912, 3913, 3914, 3915, 3916, 3917, 3918, 3919, 3920, 3921, 3922,
+        3923, 3924, 3925, 3926, 3927, 3928, 3929, 3930, 3931, 3932, 3933, 3934, 3935, 3936, 3937, 3938,
+        3939, 3940, 3941, 3942, 3943, 3944, 3945, 3946, 3947, 3948, 3949, 3950, 3951, 3952, 3953, 3954,
+        3955, 3956, 3957, 3958, 3959, 3960, 3961, 3962, 3963, 3964, 3965, 3966, 3967, 3968, 3969, 3970,
+        3971, 3972, 3973, 3974, 3975, 3976, 3977, 3978, 3979, 3980, 3981, 3982, 3983, 3984, 3985, 3986,
+        3987, 3988, 3989, 3990, 3991, 3992, 3993, 3994, 3995, 3996, 3997, 3998, 3999, 4000, 4001, 4002,
+        4003, 4004, 4005, 4006, 4007, 4008, 4009, 4010, 4011, 4012, 4013, 4014, 4015, 4016, 4017, 4018,
+        4019, 4020, 4021, 4022, 4023, 4024, 4025, 4026, 4027, 4028, 4029, 4030, 4031, 4032, 4033, 4034,
+        4035, 4036, 4037, 4038, 4039, 4040, 4041, 4042, 4043, 4044, 4045, 4046, 4047, 4048, 4049, 4050,
+        4051, 4052, 4053, 4054, 4055, 4056, 4057, 4058, 4059, 4060, 4061, 4062, 4063, 4064, 4065, 4066,
+        4067, 4068, 4069, 4070, 4071, 4072, 4073, 4074, 4075, 4076, 4077, 4078, 4079, 4080, 4081, 4082,
+        4083, 4084, 4085, 4086, 4087, 4088, 4089, 4090, 4091, 0, 4092, 4093, 4094, 4095, 0, 0,
+        4096, 4097, 4098, 4099, 4100, 4101, 4102, 0, 4103, 0, 4104, 4105, 4106, 4107, 0, 0,
+        4108, 4109, 4110, 4111, 4112, 4113, 4114, 4115, 4116, 4117, 4118, 4119, 4120, 4121, 4122, 4123,
+        4124, 4125, 4126, 4127, 4128, 4129, 4130, 4131, 4132, 4133, 4134, 4135, 4136, 4137, 4138, 4139,
+        4140, 4141, 4142, 4143, 4144, 4145, 4146, 4147, 4148, 0, 4149, 4150, 4151, 4152, 0, 0,
+        4153, 4154, 4155, 4156, 4157, 4158, 4159, 4160, 4161, 4162, 4163, 4164, 4165, 4166, 4167, 4168,
+        4169, 4170, 4171, 4172, 4173, 4174, 4175, 4176, 4177, 4178, 4179, 4180, 4181, 4182, 4183, 4184,
+        4185, 0, 4186, 4187, 4188, 4189, 0, 0, 4190, 4191, 4192, 4193, 4194, 4195, 4196, 0,
+        4197, 0, 4198, 4199, 4200, 4201, 0, 0, 4202, 4203, 4204, 4205, 4206, 4207, 4208, 4209,
+        4210, 4211, 4212, 4213, 4214, 4215, 4216, 0, 4217, 4218, 4219, 4220, 4221, 4222, 4223, 4224,
+        4225, 4226, 4227, 4228, 4229, 4230, 4231, 4232, 4233, 4234, 4235, 4236, 4237, 4238, 4239, 4240,
+        4241, 4242, 4243, 4244, 4245, 4246, 4247, 4248, 4249, 4250, 4251, 4252, 4253, 4254, 4255, 4256,
+        4257, 4258, 4259, 4260, 4261, 4262, 4263, 4264, 4265, 4266, 4267, 4268, 4269, 4270, 4271, 4272,
+        4273, 0, 4274, 4275, 4276, 4277, 0, 0, 4278, 4279, 4280, 4281, 4282, 4283, 4284, 4285,
+        4286, 4287, 4288, 4289, 4290, 4291, 4292, 4293, 4294, 4295, 4296, 4297, 4298, 4299, 4300, 4301,
+        4302, 4303, 4304, 4305, 4306, 4307, 4308, 4309, 4310, 4311, 4312, 4313, 4314, 4315, 4316, 4317,
+        4318, 4319, 4320, 4321, 4322, 4323, 4324, 4325, 4326, 4327, 4328, 4329, 4330, 4331, 4332, 4333,
+        4334, 4335, 4336, 4337, 4338, 4339, 4340, 4341, 4342, 4343, 4344, 0, 0, 4345, 4346, 4347,
+        4348, 4349, 4350, 4351, 4352, 4353, 4354, 4355, 4356, 24, 25, 26, 27, 28, 29, 30,
+        31, 32, 4357, 4358, 4359, 4360, 4361, 4362, 4363, 4364, 4365, 4366, 4367, 0, 0, 0,
+        4368, 4369, 4370, 4371, 4372, 4373, 4374, 4375, 4376, 4377, 4378, 4379, 4380, 4381, 4382, 4383,
+        4384, 4385, 4386, 4387, 4388, 4389, 4390, 4391, 4392, 4393, 0, 0, 0, 0, 0, 0,
+        4394, 4395, 4396, 4397, 4398, 4399, 4400, 4401, 4402, 4403, 4404, 4405, 4406, 4407, 4408, 4409,
+        4410, 4411, 4412, 4413, 4414, 4415, 4416, 4417, 4418, 4419, 4420, 4421, 4422, 4423, 4424, 4425,
+        4426, 4427, 4428, 4429, 4430, 4431, 4432, 4433, 4434, 4435, 4436, 4437, 4438, 4439, 4440, 4441,
+        4442, 4443, 4444, 4445, 4446, 4447, 4448, 4449, 4450, 4451, 4452, 4453, 4454, 4455, 4456, 4457,
+        4458, 4459, 4460, 4461, 4462, 4463, 4464, 4465, 4466, 4467, 4468, 4469, 4470, 4471, 4472, 4473,
+        4474, 4475, 4476, 4477, 4478, 4479, 0, 0, 4480, 4481, 4482, 4483, 4484, 4485, 0, 0,
+        4486, 4487, 4488, 4489, 4490, 4491, 4492, 4493, 4494, 4495, 4496, 4497, 4498, 4499, 4500, 4501,
+        4502, 4503, 4504, 4505, 4506, 4507, 4508, 4509, 4510, 4511, 4512, 4513, 4514, 4515, 4516, 4517,
+        4518, 4519, 4520, 4521, 4522, 4523, 4524, 4525, 4526, 4527, 4528, 4529, 4530, 4531, 4532, 4533,
+        4534, 4535, 4536, 4537, 4538, 4539, 4540, 4541, 4542, 4543, 4544, 4545, 4546, 4547, 4548, 4549,
+        4550, 4551, 4552, 4553, 4554, 4555, 4556, 4557, 4558, 4559, 4560, 4561, 4562, 4563, 4564, 4565,
+        4566, 4567, 4568, 4569, 4570, 4571, 4572, 4573, 4574, 4575, 4576, 4577, 4578, 4579, 4580, 4581,
+        4582, 4583, 4584, 4585, 4586, 4587, 4588, 4589, 4590, 4591, 4592, 4593, 4594, 4595, 4596, 4597,
+        4598, 4599, 4600, 4601, 4602, 4603, 4604, 4605, 4606, 4607, 4608, 4609, 4610, 4611, 4612, 4613,
+        4614, 4615, 4616, 4617, 4618, 4619, 4620, 4621, 4622, 4623, 4624, 4625, 4626, 4627, 4628, 4629,
+        4630, 4631, 4632, 4633, 4634, 4635, 4636, 4637, 4638, 4639, 4640, 4641, 4642, 4643, 4644, 4645,
+        4646, 4647, 4648, 4649, 4650, 4651, 4652, 4653, 4654, 4655, 4656, 4657, 4658, 4659, 4660, 4661,
+        4662, 4663, 4664, 4665, 4666, 4667, 4668, 4669, 4670, 4671, 4672, 4673, 4674, 4675, 4676, 4677,
+        4678, 4679, 4680, 4681, 4682, 4683, 4684, 4685, 4686, 4687, 4688, 4689, 4690, 4691, 4692, 4693,
+        4694, 4695, 4696, 4697, 4698, 4699, 4700, 4701, 4702, 4703, 4704, 4705, 4706, 4707, 4708, 4709,
+        4710, 4711, 4712, 4713, 4714, 4715, 4716, 4717, 4718, 4719, 4720, 4721, 4722, 4723, 4724, 4725,
+        4726, 4727, 4728, 4729, 4730, 4731, 4732, 4733, 4734, 4735, 4736, 4737, 4738, 4739, 4740, 4741,
+        4742, 4743, 4744, 4745, 4746, 4747, 4748, 4749, 4750, 4751, 4752, 4753, 4754, 4755, 4756, 4757,
+        4758, 4759, 4760, 4761, 4762, 4763, 4764, 4765, 4766, 4767, 4768, 4769, 4770, 4771, 4772, 4773,
+        4774, 4775, 4776, 4777, 4778, 4779, 4780, 4781, 4782, 4783, 4784, 4785, 4786, 4787, 4788, 4789,
+        4790, 4791, 4792, 4793, 4794, 4795, 4796, 4797, 4798, 4799, 4800, 4801, 4802, 4803, 4804, 4805,
+        4806, 4807, 4808, 4809, 4810, 4811, 4812, 4813, 4814, 4815, 4816, 4817, 4818, 4819, 4820, 4821,
+        4822, 4823, 4824, 4825, 4826, 4827, 4828, 4829, 4830, 4831, 4832, 4833, 4834, 4835, 4836, 4837,
+        4838, 4839, 4840, 4841, 4842, 4843, 4844, 4845, 4846, 4847, 4848, 4849, 4850, 4851, 4852, 4853,
+        4854, 4855, 4856, 4857, 4858, 4859, 4860, 4861, 4862, 4863, 4864, 4865, 4866, 4867, 4868, 4869,
+        4870, 4871, 4872, 4873, 4874, 4875, 4876, 4877, 4878, 4879, 4880, 4881, 4882, 4883, 4884, 4885,
+        4886, 4887, 4888, 4889, 4890, 4891, 4892, 4893, 4894, 4895, 4896, 4897, 4898, 4899, 4900, 4901,
+        4902, 4903, 4904, 4905, 4906, 4907, 4908, 4909, 4910, 4911, 4912, 4913, 4914, 4915, 4916, 4917,
+        4918, 4919, 4920, 4921, 4922, 4923, 4924, 4925, 4926, 4927, 4928, 4929, 4930, 4931, 4932, 4933,
+        4934, 4935, 4936, 4937, 4938, 4939, 4940, 4941, 4942, 4943, 4944, 4945, 4946, 4947, 4948, 4949,
+        4950, 4951, 4952, 4953, 4954, 4955, 4956, 4957, 4958, 4959, 4960, 4961, 4962, 4963, 4964, 4965,
+        4966, 4967, 4968, 4969, 4970, 4971, 4972, 4973, 4974, 4975, 4976, 4977, 4978, 4979, 4980, 4981,
+        4982, 4983, 4984, 4985, 4986, 4987, 4988, 4989, 4990, 4991, 4992, 4993, 4994, 4995, 4996, 4997,
+        4998, 4999, 5000, 5001, 5002, 5003, 5004, 5005, 5006, 5007, 5008, 5009, 5010, 5011, 5012, 5013,
+        5014, 5015, 5016, 5017, 5018, 5019, 5020, 5021, 5022, 5023, 5024, 5025, 5026, 5027, 5028, 5029,
+        5030, 5031, 5032, 5033, 5034, 5035, 5036, 5037, 5038, 5039, 5040, 5041, 5042, 5043, 5044, 5045,
+        5046, 5047, 5048, 5049, 5050, 5051, 5052, 5053, 5054, 5055, 5056, 5057, 5058, 5059, 5060, 5061,
+        5062, 5063, 5064, 5065, 5066, 5067, 5068, 5069, 5070, 5071, 5072, 5073, 5074, 5075, 5076, 5077,
+        5078, 5079, 5080, 5081, 5082, 5083, 5084, 5085, 5086, 5087, 5088, 5089, 5090, 5091, 5092, 5093,
+        5094, 5095, 5096, 5097, 5098, 5099, 5100, 5101, 5102, 5103, 5104, 5105, 5106, 5107, 5108, 5109,
+        5110, 5111, 5112, 5113, 5114, 5115, 5116, 5117, 5118, 5119, 5120, 5121, 5122, 5123, 5124, 5125,
+        5126, 5127, 5128, 5129, 5130, 5131, 5132, 5133, 5134, 5135, 5136, 5137, 5138, 5139, 5140, 5141,
+        5142, 5143, 5144, 5145, 5146, 5147, 5148, 5149, 5150, 5151, 5152, 5153, 5154, 0, 0, 0,
+        5155, 5156, 5158, 5159, 5160, 5162, 5164, 5165, 5167, 5168, 5170, 5171, 5172, 5174, 5176, 5178,
+        5179, 5180, 5181, 5182, 5184, 5186, 5188, 5190, 5191, 5192, 5193, 5194, 5196, 5198, 5200, 5201,
+        5203, 5205, 5206, 5208, 5209, 5211, 5212, 5214, 5215, 5216, 5217, 5218, 5220, 5222, 5224, 5226,
+        5227, 5229, 5231, 5232, 5234, 5236, 5238, 5239, 5240, 5242, 5244, 5245, 5247, 5248, 5250, 5251,
+        5252, 5253, 5254, 5255, 5256, 5257, 5258, 5259, 5261, 5263, 5265, 5267, 5268, 5269, 5270, 5272,
+        5276, 5278, 5279, 5280, 5281, 5282, 5283, 5284, 5285, 0, 0, 0, 0, 0, 0, 0,
+        5286, 5287, 5288, 5289, 5290, 5291, 5292, 5293, 5294, 5295, 5296, 5297, 5298, 0, 5299, 5300,
+        5301, 5302, 5303, 5304, 5305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        5306, 5307, 5308, 5309, 5310, 5311, 5312, 5313, 5314, 5315, 5316, 5317, 5318, 5319, 5320, 5321,
+        5322, 5323, 5324, 5325, 5326, 5327, 5328, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        5329, 5330, 5331, 5332, 5333, 5334, 5335, 5336, 5337, 5338, 5339, 5340, 5341, 5342, 5343, 5344,
+        5345, 5346, 5347, 5348, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        5349, 5350, 5351, 5352, 5353, 5354, 5355, 5356, 5357, 5358, 5359, 5360, 5361, 0, 5362, 5363,
+        5364, 0, 5365, 5366, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        5367, 5368, 5369, 5370, 5371, 5372, 5373, 5374, 5375, 5376, 5377, 5378, 5379, 5380, 5381, 5382,
+        5383, 5384, 5385, 5386, 5387, 5388, 5389, 5390, 5391, 5392, 5393, 5394, 5395, 5396, 5397, 5398,
+        5399, 5400, 5401, 5402, 5403, 5404, 5405, 5406, 5407, 5408, 5409, 5410, 5411, 5412, 5413, 5414,
+        5415, 5416, 5417, 5418, 1, 1, 5419, 5420, 5421, 5422, 5423, 5424, 5425, 5426, 5427, 5428,
+        5429, 5430, 5431, 5432, 5433, 5434, 2347, 2348, 5435, 5436, 5437, 1063, 1063, 1063, 1063, 1063,
+        1063, 1063, 5438, 1, 5439, 5440, 5441, 5442, 5443, 5444, 5445, 5446, 5447, 1063, 0, 0,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 0, 0, 0, 0, 0, 0,
+        5448, 5449, 5450, 5451, 5452, 5453, 5454, 5455, 5456, 5457, 1, 1, 1, 1, 1, 0,
+        5458, 5459, 5460, 5461, 5462, 5463, 5464, 5465, 5466, 5467, 5468, 5469, 5470, 5471, 5472, 5473,
+        5474, 5475, 5476, 5477, 5478, 5479, 5480, 5481, 5482, 5483, 5484, 5485, 5486, 5487, 5488, 5489,
+        5490, 5491, 5492, 5493, 5494, 5495, 5496, 5497, 5498, 5499, 5500, 5501, 5502, 5503, 5504, 5505,
+        5506, 5507, 5508, 5509, 5510, 5511, 5512, 5513, 5514, 5515, 5516, 5517, 5518, 5519, 5520, 5521,
+        5522, 5523, 5524, 5525, 5526, 5527, 5528, 5529, 5530, 5531, 5532, 5533, 5534, 5535, 5536, 5537,
+        5538, 5539, 5540, 5541, 5542, 5543, 5544, 5545, 5546, 0, 0, 0, 0, 0, 0, 0,
+        5547, 5548, 5549, 5550, 5551, 5552, 5553, 5554, 5555, 5556, 5557, 5558, 5559, 5560, 5561, 5562,
+        5563, 5564, 5565, 5566, 5567, 5568, 5569, 5570, 5571, 5572, 5573, 5574, 5575, 5576, 5577, 5578,
+        5579, 5580, 5581, 5582, 5583, 5584, 5585, 5586, 5587, 5588, 5589, 0, 0, 0, 0, 0,
+        5590, 5591, 5592, 5593, 5594, 5595, 5596, 5597, 5598, 5599, 5600, 5601, 5602, 5603, 5604, 5605,
+        5606, 5607, 5608, 5609, 5610, 5611, 5612, 5613, 5614, 5615, 5616, 5617, 5618, 5619, 5620, 5621,
+        5622, 5623, 5624, 5625, 5626, 5627, 5628, 5629, 5630, 5631, 5632, 5633, 5634, 5635, 5636, 5637,
+        5638, 5639, 5640, 5641, 5642, 5643, 5644, 5645, 5646, 5647, 5648, 5649, 5650, 5651, 5652, 5653,
+        5654, 5655, 5656, 5657, 5658, 5659, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        5660, 5661, 5662, 5663, 5664, 5665, 5666, 5667, 5668, 5669, 5670, 5671, 5672, 5673, 5674, 5675,
+        5676, 5677, 5678, 5679, 5680, 5681, 5682, 5683, 5684, 5685, 5686, 5687, 5688, 5689, 5691, 0,
+        5693, 5694, 5695, 5696, 5697, 5698, 5699, 5700, 5701, 5702, 5703, 5704, 0, 0, 0, 0,
+        5705, 5706, 5707, 5708, 5709, 5710, 5711, 5712, 5713, 5714, 5715, 5716, 0, 0, 0, 0,
+        5717, 0, 0, 0, 5718, 5719, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+        5720, 5721, 5722, 5723, 5724, 5725, 5726, 5727, 5728, 5729, 5730, 5731, 5732, 5733, 5734, 5735,
+        5736, 5737, 5738, 5739, 5740, 5741, 5742, 5743, 5744, 5745, 5746, 5747, 5748, 5749, 0, 0,
+        5750, 5751, 5752, 5753, 5754, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        5755, 5756, 5757, 5758, 5759, 5760, 5761, 5762, 5763, 5764, 5765, 5766, 5767, 5768, 5769, 5770,
+        5771, 5772, 5773, 5774, 5775, 5776, 5777, 5778, 5779, 5780, 5781, 5782, 5783, 5784, 5785, 5786,
+        5787, 5788, 5789, 5790, 5791, 5792, 5793, 5794, 5795, 5796, 5797, 5798, 0, 0, 0, 0,
+        5799, 5800, 5801, 5802, 5803, 5804, 5805, 5806, 5807, 5808, 5809, 5810, 5811, 5812, 5813, 5814,
+        5815, 5816, 5817, 5818, 5819, 5820, 5821, 5822, 5823, 5824, 0, 0, 0, 0, 0, 0,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 24, 0, 0, 0, 5825, 5827,
+        5830, 5831, 5832, 5833, 5834, 5835, 5836, 5837, 5838, 5839, 5840, 5841, 5842, 5843, 5844, 5845,
+        5846, 5847, 5848, 5849, 5850, 5851, 5852, 5853, 5854, 5855, 5856, 5857, 5858, 5859, 5860, 5861,
+        5862, 5863, 5864, 5865, 5866, 5867, 5868, 5869, 5870, 5871, 5872, 5873, 5874, 5875, 5876, 5877,
+        5878, 5879, 5880, 5881, 5882, 5883, 5884, 5885, 5886, 5887, 5888, 5889, 0, 0, 5890, 5891,
+        5892, 5893, 5894, 5895, 5896, 5897, 5898, 5899, 5900, 5901, 5902, 5903, 5904, 5905, 5906, 5907,
+        5908, 5909, 5910, 5911, 5912, 5913, 5914, 5915, 5916, 5917, 5918, 5919, 5920, 5921, 5922, 5923,
+        5924, 5925, 5926, 5927, 5928, 5929, 5930, 5931, 5932, 5933, 5934, 5935, 5936, 5937, 5938, 5939,
+        5940, 5941, 5942, 5943, 5944, 5947, 5948, 5949, 5950, 5950, 5951, 5951, 5952, 5953, 5954, 0,
+        5955, 5956, 5957, 5958, 5959, 5960, 5961, 5962, 5963, 5964, 5965, 5966, 5967, 5968, 5969, 5970,
+        5971, 5972, 5973, 5974, 2347, 5975, 5976, 5977, 5978, 5979, 5980, 5981, 5982, 0, 0, 1,
+        5983, 5984, 5985, 5986, 5987, 5988, 5989, 5990, 5991, 5992, 5993, 5994, 5995, 5996, 0, 0,
+        1063, 1063, 1063, 1063, 1063, 1069, 1069, 1069, 1069, 1069, 1069, 1063, 1063, 1069, 5997, 5998,
+        5999, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2346, 2346, 2347, 6000, 2348, 6001, 6002, 6003, 6004, 6005, 6006, 6007, 6008, 6009, 6010, 6011,
+        6012, 6013, 6014, 6015, 6016, 6017, 6018, 6019, 6020, 6021, 6022, 6023, 6024, 6025, 6026, 6027,
+        6028, 6029, 6030, 6031, 6032, 6033, 6034, 6035, 6036, 6037, 6038, 6039, 6040, 6041, 6042, 6043,
+        6044, 6045, 6046, 6047, 2408, 6048, 6049, 6050, 6051, 6052, 6053, 6054, 6055, 6056, 6057, 6058,
+        6059, 6060, 6061, 6062, 6063, 6064, 6065, 6066, 6067, 6068, 6069, 6070, 0, 0, 0, 0,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 6071, 6072, 6073, 6074, 6075, 6076,
+        6077, 6078, 6079, 6080, 6081, 6082, 6083, 6084, 6085, 6086, 6087, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 6088, 6089, 6090, 6091, 6092, 6093, 6094, 6095, 6096, 0, 0, 0,
+        2347, 6097, 2348, 6098, 6099, 6100, 6101, 6102, 6103, 6104, 6105, 6106, 6107, 6108, 6109, 6110,
+        6111, 6112, 6113, 6114, 6115, 6116, 6117, 6118, 6119, 6120, 6121, 6122, 6123, 6124, 6125, 6126,
+        6127, 6128, 6129, 6130, 6131, 6132, 6133, 6134, 6135, 6136, 6137, 6138, 6139, 6140, 6141, 6142,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 6143, 6144, 6145, 6146, 6147, 6148,
+        6149, 6150, 6151, 6152, 6152, 6153, 6154, 6155, 6156, 6157, 6158, 6159, 6160, 6160, 6161, 6162,
+        6163, 6164, 6165, 6166, 6167, 6168, 6169, 6170, 6171, 6172, 6172, 6173, 6174, 6175, 6176, 6177,
+        6178, 6179, 6180, 6181, 6182, 6183, 2408, 6184, 6185, 6186, 6187, 6188, 6189, 6190, 6191, 6192,
+        6193, 6194, 6195, 6196, 0, 0, 0, 0, 0, 0, 0, 0, 6197, 6198, 6199, 6200,
+        6201, 6202, 6203, 6204, 6205, 6206, 6207, 6208, 6209, 6210, 6211, 6212, 6213, 6214, 6215, 6216,
+        6217, 6218, 6219, 6220, 6221, 6222, 6223, 6224, 6225, 6226, 6227, 6228, 6229, 6230, 6231, 6232,
+        6233, 6234, 6235, 6236, 6237, 6238, 6239, 6240, 6241, 6242, 6243, 6244, 6245, 6246, 6247, 6248,
+        6249, 6250, 6251, 6252, 6253, 6254, 6255, 2408, 0, 0, 0, 6256, 6257, 6258, 6259, 6260,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 0, 0, 0, 6261, 6262, 6263,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 6264, 6265, 6266, 6267, 6268, 6269,
+        6270, 6271, 6272, 6273, 6274, 6275, 6276, 6277, 6278, 6279, 6280, 6281, 6282, 6283, 6284, 6285,
+        6286, 6287, 6288, 6289, 6290, 6291, 6292, 6293, 6294, 6295, 6296, 6297, 6298, 6299, 6300, 6301,
+        6302, 6303, 6304, 6305, 6306, 6306, 6307, 6308, 6309, 0, 0, 0, 0, 0, 0, 0,
+        6310, 6311, 6312, 6313, 6314, 6315, 6316, 6317, 6318, 6319, 6320, 6321, 6322, 6323, 6324, 6325,
+        6326, 6327, 6328, 6329, 6330, 6331, 6332, 6333, 6334, 6335, 6336, 6337, 6338, 6339, 6340, 6341,
+        6342, 6343, 6344, 6345, 6346, 6347, 6348, 6349, 6350, 6351, 6352, 0, 0, 6353, 6354, 6355,
+        6356, 6357, 6358, 6359, 6360, 6361, 6362, 6363, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 6364, 6365, 6365, 6365, 2347, 6365, 6365,
+        6365, 6365, 2348, 2348, 1, 6366, 6367, 1, 1, 1, 6365, 0, 0, 0, 0, 0,
+        6368, 6369, 6370, 6371, 6372, 6373, 6374, 6375, 6376, 6377, 6378, 6379, 6380, 6381, 6382, 6383,
+        6384, 6385, 6386, 6387, 6388, 6389, 6390, 6391, 6392, 6393, 6394, 6395, 6396, 6397, 6398, 6399,
+        6400, 6401, 6402, 6403, 6404, 6405, 6406, 6407, 6408, 6409, 6410, 6411, 6412, 6413, 6416, 6417,
+        6418, 6419, 6420, 6421, 6422, 6423, 6424, 6425, 6426, 6427, 6428, 6429, 6430, 6431, 6432, 6433,
+        6434, 6435, 6436, 113, 6437, 6438, 6439, 6440, 6441, 6442, 6443, 6444, 6445, 6446, 6447, 6448,
+        6449, 6450, 128, 6451, 6452, 6453, 6454, 6455, 6456, 6457, 6458, 6459, 6460, 6461, 6462, 6463,
+        6464, 6465, 6466, 6467, 6468, 6469, 6470, 6471, 6472, 6473, 6474, 6475, 6476, 6477, 6478, 6479,
+        6480, 6481, 6482, 6483, 6484, 6485, 6486, 6487, 6488, 6489, 6491, 6494, 6495, 6496, 6497, 6498,
+        6499, 6500, 6501, 6502, 6503, 6504, 6505, 6506, 6507, 6508, 6509, 6510, 6511, 6512, 6513, 6514,
+        6515, 6516, 6517, 6518, 6519, 6520, 6521, 6522, 6523, 6524, 6525, 6526, 6527, 6528, 6529, 6531,
+        6532, 6533, 6534, 6535, 6536, 6537, 6538, 6539, 6540, 6541, 6542, 6543, 6544, 6545, 6546, 6547,
+        6548, 6549, 6550, 6551, 6552, 6553, 6554, 6555, 6556, 6557, 6558, 6559, 6560, 6561, 6562, 6563,
+        1063, 1063, 1069, 1063, 1063, 1063, 1063, 1063, 1063, 1063, 1105, 1063, 1063, 1063, 1063, 1069,
+        1069, 1063, 6564, 6565, 216, 6567, 6569, 6571, 6573, 237, 6575, 6576, 6577, 6578, 6579, 6580,
+        6581, 6582, 6583, 6584, 6585, 517, 6586, 6587, 6588, 6589, 6590, 6591, 6592, 6593, 6595, 6596,
+        6597, 5998, 6599, 6601, 6603, 1063, 1063, 1063, 1063, 1069, 0, 1063, 1069, 1069, 1063, 1069,
+        6605, 6607, 6609, 6611, 6613, 6615, 6617, 6619, 6621, 6624, 6627, 6629, 6631, 6633, 6635, 6637,
+        6639, 6641, 6643, 6645, 6647, 6650, 6653, 6656, 6659, 6661, 6663, 6665, 6667, 6670, 6673, 6675,
+        6677, 6679, 6681, 6683, 6685, 6687, 6689, 6691, 6693, 6695, 6697, 6699, 6701, 6703, 6705, 6708,
+        6711, 6713, 6715, 6717, 6719, 6721, 6723, 6725, 6727, 6730, 6733, 6735, 6737, 6739, 6741, 6743,
+        6745, 6747, 6749, 6751, 6753, 6755, 6757, 6759, 6761, 6763, 6765, 6767, 6769, 6772, 6775, 6778,
+        6781, 6784, 6787, 6790, 6793, 6795, 6797, 6799, 6801, 6803, 6805, 6807, 6809, 6812, 6815, 6817,
+        6819, 6821, 6823, 6825, 6827, 6830, 6833, 6836, 6839, 6842, 6845, 6847, 6849, 6851, 6853, 6855,
+        6857, 6859, 6861, 6863, 6865, 6867, 6869, 6871, 6873, 6876, 6879, 6882, 6885, 6887, 6889, 6891,
+        6893, 6895, 6897, 6899, 6901, 6903, 6905, 6907, 6909, 6911, 6913, 6915, 6917, 6919, 6921, 6923,
+        6925, 6927, 6929, 6931, 6933, 6935, 6937, 6939, 6941, 6943, 6945, 6947, 6950, 6951, 6952, 6955,
+        6956, 6958, 6960, 6962, 6964, 6967, 6970, 6973, 6976, 6979, 6982, 6985, 6988, 6991, 6994, 6997,
+        7000, 7003, 7006, 7009, 7012, 7015, 7018, 7021, 7024, 7026, 7028, 7030, 7032, 7034, 7036, 7039,
+        7042, 7045, 7048, 7051, 7054, 7057, 7060, 7063, 7066, 7068, 7070, 7072, 7074, 7076, 7078, 7080,
+        7082, 7085, 7088, 7091, 7094, 7097, 7100, 7103, 7106, 7109, 7112, 7115, 7118, 7121, 7124, 7127,
+        7130, 7133, 7136, 7139, 7142, 7144, 7146, 7148, 7150, 7153, 7156, 7159, 7162, 7165, 7168, 7171,
+        7174, 7177, 7180, 7182, 7184, 7186, 7188, 7190, 7192, 7194, 7196, 7198, 7200, 7201, 7202, 7203,
+        7204, 7206, 7208, 7211, 7214, 7217, 7220, 7223, 7226, 7228, 7230, 7233, 7236, 7239, 7242, 7245,
+        7248, 7250, 7252, 7255, 7258, 7261, 0, 0, 7264, 7266, 7268, 7271, 7274, 7277, 0, 0,
+        7280, 7282, 7284, 7287, 7290, 7293, 7296, 7299, 7302, 7304, 7306, 7309, 7312, 7315, 7318, 7321,
+        7324, 7326, 7328, 7331, 7334, 7337, 7340, 7343, 7346, 7348, 7350, 7353, 7356, 7359, 7362, 7365,
+        7368, 7370, 7372, 7375, 7378, 7381, 0, 0, 7384, 7386, 7388, 7391, 7394, 7397, 0, 0,
+        7400, 7402, 7404, 7407, 7410, 7413, 7416, 7419, 0, 7422, 0, 7424, 0, 7427, 0, 7430,
+        7433, 7435, 7437, 7440, 7443, 7446, 7449, 7452, 7455, 7457, 7459, 7462, 7465, 7468, 7471, 7474,
+        7477, 1168, 7479, 1170, 7481, 1172, 7483, 1174, 7485, 1208, 7487, 1210, 7489, 1212, 0, 0,
+        7491, 7494, 7497, 7501, 7505, 7509, 7513, 7517, 7521, 7524, 7527, 7531, 7535, 7539, 7543, 7547,
+        7551, 7554, 7557, 7561, 7565, 7569, 7573, 7577, 7581, 7584, 7587, 7591, 7595, 7599, 7603, 7607,
+        7611, 7614, 7617, 7621, 7625, 7629, 7633, 7637, 7641, 7644, 7647, 7651, 7655, 7659, 7663, 7667,
+        7671, 7673, 7675, 7678, 7680, 0, 7683, 7685, 7688, 7690, 7692, 1123, 7694, 7696, 1187, 7696,
+        7697, 7698, 7700, 7703, 7705, 0, 7708, 7710, 7713, 1125, 7715, 1127, 7717, 7719, 7721, 7723,
+        7725, 7727, 7729, 1137, 0, 0, 7732, 7734, 7737, 7739, 7741, 1129, 0, 7743, 7745, 7747,
+        7749, 7751, 7753, 1176, 7756, 7758, 7760, 7762, 7765, 7767, 7769, 1133, 7771, 7773, 1121, 71,
+        0, 0, 7775, 7778, 7780, 0, 7783, 7785, 7788, 1131, 7790, 1135, 7792, 122, 7794, 0,
+        5126, 5126, 5126, 5126, 5126, 5126, 5126, 103, 5126, 5126, 5126, 1, 1, 1, 1, 1,
+        7795, 7796, 7797, 7798, 7799, 7800, 7801, 7802, 7803, 7804, 7805, 7806, 7807, 7808, 7809, 7810,
+        7811, 7812, 7813, 7814, 7815, 7816, 7818, 7821, 7822, 7823, 1, 1, 1, 1, 1, 103,
+        7824, 7825, 7826, 7827, 7829, 7832, 7833, 7835, 7838, 7839, 7840, 7841, 7842, 7844, 7845, 7846,
+        7847, 7848, 7849, 7850, 7851, 7852, 7853, 7854, 7856, 7858, 7860, 7861, 7862, 7863, 7864, 7865,
+        7866, 7867, 7868, 7869, 7870, 7871, 7872, 7873, 7877, 7878, 7879, 7880, 7881, 7882, 7883, 5126,
+        1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        7884, 7885, 0, 0, 7886, 7887, 7888, 7889, 7890, 7891, 7892, 7893, 7894, 7895, 7896, 7897,
+        7898, 7899, 7900, 7901, 7902, 7903, 7904, 7905, 7906, 7907, 7908, 7909, 7910, 7911, 7912, 0,
+        7913, 7914, 7915, 7916, 7917, 7918, 7919, 7920, 7921, 7922, 7923, 7924, 7925, 0, 0, 0,
+        7926, 7927, 7928, 7929, 7930, 7931, 7932, 7933, 7934, 7936, 7937, 7938, 7939, 7940, 7941, 7942,
+        7943, 7944, 7945, 7946, 7947, 7948, 7949, 7950, 7951, 7952, 7953, 7954, 7955, 7956, 7957, 7958,
+        7959, 7960, 7961, 7961, 7962, 7963, 7964, 7965, 1086, 1086, 1086, 7966, 7967, 5997, 5997, 5997,
+        5997, 7968, 5997, 5997, 5997, 1086, 7969, 7970, 7971, 7972, 1086, 1086, 1069, 1069, 1069, 1069,
+        1063, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        7973, 7976, 7979, 7980, 7982, 7983, 7986, 7989, 7990, 7991, 7993, 7994, 7994, 7994, 7995, 345,
+        7996, 7996, 7997, 7998, 7999, 8000, 8001, 8003, 8004, 8005, 8006, 8007, 8007, 8007, 8008, 8009,
+        8010, 8012, 8015, 8017, 8018, 8019, 1163, 8020, 8018, 8021, 50, 150, 8022, 7979, 8023, 8024,
+        8025, 8026, 8027, 8028, 8029, 8030, 8031, 8032, 8033, 8034, 8035, 8036, 8039, 8040, 8041, 8042,
+        8043, 8044, 8045, 8046, 8047, 8048, 8049, 8024, 8034, 8050, 8051, 8052, 8053, 8054, 8057, 8058,
+        8059, 8062, 8065, 8069, 8072, 8075, 8078, 8081, 8084, 8087, 8090, 8093, 8096, 8099, 8102, 8105,
+        8107, 8108, 8110, 8113, 8115, 8116, 8118, 8121, 8125, 8127, 8128, 8130, 8133, 8134, 8135, 8136,
+        1098, 8137, 8139, 8142, 1107, 8144, 8146, 8149, 8153, 1108, 8155, 8157, 6578, 1101, 1102, 1104,
+        8160, 8161, 8162, 8163, 8164, 29, 8165, 8166, 8167, 8168, 8171, 8172, 0, 0, 0, 0,
+        8173, 8174, 8175, 8176, 8177, 8178, 8179, 8180, 8181, 8182, 8183, 8185, 8187, 8188, 8189, 8190,
+        8191, 8192, 8193, 8194, 8195, 8196, 8197, 8198, 8199, 8200, 8201, 8202, 8203, 8204, 8205, 8207,
+        8208, 8209, 8210, 8211, 8212, 8213, 8214, 8215, 8216, 8217, 8218, 8219, 8220, 8221, 8222, 8223,
+        8224, 8225, 8226, 8227, 8228, 8229, 8230, 8231, 8232, 8233, 8234, 8235, 8236, 8237, 8239, 8241,
+        8243, 8244, 8245, 8246, 8247, 8248, 8249, 8250, 8251, 8252, 8253, 8254, 8255, 8256, 8257, 8258,
+        8259, 8260, 8261, 8262, 8263, 8264, 8265, 8266, 8267, 8268, 8269, 8270, 8271, 8272, 8273, 8274,
+        8275, 8276, 8277, 8278, 8279, 8280, 8281, 8282, 8283, 8284, 8285, 8286, 8287, 8288, 8289, 8290,
+        8291, 8292, 8293, 8294, 8295, 8297, 8298, 8299, 8300, 8301, 8303, 8304, 8305, 8307, 8308, 8309,
+        8310, 8311, 8312, 8313, 8314, 8315, 8316, 8317, 8318, 8319, 8320, 8321, 8322, 8323, 8324, 8325,
+        8326, 8327, 8328, 8329, 8330, 8332, 8333, 8335, 8336, 8337, 8338, 8339, 8340, 8342, 8345, 8346,
+        8348, 8351, 8352, 8353, 8354, 8355, 8356, 8357, 8358, 8359, 8360, 8361, 8362, 8363, 8364, 8365,
+        8366, 8367, 8369, 8370, 8371, 8373, 8374, 8375, 8377, 8378, 8380, 8381, 8382, 8383, 8384, 8385,
+        8386, 8387, 8388, 8389, 8390, 8391, 8392, 8393, 8394, 8395, 8396, 8397, 8398, 8399, 8400, 8401,
+        8402, 8404, 8405, 8407, 8408, 8409, 8410, 8411, 8412, 8413, 8414, 8415, 8416, 8417, 8419, 8421,
+        8423, 8425, 8427, 8428, 8429, 8431, 8433, 8434, 8435, 8437, 8439, 8440, 8441, 8442, 8443, 8444,
+        8445, 8447, 8449, 8450, 8451, 8453, 8455, 8456, 8457, 8459, 8461, 8462, 8463, 8464, 8465, 8466,
+        8467, 8468, 8469, 8470, 8471, 8472, 8473, 8474, 8475, 8476, 8477, 8478, 8479, 8480, 8481, 8482,
+        8483, 8484, 8485, 8486, 8487, 8488, 8489, 8490, 8491, 8492, 8493, 8494, 8495, 8497, 8499, 8501,
+        8503, 8504, 8505, 8506, 8507, 8508, 8509, 8510, 8511, 8512, 8513, 8514, 8515, 8516, 8517, 8518,
+        8519, 8520, 8521, 8522, 8523, 8524, 8525, 8526, 8527, 8528, 8529, 8530, 8531, 8532, 8533, 8534,
+        8535, 8536, 8537, 8538, 8539, 8540, 8541, 8542, 8543, 8544, 8545, 8546, 8547, 8548, 8549, 8550,
+        8551, 8553, 8555, 8557, 8559, 8560, 8561, 8562, 8563, 8564, 8565, 8567, 8569, 8571, 8573, 8574,
+        8575, 8576, 8577, 8578, 8579, 8580, 8581, 8582, 8583, 8584, 8585, 8586, 8587, 8588, 8589, 8590,
+        8591, 8592, 8593, 8594, 8595, 8596, 8597, 8598, 8599, 8600, 8601, 8602, 8603, 8604, 8605, 8606,
+        8607, 8608, 8609, 8610, 8611, 8612, 8613, 8614, 8615, 8616, 8617, 8618, 8619, 8620, 8621, 8622,
+        8623, 8624, 8625, 8626, 8627, 8628, 8629, 8630, 8631, 8632, 8633, 8634, 8635, 8636, 8637, 8638,
+        8639, 8640, 8641, 8642, 8643, 8644, 8645, 8646, 8647, 8648, 8649, 8650, 8651, 8652, 8653, 8654,
+        8655, 8656, 8657, 8658, 8659, 8660, 8661, 8662, 8663, 8664, 8665, 8666, 8667, 8668, 8669, 8670,
+        8671, 8672, 8673, 8674, 8675, 8676, 8677, 8678, 8679, 8680, 8681, 8682, 8683, 8684, 8685, 8686,
+        8687, 8688, 8689, 8690, 8691, 8692, 8693, 8694, 8695, 8696, 8697, 8698, 8699, 8700, 8701, 8702,
+        8703, 8704, 8705, 8706, 8707, 8708, 8709, 8710, 8711, 8712, 8713, 8714, 8715, 8716, 8717, 8718,
+        8719, 8720, 8721, 8722, 8723, 8724, 8725, 8726, 8727, 8728, 8729, 8730, 8731, 8732, 8733, 8734,
+        8735, 8736, 8737, 8738, 8739, 8740, 8741, 8742, 8743, 8744, 8745, 8746, 8747, 8748, 8749, 8750,
+        8751, 8752, 8753, 8754, 8755, 8756, 8757, 8758, 8759, 8760, 8761, 8762, 8763, 8764, 8765, 8766,
+        8767, 8768, 8769, 8770, 8771, 8772, 8773, 8774, 8775, 8776, 8777, 8778, 8779, 8780, 8781, 8782,
+        8783, 8784, 8785, 8786, 8787, 8788, 8789, 8790, 8791, 8792, 8793, 8794, 8795, 8796, 8797, 8798,
+        8799, 8800, 8801, 8802, 8803, 8804, 8805, 8806, 8807, 8808, 8809, 8810, 8811, 8812, 8813, 8814,
+        8815, 8816, 8817, 8818, 8819, 8820, 8821, 8822, 8823, 8824, 8825, 8826, 8827, 8828, 8829, 8830,
+        8831, 8832, 8833, 8834, 8835, 8836, 8837, 8838, 8839, 8840, 8841, 8842, 8843, 8844, 8845, 8846,
+        8847, 8848, 8849, 8850, 8851, 8852, 8853, 8854, 8855, 8856, 8857, 8858, 8859, 8860, 8861, 8862,
+        8863, 8864, 8865, 8866, 8867, 8868, 8869, 8870, 8871, 8872, 8873, 8874, 8875, 8876, 8877, 8878,
+        8879, 8880, 8881, 8882, 8883, 8884, 8885, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        8886, 8887, 8888, 8889, 8890, 8891, 8892, 8893, 8894, 8895, 8896, 0, 0, 0, 0, 0,
+        8897, 8898, 8899, 8900, 8901, 8902, 8903, 8904, 8905, 8906, 8908, 8910, 8912, 8914, 8916, 8918,
+        8920, 8922, 8924, 8926, 8928, 8931, 8934, 8937, 8940, 8943, 8946, 8949, 8952, 8955, 8959, 8963,
+        8967, 8971, 8975, 8979, 8983, 8987, 8991, 8995, 8999, 9001, 9003, 9005, 9007, 9009, 9011, 9013,
+        9015, 9017, 9020, 9023, 9026, 9029, 9032, 9035, 9038, 9041, 9044, 9047, 9050, 9053, 9056, 9059,
+        9062, 9065, 9068, 9071, 9074, 9077, 9080, 9083, 9086, 9089, 9092, 9095, 9098, 9101, 9104, 9107,
+        9110, 9113, 9116, 9119, 9122, 9125, 9128, 9129, 9130, 9131, 9132, 9133, 9134, 9135, 9136, 9137,
+        9138, 9139, 9140, 9141, 9142, 9143, 9144, 9145, 9146, 9147, 9148, 9149, 9150, 9151, 9152, 9153,
+        9154, 9155, 9156, 9157, 9158, 9159, 9160, 9161, 9162, 9163, 9164, 9165, 9166, 9167, 9168, 9169,
+        9170, 9171, 9172, 9173, 9174, 9175, 9176, 9177, 9178, 9179, 9180, 8908, 8910, 8912, 8914, 8916,
+        8918, 8920, 8922, 8924, 8926, 8897, 8898, 8899, 8900, 8901, 8902, 8903, 8904, 8905, 8906, 9180,
+        9181, 9182, 9183, 9184, 9185, 9186, 9187, 9188, 9189, 9190, 9191, 9192, 9193, 9194, 9195, 9196,
+        9197, 9198, 9199, 9200, 9201, 9202, 9203, 9204, 9205, 9206, 9207, 9208, 9209, 9210, 9211, 9212,
+        9213, 9214, 9215, 9216, 9217, 9218, 9219, 9220, 9221, 9222, 9223, 9224, 9225, 9226, 9227, 9228,
+        9229, 9230, 9231, 9232, 9233, 9234, 9235, 9236, 9237, 9238, 9239, 9240, 9241, 9242, 9243, 9244,
+        9245, 9246, 9247, 9248, 9249, 9250, 9251, 9252, 9253, 9254, 9255, 9256, 9257, 9258, 9259, 9260,
+        9261, 9262, 9263, 9264, 9265, 9266, 9267, 9268, 9269, 9270, 9271, 9272, 9273, 9274, 9275, 9276,
+        9277, 9278, 9279, 9280, 9281, 9282, 9283, 9284, 9285, 9286, 9287, 9288, 9289, 9290, 9291, 9292,
+        9293, 9294, 9295, 9296, 9297, 9298, 9299, 9300, 9301, 9302, 9303, 9304, 9305, 9306, 9307, 9308,
+        9309, 9310, 9311, 9312, 9313, 9314, 9315, 9316, 9317, 9318, 9319, 9320, 9321, 9322, 9323, 9324,
+        9325, 9326, 9327, 9328, 9329, 9330, 9331, 9332, 9333, 9334, 9335, 9336, 9337, 9338, 9339, 9340,
+        9341, 9342, 9343, 9344, 9345, 9346, 9347, 9348, 9349, 9350, 9351, 9352, 9353, 9354, 9355, 9356,
+        9357, 9358, 9359, 9360, 9361, 9362, 9363, 9364, 9365, 9366, 9367, 9368, 9369, 9370, 9371, 9372,
+        9373, 9374, 9375, 9376, 9377, 9378, 9379, 9380, 9381, 9382, 9383, 9384, 9385, 9386, 9387, 9388,
+        9389, 9390, 9391, 9392, 9393, 9394, 9395, 9396, 9397, 9398, 9399, 9400, 9401, 9402, 9403, 9404,
+        9405, 9406, 9407, 9408, 9409, 9410, 9411, 9412, 9413, 9414, 9415, 9416, 9417, 9418, 9419, 9420,
+        9421, 9422, 9423, 9424, 9425, 9426, 9427, 9428, 9429, 9430, 9431, 9432, 9433, 9434, 9435, 9436,
+        9437, 9438, 9439, 9440, 9441, 9442, 9443, 9444, 9445, 9446, 9447, 9448, 9449, 9450, 9451, 9452,
+        9453, 9454, 9455, 9456, 9457, 9458, 9459, 9460, 9461, 9462, 9463, 9464, 9465, 9466, 9467, 9468,
+        9469, 9470, 9471, 9472, 9473, 9474, 9475, 9476, 9477, 9478, 9479, 9480, 9481, 9482, 9483, 9484,
+        9485, 9486, 9487, 9488, 9489, 9490, 9491, 9492, 9493, 9494, 9495, 9496, 9497, 9498, 9499, 9500,
+        9501, 9502, 9503, 9504, 9505, 9506, 9507, 9508, 9509, 9510, 9511, 9512, 9513, 9514, 9515, 9516,
+        9517, 9518, 9519, 9520, 9521, 9522, 9523, 9524, 9525, 9526, 9527, 9528, 9529, 9530, 9531, 9532,
+        9533, 9534, 9535, 9536, 9537, 9538, 9539, 9540, 9541, 9542, 9543, 9544, 9545, 9546, 9547, 9548,
+        9549, 9550, 9551, 9552, 9553, 9554, 9555, 9556, 9557, 9558, 9559, 9560, 9561, 9562, 9563, 9564,
+        9565, 9566, 9567, 9568, 9569, 9570, 9571, 9572, 9573, 9574, 9575, 9576, 9577, 9578, 9579, 9580,
+        9581, 9582, 9583, 9584, 9585, 9586, 9587, 9588, 9589, 9590, 9591, 9592, 9593, 9594, 9595, 9596,
+        9597, 9598, 9599, 9600, 9601, 9602, 9603, 9604, 9605, 9606, 9607, 9608, 9609, 9610, 9611, 9612,
+        9613, 9614, 9615, 9616, 9617, 9618, 9619, 9620, 9621, 9622, 9623, 9624, 9625, 9626, 9627, 9628,
+        9629, 9630, 9631, 9632, 9633, 9634, 9635, 9636, 9637, 9638, 9639, 9640, 9641, 9642, 9643, 9644,
+        9645, 9646, 9647, 9648, 9649, 9650, 9651, 9652, 9653, 9654, 9655, 9656, 9657, 9658, 9659, 9660,
+        9661, 9662, 9663, 9664, 9665, 9666, 9667, 9668, 9669, 9670, 9671, 9672, 9673, 9674, 9675, 9676,
+        9677, 9678, 9679, 9680, 9681, 9682, 9683, 9684, 9685, 9686, 9687, 9688, 9689, 9690, 9691, 9692,
+        9693, 9694, 9695, 9696, 9697, 9698, 9699, 9700, 9701, 9702, 9703, 9704, 9705, 9706, 9707, 9708,
+        9709, 9710, 9711, 9712, 9713, 9714, 9715, 9716, 9717, 9718, 9719, 9720, 9721, 9722, 9723, 9724,
+        9725, 9726, 9727, 9728, 9729, 9730, 9731, 9732, 9733, 9734, 9735, 9736, 9737, 9738, 9739, 9740,
+        9741, 9742, 9743, 9744, 9745, 9746, 9747, 9748, 9749, 9750, 9751, 9752, 9753, 9754, 9755, 9756,
+        9757, 9758, 9759, 9760, 9761, 9762, 9763, 9764, 9765, 9766, 9767, 9768, 9769, 9770, 9771, 9772,
+        9773, 9774, 9775, 9776, 9777, 9778, 9779, 9780, 9781, 9782, 9783, 9784, 9785, 9786, 9787, 9788,
+        9789, 9790, 9791, 9792, 9793, 9794, 9795, 9796, 9797, 9798, 9799, 9800, 9801, 9802, 9803, 9804,
+        9805, 9806, 9807, 9808, 9809, 9810, 8897, 8898, 8899, 8900, 8901, 8902, 8903, 8904, 8905, 8906,
+        8897, 8898, 8899, 8900, 8901, 8902, 8903, 8904, 8905, 8906, 8897, 8898, 8899, 8900, 8901, 8902,
+        8903, 8904, 8905, 8906, 9811, 9812, 9813, 9814, 9815, 9816, 9817, 9818, 9819, 9820, 9821, 9822,
+        9823, 9824, 9825, 9826, 9827, 9828, 9829, 9830, 9831, 9832, 9833, 9834, 9835, 9836, 9837, 9838,
+        9839, 9840, 9841, 9842, 9843, 9844, 9845, 9846, 9847, 9848, 9849, 9850, 9851, 9852, 9853, 9854,
+        9855, 9856, 9857, 9858, 9859, 9860, 9861, 9862, 9863, 9864, 9865, 9866, 9867, 9868, 9869, 9870,
+        9871, 9872, 9873, 9874, 9875, 9876, 9877, 9878, 9879, 9880, 9881, 9882, 9883, 9884, 9885, 9886,
+        9887, 9888, 9889, 9890, 9891, 9892, 9893, 9894, 9895, 9896, 9897, 9898, 9899, 9900, 9901, 9902,
+        9903, 9904, 9905, 9906, 9907, 9908, 9909, 9910, 9911, 9912, 9913, 9914, 9915, 9916, 9917, 9918,
+        9919, 9920, 9921, 9922, 9923, 9924, 9925, 9926, 9927, 9928, 9929, 9930, 9931, 9932, 9933, 9934,
+        9935, 9936, 9937, 9938, 9939, 9940, 9941, 9942, 9943, 9944, 9945, 9946, 9947, 9948, 9949, 9950,
+        9951, 9952, 9953, 9954, 9955, 9956, 9957, 9958, 9959, 9960, 9961, 9962, 9963, 9964, 9965, 9966,
+        9967, 9968, 9969, 9970, 9971, 9972, 9973, 9974, 9975, 9976, 9977, 9978, 9979, 9980, 9981, 9982,
+        9983, 9984, 9985, 9986, 9987, 9988, 9989, 9990, 9991, 9992, 9993, 9994, 9995, 9996, 9997, 9998,
+        9999, 10000, 10001, 10002, 10003, 10004, 10005, 10006, 10007, 10008, 10009, 10010, 10011, 10012, 10013, 10014,
+        10015, 10016, 10017, 10018, 10019, 10020, 10021, 10022, 10023, 10024, 10025, 10026, 10027, 10028, 10029, 10030,
+        10031, 10032, 10033, 10034, 10035, 10036, 10037, 10038, 10039, 10040, 10041, 10042, 10043, 10044, 10045, 10046,
+        10047, 10048, 10049, 10050, 10051, 10052, 10053, 10054, 10055, 10056, 10057, 10058, 10059, 10060, 10061, 10062,
+        10063, 10064, 10065, 10066, 10067, 10068, 10069, 10070, 10071, 10072, 10073, 10074, 10075, 10076, 10077, 10078,
+        10079, 10080, 10081, 10082, 10083, 10084, 10085, 10086, 10087, 10088, 10089, 10090, 10091, 10092, 10093, 10094,
+        10095, 10096, 10097, 10098, 10099, 10100, 10101, 10102, 10103, 10104, 10105, 10106, 10107, 10108, 10109, 10110,
+        10111, 10112, 10113, 10114, 10115, 10116, 10117, 10118, 10119, 10120, 10121, 10122, 10123, 10124, 10125, 10126,
+        10127, 10128, 10129, 10130, 10131, 10132, 10133, 10134, 10135, 10136, 10137, 10138, 10139, 10140, 10141, 10142,
+        10143, 10144, 10145, 10146, 10147, 10148, 10149, 10150, 10151, 10152, 10153, 10154, 10155, 10156, 10157, 10158,
+        10159, 10160, 10161, 10162, 10163, 10164, 10165, 10166, 10167, 10168, 10169, 10170, 10171, 10172, 10173, 10174,
+        10175, 10176, 10177, 10178, 10179, 10180, 10181, 10182, 10183, 10184, 10185, 10186, 10187, 10188, 10189, 10190,
+        10191, 10192, 10193, 10194, 10195, 10196, 10197, 10198, 10199, 10200, 10201, 10202, 10203, 10204, 10205, 10206,
+        10207, 10208, 10209, 10210, 10211, 10212, 10213, 10214, 10215, 10216, 10217, 10218, 10219, 10220, 10221, 10222,
+        10223, 10224, 10225, 10226, 10227, 10228, 10229, 10230, 10231, 10232, 10233, 10234, 10235, 10236, 10237, 10238,
+        10239, 10240, 10241, 10242, 10243, 10244, 10245, 10246, 10247, 10248, 10249, 10250, 10251, 10252, 10253, 10254,
+        10255, 10256, 10257, 10258, 10259, 10260, 10261, 10262, 10263, 10264, 10265, 10266, 10267, 10268, 10269, 10270,
+        10271, 10272, 10273, 10274, 10275, 10276, 10277, 10278, 10279, 10280, 10281, 10282, 10283, 10284, 10285, 10286,
+        10287, 10288, 10289, 10290, 10291, 10292, 10293, 10294, 10295, 10296, 10297, 10298, 10299, 10300, 10301, 10302,
+        10303, 10304, 10305, 10306, 10307, 10308, 10309, 10310, 10311, 10312, 10313, 10314, 10315, 10316, 10317, 10318,
+        10319, 10320, 10321, 10322, 10323, 10324, 10325, 10326, 10327, 10328, 10329, 10330, 10331, 10332, 10333, 10334,
+        10335, 10336, 10337, 10338, 10339, 10340, 10341, 10342, 10343, 10344, 10345, 10346, 10347, 10348, 10349, 10350,
+        10351, 10352, 10353, 10354, 10355, 10356, 10357, 10358, 10359, 10360, 10361, 10362, 10363, 10364, 10365, 10366,
+        10367, 10368, 10369, 10370, 10371, 10372, 10373, 10374, 10375, 10376, 10377, 10378, 10379, 10380, 10381, 10382,
+        10383, 10384, 10385, 10386, 10387, 10388, 10389, 10390, 10391, 10392, 10393, 10394, 10395, 10396, 10397, 10398,
+        10399, 10400, 10401, 10402, 10403, 10404, 10405, 10406, 10407, 10408, 10409, 10410, 10411, 10412, 10413, 10414,
+        10415, 10416, 10417, 10418, 10419, 10420, 10421, 10422, 10423, 10424, 10425, 10426, 10427, 10428, 10429, 10430,
+        10431, 10432, 10433, 10434, 10435, 10436, 10437, 10438, 10439, 10440, 10441, 10442, 10443, 10447, 10448, 10449,
+        10450, 10451, 10452, 10453, 10454, 10455, 10456, 10457, 10458, 10459, 10460, 10461, 10462, 10463, 10464, 10465,
+        10466, 10467, 10468, 10469, 10470, 10471, 10472, 10473, 10474, 10475, 10476, 10477, 10478, 10479, 10480, 10481,
+        10482, 10483, 10484, 10485, 10486, 10487, 10488, 10489, 10490, 10491, 10492, 10493, 10494, 10495, 10496, 10497,
+        10498, 10499, 10500, 10501, 10502, 10503, 10504, 10505, 10506, 10507, 10508, 10509, 10510, 10511, 10512, 10513,
+        10514, 10515, 10516, 10517, 10518, 10519, 10520, 10521, 10522, 10523, 10524, 10525, 10526, 10527, 10528, 10529,
+        10530, 10531, 10532, 10533, 10534, 10535, 10536, 10537, 10538, 10539, 10540, 10541, 10542, 10543, 10544, 10545,
+        10546, 10547, 10548, 10549, 10550, 10553, 10555, 10558, 10559, 10560, 10561, 10562, 10563, 10564, 10565, 10566,
+        10567, 10568, 10569, 10570, 10571, 10572, 10573, 10574, 10575, 10576, 10577, 10578, 10579, 10580, 10581, 10582,
+        10583, 10584, 10585, 10586, 10587, 10588, 10589, 10590, 10591, 10592, 10593, 10594, 10595, 10596, 10597, 10598,
+        10599, 10600, 10601, 10602, 10603, 10604, 10605, 10606, 10607, 10608, 10609, 10610, 10611, 10612, 10613, 10614,
+        10615, 10616, 10617, 10618, 10619, 10620, 10621, 10622, 10623, 10624, 10625, 10626, 10627, 10628, 10629, 10630,
+        10631, 10632, 10633, 10634, 10635, 10636, 10637, 10638, 10639, 10640, 10641, 10642, 10643, 10644, 10645, 10646,
+        10647, 10648, 10649, 10650, 10651, 10652, 10653, 10654, 10655, 10656, 10657, 10658, 10659, 10661, 10662, 10663,
+        10664, 10665, 10666, 10667, 10668, 10669, 10670, 10671, 10672, 10673, 10674, 10675, 10676, 10677, 10678, 10679,
+        10680, 10681, 10682, 10683, 10684, 10685, 10686, 10687, 10688, 10689, 10690, 10691, 10692, 10693, 10694, 10695,
+        10696, 10697, 10698, 10699, 10700, 10701, 10702, 10703, 10704, 10705, 10706, 10707, 10708, 10709, 10710, 10711,
+        10712, 10713, 10714, 10715, 10716, 10717, 10718, 10719, 10720, 10721, 10722, 10723, 10724, 10725, 10726, 10727,
+        10728, 10729, 10730, 10731, 10732, 10733, 10734, 10735, 10736, 10737, 10738, 10739, 10740, 10741, 10742, 10743,
+        10744, 10745, 10746, 10747, 10748, 10749, 10750, 10751, 10752, 10753, 10754, 10755, 10756, 10757, 10758, 10759,
+        10760, 10761, 10762, 10763, 10764, 10765, 10766, 10767, 10768, 10769, 10770, 10771, 10772, 10773, 10774, 10775,
+        10776, 10777, 10778, 10779, 10780, 10781, 10782, 10783, 10784, 10785, 10786, 10787, 10788, 10789, 10790, 10791,
+        10792, 10793, 10794, 10795, 10796, 10797, 10798, 10799, 10800, 10801, 10802, 10803, 10804, 10805, 10806, 10807,
+        10808, 10809, 10810, 10811, 0, 0, 10812, 10813, 10814, 10815, 10816, 10817, 10818, 10819, 10820, 10821,
+        10822, 10823, 10824, 10825, 10826, 10827, 10828, 10829, 10830, 10831, 10832, 10833, 10834, 10835, 10836, 10837,
+        10838, 10839, 10840, 10841, 10842, 10843, 0, 10844, 10845, 10846, 10847, 10848, 10849, 10850, 10851, 10852,
+        10853, 10854, 10855, 10856, 10857, 10858, 10859, 10860, 10861, 10862, 10863, 10864, 10865, 10866, 10867, 10868,
+        10869, 10870, 10871, 10872, 10873, 10874, 10875, 10876, 10877, 10878, 10879, 10880, 10881, 10882, 10883, 10884,
+        10885, 10886, 10887, 10888, 10889, 10890, 10891, 10892, 10893, 10894, 10895, 10896, 10897, 10898, 10899, 10900,
+        10901, 10902, 10903, 10904, 10905, 10906, 10907, 10908, 10909, 10910, 10911, 10912, 10913, 10914, 10915, 10916,
+        10917, 10918, 10919, 10920, 10921, 10922, 10923, 10924, 10925, 10926, 10927, 10928, 10929, 10930, 10931, 10932,
+        10933, 10934, 10935, 10936, 10937, 10938, 10939, 10940, 10941, 10942, 10943, 10944, 10945, 10946, 10947, 10948,
+        10949, 10950, 10951, 10952, 10953, 10954, 10955, 10956, 10957, 10958, 10959, 10960, 10961, 10962, 10963, 10964,
+        10965, 10966, 10967, 10968, 10969, 10970, 10971, 10972, 10973, 10974, 10975, 10976, 10977, 10978, 10979, 10980,
+        10981, 10982, 10983, 10984, 10985, 10986, 10987, 10988, 10989, 10990, 10991, 10992, 10993, 10994, 10995, 0,
+        10996, 10997, 10998, 10999, 11000, 11001, 11002, 11003, 11004, 11005, 11006, 11007, 11008, 11009, 11010, 11011,
+        11012, 11013, 11014, 11015, 11016, 11017, 11018, 11019, 11020, 11021, 11022, 11023, 11024, 11025, 11026, 11027,
+        11028, 11029, 11030, 11031, 11032, 11033, 11034, 11035, 11036, 11037, 11038, 11039, 11040, 11041, 11042, 0,
+        11043, 11044, 11045, 11046, 11047, 11048, 11049, 11050, 11051, 11052, 11053, 11054, 11055, 11056, 11057, 11058,
+        11059, 11060, 11061, 11062, 11063, 11064, 11065, 11066, 11067, 11068, 11069, 11070, 11071, 11072, 11073, 11074,
+        11075, 11076, 11077, 11078, 11079, 11080, 11081, 11082, 11083, 11084, 11085, 11086, 11087, 11088, 11089, 11090,
+        11091, 11092, 11093, 11094, 11095, 11096, 11097, 11098, 11099, 11100, 11101, 11102, 11103, 11104, 11105, 11106,
+        11107, 11108, 11109, 11110, 11111, 11112, 11113, 11114, 11115, 11116, 11117, 11118, 11119, 11120, 11121, 11122,
+        11123, 11124, 11125, 11126, 11127, 11128, 11129, 11130, 11131, 11132, 11133, 11134, 11135, 11136, 11137, 11138,
+        11139, 11140, 11141, 11142, 11143, 11144, 11145, 11146, 11147, 11148, 11149, 11150, 11151, 11152, 11153, 11154,
+        11155, 11156, 11157, 11158, 11159, 11160, 11161, 11162, 11163, 11164, 11165, 11166, 11167, 11168, 11169, 11170,
+        11171, 11172, 11173, 11174, 11175, 11178, 11179, 11180, 11181, 11182, 11183, 11184, 11185, 11186, 11187, 1063,
+        1068, 1067, 11188, 11189, 0, 0, 0, 0, 0, 11190, 11191, 11192, 11193, 11194, 11195, 11196,
+        11197, 11198, 11199, 11200, 11201, 11202, 11203, 11204, 11205, 11206, 11207, 11208, 11209, 11210, 11211, 11212,
+        11213, 11214, 11215, 11216, 11217, 11218, 11219, 11220, 11221, 11222, 11223, 11224, 11225, 11226, 11227, 11228,
+        11229, 11230, 11231, 11232, 11233, 11234, 0, 11235, 0, 0, 0, 0, 0, 11236, 0, 0,
+        11237, 11238, 11239, 11240, 11241, 11242, 11243, 11244, 11245, 11246, 11247, 11248, 11249, 11250, 11251, 11252,
+        11253, 11254, 11255, 11256, 11257, 11258, 11259, 11260, 11261, 11262, 11263, 11264, 11265, 11266, 11267, 11268,
+        11269, 11270, 11271, 11272, 11273, 11274, 11275, 11276, 11277, 11278, 11279, 11280, 11281, 11282, 11283, 11284,
+        11285, 11286, 11287, 11288, 11289, 11290, 11291, 11292, 0, 0, 0, 0, 0, 0, 0, 11293,
+        11294, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+        11295, 11296, 11297, 11298, 11299, 11300, 11301, 11302, 11303, 11304, 11305, 11306, 11307, 11308, 11309, 11310,
+        11311, 11312, 11313, 11314, 11315, 11316, 11317, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        11318, 11319, 11320, 11321, 11322, 11323, 11324, 0, 11325, 11326, 11327, 11328, 11329, 11330, 11331, 0,
+        11332, 11333, 11334, 11335, 11336, 11337, 11338, 0, 11339, 11340, 11341, 11342, 11343, 11344, 11345, 0,
+        11346, 11347, 11348, 11349, 11350, 11351, 11352, 0, 11353, 11354, 11355, 11356, 11357, 11358, 11359, 0,
+        11360, 11361, 11362, 11363, 11364, 11365, 11366, 0, 11367, 11368, 11369, 11370, 11371, 11372, 11373, 0,
+        11374, 6302, 11375, 6303, 11376, 11377, 11378, 11379, 11380, 11381, 6304, 11382, 11383, 6305, 6306, 11384,
+        11385, 11386, 11387, 11388, 11389, 11390, 11392, 11393, 11394, 6309, 6308, 11395, 11396, 11397, 11398, 11399,
+        11400, 11401, 11402, 11403, 11404, 11405, 11406, 11407, 11408, 11409, 11410, 11411, 11412, 11413, 11414, 11415,
+        11416, 11417, 11418, 11419, 11420, 11421, 11422, 11423, 11424, 11425, 11426, 11427, 11428, 11429, 11430, 11431,
+        11432, 11433, 11434, 11435, 11436, 11437, 11438, 11439, 11440, 11441, 11442, 11443, 11444, 11445, 11446, 11447,
+        11448, 11449, 11450, 11451, 11452, 11453, 11454, 11455, 11456, 11457, 11458, 11459, 11460, 11461, 11462, 11463,
+        11464, 11465, 11466, 11467, 11468, 11469, 11470, 11471, 11472, 11473, 11474, 11475, 11476, 11477, 11478, 11479,
+        11480, 11481, 11482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        11483, 11486, 11489, 11491, 11493, 11496, 11498, 11501, 11504, 11507, 11509, 11512, 11515, 11518, 11521, 11524,
+        11526, 11528, 11531, 11533, 11535, 11537, 11540, 11542, 11545, 11547, 0, 11549, 11551, 11554, 11557, 11560,
+        11562, 11564, 11566, 11568, 11570, 11572, 11575, 11577, 11580, 11582, 11585, 11588, 11591, 11594, 11596, 11599,
+        11601, 11603, 11605, 11607, 11610, 11613, 11616, 11619, 11622, 11624, 11626, 11628, 11631, 11634, 11637, 11639,
+        11642, 11645, 11647, 11649, 11651, 11653, 11655, 11657, 11660, 11662, 11664, 11667, 11669, 11671, 11674, 11677,
+        11680, 11682, 11684, 11686, 11688, 11690, 11693, 11695, 11698, 11700, 11702, 11704, 11706, 11708, 11710, 11713,
+        11715, 11717, 11720, 11722, 11725, 11728, 11730, 11732, 11735, 11737, 11739, 11741, 11744, 11746, 11749, 11751,
+        11754, 11756, 11759, 11762, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        11764, 11766, 11768, 11770, 11772, 11774, 11776, 11778, 11780, 11782, 11784, 11786, 11788, 11790, 11792, 11794,
+        11796, 11798, 11800, 11802, 11804, 11806, 11808, 11810, 11812, 11814, 11816, 11818, 11820, 11822, 11824, 11826,
+        11828, 11830, 11832, 11834, 11836, 11838, 11840, 11842, 11844, 11846, 11526, 11848, 11850, 11852, 11854, 11856,
+        11858, 11860, 11862, 11533, 11864, 11866, 11868, 11870, 11872, 11874, 11876, 11878, 11880, 11882, 11884, 11886,
+        11888, 11890, 11892, 11894, 11896, 11898, 11900, 11902, 11904, 11906, 11908, 11910, 11912, 11914, 11916, 11918,
+        11920, 11922, 11924, 11926, 11928, 11930, 11932, 11934, 11936, 11938, 11940, 11942, 11944, 11946, 11948, 11950,
+        11952, 11954, 11956, 11958, 11960, 11962, 11964, 11966, 11968, 11970, 11972, 11974, 11976, 11978, 11980, 11982,
+        11984, 11986, 11988, 11990, 11992, 11994, 11996, 11998, 12000, 12002, 12004, 12006, 12008, 12010, 12012, 12014,
+        12016, 12018, 12020, 12022, 12024, 12026, 12028, 12030, 12032, 12034, 12036, 12038, 12040, 12042, 12044, 12046,
+        12048, 12050, 12052, 11655, 12054, 12056, 12058, 12060, 12062, 12064, 12066, 12068, 12070, 12072, 12074, 12076,
+        12078, 12080, 12082, 12084, 12086, 12088, 12090, 11682, 12092, 12094, 12096, 12098, 12100, 12102, 12104, 12106,
+        12108, 12110, 12112, 12114, 12116, 12118, 12120, 11708, 12122, 12124, 12126, 12128, 12130, 12132, 12134, 12136,
+        12138, 12140, 12142, 12144, 12146, 12148, 12150, 12152, 12154, 12156, 12158, 12160, 12162, 12164, 12166, 12168,
+        12170, 12172, 12174, 12176, 12178, 12180, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        12182, 12183, 12184, 12185, 12186, 12187, 12188, 12189, 12190, 12191, 12192, 12193, 0, 0, 0, 0,
+        12194, 12195, 12196, 12197, 12198, 12199, 12200, 23, 8632, 8633, 12202, 12203, 12204, 12205, 12206, 12207,
+        12208, 12209, 12210, 12211, 12212, 12213, 12214, 12215, 12216, 12217, 12218, 12219, 12220, 12221, 12222, 12223,
+        12224, 24, 25, 26, 27, 28, 29, 30, 31, 32, 12225, 12226, 12227, 12228, 12229, 12230,
+        12231, 12232, 12233, 12235, 12236, 12238, 12239, 12240, 11810, 12241, 12243, 12245, 12246, 12248, 12249, 12250,
+        0, 12251, 12252, 12253, 12254, 12255, 12256, 12257, 12258, 12259, 12260, 12261, 12262, 12264, 12265, 12267,
+        12268, 12270, 12271, 12273, 12274, 12276, 12277, 12279, 12280, 12282, 12283, 12285, 12286, 12288, 12289, 12291,
+        12292, 12294, 12295, 12297, 12298, 12299, 12301, 12302, 12304, 12305, 12307, 12308, 12309, 12310, 12311, 12312,
+        12313, 12315, 12317, 12318, 12320, 12322, 12323, 12325, 12327, 12328, 12330, 12332, 12333, 12335, 12337, 12338,
+        12339, 12340, 12341, 12342, 12343, 12344, 12345, 12346, 12347, 12348, 12349, 12350, 12351, 12352, 12353, 12354,
+        12355, 12356, 12357, 12358, 12359, 12361, 12362, 0, 0, 12363, 12364, 12365, 12366, 12367, 12368, 12370,
+        12372, 12373, 12374, 12375, 12376, 12377, 12378, 12379, 12380, 12381, 12382, 12383, 12384, 12386, 12387, 12389,
+        12390, 12392, 12393, 12395, 12396, 12398, 12399, 12401, 12402, 12404, 12405, 12407, 12408, 12410, 12411, 12413,
+        12414, 12416, 12417, 12419, 12420, 12421, 12423, 12424, 12426, 12427, 12429, 12430, 12431, 12432, 12433, 12434,
+        12435, 12437, 12439, 12440, 12442, 12444, 12445, 12447, 12449, 12450, 12452, 12454, 12455, 12457, 12459, 12460,
+        12461, 12462, 12463, 12464, 12465, 12466, 12467, 12468, 12469, 12470, 12471, 12472, 12473, 12474, 12475, 12476,
+        12477, 12478, 12479, 12480, 12481, 12483, 12484, 12485, 12487, 12489, 12491, 12493, 12494, 12495, 12496, 12498,
+        0, 0, 0, 0, 0, 12500, 12501, 12502, 12503, 12504, 12505, 12506, 12507, 12508, 12509, 12510,
+        12511, 12512, 12513, 12514, 12515, 12516, 12517, 12518, 12519, 12520, 12521, 12522, 12523, 12524, 12525, 12526,
+        12527, 12528, 12529, 12530, 12531, 12532, 12533, 12534, 12535, 12536, 12537, 12538, 12539, 12540, 12541, 12542,
+        0, 12543, 12544, 12545, 12546, 12547, 12548, 12549, 12550, 12551, 12552, 12553, 12554, 12555, 12556, 12557,
+        12558, 12559, 12560, 12561, 12562, 12563, 12564, 12565, 12566, 12567, 12568, 12569, 12570, 12571, 12572, 12573,
+        12574, 12575, 12576, 12577, 12578, 12579, 12580, 12581, 12582, 12583, 12584, 12585, 12586, 12587, 12588, 12589,
+        12590, 12591, 12592, 12593, 12594, 12595, 12596, 12597, 12598, 12599, 12600, 12601, 12602, 12603, 12604, 12605,
+        12606, 12607, 12608, 12609, 12610, 12611, 12612, 12613, 12614, 12615, 12616, 12617, 12618, 12619, 12620, 12621,
+        12622, 12623, 12624, 12625, 12626, 12627, 12628, 12629, 12630, 12631, 12632, 12633, 12634, 12635, 12636, 0,
+        12637, 12638, 12639, 12641, 12643, 12645, 12647, 12649, 12651, 12653, 12655, 12657, 12659, 12661, 12663, 12665,
+        12667, 12669, 12671, 12673, 12675, 12676, 12678, 12679, 12681, 12683, 12685, 12687, 12689, 12690, 12691, 12693,
+        12695, 12696, 12697, 12698, 12700, 12701, 12702, 12703, 12704, 12705, 12706, 12707, 12708, 12709, 12710, 12711,
+        12712, 12713, 12714, 12715, 12716, 12717, 12718, 12719, 12720, 12721, 12722, 12723, 12724, 12725, 12726, 12727,
+        12728, 12729, 12730, 12731, 12732, 12733, 12734, 12735, 12736, 12737, 12738, 12739, 12740, 12741, 12742, 12743,
+        12744, 12745, 12746, 12747, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        12748, 12749, 12750, 12751, 12752, 12753, 12754, 12755, 12756, 12757, 12758, 12759, 12760, 12761, 12762, 12763,
+        12764, 12767, 12770, 12773, 12776, 12779, 12782, 12785, 12788, 12791, 12794, 12797, 12800, 12803, 12806, 12810,
+        12814, 12818, 12822, 12826, 12830, 12834, 12838, 12842, 12846, 12850, 12854, 12858, 12862, 12866, 12873, 0,
+        12879, 12883, 12887, 12891, 12895, 12899, 12903, 12907, 12911, 12915, 12919, 12923, 12927, 12931, 12935, 12939,
+        12943, 12947, 12951, 12955, 12959, 12963, 12967, 12971, 12975, 12979, 12983, 12987, 12991, 12995, 12999, 13003,
+        13007, 13011, 13015, 13019, 13023, 13025, 13027, 13029, 8906, 8926, 13031, 13033, 13035, 13037, 13039, 13041,
+        13043, 13046, 13048, 13050, 13052, 13054, 13056, 13058, 13060, 13062, 13031, 13064, 13066, 13068, 13070, 13072,
+        13074, 13075, 13076, 13077, 13078, 13079, 13080, 13081, 13082, 13083, 13084, 13085, 13086, 13087, 13088, 13090,
+        13092, 13094, 13096, 13098, 13100, 13102, 13104, 13106, 13108, 13110, 13112, 13114, 13116, 13121, 13125, 13127,
+        13128, 13130, 13132, 13134, 13136, 13138, 13140, 13142, 13144, 13146, 13148, 13150, 13152, 13154, 13156, 13158,
+        13160, 13162, 13164, 13166, 13168, 13170, 13172, 13174, 13176, 13178, 13180, 13182, 13184, 13186, 13188, 13190,
+        13192, 13194, 13196, 13198, 13200, 13202, 13204, 13206, 13208, 13210, 13212, 13214, 13216, 13218, 13220, 13222,
+        13224, 13226, 13228, 13230, 13232, 13033, 13234, 13236, 13238, 13240, 13242, 13244, 13246, 13248, 13250, 13035,
+        13252, 13255, 13258, 13261, 13264, 13267, 13270, 13273, 13276, 13279, 13283, 13287, 13291, 13293, 13296, 13298,
+        13301, 13302, 13303, 13304, 13305, 13306, 13307, 13308, 13309, 13310, 13311, 13312, 13313, 13314, 13315, 13316,
+        13317, 13318, 13319, 13320, 13321, 13322, 13323, 13324, 13325, 13326, 13327, 13328, 13329, 13330, 13331, 13332,
+        13333, 13334, 13335, 13336, 13337, 13338, 13339, 13340, 13341, 13342, 13343, 13344, 13345, 13346, 13347, 13348,
+        13352, 13357, 13361, 13366, 13369, 13374, 13377, 13380, 13386, 13390, 13393, 13396, 13399, 13403, 13407, 13411,
+        13415, 13419, 13423, 13427, 13433, 13435, 13441, 13447, 13452, 13456, 13462, 13468, 13472, 13475, 13478, 13482,
+        13486, 13491, 13496, 13499, 13502, 13506, 13509, 13512, 13514, 13516, 13519, 13522, 13528, 13532, 13537, 13543,
+        13547, 13550, 13553, 13559, 13563, 13569, 13572, 13577, 13580, 13584, 13587, 13591, 13596, 13600, 13605, 13609,
+        13611, 13616, 13619, 13622, 13626, 13629, 13632, 13635, 13640, 13644, 13646, 13652, 13655, 13660, 13664, 13668,
+        13671, 13674, 13678, 13680, 13684, 13689, 13691, 13697, 13700, 13703, 13706, 13709, 13712, 13715, 13718, 13721,
+        13724, 13727, 13730, 13734, 13738, 13742, 13746, 13750, 13754, 13758, 13762, 13766, 13770, 13774, 13778, 13782,
+        13786, 13790, 13793, 13795, 13797, 13800, 13802, 13804, 13806, 13809, 13812, 13814, 13818, 13822, 13826, 13830,
+        13838, 13840, 13842, 13844, 13846, 13848, 13850, 13852, 13854, 13857, 13861, 13863, 13865, 13867, 13869, 13871,
+        13873, 13875, 13878, 13881, 13884, 13887, 13889, 13891, 13893, 13895, 13897, 13899, 13901, 13903, 13905, 13907,
+        13910, 13913, 13915, 13918, 13921, 13924, 13926, 13929, 13932, 13936, 13938, 13941, 13944, 13947, 13950, 13955,
+        13961, 13963, 13965, 13967, 13969, 13971, 13973, 13975, 13977, 13979, 13981, 13983, 13985, 13987, 13989, 13991,
+        13993, 13995, 13997, 14001, 14003, 14005, 14007, 14011, 14014, 14016, 14018, 14020, 14022, 14024, 14026, 14028,
+        14030, 14032, 14034, 14037, 14039, 14041, 14044, 14047, 14049, 14053, 14056, 14058, 14060, 14062, 14064, 14067,
+        14070, 14073, 14076, 14079, 14082, 14085, 14088, 14091, 14094, 14097, 14101, 14105, 14109, 14113, 14117, 14121,
+        14125, 14129, 14133, 14137, 14141, 14145, 14149, 14153, 14157, 14161, 14165, 14169, 14173, 14177, 14181, 14185,
+        14188, 14189, 14190, 14191, 14192, 14193, 14194, 14195, 14196, 14197, 14198, 14199, 14200, 14201, 14202, 14203,
+        14204, 14205, 14206, 14207, 14208, 14209, 14210, 14211, 14212, 14213, 14214, 14215, 14216, 14217, 14218, 14219,
+        14220, 14221, 14222, 14223, 14224, 14225, 14226, 14227, 14228, 14229, 14230, 14231, 14232, 14233, 14234, 14235,
+        14236, 14237, 14238, 14239, 14240, 14241, 14242, 14243, 14244, 14245, 14246, 14247, 14248, 14249, 14250, 14251,
+        14252, 14253, 14254, 14255, 14256, 14257, 14258, 14259, 14260, 14261, 14262, 14263, 14264, 14265, 14266, 14267,
+        14268, 14269, 14270, 14271, 14272, 14273, 14274, 14275, 14276, 14277, 14278, 14279, 14280, 14281, 14282, 14283,
+        14284, 14285, 14286, 14287, 14288, 14289, 14290, 14291, 14292, 14293, 14294, 14295, 14296, 14297, 14298, 14299,
+        14300, 14301, 14302, 14303, 14304, 14305, 14306, 14307, 14308, 14309, 14310, 14311, 14312, 14313, 14314, 14315,
+        14316, 14317, 14318, 14319, 14320, 14321, 14322, 14323, 14324, 14325, 14326, 14327, 14328, 14329, 14330, 14331,
+        14332, 14333, 14334, 14335, 14336, 14337, 14338, 14339, 14340, 14341, 14342, 14343, 14344, 14345, 14346, 14347,
+        14348, 14349, 14350, 14351, 14352, 14353, 14354, 14355, 14356, 14357, 14358, 14359, 14360, 14361, 14362, 14363,
+        14364, 14365, 14366, 14367, 14368, 14369, 14370, 14371, 14372, 14373, 14374, 14375, 14376, 14377, 14378, 14379,
+        14380, 14381, 14382, 14383, 14384, 14385, 14386, 14387, 14388, 14389, 14390, 14391, 14392, 14393, 14394, 14395,
+        14396, 14397, 14398, 14399, 14400, 14401, 14402, 14403, 14404, 14405, 14406, 14407, 14408, 14409, 14410, 14411,
+        14412, 14413, 14414, 14415, 14416, 14417, 14418, 14419, 14420, 14421, 14422, 14423, 14424, 14425, 14426, 14427,
+        14428, 14429, 14430, 14431, 14432, 14433, 14434, 14435, 14436, 14437, 14438, 14439, 14440, 14441, 14442, 14443,
+        14444, 14445, 14446, 14447, 14448, 14449, 14450, 14451, 14452, 14453, 14454, 14455, 14456, 14457, 14458, 14459,
+        14460, 14461, 14462, 14463, 14464, 14465, 14466, 14467, 14468, 14469, 14470, 14471, 14472, 14473, 14474, 14475,
+        14476, 14477, 14478, 14479, 14480, 14481, 14482, 14483, 14484, 14485, 14486, 14487, 14488, 14489, 14490, 14491,
+        14492, 14493, 14494, 14495, 14496, 14497, 14498, 14499, 14500, 14501, 14502, 14503, 14504, 14505, 14506, 14507,
+        14508, 14509, 14510, 14511, 14512, 14513, 14514, 14515, 14516, 14517, 14518, 14519, 14520, 14521, 14522, 14523,
+        14524, 14525, 14526, 14527, 14528, 14529, 14530, 14531, 14532, 14533, 14534, 14535, 14536, 14537, 14538, 14539,
+        14540, 14541, 14542, 14543, 14544, 14545, 14546, 14547, 14548, 14549, 14550, 14551, 14552, 14553, 14554, 14555,
+        14556, 14557, 14558, 14559, 14560, 14561, 14562, 14563, 14564, 14565, 14566, 14567, 14568, 14569, 14570, 14571,
+        14572, 14573, 14574, 14575, 14576, 14577, 14578, 14579, 14580, 14581, 14582, 14583, 14584, 14585, 14586, 14587,
+        14588, 14589, 14590, 14591, 14592, 14593, 14594, 14595, 14596, 14597, 14598, 14599, 14600, 14601, 14602, 14603,
+        14604, 14605, 14606, 14607, 14608, 14609, 14610, 14611, 14612, 14613, 14614, 14615, 14616, 14617, 14618, 14619,
+        14620, 14621, 14622, 14623, 14624, 14625, 14626, 14627, 14628, 14629, 14630, 14631, 14632, 14633, 14634, 14635,
+        14636, 14637, 14638, 14639, 14640, 14641, 14642, 14643, 14644, 14645, 14646, 14647, 14648, 14649, 14650, 14651,
+        14652, 14653, 14654, 14655, 14656, 14657, 14658, 14659, 14660, 14661, 14662, 14663, 14664, 14665, 14666, 14667,
+        14668, 14669, 14670, 14671, 14672, 14673, 14674, 14675, 14676, 14677, 14678, 14679, 14680, 14681, 14682, 14683,
+        14684, 14685, 14686, 14687, 14688, 14689, 14690, 14691, 14692, 14693, 14694, 14695, 14696, 14697, 14698, 14699,
+        14700, 14701, 14702, 14703, 14704, 14705, 14706, 14707, 14708, 14709, 14710, 14711, 14712, 14713, 14714, 14715,
+        14716, 14717, 14718, 14719, 14720, 14721, 14722, 14723, 14724, 14725, 14726, 14727, 14728, 14729, 14730, 14731,
+        14732, 14733, 14734, 14735, 14736, 14737, 14738, 14739, 14740, 14741, 14742, 14743, 14744, 14745, 14746, 14747,
+        14748, 14749, 14750, 14751, 14752, 14753, 14754, 14755, 14756, 14757, 14758, 14759, 14760, 14761, 14762, 14763,
+        14764, 14765, 14766, 14767, 14768, 14769, 14770, 14771, 14772, 14773, 14774, 14775, 14776, 14777, 14778, 14779,
+        14780, 14781, 14782, 14783, 14784, 14785, 14786, 14787, 14788, 14789, 14790, 14791, 14792, 14793, 14794, 14795,
+        14796, 14797, 14798, 14799, 14800, 14801, 14802, 14803, 14804, 14805, 14806, 14807, 14808, 14809, 14810, 14811,
+        14812, 14813, 14814, 14815, 14816, 14817, 14818, 14819, 14820, 14821, 14822, 14823, 14824, 14825, 14826, 14827,
+        14828, 14829, 14830, 14831, 14832, 14833, 14834, 14835, 14836, 14837, 14838, 14839, 14840, 14841, 14842, 14843,
+        14844, 14845, 14846, 14847, 14848, 14849, 14850, 14851, 14852, 14853, 14854, 14855, 14856, 14857, 14858, 14859,
+        14860, 14861, 14862, 14863, 14864, 14865, 14866, 14867, 14868, 14869, 14870, 14871, 14872, 14873, 14874, 14875,
+        14876, 14877, 14878, 14879, 14880, 14881, 14882, 14883, 14884, 14885, 14886, 14887, 14888, 14889, 14890, 14891,
+        14892, 14893, 14894, 14895, 14896, 14897, 14898, 14899, 14900, 14901, 14902, 14903, 14904, 14905, 14906, 14907,
+        14908, 14909, 14910, 14911, 14912, 14913, 14914, 14915, 14916, 14917, 14918, 14919, 14920, 14921, 14922, 14923,
+        14924, 14925, 14926, 14927, 14928, 14929, 14930, 14931, 14932, 14933, 14934, 14935, 14936, 14937, 14938, 14939,
+        14940, 14941, 14942, 14943, 14944, 14945, 14946, 14947, 14948, 14949, 14950, 14951, 14952, 14953, 14954, 14955,
+        14956, 14957, 14958, 14959, 14960, 14961, 14962, 14963, 14964, 14965, 14966, 14967, 14968, 14969, 14970, 14971,
+        14972, 14973, 14974, 14975, 14976, 14977, 14978, 14979, 14980, 14981, 14982, 14983, 14984, 14985, 14986, 14987,
+        14988, 14989, 14990, 14991, 14992, 14993, 14994, 14995, 14996, 14997, 14998, 14999, 15000, 15001, 15002, 15003,
+        15004, 15005, 15006, 15007, 15008, 15009, 15010, 15011, 15012, 15013, 15014, 15015, 15016, 15017, 15018, 15019,
+        15020, 15021, 15022, 15023, 15024, 15025, 15026, 15027, 15028, 15029, 15030, 15031, 15032, 15033, 15034, 15035,
+        15036, 15037, 15038, 15039, 15040, 15041, 15042, 15043, 15044, 15045, 15046, 15047, 15048, 15049, 15050, 15051,
+        15052, 15053, 15054, 15055, 15056, 15057, 15058, 15059, 15060, 15061, 15062, 15063, 15064, 15065, 15066, 15067,
+        15068, 15069, 15070, 15071, 15072, 15073, 15074, 15075, 15076, 15077, 15078, 15079, 15080, 15081, 15082, 15083,
+        15084, 15085, 15086, 15087, 15088, 15089, 15090, 15091, 15092, 15093, 15094, 15095, 15096, 15097, 15098, 15099,
+        15100, 15101, 15102, 15103, 15104, 15105, 15106, 15107, 15108, 15109, 15110, 15111, 15112, 15113, 15114, 15115,
+        15116, 15117, 15118, 15119, 15120, 15121, 15122, 15123, 15124, 15125, 15126, 15127, 15128, 15129, 15130, 15131,
+        15132, 15133, 15134, 15135, 15136, 15137, 15138, 15139, 15140, 15141, 15142, 15143, 15144, 15145, 15146, 15147,
+        15148, 15149, 15150, 15151, 15152, 15153, 15154, 15155, 15156, 15157, 15158, 15159, 15160, 15161, 15162, 15163,
+        15164, 15165, 15166, 15167, 15168, 15169, 15170, 15171, 15172, 15173, 15174, 15175, 15176, 15177, 15178, 15179,
+        15180, 15181, 15182, 15183, 15184, 15185, 15186, 15187, 15188, 15189, 15190, 15191, 15192, 15193, 15194, 15195,
+        15196, 15197, 15198, 15199, 15200, 15201, 15202, 15203, 15204, 15205, 15206, 15207, 15208, 15209, 15210, 15211,
+        15212, 15213, 15214, 15215, 15216, 15217, 15218, 15219, 15220, 15221, 15222, 15223, 15224, 15225, 15226, 15227,
+        15228, 15229, 15230, 15231, 15232, 15233, 15234, 15235, 15236, 15237, 15238, 15239, 15240, 15241, 15242, 15243,
+        15244, 15245, 15246, 15247, 15248, 15249, 15250, 15251, 15252, 15253, 15254, 15255, 15256, 15257, 15258, 15259,
+        15260, 15261, 15262, 15263, 15264, 15265, 15266, 15267, 15268, 15269, 15270, 15271, 15272, 15273, 15274, 15275,
+        15276, 15277, 15278, 15279, 15280, 15281, 15282, 15283, 15284, 15285, 15286, 15287, 15288, 15289, 15290, 15291,
+        15292, 15293, 15294, 15295, 15296, 15297, 15298, 15299, 15300, 15301, 15302, 15303, 15304, 15305, 15306, 15307,
+        15308, 15309, 15310, 15311, 15312, 15313, 15314, 15315, 15316, 15317, 15318, 15319, 15320, 15321, 15322, 15323,
+        15324, 15325, 15326, 15327, 15328, 15329, 15330, 15331, 15332, 15333, 15334, 15335, 15336, 15337, 15338, 15339,
+        15340, 15341, 15342, 15343, 15344, 15345, 15346, 15347, 15348, 15349, 15350, 15351, 15352, 15353, 15354, 15355,
+        15356, 15357, 15358, 15359, 15360, 15361, 15362, 15363, 15364, 15365, 15366, 15367, 15368, 15369, 15370, 15371,
+        15372, 15373, 15374, 15375, 15376, 15377, 15378, 15379, 15380, 15381, 15382, 15383, 15384, 15385, 15386, 15387,
+        15388, 15389, 15390, 15391, 15392, 15393, 15394, 15395, 15396, 15397, 15398, 15399, 15400, 15401, 15402, 15403,
+        15404, 15405, 15406, 15407, 15408, 15409, 15410, 15411, 15412, 15413, 15414, 15415, 15416, 0, 0, 0,
+        15417, 15418, 15419, 15420, 15421, 15422, 15423, 15424, 15425, 15426, 15427, 15428, 15429, 15430, 15431, 15432,
+        15433, 15434, 15435, 15436, 15437, 15438, 15439, 15440, 15441, 15442, 15443, 15444, 15445, 15446, 15447, 15448,
+        15449, 15450, 15451, 15452, 15453, 15454, 15455, 15456, 15457, 15458, 15459, 15460, 15461, 15462, 15463, 15464,
+        15465, 15466, 15467, 15468, 15469, 15470, 15471, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        15472, 15473, 15474, 15475, 15476, 15477, 15478, 15479, 15480, 15481, 15482, 15483, 15484, 15485, 15486, 15487,
+        15488, 15489, 15490, 15491, 15492, 15493, 15494, 15495, 15496, 15497, 15498, 15499, 15500, 15501, 15502, 15503,
+        15504, 15505, 15506, 15507, 15508, 15509, 15510, 15511, 15512, 15513, 15514, 15515, 15516, 15517, 15518, 15519,
+        15520, 15521, 15522, 15523, 15524, 15525, 15526, 15527, 15528, 15529, 15530, 15531, 15532, 15533, 15534, 15535,
+        15536, 15537, 15538, 15539, 15540, 15541, 15542, 15543, 15544, 15545, 15546, 15547, 15548, 15549, 15550, 15551,
+        15552, 15553, 15554, 15555, 15556, 15557, 15558, 15559, 15560, 15561, 15562, 15563, 15564, 15565, 15566, 15567,
+        15568, 15569, 15570, 15571, 15572, 15573, 15574, 15575, 15576, 15577, 15578, 15579, 15580, 15581, 15582, 15583,
+        15584, 15585, 15586, 15587, 15588, 15589, 15590, 15591, 15592, 15593, 15594, 15595, 15596, 15597, 15598, 15599,
+        15600, 15601, 15602, 15603, 15604, 15605, 15606, 15607, 15608, 15609, 15610, 15611, 15612, 15613, 15614, 15615,
+        15616, 15617, 15618, 15619, 15620, 15621, 15622, 15623, 15624, 15625, 15626, 15627, 15628, 15629, 15630, 15631,
+        15632, 15633, 15634, 15635, 15636, 15637, 15638, 15639, 15640, 15641, 15642, 15643, 15644, 15645, 15646, 15647,
+        15648, 15649, 15650, 15651, 15652, 15653, 15654, 15655, 15656, 15657, 15658, 15659, 15660, 15661, 15662, 15663,
+        15664, 15665, 15666, 15667, 15668, 15669, 15670, 15671, 15672, 15673, 15674, 15675, 15676, 15677, 15678, 15679,
+        15680, 15681, 15682, 15683, 15684, 15685, 15686, 15687, 15688, 15689, 15690, 15691, 15692, 15693, 15694, 15695,
+        15696, 15697, 15698, 15699, 15700, 15701, 15702, 15703, 15704, 15705, 15706, 15707, 15708, 15709, 15710, 15711,
+        15712, 15713, 15714, 15715, 15716, 15717, 15718, 15719, 15720, 15721, 15722, 15723, 15724, 15725, 15726, 15727,
+        15728, 15729, 15730, 15731, 15732, 15733, 15734, 15735, 15736, 15737, 15738, 15739, 15740, 15741, 15742, 15743,
+        15744, 15745, 15746, 15747, 15748, 15749, 15750, 15751, 15752, 15753, 15754, 15755, 15756, 15757, 15758, 15759,
+        15760, 15761, 15762, 15763, 15764, 15765, 15766, 15767, 15768, 15769, 15770, 15771, 15772, 15773, 15774, 15775,
+        15776, 15777, 15778, 15779, 15780, 15781, 15782, 15783, 15784, 15785, 15786, 15787, 15788, 15789, 15790, 15791,
+        15792, 15793, 15794, 15795, 15797, 15799, 15801, 15803, 15805, 15807, 15809, 15811, 15813, 15815, 15817, 15819,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 15821, 15822, 0, 0, 0, 0,
+        15823, 15824, 15825, 15826, 15827, 15828, 15829, 15830, 15831, 15832, 15833, 15834, 15835, 15836, 15837, 15838,
+        15839, 15840, 15841, 15842, 15843, 15844, 15845, 15846, 15847, 15848, 15849, 15850, 15851, 15852, 15853, 15854,
+        15855, 15856, 15857, 15858, 15859, 15860, 15861, 15862, 15863, 6304, 15863, 6304, 15863, 6304, 6304, 15864,
+        1, 1, 1, 15865, 15866, 15867, 15868, 15870, 6307, 15871, 15872, 15873, 1063, 1063, 15874, 15875,
+        15876, 15877, 15878, 15879, 15880, 15881, 15882, 15883, 15884, 15885, 15886, 15887, 15888, 15889, 15890, 15891,
+        15892, 15893, 15894, 15895, 15896, 15897, 15898, 15899, 15863, 6304, 15863, 6304, 15900, 15901, 15902, 15903,
+        15904, 15905, 15906, 15907, 15908, 15909, 15910, 15911, 15912, 15913, 15914, 15915, 15916, 15917, 15918, 15919,
+        15920, 15921, 15922, 15923, 15924, 15925, 15926, 15927, 15928, 15929, 15930, 15931, 15932, 15933, 15934, 15935,
+        15936, 15937, 15938, 15939, 15940, 15941, 15942, 15943, 15944, 15945, 15946, 15947, 15948, 15949, 15950, 15951,
+        15952, 15953, 15954, 15955, 15956, 15957, 15958, 15959, 15960, 15961, 15962, 15963, 15964, 15965, 15966, 15967,
+        15968, 15969, 15970, 15971, 15972, 15973, 15974, 15975, 15976, 15977, 15978, 15979, 15980, 15981, 15982, 15983,
+        15984, 15985, 15986, 15987, 15988, 15989, 15990, 15991, 0, 0, 0, 0, 0, 0, 0, 0,
+        15992, 15993, 15994, 15995, 15996, 15997, 15998, 15999, 16000, 16001, 16002, 16003, 16004, 16005, 16006, 16007,
+        16008, 16009, 16010, 16011, 16012, 16013, 16014, 16015, 16016, 16017, 16018, 16019, 16020, 16021, 16022, 16023,
+        16024, 16025, 16026, 16027, 16028, 16029, 16030, 16031, 16032, 16034, 16036, 16037, 16038, 16039, 16040, 16041,
+        16042, 16043, 16044, 16046, 16048, 6567, 16050, 16052, 16054, 6569, 16056, 16059, 16062, 16064, 16066, 16067,
+        16068, 16069, 16070, 16071, 16072, 16073, 16074, 16075, 16076, 16077, 16078, 16079, 16080, 16081, 16082, 16084,
+        16086, 16087, 16088, 16089, 16090, 16091, 16092, 16093, 16094, 16095, 16096, 16097, 16098, 16099, 16100, 16101,
+        16102, 16104, 16106, 16107, 16108, 16109, 16110, 16111, 16112, 16113, 16114, 16115, 16116, 16117, 16118, 16119,
+        16120, 16121, 16122, 16123, 16124, 16125, 16126, 16127, 16128, 16129, 6573, 16131, 16133, 16135, 16137, 16138,
+        16139, 16140, 16141, 16143, 16145, 517, 16147, 16149, 16151, 16152, 16153, 16154, 16155, 16156, 16157, 16158,
+        16159, 16160, 16161, 16162, 16163, 16164, 16165, 16166, 16167, 16168, 16169, 6599, 16171, 6601, 16173, 6603,
+        16175, 16177, 16179, 16181, 16183, 16185, 16187, 16189, 16191, 16193, 16195, 16196, 16197, 16198, 16199, 16200,
+        16201, 16202, 16203, 16204, 16205, 16206, 16207, 16208, 16209, 16210, 16211, 16212, 16213, 16214, 16215, 16216,
+        0, 0, 16217, 16218, 16219, 16220, 16221, 16222, 16223, 16224, 16225, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 16226, 16227, 16228, 16229, 16231, 16234, 16235, 16236, 16237, 16238, 16239,
+        16240, 16241, 16242, 16243, 16244, 16245, 16246, 16247, 16248, 16249, 16250, 2347, 16251, 16252, 16253, 16254,
+        16255, 16256, 16257, 16258, 16259, 16260, 16261, 16262, 16263, 16264, 16265, 16266, 16267, 16268, 16269, 16270,
+        16271, 16272, 16273, 16274, 16275, 16276, 16277, 16278, 16279, 16280, 16281, 16282, 16283, 0, 0, 0,
+        16284, 16285, 16286, 16287, 16288, 16289, 16290, 16291, 16292, 16293, 0, 0, 0, 0, 0, 0,
+        16294, 16295, 16296, 16297, 16298, 16299, 16300, 16301, 16302, 16303, 16304, 16305, 16306, 16307, 16308, 16309,
+        16310, 16311, 16312, 16313, 16314, 16315, 16316, 16317, 16318, 16319, 16320, 16321, 16322, 16323, 16324, 16325,
+        16326, 16327, 16328, 16329, 16330, 16331, 16332, 16333, 16334, 16335, 16336, 16337, 16338, 16339, 16340, 16341,
+        16342, 16343, 16344, 16345, 16346, 16347, 16348, 16349, 0, 0, 0, 0, 0, 0, 0, 0,
+        2347, 2348, 16350, 16351, 16352, 16353, 16354, 16355, 16356, 16357, 16358, 16359, 16360, 16361, 16362, 16363,
+        16364, 16365, 16366, 16367, 16368, 16369, 16370, 16371, 16372, 16373, 16374, 16375, 16376, 16377, 16378, 16379,
+        16380, 16381, 16382, 16383, 16384, 16385, 16386, 16387, 16388, 16389, 16390, 16391, 16392, 16393, 16394, 16395,
+        16396, 16397, 16398, 16399, 16400, 16401, 16402, 16403, 16404, 16405, 16406, 16407, 16408, 16409, 16410, 16411,
+        16412, 16413, 16414, 16415, 16416, 2346, 0, 0, 0, 0, 0, 0, 0, 0, 16417, 16418,
+        1, 1, 16419, 16420, 16420, 16420, 16420, 16420, 16421, 16422, 16423, 16424, 16425, 16426, 16427, 16428,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 16429, 16430, 16431, 16432, 16433, 16434,
+        16435, 16436, 16437, 16438, 16439, 16440, 16441, 16442, 16443, 16444, 16445, 16446, 16447, 16448, 16449, 16450,
+        16451, 16452, 16453, 16454, 16455, 16456, 16457, 16458, 16459, 16460, 16461, 16462, 16463, 16464, 16465, 16466,
+        16467, 16468, 16469, 16470, 16471, 16472, 16473, 16474, 16475, 16476, 16477, 16478, 16479, 16480, 16481, 16482,
+        16483, 16484, 16485, 16486, 16487, 16488, 16489, 16490, 16491, 16492, 16493, 16494, 16495, 16496, 16497, 16498,
+        16499, 16500, 16501, 16502, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16503,
+        16504, 16505, 16506, 16507, 16508, 16509, 16510, 16511, 16512, 16513, 16514, 16515, 16516, 16517, 16518, 16519,
+        16520, 16521, 16522, 16523, 16524, 16525, 16526, 16527, 16528, 16529, 16530, 16531, 16532, 0, 0, 0,
+        2346, 2347, 16533, 2348, 16534, 16535, 16536, 16537, 16538, 16539, 16540, 16541, 16542, 16543, 16544, 16545,
+        16546, 16547, 16548, 16549, 16550, 16551, 16552, 16553, 16554, 16555, 16556, 16557, 16558, 16559, 16560, 16561,
+        16562, 16563, 16564, 16565, 16566, 16567, 16568, 16569, 16570, 16571, 16572, 16573, 16574, 16575, 16576, 16577,
+        16578, 16579, 16580, 2408, 16581, 16582, 16583, 16584, 16585, 16586, 16587, 16588, 16589, 16590, 16591, 16592,
+        16593, 16594, 16595, 16596, 16597, 16598, 16599, 16600, 16601, 16602, 16603, 16604, 16605, 16606, 0, 16607,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 0, 0, 0, 0, 16608, 16609,
+        16610, 16611, 16612, 16613, 16614, 16615, 16616, 16617, 16618, 16619, 16620, 16621, 16622, 16623, 16624, 16625,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 16626, 16627, 16628, 16629, 16630, 0,
+        16631, 16632, 16633, 16634, 16635, 16636, 16637, 16638, 16639, 16640, 16641, 16642, 16643, 16644, 16645, 16646,
+        16647, 16648, 16649, 16650, 16651, 16652, 16653, 16654, 16655, 16656, 16657, 16658, 16659, 16660, 16661, 16662,
+        16663, 16664, 16665, 16666, 16667, 16668, 16669, 16670, 16671, 16672, 16673, 16674, 16675, 16676, 16677, 16678,
+        16679, 16680, 16681, 16682, 16683, 16684, 16685, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        16686, 16687, 16688, 16689, 16690, 16691, 16692, 16693, 16694, 16695, 16696, 16697, 16698, 16699, 0, 0,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 0, 0, 16700, 16701, 16702, 16703,
+        16704, 16705, 16706, 16707, 16708, 16709, 16710, 16711, 16712, 16713, 16714, 16715, 16716, 16717, 16718, 16719,
+        16720, 16721, 16722, 16723, 16724, 16725, 16726, 16727, 16728, 16729, 16730, 16731, 16732, 16733, 16734, 16735,
+        16736, 16737, 16738, 16739, 16740, 16741, 16742, 16743, 16744, 16745, 16746, 16747, 16748, 16749, 16750, 16751,
+        16752, 16753, 16754, 16755, 16756, 16757, 16758, 16759, 16760, 16761, 16762, 16763, 16764, 16765, 16766, 16767,
+        16768, 16769, 16770, 16771, 16772, 16773, 16774, 16775, 16776, 16777, 16778, 16779, 16780, 16781, 16782, 16783,
+        16784, 16785, 16786, 16787, 16788, 16789, 16790, 16791, 16792, 16793, 16794, 16795, 16796, 16797, 16798, 16799,
+        16800, 16801, 16802, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16803, 16804, 16805, 16806, 16807,
+        16808, 16809, 16810, 16811, 16812, 16813, 16814, 16815, 16816, 16817, 16818, 16819, 16820, 16821, 16822, 16823,
+        16824, 16825, 16826, 16827, 16828, 16829, 16830, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16831, 16832, 16833, 16834, 16835, 16836, 0, 0, 16837, 16838, 16839, 16840, 16841, 16842, 0,
+        0, 16843, 16844, 16845, 16846, 16847, 16848, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        16849, 16850, 16851, 16852, 16853, 16854, 16855, 0, 16856, 16857, 16858, 16859, 16860, 16861, 16862, 0,
+        16863, 16864, 16865, 16866, 16867, 16868, 16869, 16870, 16871, 16872, 16873, 16874, 16875, 16876, 16877, 16878,
+        16879, 16880, 16881, 16882, 16883, 16884, 16885, 16886, 16887, 16888, 16889, 16890, 16891, 16892, 16893, 16894,
+        16895, 16896, 16897, 16898, 16899, 16900, 16901, 16902, 16903, 16904, 16905, 16906, 16907, 16908, 16909, 16910,
+        16911, 16912, 16913, 16914, 16915, 16916, 16917, 16919, 16921, 16922, 16923, 16924, 0, 0, 0, 0,
+        16925, 16926, 16927, 16928, 16929, 16930, 16931, 16932, 16933, 16934, 16935, 16936, 16937, 16938, 16939, 16940,
+        16941, 16942, 16943, 16944, 16945, 16946, 16947, 16948, 16949, 16950, 16951, 16952, 16953, 16954, 16955, 16956,
+        16957, 16958, 16959, 16960, 16961, 16962, 16963, 16964, 16965, 16966, 16967, 16968, 16969, 16970, 16971, 16972,
+        16973, 16974, 16975, 16976, 16977, 16978, 16979, 16980, 16981, 16982, 16983, 16984, 16985, 16986, 16987, 16988,
+        16989, 16990, 16991, 16992, 16993, 16994, 16995, 16996, 16997, 16998, 16999, 17000, 17001, 17002, 17003, 17004,
+        17005, 17006, 17007, 17008, 17009, 17010, 17011, 17012, 17013, 17014, 17015, 17016, 17017, 17018, 17019, 17020,
+        17021, 17022, 17023, 17024, 17025, 17026, 17027, 17028, 17029, 17030, 17031, 17032, 17033, 17034, 17035, 17036,
+        17037, 17038, 17039, 17040, 17041, 17042, 17043, 17044, 17045, 17046, 17047, 17048, 17049, 17050, 0, 0,
+        17051, 17052, 17053, 17054, 17055, 17056, 17057, 17058, 17059, 17060, 17061, 17062, 17063, 17064, 17065, 17066,
+        17067, 17068, 17069, 17070, 17071, 17072, 17073, 0, 0, 0, 0, 17074, 17075, 17076, 17077, 17078,
+        17079, 17080, 17081, 17082, 17083, 17084, 17085, 17086, 17087, 17088, 17089, 17090, 17091, 17092, 17093, 17094,
+        17095, 17096, 17097, 17098, 17099, 17100, 17101, 17102, 17103, 17104, 17105, 17106, 17107, 17108, 17109, 17110,
+        17111, 17112, 17113, 17114, 17115, 17116, 17117, 17118, 17119, 17120, 17121, 17122, 0, 0, 0, 0,
+        17123, 17125, 17127, 17129, 17131, 17133, 17135, 17137, 17137, 17139, 17141, 17143, 17145, 17147, 17149, 17151,
+        17153, 17155, 17157, 17159, 17161, 17163, 17165, 17167, 17169, 17171, 17173, 17175, 17177, 17179, 17181, 17183,
+        17185, 17187, 17189, 17191, 17193, 17195, 17197, 17199, 17201, 17203, 17205, 17207, 17209, 17211, 17213, 17215,
+        17217, 17219, 17221, 17223, 17225, 17227, 17229, 17231, 17233, 17235, 17237, 17239, 17241, 17243, 17245, 17247,
+        17249, 17251, 17253, 17255, 17257, 17259, 17261, 17263, 17265, 17267, 17269, 17271, 17273, 17275, 17277, 17279,
+        17281, 17283, 17285, 17287, 17289, 17291, 17293, 17295, 17297, 17299, 17301, 17303, 17161, 17305, 17307, 17309,
+        17311, 17313, 17315, 17317, 17319, 17321, 17323, 17325, 17327, 17329, 17331, 17333, 17335, 17337, 17339, 17341,
+        17343, 17345, 17347, 17349, 17351, 17353, 17355, 17357, 17359, 17361, 17363, 17365, 17367, 17369, 17371, 17373,
+        17375, 17377, 17379, 17381, 17383, 17385, 17387, 17389, 17391, 17393, 17395, 17397, 17399, 17401, 17403, 17405,
+        17407, 17409, 17411, 17413, 17415, 17417, 17419, 17421, 17423, 17425, 17427, 17429, 17431, 17433, 17435, 17437,
+        17439, 17341, 17441, 17443, 17445, 17447, 17449, 17451, 17453, 17455, 17309, 17457, 17459, 17461, 17463, 17465,
+        17467, 17469, 17471, 17473, 17475, 17477, 17479, 17481, 17483, 17485, 17487, 17489, 17491, 17493, 17495, 17161,
+        17497, 17499, 17501, 17503, 17505, 17507, 17509, 17511, 17513, 17515, 17517, 17519, 17521, 17523, 17525, 17527,
+        17529, 17531, 17533, 17535, 17537, 17539, 17541, 17543, 17545, 17547, 17549, 17313, 17551, 17553, 17555, 17557,
+        17559, 17561, 17563, 17565, 17567, 17569, 17571, 17573, 17575, 17577, 17579, 17581, 17583, 17585, 17587, 17589,
+        17591, 17593, 17595, 17597, 17599, 17601, 17603, 17605, 17607, 17609, 17611, 17613, 17615, 17617, 17619, 17621,
+        17623, 17625, 17627, 17629, 17631, 17633, 17635, 17637, 17639, 17641, 17643, 17645, 17647, 17649, 17651, 17653,
+        17655, 17657, 17659, 17661, 17663, 17665, 17667, 17669, 17671, 17673, 17675, 17677, 17679, 17681, 17683, 17685,
+        17687, 17689, 17691, 17693, 17695, 17697, 17699, 17701, 17703, 17705, 17707, 17709, 17711, 17713, 17715, 17717,
+        17719, 17721, 17723, 17725, 17727, 17729, 17731, 17733, 17735, 17737, 17739, 17741, 17743, 17745, 17747, 17749,
+        17751, 17753, 17755, 17757, 17759, 17761, 17763, 17765, 17767, 17769, 17771, 17773, 17775, 17777, 17779, 17781,
+        17783, 17785, 17787, 17789, 17791, 17793, 17795, 17419, 17797, 17799, 17801, 17803, 17805, 17807, 17807, 17809,
+        17811, 17813, 17815, 17817, 17819, 17821, 17823, 17697, 17825, 17827, 17829, 17831, 17833, 17835, 0, 0,
+        17837, 17839, 17841, 17843, 17845, 17847, 17849, 17851, 17731, 17853, 17855, 17857, 17655, 17859, 17861, 17863,
+        17865, 17867, 17869, 17871, 17873, 17875, 17877, 17879, 17881, 17749, 17883, 17751, 17885, 17887, 17889, 17891,
+        17893, 17659, 17203, 17895, 17897, 17899, 17343, 17517, 17901, 17903, 17765, 17905, 17767, 17907, 17909, 17911,
+        17667, 17913, 17915, 17917, 17919, 17921, 17669, 17923, 17925, 17927, 17929, 17931, 17933, 17795, 17935, 17937,
+        17419, 17939, 17803, 17941, 17943, 17945, 17947, 17949, 17813, 17951, 17691, 17953, 17815, 17305, 17955, 17817,
+        17957, 17821, 17959, 17961, 17963, 17965, 17967, 17825, 17679, 17969, 17827, 17971, 17829, 17973, 17137, 17975,
+        17977, 17979, 17981, 17983, 17985, 17987, 17989, 17991, 17993, 17995, 0, 0, 0, 0, 0, 0,
+        17997, 17999, 18001, 18003, 18006, 18009, 18012, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 18014, 18016, 18018, 18020, 18022, 0, 0, 0, 0, 0, 18024, 18026, 18027,
+        18030, 18031, 18032, 18033, 18034, 18035, 18036, 18037, 18038, 18039, 18040, 18042, 18044, 18047, 18050, 18052,
+        18054, 18056, 18058, 18060, 18062, 18064, 18066, 0, 18068, 18070, 18072, 18074, 18076, 0, 18078, 0,
+        18080, 18082, 0, 18084, 18086, 0, 18088, 18090, 18092, 18094, 18096, 18098, 18100, 18102, 18104, 18106,
+        18108, 18109, 18110, 18111, 18112, 18113, 18114, 18115, 18116, 18117, 18118, 18119, 18120, 18121, 18122, 18123,
+        18124, 18125, 18126, 18127, 18128, 18129, 18130, 18131, 18132, 18133, 18134, 18135, 18136, 18137, 18138, 18139,
+        18140, 18141, 18142, 18143, 18144, 18145, 18146, 18147, 18148, 18149, 18150, 18151, 18152, 18153, 18154, 18155,
+        18156, 18157, 18158, 18159, 18160, 18161, 18162, 18163, 18164, 18165, 18166, 18167, 18168, 18169, 18170, 18171,
+        18172, 18173, 18174, 18175, 18176, 18177, 18178, 18179, 18180, 18181, 18182, 18183, 18184, 18185, 18186, 18187,
+        18188, 18189, 18190, 18191, 18192, 18194, 18196, 18197, 18198, 18199, 18200, 18201, 18202, 18203, 18204, 18205,
+        18206, 18208, 18210, 18211, 18212, 18213, 18214, 18215, 18216, 18217, 18218, 18219, 18220, 18221, 18222, 18223,
+        18224, 18225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 18226, 18227, 18228, 18229, 18230, 18231, 18232, 18233, 18234, 18235, 18236, 18238, 18239,
+        18240, 18241, 18242, 18243, 18244, 18245, 18246, 18247, 18248, 18249, 18250, 18252, 18254, 18256, 18258, 18260,
+        18262, 18264, 18266, 18268, 18270, 18272, 18274, 18276, 18278, 18280, 18282, 18284, 18286, 18287, 18288, 18289,
+        18290, 18292, 18294, 18280, 18296, 18298, 18300, 18302, 18304, 18306, 18308, 18310, 18312, 18314, 18316, 18318,
+        18320, 18322, 18324, 18326, 18328, 18330, 18332, 18334, 18336, 18338, 18340, 18342, 18344, 18346, 18348, 18350,
+        18352, 18354, 18356, 18358, 18360, 18362, 18364, 18366, 18368, 18370, 18372, 18374, 18376, 18378, 18380, 18382,
+        18384, 18386, 18388, 18390, 18392, 18394, 18396, 18398, 18400, 18402, 18404, 18406, 18408, 18410, 18412, 18414,
+        18416, 18418, 18420, 18422, 18424, 18426, 18428, 18430, 18432, 18434, 18436, 18438, 18440, 18442, 18444, 18446,
+        18448, 18450, 18452, 18454, 18456, 18458, 18460, 18462, 18464, 18466, 18468, 18470, 18472, 18474, 18476, 18478,
+        18480, 18482, 18484, 18486, 18488, 18490, 18492, 18494, 18282, 18496, 18498, 18500, 18502, 18504, 18506, 18508,
+        18510, 18512, 18514, 18516, 18518, 18520, 18522, 18524, 18526, 18528, 18530, 18532, 18534, 18536, 18538, 18540,
+        18542, 18544, 18546, 18548, 18550, 18552, 18554, 18556, 18558, 18560, 18562, 18564, 18566, 18568, 18570, 18572,
+        18574, 18576, 18578, 18580, 18582, 18584, 18586, 18588, 18590, 18592, 18594, 18596, 18598, 18600, 18602, 18604,
+        18606, 18608, 18610, 18612, 18614, 18616, 18618, 18620, 18622, 18624, 18626, 18628, 18630, 18632, 18634, 18636,
+        18638, 18640, 18642, 18644, 18646, 18648, 18650, 18652, 18654, 18656, 18658, 18660, 18662, 18664, 18666, 18668,
+        18670, 18672, 18674, 18676, 18678, 18680, 18682, 18684, 18686, 18688, 18690, 18692, 18694, 18696, 18698, 18700,
+        18702, 18704, 18706, 18708, 18710, 18712, 18714, 18716, 18718, 18720, 18722, 18724, 18726, 18728, 18730, 18732,
+        18734, 18736, 18738, 18740, 18742, 18744, 18746, 18748, 18750, 18752, 18754, 18756, 18758, 18760, 18762, 18764,
+        18766, 18768, 18770, 18772, 18774, 18776, 18778, 18780, 18782, 18784, 18786, 18788, 18790, 18792, 18794, 18796,
+        18798, 18800, 18802, 18804, 18806, 18808, 18810, 18812, 18814, 18816, 18818, 18820, 18822, 18824, 18826, 18828,
+        18830, 18832, 18834, 18836, 18838, 18840, 18842, 18844, 18846, 18848, 18850, 18852, 18854, 18856, 18858, 18860,
+        18862, 18864, 18866, 18868, 18870, 18872, 18874, 18876, 18878, 18880, 18882, 18884, 18886, 18888, 18890, 18892,
+        18894, 18896, 18898, 18900, 18902, 18904, 18906, 18908, 18910, 18912, 18914, 18916, 18918, 18920, 18922, 18923,
+        18924, 18927, 18930, 18933, 18936, 18939, 18942, 18945, 18948, 18951, 18954, 18957, 18960, 18963, 18966, 18969,
+        18972, 18975, 18978, 18981, 18984, 18987, 18990, 18993, 18996, 18999, 19002, 19005, 19008, 19011, 19014, 19017,
+        19020, 19023, 19026, 19029, 19032, 19035, 19038, 19041, 19044, 19047, 19050, 19053, 19056, 19059, 19062, 19065,
+        19068, 19071, 19074, 19077, 19080, 19083, 19086, 19089, 19092, 19095, 19098, 19101, 19104, 19107, 19110, 19113,
+        0, 0, 19116, 19119, 19122, 19125, 19128, 19131, 19134, 19137, 19140, 19143, 19146, 19149, 19152, 19155,
+        19158, 19161, 19164, 19167, 19170, 19173, 19176, 19179, 19182, 19185, 19188, 19191, 19194, 19197, 19200, 19203,
+        19206, 19209, 19212, 19215, 19218, 19221, 19224, 19227, 19230, 19233, 19236, 19239, 19242, 19245, 19248, 19251,
+        19254, 19257, 19260, 19263, 19266, 19269, 19272, 19275, 0, 0, 0, 0, 0, 0, 0, 0,
+        19278, 19281, 19284, 19288, 19292, 19296, 19300, 19304, 19308, 19312, 19315, 19333, 19341, 19345, 0, 0,
+        19346, 19347, 19348, 19349, 19350, 19351, 19352, 19353, 19354, 19355, 0, 0, 0, 0, 0, 0,
+        1095, 1, 1094, 1, 1, 1, 1, 1069, 1, 1094, 1, 1, 1, 1, 1416, 1,
+        19358, 19360, 19361, 19362, 19362, 19363, 19364, 19365, 19366, 19367, 19368, 19369, 19370, 19371, 19372, 19373,
+        19374, 19375, 19376, 19377, 19378, 19379, 19380, 19381, 19382, 19383, 19383, 19383, 19383, 19384, 19384, 19384,
+        19385, 19386, 19387, 0, 19388, 19389, 19390, 19391, 19392, 19393, 19394, 19395, 19396, 19397, 19398, 19399,
+        19400, 19401, 19402, 19403, 19404, 19405, 19406, 0, 19407, 19408, 19409, 19410, 0, 0, 0, 0,
+        19411, 19412, 19413, 1, 19414, 0, 19415, 19416, 19417, 19418, 19419, 19420, 19421, 19422, 19423, 19424,
+        19425, 19426, 19427, 19428, 19429, 19430, 19431, 19432, 19433, 19434, 19435, 19436, 19437, 19438, 19439, 19440,
+        19441, 19442, 19443, 19444, 19445, 19446, 19447, 19448, 19449, 19450, 19451, 19452, 19453, 19454, 19455, 19456,
+        19457, 19458, 19459, 19460, 19461, 19462, 19463, 19464, 19465, 19466, 19467, 19468, 19469, 19470, 19471, 19472,
+        19473, 19474, 19475, 19476, 19477, 19478, 19479, 19480, 19481, 19482, 19483, 19484, 19485, 19486, 19487, 19488,
+        19489, 19490, 19491, 19492, 19493, 19494, 19495, 19496, 19497, 19498, 19499, 19500, 19501, 19502, 19503, 19504,
+        19505, 19506, 19507, 19508, 19509, 19510, 19511, 19512, 19513, 19514, 19515, 19516, 19517, 19518, 19519, 19520,
+        19521, 19522, 19523, 19524, 19525, 19526, 19527, 19528, 19529, 19530, 19531, 19532, 19533, 19534, 19535, 19536,
+        19537, 19538, 19539, 19540, 19541, 19542, 19544, 19546, 19548, 19550, 19552, 19554, 19556, 0, 0, 1,
+        0, 19558, 19559, 19560, 19561, 19562, 19563, 19564, 19565, 19566, 19567, 19568, 19569, 19570, 19571, 19572,
+        19573, 19574, 19575, 19576, 19577, 19578, 19579, 19580, 19581, 19582, 19583, 19584, 19585, 19586, 19587, 19588,
+        19589, 19590, 19591, 19592, 19593, 19594, 19595, 19596, 19597, 19598, 19599, 19600, 19601, 19602, 19603, 19604,
+        19605, 19606, 19607, 19608, 19609, 19610, 19611, 19612, 19613, 19614, 19615, 19616, 19617, 19618, 19619, 19620,
+        19621, 19622, 19623, 19624, 19625, 19626, 19627, 19628, 19629, 19630, 19631, 19632, 19633, 19634, 19635, 19636,
+        19637, 19638, 19639, 19640, 19641, 19642, 19643, 19644, 19645, 19646, 19647, 19648, 19649, 19650, 19651, 19652,
+        19653, 19654, 19655, 19656, 19657, 19658, 19659, 19660, 19661, 19662, 19663, 19664, 19665, 19666, 19667, 19668,
+        19669, 19670, 19671, 19672, 19673, 19674, 19675, 19676, 19677, 19678, 19679, 19680, 19681, 19682, 19683, 19684,
+        19685, 19686, 19687, 19688, 19689, 19690, 19691, 19692, 19693, 19694, 19695, 19696, 19697, 19698, 19699, 19700,
+        19701, 19702, 19703, 19704, 19705, 19706, 19707, 19708, 19709, 19710, 19711, 19712, 19713, 19714, 19715, 19716,
+        19717, 19718, 19719, 19720, 19721, 19722, 19723, 19724, 19725, 19726, 19727, 19728, 19729, 19730, 19731, 19732,
+        19733, 19734, 19735, 19736, 19737, 19738, 19739, 19740, 19741, 19742, 19743, 19744, 19745, 19746, 19747, 0,
+        0, 0, 19748, 19749, 19750, 19751, 19752, 19753, 0, 0, 19754, 19755, 19756, 19757, 19758, 19759,
+        0, 0, 19760, 19761, 19762, 19763, 19764, 19765, 0, 0, 19766, 19767, 19768, 0, 0, 0,
+        19769, 19770, 19771, 19772, 19773, 19774, 19775, 0, 19776, 19777, 19778, 19779, 19780, 19781, 19782, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 19783, 19784, 0, 0,
+        19785, 19786, 19787, 19788, 19789, 19790, 19791, 19792, 19793, 19794, 19795, 19796, 0, 19797, 19798, 19799,
+        19800, 19801, 19802, 19803, 19804, 19805, 19806, 19807, 19808, 19809, 19810, 19811, 19812, 19813, 19814, 19815,
+        19816, 19817, 19818, 19819, 19820, 19821, 19822, 0, 19823, 19824, 19825, 19826, 19827, 19828, 19829, 19830,
+        19831, 19832, 19833, 19834, 19835, 19836, 19837, 19838, 19839, 19840, 19841, 0, 19842, 19843, 0, 19844,
+        19845, 19846, 19847, 19848, 19849, 19850, 19851, 19852, 19853, 19854, 19855, 19856, 19857, 19858, 0, 0,
+        19859, 19860, 19861, 19862, 19863, 19864, 19865, 19866, 19867, 19868, 19869, 19870, 19871, 19872, 0, 0,
+        19873, 19874, 19875, 19876, 19877, 19878, 19879, 19880, 19881, 19882, 19883, 19884, 19885, 19886, 19887, 19888,
+        19889, 19890, 19891, 19892, 19893, 19894, 19895, 19896, 19897, 19898, 19899, 19900, 19901, 19902, 19903, 19904,
+        19905, 19906, 19907, 19908, 19909, 19910, 19911, 19912, 19913, 19914, 19915, 19916, 19917, 19918, 19919, 19920,
+        19921, 19922, 19923, 19924, 19925, 19926, 19927, 19928, 19929, 19930, 19931, 19932, 19933, 19934, 19935, 19936,
+        19937, 19938, 19939, 19940, 19941, 19942, 19943, 19944, 19945, 19946, 19947, 19948, 19949, 19950, 19951, 19952,
+        19953, 19954, 19955, 19956, 19957, 19958, 19959, 19960, 19961, 19962, 19963, 19964, 19965, 19966, 19967, 19968,
+        19969, 19970, 19971, 19972, 19973, 19974, 19975, 19976, 19977, 19978, 19979, 19980, 19981, 19982, 19983, 19984,
+        19985, 19986, 19987, 19988, 19989, 19990, 19991, 19992, 19993, 19994, 19995, 0, 0, 0, 0, 0,
+        19996, 19997, 19998, 0, 0, 0, 0, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+        19999, 20000, 20001, 20002, 20003, 20004, 20005, 20006, 20007, 20008, 20009, 20010, 20011, 20012, 20013, 20014,
+        20015, 20016, 20017, 20018, 20019, 20020, 20021, 20022, 20023, 20024, 20025, 20026, 20027, 20028, 20029, 20030,
+        20031, 20032, 20033, 20034, 0, 0, 0, 20035, 20036, 20037, 20038, 20039, 20040, 20041, 20042, 20043,
+        20044, 20045, 24, 28, 20046, 20047, 20048, 20049, 28, 20050, 20051, 20052, 20053, 20054, 20055, 28,
+        20056, 20057, 20058, 20059, 20060, 20061, 20062, 20063, 24, 24, 24, 25, 25, 25, 25, 28,
+        20064, 20065, 20066, 20067, 20068, 20069, 20070, 20071, 20072, 20073, 20074, 20075, 20076, 20077, 20078, 20079,
+        20080, 20081, 20082, 28, 20083, 20084, 20085, 20086, 20087, 20088, 20089, 20090, 20091, 20092, 20093, 20094,
+        20095, 20096, 20097, 20098, 20099, 20100, 20101, 20102, 20103, 20104, 23, 20105, 20106, 20107, 20108, 0,
+        20109, 20110, 20111, 20112, 20113, 20114, 20115, 20116, 20117, 20118, 20119, 20120, 20121, 0, 0, 0,
+        20122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        20123, 20124, 20125, 20126, 20127, 20128, 20129, 20130, 20131, 20132, 20133, 20134, 20135, 20136, 20137, 20138,
+        20139, 20140, 20141, 20142, 20143, 20144, 20145, 20146, 20147, 20148, 20149, 20150, 20151, 20152, 20153, 20154,
+        20155, 20156, 20157, 20158, 20159, 20160, 20161, 20162, 20163, 20164, 20165, 20166, 20167, 20168, 0, 0,
+        20169, 20170, 20171, 20172, 20173, 20174, 20175, 20176, 20177, 20178, 20179, 20180, 20181, 20182, 20183, 20184,
+        20185, 20186, 20187, 20188, 20189, 20190, 20191, 20192, 20193, 20194, 20195, 20196, 20197, 0, 0, 0,
+        20198, 20199, 20200, 20201, 20202, 20203, 20204, 20205, 20206, 20207, 20208, 20209, 20210, 20211, 20212, 20213,
+        20214, 20215, 20216, 20217, 20218, 20219, 20220, 20221, 20222, 20223, 20224, 20225, 20226, 20227, 20228, 20229,
+        20230, 20231, 20232, 20233, 20234, 20235, 20236, 20237, 20238, 20239, 20240, 20241, 20242, 20243, 20244, 20245,
+        20246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 24, 25, 26, 27, 28, 29, 30, 31, 32, 20247, 20248, 20249, 20250, 20251, 20252,
+        20253, 20254, 20255, 20256, 20257, 20258, 20259, 20260, 20261, 20262, 20263, 20264, 0, 0, 0, 0,
+        20265, 20266, 20267, 20268, 20269, 20270, 20271, 20272, 20273, 20274, 20275, 20276, 20277, 20278, 20279, 20280,
+        20281, 20282, 20283, 20284, 20285, 20286, 20287, 20288, 20289, 20290, 20291, 20292, 20293, 20294, 20295, 20296,
+        24, 28, 20297, 20298, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20299, 20300, 20301,
+        20302, 20303, 20304, 20305, 20306, 20307, 20308, 20309, 20310, 20311, 20312, 20313, 20314, 20315, 20316, 20317,
+        20318, 20319, 20320, 20321, 20322, 20323, 20324, 20325, 20326, 20327, 20328, 0, 0, 0, 0, 0,
+        20329, 20330, 20331, 20332, 20333, 20334, 20335, 20336, 20337, 20338, 20339, 20340, 20341, 20342, 20343, 20344,
+        20345, 20346, 20347, 20348, 20349, 20350, 20351, 20352, 20353, 20354, 20355, 20356, 20357, 20358, 20359, 20360,
+        20361, 20362, 20363, 20364, 20365, 20366, 20367, 20368, 20369, 20370, 20371, 0, 0, 0, 0, 0,
+        20372, 20373, 20374, 20375, 20376, 20377, 20378, 20379, 20380, 20381, 20382, 20383, 20384, 20385, 20386, 20387,
+        20388, 20389, 20390, 20391, 20392, 20393, 20394, 20395, 20396, 20397, 20398, 20399, 20400, 20401, 0, 20402,
+        20403, 20404, 20405, 20406, 20407, 20408, 20409, 20410, 20411, 20412, 20413, 20414, 20415, 20416, 20417, 20418,
+        20419, 20420, 20421, 20422, 20423, 20424, 20425, 20426, 20427, 20428, 20429, 20430, 20431, 20432, 20433, 20434,
+        20435, 20436, 20437, 20438, 0, 0, 0, 0, 20439, 20440, 20441, 20442, 20443, 20444, 20445, 20446,
+        20447, 24, 25, 20448, 20449, 20450, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        20451, 20452, 20453, 20454, 20455, 20456, 20457, 20458, 20459, 20460, 20461, 20462, 20463, 20464, 20465, 20466,
+        20467, 20468, 20469, 20470, 20471, 20472, 20473, 20474, 20475, 20476, 20477, 20478, 20479, 20480, 20481, 20482,
+        20483, 20484, 20485, 20486, 20487, 20488, 20489, 20490, 20491, 20492, 20493, 20494, 20495, 20496, 20497, 20498,
+        20499, 20500, 20501, 20502, 20503, 20504, 20505, 20506, 20507, 20508, 20509, 20510, 20511, 20512, 20513, 20514,
+        20515, 20516, 20517, 20518, 20519, 20520, 20521, 20522, 20523, 20524, 20525, 20526, 20527, 20528, 20529, 20530,
+        20531, 20532, 20533, 20534, 20535, 20536, 20537, 20538, 20539, 20540, 20541, 20542, 20543, 20544, 20545, 20546,
+        20547, 20548, 20549, 20550, 20551, 20552, 20553, 20554, 20555, 20556, 20557, 20558, 20559, 20560, 20561, 20562,
+        20563, 20564, 20565, 20566, 20567, 20568, 20569, 20570, 20571, 20572, 20573, 20574, 20575, 20576, 20577, 20578,
+        20579, 20580, 20581, 20582, 20583, 20584, 20585, 20586, 20587, 20588, 20589, 20590, 20591, 20592, 20593, 20594,
+        20595, 20596, 20597, 20598, 20599, 20600, 20601, 20602, 20603, 20604, 20605, 20606, 20607, 20608, 0, 0,
+        20609, 20610, 20611, 20612, 20613, 20614, 20615, 20616, 20617, 20618, 20619, 20620, 20621, 20622, 20623, 20624,
+        20625, 20626, 20627, 20628, 20629, 20630, 20631, 20632, 20633, 20634, 20635, 20636, 20637, 20638, 20639, 20640,
+        20641, 20642, 20643, 20644, 0, 0, 0, 0, 20645, 20646, 20647, 20648, 20649, 20650, 20651, 20652,
+        20653, 20654, 20655, 20656, 20657, 20658, 20659, 20660, 20661, 20662, 20663, 20664, 20665, 20666, 20667, 20668,
+        20669, 20670, 20671, 20672, 20673, 20674, 20675, 20676, 20677, 20678, 20679, 20680, 0, 0, 0, 0,
+        20681, 20682, 20683, 20684, 20685, 20686, 20687, 20688, 20689, 20690, 20691, 20692, 20693, 20694, 20695, 20696,
+        20697, 20698, 20699, 20700, 20701, 20702, 20703, 20704, 20705, 20706, 20707, 20708, 20709, 20710, 20711, 20712,
+        20713, 20714, 20715, 20716, 20717, 20718, 20719, 20720, 0, 0, 0, 0, 0, 0, 0, 0,
+        20721, 20722, 20723, 20724, 20725, 20726, 20727, 20728, 20729, 20730, 20731, 20732, 20733, 20734, 20735, 20736,
+        20737, 20738, 20739, 20740, 20741, 20742, 20743, 20744, 20745, 20746, 20747, 20748, 20749, 20750, 20751, 20752,
+        20753, 20754, 20755, 20756, 20757, 20758, 20759, 20760, 20761, 20762, 20763, 20764, 20765, 20766, 20767, 20768,
+        20769, 20770, 20771, 20772, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20773,
+        20774, 20775, 20776, 20777, 20778, 20779, 20780, 20781, 20782, 20783, 20784, 20785, 20786, 20787, 20788, 20789,
+        20790, 20791, 20792, 20793, 20794, 20795, 20796, 20797, 20798, 20799, 20800, 20801, 20802, 20803, 20804, 20805,
+        20806, 20807, 20808, 20809, 20810, 20811, 20812, 20813, 20814, 20815, 20816, 20817, 20818, 20819, 20820, 20821,
+        20822, 20823, 20824, 20825, 20826, 20827, 20828, 20829, 20830, 20831, 20832, 20833, 20834, 20835, 20836, 20837,
+        20838, 20839, 20840, 20841, 20842, 20843, 20844, 20845, 20846, 20847, 20848, 20849, 20850, 20851, 20852, 20853,
+        20854, 20855, 20856, 20857, 20858, 20859, 20860, 20861, 20862, 20863, 20864, 20865, 20866, 20867, 20868, 20869,
+        20870, 20871, 20872, 20873, 20874, 20875, 20876, 20877, 20878, 20879, 20880, 20881, 20882, 20883, 20884, 20885,
+        20886, 20887, 20888, 20889, 20890, 20891, 20892, 20893, 20894, 20895, 20896, 20897, 20898, 20899, 20900, 20901,
+        20902, 20903, 20904, 20905, 20906, 20907, 20908, 20909, 20910, 20911, 20912, 20913, 20914, 20915, 20916, 20917,
+        20918, 20919, 20920, 20921, 20922, 20923, 20924, 20925, 20926, 20927, 20928, 20929, 20930, 20931, 20932, 20933,
+        20934, 20935, 20936, 20937, 20938, 20939, 20940, 20941, 20942, 20943, 20944, 20945, 20946, 20947, 20948, 20949,
+        20950, 20951, 20952, 20953, 20954, 20955, 20956, 20957, 20958, 20959, 20960, 20961, 20962, 20963, 20964, 20965,
+        20966, 20967, 20968, 20969, 20970, 20971, 20972, 20973, 20974, 20975, 20976, 20977, 20978, 20979, 20980, 20981,
+        20982, 20983, 20984, 20985, 20986, 20987, 20988, 20989, 20990, 20991, 20992, 20993, 20994, 20995, 20996, 20997,
+        20998, 20999, 21000, 21001, 21002, 21003, 21004, 21005, 21006, 21007, 21008, 21009, 21010, 21011, 21012, 21013,
+        21014, 21015, 21016, 21017, 21018, 21019, 21020, 21021, 21022, 21023, 21024, 21025, 21026, 21027, 21028, 21029,
+        21030, 21031, 21032, 21033, 21034, 21035, 21036, 21037, 21038, 21039, 21040, 21041, 21042, 21043, 21044, 21045,
+        21046, 21047, 21048, 21049, 21050, 21051, 21052, 21053, 21054, 21055, 21056, 21057, 21058, 21059, 21060, 21061,
+        21062, 21063, 21064, 21065, 21066, 21067, 21068, 21069, 21070, 21071, 21072, 21073, 21074, 21075, 21076, 21077,
+        21078, 21079, 21080, 21081, 21082, 21083, 21084, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21085, 21086, 21087, 21088, 21089, 21090, 21091, 21092, 21093, 21094, 21095, 21096, 21097, 21098, 21099, 21100,
+        21101, 21102, 21103, 21104, 21105, 21106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21107, 21108, 21109, 21110, 21111, 21112, 21113, 21114, 0, 0, 0, 0, 0, 0, 0, 0,
+        21115, 21116, 21117, 21118, 21119, 21120, 0, 0, 21121, 0, 21122, 21123, 21124, 21125, 21126, 21127,
+        21128, 21129, 21130, 21131, 21132, 21133, 21134, 21135, 21136, 21137, 21138, 21139, 21140, 21141, 21142, 21143,
+        21144, 21145, 21146, 21147, 21148, 21149, 21150, 21151, 21152, 21153, 21154, 21155, 21156, 21157, 21158, 21159,
+        21160, 21161, 21162, 21163, 21164, 21165, 0, 21166, 21167, 0, 0, 0, 21168, 0, 0, 21169,
+        21170, 21171, 21172, 21173, 21174, 21175, 21176, 21177, 21178, 21179, 21180, 21181, 21182, 21183, 21184, 21185,
+        21186, 21187, 21188, 21189, 21190, 21191, 0, 21192, 24, 25, 26, 21193, 21194, 21195, 21196, 21197,
+        21198, 21199, 21200, 21201, 21202, 21203, 21204, 21205, 21206, 21207, 21208, 21209, 21210, 21211, 21212, 21213,
+        21214, 21215, 21216, 21217, 21218, 21219, 21220, 21221, 21222, 24, 25, 26, 27, 28, 21223, 21224,
+        21225, 21226, 21227, 21228, 21229, 21230, 21231, 21232, 21233, 21234, 21235, 21236, 21237, 21238, 21239, 21240,
+        21241, 21242, 21243, 21244, 21245, 21246, 21247, 21248, 21249, 21250, 21251, 21252, 21253, 21254, 21255, 0,
+        0, 0, 0, 0, 0, 0, 0, 24, 25, 26, 27, 27, 28, 21256, 21257, 21258,
+        21259, 21260, 21261, 21262, 21263, 21264, 21265, 21266, 21267, 21268, 21269, 21270, 21271, 21272, 21273, 21274,
+        21275, 21276, 21277, 0, 21278, 21279, 0, 0, 0, 0, 0, 24, 28, 21280, 21281, 21282,
+        21283, 21284, 21285, 21286, 21287, 21288, 21289, 21290, 21291, 21292, 21293, 21294, 21295, 21296, 21297, 21298,
+        21299, 21300, 21301, 21302, 21303, 21304, 24, 21305, 21306, 21307, 25, 26, 0, 0, 0, 21308,
+        21309, 21310, 21311, 21312, 21313, 21314, 21315, 21316, 21317, 21318, 21319, 21320, 21321, 21322, 21323, 21324,
+        21325, 21326, 21327, 21328, 21329, 21330, 21331, 21332, 21333, 21334, 0, 0, 0, 0, 0, 21335,
+        21336, 21338, 21340, 21342, 21344, 21346, 21348, 21350, 21352, 21354, 21356, 21358, 21360, 21362, 21364, 21366,
+        21368, 21370, 21372, 21374, 21376, 21378, 21380, 21382, 21384, 21386, 21388, 21390, 21392, 21394, 21396, 21397,
+        21398, 21399, 21400, 21401, 21402, 21403, 21404, 21405, 21406, 21407, 21408, 21409, 21410, 21411, 21412, 21413,
+        21414, 21416, 21417, 21418, 21419, 21420, 21421, 21422, 0, 0, 0, 0, 21423, 21424, 21425, 21426,
+        24, 25, 26, 27, 28, 29, 30, 31, 32, 21427, 21428, 21429, 21430, 21431, 21432, 21433,
+        0, 0, 21434, 21435, 21436, 21437, 21438, 21439, 21440, 21441, 21442, 21443, 21444, 21445, 21446, 21447,
+        21448, 21449, 21450, 21451, 21452, 21453, 21454, 21455, 21456, 21457, 21458, 21459, 21460, 21461, 21462, 21463,
+        21464, 21465, 21466, 21467, 21468, 21469, 21470, 21471, 21472, 21473, 21474, 21475, 21476, 21477, 21478, 21479,
+        21480, 21481, 21482, 21483, 0, 21484, 21485, 0, 0, 0, 0, 0, 21486, 1069, 2347, 2348,
+        21487, 21488, 21489, 21490, 0, 21491, 21492, 21493, 0, 21494, 21495, 21496, 21497, 21498, 21499, 21500,
+        21501, 21502, 21503, 21504, 21505, 21506, 21507, 21508, 21509, 21510, 21511, 21512, 21513, 21514, 21515, 21516,
+        21517, 21518, 21519, 21520, 21521, 21522, 0, 0, 21523, 21524, 21525, 0, 0, 0, 0, 21526,
+        24, 25, 26, 27, 21527, 21528, 21529, 21530, 21531, 0, 0, 0, 0, 0, 0, 0,
+        21532, 21533, 21534, 21535, 21536, 21537, 21538, 21539, 21540, 0, 0, 0, 0, 0, 0, 0,
+        21541, 21542, 21543, 21544, 21545, 21546, 21547, 21548, 21549, 21550, 21551, 21552, 21553, 21554, 21555, 21556,
+        21557, 21558, 21559, 21560, 21561, 21562, 21563, 21564, 21565, 21566, 21567, 21568, 21569, 24, 21570, 21571,
+        21572, 21573, 21574, 21575, 21576, 21577, 21578, 21579, 21580, 21581, 21582, 21583, 21584, 21585, 21586, 21587,
+        21588, 21589, 21590, 21591, 21592, 21593, 21594, 21595, 21596, 21597, 21598, 21599, 21600, 24, 21601, 21602,
+        21603, 21604, 21605, 21606, 21607, 21608, 21609, 21610, 21611, 21613, 21614, 21615, 21616, 21617, 21618, 21619,
+        21620, 21621, 21622, 21623, 21624, 21625, 21626, 21627, 21628, 21629, 21630, 21631, 21632, 21633, 21634, 21635,
+        21636, 21637, 21638, 21639, 21640, 1063, 1069, 0, 0, 0, 0, 24, 28, 21641, 21642, 21643,
+        21644, 21645, 21646, 21647, 21648, 21649, 21650, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21651, 21652, 21653, 21654, 21655, 21656, 21657, 21658, 21659, 21660, 21661, 21662, 21663, 21664, 21665, 21666,
+        21667, 21668, 21669, 21670, 21671, 21672, 21673, 21674, 21675, 21676, 21677, 21678, 21679, 21680, 21681, 21682,
+        21683, 21684, 21685, 21686, 21687, 21688, 21689, 21690, 21691, 21692, 21693, 21694, 21695, 21696, 21697, 21699,
+        21700, 21701, 21702, 21703, 21704, 21705, 0, 0, 0, 21706, 21707, 21708, 21709, 21710, 21711, 21712,
+        21713, 21714, 21715, 21716, 21717, 21718, 21719, 21720, 21721, 21722, 21723, 21724, 21725, 21726, 21727, 21728,
+        21729, 21730, 21731, 21732, 21733, 21734, 0, 0, 24, 25, 26, 27, 21735, 21736, 21737, 21738,
+        21739, 21740, 21741, 21742, 21743, 21744, 21745, 21746, 21747, 21748, 21749, 21750, 21751, 21752, 21753, 21754,
+        21755, 21756, 21757, 0, 0, 0, 0, 0, 24, 25, 26, 27, 21758, 21759, 21760, 21761,
+        21762, 21763, 21764, 21765, 21766, 21767, 21768, 21769, 21770, 21771, 21772, 21773, 21774, 21775, 21776, 21777,
+        21778, 21779, 0, 0, 0, 0, 0, 0, 0, 21780, 21781, 21782, 21783, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 25, 26, 27, 21784, 21785, 21786,
+        21787, 21788, 21790, 21791, 21792, 21794, 21795, 21796, 21797, 21799, 21800, 21802, 21803, 21805, 21806, 21808,
+        21809, 21811, 21812, 21814, 21815, 21816, 21818, 21819, 21821, 21822, 21824, 21825, 21827, 21828, 21830, 21831,
+        21833, 21834, 21835, 21836, 21837, 21838, 21840, 21841, 21843, 21844, 21846, 21847, 21849, 21850, 21851, 21853,
+        21854, 21855, 21856, 21857, 21859, 21860, 21862, 21863, 21865, 21866, 21868, 21869, 21871, 21872, 21873, 21874,
+        21875, 21877, 21878, 21880, 21881, 21883, 21884, 21886, 21887, 0, 0, 0, 0, 0, 0, 0,
+        21888, 21889, 21891, 21892, 21893, 21894, 21895, 21896, 21897, 21898, 21899, 21901, 21903, 21904, 21905, 21906,
+        21907, 21908, 21910, 21911, 21912, 21913, 21914, 21915, 21916, 21917, 21918, 21919, 21920, 21922, 21923, 21925,
+        21927, 21928, 21929, 21930, 21932, 21933, 21934, 21935, 21936, 21937, 21938, 21939, 21941, 21942, 21944, 21945,
+        21946, 21947, 21948, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21949, 21950, 21952, 21953, 21954, 21955, 21956, 21957, 21958, 21959, 21960, 21962, 21964, 21965, 21966, 21967,
+        21968, 21969, 21971, 21972, 21973, 21974, 21975, 21976, 21977, 21978, 21979, 21980, 21981, 21983, 21984, 21986,
+        21988, 21989, 21990, 21991, 21993, 21994, 21995, 21996, 21997, 21998, 21999, 22000, 22002, 22003, 22005, 22006,
+        22007, 22008, 22009, 0, 0, 0, 0, 0, 0, 0, 24, 28, 22010, 22011, 22012, 22013,
+        22014, 22015, 22016, 22017, 22018, 22019, 22020, 22021, 22022, 22023, 22024, 22025, 22026, 22027, 22028, 22029,
+        22030, 22031, 22032, 22033, 22034, 22035, 22036, 22037, 22038, 22039, 22040, 22041, 22042, 22043, 22044, 22045,
+        22046, 22047, 22048, 22049, 1063, 1063, 1063, 1063, 0, 0, 0, 0, 0, 0, 0, 0,
+        24, 25, 26, 27, 28, 29, 30, 31, 32, 22050, 22051, 22052, 22053, 22054, 22055, 22056,
+        22057, 22058, 22059, 22060, 22061, 22062, 22063, 22064, 22065, 22066, 22067, 22068, 22069, 22070, 22071, 0,
+        22072, 22073, 22074, 22075, 22076, 22077, 22078, 22079, 22080, 22081, 22082, 22083, 22084, 22085, 22086, 22087,
+        22088, 22089, 22090, 22091, 22092, 22093, 22094, 22095, 22096, 22097, 22098, 22099, 22100, 22101, 22102, 22103,
+        22104, 22105, 22106, 22107, 22108, 22109, 22110, 22111, 22112, 22113, 0, 1833, 1832, 22114, 0, 0,
+        22115, 22116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22117, 22118, 22119, 22120, 22121, 22122, 22123, 22124, 22125, 22126, 22127, 22128, 22129, 22130, 22131, 22132,
+        22133, 22135, 22136, 22137, 22139, 22140, 22141, 22142, 22144, 22145, 22146, 22147, 22148, 24, 25, 26,
+        27, 28, 22150, 22151, 22152, 22153, 22154, 22155, 0, 0, 0, 0, 0, 0, 0, 0,
+        22157, 22158, 22159, 22160, 22161, 22162, 22163, 22164, 22165, 22166, 22167, 22168, 22169, 22170, 22171, 22172,
+        22173, 22174, 22175, 22176, 22177, 22178, 1069, 1069, 1063, 1063, 1063, 1069, 1063, 1069, 1069, 1069,
+        1069, 24, 22180, 22181, 22182, 22183, 22184, 22185, 22186, 22187, 0, 0, 0, 0, 0, 0,
+        22188, 22189, 22190, 22191, 22192, 22193, 22194, 22195, 22196, 22197, 22198, 22199, 22200, 22201, 22202, 22203,
+        22204, 22205, 22206, 22207, 22208, 24, 25, 26, 27, 22209, 22210, 22211, 0, 0, 0, 0,
+        22212, 22213, 22214, 22215, 22216, 22217, 22218, 22219, 22220, 22221, 22222, 22223, 22224, 22225, 22226, 22227,
+        22228, 22229, 22230, 22231, 22232, 22233, 22234, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2346, 2347, 2348, 22236, 22237, 22238, 22239, 22240, 22241, 22242, 22243, 22244, 22245, 22246, 22247, 22248,
+        22249, 22250, 22251, 22252, 22253, 22254, 22255, 22256, 22257, 22258, 22259, 22260, 22261, 22262, 22263, 22264,
+        22265, 22266, 22267, 22268, 22269, 22270, 22271, 22272, 22273, 22274, 22275, 22276, 22277, 22278, 22279, 22280,
+        22281, 22282, 22283, 22284, 22285, 22286, 22287, 22288, 22289, 22290, 22291, 22292, 22293, 22294, 22295, 22296,
+        22297, 22298, 22299, 22300, 22301, 22302, 22303, 22304, 22305, 22306, 22307, 22308, 22309, 22310, 0, 0,
+        0, 0, 24, 25, 26, 27, 28, 29, 30, 31, 32, 22311, 22312, 22313, 22314, 22315,
+        22316, 22317, 22318, 22319, 22320, 22321, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22322,
+        2346, 2347, 2348, 22323, 22324, 22325, 22326, 22327, 22328, 22329, 22330, 22331, 22332, 22333, 22334, 22335,
+        22336, 22337, 22338, 22339, 22340, 22341, 22342, 22343, 22344, 22345, 22346, 22348, 22349, 22351, 22352, 22353,
+        22354, 22355, 22356, 22357, 22358, 22359, 22360, 22361, 22362, 22363, 22364, 22365, 22367, 22368, 22369, 22370,
+        22371, 22372, 22373, 22374, 22375, 22376, 22377, 22378, 22379, 22380, 2408, 22381, 22382, 1, 22383, 22384,
+        22385, 22386, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+        22387, 22388, 22389, 22390, 22391, 22392, 22393, 22394, 22395, 22396, 22397, 22398, 22399, 22400, 22401, 22402,
+        22403, 22404, 22405, 22406, 22407, 22408, 22409, 22410, 22411, 0, 0, 0, 0, 0, 0, 0,
+        2346, 2347, 2348, 22412, 22413, 22414, 22415, 22416, 22417, 22418, 22419, 22420, 22421, 22422, 22423, 22424,
+        22425, 22426, 22427, 22428, 22429, 22430, 22431, 22432, 22433, 22434, 22435, 22436, 22437, 22438, 22439, 22440,
+        22441, 22442, 22443, 22444, 22445, 22446, 22447, 22448, 22449, 22450, 22451, 22452, 22453, 22454, 22455, 22456,
+        22457, 22458, 22459, 22460, 22461, 0, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+        22462, 22463, 22464, 22465, 22466, 22467, 22468, 22469, 0, 0, 0, 0, 0, 0, 0, 0,
+        22470, 22471, 22472, 22473, 22474, 22475, 22476, 22477, 22478, 22479, 22480, 22481, 22482, 22483, 22484, 22485,
+        22486, 22487, 22488, 22489, 22490, 22491, 22492, 22493, 22494, 22495, 22496, 22497, 22498, 22499, 22500, 22501,
+        22502, 22503, 22504, 2408, 22505, 22506, 22507, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2346, 2347, 2348, 22508, 22509, 22510, 22511, 22512, 22513, 22514, 22515, 22516, 22517, 22518, 22519, 22520,
+        22521, 22522, 22523, 22524, 22525, 22526, 22527, 22528, 22529, 22530, 22531, 22532, 22533, 22534, 22535, 22536,
+        22537, 22538, 22539, 22540, 22541, 22542, 22543, 22544, 22545, 22546, 22547, 22548, 22549, 22550, 22551, 22552,
+        22553, 22554, 22555, 22556, 22557, 22558, 22559, 22560, 22561, 22562, 22563, 22564, 22565, 22566, 22567, 22568,
+        22569, 22570, 22571, 22572, 22573, 22574, 22575, 22576, 22577, 2555, 2408, 22578, 22579, 22580, 22581, 2346,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 22582, 22583, 22584, 22585, 22586, 22587,
+        0, 24, 25, 26, 27, 28, 29, 30, 31, 32, 22588, 22589, 22590, 22591, 22592, 22593,
+        22594, 22595, 22596, 22597, 22598, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22599, 22600, 22601, 22602, 22603, 22604, 22605, 22606, 22607, 22608, 22609, 22610, 22611, 22612, 22613, 22614,
+        22615, 22616, 0, 22617, 22618, 22619, 22620, 22621, 22622, 22623, 22624, 22625, 22626, 22627, 22628, 22629,
+        22630, 22631, 22632, 22633, 22634, 22635, 22636, 22637, 22638, 22639, 22640, 22641, 22642, 22643, 22644, 22645,
+        22646, 22647, 22648, 22649, 2347, 22650, 2408, 1830, 22651, 22652, 22653, 22654, 22655, 22656, 1831, 0,
+        22657, 22658, 22659, 22660, 22661, 22662, 22663, 0, 22664, 0, 22665, 22666, 22667, 22668, 0, 22669,
+        22670, 22671, 22672, 22673, 22674, 22675, 22676, 22677, 22678, 22679, 22680, 22681, 22682, 22683, 0, 22684,
+        22685, 22686, 22687, 22688, 22689, 22690, 22691, 22692, 22693, 22694, 0, 0, 0, 0, 0, 0,
+        22695, 22696, 22697, 22698, 22699, 22700, 22701, 22702, 22703, 22704, 22705, 22706, 22707, 22708, 22709, 22710,
+        22711, 22712, 22713, 22714, 22715, 22716, 22717, 22718, 22719, 22720, 22721, 22722, 22723, 22724, 22725, 22726,
+        22727, 22728, 22729, 22730, 22731, 22732, 22733, 22734, 22735, 22736, 22737, 22738, 22739, 22740, 22741, 2347,
+        22742, 22743, 22744, 22745, 22746, 22747, 22748, 22749, 22750, 2408, 22751, 0, 0, 0, 0, 0,
+        2347, 2346, 2347, 2348, 0, 22752, 22753, 22754, 22755, 22756, 22757, 22758, 22759, 0, 0, 22760,
+        22761, 0, 0, 22762, 22763, 22764, 22765, 22766, 22767, 22768, 22769, 22770, 22771, 22772, 22773, 22774,
+        22775, 22776, 22777, 22778, 22779, 22780, 22781, 22782, 22783, 0, 22784, 22785, 22786, 22787, 22788, 22789,
+        22790, 0, 22791, 22792, 0, 22793, 22794, 22795, 22796, 22797, 0, 2408, 2408, 22798, 22799, 22800,
+        22801, 22802, 22803, 22804, 22805, 0, 0, 22806, 22807, 0, 0, 22808, 22809, 22810, 0, 0,
+        22811, 0, 0, 0, 0, 0, 0, 22812, 0, 0, 0, 0, 0, 22813, 22814, 22815,
+        22816, 22817, 22818, 22819, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+        1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22820, 22821, 22822, 22823, 22824, 22825, 22826, 22827, 22828, 22829, 22830, 22831, 22832, 22833, 22834, 22835,
+        22836, 22837, 22838, 22839, 22840, 22841, 22842, 22843, 22844, 22845, 22846, 22847, 22848, 22849, 22850, 22851,
+        22852, 22853, 22854, 22855, 22856, 22857, 22858, 22859, 22860, 22861, 22862, 22863, 22864, 22865, 22866, 22867,
+        22868, 22869, 22870, 22871, 22872, 22873, 22874, 22875, 22876, 22877, 22878, 22879, 22880, 22881, 22882, 22883,
+        22884, 22885, 22886, 2346, 2347, 2348, 2408, 22887, 22888, 22889, 22890, 22891, 22892, 22893, 22894, 22895,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 22896, 22897, 0, 22898, 2555, 22899,
+        22900, 22901, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22902, 22903, 22904, 22905, 22906, 22907, 22908, 22909, 22910, 22911, 22912, 22913, 22914, 22915, 22916, 22917,
+        22918, 22919, 22920, 22921, 22922, 22923, 22924, 22925, 22926, 22927, 22928, 22929, 22930, 22931, 22932, 22933,
+        22934, 22935, 22936, 22937, 22938, 22939, 22940, 22941, 22942, 22943, 22944, 22945, 22946, 22947, 22948, 22949,
+        22950, 22951, 22952, 22953, 22954, 22955, 22956, 22957, 22958, 22959, 22960, 22961, 22962, 22963, 22964, 2346,
+        2347, 2348, 22965, 2408, 22966, 22967, 22968, 22969, 0, 0, 0, 0, 0, 0, 0, 0,
+        22970, 22971, 22972, 22973, 22974, 22975, 22976, 22977, 22978, 22979, 22980, 22981, 22982, 22983, 22984, 22985,
+        22986, 22987, 22988, 22989, 22990, 22991, 22992, 22993, 22994, 22995, 22996, 22997, 22998, 22999, 23000, 23001,
+        23002, 23003, 23004, 23005, 23006, 23007, 23008, 23009, 23010, 23011, 23012, 23013, 23014, 23015, 23016, 23017,
+        23018, 23019, 23020, 23021, 23022, 23023, 0, 0, 23024, 23025, 23026, 23027, 2346, 2347, 2348, 23028,
+        2408, 23029, 23030, 23031, 23032, 23033, 23034, 23035, 23036, 23037, 23038, 23039, 23040, 23041, 23042, 23043,
+        23044, 23045, 23046, 23047, 23048, 23049, 23050, 23051, 23052, 23054, 23056, 23058, 23060, 23062, 0, 0,
+        23064, 23065, 23066, 23067, 23068, 23069, 23070, 23071, 23072, 23073, 23074, 23075, 23076, 23077, 23078, 23079,
+        23080, 23081, 23082, 23083, 23084, 23085, 23086, 23087, 23088, 23089, 23090, 23091, 23092, 23093, 23094, 23095,
+        23096, 23097, 23098, 23099, 23100, 23101, 23102, 23103, 23104, 23105, 23106, 23107, 23108, 23109, 23110, 23111,
+        23112, 23113, 23114, 23115, 23116, 23117, 23118, 23119, 23120, 23121, 23122, 23123, 23124, 2347, 2348, 23125,
+        2346, 23126, 23127, 23128, 23129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        23130, 23131, 23132, 23133, 23134, 23135, 23136, 23137, 23138, 23139, 23140, 23141, 23142, 0, 0, 0,
+        23143, 23144, 23145, 23146, 23147, 23148, 23149, 23150, 23151, 23152, 23153, 23154, 23155, 23156, 23157, 23158,
+        23159, 23160, 23161, 23162, 23163, 23164, 23165, 23166, 23167, 23168, 23169, 23170, 23171, 23172, 23173, 23174,
+        23175, 23176, 23177, 23178, 23179, 23180, 23181, 23182, 23183, 23184, 23185, 2347, 2348, 23186, 23187, 23188,
+        23189, 23190, 23191, 23192, 23193, 23194, 23195, 2408, 23196, 0, 0, 0, 0, 0, 0, 0,
+        23197, 23198, 23199, 23200, 23201, 23202, 23204, 23205, 23206, 23207, 23208, 23209, 23210, 23211, 23212, 23213,
+        23214, 23215, 23216, 23217, 23218, 23219, 23220, 23222, 23223, 23224, 23225, 0, 0, 23227, 23228, 23229,
+        23230, 23231, 23232, 23233, 23234, 23235, 23236, 23237, 23238, 23239, 23240, 23241, 0, 0, 0, 0,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 23242, 23243, 23244, 23245, 23246, 23247,
+        23248, 23249, 23250, 23251, 23252, 23253, 23254, 23255, 23256, 23257, 23258, 23259, 23260, 23261, 23262, 23263,
+        23264, 23265, 23266, 23267, 23268, 23269, 23270, 23271, 23272, 23273, 23274, 23275, 23276, 23277, 23278, 23279,
+        23280, 23281, 23282, 23283, 23284, 23285, 23286, 23287, 23288, 23289, 23290, 23291, 23292, 23293, 23294, 23295,
+        23296, 23297, 23298, 23299, 23300, 23301, 23302, 2347, 2348, 23303, 2408, 23304, 0, 0, 0, 0,
+        23305, 23306, 23307, 23308, 23309, 23310, 23311, 23312, 23313, 23314, 23315, 23316, 23317, 23318, 23319, 23320,
+        23321, 23322, 23323, 23324, 23325, 23326, 23327, 23328, 23329, 23330, 23331, 23332, 23333, 23334, 23335, 23336,
+        23337, 23338, 23339, 23340, 23341, 23342, 23343, 23344, 23345, 23346, 23347, 23348, 23349, 23350, 23351, 23352,
+        23353, 23354, 23355, 23356, 23357, 23358, 23359, 23360, 23361, 23362, 23363, 23364, 23365, 23366, 23367, 23368,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 23369, 23370, 23371, 23372, 23373, 23374,
+        23375, 23376, 23377, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23378,
+        23379, 23380, 23381, 23382, 23383, 23384, 23385, 0, 0, 23386, 0, 0, 23387, 23388, 23389, 23390,
+        23391, 23392, 23393, 23394, 0, 23395, 23396, 0, 23397, 23398, 23399, 23400, 23401, 23402, 23403, 23404,
+        23405, 23406, 23407, 23408, 23409, 23410, 23411, 23412, 23413, 23414, 23415, 23416, 23417, 23418, 23419, 23420,
+        23421, 23422, 23423, 23424, 23425, 23426, 0, 23427, 23428, 0, 0, 2347, 2346, 23429, 23430, 23431,
+        23432, 23433, 23434, 2408, 23435, 23436, 23437, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        23438, 23439, 23440, 23441, 23442, 23443, 23444, 23445, 0, 0, 23446, 23447, 23448, 23449, 23450, 23451,
+        23452, 23453, 23454, 23455, 23456, 23457, 23458, 23459, 23460, 23461, 23462, 23463, 23464, 23465, 23466, 23467,
+        23468, 23469, 23470, 23471, 23472, 23473, 23474, 23475, 23476, 23477, 23478, 23479, 23480, 23481, 23482, 23483,
+        23484, 23485, 23486, 23487, 23488, 23489, 23490, 23491, 0, 0, 23492, 23493, 23494, 23495, 2347, 2348,
+        23496, 23497, 23498, 23499, 23500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        23501, 23502, 23503, 23504, 23505, 23506, 23507, 23508, 23509, 23510, 23511, 23512, 23513, 23514, 23515, 23516,
+        23517, 23518, 23519, 23520, 23521, 23522, 23523, 23524, 23525, 23526, 23527, 23528, 23529, 23530, 23531, 23532,
+        23533, 23534, 23535, 23536, 23537, 23538, 23539, 23540, 23541, 23542, 23543, 23544, 23545, 23546, 23547, 23548,
+        23549, 23550, 23551, 2408, 23552, 2346, 2346, 2346, 2347, 2348, 23553, 23554, 23555, 23556, 23557, 23558,
+        23559, 23560, 23561, 23562, 23563, 23564, 23565, 23566, 0, 0, 0, 0, 0, 0, 0, 0,
+        23567, 23568, 23569, 23570, 23571, 23572, 23573, 23574, 23575, 23576, 23577, 23578, 23579, 23580, 23581, 23582,
+        23583, 23584, 23585, 23586, 23587, 23588, 23589, 23590, 23591, 23592, 23593, 23594, 23595, 23596, 23597, 23598,
+        23599, 23600, 23601, 23602, 23603, 23604, 23605, 23606, 23607, 23608, 23609, 23610, 23611, 23612, 23613, 23614,
+        23615, 23616, 23617, 23618, 23619, 23620, 23621, 23622, 23623, 23624, 23625, 23626, 23627, 23628, 23629, 23630,
+        23631, 23632, 23633, 23634, 23635, 23636, 2347, 2348, 23637, 23638, 23639, 23640, 23641, 23642, 23643, 23644,
+        23645, 23646, 23647, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        23648, 23649, 23650, 23651, 23652, 23653, 23654, 23655, 23656, 23657, 23658, 23659, 23660, 23661, 23662, 23663,
+        23664, 23665, 23666, 23667, 23668, 23669, 23670, 23671, 23672, 23673, 23674, 23675, 23676, 23677, 23678, 23679,
+        23680, 23681, 23682, 23683, 23684, 23685, 23686, 23687, 23688, 23689, 23690, 23691, 23692, 23693, 23694, 23695,
+        23696, 23697, 23698, 23699, 23700, 23701, 23702, 23703, 23704, 0, 0, 0, 0, 0, 0, 0,
+        23705, 23706, 23707, 23708, 23709, 23710, 23711, 23712, 23713, 0, 23714, 23715, 23716, 23717, 23718, 23719,
+        23720, 23721, 23722, 23723, 23724, 23725, 23726, 23727, 23728, 23729, 23730, 23731, 23732, 23733, 23734, 23735,
+        23736, 23737, 23738, 23739, 23740, 23741, 23742, 23743, 23744, 23745, 23746, 23747, 23748, 23749, 23750, 23751,
+        23752, 23753, 23754, 23755, 23756, 23757, 23758, 0, 23759, 23760, 23761, 23762, 2346, 2347, 2348, 23763,
+        23764, 23765, 23766, 23767, 23768, 23769, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 24, 25, 26, 27, 28, 29,
+        30, 31, 32, 23770, 23771, 23772, 23773, 23774, 23775, 23776, 23777, 23778, 23779, 0, 0, 0,
+        23780, 23781, 23782, 23783, 23784, 23785, 23786, 23787, 23788, 23789, 23790, 23791, 23792, 23793, 23794, 23795,
+        23796, 23797, 23798, 23799, 23800, 23801, 23802, 23803, 23804, 23805, 23806, 23807, 23808, 23809, 23810, 23811,
+        0, 0, 23812, 23813, 23814, 23815, 23816, 23817, 23818, 23819, 23820, 23821, 23822, 23823, 23824, 23825,
+        23826, 23827, 23828, 23829, 23830, 23831, 23832, 23833, 0, 23834, 23835, 23836, 23837, 23838, 23839, 23840,
+        23841, 23842, 23843, 23844, 23845, 2347, 2346, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        23846, 23847, 23848, 23849, 23850, 23851, 23852, 0, 23853, 23854, 0, 23855, 23856, 23857, 23858, 23859,
+        23860, 23861, 23862, 23863, 23864, 23865, 23866, 23867, 23868, 23869, 23870, 23871, 23872, 23873, 23874, 23875,
+        23876, 23877, 23878, 23879, 23880, 23881, 23882, 23883, 23884, 23885, 23886, 23887, 23888, 23889, 23890, 23891,
+        23892, 23893, 23894, 23895, 23896, 23897, 23898, 0, 0, 0, 23899, 0, 23900, 23901, 0, 23902,
+        2347, 2348, 2408, 2346, 23903, 23904, 23905, 23906, 0, 0, 0, 0, 0, 0, 0, 0,
+        23907, 23908, 23909, 23910, 23911, 23912, 0, 23913, 23914, 0, 23915, 23916, 23917, 23918, 23919, 23920,
+        23921, 23922, 23923, 23924, 23925, 23926, 23927, 23928, 23929, 23930, 23931, 23932, 23933, 23934, 23935, 23936,
+        23937, 23938, 23939, 23940, 23941, 23942, 23943, 23944, 23945, 23946, 23947, 23948, 23949, 23950, 23951, 0,
+        23952, 23953, 0, 23954, 23955, 2347, 2348, 23956, 23957, 0, 0, 0, 0, 0, 0, 0,
+        23958, 23959, 23960, 23961, 23962, 23963, 23964, 23965, 23966, 23967, 23968, 23969, 23970, 23971, 23972, 23973,
+        23974, 23975, 23976, 23977, 23978, 23979, 23980, 23981, 23982, 0, 0, 0, 0, 0, 0, 0,
+        23983, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        23984, 23985, 23986, 23987, 23988, 23989, 23990, 23991, 23992, 23993, 23994, 23995, 23996, 23997, 23998, 23999,
+        24000, 24001, 24002, 24003, 24004, 24005, 24006, 24007, 24008, 24009, 24010, 24011, 24012, 24013, 24014, 24015,
+        24016, 24017, 24018, 24019, 24020, 24021, 24022, 24023, 24024, 24025, 24026, 24027, 24028, 24029, 24030, 24031,
+        24032, 24033, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24034,
+        24035, 24036, 24037, 24038, 24039, 24040, 24041, 24042, 24043, 24044, 24045, 24046, 24047, 24048, 24049, 24050,
+        24051, 24052, 24053, 24054, 24055, 24056, 24057, 24058, 24059, 24060, 24061, 24062, 24063, 24064, 24065, 24066,
+        24067, 24068, 24069, 24070, 24071, 24072, 24073, 24074, 24075, 24076, 24077, 24078, 24079, 24080, 24081, 24082,
+        24083, 24084, 24085, 24086, 24087, 24088, 24089, 24090, 24091, 24092, 24093, 24094, 24095, 24096, 24097, 24098,
+        24099, 24100, 24101, 24102, 24103, 24104, 24105, 24106, 24107, 24108, 24109, 24110, 24111, 24112, 24113, 24114,
+        24115, 24116, 24117, 24118, 24119, 24120, 24121, 24122, 24123, 24124, 24125, 24126, 24127, 24128, 24129, 24130,
+        24131, 24132, 24133, 24134, 24135, 24136, 24137, 24138, 24139, 24140, 24141, 24142, 24143, 24144, 24145, 24146,
+        24147, 24148, 24149, 24150, 24151, 24152, 24153, 24154, 24155, 24156, 24157, 24158, 24159, 24160, 24161, 24162,
+        24163, 24164, 24165, 24166, 24167, 24168, 24169, 24170, 24171, 24172, 24173, 24174, 24175, 24176, 24177, 24178,
+        24179, 24180, 24181, 24182, 24183, 24184, 24185, 24186, 24187, 24188, 24189, 24190, 24191, 24192, 24193, 24194,
+        24195, 24196, 24197, 24198, 24199, 24200, 24201, 24202, 24203, 24204, 24205, 24206, 24207, 24208, 24209, 24210,
+        24211, 24212, 24213, 24214, 24215, 24216, 24217, 24218, 24219, 24220, 24221, 24222, 24223, 24224, 24225, 24226,
+        24227, 24228, 24229, 24230, 24231, 24232, 24233, 24234, 24235, 24236, 24237, 24238, 24239, 24240, 24241, 24242,
+        24243, 24244, 24245, 24246, 24247, 24248, 24249, 24250, 24251, 24252, 24253, 24254, 24255, 24256, 24257, 24258,
+        24259, 24260, 24261, 24262, 24263, 24264, 24265, 24266, 24267, 24268, 24269, 24270, 24271, 24272, 24273, 24274,
+        24275, 24276, 24277, 24278, 24279, 24280, 24281, 24282, 24283, 24284, 24285, 24286, 24287, 24288, 24289, 24290,
+        24291, 24292, 24293, 24294, 24295, 24296, 24297, 24298, 24299, 24300, 24301, 24302, 24303, 24304, 24305, 24306,
+        24307, 24308, 24309, 24310, 24311, 24312, 24313, 24314, 24315, 24316, 24317, 24318, 24319, 24320, 24321, 24322,
+        24323, 24324, 24325, 24326, 24327, 24328, 24329, 24330, 24331, 24332, 24333, 24334, 24335, 24336, 24337, 24338,
+        24339, 24340, 24341, 24342, 24343, 24344, 24345, 24346, 24347, 24348, 24349, 24350, 24351, 24352, 24353, 24354,
+        24355, 24356, 24357, 24358, 24359, 24360, 24361, 24362, 24363, 24364, 24365, 24366, 24367, 24368, 24369, 24370,
+        24371, 24372, 24373, 24374, 24375, 24376, 24377, 24378, 24379, 24380, 24381, 24382, 24383, 24384, 24385, 24386,
+        24387, 24388, 24389, 24390, 24391, 24392, 24393, 24394, 24395, 24396, 24397, 24398, 24399, 24400, 24401, 24402,
+        24403, 24404, 24405, 24406, 24407, 24408, 24409, 24410, 24411, 24412, 24413, 24414, 24415, 24416, 24417, 24418,
+        24419, 24420, 24421, 24422, 24423, 24424, 24425, 24426, 24427, 24428, 24429, 24430, 24431, 24432, 24433, 24434,
+        24435, 24436, 24437, 24438, 24439, 24440, 24441, 24442, 24443, 24444, 24445, 24446, 24447, 24448, 24449, 24450,
+        24451, 24452, 24453, 24454, 24455, 24456, 24457, 24458, 24459, 24460, 24461, 24462, 24463, 24464, 24465, 24466,
+        24467, 24468, 24469, 24470, 24471, 24472, 24473, 24474, 24475, 24476, 24477, 24478, 24479, 24480, 24481, 24482,
+        24483, 24484, 24485, 24486, 24487, 24488, 24489, 24490, 24491, 24492, 24493, 24494, 24495, 24496, 24497, 24498,
+        24499, 24500, 24501, 24502, 24503, 24504, 24505, 24506, 24507, 24508, 24509, 24510, 24511, 24512, 24513, 24514,
+        24515, 24516, 24517, 24518, 24519, 24520, 24521, 24522, 24523, 24524, 24525, 24526, 24527, 24528, 24529, 24530,
+        24531, 24532, 24533, 24534, 24535, 24536, 24537, 24538, 24539, 24540, 24541, 24542, 24543, 24544, 24545, 24546,
+        24547, 24548, 24549, 24550, 24551, 24552, 24553, 24554, 24555, 24556, 24557, 24558, 24559, 24560, 24561, 24562,
+        24563, 24564, 24565, 24566, 24567, 24568, 24569, 24570, 24571, 24572, 24573, 24574, 24575, 24576, 24577, 24578,
+        24579, 24580, 24581, 24582, 24583, 24584, 24585, 24586, 24587, 24588, 24589, 24590, 24591, 24592, 24593, 24594,
+        24595, 24596, 24597, 24598, 24599, 24600, 24601, 24602, 24603, 24604, 24605, 24606, 24607, 24608, 24609, 24610,
+        24611, 24612, 24613, 24614, 24615, 24616, 24617, 24618, 24619, 24620, 24621, 24622, 24623, 24624, 24625, 24626,
+        24627, 24628, 24629, 24630, 24631, 24632, 24633, 24634, 24635, 24636, 24637, 24638, 24639, 24640, 24641, 24642,
+        24643, 24644, 24645, 24646, 24647, 24648, 24649, 24650, 24651, 24652, 24653, 24654, 24655, 24656, 24657, 24658,
+        24659, 24660, 24661, 24662, 24663, 24664, 24665, 24666, 24667, 24668, 24669, 24670, 24671, 24672, 24673, 24674,
+        24675, 24676, 24677, 24678, 24679, 24680, 24681, 24682, 24683, 24684, 24685, 24686, 24687, 24688, 24689, 24690,
+        24691, 24692, 24693, 24694, 24695, 24696, 24697, 24698, 24699, 24700, 24701, 24702, 24703, 24704, 24705, 24706,
+        24707, 24708, 24709, 24710, 24711, 24712, 24713, 24714, 24715, 24716, 24717, 24718, 24719, 24720, 24721, 24722,
+        24723, 24724, 24725, 24726, 24727, 24728, 24729, 24730, 24731, 24732, 24733, 24734, 24735, 24736, 24737, 24738,
+        24739, 24740, 24741, 24742, 24743, 24744, 24745, 24746, 24747, 24748, 24749, 24750, 24751, 24752, 24753, 24754,
+        24755, 24756, 24757, 24758, 24759, 24760, 24761, 24762, 24763, 24764, 24765, 24766, 24767, 24768, 24769, 24770,
+        24771, 24772, 24773, 24774, 24775, 24776, 24777, 24778, 24779, 24780, 24781, 24782, 24783, 24784, 24785, 24786,
+        24787, 24788, 24789, 24790, 24791, 24792, 24793, 24794, 24795, 24796, 24797, 24798, 24799, 24800, 24801, 24802,
+        24803, 24804, 24805, 24806, 24807, 24808, 24809, 24810, 24811, 24812, 24813, 24814, 24815, 24816, 24817, 24818,
+        24819, 24820, 24821, 24822, 24823, 24824, 24825, 24826, 24827, 24828, 24829, 24830, 24831, 24832, 24833, 24834,
+        24835, 24836, 24837, 24838, 24839, 24840, 24841, 24842, 24843, 24844, 24845, 24846, 24847, 24848, 24849, 24850,
+        24851, 24852, 24853, 24854, 24855, 24856, 24857, 24858, 24859, 24860, 24861, 24862, 24863, 24864, 24865, 24866,
+        24867, 24868, 24869, 24870, 24871, 24872, 24873, 24874, 24875, 24876, 24877, 24878, 24879, 24880, 24881, 24882,
+        24883, 24884, 24885, 24886, 24887, 24888, 24889, 24890, 24891, 24892, 24893, 24894, 24895, 24896, 24897, 24898,
+        24899, 24900, 24901, 24902, 24903, 24904, 24905, 24906, 24907, 24908, 24909, 24910, 24911, 24912, 24913, 24914,
+        24915, 24916, 24917, 24918, 24919, 24920, 24921, 24922, 24923, 24924, 24925, 24926, 24927, 24928, 24929, 24930,
+        24931, 24932, 24933, 24934, 24935, 24936, 24937, 24938, 24939, 24940, 24941, 24942, 24943, 24944, 24945, 24946,
+        24947, 24948, 24949, 24950, 24951, 24952, 24953, 24954, 24955, 24956, 0, 0, 0, 0, 0, 0,
+        25, 26, 27, 28, 29, 30, 31, 32, 26, 27, 28, 29, 30, 31, 32, 27,
+        28, 29, 30, 31, 32, 24, 25, 26, 27, 28, 29, 30, 31, 32, 24, 25,
+        26, 27, 28, 25, 26, 26, 27, 28, 29, 30, 31, 32, 24, 25, 26, 26,
+        27, 28, 24957, 24958, 24, 25, 26, 26, 27, 28, 26, 26, 27, 27, 27, 27,
+        29, 30, 30, 30, 31, 31, 32, 32, 32, 32, 25, 26, 27, 28, 29, 24,
+        25, 26, 27, 27, 28, 28, 25, 26, 24, 25, 24959, 24960, 24961, 24962, 24963, 24964,
+        24965, 24966, 24967, 24968, 24969, 24970, 24971, 24972, 24973, 27, 28, 29, 30, 31, 32, 0,
+        24974, 24975, 24976, 24977, 24978, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        24979, 24980, 24981, 24982, 24983, 24984, 24985, 24986, 24987, 24988, 24989, 24990, 24991, 24992, 24993, 24994,
+        24995, 24996, 24997, 24998, 24999, 25000, 25001, 25002, 25003, 25004, 25005, 25006, 25007, 25008, 25009, 25010,
+        25011, 25012, 25013, 25014, 25015, 25016, 25017, 25018, 25019, 25020, 25021, 25022, 25023, 25024, 25025, 25026,
+        25027, 25028, 25029, 25030, 25031, 25032, 25033, 25034, 25035, 25036, 25037, 25038, 25039, 25040, 25041, 25042,
+        25043, 25044, 25045, 25046, 25047, 25048, 25049, 25050, 25051, 25052, 25053, 25054, 25055, 25056, 25057, 25058,
+        25059, 25060, 25061, 25062, 25063, 25064, 25065, 25066, 25067, 25068, 25069, 25070, 25071, 25072, 25073, 25074,
+        25075, 25076, 25077, 25078, 25079, 25080, 25081, 25082, 25083, 25084, 25085, 25086, 25087, 25088, 25089, 25090,
+        25091, 25092, 25093, 25094, 25095, 25096, 25097, 25098, 25099, 25100, 25101, 25102, 25103, 25104, 25105, 25106,
+        25107, 25108, 25109, 25110, 25111, 25112, 25113, 25114, 25115, 25116, 25117, 25118, 25119, 25120, 25121, 25122,
+        25123, 25124, 25125, 25126, 25127, 25128, 25129, 25130, 25131, 25132, 25133, 25134, 25135, 25136, 25137, 25138,
+        25139, 25140, 25141, 25142, 25143, 25144, 25145, 25146, 25147, 25148, 25149, 25150, 25151, 25152, 25153, 25154,
+        25155, 25156, 25157, 25158, 25159, 25160, 25161, 25162, 25163, 25164, 25165, 25166, 25167, 25168, 25169, 25170,
+        25171, 25172, 25173, 25174, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        25175, 25176, 25177, 25178, 25179, 25180, 25181, 25182, 25183, 25184, 25185, 25186, 25187, 25188, 25189, 25190,
+        25191, 25192, 25193, 25194, 25195, 25196, 25197, 25198, 25199, 25200, 25201, 25202, 25203, 25204, 25205, 25206,
+        25207, 25208, 25209, 25210, 25211, 25212, 25213, 25214, 25215, 25216, 25217, 25218, 25219, 25220, 25221, 25222,
+        25223, 25224, 25225, 25226, 25227, 25228, 25229, 25230, 25231, 25232, 25233, 25234, 25235, 25236, 25237, 25238,
+        25239, 25240, 25241, 25242, 25243, 25244, 25245, 25246, 25247, 25248, 25249, 25250, 25251, 25252, 25253, 25254,
+        25255, 25256, 25257, 25258, 25259, 25260, 25261, 25262, 25263, 25264, 25265, 25266, 25267, 25268, 25269, 25270,
+        25271, 25272, 25273, 25274, 25275, 25276, 25277, 25278, 25279, 25280, 25281, 25282, 25283, 25284, 25285, 25286,
+        25287, 25288, 25289, 25290, 25291, 25292, 25293, 25294, 25295, 25296, 25297, 25298, 25299, 25300, 25301, 25302,
+        25303, 25304, 25305, 25306, 25307, 25308, 25309, 25310, 25311, 25312, 25313, 25314, 25315, 25316, 25317, 25318,
+        25319, 25320, 25321, 25322, 25323, 25324, 25325, 25326, 25327, 25328, 25329, 25330, 25331, 25332, 25333, 25334,
+        25335, 25336, 25337, 25338, 25339, 25340, 25341, 25342, 25343, 25344, 25345, 25346, 25347, 25348, 25349, 25350,
+        25351, 25352, 25353, 25354, 25355, 25356, 25357, 25358, 25359, 25360, 25361, 25362, 25363, 25364, 25365, 25366,
+        25367, 25368, 25369, 25370, 25371, 25372, 25373, 25374, 25375, 25376, 25377, 25378, 25379, 25380, 25381, 25382,
+        25383, 25384, 25385, 25386, 25387, 25388, 25389, 25390, 25391, 25392, 25393, 25394, 25395, 25396, 25397, 25398,
+        25399, 25400, 25401, 25402, 25403, 25404, 25405, 25406, 25407, 25408, 25409, 25410, 25411, 25412, 25413, 25414,
+        25415, 25416, 25417, 25418, 25419, 25420, 25421, 25422, 25423, 25424, 25425, 25426, 25427, 25428, 25429, 25430,
+        25431, 25432, 25433, 25434, 25435, 25436, 25437, 25438, 25439, 25440, 25441, 25442, 25443, 25444, 25445, 25446,
+        25447, 25448, 25449, 25450, 25451, 25452, 25453, 25454, 25455, 25456, 25457, 25458, 25459, 25460, 25461, 25462,
+        25463, 25464, 25465, 25466, 25467, 25468, 25469, 25470, 25471, 25472, 25473, 25474, 25475, 25476, 25477, 25478,
+        25479, 25480, 25481, 25482, 25483, 25484, 25485, 25486, 25487, 25488, 25489, 25490, 25491, 25492, 25493, 25494,
+        25495, 25496, 25497, 25498, 25499, 25500, 25501, 25502, 25503, 25504, 25505, 25506, 25507, 25508, 25509, 25510,
+        25511, 25512, 25513, 25514, 25515, 25516, 25517, 25518, 25519, 25520, 25521, 25522, 25523, 25524, 25525, 25526,
+        25527, 25528, 25529, 25530, 25531, 25532, 25533, 25534, 25535, 25536, 25537, 25538, 25539, 25540, 25541, 25542,
+        25543, 25544, 25545, 25546, 25547, 25548, 25549, 25550, 25551, 25552, 25553, 25554, 25555, 25556, 25557, 25558,
+        25559, 25560, 25561, 25562, 25563, 25564, 25565, 25566, 25567, 25568, 25569, 25570, 25571, 25572, 25573, 25574,
+        25575, 25576, 25577, 25578, 25579, 25580, 25581, 25582, 25583, 25584, 25585, 25586, 25587, 25588, 25589, 25590,
+        25591, 25592, 25593, 25594, 25595, 25596, 25597, 25598, 25599, 25600, 25601, 25602, 25603, 25604, 25605, 25606,
+        25607, 25608, 25609, 25610, 25611, 25612, 25613, 25614, 25615, 25616, 25617, 25618, 25619, 25620, 25621, 25622,
+        25623, 25624, 25625, 25626, 25627, 25628, 25629, 25630, 25631, 25632, 25633, 25634, 25635, 25636, 25637, 25638,
+        25639, 25640, 25641, 25642, 25643, 25644, 25645, 25646, 25647, 25648, 25649, 25650, 25651, 25652, 25653, 25654,
+        25655, 25656, 25657, 25658, 25659, 25660, 25661, 25662, 25663, 25664, 25665, 25666, 25667, 25668, 25669, 25670,
+        25671, 25672, 25673, 25674, 25675, 25676, 25677, 25678, 25679, 25680, 25681, 25682, 25683, 25684, 25685, 25686,
+        25687, 25688, 25689, 25690, 25691, 25692, 25693, 25694, 25695, 25696, 25697, 25698, 25699, 25700, 25701, 25702,
+        25703, 25704, 25705, 25706, 25707, 25708, 25709, 25710, 25711, 25712, 25713, 25714, 25715, 25716, 25717, 25718,
+        25719, 25720, 25721, 25722, 25723, 25724, 25725, 25726, 25727, 25728, 25729, 25730, 25731, 25732, 25733, 25734,
+        25735, 25736, 25737, 25738, 25739, 25740, 25741, 25742, 25743, 25744, 25745, 25746, 25747, 25748, 25749, 25750,
+        25751, 25752, 25753, 25754, 25755, 25756, 25757, 25758, 25759, 25760, 25761, 25762, 25763, 25764, 25765, 25766,
+        25767, 25768, 25769, 25770, 25771, 25772, 25773, 25774, 25775, 25776, 25777, 25778, 25779, 25780, 25781, 25782,
+        25783, 25784, 25785, 25786, 25787, 25788, 25789, 25790, 25791, 25792, 25793, 25794, 25795, 25796, 25797, 25798,
+        25799, 25800, 25801, 25802, 25803, 25804, 25805, 25806, 25807, 25808, 25809, 25810, 25811, 25812, 25813, 25814,
+        25815, 25816, 25817, 25818, 25819, 25820, 25821, 25822, 25823, 25824, 25825, 25826, 25827, 25828, 25829, 25830,
+        25831, 25832, 25833, 25834, 25835, 25836, 25837, 25838, 25839, 25840, 25841, 25842, 25843, 25844, 25845, 25846,
+        25847, 25848, 25849, 25850, 25851, 25852, 25853, 25854, 25855, 25856, 25857, 25858, 25859, 25860, 25861, 25862,
+        25863, 25864, 25865, 25866, 25867, 25868, 25869, 25870, 25871, 25872, 25873, 25874, 25875, 25876, 25877, 25878,
+        25879, 25880, 25881, 25882, 25883, 25884, 25885, 25886, 25887, 25888, 25889, 25890, 25891, 25892, 25893, 25894,
+        25895, 25896, 25897, 25898, 25899, 25900, 25901, 25902, 25903, 25904, 25905, 25906, 25907, 25908, 25909, 25910,
+        25911, 25912, 25913, 25914, 25915, 25916, 25917, 25918, 25919, 25920, 25921, 25922, 25923, 25924, 25925, 25926,
+        25927, 25928, 25929, 25930, 25931, 25932, 25933, 25934, 25935, 25936, 25937, 25938, 25939, 25940, 25941, 25942,
+        25943, 25944, 25945, 25946, 25947, 25948, 25949, 25950, 25951, 25952, 25953, 25954, 25955, 25956, 25957, 25958,
+        25959, 25960, 25961, 25962, 25963, 25964, 25965, 25966, 25967, 25968, 25969, 25970, 25971, 25972, 25973, 25974,
+        25975, 25976, 25977, 25978, 25979, 25980, 25981, 25982, 25983, 25984, 25985, 25986, 25987, 25988, 25989, 25990,
+        25991, 25992, 25993, 25994, 25995, 25996, 25997, 25998, 25999, 26000, 26001, 26002, 26003, 26004, 26005, 26006,
+        26007, 26008, 26009, 26010, 26011, 26012, 26013, 26014, 26015, 26016, 26017, 26018, 26019, 26020, 26021, 26022,
+        26023, 26024, 26025, 26026, 26027, 26028, 26029, 26030, 26031, 26032, 26033, 26034, 26035, 26036, 26037, 26038,
+        26039, 26040, 26041, 26042, 26043, 26044, 26045, 26046, 26047, 26048, 26049, 26050, 26051, 26052, 26053, 26054,
+        26055, 26056, 26057, 26058, 26059, 26060, 26061, 26062, 26063, 26064, 26065, 26066, 26067, 26068, 26069, 26070,
+        26071, 26072, 26073, 26074, 26075, 26076, 26077, 26078, 26079, 26080, 26081, 26082, 26083, 26084, 26085, 26086,
+        26087, 26088, 26089, 26090, 26091, 26092, 26093, 26094, 26095, 26096, 26097, 26098, 26099, 26100, 26101, 26102,
+        26103, 26104, 26105, 26106, 26107, 26108, 26109, 26110, 26111, 26112, 26113, 26114, 26115, 26116, 26117, 26118,
+        26119, 26120, 26121, 26122, 26123, 26124, 26125, 26126, 26127, 26128, 26129, 26130, 26131, 26132, 26133, 26134,
+        26135, 26136, 26137, 26138, 26139, 26140, 26141, 26142, 26143, 26144, 26145, 26146, 26147, 26148, 26149, 26150,
+        26151, 26152, 26153, 26154, 26155, 26156, 26157, 26158, 26159, 26160, 26161, 26162, 26163, 26164, 26165, 26166,
+        26167, 26168, 26169, 26170, 26171, 26172, 26173, 26174, 26175, 26176, 26177, 26178, 26179, 26180, 26181, 26182,
+        26183, 26184, 26185, 26186, 26187, 26188, 26189, 26190, 26191, 26192, 26193, 26194, 26195, 26196, 26197, 26198,
+        26199, 26200, 26201, 26202, 26203, 26204, 26205, 26206, 26207, 26208, 26209, 26210, 26211, 26212, 26213, 26214,
+        26215, 26216, 26217, 26218, 26219, 26220, 26221, 26222, 26223, 26224, 26225, 26226, 26227, 26228, 26229, 26230,
+        26231, 26232, 26233, 26234, 26235, 26236, 26237, 26238, 26239, 26240, 26241, 26242, 26243, 26244, 26245, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+        26246, 26247, 26248, 26249, 26250, 26251, 26252, 26253, 26254, 26255, 26256, 26257, 26258, 26259, 26260, 26261,
+        26262, 26263, 26264, 26265, 26266, 26267, 26268, 26269, 26270, 26271, 26272, 26273, 26274, 26275, 26276, 26277,
+        26278, 26279, 26280, 26281, 26282, 26283, 26284, 26285, 26286, 26287, 26288, 26289, 26290, 26291, 26292, 26293,
+        26294, 26295, 26296, 26297, 26298, 26299, 26300, 26301, 26302, 26303, 26304, 26305, 26306, 26307, 26308, 26309,
+        26310, 26311, 26312, 26313, 26314, 26315, 26316, 26317, 26318, 26319, 26320, 26321, 26322, 26323, 26324, 26325,
+        26326, 26327, 26328, 26329, 26330, 26331, 26332, 26333, 26334, 26335, 26336, 26337, 26338, 26339, 26340, 26341,
+        26342, 26343, 26344, 26345, 26346, 26347, 26348, 26349, 26350, 26351, 26352, 26353, 26354, 26355, 26356, 26357,
+        26358, 26359, 26360, 26361, 26362, 26363, 26364, 26365, 26366, 26367, 26368, 26369, 26370, 26371, 26372, 26373,
+        26374, 26375, 26376, 26377, 26378, 26379, 26380, 26381, 26382, 26383, 26384, 26385, 26386, 26387, 26388, 26389,
+        26390, 26391, 26392, 26393, 26394, 26395, 26396, 26397, 26398, 26399, 26400, 26401, 26402, 26403, 26404, 26405,
+        26406, 26407, 26408, 26409, 26410, 26411, 26412, 26413, 26414, 26415, 26416, 26417, 26418, 26419, 26420, 26421,
+        26422, 26423, 26424, 26425, 26426, 26427, 26428, 26429, 26430, 26431, 26432, 26433, 26434, 26435, 26436, 26437,
+        26438, 26439, 26440, 26441, 26442, 26443, 26444, 26445, 26446, 26447, 26448, 26449, 26450, 26451, 26452, 26453,
+        26454, 26455, 26456, 26457, 26458, 26459, 26460, 26461, 26462, 26463, 26464, 26465, 26466, 26467, 26468, 26469,
+        26470, 26471, 26472, 26473, 26474, 26475, 26476, 26477, 26478, 26479, 26480, 26481, 26482, 26483, 26484, 26485,
+        26486, 26487, 26488, 26489, 26490, 26491, 26492, 26493, 26494, 26495, 26496, 26497, 26498, 26499, 26500, 26501,
+        26502, 26503, 26504, 26505, 26506, 26507, 26508, 26509, 26510, 26511, 26512, 26513, 26514, 26515, 26516, 26517,
+        26518, 26519, 26520, 26521, 26522, 26523, 26524, 26525, 26526, 26527, 26528, 26529, 26530, 26531, 26532, 26533,
+        26534, 26535, 26536, 26537, 26538, 26539, 26540, 26541, 26542, 26543, 26544, 26545, 26546, 26547, 26548, 26549,
+        26550, 26551, 26552, 26553, 26554, 26555, 26556, 26557, 26558, 26559, 26560, 26561, 26562, 26563, 26564, 26565,
+        26566, 26567, 26568, 26569, 26570, 26571, 26572, 26573, 26574, 26575, 26576, 26577, 26578, 26579, 26580, 26581,
+        26582, 26583, 26584, 26585, 26586, 26587, 26588, 26589, 26590, 26591, 26592, 26593, 26594, 26595, 26596, 26597,
+        26598, 26599, 26600, 26601, 26602, 26603, 26604, 26605, 26606, 26607, 26608, 26609, 26610, 26611, 26612, 26613,
+        26614, 26615, 26616, 26617, 26618, 26619, 26620, 26621, 26622, 26623, 26624, 26625, 26626, 26627, 26628, 26629,
+        26630, 26631, 26632, 26633, 26634, 26635, 26636, 26637, 26638, 26639, 26640, 26641, 26642, 26643, 26644, 26645,
+        26646, 26647, 26648, 26649, 26650, 26651, 26652, 26653, 26654, 26655, 26656, 26657, 26658, 26659, 26660, 26661,
+        26662, 26663, 26664, 26665, 26666, 26667, 26668, 26669, 26670, 26671, 26672, 26673, 26674, 26675, 26676, 26677,
+        26678, 26679, 26680, 26681, 26682, 26683, 26684, 26685, 26686, 26687, 26688, 26689, 26690, 26691, 26692, 26693,
+        26694, 26695, 26696, 26697, 26698, 26699, 26700, 26701, 26702, 26703, 26704, 26705, 26706, 26707, 26708, 26709,
+        26710, 26711, 26712, 26713, 26714, 26715, 26716, 26717, 26718, 26719, 26720, 26721, 26722, 26723, 26724, 26725,
+        26726, 26727, 26728, 26729, 26730, 26731, 26732, 26733, 26734, 26735, 26736, 26737, 26738, 26739, 26740, 26741,
+        26742, 26743, 26744, 26745, 26746, 26747, 26748, 26749, 26750, 26751, 26752, 26753, 26754, 26755, 26756, 26757,
+        26758, 26759, 26760, 26761, 26762, 26763, 26764, 26765, 26766, 26767, 26768, 26769, 26770, 26771, 26772, 26773,
+        26774, 26775, 26776, 26777, 26778, 26779, 26780, 26781, 26782, 26783, 26784, 26785, 26786, 26787, 26788, 26789,
+        26790, 26791, 26792, 26793, 26794, 26795, 26796, 26797, 26798, 26799, 26800, 26801, 26802, 26803, 26804, 26805,
+        26806, 26807, 26808, 26809, 26810, 26811, 26812, 26813, 26814, 26815, 26816, 26817, 26818, 26819, 26820, 26821,
+        26822, 26823, 26824, 26825, 26826, 26827, 26828, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        26829, 26830, 26831, 26832, 26833, 26834, 26835, 26836, 26837, 26838, 26839, 26840, 26841, 26842, 26843, 26844,
+        26845, 26846, 26847, 26848, 26849, 26850, 26851, 26852, 26853, 26854, 26855, 26856, 26857, 26858, 26859, 26860,
+        26861, 26862, 26863, 26864, 26865, 26866, 26867, 26868, 26869, 26870, 26871, 26872, 26873, 26874, 26875, 26876,
+        26877, 26878, 26879, 26880, 26881, 26882, 26883, 26884, 26885, 26886, 26887, 26888, 26889, 26890, 26891, 26892,
+        26893, 26894, 26895, 26896, 26897, 26898, 26899, 26900, 26901, 26902, 26903, 26904, 26905, 26906, 26907, 26908,
+        26909, 26910, 26911, 26912, 26913, 26914, 26915, 26916, 26917, 26918, 26919, 26920, 26921, 26922, 26923, 26924,
+        26925, 26926, 26927, 26928, 26929, 26930, 26931, 26932, 26933, 26934, 26935, 26936, 26937, 26938, 26939, 26940,
+        26941, 26942, 26943, 26944, 26945, 26946, 26947, 26948, 26949, 26950, 26951, 26952, 26953, 26954, 26955, 26956,
+        26957, 26958, 26959, 26960, 26961, 26962, 26963, 26964, 26965, 26966, 26967, 26968, 26969, 26970, 26971, 26972,
+        26973, 26974, 26975, 26976, 26977, 26978, 26979, 26980, 26981, 26982, 26983, 26984, 26985, 26986, 26987, 26988,
+        26989, 26990, 26991, 26992, 26993, 26994, 26995, 26996, 26997, 26998, 26999, 27000, 27001, 27002, 27003, 27004,
+        27005, 27006, 27007, 27008, 27009, 27010, 27011, 27012, 27013, 27014, 27015, 27016, 27017, 27018, 27019, 27020,
+        27021, 27022, 27023, 27024, 27025, 27026, 27027, 27028, 27029, 27030, 27031, 27032, 27033, 27034, 27035, 27036,
+        27037, 27038, 27039, 27040, 27041, 27042, 27043, 27044, 27045, 27046, 27047, 27048, 27049, 27050, 27051, 27052,
+        27053, 27054, 27055, 27056, 27057, 27058, 27059, 27060, 27061, 27062, 27063, 27064, 27065, 27066, 27067, 27068,
+        27069, 27070, 27071, 27072, 27073, 27074, 27075, 27076, 27077, 27078, 27079, 27080, 27081, 27082, 27083, 27084,
+        27085, 27086, 27087, 27088, 27089, 27090, 27091, 27092, 27093, 27094, 27095, 27096, 27097, 27098, 27099, 27100,
+        27101, 27102, 27103, 27104, 27105, 27106, 27107, 27108, 27109, 27110, 27111, 27112, 27113, 27114, 27115, 27116,
+        27117, 27118, 27119, 27120, 27121, 27122, 27123, 27124, 27125, 27126, 27127, 27128, 27129, 27130, 27131, 27132,
+        27133, 27134, 27135, 27136, 27137, 27138, 27139, 27140, 27141, 27142, 27143, 27144, 27145, 27146, 27147, 27148,
+        27149, 27150, 27151, 27152, 27153, 27154, 27155, 27156, 27157, 27158, 27159, 27160, 27161, 27162, 27163, 27164,
+        27165, 27166, 27167, 27168, 27169, 27170, 27171, 27172, 27173, 27174, 27175, 27176, 27177, 27178, 27179, 27180,
+        27181, 27182, 27183, 27184, 27185, 27186, 27187, 27188, 27189, 27190, 27191, 27192, 27193, 27194, 27195, 27196,
+        27197, 27198, 27199, 27200, 27201, 27202, 27203, 27204, 27205, 27206, 27207, 27208, 27209, 27210, 27211, 27212,
+        27213, 27214, 27215, 27216, 27217, 27218, 27219, 27220, 27221, 27222, 27223, 27224, 27225, 27226, 27227, 27228,
+        27229, 27230, 27231, 27232, 27233, 27234, 27235, 27236, 27237, 27238, 27239, 27240, 27241, 27242, 27243, 27244,
+        27245, 27246, 27247, 27248, 27249, 27250, 27251, 27252, 27253, 27254, 27255, 27256, 27257, 27258, 27259, 27260,
+        27261, 27262, 27263, 27264, 27265, 27266, 27267, 27268, 27269, 27270, 27271, 27272, 27273, 27274, 27275, 27276,
+        27277, 27278, 27279, 27280, 27281, 27282, 27283, 27284, 27285, 27286, 27287, 27288, 27289, 27290, 27291, 27292,
+        27293, 27294, 27295, 27296, 27297, 27298, 27299, 27300, 27301, 27302, 27303, 27304, 27305, 27306, 27307, 27308,
+        27309, 27310, 27311, 27312, 27313, 27314, 27315, 27316, 27317, 27318, 27319, 27320, 27321, 27322, 27323, 27324,
+        27325, 27326, 27327, 27328, 27329, 27330, 27331, 27332, 27333, 27334, 27335, 27336, 27337, 27338, 27339, 27340,
+        27341, 27342, 27343, 27344, 27345, 27346, 27347, 27348, 27349, 27350, 27351, 27352, 27353, 27354, 27355, 27356,
+        27357, 27358, 27359, 27360, 27361, 27362, 27363, 27364, 27365, 27366, 27367, 27368, 27369, 27370, 27371, 27372,
+        27373, 27374, 27375, 27376, 27377, 27378, 27379, 27380, 27381, 27382, 27383, 27384, 27385, 27386, 27387, 27388,
+        27389, 27390, 27391, 27392, 27393, 27394, 27395, 27396, 27397, 0, 0, 0, 0, 0, 0, 0,
+        27398, 27399, 27400, 27401, 27402, 27403, 27404, 27405, 27406, 27407, 27408, 27409, 27410, 27411, 27412, 27413,
+        27414, 27415, 27416, 27417, 27418, 27419, 27420, 27421, 27422, 27423, 27424, 27425, 27426, 27427, 27428, 0,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 0, 0, 0, 0, 27429, 27430,
+        27431, 27432, 27433, 27434, 27435, 27436, 27437, 27438, 27439, 27440, 27441, 27442, 27443, 27444, 27445, 27446,
+        27447, 27448, 27449, 27450, 27451, 27452, 27453, 27454, 27455, 27456, 27457, 27458, 27459, 27460, 0, 0,
+        27461, 27462, 27463, 27464, 27465, 27466, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        27467, 27468, 27469, 27470, 27471, 27472, 27473, 27474, 27475, 27476, 27477, 27478, 27479, 27480, 27481, 27482,
+        27483, 27484, 27485, 27486, 27487, 27488, 27489, 27490, 27491, 27492, 27493, 27494, 27495, 27496, 27497, 27498,
+        27499, 27500, 27501, 27502, 27503, 27504, 27505, 27506, 27507, 27508, 27509, 27510, 27511, 27512, 27513, 27514,
+        27515, 27516, 27517, 27518, 27519, 27520, 27521, 27522, 27523, 27524, 27525, 27526, 27527, 27528, 27529, 27530,
+        27531, 27532, 27533, 27534, 27535, 27536, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 0, 27537, 27538, 27539, 27540, 27541,
+        27542, 27543, 0, 27544, 27545, 27546, 27547, 27548, 27549, 27550, 27551, 27552, 27553, 27554, 27555, 27556,
+        27557, 27558, 27559, 27560, 27561, 27562, 27563, 27564, 0, 0, 0, 0, 0, 27565, 27566, 27567,
+        27568, 27569, 27570, 27571, 27572, 27573, 27574, 27575, 27576, 27577, 27578, 27579, 27580, 27581, 27582, 27583,
+        27584, 27585, 27586, 27587, 27588, 27589, 27590, 27591, 27592, 27593, 27594, 27595, 27596, 27597, 27598, 27599,
+        27600, 27601, 27602, 27603, 27604, 27605, 27606, 27607, 27608, 27609, 27610, 27611, 27612, 27613, 27614, 27615,
+        27616, 27617, 27618, 27619, 27620, 27621, 27622, 27623, 27624, 27625, 27626, 27627, 27628, 27629, 27630, 27631,
+        27632, 27633, 27634, 27635, 27636, 27637, 27638, 27639, 27640, 27641, 27642, 27643, 27644, 27645, 27646, 27647,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 27648, 27649, 27650, 27651, 27652, 27653,
+        27654, 27655, 27656, 27657, 27658, 27660, 27662, 27664, 27665, 27666, 27667, 0, 0, 0, 0, 0,
+        27668, 27669, 27670, 27671, 27672, 27673, 27674, 27675, 27676, 27677, 27678, 27679, 27680, 27681, 27682, 27683,
+        27684, 27685, 27686, 27687, 27688, 27689, 27690, 27691, 27692, 27693, 27694, 27695, 27696, 27697, 27698, 27699,
+        27700, 27701, 27702, 27703, 27704, 27705, 27706, 27707, 27708, 27709, 27710, 27711, 27712, 27713, 27714, 27715,
+        27716, 27717, 27718, 27719, 27720, 27721, 27722, 27723, 27724, 27725, 27726, 27727, 27728, 27729, 27730, 27731,
+        27732, 27733, 27734, 27735, 27736, 27737, 27738, 27739, 27740, 27741, 27742, 0, 0, 0, 0, 27743,
+        27744, 27745, 27746, 27747, 27748, 27749, 27750, 27751, 27752, 27753, 27754, 27755, 27756, 27757, 27758, 27759,
+        27760, 27761, 27762, 27763, 27764, 27765, 27766, 27767, 27768, 27769, 27770, 27771, 27772, 27773, 27774, 27775,
+        27776, 27777, 27778, 27779, 27780, 27781, 27782, 27783, 27784, 27785, 27786, 27787, 27788, 27789, 27790, 27791,
+        27792, 27793, 27794, 27795, 27796, 27797, 27798, 27799, 0, 0, 0, 0, 0, 0, 0, 27800,
+        27801, 27802, 27803, 27804, 27805, 27806, 27807, 27808, 27809, 27810, 27811, 27812, 27813, 27814, 27815, 27816,
+        27817, 27818, 27819, 27820, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        27821, 27822, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        27823, 27824, 27825, 27826, 27827, 27828, 27829, 27830, 27831, 27832, 27833, 27834, 27835, 27836, 27837, 27838,
+        27839, 27840, 27841, 27842, 27843, 27844, 27845, 27846, 27847, 27848, 27849, 27850, 27851, 27852, 27853, 27854,
+        27855, 27856, 27857, 27858, 27859, 27860, 27861, 27862, 27863, 27864, 27865, 27866, 27867, 27868, 27869, 27870,
+        27871, 27872, 27873, 27874, 27875, 27876, 27877, 27878, 27879, 27880, 27881, 27882, 27883, 27884, 27885, 27886,
+        27887, 27888, 27889, 27890, 27891, 27892, 27893, 27894, 27895, 27896, 27897, 27898, 27899, 27900, 27901, 27902,
+        27903, 27904, 27905, 27906, 27907, 27908, 27909, 27910, 27911, 27912, 27913, 27914, 27915, 27916, 27917, 27918,
+        27919, 27920, 27921, 27922, 27923, 27924, 27925, 27926, 27927, 27928, 27929, 27930, 27931, 27932, 27933, 27934,
+        27935, 27936, 27937, 27938, 27939, 27940, 27941, 27942, 27943, 27944, 27945, 27946, 27947, 27948, 27949, 27950,
+        27951, 27952, 27953, 27954, 27955, 27956, 27957, 27958, 27959, 27960, 27961, 27962, 27963, 27964, 27965, 27966,
+        27967, 27968, 27969, 27970, 27971, 27972, 27973, 27974, 27975, 27976, 27977, 27978, 27979, 27980, 27981, 27982,
+        27983, 27984, 27985, 27986, 27987, 27988, 27989, 27990, 27991, 27992, 27993, 27994, 27995, 27996, 27997, 27998,
+        27999, 28000, 28001, 28002, 28003, 28004, 28005, 28006, 28007, 28008, 28009, 28010, 28011, 28012, 28013, 28014,
+        28015, 28016, 28017, 28018, 28019, 28020, 28021, 28022, 28023, 28024, 28025, 28026, 28027, 28028, 28029, 28030,
+        28031, 28032, 28033, 28034, 28035, 28036, 28037, 28038, 28039, 28040, 28041, 28042, 28043, 28044, 28045, 28046,
+        28047, 28048, 28049, 28050, 28051, 28052, 28053, 28054, 28055, 28056, 28057, 28058, 28059, 28060, 28061, 28062,
+        28063, 28064, 28065, 28066, 28067, 28068, 28069, 28070, 28071, 28072, 28073, 28074, 28075, 28076, 28077, 28078,
+        28079, 28080, 28081, 28082, 28083, 28084, 28085, 28086, 28087, 28088, 28089, 28090, 28091, 28092, 28093, 28094,
+        28095, 28096, 28097, 28098, 28099, 28100, 28101, 28102, 28103, 28104, 28105, 28106, 28107, 28108, 28109, 0,
+        28110, 28111, 28112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 28113, 28114, 28115, 28116, 0, 0, 0, 0, 0, 0, 0, 0,
+        28117, 28118, 28119, 28120, 28121, 28122, 28123, 28124, 28125, 28126, 28127, 28128, 28129, 28130, 28131, 28132,
+        28133, 28134, 28135, 28136, 28137, 28138, 28139, 28140, 28141, 28142, 28143, 28144, 28145, 28146, 28147, 28148,
+        28149, 28150, 28151, 28152, 28153, 28154, 28155, 28156, 28157, 28158, 28159, 28160, 28161, 28162, 28163, 28164,
+        28165, 28166, 28167, 28168, 28169, 28170, 28171, 28172, 28173, 28174, 28175, 28176, 28177, 28178, 28179, 28180,
+        28181, 28182, 28183, 28184, 28185, 28186, 28187, 28188, 28189, 28190, 28191, 28192, 28193, 28194, 28195, 28196,
+        28197, 28198, 28199, 28200, 28201, 28202, 28203, 28204, 28205, 28206, 28207, 28208, 28209, 28210, 28211, 28212,
+        28213, 28214, 28215, 28216, 28217, 28218, 28219, 28220, 28221, 28222, 28223, 0, 0, 0, 0, 0,
+        28224, 28225, 28226, 28227, 28228, 28229, 28230, 28231, 28232, 28233, 28234, 28235, 28236, 0, 0, 0,
+        28237, 28238, 28239, 28240, 28241, 28242, 28243, 28244, 28245, 0, 0, 0, 0, 0, 0, 0,
+        28246, 28247, 28248, 28249, 28250, 28251, 28252, 28253, 28254, 28255, 0, 0, 28256, 1063, 1086, 28257,
+        1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        28258, 28259, 28260, 28261, 28262, 28263, 28264, 28265, 28266, 28267, 28268, 28269, 28270, 28271, 28272, 28273,
+        28274, 28275, 28276, 28277, 28278, 28279, 28280, 28281, 28282, 28283, 28284, 28285, 28286, 28287, 28288, 28289,
+        28290, 28291, 28292, 28293, 28294, 28295, 28296, 28297, 28298, 28299, 28300, 28301, 28302, 28303, 28304, 28305,
+        28306, 28307, 28308, 28309, 28310, 28311, 28312, 28313, 28314, 28315, 28316, 28317, 28318, 28319, 28320, 28321,
+        28322, 28323, 28324, 28325, 28326, 28327, 28328, 28329, 28330, 28331, 28332, 28333, 28334, 28335, 28336, 28337,
+        28338, 28339, 28340, 28341, 28342, 28343, 28344, 28345, 28346, 28347, 28348, 28349, 28350, 28351, 28352, 28353,
+        28354, 28355, 28356, 28357, 28358, 28359, 28360, 28361, 28362, 28363, 28364, 28365, 28366, 28367, 28368, 28369,
+        28370, 28371, 28372, 28373, 28374, 28375, 28376, 28377, 28378, 28379, 28380, 28381, 28382, 28383, 28384, 28385,
+        28386, 28387, 28388, 28389, 28390, 28391, 28392, 28393, 28394, 28395, 28396, 28397, 28398, 28399, 28400, 28401,
+        28402, 28403, 28404, 28405, 28406, 28407, 28408, 28409, 28410, 28411, 28412, 28413, 28414, 28415, 28416, 28417,
+        28418, 28419, 28420, 28421, 28422, 28423, 28424, 28425, 28426, 28427, 28428, 28429, 28430, 28431, 28432, 28433,
+        28434, 28435, 28436, 28437, 28438, 28439, 28440, 28441, 28442, 28443, 28444, 28445, 28446, 28447, 28448, 28449,
+        28450, 28451, 28452, 28453, 28454, 28455, 28456, 28457, 28458, 28459, 28460, 28461, 28462, 28463, 28464, 28465,
+        28466, 28467, 28468, 28469, 28470, 28471, 28472, 28473, 28474, 28475, 28476, 28477, 28478, 28479, 28480, 28481,
+        28482, 28483, 28484, 28485, 28486, 28487, 28488, 28489, 28490, 28491, 28492, 28493, 28494, 28495, 28496, 28497,
+        28498, 28499, 28500, 28501, 28502, 28503, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        28504, 28505, 28506, 28507, 28508, 28509, 28510, 28511, 28512, 28513, 28514, 28515, 28516, 28517, 28518, 28519,
+        28520, 28521, 28522, 28523, 28524, 28525, 28526, 28527, 28528, 28529, 28530, 28531, 28532, 28533, 28534, 28535,
+        28536, 28537, 28538, 28539, 28540, 28541, 28542, 0, 0, 28543, 28544, 28545, 28546, 28547, 28548, 28549,
+        28550, 28551, 28552, 28553, 28554, 28555, 28556, 28557, 28558, 28559, 28560, 28561, 28562, 28563, 28564, 28565,
+        28566, 28567, 28568, 28569, 28570, 28571, 28572, 28573, 28574, 28575, 28576, 28577, 28578, 28579, 28580, 28581,
+        28582, 28583, 28584, 28585, 28586, 28587, 28588, 28589, 28590, 28591, 28592, 28593, 28594, 28595, 28596, 28598,
+        28600, 28600, 28600, 28600, 28600, 1, 1, 1, 1, 1, 28603, 28604, 28605, 1, 1, 1,
+        1, 1, 1, 28606, 28607, 1, 1, 1, 1, 1, 1, 1, 28608, 28609, 28610, 28611,
+        28612, 28613, 28614, 28615, 28616, 28617, 28618, 28619, 28620, 28621, 28622, 28623, 28624, 28625, 28626, 28627,
+        28628, 28629, 28630, 28631, 28632, 28633, 28634, 28635, 28636, 28637, 1, 1, 1, 1, 28638, 28639,
+        28640, 28641, 28642, 28643, 28644, 28645, 28646, 28647, 28648, 28649, 28650, 28651, 28653, 28655, 28658, 28655,
+        28658, 28661, 28662, 28663, 28664, 28665, 28666, 28667, 28668, 28669, 28670, 28671, 28672, 28673, 28674, 28675,
+        28676, 28677, 28678, 28679, 28680, 28681, 28682, 28683, 28684, 28685, 28686, 28687, 28688, 28689, 28690, 28691,
+        28692, 28693, 28694, 28695, 28696, 28697, 28698, 28699, 28700, 0, 0, 0, 0, 0, 0, 0,
+        28701, 28702, 28703, 28704, 28705, 28706, 28707, 28708, 28709, 28710, 28711, 28712, 28713, 28714, 28715, 28716,
+        28717, 28718, 28719, 28720, 28721, 28722, 28723, 28724, 28725, 28726, 28727, 28728, 28729, 28730, 28731, 28732,
+        28733, 28734, 28735, 28736, 28737, 28738, 28739, 28740, 28741, 28742, 28743, 28744, 28745, 28746, 28747, 28748,
+        28749, 28750, 28751, 28752, 28753, 28754, 28755, 28756, 28757, 28758, 28759, 28760, 28761, 28762, 28763, 28764,
+        28765, 28766, 1, 1, 1, 28767, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 28768, 28769, 28770, 28771, 28772, 28773,
+        28774, 28775, 28776, 28777, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        28778, 28779, 28780, 28781, 28782, 28783, 28784, 28785, 28786, 28787, 28788, 28789, 28790, 28791, 28792, 28793,
+        28794, 28795, 28796, 28797, 28798, 28799, 28800, 28801, 28802, 28803, 28804, 28805, 28806, 28807, 28808, 28809,
+        28810, 28811, 28812, 28813, 28814, 28815, 28816, 28817, 28818, 28819, 28820, 28821, 28822, 28823, 28824, 28825,
+        28826, 28827, 28828, 28829, 28830, 28831, 28832, 28833, 28834, 28835, 28836, 28837, 28838, 28839, 28840, 28841,
+        28842, 28843, 28844, 28845, 28846, 28847, 28848, 28849, 28850, 28851, 28852, 28853, 28854, 28855, 28856, 28857,
+        28858, 28859, 28860, 28861, 28862, 28863, 28864, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        24, 25, 26, 27, 28, 29, 30, 31, 32, 28865, 28866, 28867, 28868, 28869, 28870, 28871,
+        28872, 28873, 24, 25, 26, 27, 28, 24, 28, 0, 0, 0, 0, 0, 0, 0,
+        28874, 8022, 7979, 8048, 8025, 8026, 28875, 7994, 7996, 28876, 28877, 7997, 8028, 8000, 28878, 8005,
+        8006, 8007, 28879, 28880, 28881, 28882, 28883, 28884, 28885, 8018, 28886, 28887, 28888, 8049, 8024, 28889,
+        7993, 7995, 8034, 8050, 28890, 7998, 28891, 28892, 8029, 28893, 28894, 28895, 28896, 28897, 28898, 28899,
+        28900, 28901, 28902, 28903, 28874, 8022, 7979, 8048, 8025, 8026, 28875, 7994, 7996, 28876, 28877, 7997,
+        8028, 8000, 28878, 8005, 8006, 8007, 28879, 28880, 28881, 28882, 28883, 28884, 28885, 8018, 28886, 28887,
+        28888, 8049, 8024, 28889, 7993, 0, 8034, 8050, 28890, 7998, 28891, 28892, 8029, 28893, 28894, 28895,
+        28896, 28897, 28898, 28899, 28900, 28901, 28902, 28903, 28874, 8022, 7979, 8048, 8025, 8026, 28875, 7994,
+        7996, 28876, 28877, 7997, 8028, 8000, 28878, 8005, 8006, 8007, 28879, 28880, 28881, 28882, 28883, 28884,
+        28885, 8018, 28886, 28887, 28888, 8049, 8024, 28889, 7993, 7995, 8034, 8050, 28890, 7998, 28891, 28892,
+        8029, 28893, 28894, 28895, 28896, 28897, 28898, 28899, 28900, 28901, 28902, 28903, 28874, 0, 7979, 8048,
+        0, 0, 28875, 0, 0, 28876, 28877, 0, 0, 8000, 28878, 8005, 8006, 0, 28879, 28880,
+        28881, 28882, 28883, 28884, 28885, 8018, 28886, 28887, 28888, 8049, 0, 28889, 0, 7995, 8034, 8050,
+        28890, 7998, 28891, 28892, 0, 28893, 28894, 28895, 28896, 28897, 28898, 28899, 28900, 28901, 28902, 28903,
+        28900, 28901, 28902, 28903, 28874, 8022, 0, 8048, 8025, 8026, 28875, 0, 0, 28876, 28877, 7997,
+        8028, 8000, 28878, 8005, 8006, 0, 28879, 28880, 28881, 28882, 28883, 28884, 28885, 0, 28886, 28887,
+        28888, 8049, 8024, 28889, 7993, 7995, 8034, 8050, 28890, 7998, 28891, 28892, 8029, 28893, 28894, 28895,
+        28896, 28897, 28898, 28899, 28900, 28901, 28902, 28903, 28874, 8022, 0, 8048, 8025, 8026, 28875, 0,
+        7996, 28876, 28877, 7997, 8028, 0, 28878, 0, 0, 0, 28879, 28880, 28881, 28882, 28883, 28884,
+        28885, 0, 28886, 28887, 28888, 8049, 8024, 28889, 7993, 7995, 8034, 8050, 28890, 7998, 28891, 28892,
+        8029, 28893, 28894, 28895, 28896, 28897, 28898, 28899, 28900, 28901, 28902, 28903, 28874, 8022, 7979, 8048,
+        8025, 8026, 28875, 7994, 7996, 28876, 28877, 7997, 8028, 8000, 28878, 8005, 8006, 8007, 28879, 28880,
+        28881, 28882, 28883, 28884, 28885, 8018, 28886, 28887, 28888, 8049, 8024, 28889, 7993, 7995, 8034, 8050,
+        28890, 7998, 28891, 28892, 8029, 28893, 28894, 28895, 28896, 28897, 28898, 28899, 28900, 28901, 28902, 28903,
+        28900, 28901, 28902, 28903, 28904, 28905, 0, 0, 28906, 28907, 8041, 28908, 28909, 28910, 28911, 28912,
+        28913, 28914, 28915, 28916, 28917, 28918, 28919, 8042, 28920, 28912, 28921, 28922, 28923, 28924, 28925, 28926,
+        28927, 28928, 28929, 28930, 8040, 28931, 28932, 28933, 28934, 28935, 28936, 28937, 28938, 28939, 28940, 28941,
+        28942, 8039, 28943, 28944, 28944, 28945, 28946, 28947, 28948, 28949, 28950, 28951, 28932, 28935, 28937, 28947,
+        28943, 8039, 28906, 28907, 8041, 28908, 28909, 28910, 28911, 28912, 28913, 28914, 28915, 28916, 28917, 28918,
+        28919, 8042, 28920, 28912, 28921, 28922, 28923, 28924, 28925, 28926, 28927, 28928, 28929, 28930, 8040, 28931,
+        28932, 28933, 28934, 28935, 28936, 28937, 28938, 28939, 28940, 28941, 28942, 8039, 28943, 28944, 28944, 28945,
+        28946, 28947, 28948, 28949, 28950, 28951, 28932, 28935, 28937, 28947, 28943, 8039, 28906, 28907, 8041, 28908,
+        28909, 28910, 28911, 28912, 28913, 28914, 28915, 28916, 28917, 28918, 28919, 8042, 28920, 28912, 28921, 28922,
+        28923, 28924, 28925, 28926, 28927, 28928, 28929, 28930, 8040, 28931, 28932, 28933, 28934, 28935, 28936, 28937,
+        28938, 28939, 28940, 28941, 28942, 8039, 28943, 28944, 28944, 28945, 28946, 28947, 28948, 28949, 28950, 28951,
+        28932, 28935, 28937, 28947, 28943, 8039, 28906, 28907, 8041, 28908, 28909, 28910, 28911, 28912, 28913, 28914,
+        28915, 28916, 28917, 28918, 28919, 8042, 28920, 28912, 28921, 28922, 28923, 28924, 28925, 28926, 28927, 28928,
+        28929, 28930, 8040, 28931, 28932, 28933, 28934, 28935, 28936, 28937, 28938, 28939, 28940, 28941, 28942, 8039,
+        28943, 28944, 28944, 28945, 28946, 28947, 28948, 28949, 28950, 28951, 28932, 28935, 28937, 28947, 28943, 8039,
+        28906, 28907, 8041, 28908, 28909, 28910, 28911, 28912, 28913, 28914, 28915, 28916, 28917, 28918, 28919, 8042,
+        28920, 28912, 28921, 28922, 28923, 28924, 28925, 28926, 28927, 28928, 28929, 28930, 8040, 28931, 28932, 28933,
+        28934, 28935, 28936, 28937, 28938, 28939, 28940, 28941, 28942, 8039, 28943, 28944, 28944, 28945, 28946, 28947,
+        28948, 28949, 28950, 28951, 28932, 28935, 28937, 28947, 28943, 8039, 28952, 28953, 0, 0, 28954, 28955,
+        28956, 28957, 28958, 28959, 28960, 28961, 28962, 28963, 28954, 28955, 28956, 28957, 28958, 28959, 28960, 28961,
+        28962, 28963, 28954, 28955, 28956, 28957, 28958, 28959, 28960, 28961, 28962, 28963, 28954, 28955, 28956, 28957,
+        28958, 28959, 28960, 28961, 28962, 28963, 28954, 28955, 28956, 28957, 28958, 28959, 28960, 28961, 28962, 28963,
+        28964, 28965, 28966, 28967, 28968, 28969, 28970, 28971, 28972, 28973, 28974, 28975, 28976, 28977, 28978, 28979,
+        28980, 28981, 28982, 28983, 28984, 28985, 28986, 28987, 28988, 28989, 28990, 28991, 28992, 28993, 28994, 28995,
+        28996, 28997, 28998, 28999, 29000, 29001, 29002, 29003, 29004, 29005, 29006, 29007, 29008, 29009, 29010, 29011,
+        29012, 29013, 29014, 29015, 29016, 29017, 29018, 29019, 29020, 29021, 29022, 29023, 29024, 29025, 29026, 29027,
+        29028, 29029, 29030, 29031, 29032, 29033, 29034, 29035, 29036, 29037, 29038, 29039, 29040, 29041, 29042, 29043,
+        29044, 29045, 29046, 29047, 29048, 29049, 29050, 29051, 29052, 29053, 29054, 29055, 29056, 29057, 29058, 29059,
+        29060, 29061, 29062, 29063, 29064, 29065, 29066, 29067, 29068, 29069, 29070, 29071, 29072, 29073, 29074, 29075,
+        29076, 29077, 29078, 29079, 29080, 29081, 29082, 29083, 29084, 29085, 29086, 29087, 29088, 29089, 29090, 29091,
+        29092, 29093, 29094, 29095, 29096, 29097, 29098, 29099, 29100, 29101, 29102, 29103, 29104, 29105, 29106, 29107,
+        29108, 29109, 29110, 29111, 29112, 29113, 29114, 29115, 29116, 29117, 29118, 29119, 29120, 29121, 29122, 29123,
+        29124, 29125, 29126, 29127, 29128, 29129, 29130, 29131, 29132, 29133, 29134, 29135, 29136, 29137, 29138, 29139,
+        29140, 29141, 29142, 29143, 29144, 29145, 29146, 29147, 29148, 29149, 29150, 29151, 29152, 29153, 29154, 29155,
+        29156, 29157, 29158, 29159, 29160, 29161, 29162, 29163, 29164, 29165, 29166, 29167, 29168, 29169, 29170, 29171,
+        29172, 29173, 29174, 29175, 29176, 29177, 29178, 29179, 29180, 29181, 29182, 29183, 29184, 29185, 29186, 29187,
+        29188, 29189, 29190, 29191, 29192, 29193, 29194, 29195, 29196, 29197, 29198, 29199, 29200, 29201, 29202, 29203,
+        29204, 29205, 29206, 29207, 29208, 29209, 29210, 29211, 29212, 29213, 29214, 29215, 29216, 29217, 29218, 29219,
+        29220, 29221, 29222, 29223, 29224, 29225, 29226, 29227, 29228, 29229, 29230, 29231, 29232, 29233, 29234, 29235,
+        29236, 29237, 29238, 29239, 29240, 29241, 29242, 29243, 29244, 29245, 29246, 29247, 29248, 29249, 29250, 29251,
+        29252, 29253, 29254, 29255, 29256, 29257, 29258, 29259, 29260, 29261, 29262, 29263, 29264, 29265, 29266, 29267,
+        29268, 29269, 29270, 29271, 29272, 29273, 29274, 29275, 29276, 29277, 29278, 29279, 29280, 29281, 29282, 29283,
+        29284, 29285, 29286, 29287, 29288, 29289, 29290, 29291, 29292, 29293, 29294, 29295, 29296, 29297, 29298, 29299,
+        29300, 29301, 29302, 29303, 29304, 29305, 29306, 29307, 29308, 29309, 29310, 29311, 29312, 29313, 29314, 29315,
+        29316, 29317, 29318, 29319, 29320, 29321, 29322, 29323, 29324, 29325, 29326, 29327, 29328, 29329, 29330, 29331,
+        29332, 29333, 29334, 29335, 29336, 29337, 29338, 29339, 29340, 29341, 29342, 29343, 29344, 29345, 29346, 29347,
+        29348, 29349, 29350, 29351, 29352, 29353, 29354, 29355, 29356, 29357, 29358, 29359, 29360, 29361, 29362, 29363,
+        29364, 29365, 29366, 29367, 29368, 29369, 29370, 29371, 29372, 29373, 29374, 29375, 29376, 29377, 29378, 29379,
+        29380, 29381, 29382, 29383, 29384, 29385, 29386, 29387, 29388, 29389, 29390, 29391, 29392, 29393, 29394, 29395,
+        29396, 29397, 29398, 29399, 29400, 29401, 29402, 29403, 29404, 29405, 29406, 29407, 29408, 29409, 29410, 29411,
+        29412, 29413, 29414, 29415, 29416, 29417, 29418, 29419, 29420, 29421, 29422, 29423, 29424, 29425, 29426, 29427,
+        29428, 29429, 29430, 29431, 29432, 29433, 29434, 29435, 29436, 29437, 29438, 29439, 29440, 29441, 29442, 29443,
+        29444, 29445, 29446, 29447, 29448, 29449, 29450, 29451, 29452, 29453, 29454, 29455, 29456, 29457, 29458, 29459,
+        29460, 29461, 29462, 29463, 29464, 29465, 29466, 29467, 29468, 29469, 29470, 29471, 29472, 29473, 29474, 29475,
+        1, 1, 1, 1, 1, 1, 1, 29476, 29477, 29478, 29479, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 29480, 29481, 29482,
+        29483, 29484, 29485, 29486, 29487, 1, 29488, 29489, 29490, 29491, 29492, 29493, 29494, 29495, 29496, 29497,
+        29498, 29499, 29500, 29501, 1, 29502, 29503, 29504, 29505, 29506, 29507, 29508, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+        29509, 29510, 29511, 29512, 29513, 29514, 29515, 0, 29516, 29517, 29518, 29519, 29520, 29521, 29522, 29523,
+        29524, 29525, 29526, 29527, 29528, 29529, 29530, 29531, 29532, 0, 0, 29533, 29534, 29535, 29536, 29537,
+        29538, 29539, 0, 29540, 29541, 0, 29542, 29543, 29544, 29545, 29546, 0, 0, 0, 0, 0,
+        29547, 29548, 29549, 29550, 29551, 29552, 29553, 29554, 29555, 29556, 29557, 29558, 29559, 29560, 29561, 29562,
+        29563, 29564, 29565, 29566, 29567, 29568, 29569, 29570, 29571, 29572, 29573, 29574, 29575, 29576, 29577, 29578,
+        29579, 29580, 29581, 29582, 29583, 29584, 29585, 29586, 29587, 29588, 29589, 29590, 29591, 0, 0, 0,
+        27519, 27515, 27517, 27518, 27520, 27521, 27516, 29592, 29593, 29594, 29595, 29596, 29597, 29598, 0, 0,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 0, 0, 0, 0, 29599, 29600,
+        29601, 29602, 29603, 29604, 29605, 29606, 29607, 29608, 29609, 29610, 29611, 29612, 29613, 29614, 29615, 29616,
+        29617, 29618, 29619, 29620, 29621, 29622, 29623, 29624, 29625, 29626, 29627, 29628, 29629, 29630, 29631, 29632,
+        29633, 29634, 29635, 29636, 29637, 29638, 29639, 29640, 29641, 29642, 29643, 29644, 29645, 29646, 29647, 29648,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 0, 0, 0, 0, 0, 29649,
+        29650, 29651, 29652, 29653, 29654, 29655, 29656, 29657, 29658, 29659, 29660, 29661, 29662, 29663, 29664, 29665,
+        29666, 29667, 29668, 29669, 29670, 29671, 29672, 29673, 29674, 29675, 29676, 29677, 29678, 29679, 29680, 29681,
+        29682, 29683, 29684, 29685, 29686, 29687, 29688, 29689, 29690, 29691, 29692, 29693, 29694, 29695, 29696, 29697,
+        29698, 29699, 29700, 29701, 29702, 29703, 29704, 29705, 29706, 29707, 29708, 29709, 29710, 29711, 29712, 29713,
+        29714, 29715, 29716, 29717, 29718, 29719, 29720, 29721, 29722, 29723, 29724, 29725, 29726, 29727, 29728, 29729,
+        29730, 29731, 29732, 29733, 29734, 29735, 29736, 29737, 29738, 29739, 29740, 29741, 29742, 29743, 29744, 29745,
+        29746, 29747, 29748, 29749, 29750, 29751, 29752, 29753, 29754, 29755, 29756, 29757, 29758, 29759, 29760, 29761,
+        29762, 29763, 29764, 29765, 29766, 29767, 29768, 29769, 29770, 29771, 29772, 29773, 29774, 29775, 29776, 29777,
+        29778, 29779, 29780, 29781, 29782, 29783, 29784, 29785, 29786, 29787, 29788, 29789, 29790, 29791, 29792, 29793,
+        29794, 29795, 29796, 29797, 29798, 29799, 29800, 29801, 29802, 29803, 29804, 29805, 29806, 29807, 29808, 29809,
+        29810, 29811, 29812, 29813, 29814, 29815, 29816, 29817, 29818, 29819, 29820, 29821, 29822, 29823, 29824, 29825,
+        29826, 29827, 29828, 29829, 29830, 29831, 29832, 29833, 29834, 29835, 29836, 29837, 29838, 29839, 29840, 29841,
+        29842, 29843, 29844, 29845, 29846, 0, 0, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+        1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        29847, 29848, 29849, 29850, 29851, 29852, 29853, 29854, 29855, 29856, 29857, 29858, 29859, 29860, 29861, 29862,
+        29863, 29864, 29865, 29866, 29867, 29868, 29869, 29870, 29871, 29872, 29873, 29874, 29875, 29876, 29877, 29878,
+        29879, 29880, 29881, 29882, 29883, 29884, 29885, 29886, 29887, 29888, 29889, 29890, 29891, 29892, 29893, 29894,
+        29895, 29896, 29897, 29898, 29899, 29900, 29901, 29902, 29903, 29904, 29905, 29906, 29907, 29908, 29909, 29910,
+        29911, 29912, 29913, 29914, 29915, 29915, 29915, 29916, 29917, 29918, 29919, 29920, 0, 0, 0, 0,
+        23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 0, 0, 0, 0, 29921, 29922,
+        0, 24, 25, 26, 27, 28, 29, 30, 31, 32, 29923, 29924, 29925, 29926, 29927, 29928,
+        29929, 29930, 29931, 29932, 29933, 29934, 29935, 29936, 29937, 29938, 29939, 29940, 29941, 29942, 29943, 29944,
+        29945, 29946, 29947, 29948, 29949, 29950, 29951, 29952, 29953, 29954, 29955, 29956, 29957, 29958, 29959, 29960,
+        29961, 29962, 29963, 24, 25, 26, 27, 28, 29, 30, 31, 32, 29964, 29965, 29966, 29967,
+        29968, 27658, 27660, 29969, 29970, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 24, 25, 26, 27, 28, 29, 30, 31, 32, 29971, 29972, 29973, 29974, 29975, 29976,
+        29977, 29978, 29979, 29980, 29981, 29982, 29983, 29984, 29985, 29986, 29987, 29988, 29989, 29990, 29991, 29992,
+        29993, 29994, 29995, 29996, 29997, 29998, 29999, 30000, 30001, 30002, 30003, 30004, 30005, 30006, 30007, 27660,
+        30008, 30010, 30012, 30014, 30016, 30018, 30020, 30022, 30023, 30024, 30025, 30026, 30027, 30028, 0, 0,
+        30029, 30030, 30031, 30032, 0, 30033, 30034, 30035, 30036, 30037, 30038, 30039, 30040, 30041, 30042, 30043,
+        30044, 30045, 30046, 30047, 30048, 30049, 30050, 30051, 30052, 30053, 30054, 30055, 30056, 30057, 30058, 30059,
+        0, 30030, 30031, 0, 30060, 0, 0, 30035, 0, 30037, 30038, 30039, 30040, 30041, 30042, 30043,
+        30044, 30045, 30046, 0, 30048, 30049, 30050, 30051, 0, 30053, 0, 30055, 0, 0, 0, 0,
+        0, 0, 30031, 0, 0, 0, 0, 30035, 0, 30037, 0, 30039, 0, 30041, 30042, 30043,
+        0, 30045, 30046, 0, 30048, 0, 0, 30051, 0, 30053, 0, 30055, 0, 30057, 0, 30059,
+        0, 30030, 30031, 0, 30060, 0, 0, 30035, 30036, 30037, 30038, 0, 30040, 30041, 30042, 30043,
+        30044, 30045, 30046, 0, 30048, 30049, 30050, 30051, 0, 30053, 30054, 30055, 30056, 0, 30058, 0,
+        30029, 30030, 30031, 30032, 30060, 30033, 30034, 30035, 30036, 30037, 0, 30039, 30040, 30041, 30042, 30043,
+        30044, 30045, 30046, 30047, 30048, 30049, 30050, 30051, 30052, 30053, 30054, 30055, 0, 0, 0, 0,
+        0, 30030, 30031, 30032, 0, 30033, 30034, 30035, 30036, 30037, 0, 30039, 30040, 30041, 30042, 30043,
+        30061, 30062, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        30063, 30064, 30065, 30066, 30067, 30068, 30069, 30070, 30071, 30072, 30073, 30074, 30075, 30076, 30077, 30078,
+        30079, 30080, 30081, 30082, 30083, 30084, 30085, 30086, 30087, 30088, 30089, 30090, 30091, 30092, 30093, 30094,
+        30095, 30096, 30097, 30098, 30099, 30100, 30101, 30102, 30103, 30104, 30105, 30106, 0, 0, 0, 0,
+        30107, 30108, 30109, 30110, 30111, 30112, 30113, 30114, 30115, 30116, 30117, 30118, 30119, 30120, 30121, 30122,
+        30123, 30124, 30125, 30126, 30127, 30128, 30129, 30130, 30131, 30132, 30133, 30134, 30135, 30136, 30137, 30138,
+        30139, 30140, 30141, 30142, 30143, 30144, 30145, 30146, 30147, 30148, 30149, 30150, 30151, 30152, 30153, 30154,
+        30155, 30156, 30157, 30158, 30159, 30160, 30161, 30162, 30163, 30164, 30165, 30166, 30167, 30168, 30169, 30170,
+        30171, 30172, 30173, 30174, 30175, 30176, 30177, 30178, 30179, 30180, 30181, 30182, 30183, 30184, 30185, 30186,
+        30187, 30188, 30189, 30190, 30191, 30192, 30193, 30194, 30195, 30196, 30197, 30198, 30199, 30200, 30201, 30202,
+        30203, 30204, 30205, 30206, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        30207, 30208, 30209, 30210, 30211, 30212, 30213, 30214, 30215, 30216, 30217, 30218, 30219, 30220, 30221, 0,
+        0, 30222, 30223, 30224, 30225, 30226, 30227, 30228, 30229, 30230, 30231, 30232, 30233, 30234, 30235, 30236,
+        0, 30237, 30238, 30239, 30240, 30241, 30242, 30243, 30244, 30245, 30246, 30247, 30248, 30249, 30250, 30251,
+        0, 30252, 30253, 30254, 30255, 30256, 30257, 30258, 30259, 30260, 30261, 30262, 30263, 30264, 30265, 30266,
+        30267, 30268, 30269, 30270, 30271, 30272, 30273, 30274, 30275, 30276, 30277, 30278, 30279, 30280, 30281, 30282,
+        30283, 30284, 30285, 30286, 30287, 30288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        30289, 30291, 30293, 30295, 30297, 30299, 30301, 30303, 30305, 30307, 30309, 9180, 9180, 30311, 30312, 30313,
+        30314, 30317, 30320, 30323, 30326, 30329, 30332, 30335, 30338, 30341, 30344, 30347, 30350, 30353, 30356, 30359,
+        30362, 30365, 30368, 30371, 30374, 30377, 30380, 30383, 30386, 30389, 30392, 9130, 9145, 30395, 30397, 30399,
+        6412, 6416, 30400, 6418, 6419, 30401, 6421, 6422, 6423, 6424, 6425, 6426, 6427, 6428, 6430, 6432,
+        30402, 6433, 30403, 6434, 6435, 11072, 6436, 30404, 30405, 30406, 30407, 13979, 30409, 30411, 30413, 30416,
+        9128, 9129, 9130, 9131, 9132, 9133, 9134, 9135, 9136, 9137, 9138, 9139, 9140, 9141, 9142, 9143,
+        9144, 9145, 9146, 9147, 9148, 9149, 9150, 9151, 9152, 9153, 30418, 30420, 30422, 30424, 30425, 30426,
+        30402, 6433, 30403, 6434, 6435, 11072, 6436, 30404, 30405, 30406, 6432, 30427, 30429, 30431, 30433, 30416,
+        30435, 30437, 30439, 30443, 30447, 30449, 30452, 30454, 30456, 30459, 30462, 30464, 30466, 30473, 30475, 30477,
+        30479, 30482, 30485, 30489, 30492, 30496, 30497, 30499, 30502, 30508, 30516, 30519, 30522, 30525, 0, 0,
+        0, 0, 0, 0, 0, 0, 30526, 30527, 30528, 30529, 30530, 30531, 30532, 30533, 30534, 30535,
+        30536, 30537, 30538, 30539, 30540, 30541, 30542, 30543, 30544, 30545, 30546, 30547, 30548, 30549, 30550, 30551,
+        30552, 30554, 30556, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        30557, 30559, 30561, 30563, 30565, 30567, 30569, 30571, 30573, 30575, 30577, 30579, 30581, 30583, 30585, 30587,
+        30589, 30591, 30593, 30595, 30597, 30599, 30601, 30603, 30605, 30607, 30609, 30611, 30613, 30615, 30617, 30619,
+        30621, 30623, 30625, 30627, 30629, 30631, 30633, 30635, 30637, 30639, 30641, 30643, 0, 0, 0, 0,
+        30645, 30649, 30653, 30657, 30661, 30665, 30669, 30673, 30677, 0, 0, 0, 0, 0, 0, 0,
+        30681, 30683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        30685, 30686, 30687, 30688, 30689, 30690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        30691, 30692, 30693, 30694, 30695, 30696, 30697, 30698, 30699, 30700, 30701, 30702, 30703, 30704, 30705, 30706,
+        30707, 30708, 30709, 30710, 30711, 30712, 30713, 30714, 30715, 30716, 30717, 30718, 30719, 30720, 30721, 30722,
+        30723, 30724, 30725, 30726, 30727, 30728, 30729, 30730, 30731, 30732, 30733, 30734, 30735, 30736, 30737, 30738,
+        30739, 30740, 30741, 30742, 30743, 30744, 30745, 30746, 30747, 30748, 30749, 30750, 30751, 30752, 30753, 30754,
+        30755, 30756, 30757, 30758, 30759, 30760, 30761, 30762, 30763, 30764, 30765, 30766, 30767, 30768, 30769, 30770,
+        30771, 30772, 30773, 30774, 30775, 30776, 30777, 30778, 30779, 30780, 30781, 30782, 30783, 30784, 30785, 30786,
+        30787, 30788, 30789, 30790, 30791, 30792, 30793, 30794, 30795, 30796, 30797, 30798, 30799, 30800, 30801, 30802,
+        30803, 30804, 30805, 30806, 30807, 30808, 30809, 30810, 30811, 30812, 30813, 30814, 30815, 30816, 30817, 30818,
+        30819, 30820, 30821, 30822, 30823, 30824, 30825, 30826, 30827, 30828, 30829, 30830, 30831, 30832, 30833, 30834,
+        30835, 30836, 30837, 30838, 30839, 30840, 30841, 30842, 30843, 30844, 30845, 30846, 30847, 30848, 30849, 30850,
+        30851, 30852, 30853, 30854, 30855, 30856, 30857, 30858, 30859, 30860, 30861, 30862, 30863, 30864, 30865, 30866,
+        30867, 30868, 30869, 30870, 30871, 30872, 30873, 30874, 30875, 30876, 30877, 30878, 30879, 30880, 30881, 30882,
+        30883, 30884, 30885, 30886, 30887, 30888, 30889, 30890, 30891, 30892, 30893, 30894, 30895, 30896, 30897, 30898,
+        30899, 30900, 30901, 30902, 30903, 30904, 30905, 30906, 30907, 30908, 30909, 30910, 30911, 30912, 30913, 30914,
+        30915, 30916, 30917, 30918, 30919, 30920, 30921, 30922, 30923, 30924, 30925, 30926, 30927, 30928, 30929, 30930,
+        30931, 30932, 30933, 30934, 30935, 30936, 30937, 30938, 30939, 30940, 30941, 30942, 30943, 30944, 30945, 30946,
+        30947, 30948, 30949, 30950, 30951, 30952, 30953, 30954, 30955, 30956, 30957, 30958, 30959, 30960, 30961, 30962,
+        30963, 30964, 30965, 30966, 30967, 30968, 30969, 30970, 30971, 30972, 30973, 30974, 30975, 30976, 30977, 30978,
+        30979, 30980, 30981, 30982, 30983, 30984, 30985, 30986, 30987, 30988, 30989, 30990, 30991, 30992, 30993, 30994,
+        30995, 30996, 30997, 30998, 30999, 31000, 31001, 31002, 31003, 31004, 31005, 31006, 31007, 31008, 31009, 31010,
+        31011, 31012, 31013, 31014, 31015, 31016, 31017, 31018, 31019, 31020, 31021, 31022, 31023, 31024, 31025, 31026,
+        31027, 31028, 31029, 31030, 31031, 31032, 31033, 31034, 31035, 31036, 31037, 31038, 31039, 31040, 31041, 31042,
+        31043, 31044, 31045, 31046, 31047, 31048, 31049, 31050, 31051, 31052, 31053, 31054, 31055, 31056, 31057, 31058,
+        31059, 31060, 31061, 31062, 31063, 31064, 31065, 31066, 31067, 31068, 31069, 31070, 31071, 31072, 31073, 31074,
+        31075, 31076, 31077, 31078, 31079, 31080, 31081, 31082, 31083, 31084, 31085, 31086, 31087, 31088, 31089, 31090,
+        31091, 31092, 31093, 31094, 31095, 31096, 31097, 31098, 31099, 31100, 31101, 31102, 31103, 31104, 31105, 31106,
+        31107, 31108, 31109, 31110, 31111, 31112, 31113, 31114, 31115, 31116, 31117, 31118, 31119, 31120, 31121, 31122,
+        31123, 31124, 31125, 31126, 31127, 31128, 31129, 31130, 31131, 31132, 31133, 31134, 31135, 31136, 31137, 31138,
+        31139, 31140, 31141, 31142, 31143, 31144, 31145, 31146, 31147, 31148, 31149, 31150, 31151, 31152, 31153, 31154,
+        31155, 31156, 31157, 31158, 31159, 31160, 31161, 31162, 31163, 31164, 31165, 31166, 31167, 31168, 31169, 31170,
+        31171, 31172, 31173, 31174, 31175, 31176, 31177, 31178, 31179, 31180, 31181, 31182, 31183, 31184, 31185, 31186,
+        31187, 31188, 31189, 31190, 31191, 31192, 31193, 31194, 31195, 31196, 31197, 31198, 31199, 31200, 31201, 31202,
+        31203, 31204, 31205, 31206, 31207, 31208, 31209, 31210, 31211, 31212, 31213, 31214, 31215, 31216, 31217, 31218,
+        31219, 31220, 31221, 31222, 31223, 31224, 31225, 31226, 31227, 31228, 31229, 31230, 31231, 31232, 31233, 31234,
+        31235, 31236, 31237, 31238, 31239, 31240, 31241, 31242, 31243, 31244, 31245, 31246, 31247, 31248, 31249, 31250,
+        31251, 31252, 31253, 31254, 31255, 31256, 31257, 31258, 31259, 31260, 31261, 31262, 31263, 31264, 31265, 31266,
+        31267, 31268, 31269, 31270, 31271, 31272, 31273, 31274, 31275, 31276, 31277, 31278, 31279, 31280, 31281, 31282,
+        31283, 31284, 31285, 31286, 31287, 31288, 31289, 31290, 31291, 31292, 31293, 31294, 31295, 31296, 31297, 31298,
+        31299, 31300, 31301, 31302, 31303, 31304, 31305, 31306, 31307, 31308, 31309, 31310, 31311, 31312, 31313, 31314,
+        31315, 31316, 31317, 31318, 31319, 31320, 31321, 31322, 31323, 31324, 31325, 31326, 31327, 31328, 31329, 31330,
+        31331, 31332, 31333, 31334, 31335, 31336, 31337, 31338, 31339, 31340, 31341, 31342, 31343, 31344, 31345, 31346,
+        31347, 31348, 31349, 31350, 31351, 31352, 31353, 31354, 31355, 31356, 31357, 31358, 31359, 31360, 31361, 31362,
+        31363, 31364, 31365, 31366, 31367, 31368, 31369, 31370, 31371, 31372, 31373, 31374, 31375, 31376, 31377, 31378,
+        31379, 31380, 31381, 31382, 31383, 31384, 31385, 31386, 31387, 31388, 31389, 31390, 31391, 31392, 31393, 31394,
+        31395, 31396, 31397, 31398, 31399, 31400, 31401, 31402, 31403, 31404, 31405, 31406, 31407, 31408, 31409, 31410,
+        31411, 31412, 31413, 31414, 31415, 31416, 31417, 31418, 31419, 31420, 31421, 31422, 31423, 31424, 31425, 31426,
+        31427, 31428, 31429, 31430, 31431, 31432, 31433, 31434, 31435, 31436, 31437, 31438, 31439, 31440, 31441, 31442,
+        31443, 31444, 31445, 31446, 31447, 31448, 31449, 31450, 31451, 31452, 31453, 31454, 31455, 31456, 31457, 31458,
+        31459, 31460, 31461, 31462, 31463, 31464, 31465, 31466, 31467, 31468, 31469, 31470, 31471, 31472, 31473, 31474,
+        31475, 31476, 31477, 31478, 31479, 31480, 31481, 31482, 31483, 31484, 31485, 31486, 31487, 31488, 31489, 31490,
+        31491, 31492, 31493, 31494, 31495, 31496, 31497, 31498, 31499, 31500, 31501, 31502, 31503, 31504, 31505, 31506,
+        31507, 31508, 31509, 31510, 31511, 31512, 31513, 31514, 31515, 31516, 31517, 31518, 31519, 31520, 31521, 31522,
+        31523, 31524, 31525, 31526, 31527, 31528, 31529, 31530, 31531, 31532, 31533, 31534, 31535, 31536, 31537, 31538,
+        31539, 31540, 31541, 31542, 31543, 31544, 31545, 31546, 31547, 31548, 31549, 31550, 31551, 31552, 31553, 31554,
+        31555, 31556, 31557, 31558, 31559, 31560, 31561, 31562, 31563, 31564, 31565, 31566, 31567, 31568, 31569, 31570,
+        31571, 31572, 31573, 31574, 31575, 31576, 31577, 31578, 31579, 31580, 31581, 31582, 31583, 31584, 31585, 31586,
+        31587, 31588, 31589, 31590, 31591, 31592, 31593, 31594, 31595, 31596, 31597, 31598, 31599, 31600, 31601, 31602,
+        31603, 31604, 31605, 31606, 31607, 31608, 31609, 31610, 31611, 31612, 31613, 31614, 31615, 31616, 31617, 31618,
+        31619, 31620, 31621, 31622, 31623, 31624, 31625, 31626, 31627, 31628, 31629, 31630, 31631, 31632, 31633, 31634,
+        31635, 31636, 31637, 31638, 31639, 31640, 31641, 31642, 31643, 31644, 31645, 31646, 31647, 31648, 31649, 31650,
+        31651, 31652, 31653, 31654, 31655, 31656, 31657, 31658, 31659, 31660, 31661, 31662, 31663, 31664, 31665, 31666,
+        31667, 31668, 31669, 31670, 31671, 31672, 31673, 31674, 0, 0, 0, 0, 0, 0, 0, 0,
+        31675, 31676, 31677, 31678, 31679, 31680, 31681, 31682, 31683, 31684, 31685, 31686, 31687, 0, 0, 0,
+        31688, 31689, 31690, 31691, 31692, 31693, 31694, 31695, 31696, 31697, 31698, 31699, 31700, 0, 0, 0,
+        31701, 31702, 31703, 31704, 31705, 31706, 31707, 31708, 31709, 31710, 31711, 31712, 31713, 31714, 31715, 31716,
+        31717, 31718, 31719, 31720, 31721, 31722, 31723, 31724, 31725, 31726, 31727, 31728, 31729, 31730, 31731, 31732,
+        31733, 31734, 31735, 31736, 31737, 31738, 31739, 31740, 31741, 31742, 31743, 31744, 31745, 31746, 31747, 31748,
+        31749, 31750, 31751, 31752, 31753, 31754, 31755, 31756, 31757, 31758, 31759, 31760, 31761, 31762, 31763, 31764,
+        31765, 31766, 31767, 31768, 31769, 31770, 31771, 31772, 31773, 31774, 31775, 31776, 31777, 31778, 31779, 31780,
+        31781, 31782, 31783, 31784, 31785, 31786, 31787, 31788, 31789, 31790, 31791, 31792, 31793, 31794, 31795, 31796,
+        31797, 31798, 31799, 31800, 31801, 31802, 31803, 31804, 31805, 31806, 31807, 31808, 31809, 31810, 31811, 31812,
+        31813, 31814, 31815, 31816, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        31817, 31818, 31819, 31820, 31821, 31822, 31823, 31824, 31825, 31826, 31827, 31828, 31829, 31830, 31831, 31832,
+        31833, 31834, 31835, 31836, 31837, 31838, 31839, 31840, 31841, 31842, 31843, 31844, 31845, 31846, 31847, 31848,
+        31849, 31850, 31851, 31852, 31853, 31854, 31855, 31856, 31857, 31858, 31859, 31860, 31861, 31862, 31863, 31864,
+        31865, 31866, 31867, 31868, 31869, 31870, 31871, 31872, 31873, 31874, 31875, 31876, 31877, 31878, 31879, 31880,
+        31881, 31882, 31883, 31884, 31885, 31886, 31887, 31888, 31889, 31890, 31891, 31892, 31893, 31894, 31895, 31896,
+        31897, 31898, 31899, 31900, 31901, 31902, 31903, 31904, 31905, 0, 0, 0, 0, 0, 0, 0,
+        31906, 31907, 31908, 31909, 31910, 31911, 31912, 31913, 31914, 31915, 31916, 31917, 0, 0, 0, 0,
+        31918, 31919, 31920, 31921, 31922, 31923, 31924, 31925, 31926, 31927, 31928, 31929, 0, 0, 0, 0,
+        31930, 31931, 31932, 31933, 31934, 31935, 31936, 31937, 31938, 31939, 31940, 31941, 31942, 31943, 31944, 31945,
+        31946, 31947, 31948, 31949, 31950, 31951, 31952, 31953, 31954, 31955, 31956, 31957, 31958, 31959, 31960, 31961,
+        31962, 31963, 31964, 31965, 31966, 31967, 31968, 31969, 31970, 31971, 31972, 31973, 31974, 31975, 31976, 31977,
+        31978, 31979, 31980, 31981, 31982, 31983, 31984, 31985, 0, 0, 0, 0, 0, 0, 0, 0,
+        31986, 31987, 31988, 31989, 31990, 31991, 31992, 31993, 31994, 31995, 0, 0, 0, 0, 0, 0,
+        31996, 31997, 31998, 31999, 32000, 32001, 32002, 32003, 32004, 32005, 32006, 32007, 32008, 32009, 32010, 32011,
+        32012, 32013, 32014, 32015, 32016, 32017, 32018, 32019, 32020, 32021, 32022, 32023, 32024, 32025, 32026, 32027,
+        32028, 32029, 32030, 32031, 32032, 32033, 32034, 32035, 0, 0, 0, 0, 0, 0, 0, 0,
+        32036, 32037, 32038, 32039, 32040, 32041, 32042, 32043, 32044, 32045, 32046, 32047, 32048, 32049, 32050, 32051,
+        32052, 32053, 32054, 32055, 32056, 32057, 32058, 32059, 32060, 32061, 32062, 32063, 32064, 32065, 0, 0,
+        32066, 32067, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        32068, 32069, 32070, 32071, 32072, 32073, 32074, 32075, 32076, 32077, 32078, 32079, 32080, 32081, 32082, 32083,
+        32084, 32085, 32086, 32087, 32088, 32089, 32090, 32091, 32092, 32093, 32094, 32095, 32096, 32097, 32098, 32099,
+        32100, 32101, 32102, 32103, 32104, 32105, 32106, 32107, 32108, 32109, 32110, 32111, 32112, 32113, 32114, 32115,
+        32116, 32117, 32118, 32119, 32120, 32121, 32122, 32123, 32124, 32125, 32126, 32127, 32128, 32129, 32130, 32131,
+        32132, 32133, 32134, 32135, 32136, 32137, 32138, 32139, 32140, 32141, 32142, 32143, 32144, 32145, 32146, 32147,
+        32148, 32149, 32150, 32151, 32152, 32153, 32154, 32155, 32156, 32157, 32158, 32159, 32160, 32161, 32162, 32163,
+        32164, 32165, 32166, 32167, 32168, 32169, 32170, 32171, 32172, 32173, 32174, 32175, 32176, 32177, 32178, 32179,
+        32180, 32181, 32182, 32183, 32184, 32185, 32186, 32187, 32188, 0, 32189, 32190, 32191, 32192, 32193, 32194,
+        32195, 32196, 32197, 32198, 32199, 32200, 32201, 32202, 32203, 32204, 32205, 32206, 32207, 32208, 32209, 32210,
+        32211, 32212, 32213, 32214, 32215, 32216, 32217, 32218, 32219, 32220, 32221, 32222, 32223, 32224, 32225, 32226,
+        32227, 32228, 32229, 32230, 32231, 32232, 32233, 32234, 32235, 32236, 32237, 32238, 32239, 32240, 32241, 32242,
+        32243, 32244, 32245, 32246, 32247, 32248, 32249, 32250, 32251, 32252, 32253, 32254, 32255, 32256, 32257, 32258,
+        32259, 32260, 32261, 32262, 32263, 32264, 32265, 32266, 32267, 32268, 32269, 32270, 0, 32271, 32272, 32273,
+        32274, 32275, 32276, 32277, 32278, 32279, 32280, 32281, 32282, 32283, 32284, 32285, 32286, 32287, 32288, 32289,
+        32290, 32291, 32292, 32293, 32294, 32295, 32296, 32297, 32298, 32299, 32300, 32301, 32302, 32303, 32304, 32305,
+        32306, 32307, 32308, 32309, 32310, 32311, 32312, 32313, 32314, 32315, 32316, 32317, 32318, 32319, 32320, 32321,
+        32322, 32323, 32324, 32325, 32326, 32327, 32328, 32329, 32330, 32331, 32332, 32333, 32334, 32335, 32336, 32337,
+        32338, 32339, 32340, 32341, 32342, 32343, 32344, 32345, 32346, 32347, 32348, 32349, 32350, 32351, 32352, 32353,
+        32354, 32355, 32356, 32357, 32358, 32359, 32360, 32361, 32362, 32363, 32364, 32365, 32366, 32367, 32368, 32369,
+        32370, 32371, 32372, 32373, 32374, 32375, 32376, 32377, 32378, 32379, 32380, 32381, 32382, 32383, 32384, 32385,
+        32386, 32387, 32388, 32389, 32390, 32391, 32392, 32393, 32394, 32395, 32396, 32397, 32398, 32399, 32400, 32401,
+        32402, 32403, 32404, 32405, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        32406, 32407, 32408, 32409, 32410, 32411, 32412, 32413, 32414, 32415, 32416, 32417, 32418, 32419, 0, 0,
+        32420, 32421, 32422, 32423, 32424, 0, 0, 0, 32425, 32426, 32427, 0, 0, 0, 0, 0,
+        32428, 32429, 32430, 32431, 32432, 32433, 32434, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        32435, 32436, 32437, 32438, 32439, 32440, 32441, 32442, 32443, 32444, 32445, 32446, 32447, 32448, 32449, 32450,
+        32451, 32452, 32453, 32454, 32455, 32456, 32457, 32458, 32459, 0, 0, 0, 0, 0, 0, 0,
+        32460, 32461, 32462, 32463, 32464, 32465, 32466, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        32467, 32468, 32469, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        32470, 32471, 32472, 32473, 32474, 32475, 32476, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        32477, 32478, 32479, 32480, 32481, 32482, 32483, 32484, 32485, 32486, 32487, 32488, 32489, 32490, 32491, 32492,
+        32493, 32494, 32495, 32496, 32497, 32498, 32499, 32500, 32501, 32502, 32503, 32504, 32505, 32506, 32507, 32508,
+        32509, 32510, 32511, 32512, 32513, 32514, 32515, 32516, 32517, 32518, 32519, 32520, 32521, 32522, 32523, 32524,
+        32525, 32526, 32527, 32528, 32529, 32530, 32531, 32532, 32533, 32534, 32535, 32536, 32537, 32538, 32539, 32540,
+        32541, 32542, 32543, 32544, 32545, 32546, 32547, 32548, 32549, 32550, 32551, 32552, 32553, 32554, 32555, 32556,
+        32557, 32558, 32559, 32560, 32561, 32562, 32563, 32564, 32565, 32566, 32567, 32568, 32569, 32570, 32571, 32572,
+        32573, 32574, 32575, 32576, 32577, 32578, 32579, 32580, 32581, 32582, 32583, 32584, 32585, 32586, 32587, 32588,
+        32589, 32590, 32591, 32592, 32593, 32594, 32595, 32596, 32597, 32598, 32599, 32600, 32601, 32602, 32603, 32604,
+        32605, 32606, 32607, 32608, 32609, 32610, 32611, 32612, 32613, 32614, 32615, 32616, 32617, 32618, 32619, 32620,
+        32621, 32622, 32623, 0, 32624, 32625, 32626, 32627, 32628, 32629, 32630, 32631, 32632, 32633, 32634, 32635,
+        32636, 32637, 32638, 32639, 32640, 32641, 32642, 32643, 32644, 32645, 32646, 32647, 32648, 32649, 32650, 32651,
+        32652, 32653, 32654, 32655, 32656, 32657, 32658, 32659, 32660, 32661, 32662, 32663, 32664, 32665, 32666, 32667,
+        32668, 32669, 32670, 32671, 32672, 32673, 32674, 32675, 32676, 32677, 32678, 0, 0, 0, 0, 0,
+        28954, 28955, 28956, 28957, 28958, 28959, 28960, 28961, 28962, 28963, 0, 0, 0, 0, 0, 0,
+        32679, 32681, 32683, 32685, 32687, 17719, 32689, 32691, 32693, 32695, 17721, 32697, 32699, 32701, 17723, 32703,
+        32705, 32707, 32709, 32711, 32713, 32715, 32717, 32719, 32721, 32723, 32725, 17839, 32727, 32729, 32731, 32733,
+        32735, 32737, 32739, 32741, 32743, 17849, 17725, 17727, 17851, 32745, 32747, 17317, 32749, 17729, 32751, 32753,
+        32755, 32757, 32757, 32757, 32759, 32761, 32763, 32765, 32767, 32769, 32771, 32773, 32775, 32777, 32779, 32781,
+        32783, 32785, 32787, 32789, 32791, 32793, 32793, 17855, 32795, 32797, 32799, 32801, 17733, 32803, 32805, 32807,
+        17623, 32809, 32811, 32813, 32815, 32817, 32819, 32821, 32823, 32825, 32827, 32829, 32831, 32833, 32835, 32837,
+        32839, 32841, 32843, 32845, 32847, 32849, 32851, 32853, 32855, 32857, 32859, 32859, 32861, 32863, 32865, 17309,
+        32867, 32869, 32871, 32873, 32875, 32877, 32879, 32881, 17743, 32883, 32885, 32887, 32889, 32891, 32893, 32895,
+        32897, 32899, 32901, 32903, 32905, 32907, 32909, 32911, 32913, 32915, 32917, 32919, 32921, 32923, 17201, 32925,
+        32927, 32929, 32929, 32931, 32933, 32933, 32935, 32937, 32939, 32941, 32943, 32945, 32947, 32949, 32951, 32953,
+        32955, 32957, 32959, 17745, 32961, 32963, 32965, 32967, 17879, 32967, 32969, 17749, 32971, 32973, 32975, 32977,
+        17751, 17147, 32979, 32981, 32983, 32985, 32987, 32989, 32991, 32993, 32995, 32997, 32999, 33001, 33003, 33005,
+        33007, 33009, 33011, 33013, 33015, 33017, 33019, 33021, 17753, 33023, 33025, 33027, 33029, 33031, 33033, 17757,
+        33035, 33037, 33039, 33041, 33043, 33045, 33047, 33049, 17203, 17895, 33051, 33053, 33055, 33057, 33059, 33061,
+        33063, 33065, 17759, 33067, 33069, 33071, 33073, 17981, 33075, 33077, 33079, 33081, 33083, 33085, 33087, 33089,
+        33091, 33093, 33095, 33097, 33099, 17343, 33101, 33103, 33105, 33107, 33109, 33111, 33113, 33115, 33117, 33119,
+        33121, 17761, 17517, 33123, 33125, 33127, 33129, 33131, 33133, 33135, 33137, 17903, 33139, 33141, 33143, 33145,
+        33147, 33149, 33151, 33153, 17905, 33155, 33157, 33159, 33161, 33163, 33165, 33167, 33169, 33171, 33173, 33175,
+        33177, 17909, 33179, 33181, 33183, 33185, 33187, 33189, 33191, 33193, 33195, 33197, 33199, 33199, 33201, 33203,
+        17913, 33205, 33207, 33209, 33211, 33213, 33215, 33217, 17315, 33219, 33221, 33223, 33225, 33227, 33229, 33231,
+        17925, 33233, 33235, 33237, 33239, 33241, 33243, 33243, 17927, 17985, 33245, 33247, 33249, 33251, 33253, 17239,
+        17931, 33255, 33257, 17783, 33259, 33261, 17677, 33263, 33265, 17791, 33267, 33269, 33271, 33273, 33273, 33275,
+        33277, 33279, 33281, 33283, 33285, 33287, 33289, 33291, 33293, 33295, 33297, 33299, 33301, 33303, 33305, 33307,
+        33309, 33311, 33313, 33315, 33317, 33319, 33321, 33323, 33325, 33327, 17803, 33329, 33331, 33333, 33335, 33337,
+        33339, 33341, 33343, 33345, 33347, 33349, 33351, 33353, 33355, 33357, 33359, 32931, 33361, 33363, 33365, 33367,
+        33369, 33371, 33373, 33375, 33377, 33379, 33381, 33383, 17351, 33385, 33387, 33389, 33391, 33393, 33395, 17809,
+        33397, 33399, 33401, 33403, 33405, 33407, 33409, 33411, 33413, 33415, 33417, 33419, 33421, 33423, 33425, 33427,
+        33429, 33431, 33433, 33435, 17229, 33437, 33439, 33441, 33443, 33445, 33447, 17945, 33449, 33451, 33453, 33455,
+        33457, 33459, 33461, 33463, 33465, 33467, 33469, 33471, 33473, 33475, 33477, 33479, 33481, 33483, 33485, 33487,
+        17955, 17957, 33489, 33491, 33493, 33495, 33497, 33499, 33501, 33503, 33505, 33507, 33509, 33511, 33513, 17959,
+        33515, 33517, 33519, 33521, 33523, 33525, 33527, 33529, 33531, 33533, 33535, 33537, 33539, 33541, 33543, 33545,
+        33547, 33549, 33551, 33553, 33555, 33557, 33559, 33561, 33563, 33565, 33567, 33569, 33571, 33573, 17971, 17971,
+        33575, 33577, 33579, 33581, 33583, 33585, 33587, 33589, 33591, 33593, 17973, 33595, 33597, 33599, 33601, 33603,
+        33605, 33607, 33609, 33611, 33613, 33615, 33617, 33619, 33621, 33623, 33625, 33627, 33629, 33631, 0, 0,
+        0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/// 按码点序列排序的缩约项
+static const CollationContraction CollationContractions[939] = {
+        {{0x004c, 0x00b7, 0x0000}, 390}, {{0x004c, 0x0387, 0x0000}, 390},
+        {{0x006c, 0x00b7, 0x0000}, 392}, {{0x006c, 0x0387, 0x0000}, 392},
+        {{0x0418, 0x0306, 0x0000}, 1300}, {{0x0438, 0x0306, 0x0000}, 1332},
+        {{0x0627, 0x0653, 0x0000}, 1783}, {{0x0627, 0x0654, 0x0000}, 1784},
+        {{0x0627, 0x0655, 0x0000}, 1786}, {{0x0648, 0x0654, 0x0000}, 1785},
+        {{0x064a, 0x0654, 0x0000}, 1787}, {{0x09c7, 0x09be, 0x0000}, 2524},
+        {{0x09c7, 0x09d7, 0x0000}, 2525}, {{0x0b47, 0x0b3e, 0x0000}, 2754},
+        {{0x0b47, 0x0b56, 0x0000}, 2753}, {{0x0b47, 0x0b57, 0x0000}, 2755},
+        {{0x0b92, 0x0bd7, 0x0000}, 2788}, {{0x0bc6, 0x0bbe, 0x0000}, 2820},
+        {{0x0bc6, 0x0bd7, 0x0000}, 2822}, {{0x0bc7, 0x0bbe, 0x0000}, 2821},
+        {{0x0c46, 0x0c56, 0x0000}, 2897}, {{0x0cbf, 0x0cd5, 0x0000}, 2967},
+        {{0x0cc6, 0x0cc2, 0x0000}, 33632}, {{0x0cc6, 0x0cc2, 0x0cd5}, 2976},
+        {{0x0cc6, 0x0cd5, 0x0000}, 2973}, {{0x0cc6, 0x0cd6, 0x0000}, 2974},
+        {{0x0cca, 0x0cd5, 0x0000}, 2976}, {{0x0d46, 0x0d3e, 0x0000}, 3053},
+        {{0x0d46, 0x0d57, 0x0000}, 3055}, {{0x0d47, 0x0d3e, 0x0000}, 3054},
+        {{0x0dd9, 0x0dca, 0x0000}, 3168}, {{0x0dd9, 0x0dcf, 0x0000}, 33633},
+        {{0x0dd9, 0x0dcf, 0x0dca}, 3171}, {{0x0dd9, 0x0ddf, 0x0000}, 3172},
+        {{0x0ddc, 0x0dca, 0x0000}, 3171}, {{0x0e40, 0x0e01, 0x0000}, 33634},
+        {{0x0e40, 0x0e02, 0x0000}, 33636}, {{0x0e40, 0x0e03, 0x0000}, 33638},
+        {{0x0e40, 0x0e04, 0x0000}, 33640}, {{0x0e40, 0x0e05, 0x0000}, 33642},
+        {{0x0e40, 0x0e06, 0x0000}, 33644}, {{0x0e40, 0x0e07, 0x0000}, 33646},
+        {{0x0e40, 0x0e08, 0x0000}, 33648}, {{0x0e40, 0x0e09, 0x0000}, 33650},
+        {{0x0e40, 0x0e0a, 0x0000}, 33652}, {{0x0e40, 0x0e0b, 0x0000}, 33654},
+        {{0x0e40, 0x0e0c, 0x0000}, 33656}, {{0x0e40, 0x0e0d, 0x0000}, 33658},
+        {{0x0e40, 0x0e0e, 0x0000}, 33660}, {{0x0e40, 0x0e0f, 0x0000}, 33662},
+        {{0x0e40, 0x0e10, 0x0000}, 33664}, {{0x0e40, 0x0e11, 0x0000}, 33666},
+        {{0x0e40, 0x0e12, 0x0000}, 33668}, {{0x0e40, 0x0e13, 0x0000}, 33670},
+        {{0x0e40, 0x0e14, 0x0000}, 33672}, {{0x0e40, 0x0e15, 0x0000}, 33674},
+        {{0x0e40, 0x0e16, 0x0000}, 33676}, {{0x0e40, 0x0e17, 0x0000}, 33678},
+        {{0x0e40, 0x0e18, 0x0000}, 33680}, {{0x0e40, 0x0e19, 0x0000}, 33682},
+        {{0x0e40, 0x0e1a, 0x0000}, 33684}, {{0x0e40, 0x0e1b, 0x0000}, 33686},
+        {{0x0e40, 0x0e1c, 0x0000}, 33688}, {{0x0e40, 0x0e1d, 0x0000}, 33690},
+        {{0x0e40, 0x0e1e, 0x0000}, 33692}, {{0x0e40, 0x0e1f, 0x0000}, 33694},
+        {{0x0e40, 0x0e20, 0x0000}, 33696}, {{0x0e40, 0x0e21, 0x0000}, 33698},
+        {{0x0e40, 0x0e22, 0x0000}, 33700}, {{0x0e40, 0x0e23, 0x0000}, 33702},
+        {{0x0e40, 0x0e24, 0x0000}, 33704}, {{0x0e40, 0x0e25, 0x0000}, 33706},
+        {{0x0e40, 0x0e26, 0x0000}, 33708}, {{0x0e40, 0x0e27, 0x0000}, 33710},
+        {{0x0e40, 0x0e28, 0x0000}, 33712}, {{0x0e40, 0x0e29, 0x0000}, 33714},
+        {{0x0e40, 0x0e2a, 0x0000}, 33716}, {{0x0e40, 0x0e2b, 0x0000}, 33718},
+        {{0x0e40, 0x0e2c, 0x0000}, 33720}, {{0x0e40, 0x0e2d, 0x0000}, 33722},
+        {{0x0e40, 0x0e2e, 0x0000}, 33724}, {{0x0e41, 0x0e01, 0x0000}, 33726},
+        {{0x0e41, 0x0e02, 0x0000}, 33728}, {{0x0e41, 0x0e03, 0x0000}, 33730},
+        {{0x0e41, 0x0e04, 0x0000}, 33732}, {{0x0e41, 0x0e05, 0x0000}, 33734},
+        {{0x0e41, 0x0e06, 0x0000}, 33736}, {{0x0e41, 0x0e07, 0x0000}, 33738},
+        {{0x0e41, 0x0e08, 0x0000}, 33740}, {{0x0e41, 0x0e09, 0x0000}, 33742},
+        {{0x0e41, 0x0e0a, 0x0000}, 33744}, {{0x0e41, 0x0e0b, 0x0000}, 33746},
+        {{0x0e41, 0x0e0c, 0x0000}, 33748}, {{0x0e41, 0x0e0d, 0x0000}, 33750},
+        {{0x0e41, 0x0e0e, 0x0000}, 33752}, {{0x0e41, 0x0e0f, 0x0000}, 33754},
+        {{0x0e41, 0x0e10, 0x0000}, 33756}, {{0x0e41, 0x0e11, 0x0000}, 33758},
+        {{0x0e41, 0x0e12, 0x0000}, 33760}, {{0x0e41, 0x0e13, 0x0000}, 33762},
+        {{0x0e41, 0x0e14, 0x0000}, 33764}, {{0x0e41, 0x0e15, 0x0000}, 33766},
+        {{0x0e41, 0x0e16, 0x0000}, 33768}, {{0x0e41, 0x0e17, 0x0000}, 33770},
+        {{0x0e41, 0x0e18, 0x0000}, 33772}, {{0x0e41, 0x0e19, 0x0000}, 33774},
+        {{0x0e41, 0x0e1a, 0x0000}, 33776}, {{0x0e41, 0x0e1b, 0x0000}, 33778},
+        {{0x0e41, 0x0e1c, 0x0000}, 33780}, {{0x0e41, 0x0e1d, 0x0000}, 33782},
+        {{0x0e41, 0x0e1e, 0x0000}, 33784}, {{0x0e41, 0x0e1f, 0x0000}, 33786},
+        {{0x0e41, 0x0e20, 0x0000}, 33788}, {{0x0e41, 0x0e21, 0x0000}, 33790},
+        {{0x0e41, 0x0e22, 0x0000}, 33792}, {{0x0e41, 0x0e23, 0x0000}, 33794},
+        {{0x0e41, 0x0e24, 0x0000}, 33796}, {{0x0e41, 0x0e25, 0x0000}, 33798},
+        {{0x0e41, 0x0e26, 0x0000}, 33800}, {{0x0e41, 0x0e27, 0x0000}, 33802},
+        {{0x0e41, 0x0e28, 0x0000}, 33804}, {{0x0e41, 0x0e29, 0x0000}, 33806},
+        {{0x0e41, 0x0e2a, 0x0000}, 33808}, {{0x0e41, 0x0e2b, 0x0000}, 33810},
+        {{0x0e41, 0x0e2c, 0x0000}, 33812}, {{0x0e41, 0x0e2d, 0x0000}, 33814},
+        {{0x0e41, 0x0e2e, 0x0000}, 33816}, {{0x0e42, 0x0e01, 0x0000}, 33818},
+        {{0x0e42, 0x0e02, 0x0000}, 33820}, {{0x0e42, 0x0e03, 0x0000}, 33822},
+        {{0x0e42, 0x0e04, 0x0000}, 33824}, {{0x0e42, 0x0e05, 0x0000}, 33826},
+        {{0x0e42, 0x0e06, 0x0000}, 33828}, {{0x0e42, 0x0e07, 0x0000}, 33830},
+        {{0x0e42, 0x0e08, 0x0000}, 33832}, {{0x0e42, 0x0e09, 0x0000}, 33834},
+        {{0x0e42, 0x0e0a, 0x0000}, 33836}, {{0x0e42, 0x0e0b, 0x0000}, 33838},
+        {{0x0e42, 0x0e0c, 0x0000}, 33840}, {{0x0e42, 0x0e0d, 0x0000}, 33842},
+        {{0x0e42, 0x0e0e, 0x0000}, 33844}, {{0x0e42, 0x0e0f, 0x0000}, 33846},
+        {{0x0e42, 0x0e10, 0x0000}, 33848}, {{0x0e42, 0x0e11, 0x0000}, 33850},
+        {{0x0e42, 0x0e12, 0x0000}, 33852}, {{0x0e42, 0x0e13, 0x0000}, 33854},
+        {{0x0e42, 0x0e14, 0x0000}, 33856}, {{0x0e42, 0x0e15, 0x0000}, 33858},
+        {{0x0e42, 0x0e16, 0x0000}, 33860}, {{0x0e42, 0x0e17, 0x0000}, 33862},
+        {{0x0e42, 0x0e18, 0x0000}, 33864}, {{0x0e42, 0x0e19, 0x0000}, 33866},
+        {{0x0e42, 0x0e1a, 0x0000}, 33868}, {{0x0e42, 0x0e1b, 0x0000}, 33870},
+        {{0x0e42, 0x0e1c, 0x0000}, 33872}, {{0x0e42, 0x0e1d, 0x0000}, 33874},
+        {{0x0e42, 0x0e1e, 0x0000}, 33876}, {{0x0e42, 0x0e1f, 0x0000}, 33878},
+        {{0x0e42, 0x0e20, 0x0000}, 33880}, {{0x0e42, 0x0e21, 0x0000}, 33882},
+        {{0x0e42, 0x0e22, 0x0000}, 33884}, {{0x0e42, 0x0e23, 0x0000}, 33886},
+        {{0x0e42, 0x0e24, 0x0000}, 33888}, {{0x0e42, 0x0e25, 0x0000}, 33890},
+        {{0x0e42, 0x0e26, 0x0000}, 33892}, {{0x0e42, 0x0e27, 0x0000}, 33894},
+        {{0x0e42, 0x0e28, 0x0000}, 33896}, {{0x0e42, 0x0e29, 0x0000}, 33898},
+        {{0x0e42, 0x0e2a, 0x0000}, 33900}, {{0x0e42, 0x0e2b, 0x0000}, 33902},
+        {{0x0e42, 0x0e2c, 0x0000}, 33904}, {{0x0e42, 0x0e2d, 0x0000}, 33906},
+        {{0x0e42, 0x0e2e, 0x0000}, 33908}, {{0x0e43, 0x0e01, 0x0000}, 33910},
+        {{0x0e43, 0x0e02, 0x0000}, 33912}, {{0x0e43, 0x0e03, 0x0000}, 33914},
+        {{0x0e43, 0x0e04, 0x0000}, 33916}, {{0x0e43, 0x0e05, 0x0000}, 33918},
+        {{0x0e43, 0x0e06, 0x0000}, 33920}, {{0x0e43, 0x0e07, 0x0000}, 33922},
+        {{0x0e43, 0x0e08, 0x0000}, 33924}, {{0x0e43, 0x0e09, 0x0000}, 33926},
+        {{0x0e43, 0x0e0a, 0x0000}, 33928}, {{0x0e43, 0x0e0b, 0x0000}, 33930},
+        {{0x0e43, 0x0e0c, 0x0000}, 33932}, {{0x0e43, 0x0e0d, 0x0000}, 33934},
+        {{0x0e43, 0x0e0e, 0x0000}, 33936}, {{0x0e43, 0x0e0f, 0x0000}, 33938},
+        {{0x0e43, 0x0e10, 0x0000}, 33940}, {{0x0e43, 0x0e11, 0x0000}, 33942},
+        {{0x0e43, 0x0e12, 0x0000}, 33944}, {{0x0e43, 0x0e13, 0x0000}, 33946},
+        {{0x0e43, 0x0e14, 0x0000}, 33948}, {{0x0e43, 0x0e15, 0x0000}, 33950},
+        {{0x0e43, 0x0e16, 0x0000}, 33952}, {{0x0e43, 0x0e17, 0x0000}, 33954},
+        {{0x0e43, 0x0e18, 0x0000}, 33956}, {{0x0e43, 0x0e19, 0x0000}, 33958},
+        {{0x0e43, 0x0e1a, 0x0000}, 33960}, {{0x0e43, 0x0e1b, 0x0000}, 33962},
+        {{0x0e43, 0x0e1c, 0x0000}, 33964}, {{0x0e43, 0x0e1d, 0x0000}, 33966},
+        {{0x0e43, 0x0e1e, 0x0000}, 33968}, {{0x0e43, 0x0e1f, 0x0000}, 33970},
+        {{0x0e43, 0x0e20, 0x0000}, 33972}, {{0x0e43, 0x0e21, 0x0000}, 33974},
+        {{0x0e43, 0x0e22, 0x0000}, 33976}, {{0x0e43, 0x0e23, 0x0000}, 33978},
+        {{0x0e43, 0x0e24, 0x0000}, 33980}, {{0x0e43, 0x0e25, 0x0000}, 33982},
+        {{0x0e43, 0x0e26, 0x0000}, 33984}, {{0x0e43, 0x0e27, 0x0000}, 33986},
+        {{0x0e43, 0x0e28, 0x0000}, 33988}, {{0x0e43, 0x0e29, 0x0000}, 33990},
+        {{0x0e43, 0x0e2a, 0x0000}, 33992}, {{0x0e43, 0x0e2b, 0x0000}, 33994},
+        {{0x0e43, 0x0e2c, 0x0000}, 33996}, {{0x0e43, 0x0e2d, 0x0000}, 33998},
+        {{0x0e43, 0x0e2e, 0x0000}, 34000}, {{0x0e44, 0x0e01, 0x0000}, 34002},
+        {{0x0e44, 0x0e02, 0x0000}, 34004}, {{0x0e44, 0x0e03, 0x0000}, 34006},
+        {{0x0e44, 0x0e04, 0x0000}, 34008}, {{0x0e44, 0x0e05, 0x0000}, 34010},
+        {{0x0e44, 0x0e06, 0x0000}, 34012}, {{0x0e44, 0x0e07, 0x0000}, 34014},
+        {{0x0e44, 0x0e08, 0x0000}, 34016}, {{0x0e44, 0x0e09, 0x0000}, 34018},
+        {{0x0e44, 0x0e0a, 0x0000}, 34020}, {{0x0e44, 0x0e0b, 0x0000}, 34022},
+        {{0x0e44, 0x0e0c, 0x0000}, 34024}, {{0x0e44, 0x0e0d, 0x0000}, 34026},
+        {{0x0e44, 0x0e0e, 0x0000}, 34028}, {{0x0e44, 0x0e0f, 0x0000}, 34030},
+        {{0x0e44, 0x0e10, 0x0000}, 34032}, {{0x0e44, 0x0e11, 0x0000}, 34034},
+        {{0x0e44, 0x0e12, 0x0000}, 34036}, {{0x0e44, 0x0e13, 0x0000}, 34038},
+        {{0x0e44, 0x0e14, 0x0000}, 34040}, {{0x0e44, 0x0e15, 0x0000}, 34042},
+        {{0x0e44, 0x0e16, 0x0000}, 34044}, {{0x0e44, 0x0e17, 0x0000}, 34046},
+        {{0x0e44, 0x0e18, 0x0000}, 34048}, {{0x0e44, 0x0e19, 0x0000}, 34050},
+        {{0x0e44, 0x0e1a, 0x0000}, 34052}, {{0x0e44, 0x0e1b, 0x0000}, 34054},
+        {{0x0e44, 0x0e1c, 0x0000}, 34056}, {{0x0e44, 0x0e1d, 0x0000}, 34058},
+        {{0x0e44, 0x0e1e, 0x0000}, 34060}, {{0x0e44, 0x0e1f, 0x0000}, 34062},
+        {{0x0e44, 0x0e20, 0x0000}, 34064}, {{0x0e44, 0x0e21, 0x0000}, 34066},
+        {{0x0e44, 0x0e22, 0x0000}, 34068}, {{0x0e44, 0x0e23, 0x0000}, 34070},
+        {{0x0e44, 0x0e24, 0x0000}, 34072}, {{0x0e44, 0x0e25, 0x0000}, 34074},
+        {{0x0e44, 0x0e26, 0x0000}, 34076}, {{0x0e44, 0x0e27, 0x0000}, 34078},
+        {{0x0e44, 0x0e28, 0x0000}, 34080}, {{0x0e44, 0x0e29, 0x0000}, 34082},
+        {{0x0e44, 0x0e2a, 0x0000}, 34084}, {{0x0e44, 0x0e2b, 0x0000}, 34086},
+        {{0x0e44, 0x0e2c, 0x0000}, 34088}, {{0x0e44, 0x0e2d, 0x0000}, 34090},
+        {{0x0e44, 0x0e2e, 0x0000}, 34092}, {{0x0e4d, 0x0e32, 0x0000}, 3227},
+        {{0x0ec0, 0x0e81, 0x0000}, 34094}, {{0x0ec0, 0x0e82, 0x0000}, 34096},
+        {{0x0ec0, 0x0e84, 0x0000}, 34098}, {{0x0ec0, 0x0e86, 0x0000}, 34100},
+        {{0x0ec0, 0x0e87, 0x0000}, 34102}, {{0x0ec0, 0x0e88, 0x0000}, 34104},
+        {{0x0ec0, 0x0e89, 0x0000}, 34106}, {{0x0ec0, 0x0e8a, 0x0000}, 34108},
+        {{0x0ec0, 0x0e8c, 0x0000}, 34110}, {{0x0ec0, 0x0e8d, 0x0000}, 34112},
+        {{0x0ec0, 0x0e8e, 0x0000}, 34114}, {{0x0ec0, 0x0e8f, 0x0000}, 34116},
+        {{0x0ec0, 0x0e90, 0x0000}, 34118}, {{0x0ec0, 0x0e91, 0x0000}, 34120},
+        {{0x0ec0, 0x0e92, 0x0000}, 34122}, {{0x0ec0, 0x0e93, 0x0000}, 34124},
+        {{0x0ec0, 0x0e94, 0x0000}, 34126}, {{0x0ec0, 0x0e95, 0x0000}, 34128},
+        {{0x0ec0, 0x0e96, 0x0000}, 34130}, {{0x0ec0, 0x0e97, 0x0000}, 34132},
+        {{0x0ec0, 0x0e98, 0x0000}, 34134}, {{0x0ec0, 0x0e99, 0x0000}, 34136},
+        {{0x0ec0, 0x0e9a, 0x0000}, 34138}, {{0x0ec0, 0x0e9b, 0x0000}, 34140},
+        {{0x0ec0, 0x0e9c, 0x0000}, 34142}, {{0x0ec0, 0x0e9d, 0x0000}, 34144},
+        {{0x0ec0, 0x0e9e, 0x0000}, 34146}, {{0x0ec0, 0x0e9f, 0x0000}, 34148},
+        {{0x0ec0, 0x0ea0, 0x0000}, 34150}, {{0x0ec0, 0x0ea1, 0x0000}, 34152},
+        {{0x0ec0, 0x0ea2, 0x0000}, 34154}, {{0x0ec0, 0x0ea3, 0x0000}, 34156},
+        {{0x0ec0, 0x0ea5, 0x0000}, 34158}, {{0x0ec0, 0x0ea7, 0x0000}, 34160},
+        {{0x0ec0, 0x0ea8, 0x0000}, 34162}, {{0x0ec0, 0x0ea9, 0x0000}, 34164},
+        {{0x0ec0, 0x0eaa, 0x0000}, 34166}, {{0x0ec0, 0x0eab, 0x0000}, 34168},
+        {{0x0ec0, 0x0eac, 0x0000}, 34170}, {{0x0ec0, 0x0ead, 0x0000}, 34172},
+        {{0x0ec0, 0x0eae, 0x0000}, 34174}, {{0x0ec0, 0x0edc, 0x0000}, 34176},
+        {{0x0ec0, 0x0edd, 0x0000}, 34179}, {{0x0ec0, 0x0ede, 0x0000}, 34182},
+        {{0x0ec0, 0x0edf, 0x0000}, 34184}, {{0x0ec1, 0x0e81, 0x0000}, 34186},
+        {{0x0ec1, 0x0e82, 0x0000}, 34188}, {{0x0ec1, 0x0e84, 0x0000}, 34190},
+        {{0x0ec1, 0x0e86, 0x0000}, 34192}, {{0x0ec1, 0x0e87, 0x0000}, 34194},
+        {{0x0ec1, 0x0e88, 0x0000}, 34196}, {{0x0ec1, 0x0e89, 0x0000}, 34198},
+        {{0x0ec1, 0x0e8a, 0x0000}, 34200}, {{0x0ec1, 0x0e8c, 0x0000}, 34202},
+        {{0x0ec1, 0x0e8d, 0x0000}, 34204}, {{0x0ec1, 0x0e8e, 0x0000}, 34206},
+        {{0x0ec1, 0x0e8f, 0x0000}, 34208}, {{0x0ec1, 0x0e90, 0x0000}, 34210},
+        {{0x0ec1, 0x0e91, 0x0000}, 34212}, {{0x0ec1, 0x0e92, 0x0000}, 34214},
+        {{0x0ec1, 0x0e93, 0x0000}, 34216}, {{0x0ec1, 0x0e94, 0x0000}, 34218},
+        {{0x0ec1, 0x0e95, 0x0000}, 34220}, {{0x0ec1, 0x0e96, 0x0000}, 34222},
+        {{0x0ec1, 0x0e97, 0x0000}, 34224}, {{0x0ec1, 0x0e98, 0x0000}, 34226},
+        {{0x0ec1, 0x0e99, 0x0000}, 34228}, {{0x0ec1, 0x0e9a, 0x0000}, 34230},
+        {{0x0ec1, 0x0e9b, 0x0000}, 34232}, {{0x0ec1, 0x0e9c, 0x0000}, 34234},
+        {{0x0ec1, 0x0e9d, 0x0000}, 34236}, {{0x0ec1, 0x0e9e, 0x0000}, 34238},
+        {{0x0ec1, 0x0e9f, 0x0000}, 34240}, {{0x0ec1, 0x0ea0, 0x0000}, 34242},
+        {{0x0ec1, 0x0ea1, 0x0000}, 34244}, {{0x0ec1, 0x0ea2, 0x0000}, 34246},
+        {{0x0ec1, 0x0ea3, 0x0000}, 34248}, {{0x0ec1, 0x0ea5, 0x0000}, 34250},
+        {{0x0ec1, 0x0ea7, 0x0000}, 34252}, {{0x0ec1, 0x0ea8, 0x0000}, 34254},
+        {{0x0ec1, 0x0ea9, 0x0000}, 34256}, {{0x0ec1, 0x0eaa, 0x0000}, 34258},
+        {{0x0ec1, 0x0eab, 0x0000}, 34260}, {{0x0ec1, 0x0eac, 0x0000}, 34262},
+        {{0x0ec1, 0x0ead, 0x0000}, 34264}, {{0x0ec1, 0x0eae, 0x0000}, 34266},
+        {{0x0ec1, 0x0edc, 0x0000}, 34268}, {{0x0ec1, 0x0edd, 0x0000}, 34271},
+        {{0x0ec1, 0x0ede, 0x0000}, 34274}, {{0x0ec1, 0x0edf, 0x0000}, 34276},
+        {{0x0ec2, 0x0e81, 0x0000}, 34278}, {{0x0ec2, 0x0e82, 0x0000}, 34280},
+        {{0x0ec2, 0x0e84, 0x0000}, 34282}, {{0x0ec2, 0x0e86, 0x0000}, 34284},
+        {{0x0ec2, 0x0e87, 0x0000}, 34286}, {{0x0ec2, 0x0e88, 0x0000}, 34288},
+        {{0x0ec2, 0x0e89, 0x0000}, 34290}, {{0x0ec2, 0x0e8a, 0x0000}, 34292},
+        {{0x0ec2, 0x0e8c, 0x0000}, 34294}, {{0x0ec2, 0x0e8d, 0x0000}, 34296},
+        {{0x0ec2, 0x0e8e, 0x0000}, 34298}, {{0x0ec2, 0x0e8f, 0x0000}, 34300},
+        {{0x0ec2, 0x0e90, 0x0000}, 34302}, {{0x0ec2, 0x0e91, 0x0000}, 34304},
+        {{0x0ec2, 0x0e92, 0x0000}, 34306}, {{0x0ec2, 0x0e93, 0x0000}, 34308},
+        {{0x0ec2, 0x0e94, 0x0000}, 34310}, {{0x0ec2, 0x0e95, 0x0000}, 34312},
+        {{0x0ec2, 0x0e96, 0x0000}, 34314}, {{0x0ec2, 0x0e97, 0x0000}, 34316},
+        {{0x0ec2, 0x0e98, 0x0000}, 34318}, {{0x0ec2, 0x0e99, 0x0000}, 34320},
+        {{0x0ec2, 0x0e9a, 0x0000}, 34322}, {{0x0ec2, 0x0e9b, 0x0000}, 34324},
+        {{0x0ec2, 0x0e9c, 0x0000}, 34326}, {{0x0ec2, 0x0e9d, 0x0000}, 34328},
+        {{0x0ec2, 0x0e9e, 0x0000}, 34330}, {{0x0ec2, 0x0e9f, 0x0000}, 34332},
+        {{0x0ec2, 0x0ea0, 0x0000}, 34334}, {{0x0ec2, 0x0ea1, 0x0000}, 34336},
+        {{0x0ec2, 0x0ea2, 0x0000}, 34338}, {{0x0ec2, 0x0ea3, 0x0000}, 34340},
+        {{0x0ec2, 0x0ea5, 0x0000}, 34342}, {{0x0ec2, 0x0ea7, 0x0000}, 34344},
+        {{0x0ec2, 0x0ea8, 0x0000}, 34346}, {{0x0ec2, 0x0ea9, 0x0000}, 34348},
+        {{0x0ec2, 0x0eaa, 0x0000}, 34350}, {{0x0ec2, 0x0eab, 0x0000}, 34352},
+        {{0x0ec2, 0x0eac, 0x0000}, 34354}, {{0x0ec2, 0x0ead, 0x0000}, 34356},
+        {{0x0ec2, 0x0eae, 0x0000}, 34358}, {{0x0ec2, 0x0edc, 0x0000}, 34360},
+        {{0x0ec2, 0x0edd, 0x0000}, 34363}, {{0x0ec2, 0x0ede, 0x0000}, 34366},
+        {{0x0ec2, 0x0edf, 0x0000}, 34368}, {{0x0ec3, 0x0e81, 0x0000}, 34370},
+        {{0x0ec3, 0x0e82, 0x0000}, 34372}, {{0x0ec3, 0x0e84, 0x0000}, 34374},
+        {{0x0ec3, 0x0e86, 0x0000}, 34376}, {{0x0ec3, 0x0e87, 0x0000}, 34378},
+        {{0x0ec3, 0x0e88, 0x0000}, 34380}, {{0x0ec3, 0x0e89, 0x0000}, 34382},
+        {{0x0ec3, 0x0e8a, 0x0000}, 34384}, {{0x0ec3, 0x0e8c, 0x0000}, 34386},
+        {{0x0ec3, 0x0e8d, 0x0000}, 34388}, {{0x0ec3, 0x0e8e, 0x0000}, 34390},
+        {{0x0ec3, 0x0e8f, 0x0000}, 34392}, {{0x0ec3, 0x0e90, 0x0000}, 34394},
+        {{0x0ec3, 0x0e91, 0x0000}, 34396}, {{0x0ec3, 0x0e92, 0x0000}, 34398},
+        {{0x0ec3, 0x0e93, 0x0000}, 34400}, {{0x0ec3, 0x0e94, 0x0000}, 34402},
+        {{0x0ec3, 0x0e95, 0x0000}, 34404}, {{0x0ec3, 0x0e96, 0x0000}, 34406},
+        {{0x0ec3, 0x0e97, 0x0000}, 34408}, {{0x0ec3, 0x0e98, 0x0000}, 34410},
+        {{0x0ec3, 0x0e99, 0x0000}, 34412}, {{0x0ec3, 0x0e9a, 0x0000}, 34414},
+        {{0x0ec3, 0x0e9b, 0x0000}, 34416}, {{0x0ec3, 0x0e9c, 0x0000}, 34418},
+        {{0x0ec3, 0x0e9d, 0x0000}, 34420}, {{0x0ec3, 0x0e9e, 0x0000}, 34422},
+        {{0x0ec3, 0x0e9f, 0x0000}, 34424}, {{0x0ec3, 0x0ea0, 0x0000}, 34426},
+        {{0x0ec3, 0x0ea1, 0x0000}, 34428}, {{0x0ec3, 0x0ea2, 0x0000}, 34430},
+        {{0x0ec3, 0x0ea3, 0x0000}, 34432}, {{0x0ec3, 0x0ea5, 0x0000}, 34434},
+        {{0x0ec3, 0x0ea7, 0x0000}, 34436}, {{0x0ec3, 0x0ea8, 0x0000}, 34438},
+        {{0x0ec3, 0x0ea9, 0x0000}, 34440}, {{0x0ec3, 0x0eaa, 0x0000}, 34442},
+        {{0x0ec3, 0x0eab, 0x0000}, 34444}, {{0x0ec3, 0x0eac, 0x0000}, 34446},
+        {{0x0ec3, 0x0ead, 0x0000}, 34448}, {{0x0ec3, 0x0eae, 0x0000}, 34450},
+        {{0x0ec3, 0x0edc, 0x0000}, 34452}, {{0x0ec3, 0x0edd, 0x0000}, 34455},
+        {{0x0ec3, 0x0ede, 0x0000}, 34458}, {{0x0ec3, 0x0edf, 0x0000}, 34460},
+        {{0x0ec4, 0x0e81, 0x0000}, 34462}, {{0x0ec4, 0x0e82, 0x0000}, 34464},
+        {{0x0ec4, 0x0e84, 0x0000}, 34466}, {{0x0ec4, 0x0e86, 0x0000}, 34468},
+        {{0x0ec4, 0x0e87, 0x0000}, 34470}, {{0x0ec4, 0x0e88, 0x0000}, 34472},
+        {{0x0ec4, 0x0e89, 0x0000}, 34474}, {{0x0ec4, 0x0e8a, 0x0000}, 34476},
+        {{0x0ec4, 0x0e8c, 0x0000}, 34478}, {{0x0ec4, 0x0e8d, 0x0000}, 34480},
+        {{0x0ec4, 0x0e8e, 0x0000}, 34482}, {{0x0ec4, 0x0e8f, 0x0000}, 34484},
+        {{0x0ec4, 0x0e90, 0x0000}, 34486}, {{0x0ec4, 0x0e91, 0x0000}, 34488},
+        {{0x0ec4, 0x0e92, 0x0000}, 34490}, {{0x0ec4, 0x0e93, 0x0000}, 34492},
+        {{0x0ec4, 0x0e94, 0x0000}, 34494}, {{0x0ec4, 0x0e95, 0x0000}, 34496},
+        {{0x0ec4, 0x0e96, 0x0000}, 34498}, {{0x0ec4, 0x0e97, 0x0000}, 34500},
+        {{0x0ec4, 0x0e98, 0x0000}, 34502}, {{0x0ec4, 0x0e99, 0x0000}, 34504},
+        {{0x0ec4, 0x0e9a, 0x0000}, 34506}, {{0x0ec4, 0x0e9b, 0x0000}, 34508},
+        {{0x0ec4, 0x0e9c, 0x0000}, 34510}, {{0x0ec4, 0x0e9d, 0x0000}, 34512},
+        {{0x0ec4, 0x0e9e, 0x0000}, 34514}, {{0x0ec4, 0x0e9f, 0x0000}, 34516},
+        {{0x0ec4, 0x0ea0, 0x0000}, 34518}, {{0x0ec4, 0x0ea1, 0x0000}, 34520},
+        {{0x0ec4, 0x0ea2, 0x0000}, 34522}, {{0x0ec4, 0x0ea3, 0x0000}, 34524},
+        {{0x0ec4, 0x0ea5, 0x0000}, 34526}, {{0x0ec4, 0x0ea7, 0x0000}, 34528},
+        {{0x0ec4, 0x0ea8, 0x0000}, 34530}, {{0x0ec4, 0x0ea9, 0x0000}, 34532},
+        {{0x0ec4, 0x0eaa, 0x0000}, 34534}, {{0x0ec4, 0x0eab, 0x0000}, 34536},
+        {{0x0ec4, 0x0eac, 0x0000}, 34538}, {{0x0ec4, 0x0ead, 0x0000}, 34540},
+        {{0x0ec4, 0x0eae, 0x0000}, 34542}, {{0x0ec4, 0x0edc, 0x0000}, 34544},
+        {{0x0ec4, 0x0edd, 0x0000}, 34547}, {{0x0ec4, 0x0ede, 0x0000}, 34550},
+        {{0x0ec4, 0x0edf, 0x0000}, 34552}, {{0x0ecd, 0x0eb2, 0x0000}, 3299},
+        {{0x0f71, 0x0f72, 0x0000}, 3431}, {{0x0f71, 0x0f74, 0x0000}, 3433},
+        {{0x0f71, 0x0f80, 0x0000}, 3443}, {{0x0fb2, 0x0f71, 0x0f80}, 3435},
+        {{0x0fb2, 0x0f80, 0x0000}, 3434}, {{0x0fb2, 0x0f81, 0x0000}, 3435},
+        {{0x0fb3, 0x0f71, 0x0f80}, 3437}, {{0x0fb3, 0x0f80, 0x0000}, 3436},
+        {{0x0fb3, 0x0f81, 0x0000}, 3437}, {{0x1025, 0x102e, 0x0000}, 3572},
+        {{0x19b5, 0x1980, 0x0000}, 34554}, {{0x19b5, 0x1981, 0x0000}, 34556},
+        {{0x19b5, 0x1982, 0x0000}, 34558}, {{0x19b5, 0x1983, 0x0000}, 34560},
+        {{0x19b5, 0x1984, 0x0000}, 34562}, {{0x19b5, 0x1985, 0x0000}, 34564},
+        {{0x19b5, 0x1986, 0x0000}, 34566}, {{0x19b5, 0x1987, 0x0000}, 34568},
+        {{0x19b5, 0x1988, 0x0000}, 34570}, {{0x19b5, 0x1989, 0x0000}, 34572},
+        {{0x19b5, 0x198a, 0x0000}, 34574}, {{0x19b5, 0x198b, 0x0000}, 34576},
+        {{0x19b5, 0x198c, 0x0000}, 34578}, {{0x19b5, 0x198d, 0x0000}, 34580},
+        {{0x19b5, 0x198e, 0x0000}, 34582}, {{0x19b5, 0x198f, 0x0000}, 34584},
+        {{0x19b5, 0x1990, 0x0000}, 34586}, {{0x19b5, 0x1991, 0x0000}, 34588},
+        {{0x19b5, 0x1992, 0x0000}, 34590}, {{0x19b5, 0x1993, 0x0000}, 34592},
+        {{0x19b5, 0x1994, 0x0000}, 34594}, {{0x19b5, 0x1995, 0x0000}, 34596},
+        {{0x19b5, 0x1996, 0x0000}, 34598}, {{0x19b5, 0x1997, 0x0000}, 34600},
+        {{0x19b5, 0x1998, 0x0000}, 34602}, {{0x19b5, 0x1999, 0x0000}, 34604},
+        {{0x19b5, 0x199a, 0x0000}, 34606}, {{0x19b5, 0x199b, 0x0000}, 34608},
+        {{0x19b5, 0x199c, 0x0000}, 34610}, {{0x19b5, 0x199d, 0x0000}, 34612},
+        {{0x19b5, 0x199e, 0x0000}, 34614}, {{0x19b5, 0x199f, 0x0000}, 34616},
+        {{0x19b5, 0x19a0, 0x0000}, 34618}, {{0x19b5, 0x19a1, 0x0000}, 34620},
+        {{0x19b5, 0x19a2, 0x0000}, 34622}, {{0x19b5, 0x19a3, 0x0000}, 34624},
+        {{0x19b5, 0x19a4, 0x0000}, 34626}, {{0x19b5, 0x19a5, 0x0000}, 34628},
+        {{0x19b5, 0x19a6, 0x0000}, 34630}, {{0x19b5, 0x19a7, 0x0000}, 34632},
+        {{0x19b5, 0x19a8, 0x0000}, 34634}, {{0x19b5, 0x19a9, 0x0000}, 34636},
+        {{0x19b5, 0x19aa, 0x0000}, 34638}, {{0x19b5, 0x19ab, 0x0000}, 34640},
+        {{0x19b6, 0x1980, 0x0000}, 34642}, {{0x19b6, 0x1981, 0x0000}, 34644},
+        {{0x19b6, 0x1982, 0x0000}, 34646}, {{0x19b6, 0x1983, 0x0000}, 34648},
+        {{0x19b6, 0x1984, 0x0000}, 34650}, {{0x19b6, 0x1985, 0x0000}, 34652},
+        {{0x19b6, 0x1986, 0x0000}, 34654}, {{0x19b6, 0x1987, 0x0000}, 34656},
+        {{0x19b6, 0x1988, 0x0000}, 34658}, {{0x19b6, 0x1989, 0x0000}, 34660},
+        {{0x19b6, 0x198a, 0x0000}, 34662}, {{0x19b6, 0x198b, 0x0000}, 34664},
+        {{0x19b6, 0x198c, 0x0000}, 34666}, {{0x19b6, 0x198d, 0x0000}, 34668},
+        {{0x19b6, 0x198e, 0x0000}, 34670}, {{0x19b6, 0x198f, 0x0000}, 34672},
+        {{0x19b6, 0x1990, 0x0000}, 34674}, {{0x19b6, 0x1991, 0x0000}, 34676},
+        {{0x19b6, 0x1992, 0x0000}, 34678}, {{0x19b6, 0x1993, 0x0000}, 34680},
+        {{0x19b6, 0x1994, 0x0000}, 34682}, {{0x19b6, 0x1995, 0x0000}, 34684},
+        {{0x19b6, 0x1996, 0x0000}, 34686}, {{0x19b6, 0x1997, 0x0000}, 34688},
+        {{0x19b6, 0x1998, 0x0000}, 34690}, {{0x19b6, 0x1999, 0x0000}, 34692},
+        {{0x19b6, 0x199a, 0x0000}, 34694}, {{0x19b6, 0x199b, 0x0000}, 34696},
+        {{0x19b6, 0x199c, 0x0000}, 34698}, {{0x19b6, 0x199d, 0x0000}, 34700},
+        {{0x19b6, 0x199e, 0x0000}, 34702}, {{0x19b6, 0x199f, 0x0000}, 34704},
+        {{0x19b6, 0x19a0, 0x0000}, 34706}, {{0x19b6, 0x19a1, 0x0000}, 34708},
+        {{0x19b6, 0x19a2, 0x0000}, 34710}, {{0x19b6, 0x19a3, 0x0000}, 34712},
+        {{0x19b6, 0x19a4, 0x0000}, 34714}, {{0x19b6, 0x19a5, 0x0000}, 34716},
+        {{0x19b6, 0x19a6, 0x0000}, 34718}, {{0x19b6, 0x19a7, 0x0000}, 34720},
+        {{0x19b6, 0x19a8, 0x0000}, 34722}, {{0x19b6, 0x19a9, 0x0000}, 34724},
+        {{0x19b6, 0x19aa, 0x0000}, 34726}, {{0x19b6, 0x19ab, 0x0000}, 34728},
+        {{0x19b7, 0x1980, 0x0000}, 34730}, {{0x19b7, 0x1981, 0x0000}, 34732},
+        {{0x19b7, 0x1982, 0x0000}, 34734}, {{0x19b7, 0x1983, 0x0000}, 34736},
+        {{0x19b7, 0x1984, 0x0000}, 34738}, {{0x19b7, 0x1985, 0x0000}, 34740},
+        {{0x19b7, 0x1986, 0x0000}, 34742}, {{0x19b7, 0x1987, 0x0000}, 34744},
+        {{0x19b7, 0x1988, 0x0000}, 34746}, {{0x19b7, 0x1989, 0x0000}, 34748},
+        {{0x19b7, 0x198a, 0x0000}, 34750}, {{0x19b7, 0x198b, 0x0000}, 34752},
+        {{0x19b7, 0x198c, 0x0000}, 34754}, {{0x19b7, 0x198d, 0x0000}, 34756},
+        {{0x19b7, 0x198e, 0x0000}, 34758}, {{0x19b7, 0x198f, 0x0000}, 34760},
+        {{0x19b7, 0x1990, 0x0000}, 34762}, {{0x19b7, 0x1991, 0x0000}, 34764},
+        {{0x19b7, 0x1992, 0x0000}, 34766}, {{0x19b7, 0x1993, 0x0000}, 34768},
+        {{0x19b7, 0x1994, 0x0000}, 34770}, {{0x19b7, 0x1995, 0x0000}, 34772},
+        {{0x19b7, 0x1996, 0x0000}, 34774}, {{0x19b7, 0x1997, 0x0000}, 34776},
+        {{0x19b7, 0x1998, 0x0000}, 34778}, {{0x19b7, 0x1999, 0x0000}, 34780},
+        {{0x19b7, 0x199a, 0x0000}, 34782}, {{0x19b7, 0x199b, 0x0000}, 34784},
+        {{0x19b7, 0x199c, 0x0000}, 34786}, {{0x19b7, 0x199d, 0x0000}, 34788},
+        {{0x19b7, 0x199e, 0x0000}, 34790}, {{0x19b7, 0x199f, 0x0000}, 34792},
+        {{0x19b7, 0x19a0, 0x0000}, 34794}, {{0x19b7, 0x19a1, 0x0000}, 34796},
+        {{0x19b7, 0x19a2, 0x0000}, 34798}, {{0x19b7, 0x19a3, 0x0000}, 34800},
+        {{0x19b7, 0x19a4, 0x0000}, 34802}, {{0x19b7, 0x19a5, 0x0000}, 34804},
+        {{0x19b7, 0x19a6, 0x0000}, 34806}, {{0x19b7, 0x19a7, 0x0000}, 34808},
+        {{0x19b7, 0x19a8, 0x0000}, 34810}, {{0x19b7, 0x19a9, 0x0000}, 34812},
+        {{0x19b7, 0x19aa, 0x0000}, 34814}, {{0x19b7, 0x19ab, 0x0000}, 34816},
+        {{0x19ba, 0x1980, 0x0000}, 34818}, {{0x19ba, 0x1981, 0x0000}, 34820},
+        {{0x19ba, 0x1982, 0x0000}, 34822}, {{0x19ba, 0x1983, 0x0000}, 34824},
+        {{0x19ba, 0x1984, 0x0000}, 34826}, {{0x19ba, 0x1985, 0x0000}, 34828},
+        {{0x19ba, 0x1986, 0x0000}, 34830}, {{0x19ba, 0x1987, 0x0000}, 34832},
+        {{0x19ba, 0x1988, 0x0000}, 34834}, {{0x19ba, 0x1989, 0x0000}, 34836},
+        {{0x19ba, 0x198a, 0x0000}, 34838}, {{0x19ba, 0x198b, 0x0000}, 34840},
+        {{0x19ba, 0x198c, 0x0000}, 34842}, {{0x19ba, 0x198d, 0x0000}, 34844},
+        {{0x19ba, 0x198e, 0x0000}, 34846}, {{0x19ba, 0x198f, 0x0000}, 34848},
+        {{0x19ba, 0x1990, 0x0000}, 34850}, {{0x19ba, 0x1991, 0x0000}, 34852},
+        {{0x19ba, 0x1992, 0x0000}, 34854}, {{0x19ba, 0x1993, 0x0000}, 34856},
+        {{0x19ba, 0x1994, 0x0000}, 34858}, {{0x19ba, 0x1995, 0x0000}, 34860},
+        {{0x19ba, 0x1996, 0x0000}, 34862}, {{0x19ba, 0x1997, 0x0000}, 34864},
+        {{0x19ba, 0x1998, 0x0000}, 34866}, {{0x19ba, 0x1999, 0x0000}, 34868},
+        {{0x19ba, 0x199a, 0x0000}, 34870}, {{0x19ba, 0x199b, 0x0000}, 34872},
+        {{0x19ba, 0x199c, 0x0000}, 34874}, {{0x19ba, 0x199d, 0x0000}, 34876},
+        {{0x19ba, 0x199e, 0x0000}, 34878}, {{0x19ba, 0x199f, 0x0000}, 34880},
+        {{0x19ba, 0x19a0, 0x0000}, 34882}, {{0x19ba, 0x19a1, 0x0000}, 34884},
+        {{0x19ba, 0x19a2, 0x0000}, 34886}, {{0x19ba, 0x19a3, 0x0000}, 34888},
+        {{0x19ba, 0x19a4, 0x0000}, 34890}, {{0x19ba, 0x19a5, 0x0000}, 34892},
+        {{0x19ba, 0x19a6, 0x0000}, 34894}, {{0x19ba, 0x19a7, 0x0000}, 34896},
+        {{0x19ba, 0x19a8, 0x0000}, 34898}, {{0x19ba, 0x19a9, 0x0000}, 34900},
+        {{0x19ba, 0x19aa, 0x0000}, 34902}, {{0x19ba, 0x19ab, 0x0000}, 34904},
+        {{0x1b05, 0x1b35, 0x0000}, 6001}, {{0x1b07, 0x1b35, 0x0000}, 6003},
+        {{0x1b09, 0x1b35, 0x0000}, 6005}, {{0x1b0b, 0x1b35, 0x0000}, 6007},
+        {{0x1b0d, 0x1b35, 0x0000}, 6009}, {{0x1b11, 0x1b35, 0x0000}, 6013},
+        {{0x1b3a, 0x1b35, 0x0000}, 6053}, {{0x1b3c, 0x1b35, 0x0000}, 6055},
+        {{0x1b3e, 0x1b35, 0x0000}, 6058}, {{0x1b3f, 0x1b35, 0x0000}, 6059},
+        {{0x1b42, 0x1b35, 0x0000}, 6061}, {{0xaab5, 0xaa80, 0x0000}, 34906},
+        {{0xaab5, 0xaa81, 0x0000}, 34908}, {{0xaab5, 0xaa82, 0x0000}, 34910},
+        {{0xaab5, 0xaa83, 0x0000}, 34912}, {{0xaab5, 0xaa84, 0x0000}, 34914},
+        {{0xaab5, 0xaa85, 0x0000}, 34916}, {{0xaab5, 0xaa86, 0x0000}, 34918},
+        {{0xaab5, 0xaa87, 0x0000}, 34920}, {{0xaab5, 0xaa88, 0x0000}, 34922},
+        {{0xaab5, 0xaa89, 0x0000}, 34924}, {{0xaab5, 0xaa8a, 0x0000}, 34926},
+        {{0xaab5, 0xaa8b, 0x0000}, 34928}, {{0xaab5, 0xaa8c, 0x0000}, 34930},
+        {{0xaab5, 0xaa8d, 0x0000}, 34932}, {{0xaab5, 0xaa8e, 0x0000}, 34934},
+        {{0xaab5, 0xaa8f, 0x0000}, 34936}, {{0xaab5, 0xaa90, 0x0000}, 34938},
+        {{0xaab5, 0xaa91, 0x0000}, 34940}, {{0xaab5, 0xaa92, 0x0000}, 34942},
+        {{0xaab5, 0xaa93, 0x0000}, 34944}, {{0xaab5, 0xaa94, 0x0000}, 34946},
+        {{0xaab5, 0xaa95, 0x0000}, 34948}, {{0xaab5, 0xaa96, 0x0000}, 34950},
+        {{0xaab5, 0xaa97, 0x0000}, 34952}, {{0xaab5, 0xaa98, 0x0000}, 34954},
+        {{0xaab5, 0xaa99, 0x0000}, 34956}, {{0xaab5, 0xaa9a, 0x0000}, 34958},
+        {{0xaab5, 0xaa9b, 0x0000}, 34960}, {{0xaab5, 0xaa9c, 0x0000}, 34962},
+        {{0xaab5, 0xaa9d, 0x0000}, 34964}, {{0xaab5, 0xaa9e, 0x0000}, 34966},
+        {{0xaab5, 0xaa9f, 0x0000}, 34968}, {{0xaab5, 0xaaa0, 0x0000}, 34970},
+        {{0xaab5, 0xaaa1, 0x0000}, 34972}, {{0xaab5, 0xaaa2, 0x0000}, 34974},
+        {{0xaab5, 0xaaa3, 0x0000}, 34976}, {{0xaab5, 0xaaa4, 0x0000}, 34978},
+        {{0xaab5, 0xaaa5, 0x0000}, 34980}, {{0xaab5, 0xaaa6, 0x0000}, 34982},
+        {{0xaab5, 0xaaa7, 0x0000}, 34984}, {{0xaab5, 0xaaa8, 0x0000}, 34986},
+        {{0xaab5, 0xaaa9, 0x0000}, 34988}, {{0xaab5, 0xaaaa, 0x0000}, 34990},
+        {{0xaab5, 0xaaab, 0x0000}, 34992}, {{0xaab5, 0xaaac, 0x0000}, 34994},
+        {{0xaab5, 0xaaad, 0x0000}, 34996}, {{0xaab5, 0xaaae, 0x0000}, 34998},
+        {{0xaab5, 0xaaaf, 0x0000}, 35000}, {{0xaab6, 0xaa80, 0x0000}, 35002},
+        {{0xaab6, 0xaa81, 0x0000}, 35004}, {{0xaab6, 0xaa82, 0x0000}, 35006},
+        {{0xaab6, 0xaa83, 0x0000}, 35008}, {{0xaab6, 0xaa84, 0x0000}, 35010},
+        {{0xaab6, 0xaa85, 0x0000}, 35012}, {{0xaab6, 0xaa86, 0x0000}, 35014},
+        {{0xaab6, 0xaa87, 0x0000}, 35016}, {{0xaab6, 0xaa88, 0x0000}, 35018},
+        {{0xaab6, 0xaa89, 0x0000}, 35020}, {{0xaab6, 0xaa8a, 0x0000}, 35022},
+        {{0xaab6, 0xaa8b, 0x0000}, 35024}, {{0xaab6, 0xaa8c, 0x0000}, 35026},
+        {{0xaab6, 0xaa8d, 0x0000}, 35028}, {{0xaab6, 0xaa8e, 0x0000}, 35030},
+        {{0xaab6, 0xaa8f, 0x0000}, 35032}, {{0xaab6, 0xaa90, 0x0000}, 35034},
+        {{0xaab6, 0xaa91, 0x0000}, 35036}, {{0xaab6, 0xaa92, 0x0000}, 35038},
+        {{0xaab6, 0xaa93, 0x0000}, 35040}, {{0xaab6, 0xaa94, 0x0000}, 35042},
+        {{0xaab6, 0xaa95, 0x0000}, 35044}, {{0xaab6, 0xaa96, 0x0000}, 35046},
+        {{0xaab6, 0xaa97, 0x0000}, 35048}, {{0xaab6, 0xaa98, 0x0000}, 35050},
+        {{0xaab6, 0xaa99, 0x0000}, 35052}, {{0xaab6, 0xaa9a, 0x0000}, 35054},
+        {{0xaab6, 0xaa9b, 0x0000}, 35056}, {{0xaab6, 0xaa9c, 0x0000}, 35058},
+        {{0xaab6, 0xaa9d, 0x0000}, 35060}, {{0xaab6, 0xaa9e, 0x0000}, 35062},
+        {{0xaab6, 0xaa9f, 0x0000}, 35064}, {{0xaab6, 0xaaa0, 0x0000}, 35066},
+        {{0xaab6, 0xaaa1, 0x0000}, 35068}, {{0xaab6, 0xaaa2, 0x0000}, 35070},
+        {{0xaab6, 0xaaa3, 0x0000}, 35072}, {{0xaab6, 0xaaa4, 0x0000}, 35074},
+        {{0xaab6, 0xaaa5, 0x0000}, 35076}, {{0xaab6, 0xaaa6, 0x0000}, 35078},
+        {{0xaab6, 0xaaa7, 0x0000}, 35080}, {{0xaab6, 0xaaa8, 0x0000}, 35082},
+        {{0xaab6, 0xaaa9, 0x0000}, 35084}, {{0xaab6, 0xaaaa, 0x0000}, 35086},
+        {{0xaab6, 0xaaab, 0x0000}, 35088}, {{0xaab6, 0xaaac, 0x0000}, 35090},
+        {{0xaab6, 0xaaad, 0x0000}, 35092}, {{0xaab6, 0xaaae, 0x0000}, 35094},
+        {{0xaab6, 0xaaaf, 0x0000}, 35096}, {{0xaab9, 0xaa80, 0x0000}, 35098},
+        {{0xaab9, 0xaa81, 0x0000}, 35100}, {{0xaab9, 0xaa82, 0x0000}, 35102},
+        {{0xaab9, 0xaa83, 0x0000}, 35104}, {{0xaab9, 0xaa84, 0x0000}, 35106},
+        {{0xaab9, 0xaa85, 0x0000}, 35108}, {{0xaab9, 0xaa86, 0x0000}, 35110},
+        {{0xaab9, 0xaa87, 0x0000}, 35112}, {{0xaab9, 0xaa88, 0x0000}, 35114},
+        {{0xaab9, 0xaa89, 0x0000}, 35116}, {{0xaab9, 0xaa8a, 0x0000}, 35118},
+        {{0xaab9, 0xaa8b, 0x0000}, 35120}, {{0xaab9, 0xaa8c, 0x0000}, 35122},
+        {{0xaab9, 0xaa8d, 0x0000}, 35124}, {{0xaab9, 0xaa8e, 0x0000}, 35126},
+        {{0xaab9, 0xaa8f, 0x0000}, 35128}, {{0xaab9, 0xaa90, 0x0000}, 35130},
+        {{0xaab9, 0xaa91, 0x0000}, 35132}, {{0xaab9, 0xaa92, 0x0000}, 35134},
+        {{0xaab9, 0xaa93, 0x0000}, 35136}, {{0xaab9, 0xaa94, 0x0000}, 35138},
+        {{0xaab9, 0xaa95, 0x0000}, 35140}, {{0xaab9, 0xaa96, 0x0000}, 35142},
+        {{0xaab9, 0xaa97, 0x0000}, 35144}, {{0xaab9, 0xaa98, 0x0000}, 35146},
+        {{0xaab9, 0xaa99, 0x0000}, 35148}, {{0xaab9, 0xaa9a, 0x0000}, 35150},
+        {{0xaab9, 0xaa9b, 0x0000}, 35152}, {{0xaab9, 0xaa9c, 0x0000}, 35154},
+        {{0xaab9, 0xaa9d, 0x0000}, 35156}, {{0xaab9, 0xaa9e, 0x0000}, 35158},
+        {{0xaab9, 0xaa9f, 0x0000}, 35160}, {{0xaab9, 0xaaa0, 0x0000}, 35162},
+        {{0xaab9, 0xaaa1, 0x0000}, 35164}, {{0xaab9, 0xaaa2, 0x0000}, 35166},
+        {{0xaab9, 0xaaa3, 0x0000}, 35168}, {{0xaab9, 0xaaa4, 0x0000}, 35170},
+        {{0xaab9, 0xaaa5, 0x0000}, 35172}, {{0xaab9, 0xaaa6, 0x0000}, 35174},
+        {{0xaab9, 0xaaa7, 0x0000}, 35176}, {{0xaab9, 0xaaa8, 0x0000}, 35178},
+        {{0xaab9, 0xaaa9, 0x0000}, 35180}, {{0xaab9, 0xaaaa, 0x0000}, 35182},
+        {{0xaab9, 0xaaab, 0x0000}, 35184}, {{0xaab9, 0xaaac, 0x0000}, 35186},
+        {{0xaab9, 0xaaad, 0x0000}, 35188}, {{0xaab9, 0xaaae, 0x0000}, 35190},
+        {{0xaab9, 0xaaaf, 0x0000}, 35192}, {{0xaabb, 0xaa80, 0x0000}, 35194},
+        {{0xaabb, 0xaa81, 0x0000}, 35196}, {{0xaabb, 0xaa82, 0x0000}, 35198},
+        {{0xaabb, 0xaa83, 0x0000}, 35200}, {{0xaabb, 0xaa84, 0x0000}, 35202},
+        {{0xaabb, 0xaa85, 0x0000}, 35204}, {{0xaabb, 0xaa86, 0x0000}, 35206},
+        {{0xaabb, 0xaa87, 0x0000}, 35208}, {{0xaabb, 0xaa88, 0x0000}, 35210},
+        {{0xaabb, 0xaa89, 0x0000}, 35212}, {{0xaabb, 0xaa8a, 0x0000}, 35214},
+        {{0xaabb, 0xaa8b, 0x0000}, 35216}, {{0xaabb, 0xaa8c, 0x0000}, 35218},
+        {{0xaabb, 0xaa8d, 0x0000}, 35220}, {{0xaabb, 0xaa8e, 0x0000}, 35222},
+        {{0xaabb, 0xaa8f, 0x0000}, 35224}, {{0xaabb, 0xaa90, 0x0000}, 35226},
+        {{0xaabb, 0xaa91, 0x0000}, 35228}, {{0xaabb, 0xaa92, 0x0000}, 35230},
+        {{0xaabb, 0xaa93, 0x0000}, 35232}, {{0xaabb, 0xaa94, 0x0000}, 35234},
+        {{0xaabb, 0xaa95, 0x0000}, 35236}, {{0xaabb, 0xaa96, 0x0000}, 35238},
+        {{0xaabb, 0xaa97, 0x0000}, 35240}, {{0xaabb, 0xaa98, 0x0000}, 35242},
+        {{0xaabb, 0xaa99, 0x0000}, 35244}, {{0xaabb, 0xaa9a, 0x0000}, 35246},
+        {{0xaabb, 0xaa9b, 0x0000}, 35248}, {{0xaabb, 0xaa9c, 0x0000}, 35250},
+        {{0xaabb, 0xaa9d, 0x0000}, 35252}, {{0xaabb, 0xaa9e, 0x0000}, 35254},
+        {{0xaabb, 0xaa9f, 0x0000}, 35256}, {{0xaabb, 0xaaa0, 0x0000}, 35258},
+        {{0xaabb, 0xaaa1, 0x0000}, 35260}, {{0xaabb, 0xaaa2, 0x0000}, 35262},
+        {{0xaabb, 0xaaa3, 0x0000}, 35264}, {{0xaabb, 0xaaa4, 0x0000}, 35266},
+        {{0xaabb, 0xaaa5, 0x0000}, 35268}, {{0xaabb, 0xaaa6, 0x0000}, 35270},
+        {{0xaabb, 0xaaa7, 0x0000}, 35272}, {{0xaabb, 0xaaa8, 0x0000}, 35274},
+        {{0xaabb, 0xaaa9, 0x0000}, 35276}, {{0xaabb, 0xaaaa, 0x0000}, 35278},
+        {{0xaabb, 0xaaab, 0x0000}, 35280}, {{0xaabb, 0xaaac, 0x0000}, 35282},
+        {{0xaabb, 0xaaad, 0x0000}, 35284}, {{0xaabb, 0xaaae, 0x0000}, 35286},
+        {{0xaabb, 0xaaaf, 0x0000}, 35288}, {{0xaabc, 0xaa80, 0x0000}, 35290},
+        {{0xaabc, 0xaa81, 0x0000}, 35292}, {{0xaabc, 0xaa82, 0x0000}, 35294},
+        {{0xaabc, 0xaa83, 0x0000}, 35296}, {{0xaabc, 0xaa84, 0x0000}, 35298},
+        {{0xaabc, 0xaa85, 0x0000}, 35300}, {{0xaabc, 0xaa86, 0x0000}, 35302},
+        {{0xaabc, 0xaa87, 0x0000}, 35304}, {{0xaabc, 0xaa88, 0x0000}, 35306},
+        {{0xaabc, 0xaa89, 0x0000}, 35308}, {{0xaabc, 0xaa8a, 0x0000}, 35310},
+        {{0xaabc, 0xaa8b, 0x0000}, 35312}, {{0xaabc, 0xaa8c, 0x0000}, 35314},
+        {{0xaabc, 0xaa8d, 0x0000}, 35316}, {{0xaabc, 0xaa8e, 0x0000}, 35318},
+        {{0xaabc, 0xaa8f, 0x0000}, 35320}, {{0xaabc, 0xaa90, 0x0000}, 35322},
+        {{0xaabc, 0xaa91, 0x0000}, 35324}, {{0xaabc, 0xaa92, 0x0000}, 35326},
+        {{0xaabc, 0xaa93, 0x0000}, 35328}, {{0xaabc, 0xaa94, 0x0000}, 35330},
+        {{0xaabc, 0xaa95, 0x0000}, 35332}, {{0xaabc, 0xaa96, 0x0000}, 35334},
+        {{0xaabc, 0xaa97, 0x0000}, 35336}, {{0xaabc, 0xaa98, 0x0000}, 35338},
+        {{0xaabc, 0xaa99, 0x0000}, 35340}, {{0xaabc, 0xaa9a, 0x0000}, 35342},
+        {{0xaabc, 0xaa9b, 0x0000}, 35344}, {{0xaabc, 0xaa9c, 0x0000}, 35346},
+        {{0xaabc, 0xaa9d, 0x0000}, 35348}, {{0xaabc, 0xaa9e, 0x0000}, 35350},
+        {{0xaabc, 0xaa9f, 0x0000}, 35352}, {{0xaabc, 0xaaa0, 0x0000}, 35354},
+        {{0xaabc, 0xaaa1, 0x0000}, 35356}, {{0xaabc, 0xaaa2, 0x0000}, 35358},
+        {{0xaabc, 0xaaa3, 0x0000}, 35360}, {{0xaabc, 0xaaa4, 0x0000}, 35362},
+        {{0xaabc, 0xaaa5, 0x0000}, 35364}, {{0xaabc, 0xaaa6, 0x0000}, 35366},
+        {{0xaabc, 0xaaa7, 0x0000}, 35368}, {{0xaabc, 0xaaa8, 0x0000}, 35370},
+        {{0xaabc, 0xaaa9, 0x0000}, 35372}, {{0xaabc, 0xaaaa, 0x0000}, 35374},
+        {{0xaabc, 0xaaab, 0x0000}, 35376}, {{0xaabc, 0xaaac, 0x0000}, 35378},
+        {{0xaabc, 0xaaad, 0x0000}, 35380}, {{0xaabc, 0xaaae, 0x0000}, 35382},
+        {{0xaabc, 0xaaaf, 0x0000}, 35384}, {{0x11131, 0x11127, 0x0000}, 22454},
+        {{0x11132, 0x11127, 0x0000}, 22455}, {{0x11347, 0x1133e, 0x0000}, 22807},
+        {{0x11347, 0x11357, 0x0000}, 22808}, {{0x114b9, 0x114b0, 0x0000}, 22961},
+        {{0x114b9, 0x114ba, 0x0000}, 22960}, {{0x114b9, 0x114bd, 0x0000}, 22963},
+        {{0x115b8, 0x115af, 0x0000}, 23025}, {{0x115b9, 0x115af, 0x0000}, 23026},
+        {{0x11935, 0x11930, 0x0000}, 23427},
+};
+#pragma endregion
+
+static inline uint16_t getCollationEntry(uint32_t code) {
+    if (code > 0x10ffff) return 0;
+    auto block = CollationStage2[(CollationStage1[code >> 10] << 6) + ((code >> 4) & 63)];
+    return CollationStage3[(block << 4) + (code & 15)];
+}
+
+static const CollationContraction *findContraction(const uint32_t *codes, size_t count) {
+    uint32_t key[MAX_CONTRACTION] = {0, 0, 0};
+    memcpy(key, codes, count * sizeof(uint32_t));
+    auto end = CollationContractions + sizeof(CollationContractions) / sizeof(CollationContractions[0]);
+    auto it = std::lower_bound(CollationContractions, end, key,
+                               [](const CollationContraction &contraction, const uint32_t *k) {
+                                   return std::lexicographical_compare(contraction.codes, contraction.codes + MAX_CONTRACTION,
+                                                                       k, k + MAX_CONTRACTION);
+                               });
+    if (it != end && 0 == memcmp(it->codes, key, sizeof(key))) return it;
+    return nullptr;
+}
+
+/// 追加从 index 开始的同一字符的排序元素
+static void appendElements(uint16_t index, std::vector<uint32_t> &elements) {
+    uint32_t element;
+    do {
+        element = CollationElements[index++];
+        elements.push_back(element & ~(uint32_t) (CE_MORE | CE_CONTRACTION));
+    } while (element & CE_MORE);
+}
+
+/// 是否为 CJK Unified Ideographs 或 CJK Compatibility Ideographs 区中的统一表意文字
+static bool isCoreHan(uint32_t code) {
+    if (code >= 0x4e00 && code <= 0x9ffc) return true;
+    switch (code) {
+        case 0xfa0e:
+        case 0xfa0f:
+        case 0xfa11:
+        case 0xfa13:
+        case 0xfa14:
+        case 0xfa1f:
+        case 0xfa21:
+        case 0xfa23:
+        case 0xfa24:
+        case 0xfa27:
+        case 0xfa28:
+        case 0xfa29:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/// 是否为扩展区中的统一表意文字
+static bool isExtendedHan(uint32_t code) {
+    return (code >= 0x3400 && code <= 0x4dbf) || (code >= 0x20000 && code <= 0x2a6dd) ||
+           (code >= 0x2a700 && code <= 0x2b734) || (code >= 0x2b740 && code <= 0x2b81d) ||
+           (code >= 0x2b820 && code <= 0x2cea1) || (code >= 0x2ceb0 && code <= 0x2ebe0) ||
+           (code >= 0x30000 && code <= 0x3134a);
+}
+
+/// 隐式权重（UTS #10 第 10.1 节），表意文字按码点排在其他字符之后
+static void appendImplicit(uint32_t code, std::vector<uint32_t> &elements) {
+    uint32_t first, second;
+    // 西夏文、女书与契丹小字只包括 Unicode 13.0 中已分配的字符
+    if ((code >= 0x17000 && code <= 0x187f7) || (code >= 0x18800 && code <= 0x18aff) || (code >= 0x18d00 && code <= 0x18d08)) {
+        // 西夏文
+        first = 0xfb00;
+        second = code - 0x17000;
+    } else if (code >= 0x1b170 && code <= 0x1b2fb) {
+        // 女书
+        first = 0xfb01;
+        second = code - 0x1b170;
+    } else if (code >= 0x18b00 && code <= 0x18cd5) {
+        // 契丹小字
+        first = 0xfb02;
+        second = code - 0x18b00;
+    } else {
+        first = (isCoreHan(code) ? 0xfb40 : isExtendedHan(code) ? 0xfb80 : 0xfbc0) + (code >> 15);
+        second = code & 0x7fff;
+    }
+    elements.push_back(first << 16 | 0x20 << 7 | 0x02 << 1);
+    elements.push_back((second | 0x8000) << 16);
+}
+
+/// 把 NFD 码点序列映射为排序元素，处理缩约（UTS #10 S2.1）
+static void collectElements(std::vector<uint32_t> &codes, std::vector<uint32_t> &elements) {
+    auto size = codes.size();
+    for (size_t i = 0; i < size; i++) {
+        auto code = codes[i];
+        if (CODE_REMOVED == code) continue;
+        auto entry = getCollationEntry(code);
+        if (0 == entry) {
+            appendImplicit(code, elements);
+            continue;
+        }
+        uint16_t index = entry - 1;
+        if (CollationElements[index] & CE_CONTRACTION) {
+            uint32_t sequence[MAX_CONTRACTION] = {code};
+            size_t matched = 1;
+            // 连续缩约取最长匹配
+            size_t count = 1;
+            for (auto p = i + 1; count < MAX_CONTRACTION && p < size; p++) {
+                if (CODE_REMOVED == codes[p]) continue;
+                sequence[count++] = codes[p];
+                auto contraction = findContraction(sequence, count);
+                if (contraction) {
+                    index = contraction->element;
+                    matched = count;
+                    i = p;
+                }
+            }
+            // 不连续缩约：其后未被阻断的组合符
+            uint8_t lastCcc = 0;
+            for (auto p = i + 1; p < size; p++) {
+                if (CODE_REMOVED == codes[p]) continue;
+                auto ccc = SChar(codes[p]).combiningClass();
+                if (0 == ccc) break;
+                if (lastCcc != ccc && matched < MAX_CONTRACTION) {
+                    sequence[matched] = codes[p];
+                    auto contraction = findContraction(sequence, matched + 1);
+                    if (contraction) {
+                        index = contraction->element;
+                        matched++;
+                        codes[p] = CODE_REMOVED;
+                        continue;
+                    }
+                }
+                lastCcc = ccc;
+            }
+        }
+        appendElements(index, elements);
+    }
+}
+
+/// 生成排序键
+/// \param codes 复用的码点缓冲区
+/// \param elements 复用的排序元素缓冲区
+static void buildSortKey(const SStringView &str, SCollationStrength strength, bool shifted,
+                         std::vector<uint32_t> &codes, std::vector<uint32_t> &elements, SString &out) {
+    out.resize(0);
+    codes.clear();
+    elements.clear();
+    if (!str.null()) {
+        SString nfd;
+        auto view = str;
+        if (!str.isNormalized(sstr::SNormalForm::NFD)) {
+            nfd = str.normalize(sstr::SNormalForm::NFD);
+            view = nfd;
+        }
+        auto p = view.data();
+        auto end = p + view.size();
+        int n;
+        for (; p < end; p += n) codes.push_back(sstr::DecodeUTF8(p, end, n));
+        collectElements(codes, elements);
+    }
+
+    // shifted：可变元素及紧随其后的可忽略元素在前三级清零，可变元素的 primary 移到第四级
+    auto levels = (int) strength;
+    std::vector<uint16_t> quaternary;
+    if (shifted) {
+        if (levels >= 4) quaternary.reserve(elements.size());
+        bool afterVariable = false;
+        for (auto &element: elements) {
+            auto primary = element >> 16;
+            uint16_t weight;
+            if (primary > 0 && primary <= MAX_VARIABLE_PRIMARY) {
+                weight = (uint16_t) primary;
+                element = 0;
+                afterVariable = true;
+            } else if (0 == primary) {
+                if (afterVariable) element = 0;
+                weight = 0 == element ? 0 : 0xffff;
+            } else {
+                // 隐式权重的第二个元素只延续 primary，不计入第四级
+                weight = 0 == (element & 0x3e) ? 0 : 0xffff;
+                afterVariable = false;
+            }
+            if (levels >= 4) quaternary.push_back(weight);
+        }
+    }
+
+    // 各级非零权重按大端 16 位依次写出，级别之间以 0000 分隔
+    size_t count = levels - 1;
+    for (auto element: elements) {
+        count += (0 != (element >> 16)) + (levels >= 2 && 0 != ((element >> 7) & 0x1ff)) +
+                 (levels >= 3 && 0 != ((element >> 1) & 0x1f));
+    }
+    for (auto weight: quaternary) count += 0 != weight;
+    out.resize(count * 2);
+    auto dst = (uint8_t *) out.data();
+    auto put = [&dst](uint32_t weight) {
+        *dst++ = (uint8_t) (weight >> 8);
+        *dst++ = (uint8_t) weight;
+    };
+    for (int level = 1; level <= levels; level++) {
+        if (level > 1) put(0);
+        if (4 == level) {
+            for (auto weight: quaternary) {
+                if (weight) put(weight);
+            }
+            continue;
+        }
+        for (auto element: elements) {
+            auto weight = 1 == level ? element >> 16 : 2 == level ? (element >> 7) & 0x1ff : (element >> 1) & 0x1f;
+            if (weight) put(weight);
+        }
+    }
+}
+
+SCollator::SCollator(SCollationStrength strength, bool shifted) noexcept : _strength(strength), _shifted(shifted) {}
+
+SCollationStrength SCollator::strength() const {
+    return _strength;
+}
+
+bool SCollator::shifted() const {
+    return _shifted;
+}
+
+SString SCollator::getSortKey(const SStringView &str) const {
+    SString key;
+    getSortKey(str, key);
+    return key;
+}
+
+void SCollator::getSortKey(const SStringView &str, SString &out) const {
+    std::vector<uint32_t> codes, elements;
+    buildSortKey(str, _strength, _shifted, codes, elements, out);
+}
+
+SStringColumn SCollator::getSortKeys(const SStringColumn &column) const {
+    SStringColumn res;
+    auto count = column.size();
+    res.reserve(count, column.bytes() * 4);
+    std::vector<uint32_t> codes, elements;
+    SString key;
+    for (size_t i = 0; i < count; i++) {
+        buildSortKey(column[i], _strength, _shifted, codes, elements, key);
+        if (!res.append(key)) return {};
+    }
+    return res;
+}
+
+int SCollator::compare(const SStringView &a, const SStringView &b) const {
+    std::vector<uint32_t> codes, elements;
+    SString keyA, keyB;
+    buildSortKey(a, _strength, _shifted, codes, elements, keyA);
+    buildSortKey(b, _strength, _shifted, codes, elements, keyB);
+    auto size = std::min(keyA.size(), keyB.size());
+    auto res = size ? memcmp(keyA.data(), keyB.data(), size) : 0;
+    if (res) return res;
+    return keyA.size() < keyB.size() ? -1 : keyA.size() > keyB.size() ? 1 : 0;
+}
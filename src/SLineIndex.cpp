@@ -0,0 +1,160 @@
+#include <SString/SLineIndex.h>
+#include <SString/algorithm.h>
+#include <algorithm>
+
+using sstr::SLineIndex;
+using sstr::SStringBuilder;
+using sstr::SStringView;
+
+/// 在字节串中查找换行符，把其后的位置加上 base 后写入 starts
+static void scanBytes(const char *str, size_t size, size_t base, std::vector<size_t> &starts) {
+    size_t i = 0;
+#ifdef SSTR_SSE2
+    const __m128i newline = _mm_set1_epi8('\n');
+    for (; i + 16 <= size; i += 16) {
+        auto x = _mm_loadu_si128((const __m128i *) (str + i));
+        auto mask = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(x, newline));
+        while (mask) {
+            starts.push_back(base + i + sstr::CountTrailingZeros(mask) + 1);
+            mask &= mask - 1;
+        }
+    }
+#endif
+    for (; i < size; i++) {
+        if ('\n' == str[i]) starts.push_back(base + i + 1);
+    }
+}
+
+SLineIndex::SLineIndex(const SStringView &str) {
+    _size = str.null() ? 0 : str.size();
+    scanBytes(str.data(), _size, 0, _starts);
+}
+
+SLineIndex::SLineIndex(const SStringBuilder &builder) : _chars(true) {
+    auto data = builder.data();
+    _size = builder.null() ? 0 : builder.size();
+    size_t i = 0;
+#ifdef SSTR_SSE2
+    // 每个字符占 4 字节，匹配时掩码中相应的 4 位都为 1
+    const __m128i newline = _mm_set1_epi32('\n');
+    for (; i + 4 <= _size; i += 4) {
+        auto x = _mm_loadu_si128((const __m128i *) (data + i));
+        auto mask = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi32(x, newline));
+        while (mask) {
+            auto bit = CountTrailingZeros(mask);
+            _starts.push_back(i + bit / 4 + 1);
+            mask &= ~(0xfu << bit);
+        }
+    }
+#endif
+    for (; i < _size; i++) {
+        if ('\n' == data[i]) _starts.push_back(i + 1);
+    }
+}
+
+size_t SLineIndex::lineCount() const {
+    return _starts.size();
+}
+
+size_t SLineIndex::size() const {
+    return _size;
+}
+
+size_t SLineIndex::getLine(size_t offset) const {
+    if (offset > _size) return -1;
+    return std::upper_bound(_starts.begin(), _starts.end(), offset) - _starts.begin() - 1;
+}
+
+size_t SLineIndex::getLineStart(size_t line) const {
+    if (line >= _starts.size()) return -1;
+    return _starts[line];
+}
+
+size_t SLineIndex::getLineEnd(size_t line) const {
+    if (line >= _starts.size()) return -1;
+    return line + 1 < _starts.size() ? _starts[line + 1] - 1 : _size;
+}
+
+bool SLineIndex::getPosition(size_t offset, size_t &line, size_t &column) const {
+    line = getLine(offset);
+    if ((size_t) -1 == line) return false;
+    column = offset - _starts[line];
+    return true;
+}
+
+bool SLineIndex::getPosition(const SStringView &str, size_t offset, size_t &line, size_t &column) const {
+    if (_chars) return getPosition(offset, line, column);
+    if (offset > _size || offset > (str.null() ? 0 : str.size())) return false;
+    line = getLine(offset);
+    column = offset > _starts[line] ? CountUTF8Chars(str.data() + _starts[line], offset - _starts[line]) : 0;
+    return true;
+}
+
+size_t SLineIndex::getOffset(size_t line, size_t column) const {
+    auto start = getLineStart(line);
+    if ((size_t) -1 == start || column > getLineEnd(line) - start) return -1;
+    return start + column;
+}
+
+size_t SLineIndex::getOffset(const SStringView &str, size_t line, size_t column) const {
+    if (_chars) return getOffset(line, column);
+    auto start = getLineStart(line);
+    if ((size_t) -1 == start) return -1;
+    auto end = getLineEnd(line);
+    if (end > (str.null() ? 0 : str.size())) return -1;
+    // 第 column 个非续字节即为该字符的起始位置
+    auto p = str.data();
+    for (auto i = start; i < end; i++) {
+        if ((p[i] & 0b11000000) == 0b10000000) continue;
+        if (0 == column--) return i;
+    }
+    return 0 == column ? end : -1;
+}
+
+size_t SLineIndex::scan(const SStringView &text, size_t base, std::vector<size_t> &starts) const {
+    auto data = text.data();
+    auto size = text.null() ? 0 : text.size();
+    if (!_chars) {
+        scanBytes(data, size, base, starts);
+        return size;
+    }
+    // 与 SStringView::toChars 相同，遇到 '\0' 或非法序列时停止
+    size_t count = 0;
+    for (size_t i = 0; i < size; count++) {
+        if (0 == data[i]) break;
+        auto n = getSizeFromUTF8Char(data[i]);
+        if (-1 == n || i + n > size) break;
+        if ('\n' == data[i]) starts.push_back(base + count + 1);
+        i += n;
+    }
+    return count;
+}
+
+bool SLineIndex::replace(size_t begin, size_t len, const SStringView &text) {
+    // SStringBuilder::replace 在 begin 不小于长度时不做修改，len 由调用方保证不越界
+    if (_chars ? begin >= _size : begin > _size) return false;
+    if (len > _size - begin) len = _size - begin;
+    std::vector<size_t> inserted;
+    auto size = scan(text, begin, inserted);
+    // 行首落在 (begin, begin + len] 的行，其前的换行符已被删除
+    auto first = std::upper_bound(_starts.begin(), _starts.end(), begin);
+    auto last = std::upper_bound(first, _starts.end(), begin + len);
+    for (auto it = last; it != _starts.end(); ++it) {
+        *it = *it - len + size;
+    }
+    // 原位覆盖重叠部分，只对多出或缺少的行插入、删除
+    auto common = std::min<size_t>(last - first, inserted.size());
+    std::copy(inserted.begin(), inserted.begin() + common, first);
+    first += common;
+    if (inserted.size() > common) {
+        _starts.insert(first, inserted.begin() + common, inserted.end());
+    } else {
+        _starts.erase(first, last);
+    }
+    _size = _size - len + size;
+    return true;
+}
+
+void SLineIndex::append(const SStringView &text) {
+    _size += scan(text, _size, _starts);
+}
@@ -0,0 +1,94 @@
+#include <SString/SMappedFile.h>
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using sstr::SMappedFile;
+
+SMappedFile::SMappedFile(SMappedFile &&file) noexcept {
+    _data = file._data;
+    _size = file._size;
+
+    file._data = nullptr;
+    file._size = 0;
+}
+
+SMappedFile::~SMappedFile() {
+    close();
+}
+
+SMappedFile &SMappedFile::operator=(SMappedFile &&file) noexcept {
+    if (this == &file) return *this;
+    close();
+    _data = file._data;
+    _size = file._size;
+
+    file._data = nullptr;
+    file._size = 0;
+    return *this;
+}
+
+bool SMappedFile::open(const char *path) {
+    close();
+#ifdef _WIN32
+    auto file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (INVALID_HANDLE_VALUE == file) return false;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || 0 == size.QuadPart) {
+        CloseHandle(file);
+        return false;
+    }
+    auto mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (NULL == mapping) return false;
+    auto data = (const char *) MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (nullptr == data) return false;
+
+    _data = data;
+    _size = (size_t) size.QuadPart;
+#else
+    auto fd = ::open(path, O_RDONLY);
+    if (-1 == fd) return false;
+    struct stat st;
+    if (0 != fstat(fd, &st) || 0 == st.st_size) {
+        ::close(fd);
+        return false;
+    }
+    auto addr = mmap(nullptr, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (MAP_FAILED == addr) return false;
+
+    _data = (const char *) addr;
+    _size = (size_t) st.st_size;
+#endif
+    return true;
+}
+
+void SMappedFile::close() {
+    if (nullptr == _data) return;
+#ifdef _WIN32
+    UnmapViewOfFile(_data);
+#else
+    munmap((void *) _data, _size);
+#endif
+    _data = nullptr;
+    _size = 0;
+}
+
+bool SMappedFile::null() const {
+    return nullptr == _data;
+}
+
+const char *SMappedFile::data() const {
+    return _data;
+}
+
+size_t SMappedFile::size() const {
+    return _size;
+}
@@ -61,7 +61,7 @@ char sstr::getUTF8SizeFromUnicodeChar(SChar ch) {
         return 2;
     } else if ((uint32_t) ch > 0x7ff && (uint32_t) ch <= 0xffff) {
         return 3;
-    } else if ((uint32_t) ch > 0xffff && (uint32_t) ch <= 0x7ffff) {
+    } else if ((uint32_t) ch > 0xffff && (uint32_t) ch <= 0x10ffff) {
         return 4;
     } else {
         return -1;
@@ -117,31 +117,196 @@ static bool insertUnicodeChar2UTF8String(char *destination, uint32_t code, size_
     return true;
 }
 
+bool sstr::isValidUTF8String(const char *str, size_t size) {
+    auto p = (const unsigned char *) str;
+    size_t i = 0;
+    while (i < size) {
+#ifdef SSTR_SSE2
+        // ASCII 连续段按 16 字节跳过
+        while (i + 16 <= size && 0 == _mm_movemask_epi8(_mm_loadu_si128((const __m128i *) (p + i)))) {
+            i += 16;
+        }
+        if (i == size) break;
+#endif
+        auto ch = p[i];
+        if (ch < 0x80) {
+            i++;
+            continue;
+        }
+        auto n = getSizeFromUTF8Char((char) ch);
+        if (n < 2 || i + n > size) return false;
+        for (auto j = 1; j < n; j++) {
+            if ((p[i + j] & 0b11000000) != 0b10000000) return false;
+        }
+        auto code = (uint32_t) getUnicodeCharFromUTF8Char(n, str + i);
+        // 过长编码、代理项与超范围字符
+        if (getUTF8SizeFromUnicodeChar(SChar(code)) != n) return false;
+        if (code >= 0xd800 && code <= 0xdfff) return false;
+        i += n;
+    }
+    return true;
+}
+
+uint64_t sstr::getHashFromBytes(const char *data, size_t size, uint64_t seed) {
+    const uint64_t m = 0xc6a4a7935bd1e995ull;
+    const int r = 47;
+    uint64_t h = seed ^ (size * m);
+
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t k;
+        memcpy(&k, data + i, 8);
+        k *= m;
+        k ^= k >> r;
+        k *= m;
+        h ^= k;
+        h *= m;
+    }
+
+    // 剩余不足 8 字节，与 MurmurHash64A 的逐级贯穿写法等价
+    auto tail = (const unsigned char *) data + i;
+    auto rest = size & 7;
+    if (rest) {
+        for (auto j = rest; j > 0; j--) {
+            h ^= (uint64_t) tail[j - 1] << ((j - 1) * 8);
+        }
+        h *= m;
+    }
+
+    h ^= h >> r;
+    h *= m;
+    h ^= h >> r;
+    return h;
+}
+
+char sstr::putUTF8FromUnicodeChar(SChar ch, char *destination) {
+    auto n = getUTF8SizeFromUnicodeChar(ch);
+    if (-1 == n) return -1;
+    insertUnicodeChar2UTF8String(destination, (uint32_t) ch, n);
+    return n;
+}
+
 SChar sstr::getUnicodeFromUTF8Char(const char *u8char) {
     return getUnicodeCharFromUTF8Char(getSizeFromUTF8Char(*u8char), u8char);
 }
 
 /// \brief 获取指定字符的起始指针
 /// \param str 字符串
+/// \param size 字符串字节数
 /// \param begin 起始位置(单位 UTF-8 字符)
 /// \return 指定字符的起始指针，超出范围返回 nullptr
-static const char *at(const char *str, size_t begin) {
+static const char *at(const char *str, size_t size, size_t begin) {
     auto p = str;
-    auto i = -1;
+    auto end = str + size;
+    size_t i = 0;
     while (true) {
-        if ('\0' == *p) {
-            p = nullptr;
+        if (p >= end || '\0' == *p) return nullptr;
+        if (i == begin) return p;
+        auto n = sstr::getSizeFromUTF8Char(*p);
+        if (-1 == n) return nullptr;
+        p += n;
+        i++;
+    }
+}
+
+static inline bool isASCIISpace(char ch) {
+    return ' ' == ch || (ch >= 0x09 && ch <= 0x0d);
+}
+
+#ifdef SSTR_SSE2
+/// 16 字节中 ASCII 空白字符的掩码
+static inline uint32_t getASCIISpaceMask(__m128i x) {
+    auto space = _mm_cmpeq_epi8(x, _mm_set1_epi8(' '));
+    auto control = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8(0x08)), _mm_cmplt_epi8(x, _mm_set1_epi8(0x0e)));
+    return (uint32_t) _mm_movemask_epi8(_mm_or_si128(space, control));
+}
+#endif
+
+/// 获取从 end 向前的最后一个字符
+/// \param begin 字符串起始
+/// \param end 字符串结尾
+/// \param n 该字符的字节数
+/// \return Unicode 字符，编码损坏时返回 NullChar 且 n 为 1
+static SChar getLastChar(const char *begin, const char *end, int &n) {
+    auto p = end - 1;
+    // 最多回退 3 个续字节
+    while (p > begin && end - p < 4 && (*p & 0b11000000) == 0b10000000) p--;
+    auto size = sstr::getSizeFromUTF8Char(*p);
+    if (size != end - p) {
+        n = 1;
+        return NullChar;
+    }
+    n = size;
+    return sstr::getUnicodeCharFromUTF8Char(size, p);
+}
+
+/// 字符是否在字符集中
+/// \note UTF-8 可自同步，完整编码的字节串匹配必然落在字符边界上
+static inline bool inCharSet(const char *ch, size_t n, const SStringView &chars) {
+    return -1 != sstr::FindBytes(chars.data(), chars.size(), ch, n);
+}
+
+/// 计算头部可去除的字节数
+/// \param chars 字符集，为 nullptr 时使用 Unicode White_Space
+static size_t getTrimStart(const char *data, size_t size, const SStringView *chars) {
+    size_t i = 0;
+    if (nullptr == chars) {
+#ifdef SSTR_SSE2
+        for (; i + 16 <= size; i += 16) {
+            auto mask = ~getASCIISpaceMask(_mm_loadu_si128((const __m128i *) (data + i))) & 0xffff;
+            if (mask) {
+                i += sstr::CountTrailingZeros(mask);
+                break;
+            }
+        }
+#endif
+        while (i < size && isASCIISpace(data[i])) i++;
+    }
+    while (i < size) {
+        auto n = sstr::getSizeFromUTF8Char(data[i]);
+        if (-1 == n || i + n > size) break;
+        if (nullptr == chars) {
+            if (1 == n ? !isASCIISpace(data[i]) : !sstr::getUnicodeCharFromUTF8Char(n, data + i).isSpace()) break;
+        } else if (!inCharSet(data + i, n, *chars)) {
             break;
         }
-        i++;
-        if (i == begin) {
+        i += n;
+    }
+    return i;
+}
+
+/// 计算去除尾部后剩余的字节数
+/// \param chars 字符集，为 nullptr 时使用 Unicode White_Space
+static size_t getTrimEnd(const char *data, size_t size, const SStringView *chars) {
+    auto end = size;
+    if (nullptr == chars) {
+#ifdef SSTR_SSE2
+        while (end >= 16) {
+            auto mask = ~getASCIISpaceMask(_mm_loadu_si128((const __m128i *) (data + end - 16))) & 0xffff;
+            if (mask) {
+                // 最高位的非空白字节之后均为空白
+                int last = 15;
+                while (!(mask >> last & 1)) last--;
+                end -= 15 - last;
+                break;
+            }
+            end -= 16;
+        }
+#endif
+        while (end > 0 && isASCIISpace(data[end - 1])) end--;
+    }
+    while (end > 0) {
+        int n;
+        auto ch = getLastChar(data, data + end, n);
+        if (NullChar == ch) break;
+        if (nullptr == chars) {
+            if (!ch.isSpace()) break;
+        } else if (!inCharSet(data + end - n, n, *chars)) {
             break;
-        } else {
-            auto n = sstr::getSizeFromUTF8Char(*p);
-            p += n;
         }
+        end -= n;
     }
-    return p;
+    return end;
 }
 
 static void toLower(char *str) {
@@ -248,6 +413,23 @@ void sstr::SString::update() {
     _size = strlen(_data);
 }
 
+void SString::resize(size_t size) {
+    reserve(size);
+    _size = size;
+    _data[_size] = '\0';
+}
+
+void SString::reserve(size_t size) {
+    if (size + 1 <= _capacity) return;
+    auto newCap = (size / BLOCK_SIZE + 1) * BLOCK_SIZE;
+    auto newData = (char *) malloc(newCap);
+    if (_data) memcpy(newData, _data, _size);
+    newData[_size] = '\0';
+    free(_data);
+    _data = newData;
+    _capacity = newCap;
+}
+
 sstr::SString::~SString() noexcept {
     if (_data) {
         free(_data);
@@ -273,6 +455,8 @@ SString::SString(const char *str, size_t size) : SStringView() {
     _data[size] = '\0';
 }
 
+SString::SString(const sstr::SStringView &str) : SString(str.data(), str.size()) {}
+
 SString::SString(const sstr::SString &sString) noexcept : SStringView(sString) {
     _capacity = sString._capacity;
     _size = sString._size;
@@ -290,6 +474,68 @@ SString::SString(sstr::SString &&sString) noexcept : SStringView() {
     sString._size = 0;
 }
 
+SString &SString::operator=(const sstr::SString &sString) {
+    if (this == &sString) return *this;
+    free(_data);
+    _capacity = sString._capacity;
+    _size = sString._size;
+    _data = nullptr;
+    if (sString._data) {
+        _data = (char *) malloc(_capacity);
+        memcpy(_data, sString._data, _size + 1);
+    }
+    return *this;
+}
+
+SString &SString::operator=(sstr::SString &&sString) noexcept {
+    if (this == &sString) return *this;
+    free(_data);
+    _data = sString._data;
+    _capacity = sString._capacity;
+    _size = sString._size;
+
+    sString._data = nullptr;
+    sString._capacity = 0;
+    sString._size = 0;
+    return *this;
+}
+
+void SString::trimStartInPlace() {
+    auto n = getTrimStart(_data, _size, nullptr);
+    if (0 == n) return;
+    _size -= n;
+    memmove(_data, _data + n, _size + 1);
+}
+
+void SString::trimStartInPlace(const SStringView &chars) {
+    auto n = getTrimStart(_data, _size, &chars);
+    if (0 == n) return;
+    _size -= n;
+    memmove(_data, _data + n, _size + 1);
+}
+
+void SString::trimEndInPlace() {
+    if (nullptr == _data) return;
+    _size = getTrimEnd(_data, _size, nullptr);
+    _data[_size] = '\0';
+}
+
+void SString::trimEndInPlace(const SStringView &chars) {
+    if (nullptr == _data) return;
+    _size = getTrimEnd(_data, _size, &chars);
+    _data[_size] = '\0';
+}
+
+void SString::trimInPlace() {
+    trimEndInPlace();
+    trimStartInPlace();
+}
+
+void SString::trimInPlace(const SStringView &chars) {
+    trimEndInPlace(chars);
+    trimStartInPlace(chars);
+}
+
 void SString::toLower() {
     ::toLower(_data);
 }
@@ -418,9 +664,10 @@ void SString::operator+=(const sstr::SStringView &str) {
 
 bool SStringView::endsWith(const sstr::SStringView &str) const {
     if (str._size > this->_size) return false;
+    if (0 == str._size) return true;
 
     auto tmp = this->_data + this->_size - str._size;
-    return strcmp(tmp, str._data) == 0;
+    return memcmp(tmp, str._data, str._size) == 0;
 }
 
 bool SStringView::isLower() const {
@@ -454,19 +701,21 @@ SStringView::SStringView(const char *u8str) noexcept {
     _size = sstr::getByteLengthFromUTF8String(_data);
 }
 
+SStringView::SStringView(const char *data, size_t size) noexcept {
+    _data = const_cast<char *>(data);
+    _size = size;
+}
+
 bool SStringView::null() const {
     return _data == nullptr;
 }
 
 bool SStringView::empty() const {
-    if (_data) {
-        return _data[0] == '\0';
-    }
-    return true;
+    return nullptr == _data || 0 == _size;
 }
 
 size_t SStringView::size() const {
-    return getByteLengthFromUTF8String(_data);
+    return _size;
 }
 
 size_t SStringView::len() const {
@@ -487,25 +736,17 @@ const char *SStringView::data() const {
 }
 
 int32_t SStringView::findByBytes(const char *bytes) const {
-    return BM(_data, bytes);
+    return (int32_t) FindBytes(_data, _size, bytes, strlen(bytes));
 }
 
 int32_t SStringView::find(const sstr::SStringView &str) const {
-    return find(str.data());
+    auto index = FindBytes(_data, _size, str._data, str._size);
+    if (-1 == index) return -1;
+    return (int32_t) CountUTF8Chars(_data, (size_t) index);
 }
 
 int32_t SStringView::find(const char *str) const {
-    auto index = BM(_data, str);
-    auto count = 0;
-
-    if (-1 == index) return -1;
-
-    for (auto i = 0; i < index;) {
-        auto n = getSizeFromUTF8Char(_data[i]);
-        i += n;
-        count++;
-    }
-    return count;
+    return find(SStringView(str));
 }
 
 #if (__cplusplus < 201703L && _HAS_CXX17 == 0)
@@ -524,27 +765,32 @@ SString::IteratorType SStringView::end() {
 
 #endif
 
-SString SStringView::trim() const {
-    auto newSize = _size;
-    for (auto i = 0; i < _size; i++) {
-        if (_data[i] == ' ') {
-            newSize--;
-        }
-    }
+SStringView SStringView::trimStart() const {
+    auto n = getTrimStart(_data, _size, nullptr);
+    return {_data + n, _size - n};
+}
 
-    auto newCap = (newSize / BLOCK_SIZE + 1) * BLOCK_SIZE;
+SStringView SStringView::trimStart(const SStringView &chars) const {
+    auto n = getTrimStart(_data, _size, &chars);
+    return {_data + n, _size - n};
+}
 
-    char *newData = (char *) malloc(newCap);
-    char *p = _data;
-    while (*p == ' ') p++;
-    memcpy(newData, p, newSize);
-    newData[newSize] = '\0';
+SStringView SStringView::trimEnd() const {
+    return {_data, getTrimEnd(_data, _size, nullptr)};
+}
 
-    SString string;
-    string._size = newSize;
-    string._capacity = newCap;
-    string._data = newData;
-    return string;
+SStringView SStringView::trimEnd(const SStringView &chars) const {
+    return {_data, getTrimEnd(_data, _size, &chars)};
+}
+
+SStringView SStringView::trim() const {
+    auto begin = getTrimStart(_data, _size, nullptr);
+    return {_data + begin, getTrimEnd(_data + begin, _size - begin, nullptr)};
+}
+
+SStringView SStringView::trim(const SStringView &chars) const {
+    auto begin = getTrimStart(_data, _size, &chars);
+    return {_data + begin, getTrimEnd(_data + begin, _size - begin, &chars)};
 }
 
 SString SStringView::reverse() const {
@@ -592,34 +838,32 @@ SString SStringView::append(const sstr::SStringView &str) const {
 }
 
 std::vector<SString> SStringView::split(const char *str) const {
+    return split(SStringView(str));
+}
+
+std::vector<SString> SStringView::split(const SStringView &str) const {
     std::vector<SString> v;
-    auto size = getByteLengthFromUTF8String(str);
+    if (0 == str._size) {
+        v.emplace_back(_data, _size);
+        return v;
+    }
 
-    std::string::size_type pos1, pos2;
-    pos2 = BM(_data, str);
-    pos1 = 0;
+    size_t pos = 0;
     while (true) {
-        v.emplace_back(SString(_data + pos1, pos2 - pos1));
-
-        pos1 = pos2 + size;
-        pos2 = BM(_data + pos1, str);
-        if (-1 == pos2) {
-            v.emplace_back(SString::fromUTF8(_data + pos1));
+        auto index = FindBytes(_data + pos, _size - pos, str._data, str._size);
+        if (-1 == index) {
+            v.emplace_back(_data + pos, _size - pos);
             break;
-        } else {
-            pos2 += pos1;
         }
+        v.emplace_back(_data + pos, (size_t) index);
+        pos += (size_t) index + str._size;
     }
     return v;
 }
 
-std::vector<SString> SStringView::split(const SStringView &str) const {
-    return split(str._data);
-}
-
 SString SStringView::substring(size_t begin) const {
     SString str;
-    auto p = ::at(_data, begin);
+    auto p = ::at(_data, _size, begin);
     if (nullptr == p) return str;
 
     str._size = _size + _data - p;
@@ -632,20 +876,22 @@ SString SStringView::substring(size_t begin) const {
 
 SString SStringView::substring(size_t begin, size_t len) const {
     SString str;
-    auto start = ::at(_data, begin);
+    auto start = ::at(_data, _size, begin);
     if (nullptr == start) return str;
 
     // pre calculated
-    auto count = 0;
-    auto newSize = 0;
+    size_t count = 0;
+    size_t newSize = 0;
     auto p = start;
+    auto end = _data + _size;
     while (true) {
-        if ('\0' == *p) {
+        if (p >= end || '\0' == *p) {
             break;
         } else if (count == len) {
             break;
         } else {
             auto n = sstr::getSizeFromUTF8Char(*p);
+            if (-1 == n || p + n > end) break;
             newSize += n;
             p += n;
             count++;
@@ -661,9 +907,8 @@ SString SStringView::substring(size_t begin, size_t len) const {
 }
 
 std::vector<SChar> SStringView::toChars() const {
-    auto len = getByteLengthFromUTF8String(_data);
     std::vector<SChar> chars;
-    chars.reserve(len);
+    chars.reserve(_size);
     for (size_t i = 0; i < _size;) {
         if (0 == _data[i]) break;
         auto n = getSizeFromUTF8Char(_data[i]);
@@ -676,14 +921,16 @@ std::vector<SChar> SStringView::toChars() const {
 }
 
 std::string SStringView::toString() const {
-    return {_data};
+    if (nullptr == _data) return {};
+    return {_data, _size};
 }
 
 std::unique_ptr<wchar_t[]> SStringView::toCWString() const {
 #ifdef _WIN32
-    size_t size = MultiByteToWideChar(CP_UTF8, 0, _data, -1, NULL, 0);
-    auto ptr = std::unique_ptr<wchar_t[]>(new wchar_t[size]);
-    MultiByteToWideChar(CP_UTF8, 0, _data, -1, ptr.get(), size);
+    size_t size = MultiByteToWideChar(CP_UTF8, 0, _data, _size, NULL, 0);
+    auto ptr = std::unique_ptr<wchar_t[]>(new wchar_t[size + 1]);
+    MultiByteToWideChar(CP_UTF8, 0, _data, _size, ptr.get(), size);
+    ptr[size] = L'\0';
     return ptr;
 #else
     size_t size = len();
@@ -705,6 +952,21 @@ std::wstring SStringView::toWString() const {
     return {toCWString().get()};
 }
 
+int SStringView::compareNatural(const SStringView &str) const {
+    return CompareNatural(_data, _size, str._data, str._size);
+}
+
+SString SStringView::naturalSortKey() const {
+    SString res;
+    res.resize(_size * 3 + 1);
+    res.resize(NaturalSortKey(_data, _size, res.data()));
+    return res;
+}
+
+uint64_t SStringView::hash() const {
+    return getHashFromBytes(_data, _size);
+}
+
 SChar SStringView::at(size_t index) const {
     index += 1;
     size_t n = 0;
@@ -727,19 +989,19 @@ SChar SStringView::operator[](size_t index) const {
 }
 
 bool SStringView::operator!=(const char *str) const {
-    return 0 != strcmp(_data, str);
+    return !(*this == str);
 }
 
 bool SStringView::operator!=(const sstr::SStringView &str) const {
-    return 0 != strcmp(_data, str._data);
+    return !(*this == str);
 }
 
 bool SStringView::operator==(const sstr::SStringView &str) const {
-    return 0 == strcmp(_data, str._data);
+    return _size == str._size && (0 == _size || 0 == memcmp(_data, str._data, _size));
 }
 
 bool SStringView::operator==(const char *str) const {
-    return 0 == strcmp(_data, str);
+    return *this == SStringView(str);
 }
 
 SString SStringView::operator+(const SStringView &str) const {
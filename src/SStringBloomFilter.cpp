@@ -0,0 +1,140 @@
+#include <SString/SStringBloomFilter.h>
+#include <SString/algorithm.h>
+#include <algorithm>
+#include <cmath>
+
+using sstr::SBitmap;
+using sstr::SStringBloomFilter;
+using sstr::SStringColumn;
+using sstr::SStringView;
+
+/// 每块的 64 位字个数，即 512 位
+static const size_t BlockWords = 8;
+/// 批量查询时每组预取的键数
+static const size_t BatchSize = 16;
+
+/// 按缓存行对齐的起始位置，缓冲区多分配了 BlockWords - 1 个字
+template<typename T>
+static inline T *alignBlocks(T *words) {
+    auto misaligned = (uintptr_t) words % 64;
+    return misaligned ? words + (64 - misaligned) / sizeof(uint64_t) : words;
+}
+
+/// 块内第二个哈希，取奇数使各位互不重复地遍历
+static inline uint32_t getStep(uint64_t hash) {
+    return (uint32_t) ((hash * 0x9e3779b97f4a7c15ull) >> 32) | 1;
+}
+
+SStringBloomFilter::SStringBloomFilter(size_t expected, double falsePositiveRate) {
+    if (0 == expected) expected = 1;
+    if (!(falsePositiveRate > 0 && falsePositiveRate < 1)) falsePositiveRate = 0.01;
+    const double ln2 = 0.6931471805599453;
+    auto bits = -(double) expected * std::log(falsePositiveRate) / (ln2 * ln2);
+    auto hashes = (int) std::lround(bits / (double) expected * ln2);
+    _hashes = hashes < 1 ? 1 : hashes > 16 ? 16 : hashes;
+    // 分块后各块负载不均，多分配 1/8 以抵消假阳性率的上升
+    bits += bits / 8;
+    _blocks = (size_t) std::ceil(bits / (BlockWords * 64));
+    if (0 == _blocks) _blocks = 1;
+    _words.assign(_blocks * BlockWords + BlockWords - 1, 0);
+}
+
+SStringBloomFilter::SStringBloomFilter(const SStringBloomFilter &filter)
+    : _words(filter._words.size(), 0), _blocks(filter._blocks), _hashes(filter._hashes) {
+    std::copy_n(alignBlocks(filter._words.data()), _blocks * BlockWords, alignBlocks(_words.data()));
+}
+
+SStringBloomFilter &SStringBloomFilter::operator=(const SStringBloomFilter &filter) {
+    if (this == &filter) return *this;
+    _words.assign(filter._words.size(), 0);
+    _blocks = filter._blocks;
+    _hashes = filter._hashes;
+    std::copy_n(alignBlocks(filter._words.data()), _blocks * BlockWords, alignBlocks(_words.data()));
+    return *this;
+}
+
+size_t SStringBloomFilter::bits() const {
+    return _blocks * BlockWords * 64;
+}
+
+int SStringBloomFilter::hashes() const {
+    return _hashes;
+}
+
+size_t SStringBloomFilter::getBlock(uint64_t hash) const {
+    return (size_t) (((hash >> 32) * _blocks) >> 32);
+}
+
+void SStringBloomFilter::insert(const SStringView &key) {
+    auto hash = getHashFromBytes(key.data(), key.null() ? 0 : key.size());
+    auto block = alignBlocks(_words.data()) + getBlock(hash) * BlockWords;
+    auto a = (uint32_t) hash, b = getStep(hash);
+    for (int i = 0; i < _hashes; i++, a += b) {
+        auto bit = a >> 23;
+        block[bit / 64] |= 1ull << (bit % 64);
+    }
+}
+
+void SStringBloomFilter::insert(const SStringColumn &keys) {
+    for (size_t i = 0; i < keys.size(); i++) {
+        insert(keys[i]);
+    }
+}
+
+bool SStringBloomFilter::test(uint64_t hash) const {
+    auto block = alignBlocks(_words.data()) + getBlock(hash) * BlockWords;
+    auto a = (uint32_t) hash, b = getStep(hash);
+    for (int i = 0; i < _hashes; i++, a += b) {
+        auto bit = a >> 23;
+        if (!(block[bit / 64] >> (bit % 64) & 1)) return false;
+    }
+    return true;
+}
+
+bool SStringBloomFilter::mayContain(const SStringView &key) const {
+    return test(getHashFromBytes(key.data(), key.null() ? 0 : key.size()));
+}
+
+void SStringBloomFilter::testBatch(const uint64_t *hashes, size_t count, uint64_t *bits, size_t offset) const {
+    auto words = alignBlocks(_words.data());
+    for (size_t i = 0; i < count; i++) {
+        Prefetch(words + getBlock(hashes[i]) * BlockWords);
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (test(hashes[i])) bits[(offset + i) / 64] |= 1ull << ((offset + i) % 64);
+    }
+}
+
+/// 分组计算哈希，每组的块一起预取后再检查
+template<typename Keys, typename Callback>
+static void forEachBatch(const Keys &keys, size_t count, Callback &&callback) {
+    uint64_t hashes[BatchSize];
+    for (size_t base = 0; base < count; base += BatchSize) {
+        auto n = count - base < BatchSize ? count - base : BatchSize;
+        for (size_t i = 0; i < n; i++) {
+            SStringView key = keys[base + i];
+            hashes[i] = sstr::getHashFromBytes(key.data(), key.null() ? 0 : key.size());
+        }
+        callback(hashes, n, base);
+    }
+}
+
+SBitmap SStringBloomFilter::mayContain(const SStringColumn &keys) const {
+    SBitmap res(keys.size());
+    forEachBatch(keys, keys.size(), [&](const uint64_t *hashes, size_t n, size_t base) {
+        testBatch(hashes, n, res.words(), base);
+    });
+    return res;
+}
+
+SBitmap SStringBloomFilter::mayContain(const std::vector<SStringView> &keys) const {
+    SBitmap res(keys.size());
+    forEachBatch(keys, keys.size(), [&](const uint64_t *hashes, size_t n, size_t base) {
+        testBatch(hashes, n, res.words(), base);
+    });
+    return res;
+}
+
+void SStringBloomFilter::clear() {
+    std::fill(_words.begin(), _words.end(), 0);
+}
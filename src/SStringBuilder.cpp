@@ -96,6 +96,14 @@ void SStringBuilder::append(const SStringView &str) {
     _size = newSize;
 }
 
+void SStringBuilder::append(SChar ch) {
+    // 空间不足以完整追加数据
+    if (_cap < _size + 1) {
+        reserve(((_size + 1) / BLOCK_SIZE + 1) * BLOCK_SIZE);
+    }
+    _data[_size++] = (uint32_t) ch;
+}
+
 bool SStringBuilder::reserve(size_t size) {
     if (size > _cap) {
         auto newData = (uint32_t *) malloc(size * sizeof(uint32_t));
@@ -0,0 +1,251 @@
+#include <SString/SStringColumn.h>
+#include <SString/algorithm.h>
+#include <algorithm>
+#include <cstring>
+#ifdef _WIN32
+#pragma warning(disable : 4267)
+#endif
+
+using sstr::SBitmap;
+using sstr::SString;
+using sstr::SStringColumn;
+using sstr::SStringView;
+
+/// 偏移数组能表示的最大缓冲区字节数
+static const size_t MaxBytes = UINT32_MAX;
+
+/// 对整个缓冲区做 ASCII 大小写转换
+/// \param data 缓冲区
+/// \param size 字节数
+/// \param lower 是否转换为小写
+static void convertCase(char *data, size_t size, bool lower) {
+    const char first = lower ? 'A' : 'a';
+    const char last = lower ? 'Z' : 'z';
+    size_t i = 0;
+#ifdef SSTR_SSE2
+    const __m128i lo = _mm_set1_epi8((char) (first - 1));
+    const __m128i hi = _mm_set1_epi8((char) (last + 1));
+    const __m128i flip = _mm_set1_epi8(0x20);
+    for (; i + 16 <= size; i += 16) {
+        auto x = _mm_loadu_si128((const __m128i *) (data + i));
+        auto mask = _mm_and_si128(_mm_cmpgt_epi8(x, lo), _mm_cmplt_epi8(x, hi));
+        _mm_storeu_si128((__m128i *) (data + i), _mm_xor_si128(x, _mm_and_si128(mask, flip)));
+    }
+#endif
+    for (; i < size; i++) {
+        if (data[i] >= first && data[i] <= last) data[i] ^= 0x20;
+    }
+}
+
+SStringColumn::SStringColumn() : _offsets(1, 0) {}
+
+SStringColumn::SStringColumn(const std::vector<SString> &strings) : _offsets(1, 0) {
+    size_t bytes = 0;
+    for (auto &str: strings) {
+        bytes += str.size() + 1;
+    }
+    reserve(strings.size(), bytes);
+    for (auto &str: strings) {
+        if (!append(str)) break;
+    }
+}
+
+size_t SStringColumn::size() const {
+    return _offsets.size() - 1;
+}
+
+bool SStringColumn::empty() const {
+    return 1 == _offsets.size();
+}
+
+size_t SStringColumn::bytes() const {
+    return _data.size();
+}
+
+void SStringColumn::reserve(size_t count, size_t bytes) {
+    _offsets.reserve(count + 1);
+    _data.reserve(bytes);
+}
+
+bool SStringColumn::append(const SStringView &str) {
+    auto size = str.null() ? 0 : str.size();
+    if (size >= MaxBytes - _data.size()) return false;
+    _data.insert(_data.end(), str.data(), str.data() + size);
+    _data.push_back('\0');
+    _offsets.push_back((uint32_t) _data.size());
+    return true;
+}
+
+bool SStringColumn::append(const char *u8str) {
+    return append(SStringView(u8str));
+}
+
+void SStringColumn::clear() {
+    _data.clear();
+    _offsets.resize(1);
+}
+
+SStringView SStringColumn::at(size_t index) const {
+    if (index >= size()) return {};
+    auto begin = _offsets[index];
+    return {_data.data() + begin, _offsets[index + 1] - begin - 1};
+}
+
+const char *SStringColumn::data() const {
+    return _data.data();
+}
+
+const uint32_t *SStringColumn::offsets() const {
+    return _offsets.data();
+}
+
+std::vector<uint32_t> SStringColumn::len() const {
+    auto count = size();
+    std::vector<uint32_t> res(count);
+    auto data = _data.data();
+    for (size_t i = 0; i < count; i++) {
+        auto begin = _offsets[i];
+        res[i] = (uint32_t) CountUTF8Chars(data + begin, _offsets[i + 1] - begin - 1);
+    }
+    return res;
+}
+
+std::vector<uint32_t> SStringColumn::displayWidth(bool ambiguousWide) const {
+    auto count = size();
+    std::vector<uint32_t> res(count);
+    auto data = _data.data();
+    for (size_t i = 0; i < count; i++) {
+        auto begin = _offsets[i];
+        res[i] = (uint32_t) sstr::getDisplayWidthFromUTF8String(data + begin, _offsets[i + 1] - begin - 1, ambiguousWide);
+    }
+    return res;
+}
+
+SStringColumn SStringColumn::fitWidth(size_t width, bool ambiguousWide) const {
+    auto count = size();
+    SStringColumn res;
+    res.reserve(count, _data.size() + count * width);
+    for (size_t i = 0; i < count; i++) {
+        auto row = at(i);
+        auto current = sstr::getDisplayWidthFromUTF8String(row.data(), row.size(), ambiguousWide);
+        // 仅超宽的行需要再扫描一次
+        if (current > width) {
+            row = row.truncateWidth(width, ambiguousWide);
+            current = sstr::getDisplayWidthFromUTF8String(row.data(), row.size(), ambiguousWide);
+        }
+        res._data.insert(res._data.end(), row.data(), row.data() + row.size());
+        res._data.insert(res._data.end(), width - current, ' ');
+        res._data.push_back('\0');
+        if (res._data.size() > MaxBytes) return {};
+        res._offsets.push_back((uint32_t) res._data.size());
+    }
+    return res;
+}
+
+SStringColumn SStringColumn::toLower() const {
+    SStringColumn res(*this);
+    // '\0' 分隔符不受影响，整个缓冲区一次处理
+    convertCase(res._data.data(), res._data.size(), true);
+    return res;
+}
+
+SStringColumn SStringColumn::toUpper() const {
+    SStringColumn res(*this);
+    convertCase(res._data.data(), res._data.size(), false);
+    return res;
+}
+
+std::vector<int32_t> SStringColumn::find(const SStringView &str) const {
+    auto count = size();
+    std::vector<int32_t> res(count, -1);
+    auto data = _data.data();
+    auto sub = str.data();
+    auto subSize = str.null() ? 0 : str.size();
+    for (size_t i = 0; i < count; i++) {
+        auto begin = _offsets[i];
+        auto pos = FindBytes(data + begin, _offsets[i + 1] - begin - 1, sub, subSize);
+        if (-1 != pos) res[i] = (int32_t) CountUTF8Chars(data + begin, (size_t) pos);
+    }
+    return res;
+}
+
+SBitmap SStringColumn::contains(const SStringView &str) const {
+    auto count = size();
+    SBitmap res(count);
+    auto data = _data.data();
+    auto sub = str.data();
+    auto subSize = str.null() ? 0 : str.size();
+    for (size_t i = 0; i < count; i++) {
+        auto begin = _offsets[i];
+        if (-1 != FindBytes(data + begin, _offsets[i + 1] - begin - 1, sub, subSize)) res.set(i);
+    }
+    return res;
+}
+
+SBitmap SStringColumn::equals(const SStringView &str) const {
+    auto count = size();
+    SBitmap res(count);
+    auto words = res.words();
+    auto data = _data.data();
+    auto value = str.data();
+    // 连同结尾 '\0' 一起比较，长度不同的行只需比较偏移差
+    auto length = (uint32_t) (str.null() ? 0 : str.size()) + 1;
+    for (size_t i = 0; i < count; i++) {
+        auto begin = _offsets[i];
+        if (_offsets[i + 1] - begin != length) continue;
+        if (1 == length || 0 == memcmp(data + begin, value, length - 1)) {
+            words[i / 64] |= 1ull << (i % 64);
+        }
+    }
+    return res;
+}
+
+SStringColumn SStringColumn::naturalSortKeys() const {
+    auto count = size();
+    SStringColumn res;
+    res.reserve(count, _data.size());
+    auto data = _data.data();
+    for (size_t i = 0; i < count; i++) {
+        auto begin = _offsets[i];
+        auto length = _offsets[i + 1] - begin - 1;
+        // 按上限扩展后直接写入，再截到实际长度
+        auto pos = res._data.size();
+        res._data.resize(pos + length * 3 + 2);
+        auto n = NaturalSortKey(data + begin, length, res._data.data() + pos);
+        res._data.resize(pos + n + 1);
+        res._data[pos + n] = '\0';
+        if (res._data.size() > MaxBytes) return {};
+        res._offsets.push_back((uint32_t) res._data.size());
+    }
+    return res;
+}
+
+std::vector<uint32_t> SStringColumn::sortNatural() const {
+    auto keys = naturalSortKeys();
+    auto count = size();
+    std::vector<uint32_t> res(count);
+    for (size_t i = 0; i < count; i++) res[i] = (uint32_t) i;
+    auto data = keys._data.data();
+    auto offsets = keys._offsets.data();
+    std::stable_sort(res.begin(), res.end(), [data, offsets](uint32_t a, uint32_t b) {
+        auto aSize = offsets[a + 1] - offsets[a] - 1, bSize = offsets[b + 1] - offsets[b] - 1;
+        auto res = memcmp(data + offsets[a], data + offsets[b], std::min(aSize, bSize));
+        return res ? res < 0 : aSize < bSize;
+    });
+    return res;
+}
+
+std::vector<uint64_t> SStringColumn::hash(uint64_t seed) const {
+    auto count = size();
+    std::vector<uint64_t> res(count);
+    auto data = _data.data();
+    for (size_t i = 0; i < count; i++) {
+        auto begin = _offsets[i];
+        res[i] = getHashFromBytes(data + begin, _offsets[i + 1] - begin - 1, seed);
+    }
+    return res;
+}
+
+SStringView SStringColumn::operator[](size_t index) const {
+    return at(index);
+}
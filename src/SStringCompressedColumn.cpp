@@ -0,0 +1,300 @@
+#include <SString/SStringCompressedColumn.h>
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <utility>
+#ifdef _WIN32
+#pragma warning(disable : 4267)
+#endif
+
+#define ESCAPE_CODE 255
+#define MAX_SYMBOLS 255
+#define MAX_SYMBOL_LEN 8
+/// 训练时的编码空间：0~255 为原始字节，256 起为符号
+#define CODE_SPACE (256 + MAX_SYMBOLS)
+
+using sstr::SString;
+using sstr::SStringCompressedColumn;
+using sstr::SStringSymbolTable;
+using sstr::SStringView;
+
+static inline uint64_t loadBytes(const char *p, size_t n) {
+    uint64_t value = 0;
+    memcpy(&value, p, n < 8 ? n : 8);
+    return value;
+}
+
+static inline uint64_t getMask(size_t len) {
+    return len >= 8 ? ~0ull : (1ull << (len * 8)) - 1;
+}
+
+#pragma region SStringSymbolTable
+
+SStringSymbolTable::SStringSymbolTable() {
+    memset(_symbols, 0, sizeof(_symbols));
+    memset(_lens, 0, sizeof(_lens));
+}
+
+void SStringSymbolTable::add(uint64_t value, uint8_t len) {
+    if (_size >= MAX_SYMBOLS) return;
+    _symbols[_size] = value & getMask(len);
+    _lens[_size] = len;
+    _size++;
+}
+
+void SStringSymbolTable::build() {
+    for (auto &bucket: _buckets) {
+        bucket.clear();
+    }
+    for (size_t code = 0; code < _size; code++) {
+        _buckets[_symbols[code] & 0xff].push_back((uint8_t) code);
+    }
+    // 组内按长度降序，首个命中即为最长匹配
+    for (auto &bucket: _buckets) {
+        std::stable_sort(bucket.begin(), bucket.end(), [this](uint8_t a, uint8_t b) {
+            return _lens[a] > _lens[b];
+        });
+    }
+}
+
+int SStringSymbolTable::findLongest(const char *p, size_t n) const {
+    auto &bucket = _buckets[(unsigned char) p[0]];
+    if (bucket.empty()) return -1;
+    auto word = loadBytes(p, n);
+    for (auto code: bucket) {
+        auto len = _lens[code];
+        if (len <= n && (word & getMask(len)) == _symbols[code]) return code;
+    }
+    return -1;
+}
+
+SStringSymbolTable SStringSymbolTable::train(const std::vector<SStringView> &sample, int rounds) {
+    SStringSymbolTable table;
+    std::vector<uint32_t> count1(CODE_SPACE);
+    std::vector<uint32_t> count2(CODE_SPACE * CODE_SPACE);
+
+    for (int round = 0; round < rounds; round++) {
+        std::fill(count1.begin(), count1.end(), 0);
+        std::fill(count2.begin(), count2.end(), 0);
+
+        // 用当前符号表切分样本，统计单个编码与相邻编码对的出现次数
+        for (auto &str: sample) {
+            if (str.null()) continue;
+            auto p = str.data();
+            auto n = str.size();
+            size_t i = 0;
+            int prev = -1;
+            while (i < n) {
+                auto code = table.findLongest(p + i, n - i);
+                int cur = -1 == code ? (unsigned char) p[i] : 256 + code;
+                i += -1 == code ? 1 : table._lens[code];
+                count1[cur]++;
+                if (-1 != prev) count2[prev * CODE_SPACE + cur]++;
+                prev = cur;
+            }
+        }
+
+        // 候选符号：现有编码本身与相邻编码对的拼接，收益为出现次数乘以长度
+        auto getSymbol = [&table](int code, uint64_t &value) -> uint8_t {
+            if (code < 256) {
+                value = (uint64_t) code;
+                return 1;
+            }
+            value = table._symbols[code - 256];
+            return table._lens[code - 256];
+        };
+        std::map<std::pair<uint64_t, uint8_t>, uint64_t> gains;
+        for (int a = 0; a < CODE_SPACE; a++) {
+            if (0 == count1[a]) continue;
+            uint64_t valueA;
+            auto lenA = getSymbol(a, valueA);
+            // 单字节转义需要 2 字节，赋予更高权重
+            gains[std::make_pair(valueA, lenA)] += (uint64_t) count1[a] * (1 == lenA ? 8 : lenA);
+            if (MAX_SYMBOL_LEN == lenA) continue;
+            for (int b = 0; b < CODE_SPACE; b++) {
+                auto count = count2[a * CODE_SPACE + b];
+                if (0 == count) continue;
+                uint64_t valueB;
+                auto lenB = getSymbol(b, valueB);
+                auto len = (uint8_t) (lenA + lenB < MAX_SYMBOL_LEN ? lenA + lenB : MAX_SYMBOL_LEN);
+                auto value = (valueA | valueB << (lenA * 8)) & getMask(len);
+                gains[std::make_pair(value, len)] += (uint64_t) count * len;
+            }
+        }
+
+        std::vector<std::pair<uint64_t, std::pair<uint64_t, uint8_t>>> candidates;
+        candidates.reserve(gains.size());
+        for (auto &gain: gains) {
+            candidates.emplace_back(gain.second, gain.first);
+        }
+        auto n = candidates.size() < MAX_SYMBOLS ? candidates.size() : MAX_SYMBOLS;
+        std::partial_sort(candidates.begin(), candidates.begin() + n, candidates.end(),
+                          [](const std::pair<uint64_t, std::pair<uint64_t, uint8_t>> &a,
+                             const std::pair<uint64_t, std::pair<uint64_t, uint8_t>> &b) {
+                              return a.first > b.first;
+                          });
+
+        SStringSymbolTable next;
+        for (size_t i = 0; i < n; i++) {
+            next.add(candidates[i].second.first, candidates[i].second.second);
+        }
+        next.build();
+        table = std::move(next);
+    }
+    return table;
+}
+
+SStringSymbolTable SStringSymbolTable::train(const std::vector<SString> &sample, int rounds) {
+    return train(std::vector<SStringView>(sample.begin(), sample.end()), rounds);
+}
+
+size_t SStringSymbolTable::size() const {
+    return _size;
+}
+
+SString SStringSymbolTable::symbol(size_t code) const {
+    if (code >= _size) return SString();
+    return {(const char *) &_symbols[code], _lens[code]};
+}
+
+size_t SStringSymbolTable::encode(const SStringView &str, uint8_t *dst) const {
+    if (str.null()) return 0;
+    auto p = str.data();
+    auto n = str.size();
+    auto begin = dst;
+    size_t i = 0;
+    while (i < n) {
+        auto code = findLongest(p + i, n - i);
+        if (-1 == code) {
+            *dst++ = ESCAPE_CODE;
+            *dst++ = (uint8_t) p[i++];
+        } else {
+            *dst++ = (uint8_t) code;
+            i += _lens[code];
+        }
+    }
+    return dst - begin;
+}
+
+size_t SStringSymbolTable::getDecodedSize(const uint8_t *src, size_t size) const {
+    size_t n = 0;
+    for (size_t i = 0; i < size; i++) {
+        if (ESCAPE_CODE == src[i]) {
+            i++;
+            n++;
+        } else {
+            n += _lens[src[i]];
+        }
+    }
+    return n;
+}
+
+size_t SStringSymbolTable::decode(const uint8_t *src, size_t size, char *dst) const {
+    auto begin = dst;
+    size_t i = 0;
+    while (i < size) {
+        auto code = src[i++];
+        if (ESCAPE_CODE == code) {
+            if (i == size) break;
+            *dst++ = (char) src[i++];
+        } else {
+            // 整字写入后按符号长度前进，要求目标缓冲区留有 8 字节余量
+            memcpy(dst, &_symbols[code], 8);
+            dst += _lens[code];
+        }
+    }
+    return dst - begin;
+}
+
+#pragma endregion
+
+#pragma region SStringCompressedColumn
+
+SStringCompressedColumn::SStringCompressedColumn(const SStringSymbolTable &table) : _table(table), _offsets(1, 0) {}
+
+size_t SStringCompressedColumn::size() const {
+    return _offsets.size() - 1;
+}
+
+bool SStringCompressedColumn::empty() const {
+    return 1 == _offsets.size();
+}
+
+size_t SStringCompressedColumn::bytes() const {
+    return _data.size();
+}
+
+const SStringSymbolTable &SStringCompressedColumn::table() const {
+    return _table;
+}
+
+void SStringCompressedColumn::append(const SStringView &str) {
+    auto offset = _data.size();
+    auto n = str.null() ? 0 : str.size();
+    // 最坏情况下每个字节都需要转义
+    _data.resize(offset + n * 2);
+    auto len = _table.encode(str, _data.data() + offset);
+    _data.resize(offset + len);
+    _offsets.push_back((uint32_t) _data.size());
+}
+
+void SStringCompressedColumn::append(const char *u8str) {
+    append(SStringView(u8str));
+}
+
+void SStringCompressedColumn::clear() {
+    _data.clear();
+    _offsets.resize(1);
+}
+
+size_t SStringCompressedColumn::size(size_t index) const {
+    if (index >= size()) return 0;
+    auto begin = _offsets[index];
+    return _table.getDecodedSize(_data.data() + begin, _offsets[index + 1] - begin);
+}
+
+size_t SStringCompressedColumn::decompress(size_t index, char *dst) const {
+    if (index >= size()) return 0;
+    auto begin = _offsets[index];
+    return _table.decode(_data.data() + begin, _offsets[index + 1] - begin, dst);
+}
+
+SString SStringCompressedColumn::at(size_t index) const {
+    SString res;
+    if (index >= size()) return res;
+    auto n = size(index);
+    res.resize(n + 8);
+    decompress(index, res.data());
+    res.resize(n);
+    return res;
+}
+
+bool SStringCompressedColumn::equals(size_t index, const SStringView &str) const {
+    if (index >= size()) return false;
+    auto n = str.null() ? 0 : str.size();
+    std::vector<uint8_t> encoded(n * 2);
+    auto len = _table.encode(str, encoded.data());
+    auto begin = _offsets[index];
+    return _offsets[index + 1] - begin == len && (0 == len || 0 == memcmp(_data.data() + begin, encoded.data(), len));
+}
+
+int64_t SStringCompressedColumn::find(const SStringView &str) const {
+    auto n = str.null() ? 0 : str.size();
+    std::vector<uint8_t> encoded(n * 2);
+    auto len = _table.encode(str, encoded.data());
+    auto count = size();
+    auto data = _data.data();
+    // 编码是确定的，只需比较压缩后的字节
+    for (size_t i = 0; i < count; i++) {
+        auto begin = _offsets[i];
+        if (_offsets[i + 1] - begin != len) continue;
+        if (0 == len || 0 == memcmp(data + begin, encoded.data(), len)) return (int64_t) i;
+    }
+    return -1;
+}
+
+SString SStringCompressedColumn::operator[](size_t index) const {
+    return at(index);
+}
+
+#pragma endregion
@@ -0,0 +1,192 @@
+#include <SString/SStringCuckooFilter.h>
+#include <SString/algorithm.h>
+#include <algorithm>
+
+using sstr::SBitmap;
+using sstr::SStringColumn;
+using sstr::SStringCuckooFilter;
+using sstr::SStringView;
+
+/// 每个桶的槽位数
+static const size_t BucketSlots = 4;
+/// 加入时最多踢出的次数
+static const int MaxKicks = 500;
+/// 批量查询时每组预取的键数
+static const size_t BatchSize = 16;
+
+static const uint64_t LowBits = 0x0001000100010001ull;
+static const uint64_t HighBits = 0x8000800080008000ull;
+
+/// 桶中值为 fingerprint 的槽位的掩码，每个匹配的槽位最高位为 1
+static inline uint64_t matchSlots(uint64_t bucket, uint16_t fingerprint) {
+    auto x = bucket ^ (fingerprint * LowBits);
+    return (x - LowBits) & ~x & HighBits;
+}
+
+/// matchSlots 结果中最低的匹配槽位，更高的槽位可能因借位误报
+static inline size_t getFirstSlot(uint64_t match) {
+    auto low = (uint32_t) match;
+    return low ? sstr::CountTrailingZeros(low) / 16 : 2 + sstr::CountTrailingZeros((uint32_t) (match >> 32)) / 16;
+}
+
+static inline uint16_t getSlot(uint64_t bucket, size_t slot) {
+    return (uint16_t) (bucket >> (slot * 16));
+}
+
+static inline void setSlot(uint64_t &bucket, size_t slot, uint16_t fingerprint) {
+    bucket = (bucket & ~(0xffffull << (slot * 16))) | (uint64_t) fingerprint << (slot * 16);
+}
+
+/// 放入空位
+static inline bool put(uint64_t &bucket, uint16_t fingerprint) {
+    for (size_t slot = 0; slot < BucketSlots; slot++) {
+        if (!getSlot(bucket, slot)) {
+            setSlot(bucket, slot, fingerprint);
+            return true;
+        }
+    }
+    return false;
+}
+
+static inline uint64_t getKeyHash(const SStringView &key) {
+    return sstr::getHashFromBytes(key.data(), key.null() ? 0 : key.size());
+}
+
+SStringCuckooFilter::SStringCuckooFilter(size_t capacity) {
+    // 装载率按 95% 估计，桶数取 2 的幂使备选桶可由异或得到
+    size_t buckets = 1;
+    while (buckets * BucketSlots * 95 / 100 < capacity) buckets <<= 1;
+    _buckets.assign(buckets, 0);
+}
+
+size_t SStringCuckooFilter::size() const {
+    return _size;
+}
+
+size_t SStringCuckooFilter::capacity() const {
+    return _buckets.size() * BucketSlots;
+}
+
+void SStringCuckooFilter::locate(uint64_t hash, uint16_t &fingerprint, size_t &first, size_t &second) const {
+    fingerprint = (uint16_t) (hash >> 48);
+    if (!fingerprint) fingerprint = 1;
+    first = (size_t) hash & (_buckets.size() - 1);
+    second = getAlternate(first, fingerprint);
+}
+
+size_t SStringCuckooFilter::getAlternate(size_t bucket, uint16_t fingerprint) const {
+    // 只由指纹决定偏移，两个候选桶可以互相推出
+    return (bucket ^ (size_t) (fingerprint * 0x5bd1e995u)) & (_buckets.size() - 1);
+}
+
+bool SStringCuckooFilter::insert(const SStringView &key) {
+    if (_victim) return false;
+    uint16_t fingerprint;
+    size_t first, second;
+    locate(getKeyHash(key), fingerprint, first, second);
+    _size++;
+    if (put(_buckets[first], fingerprint) || put(_buckets[second], fingerprint)) return true;
+    // 随机踢出一个指纹，移到它的备选桶
+    auto bucket = (_random & 1) ? first : second;
+    for (int kick = 0; kick < MaxKicks; kick++) {
+        _random ^= _random << 13;
+        _random ^= _random >> 7;
+        _random ^= _random << 17;
+        auto slot = (size_t) (_random >> 32) % BucketSlots;
+        auto evicted = getSlot(_buckets[bucket], slot);
+        setSlot(_buckets[bucket], slot, fingerprint);
+        fingerprint = evicted;
+        bucket = getAlternate(bucket, fingerprint);
+        if (put(_buckets[bucket], fingerprint)) return true;
+    }
+    // 最后一个指纹另行保存，保证已加入的键都能查到
+    _victim = fingerprint;
+    _victimBucket = bucket;
+    return false;
+}
+
+bool SStringCuckooFilter::erase(const SStringView &key) {
+    uint16_t fingerprint;
+    size_t first, second;
+    locate(getKeyHash(key), fingerprint, first, second);
+    bool found = false;
+    for (auto index: {first, second}) {
+        auto match = matchSlots(_buckets[index], fingerprint);
+        if (match) {
+            setSlot(_buckets[index], getFirstSlot(match), 0);
+            found = true;
+            break;
+        }
+    }
+    if (!found && _victim == fingerprint && (_victimBucket == first || _victimBucket == second)) {
+        _victim = 0;
+        found = true;
+    }
+    if (!found) return false;
+    _size--;
+    // 腾出空位后放回保存的指纹
+    if (_victim) {
+        if (put(_buckets[_victimBucket], _victim) || put(_buckets[getAlternate(_victimBucket, _victim)], _victim)) _victim = 0;
+    }
+    return true;
+}
+
+bool SStringCuckooFilter::test(uint64_t hash) const {
+    uint16_t fingerprint;
+    size_t first, second;
+    locate(hash, fingerprint, first, second);
+    if (matchSlots(_buckets[first], fingerprint) | matchSlots(_buckets[second], fingerprint)) return true;
+    return _victim == fingerprint && (_victimBucket == first || _victimBucket == second);
+}
+
+bool SStringCuckooFilter::mayContain(const SStringView &key) const {
+    return test(getKeyHash(key));
+}
+
+void SStringCuckooFilter::testBatch(const uint64_t *hashes, size_t count, uint64_t *bits, size_t offset) const {
+    for (size_t i = 0; i < count; i++) {
+        uint16_t fingerprint;
+        size_t first, second;
+        locate(hashes[i], fingerprint, first, second);
+        Prefetch(&_buckets[first]);
+        Prefetch(&_buckets[second]);
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (test(hashes[i])) bits[(offset + i) / 64] |= 1ull << ((offset + i) % 64);
+    }
+}
+
+/// 分组计算哈希，每组的桶一起预取后再检查
+template<typename Keys, typename Callback>
+static void forEachBatch(const Keys &keys, size_t count, Callback &&callback) {
+    uint64_t hashes[BatchSize];
+    for (size_t base = 0; base < count; base += BatchSize) {
+        auto n = count - base < BatchSize ? count - base : BatchSize;
+        for (size_t i = 0; i < n; i++) {
+            hashes[i] = getKeyHash(keys[base + i]);
+        }
+        callback(hashes, n, base);
+    }
+}
+
+SBitmap SStringCuckooFilter::mayContain(const SStringColumn &keys) const {
+    SBitmap res(keys.size());
+    forEachBatch(keys, keys.size(), [&](const uint64_t *hashes, size_t n, size_t base) {
+        testBatch(hashes, n, res.words(), base);
+    });
+    return res;
+}
+
+SBitmap SStringCuckooFilter::mayContain(const std::vector<SStringView> &keys) const {
+    SBitmap res(keys.size());
+    forEachBatch(keys, keys.size(), [&](const uint64_t *hashes, size_t n, size_t base) {
+        testBatch(hashes, n, res.words(), base);
+    });
+    return res;
+}
+
+void SStringCuckooFilter::clear() {
+    std::fill(_buckets.begin(), _buckets.end(), 0);
+    _size = 0;
+    _victim = 0;
+}
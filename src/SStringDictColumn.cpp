@@ -0,0 +1,256 @@
+#include <SString/SStringDictColumn.h>
+#include <cstring>
+#ifdef _WIN32
+#pragma warning(disable : 4267)
+#endif
+
+#define EMPTY_SLOT 0xffffffffu
+
+using sstr::SBitmap;
+using sstr::SString;
+using sstr::SStringColumn;
+using sstr::SStringDictColumn;
+using sstr::SStringView;
+
+/// 按编码宽度展开的过滤循环
+/// \param codes 编码
+/// \param member 编码是否命中，按编码索引
+/// \param words 结果位图
+template<typename T>
+static void scanMember(const std::vector<T> &codes, const std::vector<bool> &member, uint64_t *words) {
+    auto count = codes.size();
+    for (size_t i = 0; i < count; i++) {
+        if (member[codes[i]]) words[i / 64] |= 1ull << (i % 64);
+    }
+}
+
+template<typename T>
+static void scanEqual(const std::vector<T> &codes, uint32_t code, uint64_t *words) {
+    auto p = codes.data();
+    auto count = codes.size();
+    auto target = (T) code;
+    // 每次凑满一个 64 位字再写回
+    for (size_t base = 0; base < count; base += 64) {
+        auto n = count - base < 64 ? count - base : 64;
+        uint64_t word = 0;
+        for (size_t j = 0; j < n; j++) {
+            word |= (uint64_t) (p[base + j] == target) << j;
+        }
+        words[base / 64] = word;
+    }
+}
+
+template<typename T>
+static void countCodes(const std::vector<T> &codes, std::vector<size_t> &counts) {
+    for (auto code: codes) {
+        counts[code]++;
+    }
+}
+
+template<typename From, typename To>
+static void copyCodes(std::vector<From> &from, std::vector<To> &to) {
+    to.assign(from.begin(), from.end());
+    std::vector<From>().swap(from);
+}
+
+SStringDictColumn::SStringDictColumn() {
+    rehash(16);
+}
+
+SStringDictColumn::SStringDictColumn(const SStringColumn &column) {
+    rehash(16);
+    reserve(column.size());
+    for (size_t i = 0; i < column.size(); i++) {
+        if (!append(column[i])) break;
+    }
+}
+
+SStringDictColumn::SStringDictColumn(const std::vector<SString> &strings) {
+    rehash(16);
+    reserve(strings.size());
+    for (auto &str: strings) {
+        if (!append(str)) break;
+    }
+}
+
+size_t SStringDictColumn::size() const {
+    return _size;
+}
+
+bool SStringDictColumn::empty() const {
+    return 0 == _size;
+}
+
+size_t SStringDictColumn::width() const {
+    return _width;
+}
+
+void SStringDictColumn::reserve(size_t count) {
+    switch (_width) {
+        case 1: _codes8.reserve(count); break;
+        case 2: _codes16.reserve(count); break;
+        default: _codes32.reserve(count); break;
+    }
+}
+
+void SStringDictColumn::rehash(size_t capacity) {
+    _slots.assign(capacity, EMPTY_SLOT);
+    auto mask = capacity - 1;
+    for (uint32_t code = 0; code < (uint32_t) _hashes.size(); code++) {
+        auto slot = _hashes[code] & mask;
+        while (EMPTY_SLOT != _slots[slot]) slot = (slot + 1) & mask;
+        _slots[slot] = code;
+    }
+}
+
+void SStringDictColumn::widen(size_t width) {
+    if (1 == _width) {
+        copyCodes(_codes8, _codes16);
+    } else {
+        copyCodes(_codes16, _codes32);
+    }
+    _width = width;
+}
+
+uint32_t SStringDictColumn::insertValue(const SStringView &str) {
+    auto hash = str.hash();
+    auto mask = _slots.size() - 1;
+    auto slot = hash & mask;
+    while (EMPTY_SLOT != _slots[slot]) {
+        auto code = _slots[slot];
+        if (_hashes[code] == hash && _dictionary[code] == str) return code;
+        slot = (slot + 1) & mask;
+    }
+
+    auto code = (uint32_t) _hashes.size();
+    if (!_dictionary.append(str)) return EMPTY_SLOT;
+    _hashes.push_back(hash);
+    _slots[slot] = code;
+    // 负载因子不超过 1/2
+    if (_hashes.size() * 2 > _slots.size()) rehash(_slots.size() * 2);
+
+    auto count = _hashes.size();
+    if (1 == _width && count > 0x100) widen(2);
+    if (2 == _width && count > 0x10000) widen(4);
+    return code;
+}
+
+bool SStringDictColumn::append(const SStringView &str) {
+    auto code = insertValue(str.null() ? SStringView("") : str);
+    if (EMPTY_SLOT == code) return false;
+    switch (_width) {
+        case 1: _codes8.push_back((uint8_t) code); break;
+        case 2: _codes16.push_back((uint16_t) code); break;
+        default: _codes32.push_back(code); break;
+    }
+    _size++;
+    return true;
+}
+
+bool SStringDictColumn::append(const char *u8str) {
+    return append(SStringView(u8str));
+}
+
+void SStringDictColumn::clear() {
+    _dictionary.clear();
+    _hashes.clear();
+    _codes8.clear();
+    _codes16.clear();
+    _codes32.clear();
+    _width = 1;
+    _size = 0;
+    rehash(16);
+}
+
+SStringView SStringDictColumn::at(size_t index) const {
+    if (index >= _size) return {};
+    return _dictionary[(size_t) codeAt(index)];
+}
+
+int64_t SStringDictColumn::codeAt(size_t index) const {
+    if (index >= _size) return -1;
+    switch (_width) {
+        case 1: return _codes8[index];
+        case 2: return _codes16[index];
+        default: return _codes32[index];
+    }
+}
+
+int64_t SStringDictColumn::code(const SStringView &str) const {
+    auto value = str.null() ? SStringView("") : str;
+    auto hash = value.hash();
+    auto mask = _slots.size() - 1;
+    auto slot = hash & mask;
+    while (EMPTY_SLOT != _slots[slot]) {
+        auto code = _slots[slot];
+        if (_hashes[code] == hash && _dictionary[code] == value) return code;
+        slot = (slot + 1) & mask;
+    }
+    return -1;
+}
+
+const SStringColumn &SStringDictColumn::dictionary() const {
+    return _dictionary;
+}
+
+SBitmap SStringDictColumn::equals(const SStringView &str) const {
+    auto c = code(str);
+    if (-1 == c) return SBitmap(_size);
+    return equalsCode((uint32_t) c);
+}
+
+SBitmap SStringDictColumn::equalsCode(uint32_t code) const {
+    SBitmap res(_size);
+    if (code >= _hashes.size()) return res;
+    switch (_width) {
+        case 1: scanEqual(_codes8, code, res.words()); break;
+        case 2: scanEqual(_codes16, code, res.words()); break;
+        default: scanEqual(_codes32, code, res.words()); break;
+    }
+    return res;
+}
+
+SBitmap SStringDictColumn::in(const std::vector<SStringView> &values) const {
+    SBitmap res(_size);
+    // 先把值集合转换为按编码索引的成员表，之后只扫描编码
+    std::vector<bool> member(_hashes.size(), false);
+    bool any = false;
+    for (auto &value: values) {
+        auto c = code(value);
+        if (-1 != c) member[(size_t) c] = any = true;
+    }
+    if (!any) return res;
+    switch (_width) {
+        case 1: scanMember(_codes8, member, res.words()); break;
+        case 2: scanMember(_codes16, member, res.words()); break;
+        default: scanMember(_codes32, member, res.words()); break;
+    }
+    return res;
+}
+
+bool SStringDictColumn::equals(size_t i, size_t j) const {
+    if (i >= _size || j >= _size) return false;
+    return codeAt(i) == codeAt(j);
+}
+
+std::vector<size_t> SStringDictColumn::countByCode() const {
+    std::vector<size_t> counts(_hashes.size(), 0);
+    switch (_width) {
+        case 1: countCodes(_codes8, counts); break;
+        case 2: countCodes(_codes16, counts); break;
+        default: countCodes(_codes32, counts); break;
+    }
+    return counts;
+}
+
+std::vector<uint32_t> SStringDictColumn::codes() const {
+    switch (_width) {
+        case 1: return {_codes8.begin(), _codes8.end()};
+        case 2: return {_codes16.begin(), _codes16.end()};
+        default: return _codes32;
+    }
+}
+
+SStringView SStringDictColumn::operator[](size_t index) const {
+    return at(index);
+}
@@ -0,0 +1,367 @@
+#include <SString/SStringFrontCodedDict.h>
+#include <SString/algorithm.h>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#ifdef _WIN32
+#pragma warning(disable : 4267)
+#endif
+
+#define DICT_VERSION 1
+
+using sstr::SString;
+using sstr::SStringFrontCodedDict;
+using sstr::SStringView;
+
+static const char DictMagic[4] = {'S', 'F', 'C', 'D'};
+
+struct DictHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t reserved;
+    uint32_t blockSize;
+    /// 块偏移表与块数据的 CRC32
+    uint32_t checksum;
+    uint64_t count;
+    uint64_t blockCount;
+};
+
+static_assert(sizeof(DictHeader) == 32, "unexpected DictHeader layout");
+
+/// 按字节序比较
+static int compareBytes(const char *a, size_t an, const char *b, size_t bn) {
+    auto n = an < bn ? an : bn;
+    auto res = n ? memcmp(a, b, n) : 0;
+    if (0 != res) return res;
+    return an < bn ? -1 : (an > bn ? 1 : 0);
+}
+
+static inline int compareBytes(const std::string &a, const SStringView &b) {
+    return compareBytes(a.data(), a.size(), b.data(), b.null() ? 0 : b.size());
+}
+
+static void writeVarint(std::string &out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back((char) (value | 0x80));
+        value >>= 7;
+    }
+    out.push_back((char) value);
+}
+
+/// 读取 LEB128 变长整数
+/// \return 是否成功
+static bool readVarint(const char *&p, const char *end, uint64_t &value) {
+    value = 0;
+    for (int shift = 0; p < end && shift < 64; shift += 7) {
+        auto byte = (unsigned char) *p++;
+        value |= (uint64_t) (byte & 0x7f) << shift;
+        if (0 == (byte & 0x80)) return true;
+    }
+    return false;
+}
+
+/// 块内顺序解码
+struct BlockCursor {
+    const char *p;
+    const char *end;
+    bool first = true;
+    std::string current;
+
+    BlockCursor(const char *begin, const char *end) : p(begin), end(end) {}
+
+    /// 解码下一项到 current
+    /// \return 是否成功
+    bool next() {
+        uint64_t prefix = 0;
+        uint64_t suffix;
+        if (!first && !readVarint(p, end, prefix)) return false;
+        if (!readVarint(p, end, suffix)) return false;
+        if (prefix > current.size() || suffix > (uint64_t) (end - p)) return false;
+        current.resize((size_t) prefix);
+        current.append(p, (size_t) suffix);
+        p += suffix;
+        first = false;
+        return true;
+    }
+};
+
+template<typename T>
+static bool buildImage(const std::vector<T> &sorted, uint32_t blockSize, SString &image) {
+    if (0 == blockSize) return false;
+    auto count = sorted.size();
+    auto blockCount = (count + blockSize - 1) / blockSize;
+    std::vector<uint64_t> blocks;
+    blocks.reserve(blockCount + 1);
+    std::string data;
+
+    const char *prev = nullptr;
+    size_t prevSize = 0;
+    for (size_t i = 0; i < count; i++) {
+        auto str = sorted[i].data();
+        auto size = sorted[i].null() ? 0 : sorted[i].size();
+        if (i > 0 && compareBytes(prev, prevSize, str, size) >= 0) return false;
+
+        if (0 == i % blockSize) {
+            blocks.push_back(data.size());
+            writeVarint(data, size);
+            data.append(str, size);
+        } else {
+            size_t lcp = 0;
+            auto n = size < prevSize ? size : prevSize;
+            while (lcp < n && prev[lcp] == str[lcp]) lcp++;
+            writeVarint(data, lcp);
+            writeVarint(data, size - lcp);
+            data.append(str + lcp, size - lcp);
+        }
+        prev = str;
+        prevSize = size;
+    }
+    blocks.push_back(data.size());
+
+    auto blockBytes = blocks.size() * sizeof(uint64_t);
+    image.resize(sizeof(DictHeader) + blockBytes + data.size());
+    auto base = image.data();
+    memcpy(base + sizeof(DictHeader), blocks.data(), blockBytes);
+    if (!data.empty()) memcpy(base + sizeof(DictHeader) + blockBytes, data.data(), data.size());
+
+    DictHeader header;
+    memcpy(header.magic, DictMagic, 4);
+    header.version = DICT_VERSION;
+    header.reserved = 0;
+    header.blockSize = blockSize;
+    header.checksum = sstr::CRC32(base + sizeof(DictHeader), blockBytes + data.size());
+    header.count = count;
+    header.blockCount = blockCount;
+    memcpy(base, &header, sizeof(header));
+    return true;
+}
+
+SStringFrontCodedDict::SStringFrontCodedDict(SStringFrontCodedDict &&dict) noexcept {
+    *this = std::move(dict);
+}
+
+SStringFrontCodedDict &SStringFrontCodedDict::operator=(SStringFrontCodedDict &&dict) noexcept {
+    if (this == &dict) return *this;
+    close();
+    _base = dict._base;
+    _bytes = dict._bytes;
+    _blocks = dict._blocks;
+    _strings = dict._strings;
+    _count = dict._count;
+    _blockCount = dict._blockCount;
+    _blockSize = dict._blockSize;
+    _buffer = std::move(dict._buffer);
+    _file = std::move(dict._file);
+
+    dict._base = nullptr;
+    dict._bytes = 0;
+    dict._blocks = nullptr;
+    dict._strings = nullptr;
+    dict._count = 0;
+    dict._blockCount = 0;
+    dict._blockSize = 0;
+    return *this;
+}
+
+bool SStringFrontCodedDict::build(const std::vector<SStringView> &sorted, uint32_t blockSize) {
+    close();
+    if (!buildImage(sorted, blockSize, _buffer)) return false;
+    return attach(_buffer.data(), _buffer.size(), false);
+}
+
+bool SStringFrontCodedDict::build(const std::vector<SString> &sorted, uint32_t blockSize) {
+    close();
+    if (!buildImage(sorted, blockSize, _buffer)) return false;
+    return attach(_buffer.data(), _buffer.size(), false);
+}
+
+SStringView SStringFrontCodedDict::image() const {
+    return {_base, _bytes};
+}
+
+bool SStringFrontCodedDict::write(const char *path) const {
+    if (nullptr == _base) return false;
+    auto file = fopen(path, "wb");
+    if (nullptr == file) return false;
+    bool ok = _bytes == fwrite(_base, 1, _bytes, file);
+    return 0 == fclose(file) && ok;
+}
+
+bool SStringFrontCodedDict::attach(const char *data, size_t size, bool verify) {
+    if (nullptr == data || size < sizeof(DictHeader)) return false;
+    if (0 != (uintptr_t) data % 8) return false;
+
+    DictHeader header;
+    memcpy(&header, data, sizeof(header));
+    if (0 != memcmp(header.magic, DictMagic, 4) || DICT_VERSION != header.version) return false;
+    if (0 == header.blockSize) return false;
+    if (header.blockCount != (header.count + header.blockSize - 1) / header.blockSize) return false;
+
+    auto rest = size - sizeof(DictHeader);
+    if (rest / sizeof(uint64_t) < header.blockCount + 1) return false;
+    auto blockBytes = (size_t) (header.blockCount + 1) * sizeof(uint64_t);
+    auto blocks = (const uint64_t *) (data + sizeof(DictHeader));
+    auto dataSize = blocks[header.blockCount];
+    if (dataSize > rest - blockBytes) return false;
+    for (size_t i = 0; i < header.blockCount; i++) {
+        if (blocks[i] >= blocks[i + 1]) return false;
+    }
+    if (verify && header.checksum != CRC32(blocks, blockBytes + (size_t) dataSize)) return false;
+
+    _base = data;
+    _bytes = size;
+    _blocks = blocks;
+    _strings = data + sizeof(DictHeader) + blockBytes;
+    _count = (size_t) header.count;
+    _blockCount = (size_t) header.blockCount;
+    _blockSize = header.blockSize;
+    return true;
+}
+
+bool SStringFrontCodedDict::open(const char *data, size_t size, bool verify) {
+    close();
+    return attach(data, size, verify);
+}
+
+bool SStringFrontCodedDict::load(const char *path, bool verify) {
+    close();
+    auto file = fopen(path, "rb");
+    if (nullptr == file) return false;
+    bool ok = 0 == fseek(file, 0, SEEK_END);
+    long size = ok ? ftell(file) : -1;
+    ok = size > 0 && 0 == fseek(file, 0, SEEK_SET);
+    if (ok) {
+        _buffer.resize((size_t) size);
+        ok = (size_t) size == fread(_buffer.data(), 1, (size_t) size, file);
+    }
+    fclose(file);
+    if (ok && attach(_buffer.data(), _buffer.size(), verify)) return true;
+    close();
+    return false;
+}
+
+bool SStringFrontCodedDict::map(const char *path, bool verify) {
+    close();
+    if (!_file.open(path)) return false;
+    if (!attach(_file.data(), _file.size(), verify)) {
+        _file.close();
+        return false;
+    }
+    return true;
+}
+
+void SStringFrontCodedDict::close() {
+    _file.close();
+    _buffer = SString();
+    _base = nullptr;
+    _bytes = 0;
+    _blocks = nullptr;
+    _strings = nullptr;
+    _count = 0;
+    _blockCount = 0;
+    _blockSize = 0;
+}
+
+size_t SStringFrontCodedDict::size() const {
+    return _count;
+}
+
+bool SStringFrontCodedDict::empty() const {
+    return 0 == _count;
+}
+
+SStringView SStringFrontCodedDict::firstOf(size_t block) const {
+    auto p = _strings + _blocks[block];
+    auto end = _strings + _blocks[block + 1];
+    uint64_t size;
+    if (!readVarint(p, end, size) || size > (uint64_t) (end - p)) return {p, 0};
+    return {p, (size_t) size};
+}
+
+size_t SStringFrontCodedDict::findBlock(const SStringView &key) const {
+    auto keyData = key.data();
+    auto keySize = key.null() ? 0 : key.size();
+    // 块首不大于 key 的块个数
+    size_t lo = 0;
+    size_t hi = _blockCount;
+    while (lo < hi) {
+        auto mid = lo + (hi - lo) / 2;
+        auto first = firstOf(mid);
+        if (compareBytes(first.data(), first.size(), keyData, keySize) <= 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+size_t SStringFrontCodedDict::lowerBound(const SStringView &key) const {
+    auto n = findBlock(key);
+    if (0 == n) return 0;
+    auto block = n - 1;
+    BlockCursor cursor(_strings + _blocks[block], _strings + _blocks[block + 1]);
+    auto id = block * _blockSize;
+    auto end = id + _blockSize < _count ? id + _blockSize : _count;
+    for (; id < end && cursor.next(); id++) {
+        if (compareBytes(cursor.current, key) >= 0) return id;
+    }
+    return end;
+}
+
+int64_t SStringFrontCodedDict::lookup(const SStringView &key) const {
+    auto n = findBlock(key);
+    if (0 == n) return -1;
+    auto block = n - 1;
+    BlockCursor cursor(_strings + _blocks[block], _strings + _blocks[block + 1]);
+    auto id = block * _blockSize;
+    auto end = id + _blockSize < _count ? id + _blockSize : _count;
+    for (; id < end && cursor.next(); id++) {
+        auto res = compareBytes(cursor.current, key);
+        if (0 == res) return (int64_t) id;
+        if (res > 0) break;
+    }
+    return -1;
+}
+
+SString SStringFrontCodedDict::locate(size_t id) const {
+    if (id >= _count) return SString();
+    auto block = id / _blockSize;
+    BlockCursor cursor(_strings + _blocks[block], _strings + _blocks[block + 1]);
+    for (size_t i = 0; i <= id % _blockSize; i++) {
+        if (!cursor.next()) return SString();
+    }
+    return {cursor.current.data(), cursor.current.size()};
+}
+
+void SStringFrontCodedDict::prefixRange(const SStringView &prefix, size_t &begin, size_t &end) const {
+    begin = lowerBound(prefix);
+    // 前缀的后继：去掉末尾的 0xff 后将最后一个字节加 1
+    std::string next(prefix.data(), prefix.null() ? 0 : prefix.size());
+    while (!next.empty() && (char) 0xff == next.back()) next.pop_back();
+    if (next.empty()) {
+        end = _count;
+        return;
+    }
+    next.back() = (char) ((unsigned char) next.back() + 1);
+    end = lowerBound(SStringView(next.data(), next.size()));
+}
+
+void SStringFrontCodedDict::forEachPrefix(const SStringView &prefix, const std::function<bool(size_t, const SStringView &)> &callback) const {
+    size_t begin, end;
+    prefixRange(prefix, begin, end);
+    auto id = begin;
+    while (id < end) {
+        auto block = id / _blockSize;
+        BlockCursor cursor(_strings + _blocks[block], _strings + _blocks[block + 1]);
+        auto blockBegin = block * _blockSize;
+        auto blockEnd = blockBegin + _blockSize < end ? blockBegin + _blockSize : end;
+        for (auto i = blockBegin; i < blockEnd; i++) {
+            if (!cursor.next()) return;
+            if (i < id) continue;
+            if (!callback(i, SStringView(cursor.current.data(), cursor.current.size()))) return;
+        }
+        id = blockEnd;
+    }
+}
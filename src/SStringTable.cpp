@@ -0,0 +1,284 @@
+#include <SString/SStringTable.h>
+#include <SString/algorithm.h>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+#ifdef _WIN32
+#pragma warning(disable : 4267)
+#endif
+
+#define TABLE_VERSION 1
+#define FLAG_CHECKSUM 0x1
+#define ALIGN8(n) (((n) + 7) & ~(size_t) 7)
+
+using sstr::SString;
+using sstr::SStringTable;
+using sstr::SStringView;
+
+static const char TableMagic[4] = {'S', 'S', 'T', 'B'};
+
+struct TableHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t flags;
+    uint32_t count;
+    /// 偏移表与数据区的 CRC32
+    uint32_t checksum;
+    /// 数据区字节数（含对齐填充）
+    uint64_t dataSize;
+};
+
+static_assert(sizeof(TableHeader) == 24, "unexpected TableHeader layout");
+
+template<typename T>
+static size_t getDataSize(const std::vector<T> &strings) {
+    size_t size = 0;
+    for (auto &str: strings) {
+        size += str.size() + 1;
+    }
+    return ALIGN8(size);
+}
+
+template<typename T>
+static SString serializeTable(const std::vector<T> &strings, bool checksum) {
+    SString res;
+    auto count = strings.size();
+    // 头部以 32 位记录个数
+    if (count > UINT32_MAX) return res;
+    auto dataSize = getDataSize(strings);
+    auto offsetSize = (count + 1) * sizeof(uint64_t);
+    res.resize(sizeof(TableHeader) + offsetSize + dataSize);
+
+    auto base = res.data();
+    auto offsets = (uint64_t *) (base + sizeof(TableHeader));
+    auto data = base + sizeof(TableHeader) + offsetSize;
+    uint64_t offset = 0;
+    for (size_t i = 0; i < count; i++) {
+        offsets[i] = offset;
+        auto size = strings[i].size();
+        if (size) memcpy(data + offset, strings[i].data(), size);
+        data[offset + size] = '\0';
+        offset += size + 1;
+    }
+    offsets[count] = offset;
+    memset(data + offset, 0, dataSize - offset);
+
+    TableHeader header;
+    memcpy(header.magic, TableMagic, 4);
+    header.version = TABLE_VERSION;
+    header.flags = checksum ? FLAG_CHECKSUM : 0;
+    header.count = (uint32_t) count;
+    header.checksum = checksum ? sstr::CRC32(offsets, offsetSize + dataSize) : 0;
+    header.dataSize = dataSize;
+    memcpy(base, &header, sizeof(header));
+    return res;
+}
+
+template<typename T>
+static bool writeTable(const char *path, const std::vector<T> &strings, bool checksum) {
+    auto count = strings.size();
+    if (count > UINT32_MAX) return false;
+    auto file = fopen(path, "wb");
+    if (nullptr == file) return false;
+
+    auto dataSize = getDataSize(strings);
+    TableHeader header;
+    memcpy(header.magic, TableMagic, 4);
+    header.version = TABLE_VERSION;
+    header.flags = checksum ? FLAG_CHECKSUM : 0;
+    header.count = (uint32_t) count;
+    header.checksum = 0;
+    header.dataSize = dataSize;
+
+    // 偏移表只依赖长度，先整体写出，随后顺序写出数据区，校验和最后回填
+    std::vector<uint64_t> offsets(count + 1);
+    uint64_t offset = 0;
+    for (size_t i = 0; i < count; i++) {
+        offsets[i] = offset;
+        offset += strings[i].size() + 1;
+    }
+    offsets[count] = offset;
+
+    bool ok = 1 == fwrite(&header, sizeof(header), 1, file);
+    ok = ok && offsets.size() == fwrite(offsets.data(), sizeof(uint64_t), offsets.size(), file);
+    uint32_t crc = checksum ? sstr::CRC32(offsets.data(), offsets.size() * sizeof(uint64_t)) : 0;
+
+    const char zeros[8] = {0};
+    for (size_t i = 0; ok && i < count; i++) {
+        auto size = strings[i].size();
+        ok = size == fwrite(strings[i].data(), 1, size, file) && 1 == fwrite(zeros, 1, 1, file);
+        if (checksum) crc = sstr::CRC32(zeros, 1, sstr::CRC32(strings[i].data(), size, crc));
+    }
+    auto padding = dataSize - offset;
+    ok = ok && padding == fwrite(zeros, 1, padding, file);
+    if (checksum) crc = sstr::CRC32(zeros, padding, crc);
+
+    if (ok && checksum) {
+        header.checksum = crc;
+        ok = 0 == fseek(file, 0, SEEK_SET) && 1 == fwrite(&header, sizeof(header), 1, file);
+    }
+    return 0 == fclose(file) && ok;
+}
+
+SStringTable::SStringTable(SStringTable &&table) noexcept {
+    *this = std::move(table);
+}
+
+SStringTable::~SStringTable() {
+    close();
+}
+
+SStringTable &SStringTable::operator=(SStringTable &&table) noexcept {
+    if (this == &table) return *this;
+    close();
+    _base = table._base;
+    _bytes = table._bytes;
+    _offsets = table._offsets;
+    _strings = table._strings;
+    _count = table._count;
+    _flags = table._flags;
+    _buffer = table._buffer;
+    _file = std::move(table._file);
+
+    table._base = nullptr;
+    table._bytes = 0;
+    table._offsets = nullptr;
+    table._strings = nullptr;
+    table._count = 0;
+    table._flags = 0;
+    table._buffer = nullptr;
+    return *this;
+}
+
+SString SStringTable::serialize(const std::vector<SString> &strings, bool checksum) {
+    return serializeTable(strings, checksum);
+}
+
+SString SStringTable::serialize(const std::vector<SStringView> &strings, bool checksum) {
+    return serializeTable(strings, checksum);
+}
+
+bool SStringTable::write(const char *path, const std::vector<SString> &strings, bool checksum) {
+    return writeTable(path, strings, checksum);
+}
+
+bool SStringTable::write(const char *path, const std::vector<SStringView> &strings, bool checksum) {
+    return writeTable(path, strings, checksum);
+}
+
+bool SStringTable::attach(const char *data, size_t size) {
+    if (nullptr == data || size < sizeof(TableHeader)) return false;
+    // 偏移表需要 8 字节对齐访问
+    if (0 != (uintptr_t) data % 8) return false;
+
+    TableHeader header;
+    memcpy(&header, data, sizeof(header));
+    if (0 != memcmp(header.magic, TableMagic, 4) || TABLE_VERSION != header.version) return false;
+
+    auto offsetSize = ((size_t) header.count + 1) * sizeof(uint64_t);
+    if (size - sizeof(TableHeader) < offsetSize) return false;
+    if (size - sizeof(TableHeader) - offsetSize < header.dataSize) return false;
+
+    auto offsets = (const uint64_t *) (data + sizeof(TableHeader));
+    auto strings = data + sizeof(TableHeader) + offsetSize;
+    if (0 != offsets[0] || offsets[header.count] > header.dataSize) return false;
+    // 每项至少包含结尾 '\0'，且 at 返回的视图必须以 '\0' 结尾
+    for (size_t i = 0; i < header.count; i++) {
+        if (offsets[i + 1] <= offsets[i] || '\0' != strings[offsets[i + 1] - 1]) return false;
+    }
+    if ((header.flags & FLAG_CHECKSUM) && header.checksum != CRC32(offsets, offsetSize + header.dataSize)) {
+        return false;
+    }
+
+    _base = data;
+    _bytes = size;
+    _offsets = offsets;
+    _strings = strings;
+    _count = header.count;
+    _flags = header.flags;
+    return true;
+}
+
+bool SStringTable::open(const char *data, size_t size) {
+    close();
+    return attach(data, size);
+}
+
+bool SStringTable::load(const char *path) {
+    close();
+    auto file = fopen(path, "rb");
+    if (nullptr == file) return false;
+
+    bool ok = 0 == fseek(file, 0, SEEK_END);
+    long size = ok ? ftell(file) : -1;
+    ok = size > 0 && 0 == fseek(file, 0, SEEK_SET);
+    char *buffer = nullptr;
+    if (ok) {
+        // malloc 的结果满足 8 字节对齐
+        buffer = (char *) malloc((size_t) size);
+        ok = (size_t) size == fread(buffer, 1, (size_t) size, file);
+    }
+    fclose(file);
+
+    if (ok && attach(buffer, (size_t) size)) {
+        _buffer = buffer;
+        return true;
+    }
+    free(buffer);
+    return false;
+}
+
+bool SStringTable::map(const char *path) {
+    close();
+    if (!_file.open(path)) return false;
+    if (!attach(_file.data(), _file.size())) {
+        _file.close();
+        return false;
+    }
+    return true;
+}
+
+void SStringTable::close() {
+    _file.close();
+    free(_buffer);
+
+    _base = nullptr;
+    _bytes = 0;
+    _offsets = nullptr;
+    _strings = nullptr;
+    _count = 0;
+    _flags = 0;
+    _buffer = nullptr;
+}
+
+size_t SStringTable::size() const {
+    return _count;
+}
+
+bool SStringTable::empty() const {
+    return 0 == _count;
+}
+
+bool SStringTable::checksummed() const {
+    return 0 != (_flags & FLAG_CHECKSUM);
+}
+
+SStringView SStringTable::at(size_t index) const {
+    if (index >= _count) return {};
+    auto begin = _offsets[index];
+    return {_strings + begin, (size_t) (_offsets[index + 1] - begin - 1)};
+}
+
+SStringView SStringTable::operator[](size_t index) const {
+    return at(index);
+}
+
+std::vector<SString> SStringTable::toVector() const {
+    std::vector<SString> v;
+    v.reserve(_count);
+    for (size_t i = 0; i < _count; i++) {
+        auto str = at(i);
+        v.emplace_back(str.data(), str.size());
+    }
+    return v;
+}
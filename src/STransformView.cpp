@@ -0,0 +1,301 @@
+#include <SString/STransformView.h>
+#include <SString/algorithm.h>
+#include <cstring>
+
+using sstr::SChar;
+using sstr::SString;
+using sstr::SStringView;
+using sstr::STransformView;
+
+/// 非法字节以该标记加字节值表示，输出时原样写回
+static const uint32_t RawByte = 0x80000000u;
+
+/// DecodeUTF8 拒绝的序列（含过长编码、代理项与超范围字符）逐字节标记为原始字节
+static inline uint32_t decode(const char *p, const char *end, int &n) {
+    auto ch = sstr::DecodeUTF8(p, end, n);
+    if (0xfffd == ch && 1 == n) return RawByte | (unsigned char) *p;
+    return ch;
+}
+
+static inline SChar toChar(uint32_t ch) {
+    return SChar(ch & RawByte ? 0xfffd : ch);
+}
+
+static inline bool isSpace(uint32_t ch) {
+    if (ch < 0x80) return ' ' == ch || (ch >= 0x09 && ch <= 0x0d);
+    return !(ch & RawByte) && SChar(ch).isSpace();
+}
+
+/// 将字符串解码为字符序列
+static void decodeAll(const SStringView &str, std::vector<uint32_t> &out) {
+    auto p = str.data(), end = p + (str.null() ? 0 : str.size());
+    while (p < end) {
+        int n;
+        out.push_back(decode(p, end, n));
+        p += n;
+    }
+}
+
+namespace sstr {
+
+/// 逐字符推入各步骤的求值过程
+class STransformPipeline {
+public:
+    typedef std::function<bool(uint32_t)> Sink;
+
+    STransformPipeline(const std::vector<STransformView::Step> &steps, size_t first, const Sink &sink)
+        : _steps(steps), _first(first), _sink(sink), _states(steps.size()) {
+        for (size_t i = first; i < steps.size(); i++) {
+            auto &step = steps[i];
+            if (STransformView::Step::Replace != step.type) continue;
+            auto &state = _states[i];
+            decodeAll(step.from, state.pattern);
+            decodeAll(step.to, state.replacement);
+            // KMP 失配表
+            auto &pattern = state.pattern;
+            state.fail.assign(pattern.size(), 0);
+            for (size_t k = 1, j = 0; k < pattern.size(); k++) {
+                while (j && pattern[k] != pattern[j]) j = state.fail[j - 1];
+                if (pattern[k] == pattern[j]) j++;
+                state.fail[k] = j;
+            }
+        }
+    }
+
+    /// 推入一个字符
+    /// \return 之后是否还需要输入
+    bool push(uint32_t ch) {
+        return push(_first, ch);
+    }
+
+    /// 结束输入，输出各步骤中暂存的字符
+    void finish() {
+        finish(_first);
+    }
+
+    /// 将位于最前面的 trim 与 substring 直接作用于源字符串
+    /// \return 第一个需要逐字符处理的步骤，收窄后的范围写入 begin 与 end
+    static size_t narrow(const STransformView &view, const char *&begin, const char *&end);
+
+    /// 遍历源字符串并推入流水线，ASCII 字节不经过解码
+    void run(const char *p, const char *end);
+
+private:
+    struct State {
+        /// Trim：是否已遇到非空白字符
+        bool started = false;
+        /// Substring：已经过的字符数；Replace：已匹配的长度
+        size_t count = 0;
+        /// Trim：尚未确定是否位于尾部的空白
+        std::vector<uint32_t> pending;
+        std::vector<uint32_t> pattern, replacement;
+        std::vector<size_t> fail;
+    };
+
+    bool push(size_t i, uint32_t ch) {
+        if (i == _steps.size()) {
+            if (!_sink(ch)) _stopped = true;
+            return !_stopped;
+        }
+        auto &step = _steps[i];
+        auto &state = _states[i];
+        switch (step.type) {
+            case STransformView::Step::Trim:
+                if (isSpace(ch)) {
+                    if (state.started) state.pending.push_back(ch);
+                    return true;
+                }
+                state.started = true;
+                for (auto space: state.pending) {
+                    if (!push(i + 1, space)) return false;
+                }
+                state.pending.clear();
+                return push(i + 1, ch);
+            case STransformView::Step::Lower:
+                return push(i + 1, ch - 'A' < 26u ? ch + 32 : ch);
+            case STransformView::Step::Upper:
+                return push(i + 1, ch - 'a' < 26u ? ch - 32 : ch);
+            case STransformView::Step::Substring: {
+                auto index = state.count++;
+                if (index < step.begin) return true;
+                // 取满后不再需要输入
+                return index - step.begin < step.len && push(i + 1, ch) && index - step.begin + 1 < step.len;
+            }
+            case STransformView::Step::Replace: {
+                auto &pattern = state.pattern;
+                auto &j = state.count;
+                while (j && pattern[j] != ch) {
+                    // 失配后不再可能参与匹配的前缀部分原样输出
+                    auto keep = state.fail[j - 1];
+                    for (size_t k = 0; k < j - keep; k++) {
+                        if (!push(i + 1, pattern[k])) return false;
+                    }
+                    j = keep;
+                }
+                if (pattern[j] != ch) return push(i + 1, ch);
+                if (++j < pattern.size()) return true;
+                j = 0;
+                for (auto to: state.replacement) {
+                    if (!push(i + 1, to)) return false;
+                }
+                return true;
+            }
+            case STransformView::Step::Filter:
+                return !step.predicate(toChar(ch)) || push(i + 1, ch);
+        }
+        return true;
+    }
+
+    void finish(size_t i) {
+        // 已取满的 substring 之后的步骤仍需输出暂存的字符，向其之前的步骤推入时直接返回 false
+        for (; i < _steps.size() && !_stopped; i++) {
+            auto &state = _states[i];
+            if (STransformView::Step::Replace != _steps[i].type || !state.count) continue;
+            // 未完成的匹配原样输出
+            auto count = state.count;
+            state.count = 0;
+            for (size_t k = 0; k < count && push(i + 1, state.pattern[k]); k++) {}
+        }
+    }
+
+    const std::vector<STransformView::Step> &_steps;
+    size_t _first;
+    const Sink &_sink;
+    std::vector<State> _states;
+    /// 输出端是否已要求停止
+    bool _stopped = false;
+};
+
+}// namespace sstr
+
+using sstr::STransformPipeline;
+
+size_t STransformPipeline::narrow(const STransformView &transform, const char *&begin, const char *&end) {
+    auto &source = transform._source;
+    auto &steps = transform._steps;
+    auto view = source.null() ? SStringView("", 0) : source;
+    size_t i = 0;
+    for (; i < steps.size(); i++) {
+        auto &step = steps[i];
+        if (STransformView::Step::Trim == step.type) {
+            view = view.trim();
+        } else if (STransformView::Step::Substring == step.type) {
+            auto p = view.data(), last = p + view.size();
+            for (size_t k = 0; k < step.begin && p < last; k++) {
+                int n;
+                decode(p, last, n);
+                p += n;
+            }
+            auto q = p;
+            for (size_t k = 0; k < step.len && q < last; k++) {
+                int n;
+                decode(q, last, n);
+                q += n;
+            }
+            view = SStringView(p, q - p);
+        } else {
+            break;
+        }
+    }
+    begin = view.data();
+    end = begin + view.size();
+    return i;
+}
+
+void STransformPipeline::run(const char *p, const char *end) {
+    while (p < end) {
+        int n = 1;
+        uint32_t ch = (unsigned char) *p;
+        if (ch >= 0x80) ch = decode(p, end, n);
+        p += n;
+        if (!push(ch)) break;
+    }
+    finish();
+}
+
+STransformView::STransformView(const SStringView &source) noexcept : _source(source) {}
+
+STransformView STransformView::append(Step step) const {
+    STransformView res(*this);
+    res._steps.push_back(std::move(step));
+    return res;
+}
+
+STransformView STransformView::trim() const {
+    return append(Step{Step::Trim, 0, 0, {}, {}, nullptr});
+}
+
+STransformView STransformView::toLower() const {
+    return append(Step{Step::Lower, 0, 0, {}, {}, nullptr});
+}
+
+STransformView STransformView::toUpper() const {
+    return append(Step{Step::Upper, 0, 0, {}, {}, nullptr});
+}
+
+STransformView STransformView::substring(size_t begin, size_t len) const {
+    return append(Step{Step::Substring, begin, len, {}, {}, nullptr});
+}
+
+STransformView STransformView::replace(const SStringView &from, const SStringView &to) const {
+    if (from.null() || from.empty()) return *this;
+    return append(Step{Step::Replace, 0, 0, from, to, nullptr});
+}
+
+STransformView STransformView::filter(const std::function<bool(SChar)> &predicate) const {
+    return append(Step{Step::Filter, 0, 0, {}, {}, predicate});
+}
+
+void STransformView::forEach(const std::function<bool(SChar)> &callback) const {
+    const char *begin, *end;
+    auto first = STransformPipeline::narrow(*this, begin, end);
+    STransformPipeline::Sink sink = [&callback](uint32_t ch) { return callback(toChar(ch)); };
+    STransformPipeline pipeline(_steps, first, sink);
+    pipeline.run(begin, end);
+}
+
+SString STransformView::materialize() const {
+    SString res;
+    materialize(res);
+    return res;
+}
+
+void STransformView::materialize(SString &out) const {
+    const char *begin, *end;
+    auto first = STransformPipeline::narrow(*this, begin, end);
+    out.resize(0);
+    if (first == _steps.size()) {
+        out.resize(end - begin);
+        if (end != begin) memcpy(out.data(), begin, end - begin);
+        return;
+    }
+    // 直接写入 out 的缓冲区，容量不足时按倍数扩展
+    out.reserve(end - begin);
+    size_t size = 0, cap = out.cap() - 1;
+    auto dst = out.data();
+    STransformPipeline::Sink sink = [&](uint32_t ch) {
+        if (size + 4 > cap) {
+            out.resize(size);
+            out.reserve(cap * 2 + 4);
+            cap = out.cap() - 1;
+            dst = out.data();
+        }
+        if (ch & RawByte) {
+            dst[size++] = (char) ch;
+        } else if (ch < 0x80) {
+            dst[size++] = (char) ch;
+        } else {
+            auto written = sstr::putUTF8FromUnicodeChar(SChar(ch), dst + size);
+            if (written < 0) written = sstr::putUTF8FromUnicodeChar(SChar(0xfffd), dst + size);
+            size += written;
+        }
+        return true;
+    };
+    STransformPipeline pipeline(_steps, first, sink);
+    pipeline.run(begin, end);
+    out.resize(size);
+}
+
+const SStringView &STransformView::source() const {
+    return _source;
+}
@@ -131,4 +131,160 @@ int sstr::BM(const uint32_t *str, size_t size, std::vector<SChar> &sub) {
 int sstr::NORMAL(const char *str, const char *sub) {
     auto p = strstr(str, sub);
     return p ? (int) (p - str) : -1;
-}
\ No newline at end of file
+}
+
+int64_t sstr::FindBytes(const char *str, size_t size, const char *sub, size_t subSize) {
+    if (0 == subSize) return 0;
+    if (subSize > size) return -1;
+    auto first = sub[0];
+    auto last = size - subSize;
+    size_t i = 0;
+    while (i <= last) {
+        auto p = (const char *) memchr(str + i, first, last - i + 1);
+        if (nullptr == p) return -1;
+        i = p - str;
+        if (0 == memcmp(p + 1, sub + 1, subSize - 1)) return (int64_t) i;
+        i++;
+    }
+    return -1;
+}
+
+size_t sstr::CountUTF8Chars(const char *str, size_t size) {
+    size_t count = 0;
+    size_t i = 0;
+#ifdef SSTR_SSE2
+    // 续字节 0x80~0xBF 作为有符号数落在 [-128, -65]
+    const __m128i limit = _mm_set1_epi8(-65);
+    for (; i + 16 <= size; i += 16) {
+        auto x = _mm_loadu_si128((const __m128i *) (str + i));
+        count += PopCount((uint32_t) _mm_movemask_epi8(_mm_cmpgt_epi8(x, limit)));
+    }
+#endif
+    for (; i < size; i++) {
+        if ((str[i] & 0b11000000) != 0b10000000) count++;
+    }
+    return count;
+}
+
+struct CRC32Table {
+    uint32_t data[256];
+
+    CRC32Table() {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) {
+                c = c & 1 ? 0xedb88320u ^ (c >> 1) : c >> 1;
+            }
+            data[i] = c;
+        }
+    }
+};
+
+static const uint32_t *getCRC32Table() {
+    static const CRC32Table table;
+    return table.data;
+}
+
+uint32_t sstr::CRC32(const void *data, size_t size, uint32_t crc) {
+    auto table = getCRC32Table();
+    auto p = (const unsigned char *) data;
+    crc = ~crc;
+    for (size_t i = 0; i < size; i++) {
+        crc = table[(crc ^ p[i]) & 0xff] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+static inline bool isDigit(uint8_t ch) {
+    return (unsigned) (ch - '0') < 10u;
+}
+
+/// 非数字字节的排序值，数字段整体排在 '/' 与 ':' 之间，0 留作键的分隔符
+static inline uint8_t getNaturalRank(uint8_t ch) {
+    return ch < '0' ? ch + 1 : ch;
+}
+
+static const uint8_t NaturalDigitRank = '0' + 1;
+
+int sstr::CompareNatural(const char *a, size_t aSize, const char *b, size_t bSize) {
+    auto p = (const uint8_t *) a, q = (const uint8_t *) b;
+    auto pEnd = p + aSize, qEnd = q + bSize;
+    // 数值相等时，第一个前导零个数不同的数字段决定先后
+    int tie = 0;
+    while (p < pEnd && q < qEnd) {
+        if (!isDigit(*p) || !isDigit(*q)) {
+            auto x = isDigit(*p) ? NaturalDigitRank : getNaturalRank(*p);
+            auto y = isDigit(*q) ? NaturalDigitRank : getNaturalRank(*q);
+            if (x != y) return x < y ? -1 : 1;
+            p++, q++;
+            continue;
+        }
+        auto pRun = p, qRun = q;
+        while (p < pEnd && '0' == *p) p++;
+        while (q < qEnd && '0' == *q) q++;
+        auto pZeros = p - pRun, qZeros = q - qRun;
+        auto pDigits = p, qDigits = q;
+        while (p < pEnd && isDigit(*p)) p++;
+        while (q < qEnd && isDigit(*q)) q++;
+        auto pLength = p - pDigits, qLength = q - qDigits;
+        if (pLength != qLength) return pLength < qLength ? -1 : 1;
+        if (pLength) {
+            auto res = memcmp(pDigits, qDigits, pLength);
+            if (res) return res < 0 ? -1 : 1;
+        }
+        if (!tie && pZeros != qZeros) tie = pZeros < qZeros ? -1 : 1;
+    }
+    if (p < pEnd) return 1;
+    if (q < qEnd) return -1;
+    return tie;
+}
+
+/// 写入保序的变长整数：小于 255 的值占 1 字节，否则为 0xff 后接 8 字节大端
+static inline uint8_t *putNaturalLength(uint8_t *dst, uint64_t value) {
+    if (value < 0xff) {
+        *dst++ = (uint8_t) value;
+        return dst;
+    }
+    *dst++ = 0xff;
+    for (int shift = 56; shift >= 0; shift -= 8) *dst++ = (uint8_t) (value >> shift);
+    return dst;
+}
+
+size_t sstr::NaturalSortKey(const char *str, size_t size, char *key) {
+    auto p = (const uint8_t *) str, end = p + size;
+    auto dst = (uint8_t *) key;
+    size_t runs = 0, zeroRuns = 0;
+    while (p < end) {
+        if (!isDigit(*p)) {
+            *dst++ = getNaturalRank(*p++);
+            continue;
+        }
+        auto run = p;
+        while (p < end && '0' == *p) p++;
+        auto digits = p;
+        while (p < end && isDigit(*p)) p++;
+        size_t zeros = digits - run, length = p - digits;
+        // 数字段：标记、有效位数、每字节两位的有效数字
+        *dst++ = NaturalDigitRank;
+        dst = putNaturalLength(dst, length);
+        for (size_t i = 0; i < length; i += 2) {
+            auto high = digits[i] - '0';
+            auto low = i + 1 < length ? digits[i + 1] - '0' : 0;
+            *dst++ = (uint8_t) (high << 4 | low);
+        }
+        runs++;
+        if (zeros) zeroRuns = runs;
+    }
+    if (!zeroRuns) return dst - (uint8_t *) key;
+    // 有前导零时追加分隔符与各数字段的前导零个数（省略末尾的 0），数值相等时少者在前
+    *dst++ = 0;
+    p = (const uint8_t *) str;
+    for (size_t i = 0; i < zeroRuns; i++) {
+        while (!isDigit(*p)) p++;
+        auto run = p;
+        while (p < end && '0' == *p) p++;
+        dst = putNaturalLength(dst, p - run);
+        while (p < end && isDigit(*p)) p++;
+    }
+    return dst - (uint8_t *) key;
+}
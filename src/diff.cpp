@@ -0,0 +1,281 @@
+#include <SString/diff.h>
+#include <SString/algorithm.h>
+#include <cstring>
+#include <unordered_map>
+
+using sstr::SDiffUnit;
+using sstr::SEdit;
+using sstr::SString;
+using sstr::SStringBuilder;
+using sstr::SStringView;
+
+/// 一段码点序列
+struct Sequence {
+    const uint32_t *data = nullptr;
+    size_t size = 0;
+    /// 解码 SStringView 时的存储
+    std::vector<uint32_t> storage;
+
+    explicit Sequence(const SStringView &str) {
+        auto p = str.data(), end = p + (str.null() ? 0 : str.size());
+        storage.reserve(end - p);
+        while (p < end) {
+            int n;
+            storage.push_back(sstr::DecodeUTF8(p, end, n));
+            p += n;
+        }
+        data = storage.data();
+        size = storage.size();
+    }
+
+    explicit Sequence(const SStringBuilder &builder) : data(builder.data()), size(builder.size()) {}
+};
+
+/// 差异区间：a 中 [aBegin, aEnd) 对应 b 中 [bBegin, bEnd)
+struct Hunk {
+    size_t aBegin, aEnd, bBegin, bEnd;
+};
+
+/// Myers 差异，比较两个编号序列
+class Differ {
+public:
+    Differ(const uint32_t *a, size_t n, const uint32_t *b, size_t m) : _a(a), _b(b) {
+        // 各层二分依次进行，共用同一块工作区
+        _work.resize(2 * (n + m + 2));
+        compare(0, n, 0, m);
+    }
+
+    std::vector<Hunk> &hunks() {
+        return _hunks;
+    }
+
+private:
+    void emit(size_t aBegin, size_t aEnd, size_t bBegin, size_t bEnd) {
+        if (aBegin == aEnd && bBegin == bEnd) return;
+        // 与上一处相连时合并
+        if (!_hunks.empty() && _hunks.back().aEnd == aBegin && _hunks.back().bEnd == bBegin) {
+            _hunks.back().aEnd = aEnd;
+            _hunks.back().bEnd = bEnd;
+            return;
+        }
+        _hunks.push_back({aBegin, aEnd, bBegin, bEnd});
+    }
+
+    void compare(size_t aBegin, size_t aEnd, size_t bBegin, size_t bEnd) {
+        // 去除公共前缀与后缀
+        while (aBegin < aEnd && bBegin < bEnd && _a[aBegin] == _b[bBegin]) aBegin++, bBegin++;
+        while (aBegin < aEnd && bBegin < bEnd && _a[aEnd - 1] == _b[bEnd - 1]) aEnd--, bEnd--;
+        if (aBegin == aEnd || bBegin == bEnd) {
+            emit(aBegin, aEnd, bBegin, bEnd);
+            return;
+        }
+        size_t x, y;
+        if (!bisect(aBegin, aEnd, bBegin, bEnd, x, y)) {
+            emit(aBegin, aEnd, bBegin, bEnd);
+            return;
+        }
+        compare(aBegin, x, bBegin, y);
+        compare(x, aEnd, y, bEnd);
+    }
+
+    /// 同时从两端搜索，找到路径重叠处作为二分点
+    /// \return 是否找到，两段完全不同时返回 false
+    bool bisect(size_t aBegin, size_t aEnd, size_t bBegin, size_t bEnd, size_t &splitA, size_t &splitB) {
+        auto a = _a + aBegin, b = _b + bBegin;
+        auto n = (ptrdiff_t) (aEnd - aBegin), m = (ptrdiff_t) (bEnd - bBegin);
+        auto maxD = (n + m + 1) / 2;
+        auto offset = maxD, length = 2 * maxD;
+        auto v1 = _work.data(), v2 = _work.data() + length;
+        for (ptrdiff_t i = 0; i < length; i++) v1[i] = v2[i] = -1;
+        v1[offset + 1] = 0;
+        v2[offset + 1] = 0;
+        auto delta = n - m;
+        // 差为奇数时前向路径先与反向路径相遇
+        bool front = 0 != delta % 2;
+        ptrdiff_t k1Start = 0, k1End = 0, k2Start = 0, k2End = 0;
+        for (ptrdiff_t d = 0; d < maxD; d++) {
+            for (auto k1 = -d + k1Start; k1 <= d - k1End; k1 += 2) {
+                auto k1Offset = offset + k1;
+                ptrdiff_t x1;
+                if (k1 == -d || (k1 != d && v1[k1Offset - 1] < v1[k1Offset + 1])) {
+                    x1 = v1[k1Offset + 1];
+                } else {
+                    x1 = v1[k1Offset - 1] + 1;
+                }
+                auto y1 = x1 - k1;
+                while (x1 < n && y1 < m && a[x1] == b[y1]) x1++, y1++;
+                v1[k1Offset] = x1;
+                if (x1 > n) {
+                    k1End += 2;
+                } else if (y1 > m) {
+                    k1Start += 2;
+                } else if (front) {
+                    auto k2Offset = offset + delta - k1;
+                    if (k2Offset >= 0 && k2Offset < length && -1 != v2[k2Offset] && x1 >= n - v2[k2Offset]) {
+                        splitA = aBegin + x1;
+                        splitB = bBegin + y1;
+                        return true;
+                    }
+                }
+            }
+            for (auto k2 = -d + k2Start; k2 <= d - k2End; k2 += 2) {
+                auto k2Offset = offset + k2;
+                ptrdiff_t x2;
+                if (k2 == -d || (k2 != d && v2[k2Offset - 1] < v2[k2Offset + 1])) {
+                    x2 = v2[k2Offset + 1];
+                } else {
+                    x2 = v2[k2Offset - 1] + 1;
+                }
+                auto y2 = x2 - k2;
+                while (x2 < n && y2 < m && a[n - x2 - 1] == b[m - y2 - 1]) x2++, y2++;
+                v2[k2Offset] = x2;
+                if (x2 > n) {
+                    k2End += 2;
+                } else if (y2 > m) {
+                    k2Start += 2;
+                } else if (!front) {
+                    auto k1Offset = offset + delta - k2;
+                    if (k1Offset >= 0 && k1Offset < length && -1 != v1[k1Offset]) {
+                        auto x1 = v1[k1Offset];
+                        if (x1 >= n - x2) {
+                            splitA = aBegin + x1;
+                            splitB = bBegin + (x1 - (k1Offset - offset));
+                            return true;
+                        }
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+    const uint32_t *_a;
+    const uint32_t *_b;
+    std::vector<ptrdiff_t> _work;
+    std::vector<Hunk> _hunks;
+};
+
+/// 将两段文本的行映射为编号，内容相同的行编号相同
+/// \param starts 输出每行起始的字符索引，末尾另加总字符数
+static void mapLines(const Sequence &seq, std::unordered_multimap<uint64_t, uint32_t> &table,
+                     std::vector<std::pair<const uint32_t *, size_t>> &lines,
+                     std::vector<uint32_t> &ids, std::vector<size_t> &starts) {
+    for (size_t begin = 0; begin < seq.size;) {
+        auto end = begin;
+        while (end < seq.size && '\n' != seq.data[end]) end++;
+        if (end < seq.size) end++;
+        auto line = seq.data + begin;
+        auto size = end - begin;
+        auto hash = sstr::getHashFromBytes((const char *) line, size * sizeof(uint32_t));
+        uint32_t id = UINT32_MAX;
+        auto range = table.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            auto &other = lines[it->second];
+            if (other.second == size && 0 == memcmp(other.first, line, size * sizeof(uint32_t))) {
+                id = it->second;
+                break;
+            }
+        }
+        if (UINT32_MAX == id) {
+            id = (uint32_t) lines.size();
+            lines.emplace_back(line, size);
+            table.emplace(hash, id);
+        }
+        ids.push_back(id);
+        starts.push_back(begin);
+        begin = end;
+    }
+    starts.push_back(seq.size);
+}
+
+static void putText(const uint32_t *data, size_t size, SString &out) {
+    out.resize(size * 4);
+    auto dst = out.data();
+    size_t n = 0;
+    for (size_t i = 0; i < size; i++) {
+        auto written = sstr::putUTF8FromUnicodeChar(sstr::SChar(data[i]), dst + n);
+        if (written > 0) n += written;
+    }
+    out.resize(n);
+}
+
+static std::vector<SEdit> diffSequences(const Sequence &from, const Sequence &to, SDiffUnit unit) {
+    std::vector<SEdit> res;
+    std::vector<Hunk> hunks;
+    if (SDiffUnit::Line == unit) {
+        std::unordered_multimap<uint64_t, uint32_t> table;
+        std::vector<std::pair<const uint32_t *, size_t>> lines;
+        std::vector<uint32_t> a, b;
+        std::vector<size_t> aStarts, bStarts;
+        mapLines(from, table, lines, a, aStarts);
+        mapLines(to, table, lines, b, bStarts);
+        Differ differ(a.data(), a.size(), b.data(), b.size());
+        hunks.swap(differ.hunks());
+        // 行索引换算为字符索引
+        for (auto &hunk: hunks) {
+            hunk = {aStarts[hunk.aBegin], aStarts[hunk.aEnd], bStarts[hunk.bBegin], bStarts[hunk.bEnd]};
+        }
+    } else {
+        Differ differ(from.data, from.size, to.data, to.size);
+        hunks.swap(differ.hunks());
+    }
+    res.resize(hunks.size());
+    for (size_t i = 0; i < hunks.size(); i++) {
+        auto &hunk = hunks[i];
+        res[i].begin = hunk.aBegin;
+        res[i].len = hunk.aEnd - hunk.aBegin;
+        putText(to.data + hunk.bBegin, hunk.bEnd - hunk.bBegin, res[i].text);
+    }
+    return res;
+}
+
+std::vector<SEdit> sstr::getDiff(const SStringView &from, const SStringView &to, SDiffUnit unit) {
+    return diffSequences(Sequence(from), Sequence(to), unit);
+}
+
+std::vector<SEdit> sstr::getDiff(const SStringView &from, const SStringBuilder &to, SDiffUnit unit) {
+    return diffSequences(Sequence(from), Sequence(to), unit);
+}
+
+std::vector<SEdit> sstr::getDiff(const SStringBuilder &from, const SStringBuilder &to, SDiffUnit unit) {
+    return diffSequences(Sequence(from), Sequence(to), unit);
+}
+
+void sstr::applyDiff(SStringBuilder &builder, const std::vector<SEdit> &edits) {
+    // 从后向前应用，前面编辑的索引不受影响
+    for (auto it = edits.rbegin(); it != edits.rend(); ++it) {
+        if (it->begin >= builder.size()) {
+            builder.append(it->text);
+        } else {
+            builder.replace(it->begin, it->len, it->text);
+        }
+    }
+}
+
+SString sstr::applyDiff(const SStringView &str, const std::vector<SEdit> &edits) {
+    SString res;
+    auto p = str.data(), end = p + (str.null() ? 0 : str.size());
+    res.reserve(end - p);
+    auto copied = p;
+    size_t index = 0;
+    // 跳过 count 个字符
+    auto skip = [&](size_t count) {
+        for (; index < count && p < end; index++) {
+            int n;
+            DecodeUTF8(p, end, n);
+            p += n;
+        }
+    };
+    auto put = [&res](const char *data, size_t size) {
+        if (size) res += SStringView(data, size);
+    };
+    for (auto &edit: edits) {
+        skip(edit.begin);
+        put(copied, p - copied);
+        put(edit.text.data(), edit.text.size());
+        skip(edit.begin + edit.len);
+        copied = p;
+    }
+    put(copied, end - copied);
+    return res;
+}
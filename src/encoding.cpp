@@ -0,0 +1,261 @@
+#include <SString/encoding.h>
+#include <cstring>
+#ifdef _WIN32
+#pragma warning(disable : 4267)
+#endif
+
+using sstr::SString;
+using sstr::SStringView;
+
+#define INVALID_BITS 0x01000000u
+
+static const char *const Base64Alphabets[2] = {
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/",
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_",
+};
+
+/// 编解码查找表
+/// \note 编码时一次查表得到 12 bit 对应的两个字符；
+///       解码时四个表预先移位，四个字符按位或即得 24 bit，非法字符会置位 INVALID_BITS
+struct CodecTables {
+    char base64Pair[2][4096][2];
+    uint32_t base64Decode[2][4][256];
+    char hexPair[2][256][2];
+    int8_t hexValue[256];
+
+    CodecTables() {
+        for (int a = 0; a < 2; a++) {
+            auto alphabet = Base64Alphabets[a];
+            for (int i = 0; i < 4096; i++) {
+                base64Pair[a][i][0] = alphabet[i >> 6];
+                base64Pair[a][i][1] = alphabet[i & 0x3f];
+            }
+            for (int k = 0; k < 4; k++) {
+                for (int ch = 0; ch < 256; ch++) {
+                    base64Decode[a][k][ch] = INVALID_BITS;
+                }
+                for (uint32_t v = 0; v < 64; v++) {
+                    base64Decode[a][k][(unsigned char) alphabet[v]] = v << (18 - 6 * k);
+                }
+            }
+        }
+
+        const char *digits[2] = {"0123456789abcdef", "0123456789ABCDEF"};
+        for (int u = 0; u < 2; u++) {
+            for (int ch = 0; ch < 256; ch++) {
+                hexPair[u][ch][0] = digits[u][ch >> 4];
+                hexPair[u][ch][1] = digits[u][ch & 0xf];
+            }
+        }
+        for (int ch = 0; ch < 256; ch++) {
+            hexValue[ch] = -1;
+        }
+        for (int v = 0; v < 16; v++) {
+            hexValue[(unsigned char) digits[0][v]] = (int8_t) v;
+            hexValue[(unsigned char) digits[1][v]] = (int8_t) v;
+        }
+    }
+};
+
+static const CodecTables &getTables() {
+    static const CodecTables tables;
+    return tables;
+}
+
+static inline bool isSpace(char ch) {
+    return ' ' == ch || '\t' == ch || '\n' == ch || '\r' == ch || '\f' == ch || '\v' == ch;
+}
+
+static SString encodeBase64(const SStringView &data, int alphabet, bool padding) {
+    SString res;
+    if (data.null()) return res;
+    auto &pair = getTables().base64Pair[alphabet];
+    auto src = (const unsigned char *) data.data();
+    auto size = data.size();
+    res.resize(sstr::getBase64EncodedSize(size, padding));
+    auto dst = res.data();
+
+    size_t i = 0;
+    for (; i + 3 <= size; i += 3) {
+        uint32_t x = (uint32_t) src[i] << 16 | (uint32_t) src[i + 1] << 8 | src[i + 2];
+        memcpy(dst, pair[x >> 12], 2);
+        memcpy(dst + 2, pair[x & 0xfff], 2);
+        dst += 4;
+    }
+
+    auto chars = Base64Alphabets[alphabet];
+    auto rest = size - i;
+    if (1 == rest) {
+        uint32_t x = (uint32_t) src[i] << 16;
+        *dst++ = chars[x >> 18];
+        *dst++ = chars[x >> 12 & 0x3f];
+        if (padding) {
+            *dst++ = '=';
+            *dst++ = '=';
+        }
+    } else if (2 == rest) {
+        uint32_t x = (uint32_t) src[i] << 16 | (uint32_t) src[i + 1] << 8;
+        *dst++ = chars[x >> 18];
+        *dst++ = chars[x >> 12 & 0x3f];
+        *dst++ = chars[x >> 6 & 0x3f];
+        if (padding) *dst++ = '=';
+    }
+    return res;
+}
+
+/// Base64 解码
+/// \param src 编码字节串
+/// \param size 编码字节数
+/// \param dst 写入位置
+/// \param alphabet 字母表索引
+/// \return 解码后字节数，失败返回 -1
+static int64_t decodeBase64(const char *src, size_t size, char *dst, int alphabet) {
+    auto &table = getTables().base64Decode[alphabet];
+    auto begin = dst;
+    auto p = (const unsigned char *) src;
+    uint32_t quad = 0;
+    int count = 0;
+    size_t i = 0;
+    while (i < size) {
+        // 无空白与填充的连续段按 4 字符一组直接查表
+        if (0 == count) {
+            for (; i + 4 <= size; i += 4) {
+                auto x = table[0][p[i]] | table[1][p[i + 1]] | table[2][p[i + 2]] | table[3][p[i + 3]];
+                if (x & INVALID_BITS) break;
+                dst[0] = (char) (x >> 16);
+                dst[1] = (char) (x >> 8);
+                dst[2] = (char) x;
+                dst += 3;
+            }
+            if (i == size) break;
+        }
+
+        auto ch = src[i++];
+        if (isSpace(ch)) continue;
+        if ('=' == ch) {
+            if (count < 2) return -1;
+            // 填充之后只允许 '=' 与空白
+            for (; i < size; i++) {
+                if ('=' != src[i] && !isSpace(src[i])) return -1;
+            }
+            break;
+        }
+        auto v = table[3][p[i - 1]];
+        if (v & INVALID_BITS) return -1;
+        quad = quad << 6 | v;
+        if (4 == ++count) {
+            dst[0] = (char) (quad >> 16);
+            dst[1] = (char) (quad >> 8);
+            dst[2] = (char) quad;
+            dst += 3;
+            quad = 0;
+            count = 0;
+        }
+    }
+
+    if (1 == count) return -1;
+    if (2 == count) {
+        *dst++ = (char) (quad >> 4);
+    } else if (3 == count) {
+        *dst++ = (char) (quad >> 10);
+        *dst++ = (char) (quad >> 2);
+    }
+    return dst - begin;
+}
+
+static bool decodeBase64To(const SStringView &str, SString &out, int alphabet) {
+    if (str.null()) {
+        out.resize(0);
+        return true;
+    }
+    // 先按上界分配，解码后收缩
+    out.resize(str.size() / 4 * 3 + 3);
+    auto n = decodeBase64(str.data(), str.size(), out.data(), alphabet);
+    if (-1 == n) return false;
+    out.resize((size_t) n);
+    return true;
+}
+
+size_t sstr::getBase64EncodedSize(size_t size, bool padding) {
+    if (padding) return (size + 2) / 3 * 4;
+    return size / 3 * 4 + (size % 3 ? size % 3 + 1 : 0);
+}
+
+size_t sstr::getBase64DecodedSize(const SStringView &str) {
+    if (str.null()) return 0;
+    auto p = str.data();
+    auto size = str.size();
+    while (size > 0 && ('=' == p[size - 1] || isSpace(p[size - 1]))) size--;
+    return size / 4 * 3 + (size % 4 ? size % 4 - 1 : 0);
+}
+
+SString sstr::base64Encode(const SStringView &data) {
+    return encodeBase64(data, 0, true);
+}
+
+SString sstr::base64UrlEncode(const SStringView &data) {
+    return encodeBase64(data, 1, false);
+}
+
+bool sstr::base64Decode(const SStringView &str, SString &out) {
+    return decodeBase64To(str, out, 0);
+}
+
+bool sstr::base64UrlDecode(const SStringView &str, SString &out) {
+    return decodeBase64To(str, out, 1);
+}
+
+SString sstr::hexEncode(const SStringView &data, bool upper) {
+    SString res;
+    if (data.null()) return res;
+    auto &pair = getTables().hexPair[upper ? 1 : 0];
+    auto src = (const unsigned char *) data.data();
+    auto size = data.size();
+    res.resize(size * 2);
+    auto dst = res.data();
+    for (size_t i = 0; i < size; i++) {
+        memcpy(dst + i * 2, pair[src[i]], 2);
+    }
+    return res;
+}
+
+bool sstr::hexDecode(const SStringView &str, SString &out) {
+    if (str.null()) {
+        out.resize(0);
+        return true;
+    }
+    auto &value = getTables().hexValue;
+    auto p = (const unsigned char *) str.data();
+    auto size = str.size();
+    out.resize(size / 2);
+    auto dst = out.data();
+
+    size_t i = 0;
+    int high = -1;
+    while (i < size) {
+        if (-1 == high) {
+            for (; i + 2 <= size; i += 2) {
+                auto hi = value[p[i]];
+                auto lo = value[p[i + 1]];
+                if ((hi | lo) < 0) break;
+                *dst++ = (char) (hi << 4 | lo);
+            }
+            if (i == size) break;
+        }
+
+        auto ch = (char) p[i];
+        auto v = value[p[i++]];
+        if (isSpace(ch)) continue;
+        if (v < 0) return false;
+        if (-1 == high) {
+            high = v;
+        } else {
+            *dst++ = (char) (high << 4 | v);
+            high = -1;
+        }
+    }
+    if (-1 != high) return false;
+
+    out.resize(dst - out.data());
+    return true;
+}
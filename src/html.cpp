@@ -0,0 +1,367 @@
+#include <SString/html.h>
+#include <SString/algorithm.h>
+#include <cstring>
+#include <utility>
+#ifdef _WIN32
+#pragma warning(disable : 4267)
+#endif
+
+using sstr::SChar;
+using sstr::SString;
+using sstr::SStringView;
+
+#define ENTITY_BUCKETS 128
+#define ENTITY_SLOTS 512
+#define ENTITY_MAX_NAME 8
+
+struct Entity {
+    const char *name;
+    uint32_t code;
+};
+
+#pragma region EntityTable
+
+// HTML 4.01 的 252 个命名实体加上 XML 的 apos，以 hash-and-displace 方式构建的完美哈希表：
+// 第一次哈希（种子 0）选桶，桶内位移作为第二次哈希的种子得到槽位，任意两个实体不会落入同一槽位
+
+static const uint16_t EntityDisplacement[128] = {
+        1, 0, 2, 0, 1, 4, 1, 3, 1, 4, 1, 1, 1, 1, 1, 1,
+        3, 0, 2, 3, 2, 2, 1, 2, 1, 4, 1, 1, 3, 1, 2, 4,
+        5, 2, 1, 2, 2, 0, 1, 1, 1, 1, 1, 7, 2, 1, 1, 2,
+        1, 1, 3, 1, 1, 4, 0, 3, 0, 0, 2, 1, 1, 1, 6, 3,
+        1, 1, 1, 1, 1, 3, 1, 1, 4, 1, 5, 3, 1, 2, 1, 2,
+        6, 4, 2, 5, 0, 1, 3, 1, 1, 1, 2, 4, 0, 1, 1, 1,
+        0, 0, 0, 1, 3, 5, 1, 1, 3, 2, 1, 0, 0, 2, 1, 0,
+        2, 0, 3, 1, 4, 2, 2, 5, 2, 0, 6, 0, 3, 2, 3, 0,
+};
+
+static const Entity EntityTable[512] = {
+        {"euml", 235}, {"Uacute", 218}, {"lowast", 8727}, {nullptr, 0},
+        {"there4", 8756}, {nullptr, 0}, {"ndash", 8211}, {nullptr, 0},
+        {nullptr, 0}, {nullptr, 0}, {nullptr, 0}, {nullptr, 0},
+        {nullptr, 0}, {"Tau", 932}, {nullptr, 0}, {"frac12", 189},
+        {"frasl", 8260}, {"Mu", 924}, {nullptr, 0}, {"brvbar", 166},
+        {nullptr, 0}, {nullptr, 0}, {"Epsilon", 917}, {nullptr, 0},
+        {nullptr, 0}, {"Chi", 935}, {"fnof", 402}, {"reg", 174},
+        {"zeta", 950}, {"nsub", 8836}, {nullptr, 0}, {"harr", 8596},
+        {"lsquo", 8216}, {"Aring", 197}, {nullptr, 0}, {nullptr, 0},
+        {"plusmn", 177}, {nullptr, 0}, {"sim", 8764}, {"atilde", 227},
+        {"oplus", 8853}, {"lrm", 8206}, {nullptr, 0}, {"sup3", 179},
+        {nullptr, 0}, {"Ouml", 214}, {nullptr, 0}, {nullptr, 0},
+        {"emsp", 8195}, {"ordf", 170}, {"Delta", 916}, {"igrave", 236},
+        {"dArr", 8659}, {nullptr, 0}, {"oslash", 248}, {nullptr, 0},
+        {nullptr, 0}, {"sigmaf", 962}, {"sup", 8835}, {"pound", 163},
+        {"Euml", 203}, {"rsaquo", 8250}, {"weierp", 8472}, {nullptr, 0},
+        {"Egrave", 200}, {nullptr, 0}, {"Ecirc", 202}, {"rfloor", 8971},
+        {nullptr, 0}, {"rlm", 8207}, {"Upsilon", 933}, {"Atilde", 195},
+        {"raquo", 187}, {nullptr, 0}, {"euro", 8364}, {"Yacute", 221},
+        {"Omega", 937}, {nullptr, 0}, {nullptr, 0}, {nullptr, 0},
+        {"zwnj", 8204}, {nullptr, 0}, {nullptr, 0}, {"Igrave", 204},
+        {"Pi", 928}, {nullptr, 0}, {nullptr, 0}, {"Dagger", 8225},
+        {nullptr, 0}, {"Ucirc", 219}, {nullptr, 0}, {"piv", 982},
+        {"Iota", 921}, {"diams", 9830}, {nullptr, 0}, {nullptr, 0},
+        {nullptr, 0}, {"thorn", 254}, {nullptr, 0}, {nullptr, 0},
+        {nullptr, 0}, {nullptr, 0}, {nullptr, 0}, {nullptr, 0},
+        {"circ", 710}, {"exist", 8707}, {"ocirc", 244}, {nullptr, 0},
+        {"eta", 951}, {"Ocirc", 212}, {"otilde", 245}, {nullptr, 0},
+        {nullptr, 0}, {"Eacute", 201}, {nullptr, 0}, {nullptr, 0},
+        {nullptr, 0}, {nullptr, 0}, {"epsilon", 949}, {"tau", 964},
+        {"ccedil", 231}, {nullptr, 0}, {"part", 8706}, {"frac34", 190},
+        {"crarr", 8629}, {nullptr, 0}, {"Acirc", 194}, {"thetasym", 977},
+        {nullptr, 0}, {"aring", 229}, {nullptr, 0}, {nullptr, 0},
+        {"Oacute", 211}, {nullptr, 0}, {"mu", 956}, {nullptr, 0},
+        {"micro", 181}, {nullptr, 0}, {"Phi", 934}, {nullptr, 0},
+        {"quot", 34}, {nullptr, 0}, {nullptr, 0}, {nullptr, 0},
+        {nullptr, 0}, {nullptr, 0}, {nullptr, 0}, {"Omicron", 927},
+        {nullptr, 0}, {"Iacute", 205}, {nullptr, 0}, {"lambda", 955},
+        {nullptr, 0}, {nullptr, 0}, {"radic", 8730}, {"prime", 8242},
+        {"Psi", 936}, {"minus", 8722}, {nullptr, 0}, {"lt", 60},
+        {"real", 8476}, {"hellip", 8230}, {nullptr, 0}, {nullptr, 0},
+        {"lceil", 8968}, {"iexcl", 161}, {nullptr, 0}, {"le", 8804},
+        {nullptr, 0}, {nullptr, 0}, {nullptr, 0}, {"ecirc", 234},
+        {"Icirc", 206}, {"Aacute", 193}, {nullptr, 0}, {nullptr, 0},
+        {nullptr, 0}, {nullptr, 0}, {nullptr, 0}, {nullptr, 0},
+        {"OElig", 338}, {"cong", 8773}, {nullptr, 0}, {"Yuml", 376},
+        {"darr", 8595}, {nullptr, 0}, {nullptr, 0}, {nullptr, 0},
+        {"larr", 8592}, {nullptr, 0}, {"shy", 173}, {"egrave", 232},
+        {nullptr, 0}, {"THORN", 222}, {"rsquo", 8217}, {nullptr, 0},
+        {nullptr, 0}, {"bull", 8226}, {nullptr, 0}, {nullptr, 0},
+        {nullptr, 0}, {nullptr, 0}, {nullptr, 0}, {"sub", 8834},
+        {nullptr, 0}, {"permil", 8240}, {nullptr, 0}, {"Kappa", 922},
+        {nullptr, 0}, {nullptr, 0}, {"uml", 168}, {"sup1", 185},
+        {nullptr, 0}, {"ni", 8715}, {nullptr, 0}, {nullptr, 0},
+        {nullptr, 0}, {nullptr, 0}, {nullptr, 0}, {nullptr, 0},
+        {nullptr, 0}, {"Otilde", 213}, {nullptr, 0}, {nullptr, 0},
+        {"ordm", 186}, {nullptr, 0}, {nullptr, 0}, {"isin", 8712},
+        {"iuml", 239}, {nullptr, 0}, {"sube", 8838}, {nullptr, 0},
+        {nullptr, 0}, {"frac14", 188}, {"Sigma", 931}, {"Agrave", 192},
+        {"infin", 8734}, {"middot", 183}, {"Zeta", 918}, {"Prime", 8243},
+        {nullptr, 0}, {"pi", 960}, {nullptr, 0}, {nullptr, 0},
+        {"oelig", 339}, {"gamma", 947}, {"rang", 9002}, {nullptr, 0},
+        {"sigma", 963}, {"iacute", 237}, {nullptr, 0}, {"ouml", 246},
+        {"gt", 62}, {"Ugrave", 217}, {nullptr, 0}, {nullptr, 0},
+        {nullptr, 0}, {nullptr, 0}, {nullptr, 0}, {"Uuml", 220},
+        {"iquest", 191}, {"omicron", 959}, {nullptr, 0}, {"rceil", 8969},
+        {nullptr, 0}, {nullptr, 0}, {"prop", 8733}, {nullptr, 0},
+        {"Eta", 919}, {"ETH", 208}, {"aelig", 230}, {nullptr, 0},
+        {"lfloor", 8970}, {nullptr, 0}, {"tilde", 732}, {nullptr, 0},
+        {"yuml", 255}, {nullptr, 0}, {"beta", 946}, {"omega", 969},
+        {"Ntilde", 209}, {"Iuml", 207}, {"spades", 9824}, {nullptr, 0},
+        {"sbquo", 8218}, {nullptr, 0}, {"Ograve", 210}, {nullptr, 0},
+        {"prod", 8719}, {"ne", 8800}, {nullptr, 0}, {nullptr, 0},
+        {nullptr, 0}, {"and", 8743}, {nullptr, 0}, {"xi", 958},
+        {"Theta", 920}, {"apos", 39}, {nullptr, 0}, {"oline", 8254},
+        {nullptr, 0}, {nullptr, 0}, {nullptr, 0}, {"kappa", 954},
+        {"sdot", 8901}, {"rdquo", 8221}, {nullptr, 0}, {nullptr, 0},
+        {nullptr, 0}, {"not", 172}, {"Beta", 914}, {"sum", 8721},
+        {"image", 8465}, {nullptr, 0}, {"laquo", 171}, {"szlig", 223},
+        {nullptr, 0}, {nullptr, 0}, {"forall", 8704}, {nullptr, 0},
+        {"cup", 8746}, {"equiv", 8801}, {"trade", 8482}, {nullptr, 0},
+        {"thinsp", 8201}, {"empty", 8709}, {nullptr, 0}, {"zwj", 8205},
+        {nullptr, 0}, {"cedil", 184}, {nullptr, 0}, {nullptr, 0},
+        {nullptr, 0}, {nullptr, 0}, {"divide", 247}, {nullptr, 0},
+        {nullptr, 0}, {nullptr, 0}, {nullptr, 0}, {nullptr, 0},
+        {nullptr, 0}, {nullptr, 0}, {"Ccedil", 199}, {nullptr, 0},
+        {"mdash", 8212}, {nullptr, 0}, {"dagger", 8224}, {"lArr", 8656},
+        {nullptr, 0}, {"loz", 9674}, {"rho", 961}, {nullptr, 0},
+        {nullptr, 0}, {nullptr, 0}, {nullptr, 0}, {nullptr, 0},
+        {nullptr, 0}, {nullptr, 0}, {nullptr, 0}, {"lsaquo", 8249},
+        {nullptr, 0}, {nullptr, 0}, {"uArr", 8657}, {nullptr, 0},
+        {"nbsp", 160}, {"ensp", 8194}, {nullptr, 0}, {"curren", 164},
+        {"iota", 953}, {nullptr, 0}, {"acute", 180}, {nullptr, 0},
+        {nullptr, 0}, {nullptr, 0}, {nullptr, 0}, {nullptr, 0},
+        {"yen", 165}, {"or", 8744}, {"Nu", 925}, {nullptr, 0},
+        {nullptr, 0}, {"alefsym", 8501}, {"Alpha", 913}, {nullptr, 0},
+        {"icirc", 238}, {"perp", 8869}, {"ang", 8736}, {"ldquo", 8220},
+        {nullptr, 0}, {"amp", 38}, {nullptr, 0}, {nullptr, 0},
+        {"theta", 952}, {nullptr, 0}, {nullptr, 0}, {"nabla", 8711},
+        {nullptr, 0}, {nullptr, 0}, {nullptr, 0}, {"supe", 8839},
+        {nullptr, 0}, {nullptr, 0}, {nullptr, 0}, {nullptr, 0},
+        {nullptr, 0}, {"Gamma", 915}, {nullptr, 0}, {"eacute", 233},
+        {"lang", 9001}, {"rArr", 8658}, {nullptr, 0}, {"asymp", 8776},
+        {nullptr, 0}, {nullptr, 0}, {nullptr, 0}, {"oacute", 243},
+        {nullptr, 0}, {"hearts", 9829}, {"acirc", 226}, {nullptr, 0},
+        {nullptr, 0}, {nullptr, 0}, {"upsilon", 965}, {"notin", 8713},
+        {nullptr, 0}, {nullptr, 0}, {nullptr, 0}, {nullptr, 0},
+        {"Oslash", 216}, {nullptr, 0}, {nullptr, 0}, {"macr", 175},
+        {"bdquo", 8222}, {"cent", 162}, {nullptr, 0}, {nullptr, 0},
+        {"ge", 8805}, {nullptr, 0}, {nullptr, 0}, {"Lambda", 923},
+        {nullptr, 0}, {"ucirc", 251}, {"alpha", 945}, {nullptr, 0},
+        {nullptr, 0}, {nullptr, 0}, {"chi", 967}, {"hArr", 8660},
+        {nullptr, 0}, {nullptr, 0}, {"uacute", 250}, {"Rho", 929},
+        {nullptr, 0}, {"AElig", 198}, {nullptr, 0}, {nullptr, 0},
+        {nullptr, 0}, {"copy", 169}, {nullptr, 0}, {"agrave", 224},
+        {"clubs", 9827}, {nullptr, 0}, {"aacute", 225}, {"delta", 948},
+        {nullptr, 0}, {"times", 215}, {"upsih", 978}, {nullptr, 0},
+        {nullptr, 0}, {"uarr", 8593}, {nullptr, 0}, {nullptr, 0},
+        {nullptr, 0}, {nullptr, 0}, {"sup2", 178}, {"scaron", 353},
+        {nullptr, 0}, {"int", 8747}, {nullptr, 0}, {"auml", 228},
+        {nullptr, 0}, {"otimes", 8855}, {nullptr, 0}, {"uuml", 252},
+        {nullptr, 0}, {nullptr, 0}, {"yacute", 253}, {nullptr, 0},
+        {nullptr, 0}, {"sect", 167}, {nullptr, 0}, {"deg", 176},
+        {"para", 182}, {"eth", 240}, {nullptr, 0}, {"phi", 966},
+        {"ugrave", 249}, {"nu", 957}, {nullptr, 0}, {"Xi", 926},
+        {"cap", 8745}, {nullptr, 0}, {nullptr, 0}, {nullptr, 0},
+        {"ntilde", 241}, {"rarr", 8594}, {nullptr, 0}, {"Scaron", 352},
+        {"psi", 968}, {nullptr, 0}, {"ograve", 242}, {"Auml", 196},
+};
+
+
+#pragma endregion
+
+static inline uint32_t hashName(const char *name, size_t len, uint32_t seed) {
+    uint32_t h = 2166136261u ^ seed;
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ (unsigned char) name[i]) * 16777619u;
+    }
+    return h;
+}
+
+/// 查找命名实体
+/// \param name 实体名，不含 '&' 与 ';'
+/// \param len 实体名长度
+/// \return 码点，不存在返回 0
+static uint32_t findEntity(const char *name, size_t len) {
+    auto bucket = hashName(name, len, 0) % ENTITY_BUCKETS;
+    auto &entity = EntityTable[hashName(name, len, EntityDisplacement[bucket]) % ENTITY_SLOTS];
+    if (nullptr == entity.name) return 0;
+    if (0 != strncmp(entity.name, name, len) || '\0' != entity.name[len]) return 0;
+    return entity.code;
+}
+
+static inline bool isSpecial(unsigned char ch) {
+    return '<' == ch || '>' == ch || '&' == ch || '"' == ch || '\'' == ch;
+}
+
+/// 扫描无需转义的连续字节
+/// \return 首个需转义字节的偏移
+static size_t scanClean(const char *p, size_t n) {
+    size_t i = 0;
+#ifdef SSTR_SSE2
+    const __m128i lt = _mm_set1_epi8('<'), gt = _mm_set1_epi8('>'), amp = _mm_set1_epi8('&');
+    const __m128i quot = _mm_set1_epi8('"'), apos = _mm_set1_epi8('\'');
+    for (; i + 32 <= n; i += 32) {
+        auto a = _mm_loadu_si128((const __m128i *) (p + i));
+        auto b = _mm_loadu_si128((const __m128i *) (p + i + 16));
+        auto ma = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(a, lt), _mm_cmpeq_epi8(a, gt)),
+                               _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(a, amp), _mm_cmpeq_epi8(a, quot)), _mm_cmpeq_epi8(a, apos)));
+        auto mb = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(b, lt), _mm_cmpeq_epi8(b, gt)),
+                               _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(b, amp), _mm_cmpeq_epi8(b, quot)), _mm_cmpeq_epi8(b, apos)));
+        auto mask = (uint32_t) _mm_movemask_epi8(ma) | (uint32_t) _mm_movemask_epi8(mb) << 16;
+        if (mask) return i + sstr::CountTrailingZeros(mask);
+    }
+#endif
+    for (; i < n; i++) {
+        if (isSpecial((unsigned char) p[i])) return i;
+    }
+    return n;
+}
+
+static inline const char *getEscape(unsigned char ch, size_t &len) {
+    switch (ch) {
+        case '<': len = 4; return "&lt;";
+        case '>': len = 4; return "&gt;";
+        case '&': len = 5; return "&amp;";
+        case '"': len = 6; return "&quot;";
+        default: len = 5; return "&#39;";
+    }
+}
+
+/// 转义写入
+/// \param src 原始字节串
+/// \param size 原始字节数
+/// \param dst 写入位置，需有 getEscapedHtmlSize 大小的空间
+static void escapeTo(const char *src, size_t size, char *dst) {
+    size_t i = 0;
+    while (i < size) {
+        auto n = scanClean(src + i, size - i);
+        memcpy(dst, src + i, n);
+        dst += n;
+        i += n;
+        if (i == size) break;
+        size_t len;
+        auto escape = getEscape((unsigned char) src[i++], len);
+        memcpy(dst, escape, len);
+        dst += len;
+    }
+}
+
+/// 解析 '&' 起始的实体
+/// \param p 指向 '&'
+/// \param n 剩余字节数
+/// \param code 解析出的码点
+/// \return 实体字节数，无法识别返回 0
+static size_t parseEntity(const char *p, size_t n, uint32_t &code) {
+    size_t i = 1;
+    if (i < n && '#' == p[i]) {
+        i++;
+        bool hex = i < n && ('x' == p[i] || 'X' == p[i]);
+        if (hex) i++;
+        auto begin = i;
+        uint32_t value = 0;
+        for (; i < n; i++) {
+            auto ch = p[i];
+            int digit;
+            if (ch >= '0' && ch <= '9') {
+                digit = ch - '0';
+            } else if (hex && ch >= 'a' && ch <= 'f') {
+                digit = ch - 'a' + 10;
+            } else if (hex && ch >= 'A' && ch <= 'F') {
+                digit = ch - 'A' + 10;
+            } else {
+                break;
+            }
+            // 超出范围后不再累加，保证不溢出
+            if (value <= 0x10ffff) value = value * (hex ? 16 : 10) + digit;
+        }
+        if (i == begin || i == n || ';' != p[i]) return 0;
+        if (0 == value || value > 0x10ffff || (value >= 0xd800 && value <= 0xdfff)) value = 0xfffd;
+        code = value;
+        return i + 1;
+    }
+
+    auto begin = i;
+    for (; i < n && i - begin <= ENTITY_MAX_NAME; i++) {
+        auto ch = p[i];
+        if (!((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9'))) break;
+    }
+    if (i == begin || i == n || ';' != p[i]) return 0;
+    code = findEntity(p + begin, i - begin);
+    return 0 == code ? 0 : i + 1;
+}
+
+/// 反转义写入
+/// \note 允许 dst 与 src 相同（原地反转义）
+/// \return 反转义后字节数
+static size_t unescapeTo(const char *src, size_t size, char *dst) {
+    auto begin = dst;
+    size_t i = 0;
+    while (i < size) {
+        auto amp = (const char *) memchr(src + i, '&', size - i);
+        auto n = amp ? (size_t) (amp - src) - i : size - i;
+        if (dst != src + i) memmove(dst, src + i, n);
+        dst += n;
+        i += n;
+        if (i == size) break;
+
+        uint32_t code;
+        auto len = parseEntity(src + i, size - i, code);
+        if (0 == len) {
+            *dst++ = src[i++];
+        } else {
+            dst += sstr::putUTF8FromUnicodeChar(SChar(code), dst);
+            i += len;
+        }
+    }
+    return dst - begin;
+}
+
+size_t sstr::getEscapedHtmlSize(const SStringView &str) {
+    if (str.null()) return 0;
+    auto p = str.data();
+    auto size = str.size();
+    auto newSize = size;
+    size_t i = 0;
+    while (true) {
+        i += scanClean(p + i, size - i);
+        if (i == size) break;
+        size_t len;
+        getEscape((unsigned char) p[i++], len);
+        newSize += len - 1;
+    }
+    return newSize;
+}
+
+SString sstr::escapeHtml(const SStringView &str) {
+    SString res;
+    if (str.null()) return res;
+    res.resize(getEscapedHtmlSize(str));
+    escapeTo(str.data(), str.size(), res.data());
+    return res;
+}
+
+bool sstr::escapeHtmlInPlace(SString &str) {
+    auto newSize = getEscapedHtmlSize(str);
+    if (newSize == str.size()) return false;
+    SString res;
+    res.resize(newSize);
+    escapeTo(str.data(), str.size(), res.data());
+    str = std::move(res);
+    return true;
+}
+
+SString sstr::unescapeHtml(const SStringView &str) {
+    SString res;
+    if (str.null()) return res;
+    // 反转义结果不会比输入更长
+    res.resize(str.size());
+    res.resize(unescapeTo(str.data(), str.size(), res.data()));
+    return res;
+}
+
+bool sstr::unescapeHtmlInPlace(SString &str) {
+    if (str.null() || nullptr == memchr(str.data(), '&', str.size())) return false;
+    auto size = str.size();
+    str.resize(unescapeTo(str.data(), size, str.data()));
+    return str.size() != size;
+}
@@ -0,0 +1,269 @@
+#include <SString/json.h>
+#include <SString/algorithm.h>
+#include <cstring>
+#ifdef _WIN32
+#pragma warning(disable : 4267)
+#endif
+
+using sstr::SChar;
+using sstr::SString;
+using sstr::SStringBuilder;
+using sstr::SStringView;
+
+static const char HexDigits[] = "0123456789abcdef";
+
+static inline bool needEscape(unsigned char ch) {
+    return ch < 0x20 || '"' == ch || '\\' == ch;
+}
+
+/// 获取单个字节转义后的额外字节数
+static inline size_t getEscapeExtra(unsigned char ch) {
+    switch (ch) {
+        case '"':
+        case '\\':
+        case '\b':
+        case '\f':
+        case '\n':
+        case '\r':
+        case '\t':
+            return 1;
+        default:
+            return 5;
+    }
+}
+
+/// 写入单个字节的转义序列
+/// \return 写入字节数
+static inline size_t writeEscape(char *dst, unsigned char ch) {
+    dst[0] = '\\';
+    switch (ch) {
+        case '"': dst[1] = '"'; return 2;
+        case '\\': dst[1] = '\\'; return 2;
+        case '\b': dst[1] = 'b'; return 2;
+        case '\f': dst[1] = 'f'; return 2;
+        case '\n': dst[1] = 'n'; return 2;
+        case '\r': dst[1] = 'r'; return 2;
+        case '\t': dst[1] = 't'; return 2;
+        default:
+            dst[1] = 'u';
+            dst[2] = '0';
+            dst[3] = '0';
+            dst[4] = HexDigits[ch >> 4];
+            dst[5] = HexDigits[ch & 0xf];
+            return 6;
+    }
+}
+
+/// 扫描无需转义的连续字节
+/// \param p 起始位置
+/// \param n 剩余字节数
+/// \return 无需转义的字节数，即首个需转义字节的偏移
+static size_t scanClean(const char *p, size_t n) {
+    size_t i = 0;
+#ifdef SSTR_SSE2
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i slash = _mm_set1_epi8('\\');
+    const __m128i ctrl = _mm_set1_epi8(0x1f);
+    const __m128i zero = _mm_setzero_si128();
+    // 每次处理 32 字节
+    for (; i + 32 <= n; i += 32) {
+        auto a = _mm_loadu_si128((const __m128i *) (p + i));
+        auto b = _mm_loadu_si128((const __m128i *) (p + i + 16));
+        // 饱和减法结果为 0 即 ch <= 0x1f
+        auto ma = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(a, quote), _mm_cmpeq_epi8(a, slash)),
+                               _mm_cmpeq_epi8(_mm_subs_epu8(a, ctrl), zero));
+        auto mb = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(b, quote), _mm_cmpeq_epi8(b, slash)),
+                               _mm_cmpeq_epi8(_mm_subs_epu8(b, ctrl), zero));
+        auto mask = (uint32_t) _mm_movemask_epi8(ma) | (uint32_t) _mm_movemask_epi8(mb) << 16;
+        if (mask) return i + sstr::CountTrailingZeros(mask);
+    }
+#endif
+    for (; i < n; i++) {
+        if (needEscape((unsigned char) p[i])) return i;
+    }
+    return n;
+}
+
+/// 无需转义的一段中非法 UTF-8 字节的个数
+static size_t countInvalid(const char *p, size_t n) {
+    if (sstr::isValidUTF8String(p, n)) return 0;
+    size_t count = 0;
+    for (size_t i = 0; i < n;) {
+        int k;
+        if (0xfffd == sstr::DecodeUTF8(p + i, p + n, k) && 1 == k) count++;
+        i += k;
+    }
+    return count;
+}
+
+/// 复制无需转义的一段，非法 UTF-8 字节逐个替换为 U+FFFD
+/// \return 写入字节数
+static size_t copyClean(const char *p, size_t n, char *dst) {
+    if (sstr::isValidUTF8String(p, n)) {
+        memcpy(dst, p, n);
+        return n;
+    }
+    size_t size = 0;
+    for (size_t i = 0; i < n;) {
+        int k;
+        if (0xfffd == sstr::DecodeUTF8(p + i, p + n, k) && 1 == k) {
+            memcpy(dst + size, "\xef\xbf\xbd", 3);
+            size += 3;
+        } else {
+            memcpy(dst + size, p + i, k);
+            size += k;
+        }
+        i += k;
+    }
+    return size;
+}
+
+static inline int hexValue(char ch) {
+    if (ch >= '0' && ch <= '9') return ch - '0';
+    if (ch >= 'a' && ch <= 'f') return ch - 'a' + 10;
+    if (ch >= 'A' && ch <= 'F') return ch - 'A' + 10;
+    return -1;
+}
+
+/// 读取 4 位十六进制数
+/// \return 数值，非法返回 -1
+static int readHex4(const char *p) {
+    int value = 0;
+    for (int i = 0; i < 4; i++) {
+        auto v = hexValue(p[i]);
+        if (-1 == v) return -1;
+        value = value << 4 | v;
+    }
+    return value;
+}
+
+size_t sstr::getEscapedJsonSize(const SStringView &str) {
+    if (str.null()) return 0;
+    auto p = str.data();
+    auto size = str.size();
+    auto newSize = size;
+    size_t i = 0;
+    while (true) {
+        auto n = scanClean(p + i, size - i);
+        // U+FFFD 占 3 字节
+        newSize += countInvalid(p + i, n) * 2;
+        i += n;
+        if (i == size) break;
+        newSize += getEscapeExtra((unsigned char) p[i]);
+        i++;
+    }
+    return newSize;
+}
+
+SString sstr::escapeJson(const SStringView &str) {
+    SString res;
+    if (str.null()) return res;
+    auto p = str.data();
+    auto size = str.size();
+    res.resize(getEscapedJsonSize(str));
+    // 大小一致说明无需转义
+    if (res.size() == size) {
+        memcpy(res.data(), p, size);
+        return res;
+    }
+
+    auto dst = res.data();
+    size_t i = 0;
+    while (i < size) {
+        auto n = scanClean(p + i, size - i);
+        dst += copyClean(p + i, n, dst);
+        i += n;
+        if (i == size) break;
+        dst += writeEscape(dst, (unsigned char) p[i]);
+        i++;
+    }
+    return res;
+}
+
+void sstr::escapeJson(const SStringView &str, SStringBuilder &builder) {
+    if (str.null()) return;
+    auto p = str.data();
+    auto size = str.size();
+    // 转义序列均为 ASCII，新增字数等于新增字节数
+    builder.reserve(builder.size() + str.len() + getEscapedJsonSize(str) - size);
+
+    char buffer[6];
+    size_t i = 0;
+    while (i < size) {
+        auto end = i + scanClean(p + i, size - i);
+        while (i < end) {
+            // 非法或截断的序列按 U+FFFD 处理，每次跳过 1 字节
+            int n;
+            builder.append(SChar(DecodeUTF8(p + i, p + end, n)));
+            i += n;
+        }
+        if (i == size) break;
+        auto n = writeEscape(buffer, (unsigned char) p[i]);
+        for (size_t j = 0; j < n; j++) {
+            builder.append(SChar(buffer[j]));
+        }
+        i++;
+    }
+}
+
+bool sstr::unescapeJson(const SStringView &str, SString &out) {
+    if (str.null()) {
+        out.resize(0);
+        return true;
+    }
+    auto p = str.data();
+    auto size = str.size();
+    // 反转义结果不会比输入更长
+    out.resize(size);
+    auto dst = out.data();
+    // 失败时清空，不留下部分结果
+    auto fail = [&out]() {
+        out.resize(0);
+        return false;
+    };
+
+    size_t i = 0;
+    while (i < size) {
+        auto slash = (const char *) memchr(p + i, '\\', size - i);
+        auto n = slash ? (size_t) (slash - p) - i : size - i;
+        memcpy(dst, p + i, n);
+        dst += n;
+        i += n;
+        if (i == size) break;
+
+        // 跳过 '\\'
+        if (++i == size) return fail();
+        switch (p[i++]) {
+            case '"': *dst++ = '"'; break;
+            case '\\': *dst++ = '\\'; break;
+            case '/': *dst++ = '/'; break;
+            case 'b': *dst++ = '\b'; break;
+            case 'f': *dst++ = '\f'; break;
+            case 'n': *dst++ = '\n'; break;
+            case 'r': *dst++ = '\r'; break;
+            case 't': *dst++ = '\t'; break;
+            case 'u': {
+                if (i + 4 > size) return fail();
+                auto code = readHex4(p + i);
+                if (-1 == code) return fail();
+                i += 4;
+                if (code >= 0xdc00 && code <= 0xdfff) return fail();
+                // 高代理项后必须紧跟低代理项
+                if (code >= 0xd800 && code <= 0xdbff) {
+                    if (i + 6 > size || '\\' != p[i] || 'u' != p[i + 1]) return fail();
+                    auto low = readHex4(p + i + 2);
+                    if (low < 0xdc00 || low > 0xdfff) return fail();
+                    i += 6;
+                    code = 0x10000 + ((code - 0xd800) << 10) + (low - 0xdc00);
+                }
+                dst += putUTF8FromUnicodeChar(SChar(code), dst);
+                break;
+            }
+            default:
+                return fail();
+        }
+    }
+
+    out.resize(dst - out.data());
+    return true;
+}
@@ -0,0 +1,4709 @@
+#include <SString/SNormalizer.h>
+#include <SString/SSearchNormalizer.h>
+#include <SString/algorithm.h>
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#ifdef _WIN32
+#pragma warning(disable : 4267)
+#endif
+
+#define NFD_NO 0x01
+#define NFKD_NO 0x02
+#define NFC_NO 0x04
+#define NFC_MAYBE 0x08
+#define NFKC_NO 0x10
+#define NFKC_MAYBE 0x20
+
+#define HANGUL_S_BASE 0xac00
+#define HANGUL_L_BASE 0x1100
+#define HANGUL_V_BASE 0x1161
+#define HANGUL_T_BASE 0x11a7
+#define HANGUL_L_COUNT 19
+#define HANGUL_V_COUNT 21
+#define HANGUL_T_COUNT 28
+#define HANGUL_N_COUNT (HANGUL_V_COUNT * HANGUL_T_COUNT)
+#define HANGUL_S_COUNT (HANGUL_L_COUNT * HANGUL_N_COUNT)
+
+using sstr::SNormalForm;
+using sstr::SNormalizer;
+using sstr::SSearchNormalizer;
+using sstr::SString;
+using sstr::SStringView;
+
+struct NormRecord {
+    /// 规范组合类（Canonical_Combining_Class）
+    uint8_t ccc;
+    /// 快速检查标志
+    uint8_t flags;
+    /// 规范分解在 DecompositionPool 中的位置，0 表示无分解
+    uint16_t canonical;
+    /// 兼容分解在 DecompositionPool 中的位置，0 表示无分解
+    uint16_t compat;
+};
+
+struct CompositionPair {
+    uint32_t first;
+    uint32_t second;
+    uint32_t composite;
+};
+
+#pragma region NormalizationTable
+
+// 由 Unicode 14.0 UnicodeData.txt、DerivedNormalizationProps.txt 与 CompositionExclusions.txt 生成，
+// 韩文音节的分解与组合按算法处理，不在表中
+
+static const NormRecord NormRecords[3828] = {
+        {0, 0, 0, 0}, {0, 18, 0, 1}, {0, 18, 0, 3}, {0, 18, 0, 6},
+        {0, 18, 0, 8}, {0, 18, 0, 11}, {0, 18, 0, 13}, {0, 18, 0, 15},
+        {0, 18, 0, 18}, {0, 18, 0, 20}, {0, 18, 0, 23}, {0, 18, 0, 25},
+        {0, 18, 0, 27}, {0, 18, 0, 31}, {0, 18, 0, 35}, {0, 3, 39, 39},
+        {0, 3, 42, 42}, {0, 3, 45, 45}, {0, 3, 48, 48}, {0, 3, 51, 51},
+        {0, 3, 54, 54}, {0, 3, 57, 57}, {0, 3, 60, 60}, {0, 3, 63, 63},
+        {0, 3, 66, 66}, {0, 3, 69, 69}, {0, 3, 72, 72}, {0, 3, 75, 75},
+        {0, 3, 78, 78}, {0, 3, 81, 81}, {0, 3, 84, 84}, {0, 3, 87, 87},
+        {0, 3, 90, 90}, {0, 3, 93, 93}, {0, 3, 96, 96}, {0, 3, 99, 99},
+        {0, 3, 102, 102}, {0, 3, 105, 105}, {0, 3, 108, 108}, {0, 3, 111, 111},
+        {0, 3, 114, 114}, {0, 3, 117, 117}, {0, 3, 120, 120}, {0, 3, 123, 123},
+        {0, 3, 126, 126}, {0, 3, 129, 129}, {0, 3, 132, 132}, {0, 3, 135, 135},
+        {0, 3, 138, 138}, {0, 3, 141, 141}, {0, 3, 144, 144}, {0, 3, 147, 147},
+        {0, 3, 150, 150}, {0, 3, 153, 153}, {0, 3, 156, 156}, {0, 3, 159, 159},
+        {0, 3, 162, 162}, {0, 3, 165, 165}, {0, 3, 168, 168}, {0, 3, 171, 171},
+        {0, 3, 174, 174}, {0, 3, 177, 177}, {0, 3, 180, 180}, {0, 3, 183, 183},
+        {0, 3, 186, 186}, {0, 3, 189, 189}, {0, 3, 192, 192}, {0, 3, 195, 195},
+        {0, 3, 198, 198}, {0, 3, 201, 201}, {0, 3, 204, 204}, {0, 3, 207, 207},
+        {0, 3, 210, 210}, {0, 3, 213, 213}, {0, 3, 216, 216}, {0, 3, 219, 219},
+        {0, 3, 222, 222}, {0, 3, 225, 225}, {0, 3, 228, 228}, {0, 3, 231, 231},
+        {0, 3, 234, 234}, {0, 3, 237, 237}, {0, 3, 240, 240}, {0, 3, 243, 243},
+        {0, 3, 246, 246}, {0, 3, 249, 249}, {0, 3, 252, 252}, {0, 3, 255, 255},
+        {0, 3, 258, 258}, {0, 3, 261, 261}, {0, 3, 264, 264}, {0, 3, 267, 267},
+        {0, 3, 270, 270}, {0, 3, 273, 273}, {0, 3, 276, 276}, {0, 3, 279, 279},
+        {0, 3, 282, 282}, {0, 3, 285, 285}, {0, 3, 288, 288}, {0, 3, 291, 291},
+        {0, 3, 294, 294}, {0, 3, 297, 297}, {0, 3, 300, 300}, {0, 3, 303, 303},
+        {0, 3, 306, 306}, {0, 3, 309, 309}, {0, 3, 312, 312}, {0, 3, 315, 315},
+        {0, 3, 318, 318}, {0, 3, 321, 321}, {0, 3, 324, 324}, {0, 3, 327, 327},
+        {0, 3, 330, 330}, {0, 18, 0, 333}, {0, 18, 0, 336}, {0, 3, 339, 339},
+        {0, 3, 342, 342}, {0, 3, 345, 345}, {0, 3, 348, 348}, {0, 3, 351, 351},
+        {0, 3, 354, 354}, {0, 3, 357, 357}, {0, 3, 360, 360}, {0, 3, 363, 363},
+        {0, 3, 366, 366}, {0, 18, 0, 369}, {0, 18, 0, 372}, {0, 3, 375, 375},
+        {0, 3, 378, 378}, {0, 3, 381, 381}, {0, 3, 384, 384}, {0, 3, 387, 387},
+        {0, 3, 390, 390}, {0, 18, 0, 393}, {0, 3, 396, 396}, {0, 3, 399, 399},
+        {0, 3, 402, 402}, {0, 3, 405, 405}, {0, 3, 408, 408}, {0, 3, 411, 411},
+        {0, 3, 414, 414}, {0, 3, 417, 417}, {0, 3, 420, 420}, {0, 3, 423, 423},
+        {0, 3, 426, 426}, {0, 3, 429, 429}, {0, 3, 432, 432}, {0, 3, 435, 435},
+        {0, 3, 438, 438}, {0, 3, 441, 441}, {0, 3, 444, 444}, {0, 3, 447, 447},
+        {0, 3, 450, 450}, {0, 3, 453, 453}, {0, 3, 456, 456}, {0, 3, 459, 459},
+        {0, 3, 462, 462}, {0, 3, 465, 465}, {0, 3, 468, 468}, {0, 3, 471, 471},
+        {0, 3, 474, 474}, {0, 3, 477, 477}, {0, 3, 480, 480}, {0, 3, 483, 483},
+        {0, 3, 486, 486}, {0, 3, 489, 489}, {0, 3, 492, 492}, {0, 3, 495, 495},
+        {0, 3, 498, 498}, {0, 3, 501, 501}, {0, 3, 504, 504}, {0, 3, 507, 507},
+        {0, 3, 510, 510}, {0, 3, 513, 513}, {0, 3, 516, 516}, {0, 3, 519, 519},
+        {0, 3, 522, 522}, {0, 3, 525, 525}, {0, 3, 528, 528}, {0, 3, 531, 531},
+        {0, 3, 534, 534}, {0, 18, 0, 537}, {0, 3, 539, 539}, {0, 3, 542, 542},
+        {0, 3, 545, 545}, {0, 3, 548, 548}, {0, 18, 0, 551}, {0, 18, 0, 555},
+        {0, 18, 0, 559}, {0, 18, 0, 563}, {0, 18, 0, 566}, {0, 18, 0, 569},
+        {0, 18, 0, 572}, {0, 18, 0, 575}, {0, 18, 0, 578}, {0, 3, 581, 581},
+        {0, 3, 584, 584}, {0, 3, 587, 587}, {0, 3, 590, 590}, {0, 3, 593, 593},
+        {0, 3, 596, 596}, {0, 3, 599, 599}, {0, 3, 602, 602}, {0, 3, 605, 605},
+        {0, 3, 609, 609}, {0, 3, 613, 613}, {0, 3, 617, 617}, {0, 3, 621, 621},
+        {0, 3, 625, 625}, {0, 3, 629, 629}, {0, 3, 633, 633}, {0, 3, 637, 637},
+        {0, 3, 641, 641}, {0, 3, 645, 645}, {0, 3, 649, 649}, {0, 3, 653, 653},
+        {0, 3, 656, 656}, {0, 3, 659, 659}, {0, 3, 662, 662}, {0, 3, 665, 665},
+        {0, 3, 668, 668}, {0, 3, 671, 671}, {0, 3, 674, 674}, {0, 3, 677, 677},
+        {0, 3, 681, 681}, {0, 3, 685, 685}, {0, 3, 688, 688}, {0, 3, 691, 691},
+        {0, 18, 0, 694}, {0, 18, 0, 697}, {0, 18, 0, 700}, {0, 3, 703, 703},
+        {0, 3, 706, 706}, {0, 3, 709, 709}, {0, 3, 712, 712}, {0, 3, 715, 715},
+        {0, 3, 719, 719}, {0, 3, 723, 723}, {0, 3, 726, 726}, {0, 3, 729, 729},
+        {0, 3, 732, 732}, {0, 3, 735, 735}, {0, 3, 738, 738}, {0, 3, 741, 741},
+        {0, 3, 744, 744}, {0, 3, 747, 747}, {0, 3, 750, 750}, {0, 3, 753, 753},
+        {0, 3, 756, 756}, {0, 3, 759, 759}, {0, 3, 762, 762}, {0, 3, 765, 765},
+        {0, 3, 768, 768}, {0, 3, 771, 771}, {0, 3, 774, 774}, {0, 3, 777, 777},
+        {0, 3, 780, 780}, {0, 3, 783, 783}, {0, 3, 786, 786}, {0, 3, 789, 789},
+        {0, 3, 792, 792}, {0, 3, 795, 795}, {0, 3, 798, 798}, {0, 3, 801, 801},
+        {0, 3, 804, 804}, {0, 3, 807, 807}, {0, 3, 810, 810}, {0, 3, 813, 813},
+        {0, 3, 816, 816}, {0, 3, 819, 819}, {0, 3, 822, 822}, {0, 3, 825, 825},
+        {0, 3, 828, 828}, {0, 3, 831, 831}, {0, 3, 834, 834}, {0, 3, 837, 837},
+        {0, 3, 841, 841}, {0, 3, 845, 845}, {0, 3, 849, 849}, {0, 3, 853, 853},
+        {0, 3, 856, 856}, {0, 3, 859, 859}, {0, 3, 863, 863}, {0, 3, 867, 867},
+        {0, 3, 870, 870}, {0, 18, 0, 873}, {0, 18, 0, 875}, {0, 18, 0, 877},
+        {0, 18, 0, 879}, {0, 18, 0, 881}, {0, 18, 0, 883}, {0, 18, 0, 885},
+        {0, 18, 0, 887}, {0, 18, 0, 889}, {0, 18, 0, 891}, {0, 18, 0, 894},
+        {0, 18, 0, 897}, {0, 18, 0, 900}, {0, 18, 0, 903}, {0, 18, 0, 906},
+        {0, 18, 0, 909}, {0, 18, 0, 911}, {0, 18, 0, 913}, {0, 18, 0, 915},
+        {230, 40, 0, 0}, {230, 0, 0, 0}, {232, 0, 0, 0}, {220, 0, 0, 0},
+        {216, 40, 0, 0}, {202, 0, 0, 0}, {220, 40, 0, 0}, {202, 40, 0, 0},
+        {1, 0, 0, 0}, {1, 40, 0, 0}, {230, 23, 917, 917}, {230, 23, 919, 919},
+        {230, 23, 921, 921}, {230, 23, 923, 923}, {240, 40, 0, 0}, {233, 0, 0, 0},
+        {234, 0, 0, 0}, {0, 23, 926, 926}, {0, 18, 0, 928}, {0, 23, 931, 931},
+        {0, 19, 933, 936}, {0, 3, 940, 940}, {0, 23, 943, 943}, {0, 3, 945, 945},
+        {0, 3, 948, 948}, {0, 3, 951, 951}, {0, 3, 954, 954}, {0, 3, 957, 957},
+        {0, 3, 960, 960}, {0, 3, 963, 963}, {0, 3, 967, 967}, {0, 3, 970, 970},
+        {0, 3, 973, 973}, {0, 3, 976, 976}, {0, 3, 979, 979}, {0, 3, 982, 982},
+        {0, 3, 985, 985}, {0, 3, 989, 989}, {0, 3, 992, 992}, {0, 3, 995, 995},
+        {0, 3, 998, 998}, {0, 3, 1001, 1001}, {0, 18, 0, 1004}, {0, 18, 0, 1006},
+        {0, 18, 0, 1008}, {0, 19, 1010, 957}, {0, 19, 1013, 970}, {0, 18, 0, 1016},
+        {0, 18, 0, 1018}, {0, 18, 0, 1020}, {0, 18, 0, 1022}, {0, 18, 0, 1024},
+        {0, 18, 0, 1026}, {0, 18, 0, 1028}, {0, 18, 0, 1030}, {0, 3, 1032, 1032},
+        {0, 3, 1035, 1035}, {0, 3, 1038, 1038}, {0, 3, 1041, 1041}, {0, 3, 1044, 1044},
+        {0, 3, 1047, 1047}, {0, 3, 1050, 1050}, {0, 3, 1053, 1053}, {0, 3, 1056, 1056},
+        {0, 3, 1059, 1059}, {0, 3, 1062, 1062}, {0, 3, 1065, 1065}, {0, 3, 1068, 1068},
+        {0, 3, 1071, 1071}, {0, 3, 1074, 1074}, {0, 3, 1077, 1077}, {0, 3, 1080, 1080},
+        {0, 3, 1083, 1083}, {0, 3, 1086, 1086}, {0, 3, 1089, 1089}, {0, 3, 1092, 1092},
+        {0, 3, 1095, 1095}, {0, 3, 1098, 1098}, {0, 3, 1101, 1101}, {0, 3, 1104, 1104},
+        {0, 3, 1107, 1107}, {0, 3, 1110, 1110}, {0, 3, 1113, 1113}, {0, 3, 1116, 1116},
+        {0, 3, 1119, 1119}, {0, 3, 1122, 1122}, {0, 3, 1125, 1125}, {0, 3, 1128, 1128},
+        {0, 3, 1131, 1131}, {0, 3, 1134, 1134}, {0, 3, 1137, 1137}, {0, 3, 1140, 1140},
+        {0, 3, 1143, 1143}, {0, 3, 1146, 1146}, {0, 3, 1149, 1149}, {0, 3, 1152, 1152},
+        {0, 3, 1155, 1155}, {0, 3, 1158, 1158}, {0, 3, 1161, 1161}, {0, 3, 1164, 1164},
+        {0, 3, 1167, 1167}, {0, 3, 1170, 1170}, {0, 3, 1173, 1173}, {0, 3, 1176, 1176},
+        {0, 3, 1179, 1179}, {0, 3, 1182, 1182}, {0, 3, 1185, 1185}, {0, 18, 0, 1188},
+        {222, 0, 0, 0}, {228, 0, 0, 0}, {10, 0, 0, 0}, {11, 0, 0, 0},
+        {12, 0, 0, 0}, {13, 0, 0, 0}, {14, 0, 0, 0}, {15, 0, 0, 0},
+        {16, 0, 0, 0}, {17, 0, 0, 0}, {18, 0, 0, 0}, {19, 0, 0, 0},
+        {20, 0, 0, 0}, {21, 0, 0, 0}, {22, 0, 0, 0}, {23, 0, 0, 0},
+        {24, 0, 0, 0}, {25, 0, 0, 0}, {30, 0, 0, 0}, {31, 0, 0, 0},
+        {32, 0, 0, 0}, {0, 3, 1191, 1191}, {0, 3, 1194, 1194}, {0, 3, 1197, 1197},
+        {0, 3, 1200, 1200}, {0, 3, 1203, 1203}, {27, 0, 0, 0}, {28, 0, 0, 0},
+        {29, 0, 0, 0}, {33, 0, 0, 0}, {34, 0, 0, 0}, {35, 0, 0, 0},
+        {0, 18, 0, 1206}, {0, 18, 0, 1209}, {0, 18, 0, 1212}, {0, 18, 0, 1215},
+        {0, 3, 1218, 1218}, {0, 3, 1221, 1221}, {0, 3, 1224, 1224}, {36, 0, 0, 0},
+        {0, 3, 1227, 1227}, {0, 3, 1230, 1230}, {0, 3, 1233, 1233}, {7, 40, 0, 0},
+        {9, 0, 0, 0}, {0, 23, 1236, 1236}, {0, 23, 1239, 1239}, {0, 23, 1242, 1242},
+        {0, 23, 1245, 1245}, {0, 23, 1248, 1248}, {0, 23, 1251, 1251}, {0, 23, 1254, 1254},
+        {0, 23, 1257, 1257}, {7, 0, 0, 0}, {0, 40, 0, 0}, {0, 3, 1260, 1260},
+        {0, 3, 1263, 1263}, {0, 23, 1266, 1266}, {0, 23, 1269, 1269}, {0, 23, 1272, 1272},
+        {0, 23, 1275, 1275}, {0, 23, 1278, 1278}, {0, 23, 1281, 1281}, {0, 23, 1284, 1284},
+        {0, 23, 1287, 1287}, {0, 23, 1290, 1290}, {0, 3, 1293, 1293}, {0, 3, 1296, 1296},
+        {0, 3, 1299, 1299}, {0, 23, 1302, 1302}, {0, 23, 1305, 1305}, {0, 3, 1308, 1308},
+        {0, 3, 1311, 1311}, {0, 3, 1314, 1314}, {0, 3, 1317, 1317}, {0, 3, 1320, 1320},
+        {84, 0, 0, 0}, {91, 40, 0, 0}, {0, 3, 1323, 1323}, {0, 3, 1326, 1326},
+        {0, 3, 1329, 1329}, {0, 3, 1332, 1332}, {0, 3, 1335, 1335}, {0, 3, 1339, 1339},
+        {0, 3, 1342, 1342}, {0, 3, 1345, 1345}, {9, 40, 0, 0}, {0, 3, 1348, 1348},
+        {0, 3, 1351, 1351}, {0, 3, 1354, 1354}, {0, 3, 1358, 1358}, {0, 18, 0, 1361},
+        {103, 0, 0, 0}, {107, 0, 0, 0}, {0, 18, 0, 1364}, {118, 0, 0, 0},
+        {122, 0, 0, 0}, {0, 18, 0, 1367}, {0, 18, 0, 1370}, {0, 18, 0, 1373},
+        {216, 0, 0, 0}, {0, 23, 1375, 1375}, {0, 23, 1378, 1378}, {0, 23, 1381, 1381},
+        {0, 23, 1384, 1384}, {0, 23, 1387, 1387}, {0, 23, 1390, 1390}, {129, 0, 0, 0},
+        {130, 0, 0, 0}, {0, 23, 1393, 1393}, {132, 0, 0, 0}, {0, 23, 1396, 1396},
+        {0, 23, 1399, 1399}, {0, 18, 0, 1402}, {0, 23, 1406, 1406}, {0, 18, 0, 1409},
+        {0, 23, 1413, 1413}, {0, 23, 1416, 1416}, {0, 23, 1419, 1419}, {0, 23, 1422, 1422},
+        {0, 23, 1425, 1425}, {0, 23, 1428, 1428}, {0, 23, 1431, 1431}, {0, 3, 1434, 1434},
+        {0, 18, 0, 1437}, {0, 3, 1439, 1439}, {0, 3, 1442, 1442}, {0, 3, 1445, 1445},
+        {0, 3, 1448, 1448}, {0, 3, 1451, 1451}, {0, 3, 1454, 1454}, {0, 3, 1457, 1457},
+        {0, 3, 1460, 1460}, {0, 3, 1463, 1463}, {0, 3, 1466, 1466}, {0, 3, 1469, 1469},
+        {0, 18, 0, 1472}, {0, 18, 0, 1474}, {0, 18, 0, 1476}, {0, 18, 0, 1478},
+        {0, 18, 0, 1480}, {0, 18, 0, 1482}, {0, 18, 0, 1484}, {0, 18, 0, 1486},
+        {0, 18, 0, 1488}, {0, 18, 0, 1490}, {0, 18, 0, 1492}, {0, 18, 0, 1494},
+        {0, 18, 0, 1496}, {0, 18, 0, 1498}, {0, 18, 0, 1500}, {0, 18, 0, 1502},
+        {0, 18, 0, 1504}, {0, 18, 0, 1506}, {0, 18, 0, 1508}, {0, 18, 0, 1510},
+        {0, 18, 0, 1512}, {0, 18, 0, 1514}, {0, 18, 0, 1516}, {0, 18, 0, 1518},
+        {0, 18, 0, 1520}, {0, 18, 0, 1522}, {0, 18, 0, 1524}, {0, 18, 0, 1526},
+        {0, 18, 0, 1528}, {0, 18, 0, 1530}, {0, 18, 0, 1532}, {0, 18, 0, 1534},
+        {0, 18, 0, 1536}, {0, 18, 0, 1538}, {0, 18, 0, 1540}, {0, 18, 0, 1542},
+        {0, 18, 0, 1544}, {0, 18, 0, 1546}, {0, 18, 0, 1548}, {0, 18, 0, 1550},
+        {0, 18, 0, 1552}, {0, 18, 0, 1554}, {0, 18, 0, 1556}, {0, 18, 0, 1558},
+        {0, 18, 0, 1560}, {0, 18, 0, 1562}, {0, 18, 0, 1564}, {0, 18, 0, 1566},
+        {0, 18, 0, 1568}, {0, 18, 0, 1570}, {0, 18, 0, 1572}, {0, 18, 0, 1574},
+        {0, 18, 0, 1576}, {0, 18, 0, 1578}, {0, 18, 0, 1580}, {0, 18, 0, 1582},
+        {0, 18, 0, 1584}, {0, 18, 0, 1586}, {0, 18, 0, 1588}, {0, 18, 0, 1590},
+        {0, 18, 0, 1592}, {0, 18, 0, 1594}, {0, 18, 0, 1596}, {0, 18, 0, 1598},
+        {0, 18, 0, 1600}, {0, 18, 0, 1602}, {0, 18, 0, 1604}, {0, 18, 0, 1606},
+        {0, 18, 0, 1608}, {0, 18, 0, 1610}, {0, 18, 0, 1612}, {0, 18, 0, 1614},
+        {0, 18, 0, 1616}, {0, 18, 0, 1618}, {0, 18, 0, 1620}, {0, 18, 0, 1622},
+        {0, 18, 0, 1624}, {0, 18, 0, 1626}, {0, 18, 0, 1628}, {0, 18, 0, 1630},
+        {0, 18, 0, 1632}, {0, 18, 0, 1634}, {0, 18, 0, 1636}, {0, 18, 0, 1638},
+        {214, 0, 0, 0}, {218, 0, 0, 0}, {0, 3, 1640, 1640}, {0, 3, 1643, 1643},
+        {0, 3, 1646, 1646}, {0, 3, 1649, 1649}, {0, 3, 1652, 1652}, {0, 3, 1655, 1655},
+        {0, 3, 1658, 1658}, {0, 3, 1661, 1661}, {0, 3, 1664, 1664}, {0, 3, 1668, 1668},
+        {0, 3, 1672, 1672}, {0, 3, 1675, 1675}, {0, 3, 1678, 1678}, {0, 3, 1681, 1681},
+        {0, 3, 1684, 1684}, {0, 3, 1687, 1687}, {0, 3, 1690, 1690}, {0, 3, 1693, 1693},
+        {0, 3, 1696, 1696}, {0, 3, 1699, 1699}, {0, 3, 1702, 1702}, {0, 3, 1706, 1706},
+        {0, 3, 1710, 1710}, {0, 3, 1714, 1714}, {0, 3, 1718, 1718}, {0, 3, 1721, 1721},
+        {0, 3, 1724, 1724}, {0, 3, 1727, 1727}, {0, 3, 1730, 1730}, {0, 3, 1734, 1734},
+        {0, 3, 1738, 1738}, {0, 3, 1741, 1741}, {0, 3, 1744, 1744}, {0, 3, 1747, 1747},
+        {0, 3, 1750, 1750}, {0, 3, 1753, 1753}, {0, 3, 1756, 1756}, {0, 3, 1759, 1759},
+        {0, 3, 1762, 1762}, {0, 3, 1765, 1765}, {0, 3, 1768, 1768}, {0, 3, 1771, 1771},
+        {0, 3, 1774, 1774}, {0, 3, 1777, 1777}, {0, 3, 1780, 1780}, {0, 3, 1783, 1783},
+        {0, 3, 1786, 1786}, {0, 3, 1790, 1790}, {0, 3, 1794, 1794}, {0, 3, 1797, 1797},
+        {0, 3, 1800, 1800}, {0, 3, 1803, 1803}, {0, 3, 1806, 1806}, {0, 3, 1809, 1809},
+        {0, 3, 1812, 1812}, {0, 3, 1815, 1815}, {0, 3, 1818, 1818}, {0, 3, 1822, 1822},
+        {0, 3, 1826, 1826}, {0, 3, 1829, 1829}, {0, 3, 1832, 1832}, {0, 3, 1835, 1835},
+        {0, 3, 1838, 1838}, {0, 3, 1841, 1841}, {0, 3, 1844, 1844}, {0, 3, 1847, 1847},
+        {0, 3, 1850, 1850}, {0, 3, 1853, 1853}, {0, 3, 1856, 1856}, {0, 3, 1859, 1859},
+        {0, 3, 1862, 1862}, {0, 3, 1865, 1865}, {0, 3, 1868, 1868}, {0, 3, 1871, 1871},
+        {0, 3, 1874, 1874}, {0, 3, 1877, 1877}, {0, 3, 1880, 1880}, {0, 3, 1884, 1884},
+        {0, 3, 1888, 1888}, {0, 3, 1892, 1892}, {0, 3, 1896, 1896}, {0, 3, 1900, 1900},
+        {0, 3, 1904, 1904}, {0, 3, 1908, 1908}, {0, 3, 1912, 1912}, {0, 3, 1915, 1915},
+        {0, 3, 1918, 1918}, {0, 3, 1921, 1921}, {0, 3, 1924, 1924}, {0, 3, 1927, 1927},
+        {0, 3, 1930, 1930}, {0, 3, 1933, 1933}, {0, 3, 1936, 1936}, {0, 3, 1940, 1940},
+        {0, 3, 1944, 1944}, {0, 3, 1947, 1947}, {0, 3, 1950, 1950}, {0, 3, 1953, 1953},
+        {0, 3, 1956, 1956}, {0, 3, 1959, 1959}, {0, 3, 1962, 1962}, {0, 3, 1966, 1966},
+        {0, 3, 1970, 1970}, {0, 3, 1974, 1974}, {0, 3, 1978, 1978}, {0, 3, 1982, 1982},
+        {0, 3, 1986, 1986}, {0, 3, 1989, 1989}, {0, 3, 1992, 1992}, {0, 3, 1995, 1995},
+        {0, 3, 1998, 1998}, {0, 3, 2001, 2001}, {0, 3, 2004, 2004}, {0, 3, 2007, 2007},
+        {0, 3, 2010, 2010}, {0, 3, 2013, 2013}, {0, 3, 2016, 2016}, {0, 3, 2019, 2019},
+        {0, 3, 2022, 2022}, {0, 3, 2025, 2025}, {0, 3, 2028, 2028}, {0, 3, 2032, 2032},
+        {0, 3, 2036, 2036}, {0, 3, 2040, 2040}, {0, 3, 2044, 2044}, {0, 3, 2047, 2047},
+        {0, 3, 2050, 2050}, {0, 3, 2053, 2053}, {0, 3, 2056, 2056}, {0, 3, 2059, 2059},
+        {0, 3, 2062, 2062}, {0, 3, 2065, 2065}, {0, 3, 2068, 2068}, {0, 3, 2071, 2071},
+        {0, 3, 2074, 2074}, {0, 3, 2077, 2077}, {0, 3, 2080, 2080}, {0, 3, 2083, 2083},
+        {0, 3, 2086, 2086}, {0, 3, 2089, 2089}, {0, 3, 2092, 2092}, {0, 3, 2095, 2095},
+        {0, 3, 2098, 2098}, {0, 3, 2101, 2101}, {0, 3, 2104, 2104}, {0, 3, 2107, 2107},
+        {0, 3, 2110, 2110}, {0, 3, 2113, 2113}, {0, 3, 2116, 2116}, {0, 3, 2119, 2119},
+        {0, 3, 2122, 2122}, {0, 3, 2125, 2125}, {0, 3, 2128, 2128}, {0, 3, 2131, 2131},
+        {0, 18, 0, 2134}, {0, 19, 2137, 1953}, {0, 3, 2140, 2140}, {0, 3, 2143, 2143},
+        {0, 3, 2146, 2146}, {0, 3, 2149, 2149}, {0, 3, 2152, 2152}, {0, 3, 2156, 2156},
+        {0, 3, 2160, 2160}, {0, 3, 2164, 2164}, {0, 3, 2168, 2168}, {0, 3, 2172, 2172},
+        {0, 3, 2176, 2176}, {0, 3, 2180, 2180}, {0, 3, 2184, 2184}, {0, 3, 2188, 2188},
+        {0, 3, 2192, 2192}, {0, 3, 2196, 2196}, {0, 3, 2200, 2200}, {0, 3, 2204, 2204},
+        {0, 3, 2208, 2208}, {0, 3, 2212, 2212}, {0, 3, 2216, 2216}, {0, 3, 2220, 2220},
+        {0, 3, 2224, 2224}, {0, 3, 2228, 2228}, {0, 3, 2232, 2232}, {0, 3, 2235, 2235},
+        {0, 3, 2238, 2238}, {0, 3, 2241, 2241}, {0, 3, 2244, 2244}, {0, 3, 2247, 2247},
+        {0, 3, 2250, 2250}, {0, 3, 2254, 2254}, {0, 3, 2258, 2258}, {0, 3, 2262, 2262},
+        {0, 3, 2266, 2266}, {0, 3, 2270, 2270}, {0, 3, 2274, 2274}, {0, 3, 2278, 2278},
+        {0, 3, 2282, 2282}, {0, 3, 2286, 2286}, {0, 3, 2290, 2290}, {0, 3, 2293, 2293},
+        {0, 3, 2296, 2296}, {0, 3, 2299, 2299}, {0, 3, 2302, 2302}, {0, 3, 2305, 2305},
+        {0, 3, 2308, 2308}, {0, 3, 2311, 2311}, {0, 3, 2314, 2314}, {0, 3, 2318, 2318},
+        {0, 3, 2322, 2322}, {0, 3, 2326, 2326}, {0, 3, 2330, 2330}, {0, 3, 2334, 2334},
+        {0, 3, 2338, 2338}, {0, 3, 2342, 2342}, {0, 3, 2346, 2346}, {0, 3, 2350, 2350},
+        {0, 3, 2354, 2354}, {0, 3, 2358, 2358}, {0, 3, 2362, 2362}, {0, 3, 2366, 2366},
+        {0, 3, 2370, 2370}, {0, 3, 2374, 2374}, {0, 3, 2378, 2378}, {0, 3, 2382, 2382},
+        {0, 3, 2386, 2386}, {0, 3, 2390, 2390}, {0, 3, 2394, 2394}, {0, 3, 2397, 2397},
+        {0, 3, 2400, 2400}, {0, 3, 2403, 2403}, {0, 3, 2406, 2406}, {0, 3, 2410, 2410},
+        {0, 3, 2414, 2414}, {0, 3, 2418, 2418}, {0, 3, 2422, 2422}, {0, 3, 2426, 2426},
+        {0, 3, 2430, 2430}, {0, 3, 2434, 2434}, {0, 3, 2438, 2438}, {0, 3, 2442, 2442},
+        {0, 3, 2446, 2446}, {0, 3, 2449, 2449}, {0, 3, 2452, 2452}, {0, 3, 2455, 2455},
+        {0, 3, 2458, 2458}, {0, 3, 2461, 2461}, {0, 3, 2464, 2464}, {0, 3, 2467, 2467},
+        {0, 3, 2470, 2470}, {0, 3, 2473, 2473}, {0, 3, 2476, 2476}, {0, 3, 2480, 2480},
+        {0, 3, 2484, 2484}, {0, 3, 2488, 2488}, {0, 3, 2492, 2492}, {0, 3, 2496, 2496},
+        {0, 3, 2500, 2500}, {0, 3, 2503, 2503}, {0, 3, 2506, 2506}, {0, 3, 2510, 2510},
+        {0, 3, 2514, 2514}, {0, 3, 2518, 2518}, {0, 3, 2522, 2522}, {0, 3, 2526, 2526},
+        {0, 3, 2530, 2530}, {0, 3, 2533, 2533}, {0, 3, 2536, 2536}, {0, 3, 2540, 2540},
+        {0, 3, 2544, 2544}, {0, 3, 2548, 2548}, {0, 3, 2552, 2552}, {0, 3, 2555, 2555},
+        {0, 3, 2558, 2558}, {0, 3, 2562, 2562}, {0, 3, 2566, 2566}, {0, 3, 2570, 2570},
+        {0, 3, 2574, 2574}, {0, 3, 2577, 2577}, {0, 3, 2580, 2580}, {0, 3, 2584, 2584},
+        {0, 3, 2588, 2588}, {0, 3, 2592, 2592}, {0, 3, 2596, 2596}, {0, 3, 2600, 2600},
+        {0, 3, 2604, 2604}, {0, 3, 2607, 2607}, {0, 3, 2610, 2610}, {0, 3, 2614, 2614},
+        {0, 3, 2618, 2618}, {0, 3, 2622, 2622}, {0, 3, 2626, 2626}, {0, 3, 2630, 2630},
+        {0, 3, 2634, 2634}, {0, 3, 2637, 2637}, {0, 3, 2640, 2640}, {0, 3, 2644, 2644},
+        {0, 3, 2648, 2648}, {0, 3, 2652, 2652}, {0, 3, 2656, 2656}, {0, 3, 2660, 2660},
+        {0, 3, 2664, 2664}, {0, 3, 2667, 2667}, {0, 3, 2670, 2670}, {0, 3, 2674, 2674},
+        {0, 3, 2678, 2678}, {0, 3, 2682, 2682}, {0, 3, 2686, 2686}, {0, 3, 2690, 2690},
+        {0, 3, 2694, 2694}, {0, 3, 2697, 2697}, {0, 3, 2700, 2700}, {0, 3, 2704, 2704},
+        {0, 3, 2708, 2708}, {0, 3, 2712, 2712}, {0, 3, 2716, 2716}, {0, 3, 2719, 2719},
+        {0, 3, 2722, 2722}, {0, 3, 2726, 2726}, {0, 3, 2730, 2730}, {0, 3, 2734, 2734},
+        {0, 3, 2738, 2738}, {0, 3, 2741, 2741}, {0, 3, 2744, 2744}, {0, 3, 2748, 2748},
+        {0, 3, 2752, 2752}, {0, 3, 2756, 2756}, {0, 3, 2760, 2760}, {0, 3, 2764, 2764},
+        {0, 3, 2768, 2768}, {0, 3, 2771, 2771}, {0, 3, 2775, 2775}, {0, 3, 2779, 2779},
+        {0, 3, 2783, 2783}, {0, 3, 2786, 2786}, {0, 3, 2789, 2789}, {0, 3, 2793, 2793},
+        {0, 3, 2797, 2797}, {0, 3, 2801, 2801}, {0, 3, 2805, 2805}, {0, 3, 2809, 2809},
+        {0, 3, 2813, 2813}, {0, 3, 2816, 2816}, {0, 3, 2819, 2819}, {0, 3, 2823, 2823},
+        {0, 3, 2827, 2827}, {0, 3, 2831, 2831}, {0, 3, 2835, 2835}, {0, 3, 2839, 2839},
+        {0, 3, 2843, 2843}, {0, 23, 973, 973}, {0, 3, 2846, 2846}, {0, 23, 976, 976},
+        {0, 3, 2849, 2849}, {0, 23, 979, 979}, {0, 3, 2852, 2852}, {0, 23, 982, 982},
+        {0, 3, 2855, 2855}, {0, 23, 995, 995}, {0, 3, 2858, 2858}, {0, 23, 998, 998},
+        {0, 3, 2861, 2861}, {0, 23, 1001, 1001}, {0, 3, 2864, 2864}, {0, 3, 2868, 2868},
+        {0, 3, 2872, 2872}, {0, 3, 2877, 2877}, {0, 3, 2882, 2882}, {0, 3, 2887, 2887},
+        {0, 3, 2892, 2892}, {0, 3, 2897, 2897}, {0, 3, 2902, 2902}, {0, 3, 2906, 2906},
+        {0, 3, 2910, 2910}, {0, 3, 2915, 2915}, {0, 3, 2920, 2920}, {0, 3, 2925, 2925},
+        {0, 3, 2930, 2930}, {0, 3, 2935, 2935}, {0, 3, 2940, 2940}, {0, 3, 2944, 2944},
+        {0, 3, 2948, 2948}, {0, 3, 2953, 2953}, {0, 3, 2958, 2958}, {0, 3, 2963, 2963},
+        {0, 3, 2968, 2968}, {0, 3, 2973, 2973}, {0, 3, 2978, 2978}, {0, 3, 2982, 2982},
+        {0, 3, 2986, 2986}, {0, 3, 2991, 2991}, {0, 3, 2996, 2996}, {0, 3, 3001, 3001},
+        {0, 3, 3006, 3006}, {0, 3, 3011, 3011}, {0, 3, 3016, 3016}, {0, 3, 3020, 3020},
+        {0, 3, 3024, 3024}, {0, 3, 3029, 3029}, {0, 3, 3034, 3034}, {0, 3, 3039, 3039},
+        {0, 3, 3044, 3044}, {0, 3, 3049, 3049}, {0, 3, 3054, 3054}, {0, 3, 3058, 3058},
+        {0, 3, 3062, 3062}, {0, 3, 3067, 3067}, {0, 3, 3072, 3072}, {0, 3, 3077, 3077},
+        {0, 3, 3082, 3082}, {0, 3, 3087, 3087}, {0, 3, 3092, 3092}, {0, 3, 3095, 3095},
+        {0, 3, 3098, 3098}, {0, 3, 3102, 3102}, {0, 3, 3105, 3105}, {0, 3, 3109, 3109},
+        {0, 3, 3112, 3112}, {0, 3, 3116, 3116}, {0, 3, 3119, 3119}, {0, 3, 3122, 3122},
+        {0, 23, 940, 940}, {0, 3, 3125, 3125}, {0, 18, 0, 3128}, {0, 23, 3131, 3131},
+        {0, 18, 0, 3133}, {0, 19, 3136, 3139}, {0, 3, 3143, 3143}, {0, 3, 3147, 3147},
+        {0, 3, 3150, 3150}, {0, 3, 3154, 3154}, {0, 3, 3157, 3157}, {0, 3, 3161, 3161},
+        {0, 23, 945, 945}, {0, 3, 3164, 3164}, {0, 23, 948, 948}, {0, 3, 3167, 3167},
+        {0, 19, 3170, 3173}, {0, 19, 3177, 3180}, {0, 19, 3184, 3187}, {0, 3, 3191, 3191},
+        {0, 3, 3194, 3194}, {0, 3, 3197, 3197}, {0, 23, 963, 963}, {0, 3, 3201, 3201},
+        {0, 3, 3204, 3204}, {0, 3, 3208, 3208}, {0, 3, 3211, 3211}, {0, 3, 3214, 3214},
+        {0, 23, 951, 951}, {0, 19, 3217, 3220}, {0, 19, 3224, 3227}, {0, 19, 3231, 3234},
+        {0, 3, 3238, 3238}, {0, 3, 3241, 3241}, {0, 3, 3244, 3244}, {0, 23, 985, 985},
+        {0, 3, 3248, 3248}, {0, 3, 3251, 3251}, {0, 3, 3254, 3254}, {0, 3, 3257, 3257},
+        {0, 3, 3261, 3261}, {0, 3, 3264, 3264}, {0, 3, 3267, 3267}, {0, 23, 957, 957},
+        {0, 3, 3270, 3270}, {0, 19, 3273, 3276}, {0, 23, 933, 936}, {0, 23, 3280, 3280},
+        {0, 3, 3282, 3282}, {0, 3, 3286, 3286}, {0, 3, 3289, 3289}, {0, 3, 3293, 3293},
+        {0, 3, 3296, 3296}, {0, 3, 3300, 3300}, {0, 23, 954, 954}, {0, 3, 3303, 3303},
+        {0, 23, 960, 960}, {0, 3, 3306, 3306}, {0, 23, 3309, 15}, {0, 18, 0, 3311},
+        {0, 23, 3314, 1}, {0, 23, 3316, 1}, {0, 18, 0, 3318}, {0, 18, 0, 3320},
+        {0, 18, 0, 3323}, {0, 18, 0, 3325}, {0, 18, 0, 3328}, {0, 18, 0, 3332},
+        {0, 18, 0, 3335}, {0, 18, 0, 3339}, {0, 18, 0, 3342}, {0, 18, 0, 3346},
+        {0, 18, 0, 3349}, {0, 18, 0, 3352}, {0, 18, 0, 3355}, {0, 18, 0, 3358},
+        {0, 18, 0, 3361}, {0, 18, 0, 3366}, {0, 18, 0, 3368}, {0, 18, 0, 3370},
+        {0, 18, 0, 3372}, {0, 18, 0, 3374}, {0, 18, 0, 3376}, {0, 18, 0, 3378},
+        {0, 18, 0, 3380}, {0, 18, 0, 3382}, {0, 18, 0, 3384}, {0, 18, 0, 3386},
+        {0, 18, 0, 3388}, {0, 18, 0, 3390}, {0, 18, 0, 3392}, {0, 18, 0, 3395},
+        {0, 18, 0, 3399}, {0, 18, 0, 3403}, {0, 18, 0, 3405}, {0, 18, 0, 3408},
+        {0, 18, 0, 3412}, {0, 18, 0, 3416}, {0, 18, 0, 3418}, {0, 18, 0, 3421},
+        {0, 18, 0, 3423}, {0, 18, 0, 3426}, {0, 18, 0, 3428}, {0, 18, 0, 3431},
+        {0, 18, 0, 3435}, {0, 18, 0, 3438}, {0, 23, 3440, 3440}, {0, 23, 1492, 1492},
+        {0, 23, 54, 54}, {0, 18, 0, 3442}, {0, 18, 0, 3444}, {0, 18, 0, 3446},
+        {0, 18, 0, 3448}, {0, 18, 0, 3450}, {0, 18, 0, 3452}, {0, 18, 0, 3456},
+        {0, 18, 0, 3458}, {0, 18, 0, 3460}, {0, 18, 0, 3462}, {0, 18, 0, 3466},
+        {0, 18, 0, 3470}, {0, 18, 0, 3475}, {0, 18, 0, 3479}, {0, 18, 0, 3483},
+        {0, 18, 0, 3487}, {0, 18, 0, 3491}, {0, 18, 0, 3495}, {0, 18, 0, 3499},
+        {0, 18, 0, 3503}, {0, 18, 0, 3507}, {0, 18, 0, 3511}, {0, 18, 0, 3515},
+        {0, 18, 0, 3519}, {0, 18, 0, 3523}, {0, 18, 0, 3526}, {0, 18, 0, 3529},
+        {0, 18, 0, 3533}, {0, 18, 0, 3536}, {0, 18, 0, 3538}, {0, 18, 0, 3541},
+        {0, 18, 0, 3545}, {0, 18, 0, 3550}, {0, 18, 0, 3553}, {0, 18, 0, 3555},
+        {0, 18, 0, 3558}, {0, 18, 0, 3562}, {0, 18, 0, 3565}, {0, 18, 0, 3569},
+        {0, 18, 0, 3572}, {0, 18, 0, 3575}, {0, 18, 0, 3579}, {0, 18, 0, 3584},
+        {0, 18, 0, 3587}, {0, 18, 0, 3590}, {0, 18, 0, 3594}, {0, 3, 3598, 3598},
+        {0, 3, 3601, 3601}, {0, 3, 3604, 3604}, {0, 3, 3607, 3607}, {0, 3, 3610, 3610},
+        {0, 3, 3613, 3613}, {0, 3, 3616, 3616}, {0, 3, 3619, 3619}, {0, 3, 3622, 3622},
+        {0, 3, 3625, 3625}, {0, 3, 3628, 3628}, {0, 18, 0, 3631}, {0, 18, 0, 3634},
+        {0, 18, 0, 3638}, {0, 18, 0, 3641}, {0, 3, 3645, 3645}, {0, 3, 3648, 3648},
+        {0, 3, 3651, 3651}, {0, 3, 3654, 3654}, {0, 3, 3657, 3657}, {0, 3, 3660, 3660},
+        {0, 3, 3663, 3663}, {0, 3, 3666, 3666}, {0, 3, 3669, 3669}, {0, 3, 3672, 3672},
+        {0, 3, 3675, 3675}, {0, 3, 3678, 3678}, {0, 3, 3681, 3681}, {0, 3, 3684, 3684},
+        {0, 3, 3687, 3687}, {0, 3, 3690, 3690}, {0, 3, 3693, 3693}, {0, 3, 3696, 3696},
+        {0, 3, 3699, 3699}, {0, 3, 3702, 3702}, {0, 3, 3705, 3705}, {0, 3, 3708, 3708},
+        {0, 3, 3711, 3711}, {0, 3, 3714, 3714}, {0, 3, 3717, 3717}, {0, 3, 3720, 3720},
+        {0, 3, 3723, 3723}, {0, 3, 3726, 3726}, {0, 3, 3729, 3729}, {0, 3, 3732, 3732},
+        {0, 3, 3735, 3735}, {0, 3, 3738, 3738}, {0, 3, 3741, 3741}, {0, 23, 3744, 3744},
+        {0, 23, 3746, 3746}, {0, 18, 0, 3748}, {0, 18, 0, 3751}, {0, 18, 0, 3754},
+        {0, 18, 0, 3757}, {0, 18, 0, 3760}, {0, 18, 0, 3763}, {0, 18, 0, 3766},
+        {0, 18, 0, 3769}, {0, 18, 0, 3772}, {0, 18, 0, 3775}, {0, 18, 0, 3778},
+        {0, 18, 0, 3781}, {0, 18, 0, 3785}, {0, 18, 0, 3789}, {0, 18, 0, 3793},
+        {0, 18, 0, 3797}, {0, 18, 0, 3801}, {0, 18, 0, 3805}, {0, 18, 0, 3809},
+        {0, 18, 0, 3813}, {0, 18, 0, 3817}, {0, 18, 0, 3822}, {0, 18, 0, 3827},
+        {0, 18, 0, 3832}, {0, 18, 0, 3837}, {0, 18, 0, 3842}, {0, 18, 0, 3847},
+        {0, 18, 0, 3852}, {0, 18, 0, 3857}, {0, 18, 0, 3862}, {0, 18, 0, 3867},
+        {0, 18, 0, 3872}, {0, 18, 0, 3875}, {0, 18, 0, 3878}, {0, 18, 0, 3881},
+        {0, 18, 0, 3884}, {0, 18, 0, 3887}, {0, 18, 0, 3890}, {0, 18, 0, 3893},
+        {0, 18, 0, 3896}, {0, 18, 0, 3899}, {0, 18, 0, 3903}, {0, 18, 0, 3907},
+        {0, 18, 0, 3911}, {0, 18, 0, 3915}, {0, 18, 0, 3919}, {0, 18, 0, 3923},
+        {0, 18, 0, 3927}, {0, 18, 0, 3931}, {0, 18, 0, 3935}, {0, 18, 0, 3939},
+        {0, 18, 0, 3943}, {0, 18, 0, 3947}, {0, 18, 0, 3951}, {0, 18, 0, 3955},
+        {0, 18, 0, 3959}, {0, 18, 0, 3963}, {0, 18, 0, 3967}, {0, 18, 0, 3971},
+        {0, 18, 0, 3975}, {0, 18, 0, 3979}, {0, 18, 0, 3983}, {0, 18, 0, 3987},
+        {0, 18, 0, 3991}, {0, 18, 0, 3995}, {0, 18, 0, 3999}, {0, 18, 0, 4003},
+        {0, 18, 0, 4007}, {0, 18, 0, 4011}, {0, 18, 0, 4015}, {0, 18, 0, 4019},
+        {0, 18, 0, 4023}, {0, 18, 0, 4027}, {0, 18, 0, 4031}, {0, 18, 0, 4035},
+        {0, 18, 0, 4039}, {0, 18, 0, 4043}, {0, 18, 0, 4047}, {0, 18, 0, 4049},
+        {0, 18, 0, 4051}, {0, 18, 0, 4053}, {0, 18, 0, 4058}, {0, 18, 0, 4062},
+        {0, 18, 0, 4065}, {0, 23, 4069, 4069}, {0, 18, 0, 4072}, {0, 18, 0, 4074},
+        {0, 18, 0, 4076}, {0, 18, 0, 4078}, {0, 18, 0, 4080}, {0, 18, 0, 4082},
+        {0, 18, 0, 4084}, {0, 18, 0, 4086}, {0, 18, 0, 4088}, {0, 18, 0, 4090},
+        {0, 18, 0, 4092}, {0, 18, 0, 4094}, {0, 18, 0, 4096}, {0, 18, 0, 4098},
+        {0, 18, 0, 4100}, {0, 18, 0, 4102}, {0, 18, 0, 4104}, {0, 18, 0, 4106},
+        {0, 18, 0, 4108}, {0, 18, 0, 4110}, {0, 18, 0, 4112}, {0, 18, 0, 4114},
+        {0, 18, 0, 4116}, {0, 18, 0, 4118}, {0, 18, 0, 4120}, {0, 18, 0, 4122},
+        {0, 18, 0, 4124}, {0, 18, 0, 4126}, {0, 18, 0, 4128}, {0, 18, 0, 4130},
+        {0, 18, 0, 4132}, {0, 18, 0, 4134}, {0, 18, 0, 4136}, {0, 18, 0, 4138},
+        {0, 18, 0, 4140}, {0, 18, 0, 4142}, {0, 18, 0, 4144}, {0, 18, 0, 4146},
+        {0, 18, 0, 4148}, {0, 18, 0, 4150}, {0, 18, 0, 4152}, {0, 18, 0, 4154},
+        {0, 18, 0, 4156}, {0, 18, 0, 4158}, {0, 18, 0, 4160}, {0, 18, 0, 4162},
+        {0, 18, 0, 4164}, {0, 18, 0, 4166}, {0, 18, 0, 4168}, {0, 18, 0, 4170},
+        {0, 18, 0, 4172}, {0, 18, 0, 4174}, {0, 18, 0, 4176}, {0, 18, 0, 4178},
+        {0, 18, 0, 4180}, {0, 18, 0, 4182}, {0, 18, 0, 4184}, {0, 18, 0, 4186},
+        {0, 18, 0, 4188}, {0, 18, 0, 4190}, {0, 18, 0, 4192}, {0, 18, 0, 4194},
+        {0, 18, 0, 4196}, {0, 18, 0, 4198}, {0, 18, 0, 4200}, {0, 18, 0, 4202},
+        {0, 18, 0, 4204}, {0, 18, 0, 4206}, {0, 18, 0, 4208}, {0, 18, 0, 4210},
+        {0, 18, 0, 4212}, {0, 18, 0, 4214}, {0, 18, 0, 4216}, {0, 18, 0, 4218},
+        {0, 18, 0, 4220}, {0, 18, 0, 4222}, {0, 18, 0, 4224}, {0, 18, 0, 4226},
+        {0, 18, 0, 4228}, {0, 18, 0, 4230}, {0, 18, 0, 4232}, {0, 18, 0, 4234},
+        {0, 18, 0, 4236}, {0, 18, 0, 4238}, {0, 18, 0, 4240}, {0, 18, 0, 4242},
+        {0, 18, 0, 4244}, {0, 18, 0, 4246}, {0, 18, 0, 4248}, {0, 18, 0, 4250},
+        {0, 18, 0, 4252}, {0, 18, 0, 4254}, {0, 18, 0, 4256}, {0, 18, 0, 4258},
+        {0, 18, 0, 4260}, {0, 18, 0, 4262}, {0, 18, 0, 4264}, {0, 18, 0, 4266},
+        {0, 18, 0, 4268}, {0, 18, 0, 4270}, {0, 18, 0, 4272}, {0, 18, 0, 4274},
+        {0, 18, 0, 4276}, {0, 18, 0, 4278}, {0, 18, 0, 4280}, {0, 18, 0, 4282},
+        {0, 18, 0, 4284}, {0, 18, 0, 4286}, {0, 18, 0, 4288}, {0, 18, 0, 4290},
+        {0, 18, 0, 4292}, {0, 18, 0, 4294}, {0, 18, 0, 4296}, {0, 18, 0, 4298},
+        {0, 18, 0, 4300}, {0, 18, 0, 4302}, {0, 18, 0, 4304}, {0, 18, 0, 4306},
+        {0, 18, 0, 4308}, {0, 18, 0, 4310}, {0, 18, 0, 4312}, {0, 18, 0, 4314},
+        {0, 18, 0, 4316}, {0, 18, 0, 4318}, {0, 18, 0, 4320}, {0, 18, 0, 4322},
+        {0, 18, 0, 4324}, {0, 18, 0, 4326}, {0, 18, 0, 4328}, {0, 18, 0, 4330},
+        {0, 18, 0, 4332}, {0, 18, 0, 4334}, {0, 18, 0, 4336}, {0, 18, 0, 4338},
+        {0, 18, 0, 4340}, {0, 18, 0, 4342}, {0, 18, 0, 4344}, {0, 18, 0, 4346},
+        {0, 18, 0, 4348}, {0, 18, 0, 4350}, {0, 18, 0, 4352}, {0, 18, 0, 4354},
+        {0, 18, 0, 4356}, {0, 18, 0, 4358}, {0, 18, 0, 4360}, {0, 18, 0, 4362},
+        {0, 18, 0, 4364}, {0, 18, 0, 4366}, {0, 18, 0, 4368}, {0, 18, 0, 4370},
+        {0, 18, 0, 4372}, {0, 18, 0, 4374}, {0, 18, 0, 4376}, {0, 18, 0, 4378},
+        {0, 18, 0, 4380}, {0, 18, 0, 4382}, {0, 18, 0, 4384}, {0, 18, 0, 4386},
+        {0, 18, 0, 4388}, {0, 18, 0, 4390}, {0, 18, 0, 4392}, {0, 18, 0, 4394},
+        {0, 18, 0, 4396}, {0, 18, 0, 4398}, {0, 18, 0, 4400}, {0, 18, 0, 4402},
+        {0, 18, 0, 4404}, {0, 18, 0, 4406}, {0, 18, 0, 4408}, {0, 18, 0, 4410},
+        {0, 18, 0, 4412}, {0, 18, 0, 4414}, {0, 18, 0, 4416}, {0, 18, 0, 4418},
+        {0, 18, 0, 4420}, {0, 18, 0, 4422}, {0, 18, 0, 4424}, {0, 18, 0, 4426},
+        {0, 18, 0, 4428}, {0, 18, 0, 4430}, {0, 18, 0, 4432}, {0, 18, 0, 4434},
+        {0, 18, 0, 4436}, {0, 18, 0, 4438}, {0, 18, 0, 4440}, {0, 18, 0, 4442},
+        {0, 18, 0, 4444}, {0, 18, 0, 4446}, {0, 18, 0, 4448}, {0, 18, 0, 4450},
+        {0, 18, 0, 4452}, {0, 18, 0, 4454}, {0, 18, 0, 4456}, {0, 18, 0, 4458},
+        {0, 18, 0, 4460}, {0, 18, 0, 4462}, {0, 18, 0, 4464}, {0, 18, 0, 4466},
+        {0, 18, 0, 4468}, {0, 18, 0, 4470}, {0, 18, 0, 4472}, {0, 18, 0, 4474},
+        {0, 18, 0, 4476}, {0, 18, 0, 4478}, {0, 18, 0, 4480}, {0, 18, 0, 4482},
+        {0, 18, 0, 4484}, {0, 18, 0, 4486}, {0, 18, 0, 4488}, {0, 18, 0, 4490},
+        {0, 18, 0, 4492}, {0, 18, 0, 4494}, {0, 18, 0, 4496}, {0, 18, 0, 4498},
+        {0, 18, 0, 4500}, {0, 18, 0, 4502}, {0, 18, 0, 4504}, {224, 0, 0, 0},
+        {0, 18, 0, 4506}, {0, 18, 0, 4508}, {0, 18, 0, 4510}, {0, 3, 4512, 4512},
+        {0, 3, 4515, 4515}, {0, 3, 4518, 4518}, {0, 3, 4521, 4521}, {0, 3, 4524, 4524},
+        {0, 3, 4527, 4527}, {0, 3, 4530, 4530}, {0, 3, 4533, 4533}, {0, 3, 4536, 4536},
+        {0, 3, 4539, 4539}, {0, 3, 4542, 4542}, {0, 3, 4545, 4545}, {0, 3, 4548, 4548},
+        {0, 3, 4551, 4551}, {0, 3, 4554, 4554}, {0, 3, 4557, 4557}, {0, 3, 4560, 4560},
+        {0, 3, 4563, 4563}, {0, 3, 4566, 4566}, {0, 3, 4569, 4569}, {0, 3, 4572, 4572},
+        {0, 3, 4575, 4575}, {0, 3, 4578, 4578}, {0, 3, 4581, 4581}, {0, 3, 4584, 4584},
+        {0, 3, 4587, 4587}, {8, 40, 0, 0}, {0, 18, 0, 4590}, {0, 18, 0, 4593},
+        {0, 3, 4596, 4596}, {0, 18, 0, 4599}, {0, 3, 4602, 4602}, {0, 3, 4605, 4605},
+        {0, 3, 4608, 4608}, {0, 3, 4611, 4611}, {0, 3, 4614, 4614}, {0, 3, 4617, 4617},
+        {0, 3, 4620, 4620}, {0, 3, 4623, 4623}, {0, 3, 4626, 4626}, {0, 3, 4629, 4629},
+        {0, 3, 4632, 4632}, {0, 3, 4635, 4635}, {0, 3, 4638, 4638}, {0, 3, 4641, 4641},
+        {0, 3, 4644, 4644}, {0, 3, 4647, 4647}, {0, 3, 4650, 4650}, {0, 3, 4653, 4653},
+        {0, 3, 4656, 4656}, {0, 3, 4659, 4659}, {0, 3, 4662, 4662}, {0, 3, 4665, 4665},
+        {0, 3, 4668, 4668}, {0, 3, 4671, 4671}, {0, 3, 4674, 4674}, {0, 3, 4677, 4677},
+        {0, 3, 4680, 4680}, {0, 3, 4683, 4683}, {0, 3, 4686, 4686}, {0, 3, 4689, 4689},
+        {0, 3, 4692, 4692}, {0, 18, 0, 4695}, {0, 18, 0, 4698}, {0, 18, 0, 4700},
+        {0, 18, 0, 4702}, {0, 18, 0, 4704}, {0, 18, 0, 4706}, {0, 18, 0, 4708},
+        {0, 18, 0, 4710}, {0, 18, 0, 4712}, {0, 18, 0, 4714}, {0, 18, 0, 4716},
+        {0, 18, 0, 4718}, {0, 18, 0, 4720}, {0, 18, 0, 4722}, {0, 18, 0, 4724},
+        {0, 18, 0, 4726}, {0, 18, 0, 4728}, {0, 18, 0, 4730}, {0, 18, 0, 4732},
+        {0, 18, 0, 4734}, {0, 18, 0, 4736}, {0, 18, 0, 4738}, {0, 18, 0, 4740},
+        {0, 18, 0, 4742}, {0, 18, 0, 4744}, {0, 18, 0, 4746}, {0, 18, 0, 4748},
+        {0, 18, 0, 4750}, {0, 18, 0, 4752}, {0, 18, 0, 4754}, {0, 18, 0, 4756},
+        {0, 18, 0, 4758}, {0, 18, 0, 4760}, {0, 18, 0, 4762}, {0, 18, 0, 4764},
+        {0, 18, 0, 4766}, {0, 18, 0, 4768}, {0, 18, 0, 4770}, {0, 18, 0, 4772},
+        {0, 18, 0, 4774}, {0, 18, 0, 4776}, {0, 18, 0, 4778}, {0, 18, 0, 4780},
+        {0, 18, 0, 4782}, {0, 18, 0, 4784}, {0, 18, 0, 4786}, {0, 18, 0, 4788},
+        {0, 18, 0, 4790}, {0, 18, 0, 4792}, {0, 18, 0, 4794}, {0, 18, 0, 4796},
+        {0, 18, 0, 4798}, {0, 18, 0, 4800}, {0, 18, 0, 4802}, {0, 18, 0, 4804},
+        {0, 18, 0, 4806}, {0, 18, 0, 4808}, {0, 18, 0, 4810}, {0, 18, 0, 4812},
+        {0, 18, 0, 4814}, {0, 18, 0, 4816}, {0, 18, 0, 4818}, {0, 18, 0, 4820},
+        {0, 18, 0, 4822}, {0, 18, 0, 4824}, {0, 18, 0, 4826}, {0, 18, 0, 4828},
+        {0, 18, 0, 4830}, {0, 18, 0, 4832}, {0, 18, 0, 4834}, {0, 18, 0, 4836},
+        {0, 18, 0, 4838}, {0, 18, 0, 4840}, {0, 18, 0, 4842}, {0, 18, 0, 4844},
+        {0, 18, 0, 4846}, {0, 18, 0, 4848}, {0, 18, 0, 4850}, {0, 18, 0, 4852},
+        {0, 18, 0, 4854}, {0, 18, 0, 4856}, {0, 18, 0, 4858}, {0, 18, 0, 4860},
+        {0, 18, 0, 4862}, {0, 18, 0, 4864}, {0, 18, 0, 4866}, {0, 18, 0, 4868},
+        {0, 18, 0, 4870}, {0, 18, 0, 4872}, {0, 18, 0, 4874}, {0, 18, 0, 4876},
+        {0, 18, 0, 4878}, {0, 18, 0, 4880}, {0, 18, 0, 4882}, {0, 18, 0, 4884},
+        {0, 18, 0, 4886}, {0, 18, 0, 4888}, {0, 18, 0, 4890}, {0, 18, 0, 4892},
+        {0, 18, 0, 4894}, {0, 18, 0, 4896}, {0, 18, 0, 4898}, {0, 18, 0, 4900},
+        {0, 18, 0, 4902}, {0, 18, 0, 4904}, {0, 18, 0, 4906}, {0, 18, 0, 4910},
+        {0, 18, 0, 4914}, {0, 18, 0, 4918}, {0, 18, 0, 4922}, {0, 18, 0, 4926},
+        {0, 18, 0, 4930}, {0, 18, 0, 4934}, {0, 18, 0, 4938}, {0, 18, 0, 4942},
+        {0, 18, 0, 4946}, {0, 18, 0, 4950}, {0, 18, 0, 4954}, {0, 18, 0, 4958},
+        {0, 18, 0, 4962}, {0, 18, 0, 4967}, {0, 18, 0, 4972}, {0, 18, 0, 4977},
+        {0, 18, 0, 4982}, {0, 18, 0, 4987}, {0, 18, 0, 4992}, {0, 18, 0, 4997},
+        {0, 18, 0, 5002}, {0, 18, 0, 5007}, {0, 18, 0, 5012}, {0, 18, 0, 5017},
+        {0, 18, 0, 5022}, {0, 18, 0, 5027}, {0, 18, 0, 5032}, {0, 18, 0, 5037},
+        {0, 18, 0, 5045}, {0, 18, 0, 5052}, {0, 18, 0, 5056}, {0, 18, 0, 5060},
+        {0, 18, 0, 5064}, {0, 18, 0, 5068}, {0, 18, 0, 5072}, {0, 18, 0, 5076},
+        {0, 18, 0, 5080}, {0, 18, 0, 5084}, {0, 18, 0, 5088}, {0, 18, 0, 5092},
+        {0, 18, 0, 5096}, {0, 18, 0, 5100}, {0, 18, 0, 5104}, {0, 18, 0, 5108},
+        {0, 18, 0, 5112}, {0, 18, 0, 5116}, {0, 18, 0, 5120}, {0, 18, 0, 5124},
+        {0, 18, 0, 5128}, {0, 18, 0, 5132}, {0, 18, 0, 5136}, {0, 18, 0, 5140},
+        {0, 18, 0, 5144}, {0, 18, 0, 5148}, {0, 18, 0, 5152}, {0, 18, 0, 5156},
+        {0, 18, 0, 5160}, {0, 18, 0, 5164}, {0, 18, 0, 5168}, {0, 18, 0, 5172},
+        {0, 18, 0, 5176}, {0, 18, 0, 5180}, {0, 18, 0, 5184}, {0, 18, 0, 5188},
+        {0, 18, 0, 5192}, {0, 18, 0, 5196}, {0, 18, 0, 5198}, {0, 18, 0, 5200},
+        {0, 18, 0, 5202}, {0, 18, 0, 5206}, {0, 18, 0, 5209}, {0, 18, 0, 5212},
+        {0, 18, 0, 5215}, {0, 18, 0, 5218}, {0, 18, 0, 5221}, {0, 18, 0, 5224},
+        {0, 18, 0, 5227}, {0, 18, 0, 5230}, {0, 18, 0, 5233}, {0, 18, 0, 5236},
+        {0, 18, 0, 5239}, {0, 18, 0, 5242}, {0, 18, 0, 5245}, {0, 18, 0, 5248},
+        {0, 18, 0, 5251}, {0, 18, 0, 5254}, {0, 18, 0, 5257}, {0, 18, 0, 5260},
+        {0, 18, 0, 5263}, {0, 18, 0, 5266}, {0, 18, 0, 5269}, {0, 18, 0, 5272},
+        {0, 18, 0, 5275}, {0, 18, 0, 5278}, {0, 18, 0, 5281}, {0, 18, 0, 5284},
+        {0, 18, 0, 5287}, {0, 18, 0, 5290}, {0, 18, 0, 5293}, {0, 18, 0, 5299},
+        {0, 18, 0, 5304}, {0, 18, 0, 5307}, {0, 18, 0, 5309}, {0, 18, 0, 5311},
+        {0, 18, 0, 5313}, {0, 18, 0, 5315}, {0, 18, 0, 5317}, {0, 18, 0, 5319},
+        {0, 18, 0, 5321}, {0, 18, 0, 5323}, {0, 18, 0, 5325}, {0, 18, 0, 5327},
+        {0, 18, 0, 5329}, {0, 18, 0, 5331}, {0, 18, 0, 5333}, {0, 18, 0, 5335},
+        {0, 18, 0, 5337}, {0, 18, 0, 5339}, {0, 18, 0, 5341}, {0, 18, 0, 5343},
+        {0, 18, 0, 5345}, {0, 18, 0, 5347}, {0, 18, 0, 5349}, {0, 18, 0, 5351},
+        {0, 18, 0, 5353}, {0, 18, 0, 5355}, {0, 18, 0, 5357}, {0, 18, 0, 5359},
+        {0, 18, 0, 5361}, {0, 18, 0, 5363}, {0, 18, 0, 5365}, {0, 18, 0, 5367},
+        {0, 18, 0, 5369}, {0, 18, 0, 5371}, {0, 18, 0, 5374}, {0, 18, 0, 5377},
+        {0, 18, 0, 5380}, {0, 18, 0, 5383}, {0, 18, 0, 5386}, {0, 18, 0, 5389},
+        {0, 18, 0, 5392}, {0, 18, 0, 5395}, {0, 18, 0, 5398}, {0, 18, 0, 5401},
+        {0, 18, 0, 5404}, {0, 18, 0, 5407}, {0, 18, 0, 5410}, {0, 18, 0, 5413},
+        {0, 18, 0, 5416}, {0, 18, 0, 5419}, {0, 18, 0, 5422}, {0, 18, 0, 5425},
+        {0, 18, 0, 5428}, {0, 18, 0, 5431}, {0, 18, 0, 5434}, {0, 18, 0, 5437},
+        {0, 18, 0, 5440}, {0, 18, 0, 5443}, {0, 18, 0, 5447}, {0, 18, 0, 5451},
+        {0, 18, 0, 5455}, {0, 18, 0, 5458}, {0, 18, 0, 5462}, {0, 18, 0, 5465},
+        {0, 18, 0, 5469}, {0, 18, 0, 5471}, {0, 18, 0, 5473}, {0, 18, 0, 5475},
+        {0, 18, 0, 5477}, {0, 18, 0, 5479}, {0, 18, 0, 5481}, {0, 18, 0, 5483},
+        {0, 18, 0, 5485}, {0, 18, 0, 5487}, {0, 18, 0, 5489}, {0, 18, 0, 5491},
+        {0, 18, 0, 5493}, {0, 18, 0, 5495}, {0, 18, 0, 5497}, {0, 18, 0, 5499},
+        {0, 18, 0, 5501}, {0, 18, 0, 5503}, {0, 18, 0, 5505}, {0, 18, 0, 5507},
+        {0, 18, 0, 5509}, {0, 18, 0, 5511}, {0, 18, 0, 5513}, {0, 18, 0, 5515},
+        {0, 18, 0, 5517}, {0, 18, 0, 5519}, {0, 18, 0, 5521}, {0, 18, 0, 5523},
+        {0, 18, 0, 5525}, {0, 18, 0, 5527}, {0, 18, 0, 5529}, {0, 18, 0, 5531},
+        {0, 18, 0, 5533}, {0, 18, 0, 5535}, {0, 18, 0, 5537}, {0, 18, 0, 5539},
+        {0, 18, 0, 5541}, {0, 18, 0, 5543}, {0, 18, 0, 5545}, {0, 18, 0, 5547},
+        {0, 18, 0, 5549}, {0, 18, 0, 5551}, {0, 18, 0, 5553}, {0, 18, 0, 5555},
+        {0, 18, 0, 5557}, {0, 18, 0, 5559}, {0, 18, 0, 5561}, {0, 18, 0, 5563},
+        {0, 18, 0, 5566}, {0, 18, 0, 5572}, {0, 18, 0, 5577}, {0, 18, 0, 5583},
+        {0, 18, 0, 5587}, {0, 18, 0, 5593}, {0, 18, 0, 5597}, {0, 18, 0, 5601},
+        {0, 18, 0, 5608}, {0, 18, 0, 5613}, {0, 18, 0, 5617}, {0, 18, 0, 5621},
+        {0, 18, 0, 5625}, {0, 18, 0, 5630}, {0, 18, 0, 5635}, {0, 18, 0, 5640},
+        {0, 18, 0, 5645}, {0, 18, 0, 5650}, {0, 18, 0, 5655}, {0, 18, 0, 5660},
+        {0, 18, 0, 5667}, {0, 18, 0, 5670}, {0, 18, 0, 5677}, {0, 18, 0, 5684},
+        {0, 18, 0, 5690}, {0, 18, 0, 5695}, {0, 18, 0, 5702}, {0, 18, 0, 5709},
+        {0, 18, 0, 5714}, {0, 18, 0, 5718}, {0, 18, 0, 5722}, {0, 18, 0, 5727},
+        {0, 18, 0, 5732}, {0, 18, 0, 5738}, {0, 18, 0, 5744}, {0, 18, 0, 5748},
+        {0, 18, 0, 5752}, {0, 18, 0, 5757}, {0, 18, 0, 5761}, {0, 18, 0, 5765},
+        {0, 18, 0, 5768}, {0, 18, 0, 5771}, {0, 18, 0, 5775}, {0, 18, 0, 5779},
+        {0, 18, 0, 5786}, {0, 18, 0, 5791}, {0, 18, 0, 5797}, {0, 18, 0, 5804},
+        {0, 18, 0, 5809}, {0, 18, 0, 5813}, {0, 18, 0, 5817}, {0, 18, 0, 5824},
+        {0, 18, 0, 5829}, {0, 18, 0, 5836}, {0, 18, 0, 5840}, {0, 18, 0, 5846},
+        {0, 18, 0, 5850}, {0, 18, 0, 5855}, {0, 18, 0, 5859}, {0, 18, 0, 5864},
+        {0, 18, 0, 5870}, {0, 18, 0, 5875}, {0, 18, 0, 5881}, {0, 18, 0, 5886},
+        {0, 18, 0, 5889}, {0, 18, 0, 5895}, {0, 18, 0, 5899}, {0, 18, 0, 5903},
+        {0, 18, 0, 5908}, {0, 18, 0, 5912}, {0, 18, 0, 5916}, {0, 18, 0, 5920},
+        {0, 18, 0, 5926}, {0, 18, 0, 5931}, {0, 18, 0, 5934}, {0, 18, 0, 5941},
+        {0, 18, 0, 5945}, {0, 18, 0, 5951}, {0, 18, 0, 5956}, {0, 18, 0, 5961},
+        {0, 18, 0, 5965}, {0, 18, 0, 5969}, {0, 18, 0, 5974}, {0, 18, 0, 5977},
+        {0, 18, 0, 5982}, {0, 18, 0, 5988}, {0, 18, 0, 5991}, {0, 18, 0, 5998},
+        {0, 18, 0, 6002}, {0, 18, 0, 6005}, {0, 18, 0, 6008}, {0, 18, 0, 6011},
+        {0, 18, 0, 6014}, {0, 18, 0, 6017}, {0, 18, 0, 6020}, {0, 18, 0, 6023},
+        {0, 18, 0, 6026}, {0, 18, 0, 6029}, {0, 18, 0, 6032}, {0, 18, 0, 6036},
+        {0, 18, 0, 6040}, {0, 18, 0, 6044}, {0, 18, 0, 6048}, {0, 18, 0, 6052},
+        {0, 18, 0, 6056}, {0, 18, 0, 6060}, {0, 18, 0, 6064}, {0, 18, 0, 6068},
+        {0, 18, 0, 6072}, {0, 18, 0, 6076}, {0, 18, 0, 6080}, {0, 18, 0, 6084},
+        {0, 18, 0, 6088}, {0, 18, 0, 6092}, {0, 18, 0, 6096}, {0, 18, 0, 6099},
+        {0, 18, 0, 6102}, {0, 18, 0, 6106}, {0, 18, 0, 6109}, {0, 18, 0, 6112},
+        {0, 18, 0, 6115}, {0, 18, 0, 6119}, {0, 18, 0, 6123}, {0, 18, 0, 6126},
+        {0, 18, 0, 6129}, {0, 18, 0, 6132}, {0, 18, 0, 6135}, {0, 18, 0, 6138},
+        {0, 18, 0, 6143}, {0, 18, 0, 6146}, {0, 18, 0, 6149}, {0, 18, 0, 6152},
+        {0, 18, 0, 6155}, {0, 18, 0, 6158}, {0, 18, 0, 6161}, {0, 18, 0, 6164},
+        {0, 18, 0, 6167}, {0, 18, 0, 6171}, {0, 18, 0, 6176}, {0, 18, 0, 6179},
+        {0, 18, 0, 6182}, {0, 18, 0, 6185}, {0, 18, 0, 6188}, {0, 18, 0, 6191},
+        {0, 18, 0, 6194}, {0, 18, 0, 6197}, {0, 18, 0, 6201}, {0, 18, 0, 6205},
+        {0, 18, 0, 6209}, {0, 18, 0, 6213}, {0, 18, 0, 6216}, {0, 18, 0, 6219},
+        {0, 18, 0, 6222}, {0, 18, 0, 6225}, {0, 18, 0, 6228}, {0, 18, 0, 6231},
+        {0, 18, 0, 6234}, {0, 18, 0, 6237}, {0, 18, 0, 6240}, {0, 18, 0, 6243},
+        {0, 18, 0, 6247}, {0, 18, 0, 6251}, {0, 18, 0, 6254}, {0, 18, 0, 6258},
+        {0, 18, 0, 6262}, {0, 18, 0, 6266}, {0, 18, 0, 6269}, {0, 18, 0, 6273},
+        {0, 18, 0, 6277}, {0, 18, 0, 6282}, {0, 18, 0, 6285}, {0, 18, 0, 6289},
+        {0, 18, 0, 6293}, {0, 18, 0, 6297}, {0, 18, 0, 6301}, {0, 18, 0, 6307},
+        {0, 18, 0, 6314}, {0, 18, 0, 6317}, {0, 18, 0, 6320}, {0, 18, 0, 6323},
+        {0, 18, 0, 6326}, {0, 18, 0, 6329}, {0, 18, 0, 6332}, {0, 18, 0, 6335},
+        {0, 18, 0, 6338}, {0, 18, 0, 6341}, {0, 18, 0, 6344}, {0, 18, 0, 6347},
+        {0, 18, 0, 6350}, {0, 18, 0, 6353}, {0, 18, 0, 6356}, {0, 18, 0, 6359},
+        {0, 18, 0, 6362}, {0, 18, 0, 6365}, {0, 18, 0, 6368}, {0, 18, 0, 6373},
+        {0, 18, 0, 6376}, {0, 18, 0, 6379}, {0, 18, 0, 6382}, {0, 18, 0, 6387},
+        {0, 18, 0, 6391}, {0, 18, 0, 6394}, {0, 18, 0, 6397}, {0, 18, 0, 6400},
+        {0, 18, 0, 6403}, {0, 18, 0, 6406}, {0, 18, 0, 6409}, {0, 18, 0, 6412},
+        {0, 18, 0, 6415}, {0, 18, 0, 6418}, {0, 18, 0, 6421}, {0, 18, 0, 6425},
+        {0, 18, 0, 6428}, {0, 18, 0, 6431}, {0, 18, 0, 6435}, {0, 18, 0, 6439},
+        {0, 18, 0, 6442}, {0, 18, 0, 6447}, {0, 18, 0, 6451}, {0, 18, 0, 6454},
+        {0, 18, 0, 6457}, {0, 18, 0, 6460}, {0, 18, 0, 6463}, {0, 18, 0, 6467},
+        {0, 18, 0, 6471}, {0, 18, 0, 6474}, {0, 18, 0, 6477}, {0, 18, 0, 6480},
+        {0, 18, 0, 6483}, {0, 18, 0, 6486}, {0, 18, 0, 6489}, {0, 18, 0, 6492},
+        {0, 18, 0, 6495}, {0, 18, 0, 6498}, {0, 18, 0, 6502}, {0, 18, 0, 6506},
+        {0, 18, 0, 6510}, {0, 18, 0, 6514}, {0, 18, 0, 6518}, {0, 18, 0, 6522},
+        {0, 18, 0, 6526}, {0, 18, 0, 6530}, {0, 18, 0, 6534}, {0, 18, 0, 6538},
+        {0, 18, 0, 6542}, {0, 18, 0, 6546}, {0, 18, 0, 6550}, {0, 18, 0, 6554},
+        {0, 18, 0, 6558}, {0, 18, 0, 6562}, {0, 18, 0, 6566}, {0, 18, 0, 6570},
+        {0, 18, 0, 6574}, {0, 18, 0, 6578}, {0, 18, 0, 6582}, {0, 18, 0, 6586},
+        {0, 18, 0, 6590}, {0, 18, 0, 6592}, {0, 18, 0, 6594}, {0, 18, 0, 6596},
+        {0, 18, 0, 6598}, {0, 18, 0, 6600}, {0, 18, 0, 6602}, {0, 18, 0, 6604},
+        {0, 18, 0, 6606}, {0, 18, 0, 6608}, {0, 3, 0, 0}, {0, 23, 6610, 6610},
+        {0, 23, 6612, 6612}, {0, 23, 4394, 4394}, {0, 23, 6614, 6614}, {0, 23, 6616, 6616},
+        {0, 23, 6618, 6618}, {0, 23, 6620, 6620}, {0, 23, 4502, 4502}, {0, 23, 6622, 6622},
+        {0, 23, 4410, 4410}, {0, 23, 6624, 6624}, {0, 23, 6626, 6626}, {0, 23, 6628, 6628},
+        {0, 23, 6630, 6630}, {0, 23, 6632, 6632}, {0, 23, 6634, 6634}, {0, 23, 6636, 6636},
+        {0, 23, 6638, 6638}, {0, 23, 6640, 6640}, {0, 23, 6642, 6642}, {0, 23, 6644, 6644},
+        {0, 23, 6646, 6646}, {0, 23, 6648, 6648}, {0, 23, 6650, 6650}, {0, 23, 6652, 6652},
+        {0, 23, 6654, 6654}, {0, 23, 6656, 6656}, {0, 23, 6658, 6658}, {0, 23, 6660, 6660},
+        {0, 23, 6662, 6662}, {0, 23, 6664, 6664}, {0, 23, 6666, 6666}, {0, 23, 6668, 6668},
+        {0, 23, 6670, 6670}, {0, 23, 6672, 6672}, {0, 23, 6674, 6674}, {0, 23, 6676, 6676},
+        {0, 23, 6678, 6678}, {0, 23, 6680, 6680}, {0, 23, 6682, 6682}, {0, 23, 6684, 6684},
+        {0, 23, 6686, 6686}, {0, 23, 6688, 6688}, {0, 23, 6690, 6690}, {0, 23, 6692, 6692},
+        {0, 23, 6694, 6694}, {0, 23, 6696, 6696}, {0, 23, 6698, 6698}, {0, 23, 6700, 6700},
+        {0, 23, 6702, 6702}, {0, 23, 6704, 6704}, {0, 23, 4326, 4326}, {0, 23, 6706, 6706},
+        {0, 23, 6708, 6708}, {0, 23, 6710, 6710}, {0, 23, 6712, 6712}, {0, 23, 6714, 6714},
+        {0, 23, 6716, 6716}, {0, 23, 6718, 6718}, {0, 23, 6720, 6720}, {0, 23, 6722, 6722},
+        {0, 23, 6724, 6724}, {0, 23, 6726, 6726}, {0, 23, 4472, 4472}, {0, 23, 6728, 6728},
+        {0, 23, 6730, 6730}, {0, 23, 6732, 6732}, {0, 23, 6734, 6734}, {0, 23, 6736, 6736},
+        {0, 23, 6738, 6738}, {0, 23, 6740, 6740}, {0, 23, 6742, 6742}, {0, 23, 6744, 6744},
+        {0, 23, 6746, 6746}, {0, 23, 6748, 6748}, {0, 23, 6750, 6750}, {0, 23, 6752, 6752},
+        {0, 23, 6754, 6754}, {0, 23, 6756, 6756}, {0, 23, 6758, 6758}, {0, 23, 6760, 6760},
+        {0, 23, 6762, 6762}, {0, 23, 6764, 6764}, {0, 23, 6766, 6766}, {0, 23, 6768, 6768},
+        {0, 23, 6770, 6770}, {0, 23, 6772, 6772}, {0, 23, 6774, 6774}, {0, 23, 6776, 6776},
+        {0, 23, 6778, 6778}, {0, 23, 6780, 6780}, {0, 23, 6782, 6782}, {0, 23, 6784, 6784},
+        {0, 23, 6786, 6786}, {0, 23, 6788, 6788}, {0, 23, 6790, 6790}, {0, 23, 6792, 6792},
+        {0, 23, 6794, 6794}, {0, 23, 6796, 6796}, {0, 23, 6798, 6798}, {0, 23, 6800, 6800},
+        {0, 23, 6802, 6802}, {0, 23, 6804, 6804}, {0, 23, 6806, 6806}, {0, 23, 6808, 6808},
+        {0, 23, 6810, 6810}, {0, 23, 6812, 6812}, {0, 23, 6814, 6814}, {0, 23, 6816, 6816},
+        {0, 23, 6818, 6818}, {0, 23, 6820, 6820}, {0, 23, 4398, 4398}, {0, 23, 6822, 6822},
+        {0, 23, 6824, 6824}, {0, 23, 6826, 6826}, {0, 23, 6828, 6828}, {0, 23, 6830, 6830},
+        {0, 23, 6832, 6832}, {0, 23, 6834, 6834}, {0, 23, 6836, 6836}, {0, 23, 6838, 6838},
+        {0, 23, 6840, 6840}, {0, 23, 6842, 6842}, {0, 23, 6844, 6844}, {0, 23, 6846, 6846},
+        {0, 23, 6848, 6848}, {0, 23, 6850, 6850}, {0, 23, 4152, 4152}, {0, 23, 6852, 6852},
+        {0, 23, 6854, 6854}, {0, 23, 6856, 6856}, {0, 23, 6858, 6858}, {0, 23, 6860, 6860},
+        {0, 23, 6862, 6862}, {0, 23, 6864, 6864}, {0, 23, 6866, 6866}, {0, 23, 4114, 4114},
+        {0, 23, 6868, 6868}, {0, 23, 6870, 6870}, {0, 23, 6872, 6872}, {0, 23, 6874, 6874},
+        {0, 23, 6876, 6876}, {0, 23, 6878, 6878}, {0, 23, 6880, 6880}, {0, 23, 6882, 6882},
+        {0, 23, 6884, 6884}, {0, 23, 6886, 6886}, {0, 23, 6888, 6888}, {0, 23, 6890, 6890},
+        {0, 23, 6892, 6892}, {0, 23, 6894, 6894}, {0, 23, 6896, 6896}, {0, 23, 6898, 6898},
+        {0, 23, 6900, 6900}, {0, 23, 6902, 6902}, {0, 23, 6904, 6904}, {0, 23, 6906, 6906},
+        {0, 23, 6908, 6908}, {0, 23, 6910, 6910}, {0, 23, 6912, 6912}, {0, 23, 6914, 6914},
+        {0, 23, 6916, 6916}, {0, 23, 6918, 6918}, {0, 23, 6920, 6920}, {0, 23, 6922, 6922},
+        {0, 23, 6924, 6924}, {0, 23, 6926, 6926}, {0, 23, 6928, 6928}, {0, 23, 6930, 6930},
+        {0, 23, 6932, 6932}, {0, 23, 6934, 6934}, {0, 23, 6936, 6936}, {0, 23, 6938, 6938},
+        {0, 23, 6940, 6940}, {0, 23, 6942, 6942}, {0, 23, 6944, 6944}, {0, 23, 6946, 6946},
+        {0, 23, 6948, 6948}, {0, 23, 6950, 6950}, {0, 23, 6952, 6952}, {0, 23, 6954, 6954},
+        {0, 23, 6956, 6956}, {0, 23, 6958, 6958}, {0, 23, 6960, 6960}, {0, 23, 6962, 6962},
+        {0, 23, 6964, 6964}, {0, 23, 6966, 6966}, {0, 23, 6968, 6968}, {0, 23, 6970, 6970},
+        {0, 23, 6972, 6972}, {0, 23, 6974, 6974}, {0, 23, 4500, 4500}, {0, 23, 6976, 6976},
+        {0, 23, 6978, 6978}, {0, 23, 6980, 6980}, {0, 23, 6982, 6982}, {0, 23, 6984, 6984},
+        {0, 23, 6986, 6986}, {0, 23, 6988, 6988}, {0, 23, 6990, 6990}, {0, 23, 6992, 6992},
+        {0, 23, 6994, 6994}, {0, 23, 6996, 6996}, {0, 23, 6998, 6998}, {0, 23, 5309, 5309},
+        {0, 23, 7000, 7000}, {0, 23, 7002, 7002}, {0, 23, 7004, 7004}, {0, 23, 7006, 7006},
+        {0, 23, 7008, 7008}, {0, 23, 7010, 7010}, {0, 23, 7012, 7012}, {0, 23, 7014, 7014},
+        {0, 23, 7016, 7016}, {0, 23, 7018, 7018}, {0, 23, 7020, 7020}, {0, 23, 7022, 7022},
+        {0, 23, 7024, 7024}, {0, 23, 7026, 7026}, {0, 23, 7028, 7028}, {0, 23, 7030, 7030},
+        {0, 23, 7032, 7032}, {0, 23, 7034, 7034}, {0, 23, 7036, 7036}, {0, 23, 7038, 7038},
+        {0, 23, 7040, 7040}, {0, 23, 7042, 7042}, {0, 23, 4408, 4408}, {0, 23, 7044, 7044},
+        {0, 23, 7046, 7046}, {0, 23, 7048, 7048}, {0, 23, 7050, 7050}, {0, 23, 7052, 7052},
+        {0, 23, 7054, 7054}, {0, 23, 7056, 7056}, {0, 23, 7058, 7058}, {0, 23, 7060, 7060},
+        {0, 23, 7062, 7062}, {0, 23, 7064, 7064}, {0, 23, 7066, 7066}, {0, 23, 7068, 7068},
+        {0, 23, 4310, 4310}, {0, 23, 7070, 7070}, {0, 23, 7072, 7072}, {0, 23, 7074, 7074},
+        {0, 23, 7076, 7076}, {0, 23, 7078, 7078}, {0, 23, 7080, 7080}, {0, 23, 7082, 7082},
+        {0, 23, 7084, 7084}, {0, 23, 7086, 7086}, {0, 23, 7088, 7088}, {0, 23, 7090, 7090},
+        {0, 23, 7092, 7092}, {0, 23, 7094, 7094}, {0, 23, 7096, 7096}, {0, 23, 7098, 7098},
+        {0, 23, 7100, 7100}, {0, 23, 4364, 4364}, {0, 23, 7102, 7102}, {0, 23, 4370, 4370},
+        {0, 23, 7104, 7104}, {0, 23, 7106, 7106}, {0, 23, 7108, 7108}, {0, 23, 7110, 7110},
+        {0, 23, 7112, 7112}, {0, 23, 7114, 7114}, {0, 23, 7116, 7116}, {0, 23, 7118, 7118},
+        {0, 23, 7120, 7120}, {0, 23, 7122, 7122}, {0, 23, 7124, 7124}, {0, 23, 7126, 7126},
+        {0, 23, 7128, 7128}, {0, 23, 7130, 7130}, {0, 23, 4324, 4324}, {0, 23, 7132, 7132},
+        {0, 23, 7134, 7134}, {0, 23, 7136, 7136}, {0, 23, 7138, 7138}, {0, 23, 7140, 7140},
+        {0, 23, 7142, 7142}, {0, 23, 7144, 7144}, {0, 23, 7146, 7146}, {0, 23, 7148, 7148},
+        {0, 23, 7150, 7150}, {0, 23, 7152, 7152}, {0, 23, 7154, 7154}, {0, 23, 7156, 7156},
+        {0, 23, 7158, 7158}, {0, 23, 7160, 7160}, {0, 23, 7162, 7162}, {0, 23, 7164, 7164},
+        {0, 23, 7166, 7166}, {0, 23, 7168, 7168}, {0, 23, 7170, 7170}, {0, 23, 7172, 7172},
+        {0, 23, 7174, 7174}, {0, 23, 4166, 4166}, {0, 23, 7176, 7176}, {0, 23, 7178, 7178},
+        {0, 23, 7180, 7180}, {0, 23, 7182, 7182}, {0, 23, 7184, 7184}, {0, 23, 7186, 7186},
+        {0, 23, 7188, 7188}, {0, 23, 7190, 7190}, {0, 23, 7192, 7192}, {0, 23, 7194, 7194},
+        {0, 23, 7196, 7196}, {0, 23, 7198, 7198}, {0, 23, 7200, 7200}, {0, 23, 7202, 7202},
+        {0, 23, 7204, 7204}, {0, 23, 5319, 5319}, {0, 23, 7206, 7206}, {0, 23, 7208, 7208},
+        {0, 23, 7210, 7210}, {0, 23, 7212, 7212}, {0, 23, 5327, 5327}, {0, 23, 7214, 7214},
+        {0, 23, 7216, 7216}, {0, 23, 7218, 7218}, {0, 23, 7220, 7220}, {0, 23, 7222, 7222},
+        {0, 23, 7224, 7224}, {0, 23, 7226, 7226}, {0, 23, 7228, 7228}, {0, 23, 7230, 7230},
+        {0, 23, 7232, 7232}, {0, 23, 7234, 7234}, {0, 23, 7236, 7236}, {0, 23, 7238, 7238},
+        {0, 23, 7240, 7240}, {0, 23, 7242, 7242}, {0, 23, 7244, 7244}, {0, 23, 7246, 7246},
+        {0, 23, 7248, 7248}, {0, 23, 7250, 7250}, {0, 23, 7252, 7252}, {0, 23, 7254, 7254},
+        {0, 23, 7256, 7256}, {0, 23, 7258, 7258}, {0, 23, 7260, 7260}, {0, 23, 7262, 7262},
+        {0, 23, 7264, 7264}, {0, 23, 7266, 7266}, {0, 23, 7268, 7268}, {0, 23, 7270, 7270},
+        {0, 23, 7272, 7272}, {0, 23, 7274, 7274}, {0, 23, 7276, 7276}, {0, 23, 7278, 7278},
+        {0, 23, 7280, 7280}, {0, 23, 7282, 7282}, {0, 23, 7284, 7284}, {0, 23, 7286, 7286},
+        {0, 23, 7288, 7288}, {0, 23, 7290, 7290}, {0, 23, 7292, 7292}, {0, 23, 7294, 7294},
+        {0, 23, 7296, 7296}, {0, 23, 7298, 7298}, {0, 23, 7300, 7300}, {0, 23, 7302, 7302},
+        {0, 23, 7304, 7304}, {0, 23, 7306, 7306}, {0, 23, 7308, 7308}, {0, 23, 7310, 7310},
+        {0, 23, 7312, 7312}, {0, 23, 7314, 7314}, {0, 23, 7316, 7316}, {0, 23, 7318, 7318},
+        {0, 23, 7320, 7320}, {0, 23, 7322, 7322}, {0, 23, 7324, 7324}, {0, 23, 4232, 4232},
+        {0, 23, 7326, 7326}, {0, 23, 7328, 7328}, {0, 23, 7330, 7330}, {0, 23, 7332, 7332},
+        {0, 23, 7334, 7334}, {0, 23, 7336, 7336}, {0, 23, 7338, 7338}, {0, 23, 7340, 7340},
+        {0, 23, 7342, 7342}, {0, 23, 7344, 7344}, {0, 23, 7346, 7346}, {0, 23, 7348, 7348},
+        {0, 23, 7350, 7350}, {0, 23, 7352, 7352}, {0, 23, 7354, 7354}, {0, 23, 7356, 7356},
+        {0, 23, 7358, 7358}, {0, 23, 7360, 7360}, {0, 23, 7362, 7362}, {0, 23, 7364, 7364},
+        {0, 23, 7366, 7366}, {0, 23, 7368, 7368}, {0, 23, 7370, 7370}, {0, 23, 7372, 7372},
+        {0, 23, 7374, 7374}, {0, 23, 7376, 7376}, {0, 23, 7378, 7378}, {0, 23, 7380, 7380},
+        {0, 23, 7382, 7382}, {0, 23, 7384, 7384}, {0, 23, 7386, 7386}, {0, 23, 7388, 7388},
+        {0, 23, 7390, 7390}, {0, 23, 7392, 7392}, {0, 23, 7394, 7394}, {0, 23, 7396, 7396},
+        {0, 23, 7398, 7398}, {0, 23, 7400, 7400}, {0, 23, 7402, 7402}, {0, 23, 7404, 7404},
+        {0, 23, 7406, 7406}, {0, 23, 7408, 7408}, {0, 23, 7410, 7410}, {0, 23, 7412, 7412},
+        {0, 23, 7414, 7414}, {0, 23, 7416, 7416}, {0, 23, 7418, 7418}, {0, 23, 7420, 7420},
+        {0, 18, 0, 7422}, {0, 18, 0, 7425}, {0, 18, 0, 7428}, {0, 18, 0, 7431},
+        {0, 18, 0, 7435}, {0, 18, 0, 7439}, {0, 18, 0, 7442}, {0, 18, 0, 7445},
+        {0, 18, 0, 7448}, {0, 18, 0, 7451}, {0, 18, 0, 7454}, {0, 23, 7457, 7457},
+        {26, 0, 0, 0}, {0, 23, 7460, 7460}, {0, 18, 0, 7463}, {0, 18, 0, 7465},
+        {0, 18, 0, 7467}, {0, 18, 0, 7469}, {0, 18, 0, 7471}, {0, 18, 0, 7473},
+        {0, 18, 0, 7475}, {0, 23, 7477, 7477}, {0, 23, 7480, 7480}, {0, 23, 7483, 7483},
+        {0, 23, 7487, 7487}, {0, 23, 7491, 7491}, {0, 23, 7494, 7494}, {0, 23, 7497, 7497},
+        {0, 23, 7500, 7500}, {0, 23, 7503, 7503}, {0, 23, 7506, 7506}, {0, 23, 7509, 7509},
+        {0, 23, 7512, 7512}, {0, 23, 7515, 7515}, {0, 23, 7518, 7518}, {0, 23, 7521, 7521},
+        {0, 23, 7524, 7524}, {0, 23, 7527, 7527}, {0, 23, 7530, 7530}, {0, 23, 7533, 7533},
+        {0, 23, 7536, 7536}, {0, 23, 7539, 7539}, {0, 23, 7542, 7542}, {0, 23, 7545, 7545},
+        {0, 23, 7548, 7548}, {0, 23, 7551, 7551}, {0, 23, 7554, 7554}, {0, 23, 7557, 7557},
+        {0, 23, 7560, 7560}, {0, 23, 7563, 7563}, {0, 23, 7566, 7566}, {0, 23, 7569, 7569},
+        {0, 23, 7572, 7572}, {0, 18, 0, 7575}, {0, 18, 0, 7578}, {0, 18, 0, 7580},
+        {0, 18, 0, 7582}, {0, 18, 0, 7584}, {0, 18, 0, 7586}, {0, 18, 0, 7588},
+        {0, 18, 0, 7590}, {0, 18, 0, 7592}, {0, 18, 0, 7594}, {0, 18, 0, 7596},
+        {0, 18, 0, 7598}, {0, 18, 0, 7600}, {0, 18, 0, 7602}, {0, 18, 0, 7604},
+        {0, 18, 0, 7606}, {0, 18, 0, 7608}, {0, 18, 0, 7610}, {0, 18, 0, 7612},
+        {0, 18, 0, 7614}, {0, 18, 0, 7616}, {0, 18, 0, 7618}, {0, 18, 0, 7620},
+        {0, 18, 0, 7622}, {0, 18, 0, 7624}, {0, 18, 0, 7626}, {0, 18, 0, 1218},
+        {0, 18, 0, 7628}, {0, 18, 0, 7630}, {0, 18, 0, 7632}, {0, 18, 0, 1224},
+        {0, 18, 0, 7634}, {0, 18, 0, 7636}, {0, 18, 0, 7638}, {0, 18, 0, 7640},
+        {0, 18, 0, 7642}, {0, 18, 0, 7644}, {0, 18, 0, 7646}, {0, 18, 0, 7648},
+        {0, 18, 0, 7650}, {0, 18, 0, 7652}, {0, 18, 0, 7656}, {0, 18, 0, 7660},
+        {0, 18, 0, 7664}, {0, 18, 0, 7668}, {0, 18, 0, 7672}, {0, 18, 0, 7676},
+        {0, 18, 0, 7680}, {0, 18, 0, 7684}, {0, 18, 0, 7686}, {0, 18, 0, 7690},
+        {0, 18, 0, 7694}, {0, 18, 0, 7698}, {0, 18, 0, 7702}, {0, 18, 0, 7705},
+        {0, 18, 0, 7708}, {0, 18, 0, 7711}, {0, 18, 0, 7714}, {0, 18, 0, 7717},
+        {0, 18, 0, 7720}, {0, 18, 0, 7723}, {0, 18, 0, 7726}, {0, 18, 0, 7729},
+        {0, 18, 0, 7732}, {0, 18, 0, 7735}, {0, 18, 0, 7738}, {0, 18, 0, 7741},
+        {0, 18, 0, 7744}, {0, 18, 0, 7747}, {0, 18, 0, 7750}, {0, 18, 0, 7753},
+        {0, 18, 0, 7756}, {0, 18, 0, 7759}, {0, 18, 0, 7762}, {0, 18, 0, 7765},
+        {0, 18, 0, 7768}, {0, 18, 0, 7771}, {0, 18, 0, 7774}, {0, 18, 0, 7777},
+        {0, 18, 0, 7780}, {0, 18, 0, 7783}, {0, 18, 0, 7786}, {0, 18, 0, 7789},
+        {0, 18, 0, 7792}, {0, 18, 0, 7795}, {0, 18, 0, 7798}, {0, 18, 0, 7801},
+        {0, 18, 0, 7804}, {0, 18, 0, 7807}, {0, 18, 0, 7810}, {0, 18, 0, 7813},
+        {0, 18, 0, 7816}, {0, 18, 0, 7819}, {0, 18, 0, 7822}, {0, 18, 0, 7825},
+        {0, 18, 0, 7828}, {0, 18, 0, 7831}, {0, 18, 0, 7834}, {0, 18, 0, 7837},
+        {0, 18, 0, 7840}, {0, 18, 0, 7843}, {0, 18, 0, 7846}, {0, 18, 0, 7849},
+        {0, 18, 0, 7852}, {0, 18, 0, 7855}, {0, 18, 0, 7858}, {0, 18, 0, 7861},
+        {0, 18, 0, 7864}, {0, 18, 0, 7867}, {0, 18, 0, 7870}, {0, 18, 0, 7873},
+        {0, 18, 0, 7876}, {0, 18, 0, 7879}, {0, 18, 0, 7882}, {0, 18, 0, 7885},
+        {0, 18, 0, 7888}, {0, 18, 0, 7891}, {0, 18, 0, 7894}, {0, 18, 0, 7897},
+        {0, 18, 0, 7900}, {0, 18, 0, 7903}, {0, 18, 0, 7906}, {0, 18, 0, 7909},
+        {0, 18, 0, 7912}, {0, 18, 0, 7915}, {0, 18, 0, 7918}, {0, 18, 0, 7921},
+        {0, 18, 0, 7924}, {0, 18, 0, 7927}, {0, 18, 0, 7930}, {0, 18, 0, 7933},
+        {0, 18, 0, 7936}, {0, 18, 0, 7939}, {0, 18, 0, 7942}, {0, 18, 0, 7945},
+        {0, 18, 0, 7948}, {0, 18, 0, 7951}, {0, 18, 0, 7954}, {0, 18, 0, 7957},
+        {0, 18, 0, 7960}, {0, 18, 0, 7963}, {0, 18, 0, 7966}, {0, 18, 0, 7969},
+        {0, 18, 0, 7973}, {0, 18, 0, 7977}, {0, 18, 0, 7981}, {0, 18, 0, 7985},
+        {0, 18, 0, 7989}, {0, 18, 0, 7993}, {0, 18, 0, 7997}, {0, 18, 0, 8001},
+        {0, 18, 0, 8005}, {0, 18, 0, 8008}, {0, 18, 0, 8011}, {0, 18, 0, 8014},
+        {0, 18, 0, 8017}, {0, 18, 0, 8020}, {0, 18, 0, 8023}, {0, 18, 0, 8026},
+        {0, 18, 0, 8029}, {0, 18, 0, 8032}, {0, 18, 0, 8035}, {0, 18, 0, 8038},
+        {0, 18, 0, 8041}, {0, 18, 0, 8044}, {0, 18, 0, 8047}, {0, 18, 0, 8050},
+        {0, 18, 0, 8053}, {0, 18, 0, 8057}, {0, 18, 0, 8061}, {0, 18, 0, 8064},
+        {0, 18, 0, 8067}, {0, 18, 0, 8070}, {0, 18, 0, 8073}, {0, 18, 0, 8076},
+        {0, 18, 0, 8079}, {0, 18, 0, 8082}, {0, 18, 0, 8085}, {0, 18, 0, 8088},
+        {0, 18, 0, 8091}, {0, 18, 0, 8094}, {0, 18, 0, 8098}, {0, 18, 0, 8102},
+        {0, 18, 0, 8106}, {0, 18, 0, 8109}, {0, 18, 0, 8112}, {0, 18, 0, 8115},
+        {0, 18, 0, 8118}, {0, 18, 0, 8121}, {0, 18, 0, 8124}, {0, 18, 0, 8127},
+        {0, 18, 0, 8130}, {0, 18, 0, 8133}, {0, 18, 0, 8136}, {0, 18, 0, 8139},
+        {0, 18, 0, 8142}, {0, 18, 0, 8145}, {0, 18, 0, 8148}, {0, 18, 0, 8151},
+        {0, 18, 0, 8154}, {0, 18, 0, 8157}, {0, 18, 0, 8160}, {0, 18, 0, 8163},
+        {0, 18, 0, 8166}, {0, 18, 0, 8169}, {0, 18, 0, 8172}, {0, 18, 0, 8175},
+        {0, 18, 0, 8178}, {0, 18, 0, 8181}, {0, 18, 0, 8184}, {0, 18, 0, 8187},
+        {0, 18, 0, 8190}, {0, 18, 0, 8194}, {0, 18, 0, 8198}, {0, 18, 0, 8202},
+        {0, 18, 0, 8206}, {0, 18, 0, 8210}, {0, 18, 0, 8214}, {0, 18, 0, 8218},
+        {0, 18, 0, 8222}, {0, 18, 0, 8226}, {0, 18, 0, 8230}, {0, 18, 0, 8234},
+        {0, 18, 0, 8238}, {0, 18, 0, 8242}, {0, 18, 0, 8246}, {0, 18, 0, 8250},
+        {0, 18, 0, 8254}, {0, 18, 0, 8258}, {0, 18, 0, 8262}, {0, 18, 0, 8266},
+        {0, 18, 0, 8270}, {0, 18, 0, 8274}, {0, 18, 0, 8278}, {0, 18, 0, 8282},
+        {0, 18, 0, 8286}, {0, 18, 0, 8290}, {0, 18, 0, 8294}, {0, 18, 0, 8298},
+        {0, 18, 0, 8302}, {0, 18, 0, 8306}, {0, 18, 0, 8310}, {0, 18, 0, 8314},
+        {0, 18, 0, 8318}, {0, 18, 0, 8322}, {0, 18, 0, 8326}, {0, 18, 0, 8330},
+        {0, 18, 0, 8334}, {0, 18, 0, 8338}, {0, 18, 0, 8342}, {0, 18, 0, 8346},
+        {0, 18, 0, 8350}, {0, 18, 0, 8354}, {0, 18, 0, 8358}, {0, 18, 0, 8362},
+        {0, 18, 0, 8366}, {0, 18, 0, 8370}, {0, 18, 0, 8374}, {0, 18, 0, 8378},
+        {0, 18, 0, 8382}, {0, 18, 0, 8386}, {0, 18, 0, 8390}, {0, 18, 0, 8394},
+        {0, 18, 0, 8398}, {0, 18, 0, 8402}, {0, 18, 0, 8406}, {0, 18, 0, 8410},
+        {0, 18, 0, 8414}, {0, 18, 0, 8418}, {0, 18, 0, 8422}, {0, 18, 0, 8426},
+        {0, 18, 0, 8430}, {0, 18, 0, 8434}, {0, 18, 0, 8438}, {0, 18, 0, 8442},
+        {0, 18, 0, 8446}, {0, 18, 0, 8450}, {0, 18, 0, 8454}, {0, 18, 0, 8458},
+        {0, 18, 0, 8462}, {0, 18, 0, 8466}, {0, 18, 0, 8470}, {0, 18, 0, 8474},
+        {0, 18, 0, 8478}, {0, 18, 0, 8482}, {0, 18, 0, 8486}, {0, 18, 0, 8490},
+        {0, 18, 0, 8494}, {0, 18, 0, 8498}, {0, 18, 0, 8502}, {0, 18, 0, 8506},
+        {0, 18, 0, 8510}, {0, 18, 0, 8514}, {0, 18, 0, 8518}, {0, 18, 0, 8522},
+        {0, 18, 0, 8526}, {0, 18, 0, 8530}, {0, 18, 0, 8534}, {0, 18, 0, 8538},
+        {0, 18, 0, 8542}, {0, 18, 0, 8546}, {0, 18, 0, 8550}, {0, 18, 0, 8554},
+        {0, 18, 0, 8558}, {0, 18, 0, 8562}, {0, 18, 0, 8566}, {0, 18, 0, 8570},
+        {0, 18, 0, 8574}, {0, 18, 0, 8579}, {0, 18, 0, 8584}, {0, 18, 0, 8589},
+        {0, 18, 0, 8594}, {0, 18, 0, 8599}, {0, 18, 0, 8604}, {0, 18, 0, 8609},
+        {0, 18, 0, 8613}, {0, 18, 0, 8632}, {0, 18, 0, 8641}, {0, 18, 0, 8646},
+        {0, 18, 0, 8648}, {0, 18, 0, 8650}, {0, 18, 0, 8652}, {0, 18, 0, 931},
+        {0, 18, 0, 8654}, {0, 18, 0, 8656}, {0, 18, 0, 8658}, {0, 18, 0, 8660},
+        {0, 18, 0, 8662}, {0, 18, 0, 8664}, {0, 18, 0, 8666}, {0, 18, 0, 8668},
+        {0, 18, 0, 8670}, {0, 18, 0, 8672}, {0, 18, 0, 8674}, {0, 18, 0, 8676},
+        {0, 18, 0, 8678}, {0, 18, 0, 8680}, {0, 18, 0, 8682}, {0, 18, 0, 3744},
+        {0, 18, 0, 3746}, {0, 18, 0, 8684}, {0, 18, 0, 8686}, {0, 18, 0, 8688},
+        {0, 18, 0, 8690}, {0, 18, 0, 8692}, {0, 18, 0, 8694}, {0, 18, 0, 8696},
+        {0, 18, 0, 8698}, {0, 18, 0, 8700}, {0, 18, 0, 8702}, {0, 18, 0, 8704},
+        {0, 18, 0, 8706}, {0, 18, 0, 8708}, {0, 18, 0, 8710}, {0, 18, 0, 8712},
+        {0, 18, 0, 8714}, {0, 18, 0, 8716}, {0, 18, 0, 8719}, {0, 18, 0, 8722},
+        {0, 18, 0, 8725}, {0, 18, 0, 8728}, {0, 18, 0, 8731}, {0, 18, 0, 8734},
+        {0, 18, 0, 8737}, {0, 18, 0, 8740}, {0, 18, 0, 8743}, {0, 18, 0, 8746},
+        {0, 18, 0, 8749}, {0, 18, 0, 8752}, {0, 18, 0, 8755}, {0, 18, 0, 8758},
+        {0, 18, 0, 1191}, {0, 18, 0, 1194}, {0, 18, 0, 1197}, {0, 18, 0, 1200},
+        {0, 18, 0, 1203}, {0, 18, 0, 8760}, {0, 18, 0, 8762}, {0, 18, 0, 8764},
+        {0, 18, 0, 8766}, {0, 18, 0, 8768}, {0, 18, 0, 8770}, {0, 18, 0, 8772},
+        {0, 18, 0, 8774}, {0, 18, 0, 8776}, {0, 18, 0, 8778}, {0, 18, 0, 8780},
+        {0, 18, 0, 8782}, {0, 18, 0, 8784}, {0, 18, 0, 8786}, {0, 18, 0, 8788},
+        {0, 18, 0, 8790}, {0, 18, 0, 8792}, {0, 18, 0, 8794}, {0, 18, 0, 8796},
+        {0, 18, 0, 8798}, {0, 18, 0, 8800}, {0, 18, 0, 8802}, {0, 18, 0, 8804},
+        {0, 18, 0, 8806}, {0, 18, 0, 8808}, {0, 18, 0, 8810}, {0, 18, 0, 8812},
+        {0, 18, 0, 8814}, {0, 18, 0, 8816}, {0, 18, 0, 8818}, {0, 18, 0, 8822},
+        {0, 18, 0, 8826}, {0, 18, 0, 8830}, {0, 18, 0, 8833}, {0, 18, 0, 8835},
+        {0, 18, 0, 8837}, {0, 18, 0, 8839}, {0, 18, 0, 3280}, {0, 18, 0, 8841},
+        {0, 18, 0, 8843}, {0, 18, 0, 8845}, {0, 18, 0, 8847}, {0, 18, 0, 8849},
+        {0, 18, 0, 8851}, {0, 18, 0, 8853}, {0, 18, 0, 8855}, {0, 18, 0, 8857},
+        {0, 18, 0, 8859}, {0, 18, 0, 8861}, {0, 18, 0, 8863}, {0, 18, 0, 8865},
+        {0, 18, 0, 8867}, {0, 18, 0, 8869}, {0, 18, 0, 8871}, {0, 18, 0, 8873},
+        {0, 18, 0, 8875}, {0, 18, 0, 8877}, {0, 18, 0, 8879}, {0, 18, 0, 8881},
+        {0, 18, 0, 8883}, {0, 18, 0, 8885}, {0, 18, 0, 8887}, {0, 18, 0, 8889},
+        {0, 18, 0, 8891}, {0, 18, 0, 8893}, {0, 18, 0, 8895}, {0, 18, 0, 8897},
+        {0, 18, 0, 8899}, {0, 18, 0, 8901}, {0, 18, 0, 8903}, {0, 18, 0, 8905},
+        {0, 18, 0, 8907}, {0, 18, 0, 8909}, {0, 18, 0, 8911}, {0, 18, 0, 8913},
+        {0, 18, 0, 8915}, {0, 18, 0, 8917}, {0, 18, 0, 8919}, {0, 18, 0, 8921},
+        {0, 18, 0, 8923}, {0, 18, 0, 8925}, {0, 18, 0, 8927}, {0, 18, 0, 8929},
+        {0, 18, 0, 8931}, {0, 18, 0, 8933}, {0, 18, 0, 8935}, {0, 18, 0, 8937},
+        {0, 18, 0, 8939}, {0, 18, 0, 8941}, {0, 18, 0, 8943}, {0, 18, 0, 8945},
+        {0, 18, 0, 8947}, {0, 18, 0, 8949}, {0, 18, 0, 8951}, {0, 18, 0, 8953},
+        {0, 18, 0, 8955}, {0, 18, 0, 8957}, {0, 18, 0, 8959}, {0, 18, 0, 8961},
+        {0, 18, 0, 8963}, {0, 18, 0, 8965}, {0, 18, 0, 8967}, {0, 18, 0, 8969},
+        {0, 18, 0, 8971}, {0, 18, 0, 8973}, {0, 18, 0, 8975}, {0, 18, 0, 8977},
+        {0, 18, 0, 8979}, {0, 18, 0, 8981}, {0, 18, 0, 8983}, {0, 18, 0, 8985},
+        {0, 18, 0, 8987}, {0, 18, 0, 8989}, {0, 18, 0, 8991}, {0, 18, 0, 8993},
+        {0, 18, 0, 8995}, {0, 18, 0, 8997}, {0, 18, 0, 8999}, {0, 18, 0, 9001},
+        {0, 18, 0, 9003}, {0, 18, 0, 9005}, {0, 18, 0, 9007}, {0, 18, 0, 9009},
+        {0, 3, 9011, 9011}, {0, 3, 9014, 9014}, {0, 3, 9017, 9017}, {0, 3, 9020, 9020},
+        {0, 3, 9023, 9023}, {0, 3, 9026, 9026}, {0, 3, 9029, 9029}, {0, 3, 9032, 9032},
+        {0, 3, 9035, 9035}, {0, 3, 9038, 9038}, {0, 3, 9041, 9041}, {0, 3, 9044, 9044},
+        {0, 3, 9047, 9047}, {6, 0, 0, 0}, {0, 23, 9050, 9050}, {0, 23, 9053, 9053},
+        {0, 23, 9056, 9056}, {0, 23, 9060, 9060}, {0, 23, 9064, 9064}, {0, 23, 9068, 9068},
+        {0, 23, 9072, 9072}, {226, 0, 0, 0}, {0, 23, 9076, 9076}, {0, 23, 9079, 9079},
+        {0, 23, 9082, 9082}, {0, 23, 9086, 9086}, {0, 23, 9090, 9090}, {0, 23, 9094, 9094},
+        {0, 18, 0, 9098}, {0, 18, 0, 9100}, {0, 18, 0, 9102}, {0, 18, 0, 9104},
+        {0, 18, 0, 9106}, {0, 18, 0, 9108}, {0, 18, 0, 9110}, {0, 18, 0, 9112},
+        {0, 18, 0, 9114}, {0, 18, 0, 9116}, {0, 18, 0, 9118}, {0, 18, 0, 9120},
+        {0, 18, 0, 9122}, {0, 18, 0, 9124}, {0, 18, 0, 9126}, {0, 18, 0, 9128},
+        {0, 18, 0, 9130}, {0, 18, 0, 9132}, {0, 18, 0, 9134}, {0, 18, 0, 9136},
+        {0, 18, 0, 3440}, {0, 18, 0, 9138}, {0, 18, 0, 9140}, {0, 18, 0, 9142},
+        {0, 18, 0, 9144}, {0, 18, 0, 3131}, {0, 18, 0, 9146}, {0, 18, 0, 9148},
+        {0, 18, 0, 9150}, {0, 18, 0, 9152}, {0, 18, 0, 9154}, {0, 18, 0, 9156},
+        {0, 18, 0, 9158}, {0, 18, 0, 9160}, {0, 18, 0, 9162}, {0, 18, 0, 9164},
+        {0, 18, 0, 9166}, {0, 18, 0, 9168}, {0, 18, 0, 9170}, {0, 18, 0, 9172},
+        {0, 18, 0, 9174}, {0, 18, 0, 9176}, {0, 18, 0, 9179}, {0, 18, 0, 9182},
+        {0, 18, 0, 9185}, {0, 18, 0, 9188}, {0, 18, 0, 9191}, {0, 18, 0, 9194},
+        {0, 18, 0, 9197}, {0, 18, 0, 9200}, {0, 18, 0, 9203}, {0, 18, 0, 9206},
+        {0, 18, 0, 9209}, {0, 18, 0, 9213}, {0, 18, 0, 9217}, {0, 18, 0, 9221},
+        {0, 18, 0, 9225}, {0, 18, 0, 9229}, {0, 18, 0, 9233}, {0, 18, 0, 9237},
+        {0, 18, 0, 9241}, {0, 18, 0, 9245}, {0, 18, 0, 9249}, {0, 18, 0, 9253},
+        {0, 18, 0, 9257}, {0, 18, 0, 9261}, {0, 18, 0, 9265}, {0, 18, 0, 9269},
+        {0, 18, 0, 9273}, {0, 18, 0, 9277}, {0, 18, 0, 9281}, {0, 18, 0, 9285},
+        {0, 18, 0, 9289}, {0, 18, 0, 9293}, {0, 18, 0, 9297}, {0, 18, 0, 9301},
+        {0, 18, 0, 9305}, {0, 18, 0, 9309}, {0, 18, 0, 9313}, {0, 18, 0, 9317},
+        {0, 18, 0, 9320}, {0, 18, 0, 9323}, {0, 18, 0, 9326}, {0, 18, 0, 9329},
+        {0, 18, 0, 9332}, {0, 18, 0, 9336}, {0, 18, 0, 9339}, {0, 18, 0, 9342},
+        {0, 18, 0, 9345}, {0, 18, 0, 9348}, {0, 18, 0, 9351}, {0, 18, 0, 9354},
+        {0, 18, 0, 9357}, {0, 18, 0, 9359}, {0, 18, 0, 4641}, {0, 18, 0, 9361},
+        {0, 18, 0, 9363}, {0, 18, 0, 9365}, {0, 18, 0, 9367}, {0, 18, 0, 9369},
+        {0, 18, 0, 6966}, {0, 18, 0, 9371}, {0, 18, 0, 9373}, {0, 18, 0, 9375},
+        {0, 18, 0, 9377}, {0, 18, 0, 9379}, {0, 18, 0, 9381}, {0, 18, 0, 9383},
+        {0, 18, 0, 9385}, {0, 18, 0, 9387}, {0, 18, 0, 9389}, {0, 18, 0, 9391},
+        {0, 18, 0, 9393}, {0, 18, 0, 9395}, {0, 18, 0, 9397}, {0, 18, 0, 9399},
+        {0, 18, 0, 9401}, {0, 18, 0, 9403}, {0, 18, 0, 9405}, {0, 18, 0, 9407},
+        {0, 18, 0, 9409}, {0, 18, 0, 9411}, {0, 18, 0, 9413}, {0, 18, 0, 9415},
+        {0, 18, 0, 9417}, {0, 18, 0, 9421}, {0, 18, 0, 9425}, {0, 18, 0, 9429},
+        {0, 18, 0, 9433}, {0, 18, 0, 9437}, {0, 18, 0, 9441}, {0, 18, 0, 9445},
+        {0, 18, 0, 9449}, {0, 18, 0, 9453}, {0, 18, 0, 9455}, {0, 23, 9457, 9457},
+        {0, 23, 9459, 9459}, {0, 23, 9461, 9461}, {0, 23, 9463, 9463}, {0, 23, 9465, 9465},
+        {0, 23, 9467, 9467}, {0, 23, 9469, 9469}, {0, 23, 9471, 9471}, {0, 23, 9473, 9473},
+        {0, 23, 9475, 9475}, {0, 23, 9477, 9477}, {0, 23, 9479, 9479}, {0, 23, 9481, 9481},
+        {0, 23, 9483, 9483}, {0, 23, 9485, 9485}, {0, 23, 9487, 9487}, {0, 23, 9489, 9489},
+        {0, 23, 9491, 9491}, {0, 23, 9375, 9375}, {0, 23, 9493, 9493}, {0, 23, 9495, 9495},
+        {0, 23, 9497, 9497}, {0, 23, 9499, 9499}, {0, 23, 9501, 9501}, {0, 23, 9503, 9503},
+        {0, 23, 4110, 4110}, {0, 23, 9505, 9505}, {0, 23, 9507, 9507}, {0, 23, 9509, 9509},
+        {0, 23, 9511, 9511}, {0, 23, 9411, 9411}, {0, 23, 9513, 9513}, {0, 23, 9515, 9515},
+        {0, 23, 9517, 9517}, {0, 23, 9519, 9519}, {0, 23, 9521, 9521}, {0, 23, 9523, 9523},
+        {0, 23, 9525, 9525}, {0, 23, 9527, 9527}, {0, 23, 9529, 9529}, {0, 23, 9531, 9531},
+        {0, 23, 9533, 9533}, {0, 23, 9535, 9535}, {0, 23, 9537, 9537}, {0, 23, 9539, 9539},
+        {0, 23, 9541, 9541}, {0, 23, 9543, 9543}, {0, 23, 9545, 9545}, {0, 23, 9547, 9547},
+        {0, 23, 9549, 9549}, {0, 23, 9551, 9551}, {0, 23, 9553, 9553}, {0, 23, 9555, 9555},
+        {0, 23, 9557, 9557}, {0, 23, 9559, 9559}, {0, 23, 9561, 9561}, {0, 23, 9563, 9563},
+        {0, 23, 9565, 9565}, {0, 23, 9567, 9567}, {0, 23, 9569, 9569}, {0, 23, 9571, 9571},
+        {0, 23, 9573, 9573}, {0, 23, 9575, 9575}, {0, 23, 9577, 9577}, {0, 23, 9579, 9579},
+        {0, 23, 9581, 9581}, {0, 23, 9583, 9583}, {0, 23, 9585, 9585}, {0, 23, 9587, 9587},
+        {0, 23, 9589, 9589}, {0, 23, 9591, 9591}, {0, 23, 9593, 9593}, {0, 23, 9595, 9595},
+        {0, 23, 9597, 9597}, {0, 23, 9599, 9599}, {0, 23, 9601, 9601}, {0, 23, 9603, 9603},
+        {0, 23, 9361, 9361}, {0, 23, 9605, 9605}, {0, 23, 9607, 9607}, {0, 23, 9609, 9609},
+        {0, 23, 9611, 9611}, {0, 23, 9613, 9613}, {0, 23, 9615, 9615}, {0, 23, 9617, 9617},
+        {0, 23, 9619, 9619}, {0, 23, 9621, 9621}, {0, 23, 9623, 9623}, {0, 23, 9625, 9625},
+        {0, 23, 9627, 9627}, {0, 23, 9629, 9629}, {0, 23, 9631, 9631}, {0, 23, 9633, 9633},
+        {0, 23, 9635, 9635}, {0, 23, 9637, 9637}, {0, 23, 9639, 9639}, {0, 23, 9641, 9641},
+        {0, 23, 9643, 9643}, {0, 23, 9645, 9645}, {0, 23, 4162, 4162}, {0, 23, 9647, 9647},
+        {0, 23, 9649, 9649}, {0, 23, 9651, 9651}, {0, 23, 9653, 9653}, {0, 23, 9655, 9655},
+        {0, 23, 9657, 9657}, {0, 23, 9659, 9659}, {0, 23, 9661, 9661}, {0, 23, 9663, 9663},
+        {0, 23, 9665, 9665}, {0, 23, 9667, 9667}, {0, 23, 9669, 9669}, {0, 23, 9671, 9671},
+        {0, 23, 9673, 9673}, {0, 23, 9675, 9675}, {0, 23, 9677, 9677}, {0, 23, 9679, 9679},
+        {0, 23, 9681, 9681}, {0, 23, 9683, 9683}, {0, 23, 9685, 9685}, {0, 23, 9687, 9687},
+        {0, 23, 9689, 9689}, {0, 23, 9691, 9691}, {0, 23, 9693, 9693}, {0, 23, 4186, 4186},
+        {0, 23, 9695, 9695}, {0, 23, 9697, 9697}, {0, 23, 9699, 9699}, {0, 23, 9701, 9701},
+        {0, 23, 9703, 9703}, {0, 23, 9705, 9705}, {0, 23, 9707, 9707}, {0, 23, 9709, 9709},
+        {0, 23, 9711, 9711}, {0, 23, 9713, 9713}, {0, 23, 9715, 9715}, {0, 23, 9717, 9717},
+        {0, 23, 9719, 9719}, {0, 23, 9721, 9721}, {0, 23, 9723, 9723}, {0, 23, 9725, 9725},
+        {0, 23, 9727, 9727}, {0, 23, 9729, 9729}, {0, 23, 9731, 9731}, {0, 23, 9733, 9733},
+        {0, 23, 9735, 9735}, {0, 23, 9737, 9737}, {0, 23, 9739, 9739}, {0, 23, 9741, 9741},
+        {0, 23, 9743, 9743}, {0, 23, 9745, 9745}, {0, 23, 9747, 9747}, {0, 23, 9749, 9749},
+        {0, 23, 9751, 9751}, {0, 23, 9753, 9753}, {0, 23, 9755, 9755}, {0, 23, 9757, 9757},
+        {0, 23, 9759, 9759}, {0, 23, 9761, 9761}, {0, 23, 9763, 9763}, {0, 23, 9765, 9765},
+        {0, 23, 9767, 9767}, {0, 23, 9769, 9769}, {0, 23, 9771, 9771}, {0, 23, 9773, 9773},
+        {0, 23, 9775, 9775}, {0, 23, 9777, 9777}, {0, 23, 9779, 9779}, {0, 23, 9781, 9781},
+        {0, 23, 9783, 9783}, {0, 23, 9785, 9785}, {0, 23, 9787, 9787}, {0, 23, 9789, 9789},
+        {0, 23, 9791, 9791}, {0, 23, 9793, 9793}, {0, 23, 9795, 9795}, {0, 23, 9797, 9797},
+        {0, 23, 9799, 9799}, {0, 23, 9801, 9801}, {0, 23, 9803, 9803}, {0, 23, 9805, 9805},
+        {0, 23, 9807, 9807}, {0, 23, 9809, 9809}, {0, 23, 9811, 9811}, {0, 23, 9813, 9813},
+        {0, 23, 9815, 9815}, {0, 23, 9817, 9817}, {0, 23, 9819, 9819}, {0, 23, 9821, 9821},
+        {0, 23, 9823, 9823}, {0, 23, 9825, 9825}, {0, 23, 9827, 9827}, {0, 23, 9829, 9829},
+        {0, 23, 9831, 9831}, {0, 23, 9833, 9833}, {0, 23, 9835, 9835}, {0, 23, 9837, 9837},
+        {0, 23, 9839, 9839}, {0, 23, 9841, 9841}, {0, 23, 9843, 9843}, {0, 23, 9845, 9845},
+        {0, 23, 9847, 9847}, {0, 23, 9849, 9849}, {0, 23, 9851, 9851}, {0, 23, 9853, 9853},
+        {0, 23, 9855, 9855}, {0, 23, 9857, 9857}, {0, 23, 9859, 9859}, {0, 23, 9861, 9861},
+        {0, 23, 9863, 9863}, {0, 23, 9865, 9865}, {0, 23, 9867, 9867}, {0, 23, 9869, 9869},
+        {0, 23, 9871, 9871}, {0, 23, 9873, 9873}, {0, 23, 9875, 9875}, {0, 23, 9877, 9877},
+        {0, 23, 9879, 9879}, {0, 23, 9881, 9881}, {0, 23, 9883, 9883}, {0, 23, 9885, 9885},
+        {0, 23, 9887, 9887}, {0, 23, 9889, 9889}, {0, 23, 9891, 9891}, {0, 23, 9893, 9893},
+        {0, 23, 9895, 9895}, {0, 23, 9897, 9897}, {0, 23, 9899, 9899}, {0, 23, 9901, 9901},
+        {0, 23, 9903, 9903}, {0, 23, 9905, 9905}, {0, 23, 9907, 9907}, {0, 23, 9909, 9909},
+        {0, 23, 9911, 9911}, {0, 23, 9913, 9913}, {0, 23, 9915, 9915}, {0, 23, 9917, 9917},
+        {0, 23, 9919, 9919}, {0, 23, 9921, 9921}, {0, 23, 9923, 9923}, {0, 23, 9925, 9925},
+        {0, 23, 9927, 9927}, {0, 23, 9929, 9929}, {0, 23, 9931, 9931}, {0, 23, 9933, 9933},
+        {0, 23, 9935, 9935}, {0, 23, 9937, 9937}, {0, 23, 9939, 9939}, {0, 23, 9941, 9941},
+        {0, 23, 9943, 9943}, {0, 23, 9945, 9945}, {0, 23, 9947, 9947}, {0, 23, 9949, 9949},
+        {0, 23, 9951, 9951}, {0, 23, 9953, 9953}, {0, 23, 9955, 9955}, {0, 23, 9957, 9957},
+        {0, 23, 9959, 9959}, {0, 23, 9961, 9961}, {0, 23, 9963, 9963}, {0, 23, 9965, 9965},
+        {0, 23, 9967, 9967}, {0, 23, 9969, 9969}, {0, 23, 9971, 9971}, {0, 23, 9973, 9973},
+        {0, 23, 9975, 9975}, {0, 23, 9977, 9977}, {0, 23, 9979, 9979}, {0, 23, 9981, 9981},
+        {0, 23, 9983, 9983}, {0, 23, 9985, 9985}, {0, 23, 9987, 9987}, {0, 23, 9989, 9989},
+        {0, 23, 9991, 9991}, {0, 23, 9993, 9993}, {0, 23, 9995, 9995}, {0, 23, 9997, 9997},
+        {0, 23, 9999, 9999}, {0, 23, 10001, 10001}, {0, 23, 10003, 10003}, {0, 23, 10005, 10005},
+        {0, 23, 10007, 10007}, {0, 23, 10009, 10009}, {0, 23, 10011, 10011}, {0, 23, 10013, 10013},
+        {0, 23, 10015, 10015}, {0, 23, 10017, 10017}, {0, 23, 10019, 10019}, {0, 23, 10021, 10021},
+        {0, 23, 10023, 10023}, {0, 23, 10025, 10025}, {0, 23, 10027, 10027}, {0, 23, 10029, 10029},
+        {0, 23, 10031, 10031}, {0, 23, 10033, 10033}, {0, 23, 10035, 10035}, {0, 23, 10037, 10037},
+        {0, 23, 10039, 10039}, {0, 23, 10041, 10041}, {0, 23, 10043, 10043}, {0, 23, 10045, 10045},
+        {0, 23, 10047, 10047}, {0, 23, 10049, 10049}, {0, 23, 10051, 10051}, {0, 23, 10053, 10053},
+        {0, 23, 10055, 10055}, {0, 23, 10057, 10057}, {0, 23, 10059, 10059}, {0, 23, 10061, 10061},
+        {0, 23, 10063, 10063}, {0, 23, 10065, 10065}, {0, 23, 10067, 10067}, {0, 23, 10069, 10069},
+        {0, 23, 10071, 10071}, {0, 23, 10073, 10073}, {0, 23, 10075, 10075}, {0, 23, 10077, 10077},
+        {0, 23, 10079, 10079}, {0, 23, 10081, 10081}, {0, 23, 10083, 10083}, {0, 23, 10085, 10085},
+        {0, 23, 10087, 10087}, {0, 23, 10089, 10089}, {0, 23, 10091, 10091}, {0, 23, 10093, 10093},
+        {0, 23, 10095, 10095}, {0, 23, 10097, 10097}, {0, 23, 10099, 10099}, {0, 23, 10101, 10101},
+        {0, 23, 10103, 10103}, {0, 23, 10105, 10105}, {0, 23, 10107, 10107}, {0, 23, 10109, 10109},
+        {0, 23, 10111, 10111}, {0, 23, 10113, 10113}, {0, 23, 10115, 10115}, {0, 23, 10117, 10117},
+        {0, 23, 10119, 10119}, {0, 23, 10121, 10121}, {0, 23, 10123, 10123}, {0, 23, 10125, 10125},
+        {0, 23, 10127, 10127}, {0, 23, 10129, 10129}, {0, 23, 10131, 10131}, {0, 23, 10133, 10133},
+        {0, 23, 10135, 10135}, {0, 23, 10137, 10137}, {0, 23, 10139, 10139}, {0, 23, 10141, 10141},
+        {0, 23, 10143, 10143}, {0, 23, 10145, 10145}, {0, 23, 10147, 10147}, {0, 23, 10149, 10149},
+        {0, 23, 10151, 10151}, {0, 23, 10153, 10153}, {0, 23, 10155, 10155}, {0, 23, 10157, 10157},
+        {0, 23, 10159, 10159}, {0, 23, 10161, 10161}, {0, 23, 10163, 10163}, {0, 23, 10165, 10165},
+        {0, 23, 10167, 10167}, {0, 23, 10169, 10169}, {0, 23, 10171, 10171}, {0, 23, 10173, 10173},
+        {0, 23, 10175, 10175}, {0, 23, 10177, 10177}, {0, 23, 10179, 10179}, {0, 23, 10181, 10181},
+        {0, 23, 10183, 10183}, {0, 23, 10185, 10185}, {0, 23, 10187, 10187}, {0, 23, 10189, 10189},
+        {0, 23, 10191, 10191}, {0, 23, 10193, 10193}, {0, 23, 10195, 10195}, {0, 23, 10197, 10197},
+        {0, 23, 10199, 10199}, {0, 23, 10201, 10201}, {0, 23, 10203, 10203}, {0, 23, 10205, 10205},
+        {0, 23, 10207, 10207}, {0, 23, 10209, 10209}, {0, 23, 10211, 10211}, {0, 23, 10213, 10213},
+        {0, 23, 10215, 10215}, {0, 23, 10217, 10217}, {0, 23, 10219, 10219}, {0, 23, 10221, 10221},
+        {0, 23, 10223, 10223}, {0, 23, 10225, 10225}, {0, 23, 10227, 10227}, {0, 23, 10229, 10229},
+        {0, 23, 4366, 4366}, {0, 23, 10231, 10231}, {0, 23, 10233, 10233}, {0, 23, 10235, 10235},
+        {0, 23, 10237, 10237}, {0, 23, 10239, 10239}, {0, 23, 10241, 10241}, {0, 23, 10243, 10243},
+        {0, 23, 10245, 10245}, {0, 23, 10247, 10247}, {0, 23, 10249, 10249}, {0, 23, 10251, 10251},
+        {0, 23, 4380, 4380}, {0, 23, 10253, 10253}, {0, 23, 10255, 10255}, {0, 23, 10257, 10257},
+        {0, 23, 10259, 10259}, {0, 23, 10261, 10261}, {0, 23, 10263, 10263}, {0, 23, 10265, 10265},
+        {0, 23, 10267, 10267}, {0, 23, 10269, 10269}, {0, 23, 10271, 10271}, {0, 23, 10273, 10273},
+        {0, 23, 10275, 10275}, {0, 23, 10277, 10277}, {0, 23, 10279, 10279}, {0, 23, 10281, 10281},
+        {0, 23, 10283, 10283}, {0, 23, 10285, 10285}, {0, 23, 10287, 10287}, {0, 23, 10289, 10289},
+        {0, 23, 10291, 10291}, {0, 23, 10293, 10293}, {0, 23, 10295, 10295}, {0, 23, 10297, 10297},
+        {0, 23, 10299, 10299}, {0, 23, 10301, 10301}, {0, 23, 10303, 10303}, {0, 23, 10305, 10305},
+        {0, 23, 10307, 10307}, {0, 23, 10309, 10309}, {0, 23, 10311, 10311}, {0, 23, 10313, 10313},
+        {0, 23, 10315, 10315}, {0, 23, 10317, 10317}, {0, 23, 10319, 10319}, {0, 23, 10321, 10321},
+        {0, 23, 10323, 10323}, {0, 23, 10325, 10325}, {0, 23, 10327, 10327}, {0, 23, 10329, 10329},
+        {0, 23, 10331, 10331}, {0, 23, 10333, 10333}, {0, 23, 10335, 10335}, {0, 23, 10337, 10337},
+        {0, 23, 10339, 10339}, {0, 23, 10341, 10341}, {0, 23, 10343, 10343}, {0, 23, 10345, 10345},
+        {0, 23, 10347, 10347}, {0, 23, 10349, 10349}, {0, 23, 10351, 10351}, {0, 23, 10353, 10353},
+        {0, 23, 10355, 10355}, {0, 23, 10357, 10357}, {0, 23, 10359, 10359}, {0, 23, 10361, 10361},
+        {0, 23, 10363, 10363}, {0, 23, 10365, 10365}, {0, 23, 10367, 10367}, {0, 23, 10369, 10369},
+        {0, 23, 10371, 10371}, {0, 23, 10373, 10373}, {0, 23, 10375, 10375}, {0, 23, 4476, 4476},
+        {0, 23, 10377, 10377}, {0, 23, 4484, 4484}, {0, 23, 10379, 10379}, {0, 23, 10381, 10381},
+        {0, 23, 10383, 10383}, {0, 23, 10385, 10385}, {0, 23, 4494, 4494}, {0, 23, 10387, 10387},
+};
+
+/// 完全展开的分解映射，每项以长度开头
+static const uint32_t DecompositionPool[10389] = {
+        0x0000, 0x0001, 0x0020, 0x0002, 0x0020, 0x0308, 0x0001, 0x0061,
+        0x0002, 0x0020, 0x0304, 0x0001, 0x0032, 0x0001, 0x0033, 0x0002,
+        0x0020, 0x0301, 0x0001, 0x03bc, 0x0002, 0x0020, 0x0327, 0x0001,
+        0x0031, 0x0001, 0x006f, 0x0003, 0x0031, 0x2044, 0x0034, 0x0003,
+        0x0031, 0x2044, 0x0032, 0x0003, 0x0033, 0x2044, 0x0034, 0x0002,
+        0x0041, 0x0300, 0x0002, 0x0041, 0x0301, 0x0002, 0x0041, 0x0302,
+        0x0002, 0x0041, 0x0303, 0x0002, 0x0041, 0x0308, 0x0002, 0x0041,
+        0x030a, 0x0002, 0x0043, 0x0327, 0x0002, 0x0045, 0x0300, 0x0002,
+        0x0045, 0x0301, 0x0002, 0x0045, 0x0302, 0x0002, 0x0045, 0x0308,
+        0x0002, 0x0049, 0x0300, 0x0002, 0x0049, 0x0301, 0x0002, 0x0049,
+        0x0302, 0x0002, 0x0049, 0x0308, 0x0002, 0x004e, 0x0303, 0x0002,
+        0x004f, 0x0300, 0x0002, 0x004f, 0x0301, 0x0002, 0x004f, 0x0302,
+        0x0002, 0x004f, 0x0303, 0x0002, 0x004f, 0x0308, 0x0002, 0x0055,
+        0x0300, 0x0002, 0x0055, 0x0301, 0x0002, 0x0055, 0x0302, 0x0002,
+        0x0055, 0x0308, 0x0002, 0x0059, 0x0301, 0x0002, 0x0061, 0x0300,
+        0x0002, 0x0061, 0x0301, 0x0002, 0x0061, 0x0302, 0x0002, 0x0061,
+        0x0303, 0x0002, 0x0061, 0x0308, 0x0002, 0x0061, 0x030a, 0x0002,
+        0x0063, 0x0327, 0x0002, 0x0065, 0x0300, 0x0002, 0x0065, 0x0301,
+        0x0002, 0x0065, 0x0302, 0x0002, 0x0065, 0x0308, 0x0002, 0x0069,
+        0x0300, 0x0002, 0x0069, 0x0301, 0x0002, 0x0069, 0x0302, 0x0002,
+        0x0069, 0x0308, 0x0002, 0x006e, 0x0303, 0x0002, 0x006f, 0x0300,
+        0x0002, 0x006f, 0x0301, 0x0002, 0x006f, 0x0302, 0x0002, 0x006f,
+        0x0303, 0x0002, 0x006f, 0x0308, 0x0002, 0x0075, 0x0300, 0x0002,
+        0x0075, 0x0301, 0x0002, 0x0075, 0x0302, 0x0002, 0x0075, 0x0308,
+        0x0002, 0x0079, 0x0301, 0x0002, 0x0079, 0x0308, 0x0002, 0x0041,
+        0x0304, 0x0002, 0x0061, 0x0304, 0x0002, 0x0041, 0x0306, 0x0002,
+        0x0061, 0x0306, 0x0002, 0x0041, 0x0328, 0x0002, 0x0061, 0x0328,
+        0x0002, 0x0043, 0x0301, 0x0002, 0x0063, 0x0301, 0x0002, 0x0043,
+        0x0302, 0x0002, 0x0063, 0x0302, 0x0002, 0x0043, 0x0307, 0x0002,
+        0x0063, 0x0307, 0x0002, 0x0043, 0x030c, 0x0002, 0x0063, 0x030c,
+        0x0002, 0x0044, 0x030c, 0x0002, 0x0064, 0x030c, 0x0002, 0x0045,
+        0x0304, 0x0002, 0x0065, 0x0304, 0x0002, 0x0045, 0x0306, 0x0002,
+        0x0065, 0x0306, 0x0002, 0x0045, 0x0307, 0x0002, 0x0065, 0x0307,
+        0x0002, 0x0045, 0x0328, 0x0002, 0x0065, 0x0328, 0x0002, 0x0045,
+        0x030c, 0x0002, 0x0065, 0x030c, 0x0002, 0x0047, 0x0302, 0x0002,
+        0x0067, 0x0302, 0x0002, 0x0047, 0x0306, 0x0002, 0x0067, 0x0306,
+        0x0002, 0x0047, 0x0307, 0x0002, 0x0067, 0x0307, 0x0002, 0x0047,
+        0x0327, 0x0002, 0x0067, 0x0327, 0x0002, 0x0048, 0x0302, 0x0002,
+        0x0068, 0x0302, 0x0002, 0x0049, 0x0303, 0x0002, 0x0069, 0x0303,
+        0x0002, 0x0049, 0x0304, 0x0002, 0x0069, 0x0304, 0x0002, 0x0049,
+        0x0306, 0x0002, 0x0069, 0x0306, 0x0002, 0x0049, 0x0328, 0x0002,
+        0x0069, 0x0328, 0x0002, 0x0049, 0x0307, 0x0002, 0x0049, 0x004a,
+        0x0002, 0x0069, 0x006a, 0x0002, 0x004a, 0x0302, 0x0002, 0x006a,
+        0x0302, 0x0002, 0x004b, 0x0327, 0x0002, 0x006b, 0x0327, 0x0002,
+        0x004c, 0x0301, 0x0002, 0x006c, 0x0301, 0x0002, 0x004c, 0x0327,
+        0x0002, 0x006c, 0x0327, 0x0002, 0x004c, 0x030c, 0x0002, 0x006c,
+        0x030c, 0x0002, 0x004c, 0x00b7, 0x0002, 0x006c, 0x00b7, 0x0002,
+        0x004e, 0x0301, 0x0002, 0x006e, 0x0301, 0x0002, 0x004e, 0x0327,
+        0x0002, 0x006e, 0x0327, 0x0002, 0x004e, 0x030c, 0x0002, 0x006e,
+        0x030c, 0x0002, 0x02bc, 0x006e, 0x0002, 0x004f, 0x0304, 0x0002,
+        0x006f, 0x0304, 0x0002, 0x004f, 0x0306, 0x0002, 0x006f, 0x0306,
+        0x0002, 0x004f, 0x030b, 0x0002, 0x006f, 0x030b, 0x0002, 0x0052,
+        0x0301, 0x0002, 0x0072, 0x0301, 0x0002, 0x0052, 0x0327, 0x0002,
+        0x0072, 0x0327, 0x0002, 0x0052, 0x030c, 0x0002, 0x0072, 0x030c,
+        0x0002, 0x0053, 0x0301, 0x0002, 0x0073, 0x0301, 0x0002, 0x0053,
+        0x0302, 0x0002, 0x0073, 0x0302, 0x0002, 0x0053, 0x0327, 0x0002,
+        0x0073, 0x0327, 0x0002, 0x0053, 0x030c, 0x0002, 0x0073, 0x030c,
+        0x0002, 0x0054, 0x0327, 0x0002, 0x0074, 0x0327, 0x0002, 0x0054,
+        0x030c, 0x0002, 0x0074, 0x030c, 0x0002, 0x0055, 0x0303, 0x0002,
+        0x0075, 0x0303, 0x0002, 0x0055, 0x0304, 0x0002, 0x0075, 0x0304,
+        0x0002, 0x0055, 0x0306, 0x0002, 0x0075, 0x0306, 0x0002, 0x0055,
+        0x030a, 0x0002, 0x0075, 0x030a, 0x0002, 0x0055, 0x030b, 0x0002,
+        0x0075, 0x030b, 0x0002, 0x0055, 0x0328, 0x0002, 0x0075, 0x0328,
+        0x0002, 0x0057, 0x0302, 0x0002, 0x0077, 0x0302, 0x0002, 0x0059,
+        0x0302, 0x0002, 0x0079, 0x0302, 0x0002, 0x0059, 0x0308, 0x0002,
+        0x005a, 0x0301, 0x0002, 0x007a, 0x0301, 0x0002, 0x005a, 0x0307,
+        0x0002, 0x007a, 0x0307, 0x0002, 0x005a, 0x030c, 0x0002, 0x007a,
+        0x030c, 0x0001, 0x0073, 0x0002, 0x004f, 0x031b, 0x0002, 0x006f,
+        0x031b, 0x0002, 0x0055, 0x031b, 0x0002, 0x0075, 0x031b, 0x0003,
+        0x0044, 0x005a, 0x030c, 0x0003, 0x0044, 0x007a, 0x030c, 0x0003,
+        0x0064, 0x007a, 0x030c, 0x0002, 0x004c, 0x004a, 0x0002, 0x004c,
+        0x006a, 0x0002, 0x006c, 0x006a, 0x0002, 0x004e, 0x004a, 0x0002,
+        0x004e, 0x006a, 0x0002, 0x006e, 0x006a, 0x0002, 0x0041, 0x030c,
+        0x0002, 0x0061, 0x030c, 0x0002, 0x0049, 0x030c, 0x0002, 0x0069,
+        0x030c, 0x0002, 0x004f, 0x030c, 0x0002, 0x006f, 0x030c, 0x0002,
+        0x0055, 0x030c, 0x0002, 0x0075, 0x030c, 0x0003, 0x0055, 0x0308,
+        0x0304, 0x0003, 0x0075, 0x0308, 0x0304, 0x0003, 0x0055, 0x0308,
+        0x0301, 0x0003, 0x0075, 0x0308, 0x0301, 0x0003, 0x0055, 0x0308,
+        0x030c, 0x0003, 0x0075, 0x0308, 0x030c, 0x0003, 0x0055, 0x0308,
+        0x0300, 0x0003, 0x0075, 0x0308, 0x0300, 0x0003, 0x0041, 0x0308,
+        0x0304, 0x0003, 0x0061, 0x0308, 0x0304, 0x0003, 0x0041, 0x0307,
+        0x0304, 0x0003, 0x0061, 0x0307, 0x0304, 0x0002, 0x00c6, 0x0304,
+        0x0002, 0x00e6, 0x0304, 0x0002, 0x0047, 0x030c, 0x0002, 0x0067,
+        0x030c, 0x0002, 0x004b, 0x030c, 0x0002, 0x006b, 0x030c, 0x0002,
+        0x004f, 0x0328, 0x0002, 0x006f, 0x0328, 0x0003, 0x004f, 0x0328,
+        0x0304, 0x0003, 0x006f, 0x0328, 0x0304, 0x0002, 0x01b7, 0x030c,
+        0x0002, 0x0292, 0x030c, 0x0002, 0x006a, 0x030c, 0x0002, 0x0044,
+        0x005a, 0x0002, 0x0044, 0x007a, 0x0002, 0x0064, 0x007a, 0x0002,
+        0x0047, 0x0301, 0x0002, 0x0067, 0x0301, 0x0002, 0x004e, 0x0300,
+        0x0002, 0x006e, 0x0300, 0x0003, 0x0041, 0x030a, 0x0301, 0x0003,
+        0x0061, 0x030a, 0x0301, 0x0002, 0x00c6, 0x0301, 0x0002, 0x00e6,
+        0x0301, 0x0002, 0x00d8, 0x0301, 0x0002, 0x00f8, 0x0301, 0x0002,
+        0x0041, 0x030f, 0x0002, 0x0061, 0x030f, 0x0002, 0x0041, 0x0311,
+        0x0002, 0x0061, 0x0311, 0x0002, 0x0045, 0x030f, 0x0002, 0x0065,
+        0x030f, 0x0002, 0x0045, 0x0311, 0x0002, 0x0065, 0x0311, 0x0002,
+        0x0049, 0x030f, 0x0002, 0x0069, 0x030f, 0x0002, 0x0049, 0x0311,
+        0x0002, 0x0069, 0x0311, 0x0002, 0x004f, 0x030f, 0x0002, 0x006f,
+        0x030f, 0x0002, 0x004f, 0x0311, 0x0002, 0x006f, 0x0311, 0x0002,
+        0x0052, 0x030f, 0x0002, 0x0072, 0x030f, 0x0002, 0x0052, 0x0311,
+        0x0002, 0x0072, 0x0311, 0x0002, 0x0055, 0x030f, 0x0002, 0x0075,
+        0x030f, 0x0002, 0x0055, 0x0311, 0x0002, 0x0075, 0x0311, 0x0002,
+        0x0053, 0x0326, 0x0002, 0x0073, 0x0326, 0x0002, 0x0054, 0x0326,
+        0x0002, 0x0074, 0x0326, 0x0002, 0x0048, 0x030c, 0x0002, 0x0068,
+        0x030c, 0x0002, 0x0041, 0x0307, 0x0002, 0x0061, 0x0307, 0x0002,
+        0x0045, 0x0327, 0x0002, 0x0065, 0x0327, 0x0003, 0x004f, 0x0308,
+        0x0304, 0x0003, 0x006f, 0x0308, 0x0304, 0x0003, 0x004f, 0x0303,
+        0x0304, 0x0003, 0x006f, 0x0303, 0x0304, 0x0002, 0x004f, 0x0307,
+        0x0002, 0x006f, 0x0307, 0x0003, 0x004f, 0x0307, 0x0304, 0x0003,
+        0x006f, 0x0307, 0x0304, 0x0002, 0x0059, 0x0304, 0x0002, 0x0079,
+        0x0304, 0x0001, 0x0068, 0x0001, 0x0266, 0x0001, 0x006a, 0x0001,
+        0x0072, 0x0001, 0x0279, 0x0001, 0x027b, 0x0001, 0x0281, 0x0001,
+        0x0077, 0x0001, 0x0079, 0x0002, 0x0020, 0x0306, 0x0002, 0x0020,
+        0x0307, 0x0002, 0x0020, 0x030a, 0x0002, 0x0020, 0x0328, 0x0002,
+        0x0020, 0x0303, 0x0002, 0x0020, 0x030b, 0x0001, 0x0263, 0x0001,
+        0x006c, 0x0001, 0x0078, 0x0001, 0x0295, 0x0001, 0x0300, 0x0001,
+        0x0301, 0x0001, 0x0313, 0x0002, 0x0308, 0x0301, 0x0001, 0x02b9,
+        0x0002, 0x0020, 0x0345, 0x0001, 0x003b, 0x0002, 0x00a8, 0x0301,
+        0x0003, 0x0020, 0x0308, 0x0301, 0x0002, 0x0391, 0x0301, 0x0001,
+        0x00b7, 0x0002, 0x0395, 0x0301, 0x0002, 0x0397, 0x0301, 0x0002,
+        0x0399, 0x0301, 0x0002, 0x039f, 0x0301, 0x0002, 0x03a5, 0x0301,
+        0x0002, 0x03a9, 0x0301, 0x0003, 0x03b9, 0x0308, 0x0301, 0x0002,
+        0x0399, 0x0308, 0x0002, 0x03a5, 0x0308, 0x0002, 0x03b1, 0x0301,
+        0x0002, 0x03b5, 0x0301, 0x0002, 0x03b7, 0x0301, 0x0002, 0x03b9,
+        0x0301, 0x0003, 0x03c5, 0x0308, 0x0301, 0x0002, 0x03b9, 0x0308,
+        0x0002, 0x03c5, 0x0308, 0x0002, 0x03bf, 0x0301, 0x0002, 0x03c5,
+        0x0301, 0x0002, 0x03c9, 0x0301, 0x0001, 0x03b2, 0x0001, 0x03b8,
+        0x0001, 0x03a5, 0x0002, 0x03d2, 0x0301, 0x0002, 0x03d2, 0x0308,
+        0x0001, 0x03c6, 0x0001, 0x03c0, 0x0001, 0x03ba, 0x0001, 0x03c1,
+        0x0001, 0x03c2, 0x0001, 0x0398, 0x0001, 0x03b5, 0x0001, 0x03a3,
+        0x0002, 0x0415, 0x0300, 0x0002, 0x0415, 0x0308, 0x0002, 0x0413,
+        0x0301, 0x0002, 0x0406, 0x0308, 0x0002, 0x041a, 0x0301, 0x0002,
+        0x0418, 0x0300, 0x0002, 0x0423, 0x0306, 0x0002, 0x0418, 0x0306,
+        0x0002, 0x0438, 0x0306, 0x0002, 0x0435, 0x0300, 0x0002, 0x0435,
+        0x0308, 0x0002, 0x0433, 0x0301, 0x0002, 0x0456, 0x0308, 0x0002,
+        0x043a, 0x0301, 0x0002, 0x0438, 0x0300, 0x0002, 0x0443, 0x0306,
+        0x0002, 0x0474, 0x030f, 0x0002, 0x0475, 0x030f, 0x0002, 0x0416,
+        0x0306, 0x0002, 0x0436, 0x0306, 0x0002, 0x0410, 0x0306, 0x0002,
+        0x0430, 0x0306, 0x0002, 0x0410, 0x0308, 0x0002, 0x0430, 0x0308,
+        0x0002, 0x0415, 0x0306, 0x0002, 0x0435, 0x0306, 0x0002, 0x04d8,
+        0x0308, 0x0002, 0x04d9, 0x0308, 0x0002, 0x0416, 0x0308, 0x0002,
+        0x0436, 0x0308, 0x0002, 0x0417, 0x0308, 0x0002, 0x0437, 0x0308,
+        0x0002, 0x0418, 0x0304, 0x0002, 0x0438, 0x0304, 0x0002, 0x0418,
+        0x0308, 0x0002, 0x0438, 0x0308, 0x0002, 0x041e, 0x0308, 0x0002,
+        0x043e, 0x0308, 0x0002, 0x04e8, 0x0308, 0x0002, 0x04e9, 0x0308,
+        0x0002, 0x042d, 0x0308, 0x0002, 0x044d, 0x0308, 0x0002, 0x0423,
+        0x0304, 0x0002, 0x0443, 0x0304, 0x0002, 0x0423, 0x0308, 0x0002,
+        0x0443, 0x0308, 0x0002, 0x0423, 0x030b, 0x0002, 0x0443, 0x030b,
+        0x0002, 0x0427, 0x0308, 0x0002, 0x0447, 0x0308, 0x0002, 0x042b,
+        0x0308, 0x0002, 0x044b, 0x0308, 0x0002, 0x0565, 0x0582, 0x0002,
+        0x0627, 0x0653, 0x0002, 0x0627, 0x0654, 0x0002, 0x0648, 0x0654,
+        0x0002, 0x0627, 0x0655, 0x0002, 0x064a, 0x0654, 0x0002, 0x0627,
+        0x0674, 0x0002, 0x0648, 0x0674, 0x0002, 0x06c7, 0x0674, 0x0002,
+        0x064a, 0x0674, 0x0002, 0x06d5, 0x0654, 0x0002, 0x06c1, 0x0654,
+        0x0002, 0x06d2, 0x0654, 0x0002, 0x0928, 0x093c, 0x0002, 0x0930,
+        0x093c, 0x0002, 0x0933, 0x093c, 0x0002, 0x0915, 0x093c, 0x0002,
+        0x0916, 0x093c, 0x0002, 0x0917, 0x093c, 0x0002, 0x091c, 0x093c,
+        0x0002, 0x0921, 0x093c, 0x0002, 0x0922, 0x093c, 0x0002, 0x092b,
+        0x093c, 0x0002, 0x092f, 0x093c, 0x0002, 0x09c7, 0x09be, 0x0002,
+        0x09c7, 0x09d7, 0x0002, 0x09a1, 0x09bc, 0x0002, 0x09a2, 0x09bc,
+        0x0002, 0x09af, 0x09bc, 0x0002, 0x0a32, 0x0a3c, 0x0002, 0x0a38,
+        0x0a3c, 0x0002, 0x0a16, 0x0a3c, 0x0002, 0x0a17, 0x0a3c, 0x0002,
+        0x0a1c, 0x0a3c, 0x0002, 0x0a2b, 0x0a3c, 0x0002, 0x0b47, 0x0b56,
+        0x0002, 0x0b47, 0x0b3e, 0x0002, 0x0b47, 0x0b57, 0x0002, 0x0b21,
+        0x0b3c, 0x0002, 0x0b22, 0x0b3c, 0x0002, 0x0b92, 0x0bd7, 0x0002,
+        0x0bc6, 0x0bbe, 0x0002, 0x0bc7, 0x0bbe, 0x0002, 0x0bc6, 0x0bd7,
+        0x0002, 0x0c46, 0x0c56, 0x0002, 0x0cbf, 0x0cd5, 0x0002, 0x0cc6,
+        0x0cd5, 0x0002, 0x0cc6, 0x0cd6, 0x0002, 0x0cc6, 0x0cc2, 0x0003,
+        0x0cc6, 0x0cc2, 0x0cd5, 0x0002, 0x0d46, 0x0d3e, 0x0002, 0x0d47,
+        0x0d3e, 0x0002, 0x0d46, 0x0d57, 0x0002, 0x0dd9, 0x0dca, 0x0002,
+        0x0dd9, 0x0dcf, 0x0003, 0x0dd9, 0x0dcf, 0x0dca, 0x0002, 0x0dd9,
+        0x0ddf, 0x0002, 0x0e4d, 0x0e32, 0x0002, 0x0ecd, 0x0eb2, 0x0002,
+        0x0eab, 0x0e99, 0x0002, 0x0eab, 0x0ea1, 0x0001, 0x0f0b, 0x0002,
+        0x0f42, 0x0fb7, 0x0002, 0x0f4c, 0x0fb7, 0x0002, 0x0f51, 0x0fb7,
+        0x0002, 0x0f56, 0x0fb7, 0x0002, 0x0f5b, 0x0fb7, 0x0002, 0x0f40,
+        0x0fb5, 0x0002, 0x0f71, 0x0f72, 0x0002, 0x0f71, 0x0f74, 0x0002,
+        0x0fb2, 0x0f80, 0x0003, 0x0fb2, 0x0f71, 0x0f80, 0x0002, 0x0fb3,
+        0x0f80, 0x0003, 0x0fb3, 0x0f71, 0x0f80, 0x0002, 0x0f71, 0x0f80,
+        0x0002, 0x0f92, 0x0fb7, 0x0002, 0x0f9c, 0x0fb7, 0x0002, 0x0fa1,
+        0x0fb7, 0x0002, 0x0fa6, 0x0fb7, 0x0002, 0x0fab, 0x0fb7, 0x0002,
+        0x0f90, 0x0fb5, 0x0002, 0x1025, 0x102e, 0x0001, 0x10dc, 0x0002,
+        0x1b05, 0x1b35, 0x0002, 0x1b07, 0x1b35, 0x0002, 0x1b09, 0x1b35,
+        0x0002, 0x1b0b, 0x1b35, 0x0002, 0x1b0d, 0x1b35, 0x0002, 0x1b11,
+        0x1b35, 0x0002, 0x1b3a, 0x1b35, 0x0002, 0x1b3c, 0x1b35, 0x0002,
+        0x1b3e, 0x1b35, 0x0002, 0x1b3f, 0x1b35, 0x0002, 0x1b42, 0x1b35,
+        0x0001, 0x0041, 0x0001, 0x00c6, 0x0001, 0x0042, 0x0001, 0x0044,
+        0x0001, 0x0045, 0x0001, 0x018e, 0x0001, 0x0047, 0x0001, 0x0048,
+        0x0001, 0x0049, 0x0001, 0x004a, 0x0001, 0x004b, 0x0001, 0x004c,
+        0x0001, 0x004d, 0x0001, 0x004e, 0x0001, 0x004f, 0x0001, 0x0222,
+        0x0001, 0x0050, 0x0001, 0x0052, 0x0001, 0x0054, 0x0001, 0x0055,
+        0x0001, 0x0057, 0x0001, 0x0250, 0x0001, 0x0251, 0x0001, 0x1d02,
+        0x0001, 0x0062, 0x0001, 0x0064, 0x0001, 0x0065, 0x0001, 0x0259,
+        0x0001, 0x025b, 0x0001, 0x025c, 0x0001, 0x0067, 0x0001, 0x006b,
+        0x0001, 0x006d, 0x0001, 0x014b, 0x0001, 0x0254, 0x0001, 0x1d16,
+        0x0001, 0x1d17, 0x0001, 0x0070, 0x0001, 0x0074, 0x0001, 0x0075,
+        0x0001, 0x1d1d, 0x0001, 0x026f, 0x0001, 0x0076, 0x0001, 0x1d25,
+        0x0001, 0x03b3, 0x0001, 0x03b4, 0x0001, 0x03c7, 0x0001, 0x0069,
+        0x0001, 0x043d, 0x0001, 0x0252, 0x0001, 0x0063, 0x0001, 0x0255,
+        0x0001, 0x00f0, 0x0001, 0x0066, 0x0001, 0x025f, 0x0001, 0x0261,
+        0x0001, 0x0265, 0x0001, 0x0268, 0x0001, 0x0269, 0x0001, 0x026a,
+        0x0001, 0x1d7b, 0x0001, 0x029d, 0x0001, 0x026d, 0x0001, 0x1d85,
+        0x0001, 0x029f, 0x0001, 0x0271, 0x0001, 0x0270, 0x0001, 0x0272,
+        0x0001, 0x0273, 0x0001, 0x0274, 0x0001, 0x0275, 0x0001, 0x0278,
+        0x0001, 0x0282, 0x0001, 0x0283, 0x0001, 0x01ab, 0x0001, 0x0289,
+        0x0001, 0x028a, 0x0001, 0x1d1c, 0x0001, 0x028b, 0x0001, 0x028c,
+        0x0001, 0x007a, 0x0001, 0x0290, 0x0001, 0x0291, 0x0001, 0x0292,
+        0x0002, 0x0041, 0x0325, 0x0002, 0x0061, 0x0325, 0x0002, 0x0042,
+        0x0307, 0x0002, 0x0062, 0x0307, 0x0002, 0x0042, 0x0323, 0x0002,
+        0x0062, 0x0323, 0x0002, 0x0042, 0x0331, 0x0002, 0x0062, 0x0331,
+        0x0003, 0x0043, 0x0327, 0x0301, 0x0003, 0x0063, 0x0327, 0x0301,
+        0x0002, 0x0044, 0x0307, 0x0002, 0x0064, 0x0307, 0x0002, 0x0044,
+        0x0323, 0x0002, 0x0064, 0x0323, 0x0002, 0x0044, 0x0331, 0x0002,
+        0x0064, 0x0331, 0x0002, 0x0044, 0x0327, 0x0002, 0x0064, 0x0327,
+        0x0002, 0x0044, 0x032d, 0x0002, 0x0064, 0x032d, 0x0003, 0x0045,
+        0x0304, 0x0300, 0x0003, 0x0065, 0x0304, 0x0300, 0x0003, 0x0045,
+        0x0304, 0x0301, 0x0003, 0x0065, 0x0304, 0x0301, 0x0002, 0x0045,
+        0x032d, 0x0002, 0x0065, 0x032d, 0x0002, 0x0045, 0x0330, 0x0002,
+        0x0065, 0x0330, 0x0003, 0x0045, 0x0327, 0x0306, 0x0003, 0x0065,
+        0x0327, 0x0306, 0x0002, 0x0046, 0x0307, 0x0002, 0x0066, 0x0307,
+        0x0002, 0x0047, 0x0304, 0x0002, 0x0067, 0x0304, 0x0002, 0x0048,
+        0x0307, 0x0002, 0x0068, 0x0307, 0x0002, 0x0048, 0x0323, 0x0002,
+        0x0068, 0x0323, 0x0002, 0x0048, 0x0308, 0x0002, 0x0068, 0x0308,
+        0x0002, 0x0048, 0x0327, 0x0002, 0x0068, 0x0327, 0x0002, 0x0048,
+        0x032e, 0x0002, 0x0068, 0x032e, 0x0002, 0x0049, 0x0330, 0x0002,
+        0x0069, 0x0330, 0x0003, 0x0049, 0x0308, 0x0301, 0x0003, 0x0069,
+        0x0308, 0x0301, 0x0002, 0x004b, 0x0301, 0x0002, 0x006b, 0x0301,
+        0x0002, 0x004b, 0x0323, 0x0002, 0x006b, 0x0323, 0x0002, 0x004b,
+        0x0331, 0x0002, 0x006b, 0x0331, 0x0002, 0x004c, 0x0323, 0x0002,
+        0x006c, 0x0323, 0x0003, 0x004c, 0x0323, 0x0304, 0x0003, 0x006c,
+        0x0323, 0x0304, 0x0002, 0x004c, 0x0331, 0x0002, 0x006c, 0x0331,
+        0x0002, 0x004c, 0x032d, 0x0002, 0x006c, 0x032d, 0x0002, 0x004d,
+        0x0301, 0x0002, 0x006d, 0x0301, 0x0002, 0x004d, 0x0307, 0x0002,
+        0x006d, 0x0307, 0x0002, 0x004d, 0x0323, 0x0002, 0x006d, 0x0323,
+        0x0002, 0x004e, 0x0307, 0x0002, 0x006e, 0x0307, 0x0002, 0x004e,
+        0x0323, 0x0002, 0x006e, 0x0323, 0x0002, 0x004e, 0x0331, 0x0002,
+        0x006e, 0x0331, 0x0002, 0x004e, 0x032d, 0x0002, 0x006e, 0x032d,
+        0x0003, 0x004f, 0x0303, 0x0301, 0x0003, 0x006f, 0x0303, 0x0301,
+        0x0003, 0x004f, 0x0303, 0x0308, 0x0003, 0x006f, 0x0303, 0x0308,
+        0x0003, 0x004f, 0x0304, 0x0300, 0x0003, 0x006f, 0x0304, 0x0300,
+        0x0003, 0x004f, 0x0304, 0x0301, 0x0003, 0x006f, 0x0304, 0x0301,
+        0x0002, 0x0050, 0x0301, 0x0002, 0x0070, 0x0301, 0x0002, 0x0050,
+        0x0307, 0x0002, 0x0070, 0x0307, 0x0002, 0x0052, 0x0307, 0x0002,
+        0x0072, 0x0307, 0x0002, 0x0052, 0x0323, 0x0002, 0x0072, 0x0323,
+        0x0003, 0x0052, 0x0323, 0x0304, 0x0003, 0x0072, 0x0323, 0x0304,
+        0x0002, 0x0052, 0x0331, 0x0002, 0x0072, 0x0331, 0x0002, 0x0053,
+        0x0307, 0x0002, 0x0073, 0x0307, 0x0002, 0x0053, 0x0323, 0x0002,
+        0x0073, 0x0323, 0x0003, 0x0053, 0x0301, 0x0307, 0x0003, 0x0073,
+        0x0301, 0x0307, 0x0003, 0x0053, 0x030c, 0x0307, 0x0003, 0x0073,
+        0x030c, 0x0307, 0x0003, 0x0053, 0x0323, 0x0307, 0x0003, 0x0073,
+        0x0323, 0x0307, 0x0002, 0x0054, 0x0307, 0x0002, 0x0074, 0x0307,
+        0x0002, 0x0054, 0x0323, 0x0002, 0x0074, 0x0323, 0x0002, 0x0054,
+        0x0331, 0x0002, 0x0074, 0x0331, 0x0002, 0x0054, 0x032d, 0x0002,
+        0x0074, 0x032d, 0x0002, 0x0055, 0x0324, 0x0002, 0x0075, 0x0324,
+        0x0002, 0x0055, 0x0330, 0x0002, 0x0075, 0x0330, 0x0002, 0x0055,
+        0x032d, 0x0002, 0x0075, 0x032d, 0x0003, 0x0055, 0x0303, 0x0301,
+        0x0003, 0x0075, 0x0303, 0x0301, 0x0003, 0x0055, 0x0304, 0x0308,
+        0x0003, 0x0075, 0x0304, 0x0308, 0x0002, 0x0056, 0x0303, 0x0002,
+        0x0076, 0x0303, 0x0002, 0x0056, 0x0323, 0x0002, 0x0076, 0x0323,
+        0x0002, 0x0057, 0x0300, 0x0002, 0x0077, 0x0300, 0x0002, 0x0057,
+        0x0301, 0x0002, 0x0077, 0x0301, 0x0002, 0x0057, 0x0308, 0x0002,
+        0x0077, 0x0308, 0x0002, 0x0057, 0x0307, 0x0002, 0x0077, 0x0307,
+        0x0002, 0x0057, 0x0323, 0x0002, 0x0077, 0x0323, 0x0002, 0x0058,
+        0x0307, 0x0002, 0x0078, 0x0307, 0x0002, 0x0058, 0x0308, 0x0002,
+        0x0078, 0x0308, 0x0002, 0x0059, 0x0307, 0x0002, 0x0079, 0x0307,
+        0x0002, 0x005a, 0x0302, 0x0002, 0x007a, 0x0302, 0x0002, 0x005a,
+        0x0323, 0x0002, 0x007a, 0x0323, 0x0002, 0x005a, 0x0331, 0x0002,
+        0x007a, 0x0331, 0x0002, 0x0068, 0x0331, 0x0002, 0x0074, 0x0308,
+        0x0002, 0x0077, 0x030a, 0x0002, 0x0079, 0x030a, 0x0002, 0x0061,
+        0x02be, 0x0002, 0x017f, 0x0307, 0x0002, 0x0041, 0x0323, 0x0002,
+        0x0061, 0x0323, 0x0002, 0x0041, 0x0309, 0x0002, 0x0061, 0x0309,
+        0x0003, 0x0041, 0x0302, 0x0301, 0x0003, 0x0061, 0x0302, 0x0301,
+        0x0003, 0x0041, 0x0302, 0x0300, 0x0003, 0x0061, 0x0302, 0x0300,
+        0x0003, 0x0041, 0x0302, 0x0309, 0x0003, 0x0061, 0x0302, 0x0309,
+        0x0003, 0x0041, 0x0302, 0x0303, 0x0003, 0x0061, 0x0302, 0x0303,
+        0x0003, 0x0041, 0x0323, 0x0302, 0x0003, 0x0061, 0x0323, 0x0302,
+        0x0003, 0x0041, 0x0306, 0x0301, 0x0003, 0x0061, 0x0306, 0x0301,
+        0x0003, 0x0041, 0x0306, 0x0300, 0x0003, 0x0061, 0x0306, 0x0300,
+        0x0003, 0x0041, 0x0306, 0x0309, 0x0003, 0x0061, 0x0306, 0x0309,
+        0x0003, 0x0041, 0x0306, 0x0303, 0x0003, 0x0061, 0x0306, 0x0303,
+        0x0003, 0x0041, 0x0323, 0x0306, 0x0003, 0x0061, 0x0323, 0x0306,
+        0x0002, 0x0045, 0x0323, 0x0002, 0x0065, 0x0323, 0x0002, 0x0045,
+        0x0309, 0x0002, 0x0065, 0x0309, 0x0002, 0x0045, 0x0303, 0x0002,
+        0x0065, 0x0303, 0x0003, 0x0045, 0x0302, 0x0301, 0x0003, 0x0065,
+        0x0302, 0x0301, 0x0003, 0x0045, 0x0302, 0x0300, 0x0003, 0x0065,
+        0x0302, 0x0300, 0x0003, 0x0045, 0x0302, 0x0309, 0x0003, 0x0065,
+        0x0302, 0x0309, 0x0003, 0x0045, 0x0302, 0x0303, 0x0003, 0x0065,
+        0x0302, 0x0303, 0x0003, 0x0045, 0x0323, 0x0302, 0x0003, 0x0065,
+        0x0323, 0x0302, 0x0002, 0x0049, 0x0309, 0x0002, 0x0069, 0x0309,
+        0x0002, 0x0049, 0x0323, 0x0002, 0x0069, 0x0323, 0x0002, 0x004f,
+        0x0323, 0x0002, 0x006f, 0x0323, 0x0002, 0x004f, 0x0309, 0x0002,
+        0x006f, 0x0309, 0x0003, 0x004f, 0x0302, 0x0301, 0x0003, 0x006f,
+        0x0302, 0x0301, 0x0003, 0x004f, 0x0302, 0x0300, 0x0003, 0x006f,
+        0x0302, 0x0300, 0x0003, 0x004f, 0x0302, 0x0309, 0x0003, 0x006f,
+        0x0302, 0x0309, 0x0003, 0x004f, 0x0302, 0x0303, 0x0003, 0x006f,
+        0x0302, 0x0303, 0x0003, 0x004f, 0x0323, 0x0302, 0x0003, 0x006f,
+        0x0323, 0x0302, 0x0003, 0x004f, 0x031b, 0x0301, 0x0003, 0x006f,
+        0x031b, 0x0301, 0x0003, 0x004f, 0x031b, 0x0300, 0x0003, 0x006f,
+        0x031b, 0x0300, 0x0003, 0x004f, 0x031b, 0x0309, 0x0003, 0x006f,
+        0x031b, 0x0309, 0x0003, 0x004f, 0x031b, 0x0303, 0x0003, 0x006f,
+        0x031b, 0x0303, 0x0003, 0x004f, 0x031b, 0x0323, 0x0003, 0x006f,
+        0x031b, 0x0323, 0x0002, 0x0055, 0x0323, 0x0002, 0x0075, 0x0323,
+        0x0002, 0x0055, 0x0309, 0x0002, 0x0075, 0x0309, 0x0003, 0x0055,
+        0x031b, 0x0301, 0x0003, 0x0075, 0x031b, 0x0301, 0x0003, 0x0055,
+        0x031b, 0x0300, 0x0003, 0x0075, 0x031b, 0x0300, 0x0003, 0x0055,
+        0x031b, 0x0309, 0x0003, 0x0075, 0x031b, 0x0309, 0x0003, 0x0055,
+        0x031b, 0x0303, 0x0003, 0x0075, 0x031b, 0x0303, 0x0003, 0x0055,
+        0x031b, 0x0323, 0x0003, 0x0075, 0x031b, 0x0323, 0x0002, 0x0059,
+        0x0300, 0x0002, 0x0079, 0x0300, 0x0002, 0x0059, 0x0323, 0x0002,
+        0x0079, 0x0323, 0x0002, 0x0059, 0x0309, 0x0002, 0x0079, 0x0309,
+        0x0002, 0x0059, 0x0303, 0x0002, 0x0079, 0x0303, 0x0002, 0x03b1,
+        0x0313, 0x0002, 0x03b1, 0x0314, 0x0003, 0x03b1, 0x0313, 0x0300,
+        0x0003, 0x03b1, 0x0314, 0x0300, 0x0003, 0x03b1, 0x0313, 0x0301,
+        0x0003, 0x03b1, 0x0314, 0x0301, 0x0003, 0x03b1, 0x0313, 0x0342,
+        0x0003, 0x03b1, 0x0314, 0x0342, 0x0002, 0x0391, 0x0313, 0x0002,
+        0x0391, 0x0314, 0x0003, 0x0391, 0x0313, 0x0300, 0x0003, 0x0391,
+        0x0314, 0x0300, 0x0003, 0x0391, 0x0313, 0x0301, 0x0003, 0x0391,
+        0x0314, 0x0301, 0x0003, 0x0391, 0x0313, 0x0342, 0x0003, 0x0391,
+        0x0314, 0x0342, 0x0002, 0x03b5, 0x0313, 0x0002, 0x03b5, 0x0314,
+        0x0003, 0x03b5, 0x0313, 0x0300, 0x0003, 0x03b5, 0x0314, 0x0300,
+        0x0003, 0x03b5, 0x0313, 0x0301, 0x0003, 0x03b5, 0x0314, 0x0301,
+        0x0002, 0x0395, 0x0313, 0x0002, 0x0395, 0x0314, 0x0003, 0x0395,
+        0x0313, 0x0300, 0x0003, 0x0395, 0x0314, 0x0300, 0x0003, 0x0395,
+        0x0313, 0x0301, 0x0003, 0x0395, 0x0314, 0x0301, 0x0002, 0x03b7,
+        0x0313, 0x0002, 0x03b7, 0x0314, 0x0003, 0x03b7, 0x0313, 0x0300,
+        0x0003, 0x03b7, 0x0314, 0x0300, 0x0003, 0x03b7, 0x0313, 0x0301,
+        0x0003, 0x03b7, 0x0314, 0x0301, 0x0003, 0x03b7, 0x0313, 0x0342,
+        0x0003, 0x03b7, 0x0314, 0x0342, 0x0002, 0x0397, 0x0313, 0x0002,
+        0x0397, 0x0314, 0x0003, 0x0397, 0x0313, 0x0300, 0x0003, 0x0397,
+        0x0314, 0x0300, 0x0003, 0x0397, 0x0313, 0x0301, 0x0003, 0x0397,
+        0x0314, 0x0301, 0x0003, 0x0397, 0x0313, 0x0342, 0x0003, 0x0397,
+        0x0314, 0x0342, 0x0002, 0x03b9, 0x0313, 0x0002, 0x03b9, 0x0314,
+        0x0003, 0x03b9, 0x0313, 0x0300, 0x0003, 0x03b9, 0x0314, 0x0300,
+        0x0003, 0x03b9, 0x0313, 0x0301, 0x0003, 0x03b9, 0x0314, 0x0301,
+        0x0003, 0x03b9, 0x0313, 0x0342, 0x0003, 0x03b9, 0x0314, 0x0342,
+        0x0002, 0x0399, 0x0313, 0x0002, 0x0399, 0x0314, 0x0003, 0x0399,
+        0x0313, 0x0300, 0x0003, 0x0399, 0x0314, 0x0300, 0x0003, 0x0399,
+        0x0313, 0x0301, 0x0003, 0x0399, 0x0314, 0x0301, 0x0003, 0x0399,
+        0x0313, 0x0342, 0x0003, 0x0399, 0x0314, 0x0342, 0x0002, 0x03bf,
+        0x0313, 0x0002, 0x03bf, 0x0314, 0x0003, 0x03bf, 0x0313, 0x0300,
+        0x0003, 0x03bf, 0x0314, 0x0300, 0x0003, 0x03bf, 0x0313, 0x0301,
+        0x0003, 0x03bf, 0x0314, 0x0301, 0x0002, 0x039f, 0x0313, 0x0002,
+        0x039f, 0x0314, 0x0003, 0x039f, 0x0313, 0x0300, 0x0003, 0x039f,
+        0x0314, 0x0300, 0x0003, 0x039f, 0x0313, 0x0301, 0x0003, 0x039f,
+        0x0314, 0x0301, 0x0002, 0x03c5, 0x0313, 0x0002, 0x03c5, 0x0314,
+        0x0003, 0x03c5, 0x0313, 0x0300, 0x0003, 0x03c5, 0x0314, 0x0300,
+        0x0003, 0x03c5, 0x0313, 0x0301, 0x0003, 0x03c5, 0x0314, 0x0301,
+        0x0003, 0x03c5, 0x0313, 0x0342, 0x0003, 0x03c5, 0x0314, 0x0342,
+        0x0002, 0x03a5, 0x0314, 0x0003, 0x03a5, 0x0314, 0x0300, 0x0003,
+        0x03a5, 0x0314, 0x0301, 0x0003, 0x03a5, 0x0314, 0x0342, 0x0002,
+        0x03c9, 0x0313, 0x0002, 0x03c9, 0x0314, 0x0003, 0x03c9, 0x0313,
+        0x0300, 0x0003, 0x03c9, 0x0314, 0x0300, 0x0003, 0x03c9, 0x0313,
+        0x0301, 0x0003, 0x03c9, 0x0314, 0x0301, 0x0003, 0x03c9, 0x0313,
+        0x0342, 0x0003, 0x03c9, 0x0314, 0x0342, 0x0002, 0x03a9, 0x0313,
+        0x0002, 0x03a9, 0x0314, 0x0003, 0x03a9, 0x0313, 0x0300, 0x0003,
+        0x03a9, 0x0314, 0x0300, 0x0003, 0x03a9, 0x0313, 0x0301, 0x0003,
+        0x03a9, 0x0314, 0x0301, 0x0003, 0x03a9, 0x0313, 0x0342, 0x0003,
+        0x03a9, 0x0314, 0x0342, 0x0002, 0x03b1, 0x0300, 0x0002, 0x03b5,
+        0x0300, 0x0002, 0x03b7, 0x0300, 0x0002, 0x03b9, 0x0300, 0x0002,
+        0x03bf, 0x0300, 0x0002, 0x03c5, 0x0300, 0x0002, 0x03c9, 0x0300,
+        0x0003, 0x03b1, 0x0313, 0x0345, 0x0003, 0x03b1, 0x0314, 0x0345,
+        0x0004, 0x03b1, 0x0313, 0x0300, 0x0345, 0x0004, 0x03b1, 0x0314,
+        0x0300, 0x0345, 0x0004, 0x03b1, 0x0313, 0x0301, 0x0345, 0x0004,
+        0x03b1, 0x0314, 0x0301, 0x0345, 0x0004, 0x03b1, 0x0313, 0x0342,
+        0x0345, 0x0004, 0x03b1, 0x0314, 0x0342, 0x0345, 0x0003, 0x0391,
+        0x0313, 0x0345, 0x0003, 0x0391, 0x0314, 0x0345, 0x0004, 0x0391,
+        0x0313, 0x0300, 0x0345, 0x0004, 0x0391, 0x0314, 0x0300, 0x0345,
+        0x0004, 0x0391, 0x0313, 0x0301, 0x0345, 0x0004, 0x0391, 0x0314,
+        0x0301, 0x0345, 0x0004, 0x0391, 0x0313, 0x0342, 0x0345, 0x0004,
+        0x0391, 0x0314, 0x0342, 0x0345, 0x0003, 0x03b7, 0x0313, 0x0345,
+        0x0003, 0x03b7, 0x0314, 0x0345, 0x0004, 0x03b7, 0x0313, 0x0300,
+        0x0345, 0x0004, 0x03b7, 0x0314, 0x0300, 0x0345, 0x0004, 0x03b7,
+        0x0313, 0x0301, 0x0345, 0x0004, 0x03b7, 0x0314, 0x0301, 0x0345,
+        0x0004, 0x03b7, 0x0313, 0x0342, 0x0345, 0x0004, 0x03b7, 0x0314,
+        0x0342, 0x0345, 0x0003, 0x0397, 0x0313, 0x0345, 0x0003, 0x0397,
+        0x0314, 0x0345, 0x0004, 0x0397, 0x0313, 0x0300, 0x0345, 0x0004,
+        0x0397, 0x0314, 0x0300, 0x0345, 0x0004, 0x0397, 0x0313, 0x0301,
+        0x0345, 0x0004, 0x0397, 0x0314, 0x0301, 0x0345, 0x0004, 0x0397,
+        0x0313, 0x0342, 0x0345, 0x0004, 0x0397, 0x0314, 0x0342, 0x0345,
+        0x0003, 0x03c9, 0x0313, 0x0345, 0x0003, 0x03c9, 0x0314, 0x0345,
+        0x0004, 0x03c9, 0x0313, 0x0300, 0x0345, 0x0004, 0x03c9, 0x0314,
+        0x0300, 0x0345, 0x0004, 0x03c9, 0x0313, 0x0301, 0x0345, 0x0004,
+        0x03c9, 0x0314, 0x0301, 0x0345, 0x0004, 0x03c9, 0x0313, 0x0342,
+        0x0345, 0x0004, 0x03c9, 0x0314, 0x0342, 0x0345, 0x0003, 0x03a9,
+        0x0313, 0x0345, 0x0003, 0x03a9, 0x0314, 0x0345, 0x0004, 0x03a9,
+        0x0313, 0x0300, 0x0345, 0x0004, 0x03a9, 0x0314, 0x0300, 0x0345,
+        0x0004, 0x03a9, 0x0313, 0x0301, 0x0345, 0x0004, 0x03a9, 0x0314,
+        0x0301, 0x0345, 0x0004, 0x03a9, 0x0313, 0x0342, 0x0345, 0x0004,
+        0x03a9, 0x0314, 0x0342, 0x0345, 0x0002, 0x03b1, 0x0306, 0x0002,
+        0x03b1, 0x0304, 0x0003, 0x03b1, 0x0300, 0x0345, 0x0002, 0x03b1,
+        0x0345, 0x0003, 0x03b1, 0x0301, 0x0345, 0x0002, 0x03b1, 0x0342,
+        0x0003, 0x03b1, 0x0342, 0x0345, 0x0002, 0x0391, 0x0306, 0x0002,
+        0x0391, 0x0304, 0x0002, 0x0391, 0x0300, 0x0002, 0x0391, 0x0345,
+        0x0002, 0x0020, 0x0313, 0x0001, 0x03b9, 0x0002, 0x0020, 0x0342,
+        0x0002, 0x00a8, 0x0342, 0x0003, 0x0020, 0x0308, 0x0342, 0x0003,
+        0x03b7, 0x0300, 0x0345, 0x0002, 0x03b7, 0x0345, 0x0003, 0x03b7,
+        0x0301, 0x0345, 0x0002, 0x03b7, 0x0342, 0x0003, 0x03b7, 0x0342,
+        0x0345, 0x0002, 0x0395, 0x0300, 0x0002, 0x0397, 0x0300, 0x0002,
+        0x0397, 0x0345, 0x0002, 0x1fbf, 0x0300, 0x0003, 0x0020, 0x0313,
+        0x0300, 0x0002, 0x1fbf, 0x0301, 0x0003, 0x0020, 0x0313, 0x0301,
+        0x0002, 0x1fbf, 0x0342, 0x0003, 0x0020, 0x0313, 0x0342, 0x0002,
+        0x03b9, 0x0306, 0x0002, 0x03b9, 0x0304, 0x0003, 0x03b9, 0x0308,
+        0x0300, 0x0002, 0x03b9, 0x0342, 0x0003, 0x03b9, 0x0308, 0x0342,
+        0x0002, 0x0399, 0x0306, 0x0002, 0x0399, 0x0304, 0x0002, 0x0399,
+        0x0300, 0x0002, 0x1ffe, 0x0300, 0x0003, 0x0020, 0x0314, 0x0300,
+        0x0002, 0x1ffe, 0x0301, 0x0003, 0x0020, 0x0314, 0x0301, 0x0002,
+        0x1ffe, 0x0342, 0x0003, 0x0020, 0x0314, 0x0342, 0x0002, 0x03c5,
+        0x0306, 0x0002, 0x03c5, 0x0304, 0x0003, 0x03c5, 0x0308, 0x0300,
+        0x0002, 0x03c1, 0x0313, 0x0002, 0x03c1, 0x0314, 0x0002, 0x03c5,
+        0x0342, 0x0003, 0x03c5, 0x0308, 0x0342, 0x0002, 0x03a5, 0x0306,
+        0x0002, 0x03a5, 0x0304, 0x0002, 0x03a5, 0x0300, 0x0002, 0x03a1,
+        0x0314, 0x0002, 0x00a8, 0x0300, 0x0003, 0x0020, 0x0308, 0x0300,
+        0x0001, 0x0060, 0x0003, 0x03c9, 0x0300, 0x0345, 0x0002, 0x03c9,
+        0x0345, 0x0003, 0x03c9, 0x0301, 0x0345, 0x0002, 0x03c9, 0x0342,
+        0x0003, 0x03c9, 0x0342, 0x0345, 0x0002, 0x039f, 0x0300, 0x0002,
+        0x03a9, 0x0300, 0x0002, 0x03a9, 0x0345, 0x0001, 0x00b4, 0x0002,
+        0x0020, 0x0314, 0x0001, 0x2002, 0x0001, 0x2003, 0x0001, 0x2010,
+        0x0002, 0x0020, 0x0333, 0x0001, 0x002e, 0x0002, 0x002e, 0x002e,
+        0x0003, 0x002e, 0x002e, 0x002e, 0x0002, 0x2032, 0x2032, 0x0003,
+        0x2032, 0x2032, 0x2032, 0x0002, 0x2035, 0x2035, 0x0003, 0x2035,
+        0x2035, 0x2035, 0x0002, 0x0021, 0x0021, 0x0002, 0x0020, 0x0305,
+        0x0002, 0x003f, 0x003f, 0x0002, 0x003f, 0x0021, 0x0002, 0x0021,
+        0x003f, 0x0004, 0x2032, 0x2032, 0x2032, 0x2032, 0x0001, 0x0030,
+        0x0001, 0x0034, 0x0001, 0x0035, 0x0001, 0x0036, 0x0001, 0x0037,
+        0x0001, 0x0038, 0x0001, 0x0039, 0x0001, 0x002b, 0x0001, 0x2212,
+        0x0001, 0x003d, 0x0001, 0x0028, 0x0001, 0x0029, 0x0001, 0x006e,
+        0x0002, 0x0052, 0x0073, 0x0003, 0x0061, 0x002f, 0x0063, 0x0003,
+        0x0061, 0x002f, 0x0073, 0x0001, 0x0043, 0x0002, 0x00b0, 0x0043,
+        0x0003, 0x0063, 0x002f, 0x006f, 0x0003, 0x0063, 0x002f, 0x0075,
+        0x0001, 0x0190, 0x0002, 0x00b0, 0x0046, 0x0001, 0x0127, 0x0002,
+        0x004e, 0x006f, 0x0001, 0x0051, 0x0002, 0x0053, 0x004d, 0x0003,
+        0x0054, 0x0045, 0x004c, 0x0002, 0x0054, 0x004d, 0x0001, 0x005a,
+        0x0001, 0x03a9, 0x0001, 0x0046, 0x0001, 0x05d0, 0x0001, 0x05d1,
+        0x0001, 0x05d2, 0x0001, 0x05d3, 0x0003, 0x0046, 0x0041, 0x0058,
+        0x0001, 0x0393, 0x0001, 0x03a0, 0x0001, 0x2211, 0x0003, 0x0031,
+        0x2044, 0x0037, 0x0003, 0x0031, 0x2044, 0x0039, 0x0004, 0x0031,
+        0x2044, 0x0031, 0x0030, 0x0003, 0x0031, 0x2044, 0x0033, 0x0003,
+        0x0032, 0x2044, 0x0033, 0x0003, 0x0031, 0x2044, 0x0035, 0x0003,
+        0x0032, 0x2044, 0x0035, 0x0003, 0x0033, 0x2044, 0x0035, 0x0003,
+        0x0034, 0x2044, 0x0035, 0x0003, 0x0031, 0x2044, 0x0036, 0x0003,
+        0x0035, 0x2044, 0x0036, 0x0003, 0x0031, 0x2044, 0x0038, 0x0003,
+        0x0033, 0x2044, 0x0038, 0x0003, 0x0035, 0x2044, 0x0038, 0x0003,
+        0x0037, 0x2044, 0x0038, 0x0002, 0x0031, 0x2044, 0x0002, 0x0049,
+        0x0049, 0x0003, 0x0049, 0x0049, 0x0049, 0x0002, 0x0049, 0x0056,
+        0x0001, 0x0056, 0x0002, 0x0056, 0x0049, 0x0003, 0x0056, 0x0049,
+        0x0049, 0x0004, 0x0056, 0x0049, 0x0049, 0x0049, 0x0002, 0x0049,
+        0x0058, 0x0001, 0x0058, 0x0002, 0x0058, 0x0049, 0x0003, 0x0058,
+        0x0049, 0x0049, 0x0002, 0x0069, 0x0069, 0x0003, 0x0069, 0x0069,
+        0x0069, 0x0002, 0x0069, 0x0076, 0x0002, 0x0076, 0x0069, 0x0003,
+        0x0076, 0x0069, 0x0069, 0x0004, 0x0076, 0x0069, 0x0069, 0x0069,
+        0x0002, 0x0069, 0x0078, 0x0002, 0x0078, 0x0069, 0x0003, 0x0078,
+        0x0069, 0x0069, 0x0003, 0x0030, 0x2044, 0x0033, 0x0002, 0x2190,
+        0x0338, 0x0002, 0x2192, 0x0338, 0x0002, 0x2194, 0x0338, 0x0002,
+        0x21d0, 0x0338, 0x0002, 0x21d4, 0x0338, 0x0002, 0x21d2, 0x0338,
+        0x0002, 0x2203, 0x0338, 0x0002, 0x2208, 0x0338, 0x0002, 0x220b,
+        0x0338, 0x0002, 0x2223, 0x0338, 0x0002, 0x2225, 0x0338, 0x0002,
+        0x222b, 0x222b, 0x0003, 0x222b, 0x222b, 0x222b, 0x0002, 0x222e,
+        0x222e, 0x0003, 0x222e, 0x222e, 0x222e, 0x0002, 0x223c, 0x0338,
+        0x0002, 0x2243, 0x0338, 0x0002, 0x2245, 0x0338, 0x0002, 0x2248,
+        0x0338, 0x0002, 0x003d, 0x0338, 0x0002, 0x2261, 0x0338, 0x0002,
+        0x224d, 0x0338, 0x0002, 0x003c, 0x0338, 0x0002, 0x003e, 0x0338,
+        0x0002, 0x2264, 0x0338, 0x0002, 0x2265, 0x0338, 0x0002, 0x2272,
+        0x0338, 0x0002, 0x2273, 0x0338, 0x0002, 0x2276, 0x0338, 0x0002,
+        0x2277, 0x0338, 0x0002, 0x227a, 0x0338, 0x0002, 0x227b, 0x0338,
+        0x0002, 0x2282, 0x0338, 0x0002, 0x2283, 0x0338, 0x0002, 0x2286,
+        0x0338, 0x0002, 0x2287, 0x0338, 0x0002, 0x22a2, 0x0338, 0x0002,
+        0x22a8, 0x0338, 0x0002, 0x22a9, 0x0338, 0x0002, 0x22ab, 0x0338,
+        0x0002, 0x227c, 0x0338, 0x0002, 0x227d, 0x0338, 0x0002, 0x2291,
+        0x0338, 0x0002, 0x2292, 0x0338, 0x0002, 0x22b2, 0x0338, 0x0002,
+        0x22b3, 0x0338, 0x0002, 0x22b4, 0x0338, 0x0002, 0x22b5, 0x0338,
+        0x0001, 0x3008, 0x0001, 0x3009, 0x0002, 0x0031, 0x0030, 0x0002,
+        0x0031, 0x0031, 0x0002, 0x0031, 0x0032, 0x0002, 0x0031, 0x0033,
+        0x0002, 0x0031, 0x0034, 0x0002, 0x0031, 0x0035, 0x0002, 0x0031,
+        0x0036, 0x0002, 0x0031, 0x0037, 0x0002, 0x0031, 0x0038, 0x0002,
+        0x0031, 0x0039, 0x0002, 0x0032, 0x0030, 0x0003, 0x0028, 0x0031,
+        0x0029, 0x0003, 0x0028, 0x0032, 0x0029, 0x0003, 0x0028, 0x0033,
+        0x0029, 0x0003, 0x0028, 0x0034, 0x0029, 0x0003, 0x0028, 0x0035,
+        0x0029, 0x0003, 0x0028, 0x0036, 0x0029, 0x0003, 0x0028, 0x0037,
+        0x0029, 0x0003, 0x0028, 0x0038, 0x0029, 0x0003, 0x0028, 0x0039,
+        0x0029, 0x0004, 0x0028, 0x0031, 0x0030, 0x0029, 0x0004, 0x0028,
+        0x0031, 0x0031, 0x0029, 0x0004, 0x0028, 0x0031, 0x0032, 0x0029,
+        0x0004, 0x0028, 0x0031, 0x0033, 0x0029, 0x0004, 0x0028, 0x0031,
+        0x0034, 0x0029, 0x0004, 0x0028, 0x0031, 0x0035, 0x0029, 0x0004,
+        0x0028, 0x0031, 0x0036, 0x0029, 0x0004, 0x0028, 0x0031, 0x0037,
+        0x0029, 0x0004, 0x0028, 0x0031, 0x0038, 0x0029, 0x0004, 0x0028,
+        0x0031, 0x0039, 0x0029, 0x0004, 0x0028, 0x0032, 0x0030, 0x0029,
+        0x0002, 0x0031, 0x002e, 0x0002, 0x0032, 0x002e, 0x0002, 0x0033,
+        0x002e, 0x0002, 0x0034, 0x002e, 0x0002, 0x0035, 0x002e, 0x0002,
+        0x0036, 0x002e, 0x0002, 0x0037, 0x002e, 0x0002, 0x0038, 0x002e,
+        0x0002, 0x0039, 0x002e, 0x0003, 0x0031, 0x0030, 0x002e, 0x0003,
+        0x0031, 0x0031, 0x002e, 0x0003, 0x0031, 0x0032, 0x002e, 0x0003,
+        0x0031, 0x0033, 0x002e, 0x0003, 0x0031, 0x0034, 0x002e, 0x0003,
+        0x0031, 0x0035, 0x002e, 0x0003, 0x0031, 0x0036, 0x002e, 0x0003,
+        0x0031, 0x0037, 0x002e, 0x0003, 0x0031, 0x0038, 0x002e, 0x0003,
+        0x0031, 0x0039, 0x002e, 0x0003, 0x0032, 0x0030, 0x002e, 0x0003,
+        0x0028, 0x0061, 0x0029, 0x0003, 0x0028, 0x0062, 0x0029, 0x0003,
+        0x0028, 0x0063, 0x0029, 0x0003, 0x0028, 0x0064, 0x0029, 0x0003,
+        0x0028, 0x0065, 0x0029, 0x0003, 0x0028, 0x0066, 0x0029, 0x0003,
+        0x0028, 0x0067, 0x0029, 0x0003, 0x0028, 0x0068, 0x0029, 0x0003,
+        0x0028, 0x0069, 0x0029, 0x0003, 0x0028, 0x006a, 0x0029, 0x0003,
+        0x0028, 0x006b, 0x0029, 0x0003, 0x0028, 0x006c, 0x0029, 0x0003,
+        0x0028, 0x006d, 0x0029, 0x0003, 0x0028, 0x006e, 0x0029, 0x0003,
+        0x0028, 0x006f, 0x0029, 0x0003, 0x0028, 0x0070, 0x0029, 0x0003,
+        0x0028, 0x0071, 0x0029, 0x0003, 0x0028, 0x0072, 0x0029, 0x0003,
+        0x0028, 0x0073, 0x0029, 0x0003, 0x0028, 0x0074, 0x0029, 0x0003,
+        0x0028, 0x0075, 0x0029, 0x0003, 0x0028, 0x0076, 0x0029, 0x0003,
+        0x0028, 0x0077, 0x0029, 0x0003, 0x0028, 0x0078, 0x0029, 0x0003,
+        0x0028, 0x0079, 0x0029, 0x0003, 0x0028, 0x007a, 0x0029, 0x0001,
+        0x0053, 0x0001, 0x0059, 0x0001, 0x0071, 0x0004, 0x222b, 0x222b,
+        0x222b, 0x222b, 0x0003, 0x003a, 0x003a, 0x003d, 0x0002, 0x003d,
+        0x003d, 0x0003, 0x003d, 0x003d, 0x003d, 0x0002, 0x2add, 0x0338,
+        0x0001, 0x2d61, 0x0001, 0x6bcd, 0x0001, 0x9f9f, 0x0001, 0x4e00,
+        0x0001, 0x4e28, 0x0001, 0x4e36, 0x0001, 0x4e3f, 0x0001, 0x4e59,
+        0x0001, 0x4e85, 0x0001, 0x4e8c, 0x0001, 0x4ea0, 0x0001, 0x4eba,
+        0x0001, 0x513f, 0x0001, 0x5165, 0x0001, 0x516b, 0x0001, 0x5182,
+        0x0001, 0x5196, 0x0001, 0x51ab, 0x0001, 0x51e0, 0x0001, 0x51f5,
+        0x0001, 0x5200, 0x0001, 0x529b, 0x0001, 0x52f9, 0x0001, 0x5315,
+        0x0001, 0x531a, 0x0001, 0x5338, 0x0001, 0x5341, 0x0001, 0x535c,
+        0x0001, 0x5369, 0x0001, 0x5382, 0x0001, 0x53b6, 0x0001, 0x53c8,
+        0x0001, 0x53e3, 0x0001, 0x56d7, 0x0001, 0x571f, 0x0001, 0x58eb,
+        0x0001, 0x5902, 0x0001, 0x590a, 0x0001, 0x5915, 0x0001, 0x5927,
+        0x0001, 0x5973, 0x0001, 0x5b50, 0x0001, 0x5b80, 0x0001, 0x5bf8,
+        0x0001, 0x5c0f, 0x0001, 0x5c22, 0x0001, 0x5c38, 0x0001, 0x5c6e,
+        0x0001, 0x5c71, 0x0001, 0x5ddb, 0x0001, 0x5de5, 0x0001, 0x5df1,
+        0x0001, 0x5dfe, 0x0001, 0x5e72, 0x0001, 0x5e7a, 0x0001, 0x5e7f,
+        0x0001, 0x5ef4, 0x0001, 0x5efe, 0x0001, 0x5f0b, 0x0001, 0x5f13,
+        0x0001, 0x5f50, 0x0001, 0x5f61, 0x0001, 0x5f73, 0x0001, 0x5fc3,
+        0x0001, 0x6208, 0x0001, 0x6236, 0x0001, 0x624b, 0x0001, 0x652f,
+        0x0001, 0x6534, 0x0001, 0x6587, 0x0001, 0x6597, 0x0001, 0x65a4,
+        0x0001, 0x65b9, 0x0001, 0x65e0, 0x0001, 0x65e5, 0x0001, 0x66f0,
+        0x0001, 0x6708, 0x0001, 0x6728, 0x0001, 0x6b20, 0x0001, 0x6b62,
+        0x0001, 0x6b79, 0x0001, 0x6bb3, 0x0001, 0x6bcb, 0x0001, 0x6bd4,
+        0x0001, 0x6bdb, 0x0001, 0x6c0f, 0x0001, 0x6c14, 0x0001, 0x6c34,
+        0x0001, 0x706b, 0x0001, 0x722a, 0x0001, 0x7236, 0x0001, 0x723b,
+        0x0001, 0x723f, 0x0001, 0x7247, 0x0001, 0x7259, 0x0001, 0x725b,
+        0x0001, 0x72ac, 0x0001, 0x7384, 0x0001, 0x7389, 0x0001, 0x74dc,
+        0x0001, 0x74e6, 0x0001, 0x7518, 0x0001, 0x751f, 0x0001, 0x7528,
+        0x0001, 0x7530, 0x0001, 0x758b, 0x0001, 0x7592, 0x0001, 0x7676,
+        0x0001, 0x767d, 0x0001, 0x76ae, 0x0001, 0x76bf, 0x0001, 0x76ee,
+        0x0001, 0x77db, 0x0001, 0x77e2, 0x0001, 0x77f3, 0x0001, 0x793a,
+        0x0001, 0x79b8, 0x0001, 0x79be, 0x0001, 0x7a74, 0x0001, 0x7acb,
+        0x0001, 0x7af9, 0x0001, 0x7c73, 0x0001, 0x7cf8, 0x0001, 0x7f36,
+        0x0001, 0x7f51, 0x0001, 0x7f8a, 0x0001, 0x7fbd, 0x0001, 0x8001,
+        0x0001, 0x800c, 0x0001, 0x8012, 0x0001, 0x8033, 0x0001, 0x807f,
+        0x0001, 0x8089, 0x0001, 0x81e3, 0x0001, 0x81ea, 0x0001, 0x81f3,
+        0x0001, 0x81fc, 0x0001, 0x820c, 0x0001, 0x821b, 0x0001, 0x821f,
+        0x0001, 0x826e, 0x0001, 0x8272, 0x0001, 0x8278, 0x0001, 0x864d,
+        0x0001, 0x866b, 0x0001, 0x8840, 0x0001, 0x884c, 0x0001, 0x8863,
+        0x0001, 0x897e, 0x0001, 0x898b, 0x0001, 0x89d2, 0x0001, 0x8a00,
+        0x0001, 0x8c37, 0x0001, 0x8c46, 0x0001, 0x8c55, 0x0001, 0x8c78,
+        0x0001, 0x8c9d, 0x0001, 0x8d64, 0x0001, 0x8d70, 0x0001, 0x8db3,
+        0x0001, 0x8eab, 0x0001, 0x8eca, 0x0001, 0x8f9b, 0x0001, 0x8fb0,
+        0x0001, 0x8fb5, 0x0001, 0x9091, 0x0001, 0x9149, 0x0001, 0x91c6,
+        0x0001, 0x91cc, 0x0001, 0x91d1, 0x0001, 0x9577, 0x0001, 0x9580,
+        0x0001, 0x961c, 0x0001, 0x96b6, 0x0001, 0x96b9, 0x0001, 0x96e8,
+        0x0001, 0x9751, 0x0001, 0x975e, 0x0001, 0x9762, 0x0001, 0x9769,
+        0x0001, 0x97cb, 0x0001, 0x97ed, 0x0001, 0x97f3, 0x0001, 0x9801,
+        0x0001, 0x98a8, 0x0001, 0x98db, 0x0001, 0x98df, 0x0001, 0x9996,
+        0x0001, 0x9999, 0x0001, 0x99ac, 0x0001, 0x9aa8, 0x0001, 0x9ad8,
+        0x0001, 0x9adf, 0x0001, 0x9b25, 0x0001, 0x9b2f, 0x0001, 0x9b32,
+        0x0001, 0x9b3c, 0x0001, 0x9b5a, 0x0001, 0x9ce5, 0x0001, 0x9e75,
+        0x0001, 0x9e7f, 0x0001, 0x9ea5, 0x0001, 0x9ebb, 0x0001, 0x9ec3,
+        0x0001, 0x9ecd, 0x0001, 0x9ed1, 0x0001, 0x9ef9, 0x0001, 0x9efd,
+        0x0001, 0x9f0e, 0x0001, 0x9f13, 0x0001, 0x9f20, 0x0001, 0x9f3b,
+        0x0001, 0x9f4a, 0x0001, 0x9f52, 0x0001, 0x9f8d, 0x0001, 0x9f9c,
+        0x0001, 0x9fa0, 0x0001, 0x3012, 0x0001, 0x5344, 0x0001, 0x5345,
+        0x0002, 0x304b, 0x3099, 0x0002, 0x304d, 0x3099, 0x0002, 0x304f,
+        0x3099, 0x0002, 0x3051, 0x3099, 0x0002, 0x3053, 0x3099, 0x0002,
+        0x3055, 0x3099, 0x0002, 0x3057, 0x3099, 0x0002, 0x3059, 0x3099,
+        0x0002, 0x305b, 0x3099, 0x0002, 0x305d, 0x3099, 0x0002, 0x305f,
+        0x3099, 0x0002, 0x3061, 0x3099, 0x0002, 0x3064, 0x3099, 0x0002,
+        0x3066, 0x3099, 0x0002, 0x3068, 0x3099, 0x0002, 0x306f, 0x3099,
+        0x0002, 0x306f, 0x309a, 0x0002, 0x3072, 0x3099, 0x0002, 0x3072,
+        0x309a, 0x0002, 0x3075, 0x3099, 0x0002, 0x3075, 0x309a, 0x0002,
+        0x3078, 0x3099, 0x0002, 0x3078, 0x309a, 0x0002, 0x307b, 0x3099,
+        0x0002, 0x307b, 0x309a, 0x0002, 0x3046, 0x3099, 0x0002, 0x0020,
+        0x3099, 0x0002, 0x0020, 0x309a, 0x0002, 0x309d, 0x3099, 0x0002,
+        0x3088, 0x308a, 0x0002, 0x30ab, 0x3099, 0x0002, 0x30ad, 0x3099,
+        0x0002, 0x30af, 0x3099, 0x0002, 0x30b1, 0x3099, 0x0002, 0x30b3,
+        0x3099, 0x0002, 0x30b5, 0x3099, 0x0002, 0x30b7, 0x3099, 0x0002,
+        0x30b9, 0x3099, 0x0002, 0x30bb, 0x3099, 0x0002, 0x30bd, 0x3099,
+        0x0002, 0x30bf, 0x3099, 0x0002, 0x30c1, 0x3099, 0x0002, 0x30c4,
+        0x3099, 0x0002, 0x30c6, 0x3099, 0x0002, 0x30c8, 0x3099, 0x0002,
+        0x30cf, 0x3099, 0x0002, 0x30cf, 0x309a, 0x0002, 0x30d2, 0x3099,
+        0x0002, 0x30d2, 0x309a, 0x0002, 0x30d5, 0x3099, 0x0002, 0x30d5,
+        0x309a, 0x0002, 0x30d8, 0x3099, 0x0002, 0x30d8, 0x309a, 0x0002,
+        0x30db, 0x3099, 0x0002, 0x30db, 0x309a, 0x0002, 0x30a6, 0x3099,
+        0x0002, 0x30ef, 0x3099, 0x0002, 0x30f0, 0x3099, 0x0002, 0x30f1,
+        0x3099, 0x0002, 0x30f2, 0x3099, 0x0002, 0x30fd, 0x3099, 0x0002,
+        0x30b3, 0x30c8, 0x0001, 0x1100, 0x0001, 0x1101, 0x0001, 0x11aa,
+        0x0001, 0x1102, 0x0001, 0x11ac, 0x0001, 0x11ad, 0x0001, 0x1103,
+        0x0001, 0x1104, 0x0001, 0x1105, 0x0001, 0x11b0, 0x0001, 0x11b1,
+        0x0001, 0x11b2, 0x0001, 0x11b3, 0x0001, 0x11b4, 0x0001, 0x11b5,
+        0x0001, 0x111a, 0x0001, 0x1106, 0x0001, 0x1107, 0x0001, 0x1108,
+        0x0001, 0x1121, 0x0001, 0x1109, 0x0001, 0x110a, 0x0001, 0x110b,
+        0x0001, 0x110c, 0x0001, 0x110d, 0x0001, 0x110e, 0x0001, 0x110f,
+        0x0001, 0x1110, 0x0001, 0x1111, 0x0001, 0x1112, 0x0001, 0x1161,
+        0x0001, 0x1162, 0x0001, 0x1163, 0x0001, 0x1164, 0x0001, 0x1165,
+        0x0001, 0x1166, 0x0001, 0x1167, 0x0001, 0x1168, 0x0001, 0x1169,
+        0x0001, 0x116a, 0x0001, 0x116b, 0x0001, 0x116c, 0x0001, 0x116d,
+        0x0001, 0x116e, 0x0001, 0x116f, 0x0001, 0x1170, 0x0001, 0x1171,
+        0x0001, 0x1172, 0x0001, 0x1173, 0x0001, 0x1174, 0x0001, 0x1175,
+        0x0001, 0x1160, 0x0001, 0x1114, 0x0001, 0x1115, 0x0001, 0x11c7,
+        0x0001, 0x11c8, 0x0001, 0x11cc, 0x0001, 0x11ce, 0x0001, 0x11d3,
+        0x0001, 0x11d7, 0x0001, 0x11d9, 0x0001, 0x111c, 0x0001, 0x11dd,
+        0x0001, 0x11df, 0x0001, 0x111d, 0x0001, 0x111e, 0x0001, 0x1120,
+        0x0001, 0x1122, 0x0001, 0x1123, 0x0001, 0x1127, 0x0001, 0x1129,
+        0x0001, 0x112b, 0x0001, 0x112c, 0x0001, 0x112d, 0x0001, 0x112e,
+        0x0001, 0x112f, 0x0001, 0x1132, 0x0001, 0x1136, 0x0001, 0x1140,
+        0x0001, 0x1147, 0x0001, 0x114c, 0x0001, 0x11f1, 0x0001, 0x11f2,
+        0x0001, 0x1157, 0x0001, 0x1158, 0x0001, 0x1159, 0x0001, 0x1184,
+        0x0001, 0x1185, 0x0001, 0x1188, 0x0001, 0x1191, 0x0001, 0x1192,
+        0x0001, 0x1194, 0x0001, 0x119e, 0x0001, 0x11a1, 0x0001, 0x4e09,
+        0x0001, 0x56db, 0x0001, 0x4e0a, 0x0001, 0x4e2d, 0x0001, 0x4e0b,
+        0x0001, 0x7532, 0x0001, 0x4e19, 0x0001, 0x4e01, 0x0001, 0x5929,
+        0x0001, 0x5730, 0x0003, 0x0028, 0x1100, 0x0029, 0x0003, 0x0028,
+        0x1102, 0x0029, 0x0003, 0x0028, 0x1103, 0x0029, 0x0003, 0x0028,
+        0x1105, 0x0029, 0x0003, 0x0028, 0x1106, 0x0029, 0x0003, 0x0028,
+        0x1107, 0x0029, 0x0003, 0x0028, 0x1109, 0x0029, 0x0003, 0x0028,
+        0x110b, 0x0029, 0x0003, 0x0028, 0x110c, 0x0029, 0x0003, 0x0028,
+        0x110e, 0x0029, 0x0003, 0x0028, 0x110f, 0x0029, 0x0003, 0x0028,
+        0x1110, 0x0029, 0x0003, 0x0028, 0x1111, 0x0029, 0x0003, 0x0028,
+        0x1112, 0x0029, 0x0004, 0x0028, 0x1100, 0x1161, 0x0029, 0x0004,
+        0x0028, 0x1102, 0x1161, 0x0029, 0x0004, 0x0028, 0x1103, 0x1161,
+        0x0029, 0x0004, 0x0028, 0x1105, 0x1161, 0x0029, 0x0004, 0x0028,
+        0x1106, 0x1161, 0x0029, 0x0004, 0x0028, 0x1107, 0x1161, 0x0029,
+        0x0004, 0x0028, 0x1109, 0x1161, 0x0029, 0x0004, 0x0028, 0x110b,
+        0x1161, 0x0029, 0x0004, 0x0028, 0x110c, 0x1161, 0x0029, 0x0004,
+        0x0028, 0x110e, 0x1161, 0x0029, 0x0004, 0x0028, 0x110f, 0x1161,
+        0x0029, 0x0004, 0x0028, 0x1110, 0x1161, 0x0029, 0x0004, 0x0028,
+        0x1111, 0x1161, 0x0029, 0x0004, 0x0028, 0x1112, 0x1161, 0x0029,
+        0x0004, 0x0028, 0x110c, 0x116e, 0x0029, 0x0007, 0x0028, 0x110b,
+        0x1169, 0x110c, 0x1165, 0x11ab, 0x0029, 0x0006, 0x0028, 0x110b,
+        0x1169, 0x1112, 0x116e, 0x0029, 0x0003, 0x0028, 0x4e00, 0x0029,
+        0x0003, 0x0028, 0x4e8c, 0x0029, 0x0003, 0x0028, 0x4e09, 0x0029,
+        0x0003, 0x0028, 0x56db, 0x0029, 0x0003, 0x0028, 0x4e94, 0x0029,
+        0x0003, 0x0028, 0x516d, 0x0029, 0x0003, 0x0028, 0x4e03, 0x0029,
+        0x0003, 0x0028, 0x516b, 0x0029, 0x0003, 0x0028, 0x4e5d, 0x0029,
+        0x0003, 0x0028, 0x5341, 0x0029, 0x0003, 0x0028, 0x6708, 0x0029,
+        0x0003, 0x0028, 0x706b, 0x0029, 0x0003, 0x0028, 0x6c34, 0x0029,
+        0x0003, 0x0028, 0x6728, 0x0029, 0x0003, 0x0028, 0x91d1, 0x0029,
+        0x0003, 0x0028, 0x571f, 0x0029, 0x0003, 0x0028, 0x65e5, 0x0029,
+        0x0003, 0x0028, 0x682a, 0x0029, 0x0003, 0x0028, 0x6709, 0x0029,
+        0x0003, 0x0028, 0x793e, 0x0029, 0x0003, 0x0028, 0x540d, 0x0029,
+        0x0003, 0x0028, 0x7279, 0x0029, 0x0003, 0x0028, 0x8ca1, 0x0029,
+        0x0003, 0x0028, 0x795d, 0x0029, 0x0003, 0x0028, 0x52b4, 0x0029,
+        0x0003, 0x0028, 0x4ee3, 0x0029, 0x0003, 0x0028, 0x547c, 0x0029,
+        0x0003, 0x0028, 0x5b66, 0x0029, 0x0003, 0x0028, 0x76e3, 0x0029,
+        0x0003, 0x0028, 0x4f01, 0x0029, 0x0003, 0x0028, 0x8cc7, 0x0029,
+        0x0003, 0x0028, 0x5354, 0x0029, 0x0003, 0x0028, 0x796d, 0x0029,
+        0x0003, 0x0028, 0x4f11, 0x0029, 0x0003, 0x0028, 0x81ea, 0x0029,
+        0x0003, 0x0028, 0x81f3, 0x0029, 0x0001, 0x554f, 0x0001, 0x5e7c,
+        0x0001, 0x7b8f, 0x0003, 0x0050, 0x0054, 0x0045, 0x0002, 0x0032,
+        0x0031, 0x0002, 0x0032, 0x0032, 0x0002, 0x0032, 0x0033, 0x0002,
+        0x0032, 0x0034, 0x0002, 0x0032, 0x0035, 0x0002, 0x0032, 0x0036,
+        0x0002, 0x0032, 0x0037, 0x0002, 0x0032, 0x0038, 0x0002, 0x0032,
+        0x0039, 0x0002, 0x0033, 0x0030, 0x0002, 0x0033, 0x0031, 0x0002,
+        0x0033, 0x0032, 0x0002, 0x0033, 0x0033, 0x0002, 0x0033, 0x0034,
+        0x0002, 0x0033, 0x0035, 0x0002, 0x1100, 0x1161, 0x0002, 0x1102,
+        0x1161, 0x0002, 0x1103, 0x1161, 0x0002, 0x1105, 0x1161, 0x0002,
+        0x1106, 0x1161, 0x0002, 0x1107, 0x1161, 0x0002, 0x1109, 0x1161,
+        0x0002, 0x110b, 0x1161, 0x0002, 0x110c, 0x1161, 0x0002, 0x110e,
+        0x1161, 0x0002, 0x110f, 0x1161, 0x0002, 0x1110, 0x1161, 0x0002,
+        0x1111, 0x1161, 0x0002, 0x1112, 0x1161, 0x0005, 0x110e, 0x1161,
+        0x11b7, 0x1100, 0x1169, 0x0004, 0x110c, 0x116e, 0x110b, 0x1174,
+        0x0002, 0x110b, 0x116e, 0x0001, 0x4e94, 0x0001, 0x516d, 0x0001,
+        0x4e03, 0x0001, 0x4e5d, 0x0001, 0x682a, 0x0001, 0x6709, 0x0001,
+        0x793e, 0x0001, 0x540d, 0x0001, 0x7279, 0x0001, 0x8ca1, 0x0001,
+        0x795d, 0x0001, 0x52b4, 0x0001, 0x79d8, 0x0001, 0x7537, 0x0001,
+        0x9069, 0x0001, 0x512a, 0x0001, 0x5370, 0x0001, 0x6ce8, 0x0001,
+        0x9805, 0x0001, 0x4f11, 0x0001, 0x5199, 0x0001, 0x6b63, 0x0001,
+        0x5de6, 0x0001, 0x53f3, 0x0001, 0x533b, 0x0001, 0x5b97, 0x0001,
+        0x5b66, 0x0001, 0x76e3, 0x0001, 0x4f01, 0x0001, 0x8cc7, 0x0001,
+        0x5354, 0x0001, 0x591c, 0x0002, 0x0033, 0x0036, 0x0002, 0x0033,
+        0x0037, 0x0002, 0x0033, 0x0038, 0x0002, 0x0033, 0x0039, 0x0002,
+        0x0034, 0x0030, 0x0002, 0x0034, 0x0031, 0x0002, 0x0034, 0x0032,
+        0x0002, 0x0034, 0x0033, 0x0002, 0x0034, 0x0034, 0x0002, 0x0034,
+        0x0035, 0x0002, 0x0034, 0x0036, 0x0002, 0x0034, 0x0037, 0x0002,
+        0x0034, 0x0038, 0x0002, 0x0034, 0x0039, 0x0002, 0x0035, 0x0030,
+        0x0002, 0x0031, 0x6708, 0x0002, 0x0032, 0x6708, 0x0002, 0x0033,
+        0x6708, 0x0002, 0x0034, 0x6708, 0x0002, 0x0035, 0x6708, 0x0002,
+        0x0036, 0x6708, 0x0002, 0x0037, 0x6708, 0x0002, 0x0038, 0x6708,
+        0x0002, 0x0039, 0x6708, 0x0003, 0x0031, 0x0030, 0x6708, 0x0003,
+        0x0031, 0x0031, 0x6708, 0x0003, 0x0031, 0x0032, 0x6708, 0x0002,
+        0x0048, 0x0067, 0x0003, 0x0065, 0x0072, 0x0067, 0x0002, 0x0065,
+        0x0056, 0x0003, 0x004c, 0x0054, 0x0044, 0x0001, 0x30a2, 0x0001,
+        0x30a4, 0x0001, 0x30a6, 0x0001, 0x30a8, 0x0001, 0x30aa, 0x0001,
+        0x30ab, 0x0001, 0x30ad, 0x0001, 0x30af, 0x0001, 0x30b1, 0x0001,
+        0x30b3, 0x0001, 0x30b5, 0x0001, 0x30b7, 0x0001, 0x30b9, 0x0001,
+        0x30bb, 0x0001, 0x30bd, 0x0001, 0x30bf, 0x0001, 0x30c1, 0x0001,
+        0x30c4, 0x0001, 0x30c6, 0x0001, 0x30c8, 0x0001, 0x30ca, 0x0001,
+        0x30cb, 0x0001, 0x30cc, 0x0001, 0x30cd, 0x0001, 0x30ce, 0x0001,
+        0x30cf, 0x0001, 0x30d2, 0x0001, 0x30d5, 0x0001, 0x30d8, 0x0001,
+        0x30db, 0x0001, 0x30de, 0x0001, 0x30df, 0x0001, 0x30e0, 0x0001,
+        0x30e1, 0x0001, 0x30e2, 0x0001, 0x30e4, 0x0001, 0x30e6, 0x0001,
+        0x30e8, 0x0001, 0x30e9, 0x0001, 0x30ea, 0x0001, 0x30eb, 0x0001,
+        0x30ec, 0x0001, 0x30ed, 0x0001, 0x30ef, 0x0001, 0x30f0, 0x0001,
+        0x30f1, 0x0001, 0x30f2, 0x0002, 0x4ee4, 0x548c, 0x0005, 0x30a2,
+        0x30cf, 0x309a, 0x30fc, 0x30c8, 0x0004, 0x30a2, 0x30eb, 0x30d5,
+        0x30a1, 0x0005, 0x30a2, 0x30f3, 0x30d8, 0x309a, 0x30a2, 0x0003,
+        0x30a2, 0x30fc, 0x30eb, 0x0005, 0x30a4, 0x30cb, 0x30f3, 0x30af,
+        0x3099, 0x0003, 0x30a4, 0x30f3, 0x30c1, 0x0003, 0x30a6, 0x30a9,
+        0x30f3, 0x0006, 0x30a8, 0x30b9, 0x30af, 0x30fc, 0x30c8, 0x3099,
+        0x0004, 0x30a8, 0x30fc, 0x30ab, 0x30fc, 0x0003, 0x30aa, 0x30f3,
+        0x30b9, 0x0003, 0x30aa, 0x30fc, 0x30e0, 0x0003, 0x30ab, 0x30a4,
+        0x30ea, 0x0004, 0x30ab, 0x30e9, 0x30c3, 0x30c8, 0x0004, 0x30ab,
+        0x30ed, 0x30ea, 0x30fc, 0x0004, 0x30ab, 0x3099, 0x30ed, 0x30f3,
+        0x0004, 0x30ab, 0x3099, 0x30f3, 0x30de, 0x0004, 0x30ad, 0x3099,
+        0x30ab, 0x3099, 0x0004, 0x30ad, 0x3099, 0x30cb, 0x30fc, 0x0004,
+        0x30ad, 0x30e5, 0x30ea, 0x30fc, 0x0006, 0x30ad, 0x3099, 0x30eb,
+        0x30bf, 0x3099, 0x30fc, 0x0002, 0x30ad, 0x30ed, 0x0006, 0x30ad,
+        0x30ed, 0x30af, 0x3099, 0x30e9, 0x30e0, 0x0006, 0x30ad, 0x30ed,
+        0x30e1, 0x30fc, 0x30c8, 0x30eb, 0x0005, 0x30ad, 0x30ed, 0x30ef,
+        0x30c3, 0x30c8, 0x0004, 0x30af, 0x3099, 0x30e9, 0x30e0, 0x0006,
+        0x30af, 0x3099, 0x30e9, 0x30e0, 0x30c8, 0x30f3, 0x0006, 0x30af,
+        0x30eb, 0x30bb, 0x3099, 0x30a4, 0x30ed, 0x0004, 0x30af, 0x30ed,
+        0x30fc, 0x30cd, 0x0003, 0x30b1, 0x30fc, 0x30b9, 0x0003, 0x30b3,
+        0x30eb, 0x30ca, 0x0004, 0x30b3, 0x30fc, 0x30db, 0x309a, 0x0004,
+        0x30b5, 0x30a4, 0x30af, 0x30eb, 0x0005, 0x30b5, 0x30f3, 0x30c1,
+        0x30fc, 0x30e0, 0x0005, 0x30b7, 0x30ea, 0x30f3, 0x30af, 0x3099,
+        0x0003, 0x30bb, 0x30f3, 0x30c1, 0x0003, 0x30bb, 0x30f3, 0x30c8,
+        0x0004, 0x30bf, 0x3099, 0x30fc, 0x30b9, 0x0003, 0x30c6, 0x3099,
+        0x30b7, 0x0003, 0x30c8, 0x3099, 0x30eb, 0x0002, 0x30c8, 0x30f3,
+        0x0002, 0x30ca, 0x30ce, 0x0003, 0x30ce, 0x30c3, 0x30c8, 0x0003,
+        0x30cf, 0x30a4, 0x30c4, 0x0006, 0x30cf, 0x309a, 0x30fc, 0x30bb,
+        0x30f3, 0x30c8, 0x0004, 0x30cf, 0x309a, 0x30fc, 0x30c4, 0x0005,
+        0x30cf, 0x3099, 0x30fc, 0x30ec, 0x30eb, 0x0006, 0x30d2, 0x309a,
+        0x30a2, 0x30b9, 0x30c8, 0x30eb, 0x0004, 0x30d2, 0x309a, 0x30af,
+        0x30eb, 0x0003, 0x30d2, 0x309a, 0x30b3, 0x0003, 0x30d2, 0x3099,
+        0x30eb, 0x0006, 0x30d5, 0x30a1, 0x30e9, 0x30c3, 0x30c8, 0x3099,
+        0x0004, 0x30d5, 0x30a3, 0x30fc, 0x30c8, 0x0006, 0x30d5, 0x3099,
+        0x30c3, 0x30b7, 0x30a7, 0x30eb, 0x0003, 0x30d5, 0x30e9, 0x30f3,
+        0x0005, 0x30d8, 0x30af, 0x30bf, 0x30fc, 0x30eb, 0x0003, 0x30d8,
+        0x309a, 0x30bd, 0x0004, 0x30d8, 0x309a, 0x30cb, 0x30d2, 0x0003,
+        0x30d8, 0x30eb, 0x30c4, 0x0004, 0x30d8, 0x309a, 0x30f3, 0x30b9,
+        0x0005, 0x30d8, 0x309a, 0x30fc, 0x30b7, 0x3099, 0x0004, 0x30d8,
+        0x3099, 0x30fc, 0x30bf, 0x0005, 0x30db, 0x309a, 0x30a4, 0x30f3,
+        0x30c8, 0x0004, 0x30db, 0x3099, 0x30eb, 0x30c8, 0x0002, 0x30db,
+        0x30f3, 0x0005, 0x30db, 0x309a, 0x30f3, 0x30c8, 0x3099, 0x0003,
+        0x30db, 0x30fc, 0x30eb, 0x0003, 0x30db, 0x30fc, 0x30f3, 0x0004,
+        0x30de, 0x30a4, 0x30af, 0x30ed, 0x0003, 0x30de, 0x30a4, 0x30eb,
+        0x0003, 0x30de, 0x30c3, 0x30cf, 0x0003, 0x30de, 0x30eb, 0x30af,
+        0x0005, 0x30de, 0x30f3, 0x30b7, 0x30e7, 0x30f3, 0x0004, 0x30df,
+        0x30af, 0x30ed, 0x30f3, 0x0002, 0x30df, 0x30ea, 0x0006, 0x30df,
+        0x30ea, 0x30cf, 0x3099, 0x30fc, 0x30eb, 0x0003, 0x30e1, 0x30ab,
+        0x3099, 0x0005, 0x30e1, 0x30ab, 0x3099, 0x30c8, 0x30f3, 0x0004,
+        0x30e1, 0x30fc, 0x30c8, 0x30eb, 0x0004, 0x30e4, 0x30fc, 0x30c8,
+        0x3099, 0x0003, 0x30e4, 0x30fc, 0x30eb, 0x0003, 0x30e6, 0x30a2,
+        0x30f3, 0x0004, 0x30ea, 0x30c3, 0x30c8, 0x30eb, 0x0002, 0x30ea,
+        0x30e9, 0x0004, 0x30eb, 0x30d2, 0x309a, 0x30fc, 0x0005, 0x30eb,
+        0x30fc, 0x30d5, 0x3099, 0x30eb, 0x0002, 0x30ec, 0x30e0, 0x0006,
+        0x30ec, 0x30f3, 0x30c8, 0x30b1, 0x3099, 0x30f3, 0x0003, 0x30ef,
+        0x30c3, 0x30c8, 0x0002, 0x0030, 0x70b9, 0x0002, 0x0031, 0x70b9,
+        0x0002, 0x0032, 0x70b9, 0x0002, 0x0033, 0x70b9, 0x0002, 0x0034,
+        0x70b9, 0x0002, 0x0035, 0x70b9, 0x0002, 0x0036, 0x70b9, 0x0002,
+        0x0037, 0x70b9, 0x0002, 0x0038, 0x70b9, 0x0002, 0x0039, 0x70b9,
+        0x0003, 0x0031, 0x0030, 0x70b9, 0x0003, 0x0031, 0x0031, 0x70b9,
+        0x0003, 0x0031, 0x0032, 0x70b9, 0x0003, 0x0031, 0x0033, 0x70b9,
+        0x0003, 0x0031, 0x0034, 0x70b9, 0x0003, 0x0031, 0x0035, 0x70b9,
+        0x0003, 0x0031, 0x0036, 0x70b9, 0x0003, 0x0031, 0x0037, 0x70b9,
+        0x0003, 0x0031, 0x0038, 0x70b9, 0x0003, 0x0031, 0x0039, 0x70b9,
+        0x0003, 0x0032, 0x0030, 0x70b9, 0x0003, 0x0032, 0x0031, 0x70b9,
+        0x0003, 0x0032, 0x0032, 0x70b9, 0x0003, 0x0032, 0x0033, 0x70b9,
+        0x0003, 0x0032, 0x0034, 0x70b9, 0x0003, 0x0068, 0x0050, 0x0061,
+        0x0002, 0x0064, 0x0061, 0x0002, 0x0041, 0x0055, 0x0003, 0x0062,
+        0x0061, 0x0072, 0x0002, 0x006f, 0x0056, 0x0002, 0x0070, 0x0063,
+        0x0002, 0x0064, 0x006d, 0x0003, 0x0064, 0x006d, 0x0032, 0x0003,
+        0x0064, 0x006d, 0x0033, 0x0002, 0x0049, 0x0055, 0x0002, 0x5e73,
+        0x6210, 0x0002, 0x662d, 0x548c, 0x0002, 0x5927, 0x6b63, 0x0002,
+        0x660e, 0x6cbb, 0x0004, 0x682a, 0x5f0f, 0x4f1a, 0x793e, 0x0002,
+        0x0070, 0x0041, 0x0002, 0x006e, 0x0041, 0x0002, 0x03bc, 0x0041,
+        0x0002, 0x006d, 0x0041, 0x0002, 0x006b, 0x0041, 0x0002, 0x004b,
+        0x0042, 0x0002, 0x004d, 0x0042, 0x0002, 0x0047, 0x0042, 0x0003,
+        0x0063, 0x0061, 0x006c, 0x0004, 0x006b, 0x0063, 0x0061, 0x006c,
+        0x0002, 0x0070, 0x0046, 0x0002, 0x006e, 0x0046, 0x0002, 0x03bc,
+        0x0046, 0x0002, 0x03bc, 0x0067, 0x0002, 0x006d, 0x0067, 0x0002,
+        0x006b, 0x0067, 0x0002, 0x0048, 0x007a, 0x0003, 0x006b, 0x0048,
+        0x007a, 0x0003, 0x004d, 0x0048, 0x007a, 0x0003, 0x0047, 0x0048,
+        0x007a, 0x0003, 0x0054, 0x0048, 0x007a, 0x0002, 0x03bc, 0x006c,
+        0x0002, 0x006d, 0x006c, 0x0002, 0x0064, 0x006c, 0x0002, 0x006b,
+        0x006c, 0x0002, 0x0066, 0x006d, 0x0002, 0x006e, 0x006d, 0x0002,
+        0x03bc, 0x006d, 0x0002, 0x006d, 0x006d, 0x0002, 0x0063, 0x006d,
+        0x0002, 0x006b, 0x006d, 0x0003, 0x006d, 0x006d, 0x0032, 0x0003,
+        0x0063, 0x006d, 0x0032, 0x0002, 0x006d, 0x0032, 0x0003, 0x006b,
+        0x006d, 0x0032, 0x0003, 0x006d, 0x006d, 0x0033, 0x0003, 0x0063,
+        0x006d, 0x0033, 0x0002, 0x006d, 0x0033, 0x0003, 0x006b, 0x006d,
+        0x0033, 0x0003, 0x006d, 0x2215, 0x0073, 0x0004, 0x006d, 0x2215,
+        0x0073, 0x0032, 0x0002, 0x0050, 0x0061, 0x0003, 0x006b, 0x0050,
+        0x0061, 0x0003, 0x004d, 0x0050, 0x0061, 0x0003, 0x0047, 0x0050,
+        0x0061, 0x0003, 0x0072, 0x0061, 0x0064, 0x0005, 0x0072, 0x0061,
+        0x0064, 0x2215, 0x0073, 0x0006, 0x0072, 0x0061, 0x0064, 0x2215,
+        0x0073, 0x0032, 0x0002, 0x0070, 0x0073, 0x0002, 0x006e, 0x0073,
+        0x0002, 0x03bc, 0x0073, 0x0002, 0x006d, 0x0073, 0x0002, 0x0070,
+        0x0056, 0x0002, 0x006e, 0x0056, 0x0002, 0x03bc, 0x0056, 0x0002,
+        0x006d, 0x0056, 0x0002, 0x006b, 0x0056, 0x0002, 0x004d, 0x0056,
+        0x0002, 0x0070, 0x0057, 0x0002, 0x006e, 0x0057, 0x0002, 0x03bc,
+        0x0057, 0x0002, 0x006d, 0x0057, 0x0002, 0x006b, 0x0057, 0x0002,
+        0x004d, 0x0057, 0x0002, 0x006b, 0x03a9, 0x0002, 0x004d, 0x03a9,
+        0x0004, 0x0061, 0x002e, 0x006d, 0x002e, 0x0002, 0x0042, 0x0071,
+        0x0002, 0x0063, 0x0063, 0x0002, 0x0063, 0x0064, 0x0004, 0x0043,
+        0x2215, 0x006b, 0x0067, 0x0003, 0x0043, 0x006f, 0x002e, 0x0002,
+        0x0064, 0x0042, 0x0002, 0x0047, 0x0079, 0x0002, 0x0068, 0x0061,
+        0x0002, 0x0048, 0x0050, 0x0002, 0x0069, 0x006e, 0x0002, 0x004b,
+        0x004b, 0x0002, 0x004b, 0x004d, 0x0002, 0x006b, 0x0074, 0x0002,
+        0x006c, 0x006d, 0x0002, 0x006c, 0x006e, 0x0003, 0x006c, 0x006f,
+        0x0067, 0x0002, 0x006c, 0x0078, 0x0002, 0x006d, 0x0062, 0x0003,
+        0x006d, 0x0069, 0x006c, 0x0003, 0x006d, 0x006f, 0x006c, 0x0002,
+        0x0050, 0x0048, 0x0004, 0x0070, 0x002e, 0x006d, 0x002e, 0x0003,
+        0x0050, 0x0050, 0x004d, 0x0002, 0x0050, 0x0052, 0x0002, 0x0073,
+        0x0072, 0x0002, 0x0053, 0x0076, 0x0002, 0x0057, 0x0062, 0x0003,
+        0x0056, 0x2215, 0x006d, 0x0003, 0x0041, 0x2215, 0x006d, 0x0002,
+        0x0031, 0x65e5, 0x0002, 0x0032, 0x65e5, 0x0002, 0x0033, 0x65e5,
+        0x0002, 0x0034, 0x65e5, 0x0002, 0x0035, 0x65e5, 0x0002, 0x0036,
+        0x65e5, 0x0002, 0x0037, 0x65e5, 0x0002, 0x0038, 0x65e5, 0x0002,
+        0x0039, 0x65e5, 0x0003, 0x0031, 0x0030, 0x65e5, 0x0003, 0x0031,
+        0x0031, 0x65e5, 0x0003, 0x0031, 0x0032, 0x65e5, 0x0003, 0x0031,
+        0x0033, 0x65e5, 0x0003, 0x0031, 0x0034, 0x65e5, 0x0003, 0x0031,
+        0x0035, 0x65e5, 0x0003, 0x0031, 0x0036, 0x65e5, 0x0003, 0x0031,
+        0x0037, 0x65e5, 0x0003, 0x0031, 0x0038, 0x65e5, 0x0003, 0x0031,
+        0x0039, 0x65e5, 0x0003, 0x0032, 0x0030, 0x65e5, 0x0003, 0x0032,
+        0x0031, 0x65e5, 0x0003, 0x0032, 0x0032, 0x65e5, 0x0003, 0x0032,
+        0x0033, 0x65e5, 0x0003, 0x0032, 0x0034, 0x65e5, 0x0003, 0x0032,
+        0x0035, 0x65e5, 0x0003, 0x0032, 0x0036, 0x65e5, 0x0003, 0x0032,
+        0x0037, 0x65e5, 0x0003, 0x0032, 0x0038, 0x65e5, 0x0003, 0x0032,
+        0x0039, 0x65e5, 0x0003, 0x0033, 0x0030, 0x65e5, 0x0003, 0x0033,
+        0x0031, 0x65e5, 0x0003, 0x0067, 0x0061, 0x006c, 0x0001, 0x044a,
+        0x0001, 0x044c, 0x0001, 0xa76f, 0x0001, 0x0126, 0x0001, 0x0153,
+        0x0001, 0xa727, 0x0001, 0xab37, 0x0001, 0x026b, 0x0001, 0xab52,
+        0x0001, 0x028d, 0x0001, 0x8c48, 0x0001, 0x66f4, 0x0001, 0x8cc8,
+        0x0001, 0x6ed1, 0x0001, 0x4e32, 0x0001, 0x53e5, 0x0001, 0x5951,
+        0x0001, 0x5587, 0x0001, 0x5948, 0x0001, 0x61f6, 0x0001, 0x7669,
+        0x0001, 0x7f85, 0x0001, 0x863f, 0x0001, 0x87ba, 0x0001, 0x88f8,
+        0x0001, 0x908f, 0x0001, 0x6a02, 0x0001, 0x6d1b, 0x0001, 0x70d9,
+        0x0001, 0x73de, 0x0001, 0x843d, 0x0001, 0x916a, 0x0001, 0x99f1,
+        0x0001, 0x4e82, 0x0001, 0x5375, 0x0001, 0x6b04, 0x0001, 0x721b,
+        0x0001, 0x862d, 0x0001, 0x9e1e, 0x0001, 0x5d50, 0x0001, 0x6feb,
+        0x0001, 0x85cd, 0x0001, 0x8964, 0x0001, 0x62c9, 0x0001, 0x81d8,
+        0x0001, 0x881f, 0x0001, 0x5eca, 0x0001, 0x6717, 0x0001, 0x6d6a,
+        0x0001, 0x72fc, 0x0001, 0x90ce, 0x0001, 0x4f86, 0x0001, 0x51b7,
+        0x0001, 0x52de, 0x0001, 0x64c4, 0x0001, 0x6ad3, 0x0001, 0x7210,
+        0x0001, 0x76e7, 0x0001, 0x8606, 0x0001, 0x865c, 0x0001, 0x8def,
+        0x0001, 0x9732, 0x0001, 0x9b6f, 0x0001, 0x9dfa, 0x0001, 0x788c,
+        0x0001, 0x797f, 0x0001, 0x7da0, 0x0001, 0x83c9, 0x0001, 0x9304,
+        0x0001, 0x8ad6, 0x0001, 0x58df, 0x0001, 0x5f04, 0x0001, 0x7c60,
+        0x0001, 0x807e, 0x0001, 0x7262, 0x0001, 0x78ca, 0x0001, 0x8cc2,
+        0x0001, 0x96f7, 0x0001, 0x58d8, 0x0001, 0x5c62, 0x0001, 0x6a13,
+        0x0001, 0x6dda, 0x0001, 0x6f0f, 0x0001, 0x7d2f, 0x0001, 0x7e37,
+        0x0001, 0x964b, 0x0001, 0x52d2, 0x0001, 0x808b, 0x0001, 0x51dc,
+        0x0001, 0x51cc, 0x0001, 0x7a1c, 0x0001, 0x7dbe, 0x0001, 0x83f1,
+        0x0001, 0x9675, 0x0001, 0x8b80, 0x0001, 0x62cf, 0x0001, 0x8afe,
+        0x0001, 0x4e39, 0x0001, 0x5be7, 0x0001, 0x6012, 0x0001, 0x7387,
+        0x0001, 0x7570, 0x0001, 0x5317, 0x0001, 0x78fb, 0x0001, 0x4fbf,
+        0x0001, 0x5fa9, 0x0001, 0x4e0d, 0x0001, 0x6ccc, 0x0001, 0x6578,
+        0x0001, 0x7d22, 0x0001, 0x53c3, 0x0001, 0x585e, 0x0001, 0x7701,
+        0x0001, 0x8449, 0x0001, 0x8aaa, 0x0001, 0x6bba, 0x0001, 0x6c88,
+        0x0001, 0x62fe, 0x0001, 0x82e5, 0x0001, 0x63a0, 0x0001, 0x7565,
+        0x0001, 0x4eae, 0x0001, 0x5169, 0x0001, 0x51c9, 0x0001, 0x6881,
+        0x0001, 0x7ce7, 0x0001, 0x826f, 0x0001, 0x8ad2, 0x0001, 0x91cf,
+        0x0001, 0x52f5, 0x0001, 0x5442, 0x0001, 0x5eec, 0x0001, 0x65c5,
+        0x0001, 0x6ffe, 0x0001, 0x792a, 0x0001, 0x95ad, 0x0001, 0x9a6a,
+        0x0001, 0x9e97, 0x0001, 0x9ece, 0x0001, 0x66c6, 0x0001, 0x6b77,
+        0x0001, 0x8f62, 0x0001, 0x5e74, 0x0001, 0x6190, 0x0001, 0x6200,
+        0x0001, 0x649a, 0x0001, 0x6f23, 0x0001, 0x7149, 0x0001, 0x7489,
+        0x0001, 0x79ca, 0x0001, 0x7df4, 0x0001, 0x806f, 0x0001, 0x8f26,
+        0x0001, 0x84ee, 0x0001, 0x9023, 0x0001, 0x934a, 0x0001, 0x5217,
+        0x0001, 0x52a3, 0x0001, 0x54bd, 0x0001, 0x70c8, 0x0001, 0x88c2,
+        0x0001, 0x5ec9, 0x0001, 0x5ff5, 0x0001, 0x637b, 0x0001, 0x6bae,
+        0x0001, 0x7c3e, 0x0001, 0x7375, 0x0001, 0x4ee4, 0x0001, 0x56f9,
+        0x0001, 0x5dba, 0x0001, 0x601c, 0x0001, 0x73b2, 0x0001, 0x7469,
+        0x0001, 0x7f9a, 0x0001, 0x8046, 0x0001, 0x9234, 0x0001, 0x96f6,
+        0x0001, 0x9748, 0x0001, 0x9818, 0x0001, 0x4f8b, 0x0001, 0x79ae,
+        0x0001, 0x91b4, 0x0001, 0x96b8, 0x0001, 0x60e1, 0x0001, 0x4e86,
+        0x0001, 0x50da, 0x0001, 0x5bee, 0x0001, 0x5c3f, 0x0001, 0x6599,
+        0x0001, 0x71ce, 0x0001, 0x7642, 0x0001, 0x84fc, 0x0001, 0x907c,
+        0x0001, 0x6688, 0x0001, 0x962e, 0x0001, 0x5289, 0x0001, 0x677b,
+        0x0001, 0x67f3, 0x0001, 0x6d41, 0x0001, 0x6e9c, 0x0001, 0x7409,
+        0x0001, 0x7559, 0x0001, 0x786b, 0x0001, 0x7d10, 0x0001, 0x985e,
+        0x0001, 0x622e, 0x0001, 0x9678, 0x0001, 0x502b, 0x0001, 0x5d19,
+        0x0001, 0x6dea, 0x0001, 0x8f2a, 0x0001, 0x5f8b, 0x0001, 0x6144,
+        0x0001, 0x6817, 0x0001, 0x9686, 0x0001, 0x5229, 0x0001, 0x540f,
+        0x0001, 0x5c65, 0x0001, 0x6613, 0x0001, 0x674e, 0x0001, 0x68a8,
+        0x0001, 0x6ce5, 0x0001, 0x7406, 0x0001, 0x75e2, 0x0001, 0x7f79,
+        0x0001, 0x88cf, 0x0001, 0x88e1, 0x0001, 0x96e2, 0x0001, 0x533f,
+        0x0001, 0x6eba, 0x0001, 0x541d, 0x0001, 0x71d0, 0x0001, 0x7498,
+        0x0001, 0x85fa, 0x0001, 0x96a3, 0x0001, 0x9c57, 0x0001, 0x9e9f,
+        0x0001, 0x6797, 0x0001, 0x6dcb, 0x0001, 0x81e8, 0x0001, 0x7b20,
+        0x0001, 0x7c92, 0x0001, 0x72c0, 0x0001, 0x7099, 0x0001, 0x8b58,
+        0x0001, 0x4ec0, 0x0001, 0x8336, 0x0001, 0x523a, 0x0001, 0x5207,
+        0x0001, 0x5ea6, 0x0001, 0x62d3, 0x0001, 0x7cd6, 0x0001, 0x5b85,
+        0x0001, 0x6d1e, 0x0001, 0x66b4, 0x0001, 0x8f3b, 0x0001, 0x964d,
+        0x0001, 0x5ed3, 0x0001, 0x5140, 0x0001, 0x55c0, 0x0001, 0x585a,
+        0x0001, 0x6674, 0x0001, 0x51de, 0x0001, 0x732a, 0x0001, 0x76ca,
+        0x0001, 0x793c, 0x0001, 0x795e, 0x0001, 0x7965, 0x0001, 0x798f,
+        0x0001, 0x9756, 0x0001, 0x7cbe, 0x0001, 0x8612, 0x0001, 0x8af8,
+        0x0001, 0x9038, 0x0001, 0x90fd, 0x0001, 0x98ef, 0x0001, 0x98fc,
+        0x0001, 0x9928, 0x0001, 0x9db4, 0x0001, 0x90de, 0x0001, 0x96b7,
+        0x0001, 0x4fae, 0x0001, 0x50e7, 0x0001, 0x514d, 0x0001, 0x52c9,
+        0x0001, 0x52e4, 0x0001, 0x5351, 0x0001, 0x559d, 0x0001, 0x5606,
+        0x0001, 0x5668, 0x0001, 0x5840, 0x0001, 0x58a8, 0x0001, 0x5c64,
+        0x0001, 0x6094, 0x0001, 0x6168, 0x0001, 0x618e, 0x0001, 0x61f2,
+        0x0001, 0x654f, 0x0001, 0x65e2, 0x0001, 0x6691, 0x0001, 0x6885,
+        0x0001, 0x6d77, 0x0001, 0x6e1a, 0x0001, 0x6f22, 0x0001, 0x716e,
+        0x0001, 0x722b, 0x0001, 0x7422, 0x0001, 0x7891, 0x0001, 0x7949,
+        0x0001, 0x7948, 0x0001, 0x7950, 0x0001, 0x7956, 0x0001, 0x798d,
+        0x0001, 0x798e, 0x0001, 0x7a40, 0x0001, 0x7a81, 0x0001, 0x7bc0,
+        0x0001, 0x7e09, 0x0001, 0x7e41, 0x0001, 0x7f72, 0x0001, 0x8005,
+        0x0001, 0x81ed, 0x0001, 0x8279, 0x0001, 0x8457, 0x0001, 0x8910,
+        0x0001, 0x8996, 0x0001, 0x8b01, 0x0001, 0x8b39, 0x0001, 0x8cd3,
+        0x0001, 0x8d08, 0x0001, 0x8fb6, 0x0001, 0x96e3, 0x0001, 0x97ff,
+        0x0001, 0x983b, 0x0001, 0x6075, 0x0001, 0x242ee, 0x0001, 0x8218,
+        0x0001, 0x4e26, 0x0001, 0x51b5, 0x0001, 0x5168, 0x0001, 0x4f80,
+        0x0001, 0x5145, 0x0001, 0x5180, 0x0001, 0x52c7, 0x0001, 0x52fa,
+        0x0001, 0x5555, 0x0001, 0x5599, 0x0001, 0x55e2, 0x0001, 0x58b3,
+        0x0001, 0x5944, 0x0001, 0x5954, 0x0001, 0x5a62, 0x0001, 0x5b28,
+        0x0001, 0x5ed2, 0x0001, 0x5ed9, 0x0001, 0x5f69, 0x0001, 0x5fad,
+        0x0001, 0x60d8, 0x0001, 0x614e, 0x0001, 0x6108, 0x0001, 0x6160,
+        0x0001, 0x6234, 0x0001, 0x63c4, 0x0001, 0x641c, 0x0001, 0x6452,
+        0x0001, 0x6556, 0x0001, 0x671b, 0x0001, 0x6756, 0x0001, 0x6edb,
+        0x0001, 0x6ecb, 0x0001, 0x701e, 0x0001, 0x77a7, 0x0001, 0x7235,
+        0x0001, 0x72af, 0x0001, 0x7471, 0x0001, 0x7506, 0x0001, 0x753b,
+        0x0001, 0x761d, 0x0001, 0x761f, 0x0001, 0x76db, 0x0001, 0x76f4,
+        0x0001, 0x774a, 0x0001, 0x7740, 0x0001, 0x78cc, 0x0001, 0x7ab1,
+        0x0001, 0x7c7b, 0x0001, 0x7d5b, 0x0001, 0x7f3e, 0x0001, 0x8352,
+        0x0001, 0x83ef, 0x0001, 0x8779, 0x0001, 0x8941, 0x0001, 0x8986,
+        0x0001, 0x8abf, 0x0001, 0x8acb, 0x0001, 0x8aed, 0x0001, 0x8b8a,
+        0x0001, 0x8f38, 0x0001, 0x9072, 0x0001, 0x9199, 0x0001, 0x9276,
+        0x0001, 0x967c, 0x0001, 0x97db, 0x0001, 0x980b, 0x0001, 0x9b12,
+        0x0001, 0x2284a, 0x0001, 0x22844, 0x0001, 0x233d5, 0x0001, 0x3b9d,
+        0x0001, 0x4018, 0x0001, 0x4039, 0x0001, 0x25249, 0x0001, 0x25cd0,
+        0x0001, 0x27ed3, 0x0001, 0x9f43, 0x0001, 0x9f8e, 0x0002, 0x0066,
+        0x0066, 0x0002, 0x0066, 0x0069, 0x0002, 0x0066, 0x006c, 0x0003,
+        0x0066, 0x0066, 0x0069, 0x0003, 0x0066, 0x0066, 0x006c, 0x0002,
+        0x0073, 0x0074, 0x0002, 0x0574, 0x0576, 0x0002, 0x0574, 0x0565,
+        0x0002, 0x0574, 0x056b, 0x0002, 0x057e, 0x0576, 0x0002, 0x0574,
+        0x056d, 0x0002, 0x05d9, 0x05b4, 0x0002, 0x05f2, 0x05b7, 0x0001,
+        0x05e2, 0x0001, 0x05d4, 0x0001, 0x05db, 0x0001, 0x05dc, 0x0001,
+        0x05dd, 0x0001, 0x05e8, 0x0001, 0x05ea, 0x0002, 0x05e9, 0x05c1,
+        0x0002, 0x05e9, 0x05c2, 0x0003, 0x05e9, 0x05bc, 0x05c1, 0x0003,
+        0x05e9, 0x05bc, 0x05c2, 0x0002, 0x05d0, 0x05b7, 0x0002, 0x05d0,
+        0x05b8, 0x0002, 0x05d0, 0x05bc, 0x0002, 0x05d1, 0x05bc, 0x0002,
+        0x05d2, 0x05bc, 0x0002, 0x05d3, 0x05bc, 0x0002, 0x05d4, 0x05bc,
+        0x0002, 0x05d5, 0x05bc, 0x0002, 0x05d6, 0x05bc, 0x0002, 0x05d8,
+        0x05bc, 0x0002, 0x05d9, 0x05bc, 0x0002, 0x05da, 0x05bc, 0x0002,
+        0x05db, 0x05bc, 0x0002, 0x05dc, 0x05bc, 0x0002, 0x05de, 0x05bc,
+        0x0002, 0x05e0, 0x05bc, 0x0002, 0x05e1, 0x05bc, 0x0002, 0x05e3,
+        0x05bc, 0x0002, 0x05e4, 0x05bc, 0x0002, 0x05e6, 0x05bc, 0x0002,
+        0x05e7, 0x05bc, 0x0002, 0x05e8, 0x05bc, 0x0002, 0x05e9, 0x05bc,
+        0x0002, 0x05ea, 0x05bc, 0x0002, 0x05d5, 0x05b9, 0x0002, 0x05d1,
+        0x05bf, 0x0002, 0x05db, 0x05bf, 0x0002, 0x05e4, 0x05bf, 0x0002,
+        0x05d0, 0x05dc, 0x0001, 0x0671, 0x0001, 0x067b, 0x0001, 0x067e,
+        0x0001, 0x0680, 0x0001, 0x067a, 0x0001, 0x067f, 0x0001, 0x0679,
+        0x0001, 0x06a4, 0x0001, 0x06a6, 0x0001, 0x0684, 0x0001, 0x0683,
+        0x0001, 0x0686, 0x0001, 0x0687, 0x0001, 0x068d, 0x0001, 0x068c,
+        0x0001, 0x068e, 0x0001, 0x0688, 0x0001, 0x0698, 0x0001, 0x0691,
+        0x0001, 0x06a9, 0x0001, 0x06af, 0x0001, 0x06b3, 0x0001, 0x06b1,
+        0x0001, 0x06ba, 0x0001, 0x06bb, 0x0001, 0x06c1, 0x0001, 0x06be,
+        0x0001, 0x06d2, 0x0001, 0x06ad, 0x0001, 0x06c7, 0x0001, 0x06c6,
+        0x0001, 0x06c8, 0x0001, 0x06cb, 0x0001, 0x06c5, 0x0001, 0x06c9,
+        0x0001, 0x06d0, 0x0001, 0x0649, 0x0003, 0x064a, 0x0654, 0x0627,
+        0x0003, 0x064a, 0x0654, 0x06d5, 0x0003, 0x064a, 0x0654, 0x0648,
+        0x0003, 0x064a, 0x0654, 0x06c7, 0x0003, 0x064a, 0x0654, 0x06c6,
+        0x0003, 0x064a, 0x0654, 0x06c8, 0x0003, 0x064a, 0x0654, 0x06d0,
+        0x0003, 0x064a, 0x0654, 0x0649, 0x0001, 0x06cc, 0x0003, 0x064a,
+        0x0654, 0x062c, 0x0003, 0x064a, 0x0654, 0x062d, 0x0003, 0x064a,
+        0x0654, 0x0645, 0x0003, 0x064a, 0x0654, 0x064a, 0x0002, 0x0628,
+        0x062c, 0x0002, 0x0628, 0x062d, 0x0002, 0x0628, 0x062e, 0x0002,
+        0x0628, 0x0645, 0x0002, 0x0628, 0x0649, 0x0002, 0x0628, 0x064a,
+        0x0002, 0x062a, 0x062c, 0x0002, 0x062a, 0x062d, 0x0002, 0x062a,
+        0x062e, 0x0002, 0x062a, 0x0645, 0x0002, 0x062a, 0x0649, 0x0002,
+        0x062a, 0x064a, 0x0002, 0x062b, 0x062c, 0x0002, 0x062b, 0x0645,
+        0x0002, 0x062b, 0x0649, 0x0002, 0x062b, 0x064a, 0x0002, 0x062c,
+        0x062d, 0x0002, 0x062c, 0x0645, 0x0002, 0x062d, 0x062c, 0x0002,
+        0x062d, 0x0645, 0x0002, 0x062e, 0x062c, 0x0002, 0x062e, 0x062d,
+        0x0002, 0x062e, 0x0645, 0x0002, 0x0633, 0x062c, 0x0002, 0x0633,
+        0x062d, 0x0002, 0x0633, 0x062e, 0x0002, 0x0633, 0x0645, 0x0002,
+        0x0635, 0x062d, 0x0002, 0x0635, 0x0645, 0x0002, 0x0636, 0x062c,
+        0x0002, 0x0636, 0x062d, 0x0002, 0x0636, 0x062e, 0x0002, 0x0636,
+        0x0645, 0x0002, 0x0637, 0x062d, 0x0002, 0x0637, 0x0645, 0x0002,
+        0x0638, 0x0645, 0x0002, 0x0639, 0x062c, 0x0002, 0x0639, 0x0645,
+        0x0002, 0x063a, 0x062c, 0x0002, 0x063a, 0x0645, 0x0002, 0x0641,
+        0x062c, 0x0002, 0x0641, 0x062d, 0x0002, 0x0641, 0x062e, 0x0002,
+        0x0641, 0x0645, 0x0002, 0x0641, 0x0649, 0x0002, 0x0641, 0x064a,
+        0x0002, 0x0642, 0x062d, 0x0002, 0x0642, 0x0645, 0x0002, 0x0642,
+        0x0649, 0x0002, 0x0642, 0x064a, 0x0002, 0x0643, 0x0627, 0x0002,
+        0x0643, 0x062c, 0x0002, 0x0643, 0x062d, 0x0002, 0x0643, 0x062e,
+        0x0002, 0x0643, 0x0644, 0x0002, 0x0643, 0x0645, 0x0002, 0x0643,
+        0x0649, 0x0002, 0x0643, 0x064a, 0x0002, 0x0644, 0x062c, 0x0002,
+        0x0644, 0x062d, 0x0002, 0x0644, 0x062e, 0x0002, 0x0644, 0x0645,
+        0x0002, 0x0644, 0x0649, 0x0002, 0x0644, 0x064a, 0x0002, 0x0645,
+        0x062c, 0x0002, 0x0645, 0x062d, 0x0002, 0x0645, 0x062e, 0x0002,
+        0x0645, 0x0645, 0x0002, 0x0645, 0x0649, 0x0002, 0x0645, 0x064a,
+        0x0002, 0x0646, 0x062c, 0x0002, 0x0646, 0x062d, 0x0002, 0x0646,
+        0x062e, 0x0002, 0x0646, 0x0645, 0x0002, 0x0646, 0x0649, 0x0002,
+        0x0646, 0x064a, 0x0002, 0x0647, 0x062c, 0x0002, 0x0647, 0x0645,
+        0x0002, 0x0647, 0x0649, 0x0002, 0x0647, 0x064a, 0x0002, 0x064a,
+        0x062c, 0x0002, 0x064a, 0x062d, 0x0002, 0x064a, 0x062e, 0x0002,
+        0x064a, 0x0645, 0x0002, 0x064a, 0x0649, 0x0002, 0x064a, 0x064a,
+        0x0002, 0x0630, 0x0670, 0x0002, 0x0631, 0x0670, 0x0002, 0x0649,
+        0x0670, 0x0003, 0x0020, 0x064c, 0x0651, 0x0003, 0x0020, 0x064d,
+        0x0651, 0x0003, 0x0020, 0x064e, 0x0651, 0x0003, 0x0020, 0x064f,
+        0x0651, 0x0003, 0x0020, 0x0650, 0x0651, 0x0003, 0x0020, 0x0651,
+        0x0670, 0x0003, 0x064a, 0x0654, 0x0631, 0x0003, 0x064a, 0x0654,
+        0x0632, 0x0003, 0x064a, 0x0654, 0x0646, 0x0002, 0x0628, 0x0631,
+        0x0002, 0x0628, 0x0632, 0x0002, 0x0628, 0x0646, 0x0002, 0x062a,
+        0x0631, 0x0002, 0x062a, 0x0632, 0x0002, 0x062a, 0x0646, 0x0002,
+        0x062b, 0x0631, 0x0002, 0x062b, 0x0632, 0x0002, 0x062b, 0x0646,
+        0x0002, 0x0645, 0x0627, 0x0002, 0x0646, 0x0631, 0x0002, 0x0646,
+        0x0632, 0x0002, 0x0646, 0x0646, 0x0002, 0x064a, 0x0631, 0x0002,
+        0x064a, 0x0632, 0x0002, 0x064a, 0x0646, 0x0003, 0x064a, 0x0654,
+        0x062e, 0x0003, 0x064a, 0x0654, 0x0647, 0x0002, 0x0628, 0x0647,
+        0x0002, 0x062a, 0x0647, 0x0002, 0x0635, 0x062e, 0x0002, 0x0644,
+        0x0647, 0x0002, 0x0646, 0x0647, 0x0002, 0x0647, 0x0670, 0x0002,
+        0x064a, 0x0647, 0x0002, 0x062b, 0x0647, 0x0002, 0x0633, 0x0647,
+        0x0002, 0x0634, 0x0645, 0x0002, 0x0634, 0x0647, 0x0003, 0x0640,
+        0x064e, 0x0651, 0x0003, 0x0640, 0x064f, 0x0651, 0x0003, 0x0640,
+        0x0650, 0x0651, 0x0002, 0x0637, 0x0649, 0x0002, 0x0637, 0x064a,
+        0x0002, 0x0639, 0x0649, 0x0002, 0x0639, 0x064a, 0x0002, 0x063a,
+        0x0649, 0x0002, 0x063a, 0x064a, 0x0002, 0x0633, 0x0649, 0x0002,
+        0x0633, 0x064a, 0x0002, 0x0634, 0x0649, 0x0002, 0x0634, 0x064a,
+        0x0002, 0x062d, 0x0649, 0x0002, 0x062d, 0x064a, 0x0002, 0x062c,
+        0x0649, 0x0002, 0x062c, 0x064a, 0x0002, 0x062e, 0x0649, 0x0002,
+        0x062e, 0x064a, 0x0002, 0x0635, 0x0649, 0x0002, 0x0635, 0x064a,
+        0x0002, 0x0636, 0x0649, 0x0002, 0x0636, 0x064a, 0x0002, 0x0634,
+        0x062c, 0x0002, 0x0634, 0x062d, 0x0002, 0x0634, 0x062e, 0x0002,
+        0x0634, 0x0631, 0x0002, 0x0633, 0x0631, 0x0002, 0x0635, 0x0631,
+        0x0002, 0x0636, 0x0631, 0x0002, 0x0627, 0x064b, 0x0003, 0x062a,
+        0x062c, 0x0645, 0x0003, 0x062a, 0x062d, 0x062c, 0x0003, 0x062a,
+        0x062d, 0x0645, 0x0003, 0x062a, 0x062e, 0x0645, 0x0003, 0x062a,
+        0x0645, 0x062c, 0x0003, 0x062a, 0x0645, 0x062d, 0x0003, 0x062a,
+        0x0645, 0x062e, 0x0003, 0x062c, 0x0645, 0x062d, 0x0003, 0x062d,
+        0x0645, 0x064a, 0x0003, 0x062d, 0x0645, 0x0649, 0x0003, 0x0633,
+        0x062d, 0x062c, 0x0003, 0x0633, 0x062c, 0x062d, 0x0003, 0x0633,
+        0x062c, 0x0649, 0x0003, 0x0633, 0x0645, 0x062d, 0x0003, 0x0633,
+        0x0645, 0x062c, 0x0003, 0x0633, 0x0645, 0x0645, 0x0003, 0x0635,
+        0x062d, 0x062d, 0x0003, 0x0635, 0x0645, 0x0645, 0x0003, 0x0634,
+        0x062d, 0x0645, 0x0003, 0x0634, 0x062c, 0x064a, 0x0003, 0x0634,
+        0x0645, 0x062e, 0x0003, 0x0634, 0x0645, 0x0645, 0x0003, 0x0636,
+        0x062d, 0x0649, 0x0003, 0x0636, 0x062e, 0x0645, 0x0003, 0x0637,
+        0x0645, 0x062d, 0x0003, 0x0637, 0x0645, 0x0645, 0x0003, 0x0637,
+        0x0645, 0x064a, 0x0003, 0x0639, 0x062c, 0x0645, 0x0003, 0x0639,
+        0x0645, 0x0645, 0x0003, 0x0639, 0x0645, 0x0649, 0x0003, 0x063a,
+        0x0645, 0x0645, 0x0003, 0x063a, 0x0645, 0x064a, 0x0003, 0x063a,
+        0x0645, 0x0649, 0x0003, 0x0641, 0x062e, 0x0645, 0x0003, 0x0642,
+        0x0645, 0x062d, 0x0003, 0x0642, 0x0645, 0x0645, 0x0003, 0x0644,
+        0x062d, 0x0645, 0x0003, 0x0644, 0x062d, 0x064a, 0x0003, 0x0644,
+        0x062d, 0x0649, 0x0003, 0x0644, 0x062c, 0x062c, 0x0003, 0x0644,
+        0x062e, 0x0645, 0x0003, 0x0644, 0x0645, 0x062d, 0x0003, 0x0645,
+        0x062d, 0x062c, 0x0003, 0x0645, 0x062d, 0x0645, 0x0003, 0x0645,
+        0x062d, 0x064a, 0x0003, 0x0645, 0x062c, 0x062d, 0x0003, 0x0645,
+        0x062c, 0x0645, 0x0003, 0x0645, 0x062e, 0x062c, 0x0003, 0x0645,
+        0x062e, 0x0645, 0x0003, 0x0645, 0x062c, 0x062e, 0x0003, 0x0647,
+        0x0645, 0x062c, 0x0003, 0x0647, 0x0645, 0x0645, 0x0003, 0x0646,
+        0x062d, 0x0645, 0x0003, 0x0646, 0x062d, 0x0649, 0x0003, 0x0646,
+        0x062c, 0x0645, 0x0003, 0x0646, 0x062c, 0x0649, 0x0003, 0x0646,
+        0x0645, 0x064a, 0x0003, 0x0646, 0x0645, 0x0649, 0x0003, 0x064a,
+        0x0645, 0x0645, 0x0003, 0x0628, 0x062e, 0x064a, 0x0003, 0x062a,
+        0x062c, 0x064a, 0x0003, 0x062a, 0x062c, 0x0649, 0x0003, 0x062a,
+        0x062e, 0x064a, 0x0003, 0x062a, 0x062e, 0x0649, 0x0003, 0x062a,
+        0x0645, 0x064a, 0x0003, 0x062a, 0x0645, 0x0649, 0x0003, 0x062c,
+        0x0645, 0x064a, 0x0003, 0x062c, 0x062d, 0x0649, 0x0003, 0x062c,
+        0x0645, 0x0649, 0x0003, 0x0633, 0x062e, 0x0649, 0x0003, 0x0635,
+        0x062d, 0x064a, 0x0003, 0x0634, 0x062d, 0x064a, 0x0003, 0x0636,
+        0x062d, 0x064a, 0x0003, 0x0644, 0x062c, 0x064a, 0x0003, 0x0644,
+        0x0645, 0x064a, 0x0003, 0x064a, 0x062d, 0x064a, 0x0003, 0x064a,
+        0x062c, 0x064a, 0x0003, 0x064a, 0x0645, 0x064a, 0x0003, 0x0645,
+        0x0645, 0x064a, 0x0003, 0x0642, 0x0645, 0x064a, 0x0003, 0x0646,
+        0x062d, 0x064a, 0x0003, 0x0639, 0x0645, 0x064a, 0x0003, 0x0643,
+        0x0645, 0x064a, 0x0003, 0x0646, 0x062c, 0x062d, 0x0003, 0x0645,
+        0x062e, 0x064a, 0x0003, 0x0644, 0x062c, 0x0645, 0x0003, 0x0643,
+        0x0645, 0x0645, 0x0003, 0x062c, 0x062d, 0x064a, 0x0003, 0x062d,
+        0x062c, 0x064a, 0x0003, 0x0645, 0x062c, 0x064a, 0x0003, 0x0641,
+        0x0645, 0x064a, 0x0003, 0x0628, 0x062d, 0x064a, 0x0003, 0x0633,
+        0x062e, 0x064a, 0x0003, 0x0646, 0x062c, 0x064a, 0x0003, 0x0635,
+        0x0644, 0x06d2, 0x0003, 0x0642, 0x0644, 0x06d2, 0x0004, 0x0627,
+        0x0644, 0x0644, 0x0647, 0x0004, 0x0627, 0x0643, 0x0628, 0x0631,
+        0x0004, 0x0645, 0x062d, 0x0645, 0x062f, 0x0004, 0x0635, 0x0644,
+        0x0639, 0x0645, 0x0004, 0x0631, 0x0633, 0x0648, 0x0644, 0x0004,
+        0x0639, 0x0644, 0x064a, 0x0647, 0x0004, 0x0648, 0x0633, 0x0644,
+        0x0645, 0x0003, 0x0635, 0x0644, 0x0649, 0x0012, 0x0635, 0x0644,
+        0x0649, 0x0020, 0x0627, 0x0644, 0x0644, 0x0647, 0x0020, 0x0639,
+        0x0644, 0x064a, 0x0647, 0x0020, 0x0648, 0x0633, 0x0644, 0x0645,
+        0x0008, 0x062c, 0x0644, 0x0020, 0x062c, 0x0644, 0x0627, 0x0644,
+        0x0647, 0x0004, 0x0631, 0x06cc, 0x0627, 0x0644, 0x0001, 0x002c,
+        0x0001, 0x3001, 0x0001, 0x3002, 0x0001, 0x003a, 0x0001, 0x0021,
+        0x0001, 0x003f, 0x0001, 0x3016, 0x0001, 0x3017, 0x0001, 0x2014,
+        0x0001, 0x2013, 0x0001, 0x005f, 0x0001, 0x007b, 0x0001, 0x007d,
+        0x0001, 0x3014, 0x0001, 0x3015, 0x0001, 0x3010, 0x0001, 0x3011,
+        0x0001, 0x300a, 0x0001, 0x300b, 0x0001, 0x300c, 0x0001, 0x300d,
+        0x0001, 0x300e, 0x0001, 0x300f, 0x0001, 0x005b, 0x0001, 0x005d,
+        0x0001, 0x0023, 0x0001, 0x0026, 0x0001, 0x002a, 0x0001, 0x002d,
+        0x0001, 0x003c, 0x0001, 0x003e, 0x0001, 0x005c, 0x0001, 0x0024,
+        0x0001, 0x0025, 0x0001, 0x0040, 0x0002, 0x0020, 0x064b, 0x0002,
+        0x0640, 0x064b, 0x0002, 0x0020, 0x064c, 0x0002, 0x0020, 0x064d,
+        0x0002, 0x0020, 0x064e, 0x0002, 0x0640, 0x064e, 0x0002, 0x0020,
+        0x064f, 0x0002, 0x0640, 0x064f, 0x0002, 0x0020, 0x0650, 0x0002,
+        0x0640, 0x0650, 0x0002, 0x0020, 0x0651, 0x0002, 0x0640, 0x0651,
+        0x0002, 0x0020, 0x0652, 0x0002, 0x0640, 0x0652, 0x0001, 0x0621,
+        0x0001, 0x0627, 0x0001, 0x0628, 0x0001, 0x0629, 0x0001, 0x062a,
+        0x0001, 0x062b, 0x0001, 0x062c, 0x0001, 0x062d, 0x0001, 0x062e,
+        0x0001, 0x062f, 0x0001, 0x0630, 0x0001, 0x0631, 0x0001, 0x0632,
+        0x0001, 0x0633, 0x0001, 0x0634, 0x0001, 0x0635, 0x0001, 0x0636,
+        0x0001, 0x0637, 0x0001, 0x0638, 0x0001, 0x0639, 0x0001, 0x063a,
+        0x0001, 0x0641, 0x0001, 0x0642, 0x0001, 0x0643, 0x0001, 0x0644,
+        0x0001, 0x0645, 0x0001, 0x0646, 0x0001, 0x0647, 0x0001, 0x0648,
+        0x0001, 0x064a, 0x0003, 0x0644, 0x0627, 0x0653, 0x0003, 0x0644,
+        0x0627, 0x0654, 0x0003, 0x0644, 0x0627, 0x0655, 0x0002, 0x0644,
+        0x0627, 0x0001, 0x0022, 0x0001, 0x0027, 0x0001, 0x002f, 0x0001,
+        0x005e, 0x0001, 0x007c, 0x0001, 0x007e, 0x0001, 0x2985, 0x0001,
+        0x2986, 0x0001, 0x30fb, 0x0001, 0x30a1, 0x0001, 0x30a3, 0x0001,
+        0x30a5, 0x0001, 0x30a7, 0x0001, 0x30a9, 0x0001, 0x30e3, 0x0001,
+        0x30e5, 0x0001, 0x30e7, 0x0001, 0x30c3, 0x0001, 0x30fc, 0x0001,
+        0x30f3, 0x0001, 0x3099, 0x0001, 0x309a, 0x0001, 0x00a2, 0x0001,
+        0x00a3, 0x0001, 0x00ac, 0x0001, 0x00a6, 0x0001, 0x00a5, 0x0001,
+        0x20a9, 0x0001, 0x2502, 0x0001, 0x2190, 0x0001, 0x2191, 0x0001,
+        0x2192, 0x0001, 0x2193, 0x0001, 0x25a0, 0x0001, 0x25cb, 0x0001,
+        0x02d0, 0x0001, 0x02d1, 0x0001, 0x00e6, 0x0001, 0x0299, 0x0001,
+        0x0253, 0x0001, 0x02a3, 0x0001, 0xab66, 0x0001, 0x02a5, 0x0001,
+        0x02a4, 0x0001, 0x0256, 0x0001, 0x0257, 0x0001, 0x1d91, 0x0001,
+        0x0258, 0x0001, 0x025e, 0x0001, 0x02a9, 0x0001, 0x0264, 0x0001,
+        0x0262, 0x0001, 0x0260, 0x0001, 0x029b, 0x0001, 0x029c, 0x0001,
+        0x0267, 0x0001, 0x0284, 0x0001, 0x02aa, 0x0001, 0x02ab, 0x0001,
+        0x026c, 0x0001, 0x1df04, 0x0001, 0xa78e, 0x0001, 0x026e, 0x0001,
+        0x1df05, 0x0001, 0x028e, 0x0001, 0x1df06, 0x0001, 0x00f8, 0x0001,
+        0x0276, 0x0001, 0x0277, 0x0001, 0x027a, 0x0001, 0x1df08, 0x0001,
+        0x027d, 0x0001, 0x027e, 0x0001, 0x0280, 0x0001, 0x02a8, 0x0001,
+        0x02a6, 0x0001, 0xab67, 0x0001, 0x02a7, 0x0001, 0x0288, 0x0001,
+        0x2c71, 0x0001, 0x028f, 0x0001, 0x02a1, 0x0001, 0x02a2, 0x0001,
+        0x0298, 0x0001, 0x01c0, 0x0001, 0x01c1, 0x0001, 0x01c2, 0x0001,
+        0x1df0a, 0x0001, 0x1df1e, 0x0002, 0x11099, 0x110ba, 0x0002, 0x1109b,
+        0x110ba, 0x0002, 0x110a5, 0x110ba, 0x0002, 0x11131, 0x11127, 0x0002,
+        0x11132, 0x11127, 0x0002, 0x11347, 0x1133e, 0x0002, 0x11347, 0x11357,
+        0x0002, 0x114b9, 0x114ba, 0x0002, 0x114b9, 0x114b0, 0x0002, 0x114b9,
+        0x114bd, 0x0002, 0x115b8, 0x115af, 0x0002, 0x115b9, 0x115af, 0x0002,
+        0x11935, 0x11930, 0x0002, 0x1d157, 0x1d165, 0x0002, 0x1d158, 0x1d165,
+        0x0003, 0x1d158, 0x1d165, 0x1d16e, 0x0003, 0x1d158, 0x1d165, 0x1d16f,
+        0x0003, 0x1d158, 0x1d165, 0x1d170, 0x0003, 0x1d158, 0x1d165, 0x1d171,
+        0x0003, 0x1d158, 0x1d165, 0x1d172, 0x0002, 0x1d1b9, 0x1d165, 0x0002,
+        0x1d1ba, 0x1d165, 0x0003, 0x1d1b9, 0x1d165, 0x1d16e, 0x0003, 0x1d1ba,
+        0x1d165, 0x1d16e, 0x0003, 0x1d1b9, 0x1d165, 0x1d16f, 0x0003, 0x1d1ba,
+        0x1d165, 0x1d16f, 0x0001, 0x0131, 0x0001, 0x0237, 0x0001, 0x0391,
+        0x0001, 0x0392, 0x0001, 0x0394, 0x0001, 0x0395, 0x0001, 0x0396,
+        0x0001, 0x0397, 0x0001, 0x0399, 0x0001, 0x039a, 0x0001, 0x039b,
+        0x0001, 0x039c, 0x0001, 0x039d, 0x0001, 0x039e, 0x0001, 0x039f,
+        0x0001, 0x03a1, 0x0001, 0x03a4, 0x0001, 0x03a6, 0x0001, 0x03a7,
+        0x0001, 0x03a8, 0x0001, 0x2207, 0x0001, 0x03b1, 0x0001, 0x03b6,
+        0x0001, 0x03b7, 0x0001, 0x03bb, 0x0001, 0x03bd, 0x0001, 0x03be,
+        0x0001, 0x03bf, 0x0001, 0x03c3, 0x0001, 0x03c4, 0x0001, 0x03c5,
+        0x0001, 0x03c8, 0x0001, 0x03c9, 0x0001, 0x2202, 0x0001, 0x03dc,
+        0x0001, 0x03dd, 0x0001, 0x066e, 0x0001, 0x06a1, 0x0001, 0x066f,
+        0x0002, 0x0030, 0x002e, 0x0002, 0x0030, 0x002c, 0x0002, 0x0031,
+        0x002c, 0x0002, 0x0032, 0x002c, 0x0002, 0x0033, 0x002c, 0x0002,
+        0x0034, 0x002c, 0x0002, 0x0035, 0x002c, 0x0002, 0x0036, 0x002c,
+        0x0002, 0x0037, 0x002c, 0x0002, 0x0038, 0x002c, 0x0002, 0x0039,
+        0x002c, 0x0003, 0x0028, 0x0041, 0x0029, 0x0003, 0x0028, 0x0042,
+        0x0029, 0x0003, 0x0028, 0x0043, 0x0029, 0x0003, 0x0028, 0x0044,
+        0x0029, 0x0003, 0x0028, 0x0045, 0x0029, 0x0003, 0x0028, 0x0046,
+        0x0029, 0x0003, 0x0028, 0x0047, 0x0029, 0x0003, 0x0028, 0x0048,
+        0x0029, 0x0003, 0x0028, 0x0049, 0x0029, 0x0003, 0x0028, 0x004a,
+        0x0029, 0x0003, 0x0028, 0x004b, 0x0029, 0x0003, 0x0028, 0x004c,
+        0x0029, 0x0003, 0x0028, 0x004d, 0x0029, 0x0003, 0x0028, 0x004e,
+        0x0029, 0x0003, 0x0028, 0x004f, 0x0029, 0x0003, 0x0028, 0x0050,
+        0x0029, 0x0003, 0x0028, 0x0051, 0x0029, 0x0003, 0x0028, 0x0052,
+        0x0029, 0x0003, 0x0028, 0x0053, 0x0029, 0x0003, 0x0028, 0x0054,
+        0x0029, 0x0003, 0x0028, 0x0055, 0x0029, 0x0003, 0x0028, 0x0056,
+        0x0029, 0x0003, 0x0028, 0x0057, 0x0029, 0x0003, 0x0028, 0x0058,
+        0x0029, 0x0003, 0x0028, 0x0059, 0x0029, 0x0003, 0x0028, 0x005a,
+        0x0029, 0x0003, 0x3014, 0x0053, 0x3015, 0x0002, 0x0043, 0x0044,
+        0x0002, 0x0057, 0x005a, 0x0002, 0x0048, 0x0056, 0x0002, 0x0053,
+        0x0044, 0x0002, 0x0053, 0x0053, 0x0003, 0x0050, 0x0050, 0x0056,
+        0x0002, 0x0057, 0x0043, 0x0002, 0x004d, 0x0043, 0x0002, 0x004d,
+        0x0044, 0x0002, 0x004d, 0x0052, 0x0002, 0x0044, 0x004a, 0x0002,
+        0x307b, 0x304b, 0x0002, 0x30b3, 0x30b3, 0x0001, 0x5b57, 0x0001,
+        0x53cc, 0x0001, 0x591a, 0x0001, 0x89e3, 0x0001, 0x4ea4, 0x0001,
+        0x6620, 0x0001, 0x7121, 0x0001, 0x524d, 0x0001, 0x5f8c, 0x0001,
+        0x518d, 0x0001, 0x65b0, 0x0001, 0x521d, 0x0001, 0x7d42, 0x0001,
+        0x8ca9, 0x0001, 0x58f0, 0x0001, 0x5439, 0x0001, 0x6f14, 0x0001,
+        0x6295, 0x0001, 0x6355, 0x0001, 0x904a, 0x0001, 0x6307, 0x0001,
+        0x6253, 0x0001, 0x7981, 0x0001, 0x7a7a, 0x0001, 0x5408, 0x0001,
+        0x6e80, 0x0001, 0x7533, 0x0001, 0x5272, 0x0001, 0x55b6, 0x0001,
+        0x914d, 0x0003, 0x3014, 0x672c, 0x3015, 0x0003, 0x3014, 0x4e09,
+        0x3015, 0x0003, 0x3014, 0x4e8c, 0x3015, 0x0003, 0x3014, 0x5b89,
+        0x3015, 0x0003, 0x3014, 0x70b9, 0x3015, 0x0003, 0x3014, 0x6253,
+        0x3015, 0x0003, 0x3014, 0x76d7, 0x3015, 0x0003, 0x3014, 0x52dd,
+        0x3015, 0x0003, 0x3014, 0x6557, 0x3015, 0x0001, 0x5f97, 0x0001,
+        0x53ef, 0x0001, 0x4e3d, 0x0001, 0x4e38, 0x0001, 0x4e41, 0x0001,
+        0x20122, 0x0001, 0x4f60, 0x0001, 0x4fbb, 0x0001, 0x5002, 0x0001,
+        0x507a, 0x0001, 0x5099, 0x0001, 0x50cf, 0x0001, 0x349e, 0x0001,
+        0x2063a, 0x0001, 0x5154, 0x0001, 0x5164, 0x0001, 0x5177, 0x0001,
+        0x2051c, 0x0001, 0x34b9, 0x0001, 0x5167, 0x0001, 0x2054b, 0x0001,
+        0x5197, 0x0001, 0x51a4, 0x0001, 0x4ecc, 0x0001, 0x51ac, 0x0001,
+        0x291df, 0x0001, 0x5203, 0x0001, 0x34df, 0x0001, 0x523b, 0x0001,
+        0x5246, 0x0001, 0x5277, 0x0001, 0x3515, 0x0001, 0x5305, 0x0001,
+        0x5306, 0x0001, 0x5349, 0x0001, 0x535a, 0x0001, 0x5373, 0x0001,
+        0x537d, 0x0001, 0x537f, 0x0001, 0x20a2c, 0x0001, 0x7070, 0x0001,
+        0x53ca, 0x0001, 0x53df, 0x0001, 0x20b63, 0x0001, 0x53eb, 0x0001,
+        0x53f1, 0x0001, 0x5406, 0x0001, 0x549e, 0x0001, 0x5438, 0x0001,
+        0x5448, 0x0001, 0x5468, 0x0001, 0x54a2, 0x0001, 0x54f6, 0x0001,
+        0x5510, 0x0001, 0x5553, 0x0001, 0x5563, 0x0001, 0x5584, 0x0001,
+        0x55ab, 0x0001, 0x55b3, 0x0001, 0x55c2, 0x0001, 0x5716, 0x0001,
+        0x5717, 0x0001, 0x5651, 0x0001, 0x5674, 0x0001, 0x58ee, 0x0001,
+        0x57ce, 0x0001, 0x57f4, 0x0001, 0x580d, 0x0001, 0x578b, 0x0001,
+        0x5832, 0x0001, 0x5831, 0x0001, 0x58ac, 0x0001, 0x214e4, 0x0001,
+        0x58f2, 0x0001, 0x58f7, 0x0001, 0x5906, 0x0001, 0x5922, 0x0001,
+        0x5962, 0x0001, 0x216a8, 0x0001, 0x216ea, 0x0001, 0x59ec, 0x0001,
+        0x5a1b, 0x0001, 0x5a27, 0x0001, 0x59d8, 0x0001, 0x5a66, 0x0001,
+        0x36ee, 0x0001, 0x36fc, 0x0001, 0x5b08, 0x0001, 0x5b3e, 0x0001,
+        0x219c8, 0x0001, 0x5bc3, 0x0001, 0x5bd8, 0x0001, 0x5bf3, 0x0001,
+        0x21b18, 0x0001, 0x5bff, 0x0001, 0x5c06, 0x0001, 0x5f53, 0x0001,
+        0x3781, 0x0001, 0x5c60, 0x0001, 0x5cc0, 0x0001, 0x5c8d, 0x0001,
+        0x21de4, 0x0001, 0x5d43, 0x0001, 0x21de6, 0x0001, 0x5d6e, 0x0001,
+        0x5d6b, 0x0001, 0x5d7c, 0x0001, 0x5de1, 0x0001, 0x5de2, 0x0001,
+        0x382f, 0x0001, 0x5dfd, 0x0001, 0x5e28, 0x0001, 0x5e3d, 0x0001,
+        0x5e69, 0x0001, 0x3862, 0x0001, 0x22183, 0x0001, 0x387c, 0x0001,
+        0x5eb0, 0x0001, 0x5eb3, 0x0001, 0x5eb6, 0x0001, 0x2a392, 0x0001,
+        0x22331, 0x0001, 0x8201, 0x0001, 0x5f22, 0x0001, 0x38c7, 0x0001,
+        0x232b8, 0x0001, 0x261da, 0x0001, 0x5f62, 0x0001, 0x5f6b, 0x0001,
+        0x38e3, 0x0001, 0x5f9a, 0x0001, 0x5fcd, 0x0001, 0x5fd7, 0x0001,
+        0x5ff9, 0x0001, 0x6081, 0x0001, 0x393a, 0x0001, 0x391c, 0x0001,
+        0x226d4, 0x0001, 0x60c7, 0x0001, 0x6148, 0x0001, 0x614c, 0x0001,
+        0x617a, 0x0001, 0x61b2, 0x0001, 0x61a4, 0x0001, 0x61af, 0x0001,
+        0x61de, 0x0001, 0x6210, 0x0001, 0x621b, 0x0001, 0x625d, 0x0001,
+        0x62b1, 0x0001, 0x62d4, 0x0001, 0x6350, 0x0001, 0x22b0c, 0x0001,
+        0x633d, 0x0001, 0x62fc, 0x0001, 0x6368, 0x0001, 0x6383, 0x0001,
+        0x63e4, 0x0001, 0x22bf1, 0x0001, 0x6422, 0x0001, 0x63c5, 0x0001,
+        0x63a9, 0x0001, 0x3a2e, 0x0001, 0x6469, 0x0001, 0x647e, 0x0001,
+        0x649d, 0x0001, 0x6477, 0x0001, 0x3a6c, 0x0001, 0x656c, 0x0001,
+        0x2300a, 0x0001, 0x65e3, 0x0001, 0x66f8, 0x0001, 0x6649, 0x0001,
+        0x3b19, 0x0001, 0x3b08, 0x0001, 0x3ae4, 0x0001, 0x5192, 0x0001,
+        0x5195, 0x0001, 0x6700, 0x0001, 0x669c, 0x0001, 0x80ad, 0x0001,
+        0x43d9, 0x0001, 0x6721, 0x0001, 0x675e, 0x0001, 0x6753, 0x0001,
+        0x233c3, 0x0001, 0x3b49, 0x0001, 0x67fa, 0x0001, 0x6785, 0x0001,
+        0x6852, 0x0001, 0x2346d, 0x0001, 0x688e, 0x0001, 0x681f, 0x0001,
+        0x6914, 0x0001, 0x6942, 0x0001, 0x69a3, 0x0001, 0x69ea, 0x0001,
+        0x6aa8, 0x0001, 0x236a3, 0x0001, 0x6adb, 0x0001, 0x3c18, 0x0001,
+        0x6b21, 0x0001, 0x238a7, 0x0001, 0x6b54, 0x0001, 0x3c4e, 0x0001,
+        0x6b72, 0x0001, 0x6b9f, 0x0001, 0x6bbb, 0x0001, 0x23a8d, 0x0001,
+        0x21d0b, 0x0001, 0x23afa, 0x0001, 0x6c4e, 0x0001, 0x23cbc, 0x0001,
+        0x6cbf, 0x0001, 0x6ccd, 0x0001, 0x6c67, 0x0001, 0x6d16, 0x0001,
+        0x6d3e, 0x0001, 0x6d69, 0x0001, 0x6d78, 0x0001, 0x6d85, 0x0001,
+        0x23d1e, 0x0001, 0x6d34, 0x0001, 0x6e2f, 0x0001, 0x6e6e, 0x0001,
+        0x3d33, 0x0001, 0x6ec7, 0x0001, 0x23ed1, 0x0001, 0x6df9, 0x0001,
+        0x6f6e, 0x0001, 0x23f5e, 0x0001, 0x23f8e, 0x0001, 0x6fc6, 0x0001,
+        0x7039, 0x0001, 0x701b, 0x0001, 0x3d96, 0x0001, 0x704a, 0x0001,
+        0x707d, 0x0001, 0x7077, 0x0001, 0x70ad, 0x0001, 0x20525, 0x0001,
+        0x7145, 0x0001, 0x24263, 0x0001, 0x719c, 0x0001, 0x243ab, 0x0001,
+        0x7228, 0x0001, 0x7250, 0x0001, 0x24608, 0x0001, 0x7280, 0x0001,
+        0x7295, 0x0001, 0x24735, 0x0001, 0x24814, 0x0001, 0x737a, 0x0001,
+        0x738b, 0x0001, 0x3eac, 0x0001, 0x73a5, 0x0001, 0x3eb8, 0x0001,
+        0x7447, 0x0001, 0x745c, 0x0001, 0x7485, 0x0001, 0x74ca, 0x0001,
+        0x3f1b, 0x0001, 0x7524, 0x0001, 0x24c36, 0x0001, 0x753e, 0x0001,
+        0x24c92, 0x0001, 0x2219f, 0x0001, 0x7610, 0x0001, 0x24fa1, 0x0001,
+        0x24fb8, 0x0001, 0x25044, 0x0001, 0x3ffc, 0x0001, 0x4008, 0x0001,
+        0x250f3, 0x0001, 0x250f2, 0x0001, 0x25119, 0x0001, 0x25133, 0x0001,
+        0x771e, 0x0001, 0x771f, 0x0001, 0x778b, 0x0001, 0x4046, 0x0001,
+        0x4096, 0x0001, 0x2541d, 0x0001, 0x784e, 0x0001, 0x40e3, 0x0001,
+        0x25626, 0x0001, 0x2569a, 0x0001, 0x256c5, 0x0001, 0x79eb, 0x0001,
+        0x412f, 0x0001, 0x7a4a, 0x0001, 0x7a4f, 0x0001, 0x2597c, 0x0001,
+        0x25aa7, 0x0001, 0x7aee, 0x0001, 0x4202, 0x0001, 0x25bab, 0x0001,
+        0x7bc6, 0x0001, 0x7bc9, 0x0001, 0x4227, 0x0001, 0x25c80, 0x0001,
+        0x7cd2, 0x0001, 0x42a0, 0x0001, 0x7ce8, 0x0001, 0x7ce3, 0x0001,
+        0x7d00, 0x0001, 0x25f86, 0x0001, 0x7d63, 0x0001, 0x4301, 0x0001,
+        0x7dc7, 0x0001, 0x7e02, 0x0001, 0x7e45, 0x0001, 0x4334, 0x0001,
+        0x26228, 0x0001, 0x26247, 0x0001, 0x4359, 0x0001, 0x262d9, 0x0001,
+        0x7f7a, 0x0001, 0x2633e, 0x0001, 0x7f95, 0x0001, 0x7ffa, 0x0001,
+        0x264da, 0x0001, 0x26523, 0x0001, 0x8060, 0x0001, 0x265a8, 0x0001,
+        0x8070, 0x0001, 0x2335f, 0x0001, 0x43d5, 0x0001, 0x80b2, 0x0001,
+        0x8103, 0x0001, 0x440b, 0x0001, 0x813e, 0x0001, 0x5ab5, 0x0001,
+        0x267a7, 0x0001, 0x267b5, 0x0001, 0x23393, 0x0001, 0x2339c, 0x0001,
+        0x8204, 0x0001, 0x8f9e, 0x0001, 0x446b, 0x0001, 0x8291, 0x0001,
+        0x828b, 0x0001, 0x829d, 0x0001, 0x52b3, 0x0001, 0x82b1, 0x0001,
+        0x82b3, 0x0001, 0x82bd, 0x0001, 0x82e6, 0x0001, 0x26b3c, 0x0001,
+        0x831d, 0x0001, 0x8363, 0x0001, 0x83ad, 0x0001, 0x8323, 0x0001,
+        0x83bd, 0x0001, 0x83e7, 0x0001, 0x8353, 0x0001, 0x83ca, 0x0001,
+        0x83cc, 0x0001, 0x83dc, 0x0001, 0x26c36, 0x0001, 0x26d6b, 0x0001,
+        0x26cd5, 0x0001, 0x452b, 0x0001, 0x84f1, 0x0001, 0x84f3, 0x0001,
+        0x8516, 0x0001, 0x273ca, 0x0001, 0x8564, 0x0001, 0x26f2c, 0x0001,
+        0x455d, 0x0001, 0x4561, 0x0001, 0x26fb1, 0x0001, 0x270d2, 0x0001,
+        0x456b, 0x0001, 0x8650, 0x0001, 0x8667, 0x0001, 0x8669, 0x0001,
+        0x86a9, 0x0001, 0x8688, 0x0001, 0x870e, 0x0001, 0x86e2, 0x0001,
+        0x8728, 0x0001, 0x876b, 0x0001, 0x8786, 0x0001, 0x45d7, 0x0001,
+        0x87e1, 0x0001, 0x8801, 0x0001, 0x45f9, 0x0001, 0x8860, 0x0001,
+        0x27667, 0x0001, 0x88d7, 0x0001, 0x88de, 0x0001, 0x4635, 0x0001,
+        0x88fa, 0x0001, 0x34bb, 0x0001, 0x278ae, 0x0001, 0x27966, 0x0001,
+        0x46be, 0x0001, 0x46c7, 0x0001, 0x8aa0, 0x0001, 0x27ca8, 0x0001,
+        0x8cab, 0x0001, 0x8cc1, 0x0001, 0x8d1b, 0x0001, 0x8d77, 0x0001,
+        0x27f2f, 0x0001, 0x20804, 0x0001, 0x8dcb, 0x0001, 0x8dbc, 0x0001,
+        0x8df0, 0x0001, 0x208de, 0x0001, 0x8ed4, 0x0001, 0x285d2, 0x0001,
+        0x285ed, 0x0001, 0x9094, 0x0001, 0x90f1, 0x0001, 0x9111, 0x0001,
+        0x2872e, 0x0001, 0x911b, 0x0001, 0x9238, 0x0001, 0x92d7, 0x0001,
+        0x92d8, 0x0001, 0x927c, 0x0001, 0x93f9, 0x0001, 0x9415, 0x0001,
+        0x28bfa, 0x0001, 0x958b, 0x0001, 0x4995, 0x0001, 0x95b7, 0x0001,
+        0x28d77, 0x0001, 0x49e6, 0x0001, 0x96c3, 0x0001, 0x5db2, 0x0001,
+        0x9723, 0x0001, 0x29145, 0x0001, 0x2921a, 0x0001, 0x4a6e, 0x0001,
+        0x4a76, 0x0001, 0x97e0, 0x0001, 0x2940a, 0x0001, 0x4ab2, 0x0001,
+        0x29496, 0x0001, 0x9829, 0x0001, 0x295b6, 0x0001, 0x98e2, 0x0001,
+        0x4b33, 0x0001, 0x9929, 0x0001, 0x99a7, 0x0001, 0x99c2, 0x0001,
+        0x99fe, 0x0001, 0x4bce, 0x0001, 0x29b30, 0x0001, 0x9c40, 0x0001,
+        0x9cfd, 0x0001, 0x4cce, 0x0001, 0x4ced, 0x0001, 0x9d67, 0x0001,
+        0x2a0ce, 0x0001, 0x4cf8, 0x0001, 0x2a105, 0x0001, 0x2a20e, 0x0001,
+        0x2a291, 0x0001, 0x4d56, 0x0001, 0x9efe, 0x0001, 0x9f05, 0x0001,
+        0x9f0f, 0x0001, 0x9f16, 0x0001, 0x2a600,
+};
+
+/// 一级表，按 cp >> 10 索引
+static const uint8_t NormStage1[1088] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 15, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 17, 13, 13, 13, 13, 13, 13, 13, 13, 18, 19,
+        20, 21, 22, 23, 24, 25, 26, 27, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 28, 29, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 30,
+        13, 13, 13, 13, 31, 32, 13, 13, 33, 13, 34, 35, 36, 13, 37, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 38, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+};
+
+/// 二级表，每块 64 项，按 (cp >> 4) & 63 索引
+static const uint16_t NormStage2[2496] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 6,
+        7, 8, 9, 10, 11, 12, 13, 14, 0, 0, 15, 16, 17, 18, 19, 20,
+        21, 22, 23, 24, 0, 0, 0, 0, 0, 0, 0, 25, 0, 26, 27, 0,
+        28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 0, 42,
+        43, 44, 0, 45, 0, 46, 0, 47, 48, 0, 0, 0, 49, 50, 51, 52,
+        0, 0, 0, 0, 0, 0, 0, 0, 53, 54, 55, 56, 57, 0, 0, 0,
+        0, 58, 59, 0, 60, 61, 0, 62, 0, 0, 0, 0, 63, 64, 65, 0,
+        0, 66, 0, 67, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 69, 70,
+        0, 71, 72, 0, 0, 73, 0, 0, 0, 74, 0, 0, 75, 76, 77, 78,
+        0, 0, 79, 80, 81, 82, 0, 0, 0, 0, 0, 83, 84, 85, 0, 86,
+        0, 0, 0, 87, 81, 88, 0, 0, 0, 0, 0, 89, 81, 0, 0, 0,
+        0, 0, 0, 83, 90, 91, 0, 0, 0, 92, 0, 93, 94, 95, 0, 0,
+        0, 0, 0, 89, 96, 97, 0, 0, 0, 0, 0, 89, 98, 99, 0, 0,
+        0, 0, 0, 100, 101, 95, 0, 0, 0, 0, 0, 0, 102, 103, 0, 0,
+        0, 0, 0, 104, 105, 0, 0, 0, 0, 0, 0, 106, 107, 108, 0, 0,
+        109, 110, 0, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 0, 0, 0,
+        0, 0, 121, 122, 0, 0, 0, 0, 123, 0, 0, 0, 0, 0, 0, 124,
+        0, 0, 0, 0, 0, 0, 125, 126, 0, 0, 127, 128, 129, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 130, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 131, 0, 132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 133, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 134, 0, 0, 0, 0, 0,
+        0, 0, 0, 135, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 136, 0, 0, 0, 0, 137, 138, 0, 0, 0, 139, 140, 0, 0, 0,
+        141, 142, 0, 143, 144, 0, 145, 146, 0, 0, 147, 0, 0, 0, 148, 149,
+        0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 151, 152, 153,
+        0, 0, 154, 155, 156, 157, 158, 159, 0, 160, 161, 162, 163, 164, 165, 166,
+        167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182,
+        183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198,
+        199, 200, 201, 202, 203, 204, 0, 205, 206, 207, 208, 0, 0, 209, 210, 211,
+        212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 0, 223, 0, 0, 0,
+        224, 0, 225, 226, 227, 0, 228, 229, 230, 0, 231, 0, 0, 0, 232, 0,
+        0, 0, 233, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 234, 235, 236, 237, 238, 239, 240, 241, 242, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        243, 0, 0, 0, 0, 0, 0, 244, 0, 0, 0, 0, 0, 245, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 246, 0, 0, 0, 0, 0, 0, 247, 248,
+        0, 0, 0, 0, 0, 0, 249, 250, 0, 0, 0, 0, 0, 0, 165, 165,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 251, 0, 0, 0, 0, 0, 252,
+        253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 0, 0,
+        267, 0, 268, 269, 270, 271, 272, 273, 0, 274, 275, 276, 277, 278, 0, 279,
+        0, 0, 0, 280, 281, 282, 283, 284, 285, 286, 0, 0, 0, 0, 0, 0,
+        287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302,
+        303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 247, 319, 0, 320, 0, 0, 0, 0, 0, 248,
+        0, 0, 0, 0, 0, 0, 0, 321, 0, 0, 0, 0, 0, 0, 0, 322,
+        323, 0, 324, 0, 0, 0, 0, 0, 0, 0, 0, 0, 132, 0, 165, 248,
+        0, 0, 325, 0, 0, 326, 0, 0, 0, 0, 0, 327, 137, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 328, 329, 0, 0, 323,
+        0, 0, 0, 0, 0, 330, 331, 0, 0, 0, 0, 0, 0, 0, 81, 0,
+        332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332,
+        332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332,
+        332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332,
+        332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332,
+        332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332,
+        332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332,
+        332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 332,
+        332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 333, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349,
+        350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360, 361, 362, 363, 0, 0,
+        364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 0, 376, 377, 378,
+        379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 392, 393, 394,
+        395, 396, 397, 398, 0, 399, 400, 401, 402, 403, 404, 405, 406, 0, 0, 407,
+        0, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419, 420, 421, 422,
+        423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 433, 434, 435, 436, 437, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 123,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 438, 0,
+        0, 0, 0, 0, 0, 0, 0, 439, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 440, 441, 442, 443, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        444, 0, 0, 445, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 447, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 448, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 449, 438, 0, 0, 450, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 323, 0, 0, 451, 0, 452, 453, 454, 0, 0, 0, 0,
+        455, 0, 456, 457, 0, 0, 0, 327, 0, 0, 0, 0, 458, 0, 0, 0,
+        0, 0, 0, 459, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 460, 0,
+        0, 0, 0, 461, 462, 95, 463, 464, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 465, 86, 0, 0, 0, 0, 0, 466, 467, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 468, 469, 470, 0, 0, 0,
+        0, 0, 0, 250, 0, 0, 0, 0, 0, 0, 0, 471, 0, 0, 0, 0,
+        0, 0, 472, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 473, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 474, 327, 0, 0, 0, 0, 0, 0, 0, 0, 0, 137, 0,
+        0, 0, 0, 132, 475, 0, 0, 0, 0, 476, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 250, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 477, 0, 0, 0, 0, 475, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 478,
+        0, 0, 0, 479, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 480,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 481, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 482, 483, 484, 485, 0, 486, 487, 488, 0, 0, 0,
+        0, 0, 0, 0, 489, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        490, 491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 490, 491, 492,
+        503, 504, 505, 506, 507, 508, 509, 510, 511, 512, 490, 491, 492, 493, 494, 505,
+        496, 497, 498, 509, 510, 511, 512, 490, 491, 492, 513, 514, 515, 516, 517, 518,
+        519, 520, 521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534,
+        535, 536, 537, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 479, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 86, 0, 0, 0, 538, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 539, 0, 0,
+        0, 0, 0, 0, 540, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        541, 542, 543, 544, 545, 546, 547, 548, 549, 550, 551, 550, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        552, 553, 554, 490, 555, 0, 556, 0, 0, 557, 0, 0, 0, 0, 0, 0,
+        558, 559, 560, 561, 562, 563, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 564,
+        565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 579, 580,
+        581, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 592, 593, 594, 595, 596,
+        597, 598, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/// 三级表，每块 16 个码点
+static const uint16_t NormStage3[9584] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 0, 0, 0, 4,
+        0, 0, 5, 6, 7, 8, 0, 0, 9, 10, 11, 0, 12, 13, 14, 0,
+        15, 16, 17, 18, 19, 20, 0, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+        0, 30, 31, 32, 33, 34, 35, 0, 0, 36, 37, 38, 39, 40, 0, 0,
+        41, 42, 43, 44, 45, 46, 0, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+        0, 56, 57, 58, 59, 60, 61, 0, 0, 62, 63, 64, 65, 66, 0, 67,
+        68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+        0, 0, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97,
+        98, 99, 100, 101, 102, 103, 0, 0, 104, 105, 106, 107, 108, 109, 110, 111,
+        112, 0, 113, 114, 115, 116, 117, 118, 0, 119, 120, 121, 122, 123, 124, 125,
+        126, 0, 0, 127, 128, 129, 130, 131, 132, 133, 0, 0, 134, 135, 136, 137,
+        138, 139, 0, 0, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+        152, 153, 154, 155, 156, 157, 0, 0, 158, 159, 160, 161, 162, 163, 164, 165,
+        166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+        182, 183, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 184,
+        185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197,
+        198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 0, 211, 212,
+        213, 214, 215, 216, 0, 0, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226,
+        227, 228, 229, 230, 231, 232, 0, 0, 233, 234, 235, 236, 237, 238, 239, 240,
+        241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256,
+        257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 0, 0, 269, 270,
+        0, 0, 0, 0, 0, 0, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280,
+        281, 282, 283, 284, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        285, 286, 287, 288, 289, 290, 291, 292, 293, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 294, 295, 296, 297, 298, 299, 0, 0,
+        300, 301, 181, 302, 303, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        304, 304, 304, 304, 304, 305, 304, 304, 304, 304, 304, 304, 304, 305, 305, 304,
+        305, 304, 305, 304, 304, 306, 307, 307, 307, 307, 306, 308, 307, 307, 307, 307,
+        307, 309, 309, 310, 310, 310, 310, 311, 311, 307, 307, 307, 307, 310, 310, 307,
+        310, 310, 307, 307, 312, 312, 312, 312, 313, 307, 307, 307, 307, 305, 305, 305,
+        314, 315, 304, 316, 317, 318, 305, 307, 307, 307, 305, 305, 305, 307, 307, 0,
+        305, 305, 305, 307, 307, 307, 307, 305, 306, 307, 307, 305, 319, 320, 320, 319,
+        320, 320, 319, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305,
+        0, 0, 0, 0, 321, 0, 0, 0, 0, 0, 322, 0, 0, 0, 323, 0,
+        0, 0, 0, 0, 7, 324, 325, 326, 327, 328, 329, 0, 330, 0, 331, 332,
+        333, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 334, 335, 336, 337, 338, 339,
+        340, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 341, 342, 343, 344, 345, 0,
+        346, 347, 348, 349, 350, 351, 352, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        353, 354, 355, 0, 356, 357, 0, 0, 0, 358, 0, 0, 0, 0, 0, 0,
+        359, 360, 0, 361, 0, 0, 0, 362, 0, 0, 0, 0, 363, 364, 365, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 366, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 0, 0, 0, 0, 0, 0,
+        368, 369, 0, 370, 0, 0, 0, 371, 0, 0, 0, 0, 372, 373, 374, 0,
+        0, 0, 0, 0, 0, 0, 375, 376, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 305, 305, 305, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 377, 378, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        379, 380, 381, 382, 0, 0, 383, 384, 0, 0, 385, 386, 387, 388, 389, 390,
+        0, 0, 391, 392, 393, 394, 395, 396, 0, 0, 397, 398, 399, 400, 401, 402,
+        403, 404, 405, 406, 407, 408, 0, 0, 409, 410, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 411, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 307, 305, 305, 305, 305, 307, 305, 305, 305, 412, 307, 305, 305, 305, 305,
+        305, 305, 307, 307, 307, 307, 307, 307, 305, 305, 307, 305, 305, 412, 413, 305,
+        414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 423, 424, 425, 426, 0, 427,
+        0, 428, 429, 0, 305, 307, 0, 422, 0, 0, 0, 0, 0, 0, 0, 0,
+        305, 305, 305, 305, 305, 305, 305, 305, 430, 431, 432, 0, 0, 0, 0, 0,
+        0, 0, 433, 434, 435, 436, 437, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 438, 439, 440, 430, 431,
+        432, 441, 442, 304, 304, 310, 307, 305, 305, 305, 305, 305, 307, 305, 305, 307,
+        443, 0, 0, 0, 0, 444, 445, 446, 447, 0, 0, 0, 0, 0, 0, 0,
+        448, 0, 449, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 450, 0, 0, 305, 305, 305, 305, 305, 305, 305, 0, 0, 305,
+        305, 305, 305, 307, 305, 0, 0, 305, 305, 0, 307, 305, 305, 307, 0, 0,
+        0, 451, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        305, 307, 305, 305, 307, 305, 305, 307, 307, 307, 305, 307, 307, 305, 307, 305,
+        305, 305, 307, 305, 307, 305, 307, 305, 307, 305, 305, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 305, 305, 305, 305,
+        305, 305, 307, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 307, 0, 0,
+        0, 0, 0, 0, 0, 0, 305, 305, 305, 305, 0, 305, 305, 305, 305, 305,
+        305, 305, 305, 305, 0, 305, 305, 305, 0, 305, 305, 305, 305, 305, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 307, 307, 307, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 305, 307, 307, 307, 305, 305, 305, 305,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 305, 305, 305, 305, 307,
+        307, 307, 307, 307, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305,
+        305, 305, 0, 307, 305, 305, 307, 305, 305, 307, 305, 305, 305, 307, 307, 307,
+        438, 439, 440, 305, 305, 305, 307, 305, 305, 307, 307, 305, 305, 305, 305, 305,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 452, 0, 0, 0, 0, 0, 0,
+        0, 453, 0, 0, 454, 0, 0, 0, 0, 0, 0, 0, 455, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 0, 0,
+        0, 305, 307, 305, 305, 0, 0, 0, 457, 458, 459, 460, 461, 462, 463, 464,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 465, 0, 466, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 467, 468, 456, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 466, 0, 0, 0, 0, 469, 470, 0, 471,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 0,
+        0, 0, 0, 472, 0, 0, 473, 0, 0, 0, 0, 0, 465, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 474, 475, 476, 0, 0, 477, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 465, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 478, 0, 0, 479, 480, 456, 0, 0,
+        0, 0, 0, 0, 0, 0, 466, 466, 0, 0, 0, 0, 481, 482, 0, 0,
+        0, 0, 0, 0, 483, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 466, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 484, 485, 486, 456, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 466, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 487, 0, 0, 0, 0, 456, 0, 0,
+        0, 0, 0, 0, 0, 488, 489, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        490, 0, 466, 0, 0, 0, 0, 491, 492, 0, 493, 494, 0, 456, 0, 0,
+        0, 0, 0, 0, 0, 466, 466, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 456, 0, 466, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 495, 496, 497, 456, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 498, 0, 0, 0, 0, 466,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 499, 0, 500, 501, 502, 466,
+        0, 0, 0, 503, 0, 0, 0, 0, 504, 504, 456, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 505, 505, 505, 505, 0, 0, 0, 0,
+        0, 0, 0, 506, 0, 0, 0, 0, 507, 507, 456, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 508, 508, 508, 508, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 509, 510, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 511, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 307, 307, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 307, 0, 307, 0, 512, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 513, 0, 0, 0, 0, 0, 0, 0, 0, 0, 514, 0, 0,
+        0, 0, 515, 0, 0, 0, 0, 516, 0, 0, 0, 0, 517, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 518, 0, 0, 0, 0, 0, 0,
+        0, 519, 520, 521, 522, 523, 524, 525, 526, 527, 520, 520, 520, 520, 0, 0,
+        520, 528, 305, 305, 456, 0, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 529, 0, 0, 0, 0, 0, 0, 0, 0, 0, 530, 0, 0,
+        0, 0, 531, 0, 0, 0, 0, 532, 0, 0, 0, 0, 533, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 534, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 307, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 535, 0, 0, 0, 0, 0, 0, 0, 466, 0,
+        0, 0, 0, 0, 0, 0, 0, 465, 0, 456, 456, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 307, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 536, 0, 0, 0,
+        0, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+        466, 466, 466, 466, 466, 466, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 466, 466, 466, 466, 466, 466, 466, 466,
+        466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466, 466,
+        466, 466, 466, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 305, 305,
+        0, 0, 0, 0, 456, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 413, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 412, 305, 307, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 305, 307, 0, 0, 0, 0, 0, 0, 0,
+        456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 305, 305, 305, 305, 305, 305, 305, 305, 0, 0, 307,
+        305, 305, 305, 305, 305, 307, 307, 307, 307, 307, 307, 305, 305, 307, 0, 307,
+        307, 305, 305, 307, 307, 305, 305, 305, 305, 305, 307, 305, 305, 305, 305, 0,
+        0, 0, 0, 0, 0, 0, 537, 0, 538, 0, 539, 0, 540, 0, 541, 0,
+        0, 0, 542, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 465, 466, 0, 0, 0, 0, 0, 543, 0, 544, 0, 0,
+        545, 546, 0, 547, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 307, 305, 305, 305,
+        305, 305, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 456, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 465, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 456, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 465, 0, 0, 0, 0, 0, 0, 0, 0,
+        305, 305, 305, 0, 312, 307, 307, 307, 307, 307, 305, 305, 307, 307, 307, 307,
+        305, 0, 312, 312, 312, 312, 312, 312, 312, 0, 0, 0, 0, 307, 0, 0,
+        0, 0, 0, 0, 305, 0, 0, 0, 305, 305, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 548, 549, 550, 0,
+        551, 552, 553, 554, 555, 556, 557, 558, 559, 560, 561, 0, 562, 563, 564, 565,
+        566, 567, 568, 3, 569, 570, 571, 572, 573, 574, 575, 576, 577, 578, 0, 579,
+        580, 581, 11, 582, 583, 584, 585, 586, 587, 588, 589, 590, 591, 346, 592, 593,
+        351, 594, 595, 288, 587, 590, 346, 592, 354, 351, 594, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 596, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 597, 598, 599, 600, 577,
+        601, 602, 603, 604, 605, 606, 607, 608, 609, 610, 611, 612, 613, 614, 615, 616,
+        617, 618, 619, 620, 621, 622, 623, 624, 625, 626, 627, 628, 629, 630, 631, 347,
+        305, 305, 307, 305, 305, 305, 305, 305, 305, 305, 307, 305, 305, 320, 632, 307,
+        309, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305,
+        305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305,
+        305, 305, 305, 305, 305, 305, 306, 413, 413, 307, 633, 305, 319, 307, 305, 307,
+        634, 635, 636, 637, 638, 639, 640, 641, 642, 643, 644, 645, 646, 647, 648, 649,
+        650, 651, 652, 653, 654, 655, 656, 657, 658, 659, 660, 661, 662, 663, 664, 665,
+        666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681,
+        682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695, 696, 697,
+        698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711, 712, 713,
+        714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729,
+        730, 731, 732, 733, 734, 735, 736, 737, 738, 739, 740, 741, 742, 743, 744, 745,
+        746, 747, 748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760, 761,
+        762, 763, 764, 765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777,
+        778, 779, 780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 0, 0, 0, 0,
+        790, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805,
+        806, 807, 808, 809, 810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821,
+        822, 823, 824, 825, 826, 827, 828, 829, 830, 831, 832, 833, 834, 835, 836, 837,
+        838, 839, 840, 841, 842, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853,
+        854, 855, 856, 857, 858, 859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869,
+        870, 871, 872, 873, 874, 875, 876, 877, 878, 879, 0, 0, 0, 0, 0, 0,
+        880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893, 894, 895,
+        896, 897, 898, 899, 900, 901, 0, 0, 902, 903, 904, 905, 906, 907, 0, 0,
+        908, 909, 910, 911, 912, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923,
+        924, 925, 926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939,
+        940, 941, 942, 943, 944, 945, 0, 0, 946, 947, 948, 949, 950, 951, 0, 0,
+        952, 953, 954, 955, 956, 957, 958, 959, 0, 960, 0, 961, 0, 962, 0, 963,
+        964, 965, 966, 967, 968, 969, 970, 971, 972, 973, 974, 975, 976, 977, 978, 979,
+        980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 991, 992, 993, 0, 0,
+        994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009,
+        1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025,
+        1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041,
+        1042, 1043, 1044, 1045, 1046, 0, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1054,
+        1056, 1057, 1058, 1059, 1060, 0, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070,
+        1071, 1072, 1073, 1074, 0, 0, 1075, 1076, 1077, 1078, 1079, 1080, 0, 1081, 1082, 1083,
+        1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099,
+        0, 0, 1100, 1101, 1102, 0, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 0,
+        1112, 1113, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+        0, 1114, 0, 0, 0, 0, 0, 1115, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1116, 1117, 1118, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+        0, 0, 0, 1119, 1120, 0, 1121, 1122, 0, 0, 0, 0, 1123, 0, 1124, 0,
+        0, 0, 0, 0, 0, 0, 0, 1125, 1126, 1127, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 1128, 0, 0, 0, 0, 0, 0, 0, 1,
+        1129, 595, 0, 0, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141,
+        1129, 10, 5, 6, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 0,
+        3, 574, 11, 302, 575, 285, 579, 301, 580, 1141, 585, 181, 586, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1142, 0, 0, 0, 0, 0, 0, 0,
+        305, 305, 312, 312, 305, 305, 305, 305, 312, 312, 312, 305, 305, 0, 0, 0,
+        0, 305, 0, 0, 0, 312, 312, 305, 307, 305, 312, 312, 307, 307, 307, 307,
+        305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1143, 1144, 1145, 1146, 0, 1147, 1148, 1149, 0, 1150, 578, 555, 555, 555, 285, 1151,
+        556, 556, 559, 301, 0, 561, 1152, 0, 0, 564, 1153, 565, 565, 565, 0, 0,
+        1154, 1155, 1156, 0, 1157, 0, 1158, 0, 1157, 0, 1159, 1160, 550, 1145, 0, 574,
+        552, 1161, 0, 560, 11, 1162, 1163, 1164, 1165, 595, 0, 1166, 352, 592, 1167, 1168,
+        1169, 0, 0, 0, 0, 551, 573, 574, 595, 287, 0, 0, 0, 0, 0, 0,
+        1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185,
+        556, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 559, 1145, 551, 560,
+        595, 1197, 1198, 1199, 590, 1200, 1201, 1202, 1203, 302, 1204, 1205, 301, 598, 573, 580,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1206, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1207, 1208, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1209, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1210, 1211, 1212,
+        0, 0, 0, 0, 1213, 0, 0, 0, 0, 1214, 0, 0, 1215, 0, 0, 0,
+        0, 0, 0, 0, 1216, 0, 1217, 0, 0, 0, 0, 0, 1218, 1219, 0, 1220,
+        1221, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1222, 0, 0, 1223, 0, 0, 1224, 0, 1225, 0, 0, 0, 0, 0, 0,
+        1226, 0, 1227, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1228, 1229, 1230,
+        1231, 1232, 0, 0, 1233, 1234, 0, 0, 1235, 1236, 0, 0, 0, 0, 0, 0,
+        1237, 1238, 0, 0, 1239, 1240, 0, 0, 1241, 1242, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1243, 1244, 1245, 1246,
+        1247, 1248, 1249, 1250, 0, 0, 0, 0, 0, 0, 1251, 1252, 1253, 1254, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1255, 1256, 0, 0, 0, 0, 0,
+        10, 5, 6, 1130, 1131, 1132, 1133, 1134, 1135, 1257, 1258, 1259, 1260, 1261, 1262, 1263,
+        1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279,
+        1280, 1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295,
+        1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311,
+        1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327,
+        1328, 1329, 1330, 1331, 1332, 1333, 548, 550, 1145, 551, 552, 1161, 554, 555, 556, 557,
+        558, 559, 560, 561, 562, 564, 1153, 565, 1334, 566, 567, 1189, 568, 1194, 1335, 1157,
+        3, 572, 598, 573, 574, 601, 578, 285, 595, 287, 579, 301, 580, 1141, 11, 585,
+        1336, 288, 181, 586, 587, 590, 292, 302, 293, 628, 1129, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1337, 0, 0, 0,
+        0, 0, 0, 0, 1338, 1339, 1340, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1341, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 287, 1189, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305,
+        305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1342,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1343,
+        0, 0, 0, 1344, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360,
+        1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376,
+        1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392,
+        1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408,
+        1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424,
+        1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440,
+        1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456,
+        1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472,
+        1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488,
+        1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504,
+        1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519, 1520,
+        1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536,
+        1537, 1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552,
+        1553, 1554, 1555, 1556, 1557, 1558, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 633, 413, 306, 412, 1559, 1559,
+        0, 0, 0, 0, 0, 0, 1560, 0, 1368, 1561, 1562, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1563, 0, 1564, 0,
+        1565, 0, 1566, 0, 1567, 0, 1568, 0, 1569, 0, 1570, 0, 1571, 0, 1572, 0,
+        1573, 0, 1574, 0, 0, 1575, 0, 1576, 0, 1577, 0, 0, 0, 0, 0, 0,
+        1578, 1579, 0, 1580, 1581, 0, 1582, 1583, 0, 1584, 1585, 0, 1586, 1587, 0, 0,
+        0, 0, 0, 0, 1588, 0, 0, 0, 0, 1589, 1589, 1590, 1591, 0, 1592, 1593,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1594, 0, 1595, 0,
+        1596, 0, 1597, 0, 1598, 0, 1599, 0, 1600, 0, 1601, 0, 1602, 0, 1603, 0,
+        1604, 0, 1605, 0, 0, 1606, 0, 1607, 0, 1608, 0, 0, 0, 0, 0, 0,
+        1609, 1610, 0, 1611, 1612, 0, 1613, 1614, 0, 1615, 1616, 0, 1617, 1618, 0, 0,
+        0, 0, 0, 0, 1619, 0, 0, 1620, 1621, 1622, 1623, 0, 0, 0, 1624, 1625,
+        0, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640,
+        1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656,
+        1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670, 1671, 1672,
+        1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688,
+        1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704,
+        1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 0,
+        0, 0, 1345, 1351, 1720, 1721, 1722, 1723, 1724, 1725, 1349, 1726, 1727, 1728, 1729, 1353,
+        1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745,
+        1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 0,
+        1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776,
+        1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792,
+        1793, 1794, 1795, 1796, 1797, 1798, 1411, 1799, 0, 0, 0, 0, 0, 0, 0, 0,
+        1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815,
+        1626, 1629, 1632, 1634, 1642, 1643, 1646, 1648, 1649, 1651, 1652, 1653, 1654, 1655, 1816, 1817,
+        1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 0,
+        1345, 1351, 1720, 1721, 1833, 1834, 1835, 1356, 1836, 1368, 1418, 1430, 1429, 1419, 1511, 1376,
+        1416, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1382, 1847, 1848, 1849, 1850,
+        1851, 1852, 1853, 1854, 1722, 1723, 1724, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863,
+        1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879,
+        1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895,
+        1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911,
+        1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927,
+        1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943,
+        1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956, 1957, 1958, 1959,
+        1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975,
+        1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991,
+        1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007,
+        2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023,
+        2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039,
+        2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055,
+        2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071,
+        2072, 2073, 2074, 2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087,
+        2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103,
+        2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119,
+        2120, 2121, 2122, 2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135,
+        2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151,
+        2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 2167,
+        2168, 2169, 2170, 2171, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183,
+        2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199,
+        0, 0, 0, 0, 305, 305, 305, 305, 305, 305, 305, 305, 305, 305, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2200, 2201, 305, 305,
+        2202, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1145, 1161, 1153, 0, 0, 0, 2203, 2204, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 307, 307, 307, 0, 0,
+        0, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        305, 0, 305, 305, 307, 0, 0, 305, 305, 0, 0, 0, 0, 0, 305, 305,
+        0, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2205, 2206, 2207, 2208,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 2209, 0, 0, 0, 0, 0, 0,
+        2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210, 2210,
+        2210, 2210, 2210, 2210, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2218, 2219, 2220, 2221, 2222, 2223, 2224, 2225,
+        2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240, 2241,
+        2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257,
+        2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 2273,
+        2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289,
+        2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299, 2300, 2301, 2230, 2302, 2303, 2304,
+        2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319, 2320,
+        2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336,
+        2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345, 2346, 2347, 2348, 2349, 2350, 2351, 2352,
+        2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364, 2365, 2366, 2367, 2368,
+        2369, 2320, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2304, 2378, 2379, 2380, 2381, 2382,
+        2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395, 2396, 2397, 2230,
+        2398, 2399, 2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413,
+        2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424, 2306, 2425, 2426, 2427, 2428,
+        2429, 2430, 2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443, 2444,
+        2445, 2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 2458, 2459, 2460,
+        2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473, 2474, 0, 0,
+        2475, 0, 2476, 0, 0, 2477, 2478, 2479, 2480, 2481, 2482, 2483, 2484, 2485, 2486, 0,
+        2487, 0, 2488, 0, 0, 2489, 2490, 0, 0, 0, 2491, 2492, 2493, 2494, 2495, 2496,
+        2497, 2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512,
+        2513, 2514, 2515, 2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528,
+        2529, 2530, 2531, 2532, 2533, 2534, 2535, 2359, 2536, 2537, 2538, 2539, 2540, 2541, 2541, 2542,
+        2543, 2544, 2545, 2546, 2547, 2548, 2549, 2489, 2550, 2551, 2552, 2553, 2554, 2555, 0, 0,
+        2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2503, 2564, 2565, 2566, 2475, 2567, 2568, 2569,
+        2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577, 2578, 2512, 2579, 2513, 2580, 2581, 2582, 2583,
+        2584, 2476, 2251, 2585, 2586, 2587, 2321, 2408, 2588, 2589, 2520, 2590, 2521, 2591, 2592, 2593,
+        2478, 2594, 2595, 2596, 2597, 2598, 2479, 2599, 2600, 2601, 2602, 2603, 2604, 2535, 2605, 2606,
+        2359, 2607, 2539, 2608, 2609, 2610, 2611, 2612, 2544, 2613, 2488, 2614, 2545, 2302, 2615, 2546,
+        2616, 2548, 2617, 2618, 2619, 2620, 2621, 2550, 2484, 2622, 2551, 2623, 2552, 2624, 2218, 2625,
+        2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635, 0, 0, 0, 0, 0, 0,
+        2636, 2637, 2638, 2639, 2640, 2641, 2641, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 2642, 2643, 2644, 2645, 2646, 0, 0, 0, 0, 0, 2647, 2648, 2649,
+        2650, 1162, 1165, 2651, 2652, 2653, 2654, 2655, 2656, 1136, 2657, 2658, 2659, 2660, 2661, 2662,
+        2663, 2664, 2665, 2666, 2667, 2668, 2669, 0, 2670, 2671, 2672, 2673, 2674, 0, 2675, 0,
+        2676, 2677, 0, 2678, 2679, 0, 2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689,
+        2690, 2690, 2691, 2691, 2691, 2691, 2692, 2692, 2692, 2692, 2693, 2693, 2693, 2693, 2694, 2694,
+        2694, 2694, 2695, 2695, 2695, 2695, 2696, 2696, 2696, 2696, 2697, 2697, 2697, 2697, 2698, 2698,
+        2698, 2698, 2699, 2699, 2699, 2699, 2700, 2700, 2700, 2700, 2701, 2701, 2701, 2701, 2702, 2702,
+        2702, 2702, 2703, 2703, 2704, 2704, 2705, 2705, 2706, 2706, 2707, 2707, 2708, 2708, 2709, 2709,
+        2709, 2709, 2710, 2710, 2710, 2710, 2711, 2711, 2711, 2711, 2712, 2712, 2712, 2712, 2713, 2713,
+        2714, 2714, 2714, 2714, 2715, 2715, 2716, 2716, 2716, 2716, 2717, 2717, 2717, 2717, 2718, 2718,
+        2719, 2719, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 2720, 2720, 2720, 2720, 2721, 2721, 2722, 2722, 2723, 2723, 446, 2724, 2724,
+        2725, 2725, 2726, 2726, 2727, 2727, 2727, 2727, 2728, 2728, 2729, 2729, 2730, 2730, 2731, 2731,
+        2732, 2732, 2733, 2733, 2734, 2734, 2735, 2735, 2735, 2736, 2736, 2736, 2737, 2737, 2737, 2737,
+        2738, 2739, 2740, 2736, 2741, 2742, 2743, 2744, 2745, 2746, 2747, 2748, 2749, 2750, 2751, 2752,
+        2753, 2754, 2755, 2756, 2757, 2758, 2759, 2760, 2761, 2762, 2763, 2764, 2765, 2766, 2767, 2768,
+        2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 2777, 2778, 2779, 2780, 2781, 2782, 2783, 2784,
+        2785, 2786, 2787, 2788, 2789, 2790, 2791, 2792, 2793, 2794, 2795, 2796, 2797, 2798, 2799, 2800,
+        2801, 2802, 2803, 2804, 2805, 2806, 2807, 2808, 2809, 2810, 2811, 2812, 2813, 2814, 2815, 2816,
+        2817, 2818, 2819, 2820, 2821, 2822, 2823, 2824, 2825, 2826, 2827, 2828, 2829, 2830, 2831, 2832,
+        2833, 2834, 2835, 2836, 2837, 2838, 2740, 2839, 2736, 2741, 2840, 2841, 2745, 2842, 2746, 2747,
+        2843, 2844, 2751, 2845, 2752, 2753, 2846, 2847, 2755, 2848, 2756, 2757, 2786, 2787, 2790, 2791,
+        2792, 2796, 2797, 2798, 2799, 2803, 2804, 2805, 2849, 2809, 2850, 2851, 2815, 2852, 2816, 2817,
+        2830, 2853, 2854, 2825, 2855, 2826, 2827, 2738, 2739, 2856, 2740, 2857, 2742, 2743, 2744, 2745,
+        2858, 2748, 2749, 2750, 2751, 2859, 2755, 2758, 2759, 2760, 2761, 2762, 2764, 2765, 2766, 2767,
+        2768, 2769, 2860, 2770, 2771, 2772, 2773, 2774, 2775, 2777, 2778, 2779, 2780, 2781, 2782, 2783,
+        2784, 2785, 2788, 2789, 2793, 2794, 2795, 2796, 2797, 2800, 2801, 2802, 2803, 2861, 2806, 2807,
+        2808, 2809, 2812, 2813, 2814, 2815, 2862, 2818, 2819, 2863, 2822, 2823, 2824, 2825, 2864, 2740,
+        2857, 2745, 2858, 2751, 2859, 2755, 2865, 2768, 2866, 2867, 2868, 2796, 2797, 2803, 2815, 2862,
+        2825, 2864, 2869, 2870, 2871, 2872, 2873, 2874, 2875, 2876, 2877, 2878, 2879, 2880, 2881, 2882,
+        2883, 2884, 2885, 2886, 2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894, 2867, 2895, 2896, 2897,
+        2898, 2872, 2873, 2874, 2875, 2876, 2877, 2878, 2879, 2880, 2881, 2882, 2883, 2884, 2885, 2886,
+        2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894, 2867, 2895, 2896, 2897, 2898, 2892, 2893, 2894,
+        2867, 2866, 2868, 2776, 2765, 2766, 2767, 2892, 2893, 2894, 2776, 2777, 2899, 2899, 0, 0,
+        2900, 2901, 2901, 2902, 2903, 2904, 2905, 2906, 2907, 2907, 2908, 2909, 2910, 2911, 2912, 2913,
+        2913, 2914, 2915, 2915, 2916, 2916, 2917, 2918, 2918, 2919, 2920, 2920, 2921, 2921, 2922, 2923,
+        2923, 2924, 2924, 2925, 2926, 2927, 2928, 2928, 2929, 2930, 2931, 2932, 2933, 2933, 2934, 2935,
+        2936, 2937, 2938, 2939, 2939, 2940, 2940, 2941, 2941, 2942, 2943, 2944, 2945, 2946, 2947, 2948,
+        0, 0, 2949, 2950, 2951, 2952, 2953, 2954, 2954, 2955, 2956, 2957, 2958, 2958, 2959, 2960,
+        2961, 2962, 2963, 2964, 2965, 2966, 2967, 2968, 2969, 2970, 2971, 2972, 2973, 2974, 2975, 2976,
+        2977, 2978, 2979, 2980, 2934, 2936, 2981, 2982, 2983, 2984, 2985, 2986, 2985, 2983, 2987, 2988,
+        2989, 2990, 2991, 2986, 2927, 2917, 2992, 2993, 0, 0, 0, 0, 0, 0, 0, 0,
+        2994, 2995, 2996, 2997, 2998, 2999, 3000, 3001, 3002, 3003, 3004, 3005, 3006, 0, 0, 0,
+        3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015, 1118, 0, 0, 0, 0, 0, 0,
+        305, 305, 305, 305, 305, 305, 305, 307, 307, 307, 307, 307, 307, 307, 305, 305,
+        1117, 3016, 3017, 3018, 3018, 1139, 1140, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027,
+        3028, 3029, 3030, 3031, 3032, 0, 0, 3033, 3034, 1124, 1124, 1124, 1124, 3018, 3018, 3018,
+        3007, 3008, 1116, 0, 3011, 3010, 3013, 3012, 3016, 1139, 1140, 3019, 3020, 3021, 3022, 3035,
+        3036, 3037, 1136, 3038, 3039, 3040, 1138, 0, 3041, 3042, 3043, 3044, 0, 0, 0, 0,
+        3045, 3046, 3047, 0, 3048, 0, 3049, 3050, 3051, 3052, 3053, 3054, 3055, 3056, 3057, 3058,
+        3059, 3060, 3060, 3061, 3061, 3062, 3062, 3063, 3063, 3064, 3064, 3064, 3064, 3065, 3065, 3066,
+        3066, 3066, 3066, 3067, 3067, 3068, 3068, 3068, 3068, 3069, 3069, 3069, 3069, 3070, 3070, 3070,
+        3070, 3071, 3071, 3071, 3071, 3072, 3072, 3072, 3072, 3073, 3073, 3074, 3074, 3075, 3075, 3076,
+        3076, 3077, 3077, 3077, 3077, 3078, 3078, 3078, 3078, 3079, 3079, 3079, 3079, 3080, 3080, 3080,
+        3080, 3081, 3081, 3081, 3081, 3082, 3082, 3082, 3082, 3083, 3083, 3083, 3083, 3084, 3084, 3084,
+        3084, 3085, 3085, 3085, 3085, 3086, 3086, 3086, 3086, 3087, 3087, 3087, 3087, 3088, 3088, 3088,
+        3088, 3089, 3089, 3089, 3089, 3090, 3090, 3090, 3090, 3091, 3091, 3091, 3091, 3092, 3092, 2728,
+        2728, 3093, 3093, 3093, 3093, 3094, 3094, 3095, 3095, 3096, 3096, 3097, 3097, 0, 0, 0,
+        0, 3012, 3098, 3035, 3042, 3043, 3036, 3099, 1139, 1140, 3037, 1136, 3007, 3038, 1116, 3100,
+        1129, 10, 5, 6, 1130, 1131, 1132, 1133, 1134, 1135, 3010, 3011, 3039, 1138, 3040, 3013,
+        3044, 548, 550, 1145, 551, 552, 1161, 554, 555, 556, 557, 558, 559, 560, 561, 562,
+        564, 1153, 565, 1334, 566, 567, 1189, 568, 1194, 1335, 1157, 3033, 3041, 3034, 3101, 3018,
+        3102, 3, 572, 598, 573, 574, 601, 578, 285, 595, 287, 579, 301, 580, 1141, 11,
+        585, 1336, 288, 181, 586, 587, 590, 292, 302, 293, 628, 3019, 3103, 3020, 3104, 3105,
+        3106, 3009, 3029, 3030, 3008, 3107, 1942, 3108, 3109, 3110, 3111, 3112, 3113, 3114, 3115, 3116,
+        3117, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910,
+        1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926,
+        1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 3118, 3119, 3120,
+        1677, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640,
+        1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 0,
+        0, 0, 1656, 1657, 1658, 1659, 1660, 1661, 0, 0, 1662, 1663, 1664, 1665, 1666, 1667,
+        0, 0, 1668, 1669, 1670, 1671, 1672, 1673, 0, 0, 1674, 1675, 1676, 0, 0, 0,
+        3121, 3122, 3123, 4, 3124, 3125, 3126, 0, 3127, 3128, 3129, 3130, 3131, 3132, 3133, 0,
+        307, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 305, 305, 305, 305, 305, 0, 0, 0, 0, 0,
+        0, 3134, 3135, 3136, 3137, 3138, 0, 3139, 3140, 3141, 3142, 3143, 3144, 3145, 3146, 3147,
+        3148, 3149, 3150, 3151, 3152, 1151, 3153, 3154, 3155, 3156, 3157, 3158, 3159, 3160, 3161, 3162,
+        3163, 3164, 3165, 3166, 3167, 1336, 3168, 3169, 3170, 3171, 3172, 3173, 3174, 3175, 3176, 3177,
+        3178, 0, 3179, 3180, 3181, 3182, 3183, 3184, 3185, 3186, 3187, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 307, 0, 305,
+        0, 0, 0, 0, 0, 0, 0, 0, 305, 312, 307, 0, 0, 0, 0, 456,
+        0, 0, 0, 0, 0, 305, 307, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 305, 305, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 305, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 307, 307, 305, 305, 305, 307, 305, 307, 307, 307,
+        0, 0, 305, 307, 305, 307, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3188, 0, 3189, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3190, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 455, 0, 0, 0, 0, 0,
+        305, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 466, 0, 0, 0, 0, 0, 0, 3191, 3192,
+        0, 0, 0, 456, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 465, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 456, 465, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 465, 456, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 465, 465, 0, 466, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3193, 3194, 456, 0, 0,
+        0, 0, 0, 0, 0, 0, 305, 305, 305, 305, 305, 305, 305, 0, 0, 0,
+        305, 305, 305, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 456, 0, 0, 0, 465, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        466, 0, 0, 0, 0, 0, 0, 0, 0, 0, 466, 3195, 3196, 466, 3197, 0,
+        0, 0, 456, 465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 466,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3198, 3199, 0, 0, 0, 456,
+        465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 456, 465, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 465, 0, 0, 0, 0, 0,
+        466, 0, 0, 0, 0, 0, 0, 0, 3200, 0, 0, 0, 0, 456, 456, 0,
+        0, 0, 0, 0, 0, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 456, 0, 0, 0, 0, 0, 0,
+        0, 0, 465, 0, 456, 456, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        312, 312, 312, 312, 312, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        305, 305, 305, 305, 305, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3201, 3201, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 312, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3202, 3203,
+        3204, 3205, 3206, 3207, 3208, 512, 512, 312, 312, 312, 0, 0, 0, 3209, 512, 512,
+        512, 512, 512, 0, 0, 0, 0, 0, 0, 0, 0, 307, 307, 307, 307, 307,
+        307, 307, 307, 0, 0, 305, 305, 305, 305, 305, 307, 307, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 305, 305, 305, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3210, 3211, 3212, 3213, 3214,
+        3215, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 305, 305, 305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        548, 550, 1145, 551, 552, 1161, 554, 555, 556, 557, 558, 559, 560, 561, 562, 564,
+        1153, 565, 1334, 566, 567, 1189, 568, 1194, 1335, 1157, 3, 572, 598, 573, 574, 601,
+        578, 285, 595, 287, 579, 301, 580, 1141, 11, 585, 1336, 288, 181, 586, 587, 590,
+        292, 302, 293, 628, 548, 550, 1145, 551, 552, 1161, 554, 555, 556, 557, 558, 559,
+        560, 561, 562, 564, 1153, 565, 1334, 566, 567, 1189, 568, 1194, 1335, 1157, 3, 572,
+        598, 573, 574, 601, 578, 0, 595, 287, 579, 301, 580, 1141, 11, 585, 1336, 288,
+        181, 586, 587, 590, 292, 302, 293, 628, 548, 550, 1145, 551, 552, 1161, 554, 555,
+        556, 557, 558, 559, 560, 561, 562, 564, 1153, 565, 1334, 566, 567, 1189, 568, 1194,
+        1335, 1157, 3, 572, 598, 573, 574, 601, 578, 285, 595, 287, 579, 301, 580, 1141,
+        11, 585, 1336, 288, 181, 586, 587, 590, 292, 302, 293, 628, 548, 0, 1145, 551,
+        0, 0, 554, 0, 0, 557, 558, 0, 0, 561, 562, 564, 1153, 0, 1334, 566,
+        567, 1189, 568, 1194, 1335, 1157, 3, 572, 598, 573, 0, 601, 0, 285, 595, 287,
+        579, 301, 580, 1141, 0, 585, 1336, 288, 181, 586, 587, 590, 292, 302, 293, 628,
+        292, 302, 293, 628, 548, 550, 0, 551, 552, 1161, 554, 0, 0, 557, 558, 559,
+        560, 561, 562, 564, 1153, 0, 1334, 566, 567, 1189, 568, 1194, 1335, 0, 3, 572,
+        598, 573, 574, 601, 578, 285, 595, 287, 579, 301, 580, 1141, 11, 585, 1336, 288,
+        181, 586, 587, 590, 292, 302, 293, 628, 548, 550, 0, 551, 552, 1161, 554, 0,
+        556, 557, 558, 559, 560, 0, 562, 0, 0, 0, 1334, 566, 567, 1189, 568, 1194,
+        1335, 0, 3, 572, 598, 573, 574, 601, 578, 285, 595, 287, 579, 301, 580, 1141,
+        11, 585, 1336, 288, 181, 586, 587, 590, 292, 302, 293, 628, 548, 550, 1145, 551,
+        552, 1161, 554, 555, 556, 557, 558, 559, 560, 561, 562, 564, 1153, 565, 1334, 566,
+        567, 1189, 568, 1194, 1335, 1157, 3, 572, 598, 573, 574, 601, 578, 285, 595, 287,
+        579, 301, 580, 1141, 11, 585, 1336, 288, 181, 586, 587, 590, 292, 302, 293, 628,
+        292, 302, 293, 628, 3216, 3217, 0, 0, 3218, 3219, 1167, 3220, 3221, 3222, 3223, 356,
+        3224, 3225, 3226, 3227, 3228, 3229, 3230, 1168, 3231, 356, 358, 3232, 348, 3233, 3234, 3235,
+        3236, 3237, 3238, 346, 592, 593, 357, 3239, 3240, 347, 3241, 353, 3242, 8, 3243, 3244,
+        3245, 352, 354, 355, 3246, 3247, 3248, 351, 594, 3249, 3250, 3251, 357, 347, 353, 351,
+        354, 352, 3218, 3219, 1167, 3220, 3221, 3222, 3223, 356, 3224, 3225, 3226, 3227, 3228, 3229,
+        3230, 1168, 3231, 356, 358, 3232, 348, 3233, 3234, 3235, 3236, 3237, 3238, 346, 592, 593,
+        357, 3239, 3240, 347, 3241, 353, 3242, 8, 3243, 3244, 3245, 352, 354, 355, 3246, 3247,
+        3248, 351, 594, 3249, 3250, 3251, 357, 347, 353, 351, 354, 352, 3218, 3219, 1167, 3220,
+        3221, 3222, 3223, 356, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 1168, 3231, 356, 358, 3232,
+        348, 3233, 3234, 3235, 3236, 3237, 3238, 346, 592, 593, 357, 3239, 3240, 347, 3241, 353,
+        3242, 8, 3243, 3244, 3245, 352, 354, 355, 3246, 3247, 3248, 351, 594, 3249, 3250, 3251,
+        357, 347, 353, 351, 354, 352, 3218, 3219, 1167, 3220, 3221, 3222, 3223, 356, 3224, 3225,
+        3226, 3227, 3228, 3229, 3230, 1168, 3231, 356, 358, 3232, 348, 3233, 3234, 3235, 3236, 3237,
+        3238, 346, 592, 593, 357, 3239, 3240, 347, 3241, 353, 3242, 8, 3243, 3244, 3245, 352,
+        354, 355, 3246, 3247, 3248, 351, 594, 3249, 3250, 3251, 357, 347, 353, 351, 354, 352,
+        3218, 3219, 1167, 3220, 3221, 3222, 3223, 356, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 1168,
+        3231, 356, 358, 3232, 348, 3233, 3234, 3235, 3236, 3237, 3238, 346, 592, 593, 357, 3239,
+        3240, 347, 3241, 353, 3242, 8, 3243, 3244, 3245, 352, 354, 355, 3246, 3247, 3248, 351,
+        594, 3249, 3250, 3251, 357, 347, 353, 351, 354, 352, 3252, 3253, 0, 0, 1129, 10,
+        5, 6, 1130, 1131, 1132, 1133, 1134, 1135, 1129, 10, 5, 6, 1130, 1131, 1132, 1133,
+        1134, 1135, 1129, 10, 5, 6, 1130, 1131, 1132, 1133, 1134, 1135, 1129, 10, 5, 6,
+        1130, 1131, 1132, 1133, 1134, 1135, 1129, 10, 5, 6, 1130, 1131, 1132, 1133, 1134, 1135,
+        305, 305, 305, 305, 305, 305, 305, 0, 305, 305, 305, 305, 305, 305, 305, 305,
+        305, 305, 305, 305, 305, 305, 305, 305, 305, 0, 0, 305, 305, 305, 305, 305,
+        305, 305, 0, 305, 305, 0, 305, 305, 305, 305, 305, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 305, 305, 305, 305,
+        307, 307, 307, 307, 307, 307, 307, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 305, 305, 305, 305, 305, 305, 465, 0, 0, 0, 0, 0,
+        3065, 3066, 3070, 3073, 0, 3092, 3076, 3071, 3081, 3093, 3087, 3088, 3089, 3090, 3077, 3083,
+        3085, 3079, 3086, 3075, 3078, 3068, 3069, 3072, 3074, 3080, 3082, 3084, 3254, 2713, 3255, 3256,
+        0, 3066, 3070, 0, 3091, 0, 0, 3071, 0, 3093, 3087, 3088, 3089, 3090, 3077, 3083,
+        3085, 3079, 3086, 0, 3078, 3068, 3069, 3072, 0, 3080, 0, 3084, 0, 0, 0, 0,
+        0, 0, 3070, 0, 0, 0, 0, 3071, 0, 3093, 0, 3088, 0, 3090, 3077, 3083,
+        0, 3079, 3086, 0, 3078, 0, 0, 3072, 0, 3080, 0, 3084, 0, 2713, 0, 3256,
+        0, 3066, 3070, 0, 3091, 0, 0, 3071, 3081, 3093, 3087, 0, 3089, 3090, 3077, 3083,
+        3085, 3079, 3086, 0, 3078, 3068, 3069, 3072, 0, 3080, 3082, 3084, 3254, 0, 3255, 0,
+        3065, 3066, 3070, 3073, 3091, 3092, 3076, 3071, 3081, 3093, 0, 3088, 3089, 3090, 3077, 3083,
+        3085, 3079, 3086, 3075, 3078, 3068, 3069, 3072, 3074, 3080, 3082, 3084, 0, 0, 0, 0,
+        0, 3066, 3070, 3073, 0, 3092, 3076, 3071, 3081, 3093, 0, 3088, 3089, 3090, 3077, 3083,
+        3257, 3258, 3259, 3260, 3261, 3262, 3263, 3264, 3265, 3266, 3267, 0, 0, 0, 0, 0,
+        3268, 3269, 3270, 3271, 3272, 3273, 3274, 3275, 3276, 3277, 3278, 3279, 3280, 3281, 3282, 3283,
+        3284, 3285, 3286, 3287, 3288, 3289, 3290, 3291, 3292, 3293, 3294, 1145, 565, 3295, 3296, 0,
+        1153, 565, 1334, 566, 567, 1189, 568, 1194, 1335, 1157, 3297, 2129, 3298, 3299, 3300, 3301,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3302, 3303, 3304, 0, 0, 0,
+        3305, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3306, 3307, 1906, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1408, 3308, 3309, 3310, 1351, 3311, 3312, 1728, 3313, 3314, 3315, 3316, 3317, 3318, 3319, 3320,
+        3321, 3322, 1444, 3323, 3324, 3325, 3326, 3327, 3328, 1345, 1720, 3329, 1855, 1723, 1856, 3330,
+        1500, 3331, 3332, 3333, 3334, 3335, 1838, 1418, 3336, 3337, 3338, 3339, 0, 0, 0, 0,
+        3340, 3341, 3342, 3343, 3344, 3345, 3346, 3347, 3348, 0, 0, 0, 0, 0, 0, 0,
+        3349, 3350, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1129, 10, 5, 6, 1130, 1131, 1132, 1133, 1134, 1135, 0, 0, 0, 0, 0, 0,
+        3351, 3352, 3353, 3354, 3355, 2497, 3356, 3357, 3358, 3359, 2498, 3360, 3361, 3362, 2499, 3363,
+        3364, 3365, 3366, 3367, 3368, 3369, 3370, 3371, 3372, 3373, 3374, 2557, 3375, 3376, 3377, 3378,
+        3379, 3380, 3381, 3382, 3383, 2562, 2500, 2501, 2563, 3384, 3385, 2308, 3386, 2502, 3387, 3388,
+        3389, 3390, 3390, 3390, 3391, 3392, 3393, 3394, 3395, 3396, 3397, 3398, 3399, 3400, 3401, 3402,
+        3403, 3404, 3405, 3406, 3407, 3408, 3408, 2565, 3409, 3410, 3411, 3412, 2504, 3413, 3414, 3415,
+        2461, 3416, 3417, 3418, 3419, 3420, 3421, 3422, 3423, 3424, 3425, 3426, 3427, 3428, 3429, 3430,
+        3431, 3432, 3433, 3434, 3435, 3436, 3437, 3438, 3439, 3440, 3441, 3441, 3442, 3443, 3444, 2304,
+        3445, 3446, 3447, 3448, 3449, 3450, 3451, 3452, 2509, 3453, 3454, 3455, 3456, 3457, 3458, 3459,
+        3460, 3461, 3462, 3463, 3464, 3465, 3466, 3467, 3468, 3469, 3470, 3471, 3472, 3473, 2250, 3474,
+        3475, 3476, 3476, 3477, 3478, 3478, 3479, 3480, 3481, 3482, 3483, 3484, 3485, 3486, 3487, 3488,
+        3489, 3490, 3491, 2510, 3492, 3493, 3494, 3495, 2577, 3495, 3496, 2512, 3497, 3498, 3499, 3500,
+        2513, 2223, 3501, 3502, 3503, 3504, 3505, 3506, 3507, 3508, 3509, 3510, 3511, 3512, 3513, 3514,
+        3515, 3516, 3517, 3518, 3519, 3520, 3521, 3522, 2514, 3523, 3524, 3525, 3526, 3527, 3528, 2516,
+        3529, 3530, 3531, 3532, 3533, 3534, 3535, 3536, 2251, 2585, 3537, 3538, 3539, 3540, 3541, 3542,
+        3543, 3544, 2517, 3545, 3546, 3547, 3548, 2628, 3549, 3550, 3551, 3552, 3553, 3554, 3555, 3556,
+        3557, 3558, 3559, 3560, 3561, 2321, 3562, 3563, 3564, 3565, 3566, 3567, 3568, 3569, 3570, 3571,
+        3572, 2518, 2408, 3573, 3574, 3575, 3576, 3577, 3578, 3579, 3580, 2589, 3581, 3582, 3583, 3584,
+        3585, 3586, 3587, 3588, 2590, 3589, 3590, 3591, 3592, 3593, 3594, 3595, 3596, 3597, 3598, 3599,
+        3600, 2592, 3601, 3602, 3603, 3604, 3605, 3606, 3607, 3608, 3609, 3610, 3611, 3611, 3612, 3613,
+        2594, 3614, 3615, 3616, 3617, 3618, 3619, 3620, 2307, 3621, 3622, 3623, 3624, 3625, 3626, 3627,
+        2600, 3628, 3629, 3630, 3631, 3632, 3633, 3633, 2601, 2630, 3634, 3635, 3636, 3637, 3638, 2269,
+        2603, 3639, 3640, 2529, 3641, 3642, 2483, 3643, 3644, 2533, 3645, 3646, 3647, 3648, 3648, 3649,
+        3650, 3651, 3652, 3653, 3654, 3655, 3656, 3657, 3658, 3659, 3660, 3661, 3662, 3663, 3664, 3665,
+        3666, 3667, 3668, 3669, 3670, 3671, 3672, 3673, 3674, 3675, 2539, 3676, 3677, 3678, 3679, 3680,
+        3681, 3682, 3683, 3684, 3685, 3686, 3687, 3688, 3689, 3690, 3691, 3477, 3692, 3693, 3694, 3695,
+        3696, 3697, 3698, 3699, 3700, 3701, 3702, 3703, 2325, 3704, 3705, 3706, 3707, 3708, 3709, 2542,
+        3710, 3711, 3712, 3713, 3714, 3715, 3716, 3717, 3718, 3719, 3720, 3721, 3722, 3723, 3724, 3725,
+        3726, 3727, 3728, 3729, 2264, 3730, 3731, 3732, 3733, 3734, 3735, 2610, 3736, 3737, 3738, 3739,
+        3740, 3741, 3742, 3743, 3744, 3745, 3746, 3747, 3748, 3749, 3750, 3751, 3752, 3753, 3754, 3755,
+        2615, 2616, 3756, 3757, 3758, 3759, 3760, 3761, 3762, 3763, 3764, 3765, 3766, 3767, 3768, 2617,
+        3769, 3770, 3771, 3772, 3773, 3774, 3775, 3776, 3777, 3778, 3779, 3780, 3781, 3782, 3783, 3784,
+        3785, 3786, 3787, 3788, 3789, 3790, 3791, 3792, 3793, 3794, 3795, 3796, 3797, 3798, 2623, 2623,
+        3799, 3800, 3801, 3802, 3803, 3804, 3805, 3806, 3807, 3808, 2624, 3809, 3810, 3811, 3812, 3813,
+        3814, 3815, 3816, 3817, 3818, 3819, 3820, 3821, 3822, 3823, 3824, 3825, 3826, 3827, 0, 0,
+};
+
+/// 按 (first, second) 排序的规范组合对，不含组合排除字符与韩文音节
+static const CompositionPair CompositionPairs[941] = {
+        {0x003c, 0x0338, 0x226e}, {0x003d, 0x0338, 0x2260}, {0x003e, 0x0338, 0x226f},
+        {0x0041, 0x0300, 0x00c0}, {0x0041, 0x0301, 0x00c1}, {0x0041, 0x0302, 0x00c2},
+        {0x0041, 0x0303, 0x00c3}, {0x0041, 0x0304, 0x0100}, {0x0041, 0x0306, 0x0102},
+        {0x0041, 0x0307, 0x0226}, {0x0041, 0x0308, 0x00c4}, {0x0041, 0x0309, 0x1ea2},
+        {0x0041, 0x030a, 0x00c5}, {0x0041, 0x030c, 0x01cd}, {0x0041, 0x030f, 0x0200},
+        {0x0041, 0x0311, 0x0202}, {0x0041, 0x0323, 0x1ea0}, {0x0041, 0x0325, 0x1e00},
+        {0x0041, 0x0328, 0x0104}, {0x0042, 0x0307, 0x1e02}, {0x0042, 0x0323, 0x1e04},
+        {0x0042, 0x0331, 0x1e06}, {0x0043, 0x0301, 0x0106}, {0x0043, 0x0302, 0x0108},
+        {0x0043, 0x0307, 0x010a}, {0x0043, 0x030c, 0x010c}, {0x0043, 0x0327, 0x00c7},
+        {0x0044, 0x0307, 0x1e0a}, {0x0044, 0x030c, 0x010e}, {0x0044, 0x0323, 0x1e0c},
+        {0x0044, 0x0327, 0x1e10}, {0x0044, 0x032d, 0x1e12}, {0x0044, 0x0331, 0x1e0e},
+        {0x0045, 0x0300, 0x00c8}, {0x0045, 0x0301, 0x00c9}, {0x0045, 0x0302, 0x00ca},
+        {0x0045, 0x0303, 0x1ebc}, {0x0045, 0x0304, 0x0112}, {0x0045, 0x0306, 0x0114},
+        {0x0045, 0x0307, 0x0116}, {0x0045, 0x0308, 0x00cb}, {0x0045, 0x0309, 0x1eba},
+        {0x0045, 0x030c, 0x011a}, {0x0045, 0x030f, 0x0204}, {0x0045, 0x0311, 0x0206},
+        {0x0045, 0x0323, 0x1eb8}, {0x0045, 0x0327, 0x0228}, {0x0045, 0x0328, 0x0118},
+        {0x0045, 0x032d, 0x1e18}, {0x0045, 0x0330, 0x1e1a}, {0x0046, 0x0307, 0x1e1e},
+        {0x0047, 0x0301, 0x01f4}, {0x0047, 0x0302, 0x011c}, {0x0047, 0x0304, 0x1e20},
+        {0x0047, 0x0306, 0x011e}, {0x0047, 0x0307, 0x0120}, {0x0047, 0x030c, 0x01e6},
+        {0x0047, 0x0327, 0x0122}, {0x0048, 0x0302, 0x0124}, {0x0048, 0x0307, 0x1e22},
+        {0x0048, 0x0308, 0x1e26}, {0x0048, 0x030c, 0x021e}, {0x0048, 0x0323, 0x1e24},
+        {0x0048, 0x0327, 0x1e28}, {0x0048, 0x032e, 0x1e2a}, {0x0049, 0x0300, 0x00cc},
+        {0x0049, 0x0301, 0x00cd}, {0x0049, 0x0302, 0x00ce}, {0x0049, 0x0303, 0x0128},
+        {0x0049, 0x0304, 0x012a}, {0x0049, 0x0306, 0x012c}, {0x0049, 0x0307, 0x0130},
+        {0x0049, 0x0308, 0x00cf}, {0x0049, 0x0309, 0x1ec8}, {0x0049, 0x030c, 0x01cf},
+        {0x0049, 0x030f, 0x0208}, {0x0049, 0x0311, 0x020a}, {0x0049, 0x0323, 0x1eca},
+        {0x0049, 0x0328, 0x012e}, {0x0049, 0x0330, 0x1e2c}, {0x004a, 0x0302, 0x0134},
+        {0x004b, 0x0301, 0x1e30}, {0x004b, 0x030c, 0x01e8}, {0x004b, 0x0323, 0x1e32},
+        {0x004b, 0x0327, 0x0136}, {0x004b, 0x0331, 0x1e34}, {0x004c, 0x0301, 0x0139},
+        {0x004c, 0x030c, 0x013d}, {0x004c, 0x0323, 0x1e36}, {0x004c, 0x0327, 0x013b},
+        {0x004c, 0x032d, 0x1e3c}, {0x004c, 0x0331, 0x1e3a}, {0x004d, 0x0301, 0x1e3e},
+        {0x004d, 0x0307, 0x1e40}, {0x004d, 0x0323, 0x1e42}, {0x004e, 0x0300, 0x01f8},
+        {0x004e, 0x0301, 0x0143}, {0x004e, 0x0303, 0x00d1}, {0x004e, 0x0307, 0x1e44},
+        {0x004e, 0x030c, 0x0147}, {0x004e, 0x0323, 0x1e46}, {0x004e, 0x0327, 0x0145},
+        {0x004e, 0x032d, 0x1e4a}, {0x004e, 0x0331, 0x1e48}, {0x004f, 0x0300, 0x00d2},
+        {0x004f, 0x0301, 0x00d3}, {0x004f, 0x0302, 0x00d4}, {0x004f, 0x0303, 0x00d5},
+        {0x004f, 0x0304, 0x014c}, {0x004f, 0x0306, 0x014e}, {0x004f, 0x0307, 0x022e},
+        {0x004f, 0x0308, 0x00d6}, {0x004f, 0x0309, 0x1ece}, {0x004f, 0x030b, 0x0150},
+        {0x004f, 0x030c, 0x01d1}, {0x004f, 0x030f, 0x020c}, {0x004f, 0x0311, 0x020e},
+        {0x004f, 0x031b, 0x01a0}, {0x004f, 0x0323, 0x1ecc}, {0x004f, 0x0328, 0x01ea},
+        {0x0050, 0x0301, 0x1e54}, {0x0050, 0x0307, 0x1e56}, {0x0052, 0x0301, 0x0154},
+        {0x0052, 0x0307, 0x1e58}, {0x0052, 0x030c, 0x0158}, {0x0052, 0x030f, 0x0210},
+        {0x0052, 0x0311, 0x0212}, {0x0052, 0x0323, 0x1e5a}, {0x0052, 0x0327, 0x0156},
+        {0x0052, 0x0331, 0x1e5e}, {0x0053, 0x0301, 0x015a}, {0x0053, 0x0302, 0x015c},
+        {0x0053, 0x0307, 0x1e60}, {0x0053, 0x030c, 0x0160}, {0x0053, 0x0323, 0x1e62},
+        {0x0053, 0x0326, 0x0218}, {0x0053, 0x0327, 0x015e}, {0x0054, 0x0307, 0x1e6a},
+        {0x0054, 0x030c, 0x0164}, {0x0054, 0x0323, 0x1e6c}, {0x0054, 0x0326, 0x021a},
+        {0x0054, 0x0327, 0x0162}, {0x0054, 0x032d, 0x1e70}, {0x0054, 0x0331, 0x1e6e},
+        {0x0055, 0x0300, 0x00d9}, {0x0055, 0x0301, 0x00da}, {0x0055, 0x0302, 0x00db},
+        {0x0055, 0x0303, 0x0168}, {0x0055, 0x0304, 0x016a}, {0x0055, 0x0306, 0x016c},
+        {0x0055, 0x0308, 0x00dc}, {0x0055, 0x0309, 0x1ee6}, {0x0055, 0x030a, 0x016e},
+        {0x0055, 0x030b, 0x0170}, {0x0055, 0x030c, 0x01d3}, {0x0055, 0x030f, 0x0214},
+        {0x0055, 0x0311, 0x0216}, {0x0055, 0x031b, 0x01af}, {0x0055, 0x0323, 0x1ee4},
+        {0x0055, 0x0324, 0x1e72}, {0x0055, 0x0328, 0x0172}, {0x0055, 0x032d, 0x1e76},
+        {0x0055, 0x0330, 0x1e74}, {0x0056, 0x0303, 0x1e7c}, {0x0056, 0x0323, 0x1e7e},
+        {0x0057, 0x0300, 0x1e80}, {0x0057, 0x0301, 0x1e82}, {0x0057, 0x0302, 0x0174},
+        {0x0057, 0x0307, 0x1e86}, {0x0057, 0x0308, 0x1e84}, {0x0057, 0x0323, 0x1e88},
+        {0x0058, 0x0307, 0x1e8a}, {0x0058, 0x0308, 0x1e8c}, {0x0059, 0x0300, 0x1ef2},
+        {0x0059, 0x0301, 0x00dd}, {0x0059, 0x0302, 0x0176}, {0x0059, 0x0303, 0x1ef8},
+        {0x0059, 0x0304, 0x0232}, {0x0059, 0x0307, 0x1e8e}, {0x0059, 0x0308, 0x0178},
+        {0x0059, 0x0309, 0x1ef6}, {0x0059, 0x0323, 0x1ef4}, {0x005a, 0x0301, 0x0179},
+        {0x005a, 0x0302, 0x1e90}, {0x005a, 0x0307, 0x017b}, {0x005a, 0x030c, 0x017d},
+        {0x005a, 0x0323, 0x1e92}, {0x005a, 0x0331, 0x1e94}, {0x0061, 0x0300, 0x00e0},
+        {0x0061, 0x0301, 0x00e1}, {0x0061, 0x0302, 0x00e2}, {0x0061, 0x0303, 0x00e3},
+        {0x0061, 0x0304, 0x0101}, {0x0061, 0x0306, 0x0103}, {0x0061, 0x0307, 0x0227},
+        {0x0061, 0x0308, 0x00e4}, {0x0061, 0x0309, 0x1ea3}, {0x0061, 0x030a, 0x00e5},
+        {0x0061, 0x030c, 0x01ce}, {0x0061, 0x030f, 0x0201}, {0x0061, 0x0311, 0x0203},
+        {0x0061, 0x0323, 0x1ea1}, {0x0061, 0x0325, 0x1e01}, {0x0061, 0x0328, 0x0105},
+        {0x0062, 0x0307, 0x1e03}, {0x0062, 0x0323, 0x1e05}, {0x0062, 0x0331, 0x1e07},
+        {0x0063, 0x0301, 0x0107}, {0x0063, 0x0302, 0x0109}, {0x0063, 0x0307, 0x010b},
+        {0x0063, 0x030c, 0x010d}, {0x0063, 0x0327, 0x00e7}, {0x0064, 0x0307, 0x1e0b},
+        {0x0064, 0x030c, 0x010f}, {0x0064, 0x0323, 0x1e0d}, {0x0064, 0x0327, 0x1e11},
+        {0x0064, 0x032d, 0x1e13}, {0x0064, 0x0331, 0x1e0f}, {0x0065, 0x0300, 0x00e8},
+        {0x0065, 0x0301, 0x00e9}, {0x0065, 0x0302, 0x00ea}, {0x0065, 0x0303, 0x1ebd},
+        {0x0065, 0x0304, 0x0113}, {0x0065, 0x0306, 0x0115}, {0x0065, 0x0307, 0x0117},
+        {0x0065, 0x0308, 0x00eb}, {0x0065, 0x0309, 0x1ebb}, {0x0065, 0x030c, 0x011b},
+        {0x0065, 0x030f, 0x0205}, {0x0065, 0x0311, 0x0207}, {0x0065, 0x0323, 0x1eb9},
+        {0x0065, 0x0327, 0x0229}, {0x0065, 0x0328, 0x0119}, {0x0065, 0x032d, 0x1e19},
+        {0x0065, 0x0330, 0x1e1b}, {0x0066, 0x0307, 0x1e1f}, {0x0067, 0x0301, 0x01f5},
+        {0x0067, 0x0302, 0x011d}, {0x0067, 0x0304, 0x1e21}, {0x0067, 0x0306, 0x011f},
+        {0x0067, 0x0307, 0x0121}, {0x0067, 0x030c, 0x01e7}, {0x0067, 0x0327, 0x0123},
+        {0x0068, 0x0302, 0x0125}, {0x0068, 0x0307, 0x1e23}, {0x0068, 0x0308, 0x1e27},
+        {0x0068, 0x030c, 0x021f}, {0x0068, 0x0323, 0x1e25}, {0x0068, 0x0327, 0x1e29},
+        {0x0068, 0x032e, 0x1e2b}, {0x0068, 0x0331, 0x1e96}, {0x0069, 0x0300, 0x00ec},
+        {0x0069, 0x0301, 0x00ed}, {0x0069, 0x0302, 0x00ee}, {0x0069, 0x0303, 0x0129},
+        {0x0069, 0x0304, 0x012b}, {0x0069, 0x0306, 0x012d}, {0x0069, 0x0308, 0x00ef},
+        {0x0069, 0x0309, 0x1ec9}, {0x0069, 0x030c, 0x01d0}, {0x0069, 0x030f, 0x0209},
+        {0x0069, 0x0311, 0x020b}, {0x0069, 0x0323, 0x1ecb}, {0x0069, 0x0328, 0x012f},
+        {0x0069, 0x0330, 0x1e2d}, {0x006a, 0x0302, 0x0135}, {0x006a, 0x030c, 0x01f0},
+        {0x006b, 0x0301, 0x1e31}, {0x006b, 0x030c, 0x01e9}, {0x006b, 0x0323, 0x1e33},
+        {0x006b, 0x0327, 0x0137}, {0x006b, 0x0331, 0x1e35}, {0x006c, 0x0301, 0x013a},
+        {0x006c, 0x030c, 0x013e}, {0x006c, 0x0323, 0x1e37}, {0x006c, 0x0327, 0x013c},
+        {0x006c, 0x032d, 0x1e3d}, {0x006c, 0x0331, 0x1e3b}, {0x006d, 0x0301, 0x1e3f},
+        {0x006d, 0x0307, 0x1e41}, {0x006d, 0x0323, 0x1e43}, {0x006e, 0x0300, 0x01f9},
+        {0x006e, 0x0301, 0x0144}, {0x006e, 0x0303, 0x00f1}, {0x006e, 0x0307, 0x1e45},
+        {0x006e, 0x030c, 0x0148}, {0x006e, 0x0323, 0x1e47}, {0x006e, 0x0327, 0x0146},
+        {0x006e, 0x032d, 0x1e4b}, {0x006e, 0x0331, 0x1e49}, {0x006f, 0x0300, 0x00f2},
+        {0x006f, 0x0301, 0x00f3}, {0x006f, 0x0302, 0x00f4}, {0x006f, 0x0303, 0x00f5},
+        {0x006f, 0x0304, 0x014d}, {0x006f, 0x0306, 0x014f}, {0x006f, 0x0307, 0x022f},
+        {0x006f, 0x0308, 0x00f6}, {0x006f, 0x0309, 0x1ecf}, {0x006f, 0x030b, 0x0151},
+        {0x006f, 0x030c, 0x01d2}, {0x006f, 0x030f, 0x020d}, {0x006f, 0x0311, 0x020f},
+        {0x006f, 0x031b, 0x01a1}, {0x006f, 0x0323, 0x1ecd}, {0x006f, 0x0328, 0x01eb},
+        {0x0070, 0x0301, 0x1e55}, {0x0070, 0x0307, 0x1e57}, {0x0072, 0x0301, 0x0155},
+        {0x0072, 0x0307, 0x1e59}, {0x0072, 0x030c, 0x0159}, {0x0072, 0x030f, 0x0211},
+        {0x0072, 0x0311, 0x0213}, {0x0072, 0x0323, 0x1e5b}, {0x0072, 0x0327, 0x0157},
+        {0x0072, 0x0331, 0x1e5f}, {0x0073, 0x0301, 0x015b}, {0x0073, 0x0302, 0x015d},
+        {0x0073, 0x0307, 0x1e61}, {0x0073, 0x030c, 0x0161}, {0x0073, 0x0323, 0x1e63},
+        {0x0073, 0x0326, 0x0219}, {0x0073, 0x0327, 0x015f}, {0x0074, 0x0307, 0x1e6b},
+        {0x0074, 0x0308, 0x1e97}, {0x0074, 0x030c, 0x0165}, {0x0074, 0x0323, 0x1e6d},
+        {0x0074, 0x0326, 0x021b}, {0x0074, 0x0327, 0x0163}, {0x0074, 0x032d, 0x1e71},
+        {0x0074, 0x0331, 0x1e6f}, {0x0075, 0x0300, 0x00f9}, {0x0075, 0x0301, 0x00fa},
+        {0x0075, 0x0302, 0x00fb}, {0x0075, 0x0303, 0x0169}, {0x0075, 0x0304, 0x016b},
+        {0x0075, 0x0306, 0x016d}, {0x0075, 0x0308, 0x00fc}, {0x0075, 0x0309, 0x1ee7},
+        {0x0075, 0x030a, 0x016f}, {0x0075, 0x030b, 0x0171}, {0x0075, 0x030c, 0x01d4},
+        {0x0075, 0x030f, 0x0215}, {0x0075, 0x0311, 0x0217}, {0x0075, 0x031b, 0x01b0},
+        {0x0075, 0x0323, 0x1ee5}, {0x0075, 0x0324, 0x1e73}, {0x0075, 0x0328, 0x0173},
+        {0x0075, 0x032d, 0x1e77}, {0x0075, 0x0330, 0x1e75}, {0x0076, 0x0303, 0x1e7d},
+        {0x0076, 0x0323, 0x1e7f}, {0x0077, 0x0300, 0x1e81}, {0x0077, 0x0301, 0x1e83},
+        {0x0077, 0x0302, 0x0175}, {0x0077, 0x0307, 0x1e87}, {0x0077, 0x0308, 0x1e85},
+        {0x0077, 0x030a, 0x1e98}, {0x0077, 0x0323, 0x1e89}, {0x0078, 0x0307, 0x1e8b},
+        {0x0078, 0x0308, 0x1e8d}, {0x0079, 0x0300, 0x1ef3}, {0x0079, 0x0301, 0x00fd},
+        {0x0079, 0x0302, 0x0177}, {0x0079, 0x0303, 0x1ef9}, {0x0079, 0x0304, 0x0233},
+        {0x0079, 0x0307, 0x1e8f}, {0x0079, 0x0308, 0x00ff}, {0x0079, 0x0309, 0x1ef7},
+        {0x0079, 0x030a, 0x1e99}, {0x0079, 0x0323, 0x1ef5}, {0x007a, 0x0301, 0x017a},
+        {0x007a, 0x0302, 0x1e91}, {0x007a, 0x0307, 0x017c}, {0x007a, 0x030c, 0x017e},
+        {0x007a, 0x0323, 0x1e93}, {0x007a, 0x0331, 0x1e95}, {0x00a8, 0x0300, 0x1fed},
+        {0x00a8, 0x0301, 0x0385}, {0x00a8, 0x0342, 0x1fc1}, {0x00c2, 0x0300, 0x1ea6},
+        {0x00c2, 0x0301, 0x1ea4}, {0x00c2, 0x0303, 0x1eaa}, {0x00c2, 0x0309, 0x1ea8},
+        {0x00c4, 0x0304, 0x01de}, {0x00c5, 0x0301, 0x01fa}, {0x00c6, 0x0301, 0x01fc},
+        {0x00c6, 0x0304, 0x01e2}, {0x00c7, 0x0301, 0x1e08}, {0x00ca, 0x0300, 0x1ec0},
+        {0x00ca, 0x0301, 0x1ebe}, {0x00ca, 0x0303, 0x1ec4}, {0x00ca, 0x0309, 0x1ec2},
+        {0x00cf, 0x0301, 0x1e2e}, {0x00d4, 0x0300, 0x1ed2}, {0x00d4, 0x0301, 0x1ed0},
+        {0x00d4, 0x0303, 0x1ed6}, {0x00d4, 0x0309, 0x1ed4}, {0x00d5, 0x0301, 0x1e4c},
+        {0x00d5, 0x0304, 0x022c}, {0x00d5, 0x0308, 0x1e4e}, {0x00d6, 0x0304, 0x022a},
+        {0x00d8, 0x0301, 0x01fe}, {0x00dc, 0x0300, 0x01db}, {0x00dc, 0x0301, 0x01d7},
+        {0x00dc, 0x0304, 0x01d5}, {0x00dc, 0x030c, 0x01d9}, {0x00e2, 0x0300, 0x1ea7},
+        {0x00e2, 0x0301, 0x1ea5}, {0x00e2, 0x0303, 0x1eab}, {0x00e2, 0x0309, 0x1ea9},
+        {0x00e4, 0x0304, 0x01df}, {0x00e5, 0x0301, 0x01fb}, {0x00e6, 0x0301, 0x01fd},
+        {0x00e6, 0x0304, 0x01e3}, {0x00e7, 0x0301, 0x1e09}, {0x00ea, 0x0300, 0x1ec1},
+        {0x00ea, 0x0301, 0x1ebf}, {0x00ea, 0x0303, 0x1ec5}, {0x00ea, 0x0309, 0x1ec3},
+        {0x00ef, 0x0301, 0x1e2f}, {0x00f4, 0x0300, 0x1ed3}, {0x00f4, 0x0301, 0x1ed1},
+        {0x00f4, 0x0303, 0x1ed7}, {0x00f4, 0x0309, 0x1ed5}, {0x00f5, 0x0301, 0x1e4d},
+        {0x00f5, 0x0304, 0x022d}, {0x00f5, 0x0308, 0x1e4f}, {0x00f6, 0x0304, 0x022b},
+        {0x00f8, 0x0301, 0x01ff}, {0x00fc, 0x0300, 0x01dc}, {0x00fc, 0x0301, 0x01d8},
+        {0x00fc, 0x0304, 0x01d6}, {0x00fc, 0x030c, 0x01da}, {0x0102, 0x0300, 0x1eb0},
+        {0x0102, 0x0301, 0x1eae}, {0x0102, 0x0303, 0x1eb4}, {0x0102, 0x0309, 0x1eb2},
+        {0x0103, 0x0300, 0x1eb1}, {0x0103, 0x0301, 0x1eaf}, {0x0103, 0x0303, 0x1eb5},
+        {0x0103, 0x0309, 0x1eb3}, {0x0112, 0x0300, 0x1e14}, {0x0112, 0x0301, 0x1e16},
+        {0x0113, 0x0300, 0x1e15}, {0x0113, 0x0301, 0x1e17}, {0x014c, 0x0300, 0x1e50},
+        {0x014c, 0x0301, 0x1e52}, {0x014d, 0x0300, 0x1e51}, {0x014d, 0x0301, 0x1e53},
+        {0x015a, 0x0307, 0x1e64}, {0x015b, 0x0307, 0x1e65}, {0x0160, 0x0307, 0x1e66},
+        {0x0161, 0x0307, 0x1e67}, {0x0168, 0x0301, 0x1e78}, {0x0169, 0x0301, 0x1e79},
+        {0x016a, 0x0308, 0x1e7a}, {0x016b, 0x0308, 0x1e7b}, {0x017f, 0x0307, 0x1e9b},
+        {0x01a0, 0x0300, 0x1edc}, {0x01a0, 0x0301, 0x1eda}, {0x01a0, 0x0303, 0x1ee0},
+        {0x01a0, 0x0309, 0x1ede}, {0x01a0, 0x0323, 0x1ee2}, {0x01a1, 0x0300, 0x1edd},
+        {0x01a1, 0x0301, 0x1edb}, {0x01a1, 0x0303, 0x1ee1}, {0x01a1, 0x0309, 0x1edf},
+        {0x01a1, 0x0323, 0x1ee3}, {0x01af, 0x0300, 0x1eea}, {0x01af, 0x0301, 0x1ee8},
+        {0x01af, 0x0303, 0x1eee}, {0x01af, 0x0309, 0x1eec}, {0x01af, 0x0323, 0x1ef0},
+        {0x01b0, 0x0300, 0x1eeb}, {0x01b0, 0x0301, 0x1ee9}, {0x01b0, 0x0303, 0x1eef},
+        {0x01b0, 0x0309, 0x1eed}, {0x01b0, 0x0323, 0x1ef1}, {0x01b7, 0x030c, 0x01ee},
+        {0x01ea, 0x0304, 0x01ec}, {0x01eb, 0x0304, 0x01ed}, {0x0226, 0x0304, 0x01e0},
+        {0x0227, 0x0304, 0x01e1}, {0x0228, 0x0306, 0x1e1c}, {0x0229, 0x0306, 0x1e1d},
+        {0x022e, 0x0304, 0x0230}, {0x022f, 0x0304, 0x0231}, {0x0292, 0x030c, 0x01ef},
+        {0x0391, 0x0300, 0x1fba}, {0x0391, 0x0301, 0x0386}, {0x0391, 0x0304, 0x1fb9},
+        {0x0391, 0x0306, 0x1fb8}, {0x0391, 0x0313, 0x1f08}, {0x0391, 0x0314, 0x1f09},
+        {0x0391, 0x0345, 0x1fbc}, {0x0395, 0x0300, 0x1fc8}, {0x0395, 0x0301, 0x0388},
+        {0x0395, 0x0313, 0x1f18}, {0x0395, 0x0314, 0x1f19}, {0x0397, 0x0300, 0x1fca},
+        {0x0397, 0x0301, 0x0389}, {0x0397, 0x0313, 0x1f28}, {0x0397, 0x0314, 0x1f29},
+        {0x0397, 0x0345, 0x1fcc}, {0x0399, 0x0300, 0x1fda}, {0x0399, 0x0301, 0x038a},
+        {0x0399, 0x0304, 0x1fd9}, {0x0399, 0x0306, 0x1fd8}, {0x0399, 0x0308, 0x03aa},
+        {0x0399, 0x0313, 0x1f38}, {0x0399, 0x0314, 0x1f39}, {0x039f, 0x0300, 0x1ff8},
+        {0x039f, 0x0301, 0x038c}, {0x039f, 0x0313, 0x1f48}, {0x039f, 0x0314, 0x1f49},
+        {0x03a1, 0x0314, 0x1fec}, {0x03a5, 0x0300, 0x1fea}, {0x03a5, 0x0301, 0x038e},
+        {0x03a5, 0x0304, 0x1fe9}, {0x03a5, 0x0306, 0x1fe8}, {0x03a5, 0x0308, 0x03ab},
+        {0x03a5, 0x0314, 0x1f59}, {0x03a9, 0x0300, 0x1ffa}, {0x03a9, 0x0301, 0x038f},
+        {0x03a9, 0x0313, 0x1f68}, {0x03a9, 0x0314, 0x1f69}, {0x03a9, 0x0345, 0x1ffc},
+        {0x03ac, 0x0345, 0x1fb4}, {0x03ae, 0x0345, 0x1fc4}, {0x03b1, 0x0300, 0x1f70},
+        {0x03b1, 0x0301, 0x03ac}, {0x03b1, 0x0304, 0x1fb1}, {0x03b1, 0x0306, 0x1fb0},
+        {0x03b1, 0x0313, 0x1f00}, {0x03b1, 0x0314, 0x1f01}, {0x03b1, 0x0342, 0x1fb6},
+        {0x03b1, 0x0345, 0x1fb3}, {0x03b5, 0x0300, 0x1f72}, {0x03b5, 0x0301, 0x03ad},
+        {0x03b5, 0x0313, 0x1f10}, {0x03b5, 0x0314, 0x1f11}, {0x03b7, 0x0300, 0x1f74},
+        {0x03b7, 0x0301, 0x03ae}, {0x03b7, 0x0313, 0x1f20}, {0x03b7, 0x0314, 0x1f21},
+        {0x03b7, 0x0342, 0x1fc6}, {0x03b7, 0x0345, 0x1fc3}, {0x03b9, 0x0300, 0x1f76},
+        {0x03b9, 0x0301, 0x03af}, {0x03b9, 0x0304, 0x1fd1}, {0x03b9, 0x0306, 0x1fd0},
+        {0x03b9, 0x0308, 0x03ca}, {0x03b9, 0x0313, 0x1f30}, {0x03b9, 0x0314, 0x1f31},
+        {0x03b9, 0x0342, 0x1fd6}, {0x03bf, 0x0300, 0x1f78}, {0x03bf, 0x0301, 0x03cc},
+        {0x03bf, 0x0313, 0x1f40}, {0x03bf, 0x0314, 0x1f41}, {0x03c1, 0x0313, 0x1fe4},
+        {0x03c1, 0x0314, 0x1fe5}, {0x03c5, 0x0300, 0x1f7a}, {0x03c5, 0x0301, 0x03cd},
+        {0x03c5, 0x0304, 0x1fe1}, {0x03c5, 0x0306, 0x1fe0}, {0x03c5, 0x0308, 0x03cb},
+        {0x03c5, 0x0313, 0x1f50}, {0x03c5, 0x0314, 0x1f51}, {0x03c5, 0x0342, 0x1fe6},
+        {0x03c9, 0x0300, 0x1f7c}, {0x03c9, 0x0301, 0x03ce}, {0x03c9, 0x0313, 0x1f60},
+        {0x03c9, 0x0314, 0x1f61}, {0x03c9, 0x0342, 0x1ff6}, {0x03c9, 0x0345, 0x1ff3},
+        {0x03ca, 0x0300, 0x1fd2}, {0x03ca, 0x0301, 0x0390}, {0x03ca, 0x0342, 0x1fd7},
+        {0x03cb, 0x0300, 0x1fe2}, {0x03cb, 0x0301, 0x03b0}, {0x03cb, 0x0342, 0x1fe7},
+        {0x03ce, 0x0345, 0x1ff4}, {0x03d2, 0x0301, 0x03d3}, {0x03d2, 0x0308, 0x03d4},
+        {0x0406, 0x0308, 0x0407}, {0x0410, 0x0306, 0x04d0}, {0x0410, 0x0308, 0x04d2},
+        {0x0413, 0x0301, 0x0403}, {0x0415, 0x0300, 0x0400}, {0x0415, 0x0306, 0x04d6},
+        {0x0415, 0x0308, 0x0401}, {0x0416, 0x0306, 0x04c1}, {0x0416, 0x0308, 0x04dc},
+        {0x0417, 0x0308, 0x04de}, {0x0418, 0x0300, 0x040d}, {0x0418, 0x0304, 0x04e2},
+        {0x0418, 0x0306, 0x0419}, {0x0418, 0x0308, 0x04e4}, {0x041a, 0x0301, 0x040c},
+        {0x041e, 0x0308, 0x04e6}, {0x0423, 0x0304, 0x04ee}, {0x0423, 0x0306, 0x040e},
+        {0x0423, 0x0308, 0x04f0}, {0x0423, 0x030b, 0x04f2}, {0x0427, 0x0308, 0x04f4},
+        {0x042b, 0x0308, 0x04f8}, {0x042d, 0x0308, 0x04ec}, {0x0430, 0x0306, 0x04d1},
+        {0x0430, 0x0308, 0x04d3}, {0x0433, 0x0301, 0x0453}, {0x0435, 0x0300, 0x0450},
+        {0x0435, 0x0306, 0x04d7}, {0x0435, 0x0308, 0x0451}, {0x0436, 0x0306, 0x04c2},
+        {0x0436, 0x0308, 0x04dd}, {0x0437, 0x0308, 0x04df}, {0x0438, 0x0300, 0x045d},
+        {0x0438, 0x0304, 0x04e3}, {0x0438, 0x0306, 0x0439}, {0x0438, 0x0308, 0x04e5},
+        {0x043a, 0x0301, 0x045c}, {0x043e, 0x0308, 0x04e7}, {0x0443, 0x0304, 0x04ef},
+        {0x0443, 0x0306, 0x045e}, {0x0443, 0x0308, 0x04f1}, {0x0443, 0x030b, 0x04f3},
+        {0x0447, 0x0308, 0x04f5}, {0x044b, 0x0308, 0x04f9}, {0x044d, 0x0308, 0x04ed},
+        {0x0456, 0x0308, 0x0457}, {0x0474, 0x030f, 0x0476}, {0x0475, 0x030f, 0x0477},
+        {0x04d8, 0x0308, 0x04da}, {0x04d9, 0x0308, 0x04db}, {0x04e8, 0x0308, 0x04ea},
+        {0x04e9, 0x0308, 0x04eb}, {0x0627, 0x0653, 0x0622}, {0x0627, 0x0654, 0x0623},
+        {0x0627, 0x0655, 0x0625}, {0x0648, 0x0654, 0x0624}, {0x064a, 0x0654, 0x0626},
+        {0x06c1, 0x0654, 0x06c2}, {0x06d2, 0x0654, 0x06d3}, {0x06d5, 0x0654, 0x06c0},
+        {0x0928, 0x093c, 0x0929}, {0x0930, 0x093c, 0x0931}, {0x0933, 0x093c, 0x0934},
+        {0x09c7, 0x09be, 0x09cb}, {0x09c7, 0x09d7, 0x09cc}, {0x0b47, 0x0b3e, 0x0b4b},
+        {0x0b47, 0x0b56, 0x0b48}, {0x0b47, 0x0b57, 0x0b4c}, {0x0b92, 0x0bd7, 0x0b94},
+        {0x0bc6, 0x0bbe, 0x0bca}, {0x0bc6, 0x0bd7, 0x0bcc}, {0x0bc7, 0x0bbe, 0x0bcb},
+        {0x0c46, 0x0c56, 0x0c48}, {0x0cbf, 0x0cd5, 0x0cc0}, {0x0cc6, 0x0cc2, 0x0cca},
+        {0x0cc6, 0x0cd5, 0x0cc7}, {0x0cc6, 0x0cd6, 0x0cc8}, {0x0cca, 0x0cd5, 0x0ccb},
+        {0x0d46, 0x0d3e, 0x0d4a}, {0x0d46, 0x0d57, 0x0d4c}, {0x0d47, 0x0d3e, 0x0d4b},
+        {0x0dd9, 0x0dca, 0x0dda}, {0x0dd9, 0x0dcf, 0x0ddc}, {0x0dd9, 0x0ddf, 0x0dde},
+        {0x0ddc, 0x0dca, 0x0ddd}, {0x1025, 0x102e, 0x1026}, {0x1b05, 0x1b35, 0x1b06},
+        {0x1b07, 0x1b35, 0x1b08}, {0x1b09, 0x1b35, 0x1b0a}, {0x1b0b, 0x1b35, 0x1b0c},
+        {0x1b0d, 0x1b35, 0x1b0e}, {0x1b11, 0x1b35, 0x1b12}, {0x1b3a, 0x1b35, 0x1b3b},
+        {0x1b3c, 0x1b35, 0x1b3d}, {0x1b3e, 0x1b35, 0x1b40}, {0x1b3f, 0x1b35, 0x1b41},
+        {0x1b42, 0x1b35, 0x1b43}, {0x1e36, 0x0304, 0x1e38}, {0x1e37, 0x0304, 0x1e39},
+        {0x1e5a, 0x0304, 0x1e5c}, {0x1e5b, 0x0304, 0x1e5d}, {0x1e62, 0x0307, 0x1e68},
+        {0x1e63, 0x0307, 0x1e69}, {0x1ea0, 0x0302, 0x1eac}, {0x1ea0, 0x0306, 0x1eb6},
+        {0x1ea1, 0x0302, 0x1ead}, {0x1ea1, 0x0306, 0x1eb7}, {0x1eb8, 0x0302, 0x1ec6},
+        {0x1eb9, 0x0302, 0x1ec7}, {0x1ecc, 0x0302, 0x1ed8}, {0x1ecd, 0x0302, 0x1ed9},
+        {0x1f00, 0x0300, 0x1f02}, {0x1f00, 0x0301, 0x1f04}, {0x1f00, 0x0342, 0x1f06},
+        {0x1f00, 0x0345, 0x1f80}, {0x1f01, 0x0300, 0x1f03}, {0x1f01, 0x0301, 0x1f05},
+        {0x1f01, 0x0342, 0x1f07}, {0x1f01, 0x0345, 0x1f81}, {0x1f02, 0x0345, 0x1f82},
+        {0x1f03, 0x0345, 0x1f83}, {0x1f04, 0x0345, 0x1f84}, {0x1f05, 0x0345, 0x1f85},
+        {0x1f06, 0x0345, 0x1f86}, {0x1f07, 0x0345, 0x1f87}, {0x1f08, 0x0300, 0x1f0a},
+        {0x1f08, 0x0301, 0x1f0c}, {0x1f08, 0x0342, 0x1f0e}, {0x1f08, 0x0345, 0x1f88},
+        {0x1f09, 0x0300, 0x1f0b}, {0x1f09, 0x0301, 0x1f0d}, {0x1f09, 0x0342, 0x1f0f},
+        {0x1f09, 0x0345, 0x1f89}, {0x1f0a, 0x0345, 0x1f8a}, {0x1f0b, 0x0345, 0x1f8b},
+        {0x1f0c, 0x0345, 0x1f8c}, {0x1f0d, 0x0345, 0x1f8d}, {0x1f0e, 0x0345, 0x1f8e},
+        {0x1f0f, 0x0345, 0x1f8f}, {0x1f10, 0x0300, 0x1f12}, {0x1f10, 0x0301, 0x1f14},
+        {0x1f11, 0x0300, 0x1f13}, {0x1f11, 0x0301, 0x1f15}, {0x1f18, 0x0300, 0x1f1a},
+        {0x1f18, 0x0301, 0x1f1c}, {0x1f19, 0x0300, 0x1f1b}, {0x1f19, 0x0301, 0x1f1d},
+        {0x1f20, 0x0300, 0x1f22}, {0x1f20, 0x0301, 0x1f24}, {0x1f20, 0x0342, 0x1f26},
+        {0x1f20, 0x0345, 0x1f90}, {0x1f21, 0x0300, 0x1f23}, {0x1f21, 0x0301, 0x1f25},
+        {0x1f21, 0x0342, 0x1f27}, {0x1f21, 0x0345, 0x1f91}, {0x1f22, 0x0345, 0x1f92},
+        {0x1f23, 0x0345, 0x1f93}, {0x1f24, 0x0345, 0x1f94}, {0x1f25, 0x0345, 0x1f95},
+        {0x1f26, 0x0345, 0x1f96}, {0x1f27, 0x0345, 0x1f97}, {0x1f28, 0x0300, 0x1f2a},
+        {0x1f28, 0x0301, 0x1f2c}, {0x1f28, 0x0342, 0x1f2e}, {0x1f28, 0x0345, 0x1f98},
+        {0x1f29, 0x0300, 0x1f2b}, {0x1f29, 0x0301, 0x1f2d}, {0x1f29, 0x0342, 0x1f2f},
+        {0x1f29, 0x0345, 0x1f99}, {0x1f2a, 0x0345, 0x1f9a}, {0x1f2b, 0x0345, 0x1f9b},
+        {0x1f2c, 0x0345, 0x1f9c}, {0x1f2d, 0x0345, 0x1f9d}, {0x1f2e, 0x0345, 0x1f9e},
+        {0x1f2f, 0x0345, 0x1f9f}, {0x1f30, 0x0300, 0x1f32}, {0x1f30, 0x0301, 0x1f34},
+        {0x1f30, 0x0342, 0x1f36}, {0x1f31, 0x0300, 0x1f33}, {0x1f31, 0x0301, 0x1f35},
+        {0x1f31, 0x0342, 0x1f37}, {0x1f38, 0x0300, 0x1f3a}, {0x1f38, 0x0301, 0x1f3c},
+        {0x1f38, 0x0342, 0x1f3e}, {0x1f39, 0x0300, 0x1f3b}, {0x1f39, 0x0301, 0x1f3d},
+        {0x1f39, 0x0342, 0x1f3f}, {0x1f40, 0x0300, 0x1f42}, {0x1f40, 0x0301, 0x1f44},
+        {0x1f41, 0x0300, 0x1f43}, {0x1f41, 0x0301, 0x1f45}, {0x1f48, 0x0300, 0x1f4a},
+        {0x1f48, 0x0301, 0x1f4c}, {0x1f49, 0x0300, 0x1f4b}, {0x1f49, 0x0301, 0x1f4d},
+        {0x1f50, 0x0300, 0x1f52}, {0x1f50, 0x0301, 0x1f54}, {0x1f50, 0x0342, 0x1f56},
+        {0x1f51, 0x0300, 0x1f53}, {0x1f51, 0x0301, 0x1f55}, {0x1f51, 0x0342, 0x1f57},
+        {0x1f59, 0x0300, 0x1f5b}, {0x1f59, 0x0301, 0x1f5d}, {0x1f59, 0x0342, 0x1f5f},
+        {0x1f60, 0x0300, 0x1f62}, {0x1f60, 0x0301, 0x1f64}, {0x1f60, 0x0342, 0x1f66},
+        {0x1f60, 0x0345, 0x1fa0}, {0x1f61, 0x0300, 0x1f63}, {0x1f61, 0x0301, 0x1f65},
+        {0x1f61, 0x0342, 0x1f67}, {0x1f61, 0x0345, 0x1fa1}, {0x1f62, 0x0345, 0x1fa2},
+        {0x1f63, 0x0345, 0x1fa3}, {0x1f64, 0x0345, 0x1fa4}, {0x1f65, 0x0345, 0x1fa5},
+        {0x1f66, 0x0345, 0x1fa6}, {0x1f67, 0x0345, 0x1fa7}, {0x1f68, 0x0300, 0x1f6a},
+        {0x1f68, 0x0301, 0x1f6c}, {0x1f68, 0x0342, 0x1f6e}, {0x1f68, 0x0345, 0x1fa8},
+        {0x1f69, 0x0300, 0x1f6b}, {0x1f69, 0x0301, 0x1f6d}, {0x1f69, 0x0342, 0x1f6f},
+        {0x1f69, 0x0345, 0x1fa9}, {0x1f6a, 0x0345, 0x1faa}, {0x1f6b, 0x0345, 0x1fab},
+        {0x1f6c, 0x0345, 0x1fac}, {0x1f6d, 0x0345, 0x1fad}, {0x1f6e, 0x0345, 0x1fae},
+        {0x1f6f, 0x0345, 0x1faf}, {0x1f70, 0x0345, 0x1fb2}, {0x1f74, 0x0345, 0x1fc2},
+        {0x1f7c, 0x0345, 0x1ff2}, {0x1fb6, 0x0345, 0x1fb7}, {0x1fbf, 0x0300, 0x1fcd},
+        {0x1fbf, 0x0301, 0x1fce}, {0x1fbf, 0x0342, 0x1fcf}, {0x1fc6, 0x0345, 0x1fc7},
+        {0x1ff6, 0x0345, 0x1ff7}, {0x1ffe, 0x0300, 0x1fdd}, {0x1ffe, 0x0301, 0x1fde},
+        {0x1ffe, 0x0342, 0x1fdf}, {0x2190, 0x0338, 0x219a}, {0x2192, 0x0338, 0x219b},
+        {0x2194, 0x0338, 0x21ae}, {0x21d0, 0x0338, 0x21cd}, {0x21d2, 0x0338, 0x21cf},
+        {0x21d4, 0x0338, 0x21ce}, {0x2203, 0x0338, 0x2204}, {0x2208, 0x0338, 0x2209},
+        {0x220b, 0x0338, 0x220c}, {0x2223, 0x0338, 0x2224}, {0x2225, 0x0338, 0x2226},
+        {0x223c, 0x0338, 0x2241}, {0x2243, 0x0338, 0x2244}, {0x2245, 0x0338, 0x2247},
+        {0x2248, 0x0338, 0x2249}, {0x224d, 0x0338, 0x226d}, {0x2261, 0x0338, 0x2262},
+        {0x2264, 0x0338, 0x2270}, {0x2265, 0x0338, 0x2271}, {0x2272, 0x0338, 0x2274},
+        {0x2273, 0x0338, 0x2275}, {0x2276, 0x0338, 0x2278}, {0x2277, 0x0338, 0x2279},
+        {0x227a, 0x0338, 0x2280}, {0x227b, 0x0338, 0x2281}, {0x227c, 0x0338, 0x22e0},
+        {0x227d, 0x0338, 0x22e1}, {0x2282, 0x0338, 0x2284}, {0x2283, 0x0338, 0x2285},
+        {0x2286, 0x0338, 0x2288}, {0x2287, 0x0338, 0x2289}, {0x2291, 0x0338, 0x22e2},
+        {0x2292, 0x0338, 0x22e3}, {0x22a2, 0x0338, 0x22ac}, {0x22a8, 0x0338, 0x22ad},
+        {0x22a9, 0x0338, 0x22ae}, {0x22ab, 0x0338, 0x22af}, {0x22b2, 0x0338, 0x22ea},
+        {0x22b3, 0x0338, 0x22eb}, {0x22b4, 0x0338, 0x22ec}, {0x22b5, 0x0338, 0x22ed},
+        {0x3046, 0x3099, 0x3094}, {0x304b, 0x3099, 0x304c}, {0x304d, 0x3099, 0x304e},
+        {0x304f, 0x3099, 0x3050}, {0x3051, 0x3099, 0x3052}, {0x3053, 0x3099, 0x3054},
+        {0x3055, 0x3099, 0x3056}, {0x3057, 0x3099, 0x3058}, {0x3059, 0x3099, 0x305a},
+        {0x305b, 0x3099, 0x305c}, {0x305d, 0x3099, 0x305e}, {0x305f, 0x3099, 0x3060},
+        {0x3061, 0x3099, 0x3062}, {0x3064, 0x3099, 0x3065}, {0x3066, 0x3099, 0x3067},
+        {0x3068, 0x3099, 0x3069}, {0x306f, 0x3099, 0x3070}, {0x306f, 0x309a, 0x3071},
+        {0x3072, 0x3099, 0x3073}, {0x3072, 0x309a, 0x3074}, {0x3075, 0x3099, 0x3076},
+        {0x3075, 0x309a, 0x3077}, {0x3078, 0x3099, 0x3079}, {0x3078, 0x309a, 0x307a},
+        {0x307b, 0x3099, 0x307c}, {0x307b, 0x309a, 0x307d}, {0x309d, 0x3099, 0x309e},
+        {0x30a6, 0x3099, 0x30f4}, {0x30ab, 0x3099, 0x30ac}, {0x30ad, 0x3099, 0x30ae},
+        {0x30af, 0x3099, 0x30b0}, {0x30b1, 0x3099, 0x30b2}, {0x30b3, 0x3099, 0x30b4},
+        {0x30b5, 0x3099, 0x30b6}, {0x30b7, 0x3099, 0x30b8}, {0x30b9, 0x3099, 0x30ba},
+        {0x30bb, 0x3099, 0x30bc}, {0x30bd, 0x3099, 0x30be}, {0x30bf, 0x3099, 0x30c0},
+        {0x30c1, 0x3099, 0x30c2}, {0x30c4, 0x3099, 0x30c5}, {0x30c6, 0x3099, 0x30c7},
+        {0x30c8, 0x3099, 0x30c9}, {0x30cf, 0x3099, 0x30d0}, {0x30cf, 0x309a, 0x30d1},
+        {0x30d2, 0x3099, 0x30d3}, {0x30d2, 0x309a, 0x30d4}, {0x30d5, 0x3099, 0x30d6},
+        {0x30d5, 0x309a, 0x30d7}, {0x30d8, 0x3099, 0x30d9}, {0x30d8, 0x309a, 0x30da},
+        {0x30db, 0x3099, 0x30dc}, {0x30db, 0x309a, 0x30dd}, {0x30ef, 0x3099, 0x30f7},
+        {0x30f0, 0x3099, 0x30f8}, {0x30f1, 0x3099, 0x30f9}, {0x30f2, 0x3099, 0x30fa},
+        {0x30fd, 0x3099, 0x30fe}, {0x11099, 0x110ba, 0x1109a}, {0x1109b, 0x110ba, 0x1109c},
+        {0x110a5, 0x110ba, 0x110ab}, {0x11131, 0x11127, 0x1112e}, {0x11132, 0x11127, 0x1112f},
+        {0x11347, 0x1133e, 0x1134b}, {0x11347, 0x11357, 0x1134c}, {0x114b9, 0x114b0, 0x114bc},
+        {0x114b9, 0x114ba, 0x114bb}, {0x114b9, 0x114bd, 0x114be}, {0x115b8, 0x115af, 0x115ba},
+        {0x115b9, 0x115af, 0x115bb}, {0x11935, 0x11930, 0x11938},
+};
+
+#pragma endregion
+
+#pragma region CaseFoldTable
+
+// 由 Unicode 14.0 CaseFolding.txt 生成，包含状态 C 与 F 的映射
+
+/// 完整大小写折叠映射，每项以长度开头
+static const uint32_t CaseFoldPool[3026] = {
+        0x0000, 0x0001, 0x0061, 0x0001, 0x0062, 0x0001, 0x0063, 0x0001,
+        0x0064, 0x0001, 0x0065, 0x0001, 0x0066, 0x0001, 0x0067, 0x0001,
+        0x0068, 0x0001, 0x0069, 0x0001, 0x006a, 0x0001, 0x006b, 0x0001,
+        0x006c, 0x0001, 0x006d, 0x0001, 0x006e, 0x0001, 0x006f, 0x0001,
+        0x0070, 0x0001, 0x0071, 0x0001, 0x0072, 0x0001, 0x0073, 0x0001,
+        0x0074, 0x0001, 0x0075, 0x0001, 0x0076, 0x0001, 0x0077, 0x0001,
+        0x0078, 0x0001, 0x0079, 0x0001, 0x007a, 0x0001, 0x03bc, 0x0001,
+        0x00e0, 0x0001, 0x00e1, 0x0001, 0x00e2, 0x0001, 0x00e3, 0x0001,
+        0x00e4, 0x0001, 0x00e5, 0x0001, 0x00e6, 0x0001, 0x00e7, 0x0001,
+        0x00e8, 0x0001, 0x00e9, 0x0001, 0x00ea, 0x0001, 0x00eb, 0x0001,
+        0x00ec, 0x0001, 0x00ed, 0x0001, 0x00ee, 0x0001, 0x00ef, 0x0001,
+        0x00f0, 0x0001, 0x00f1, 0x0001, 0x00f2, 0x0001, 0x00f3, 0x0001,
+        0x00f4, 0x0001, 0x00f5, 0x0001, 0x00f6, 0x0001, 0x00f8, 0x0001,
+        0x00f9, 0x0001, 0x00fa, 0x0001, 0x00fb, 0x0001, 0x00fc, 0x0001,
+        0x00fd, 0x0001, 0x00fe, 0x0002, 0x0073, 0x0073, 0x0001, 0x0101,
+        0x0001, 0x0103, 0x0001, 0x0105, 0x0001, 0x0107, 0x0001, 0x0109,
+        0x0001, 0x010b, 0x0001, 0x010d, 0x0001, 0x010f, 0x0001, 0x0111,
+        0x0001, 0x0113, 0x0001, 0x0115, 0x0001, 0x0117, 0x0001, 0x0119,
+        0x0001, 0x011b, 0x0001, 0x011d, 0x0001, 0x011f, 0x0001, 0x0121,
+        0x0001, 0x0123, 0x0001, 0x0125, 0x0001, 0x0127, 0x0001, 0x0129,
+        0x0001, 0x012b, 0x0001, 0x012d, 0x0001, 0x012f, 0x0002, 0x0069,
+        0x0307, 0x0001, 0x0133, 0x0001, 0x0135, 0x0001, 0x0137, 0x0001,
+        0x013a, 0x0001, 0x013c, 0x0001, 0x013e, 0x0001, 0x0140, 0x0001,
+        0x0142, 0x0001, 0x0144, 0x0001, 0x0146, 0x0001, 0x0148, 0x0002,
+        0x02bc, 0x006e, 0x0001, 0x014b, 0x0001, 0x014d, 0x0001, 0x014f,
+        0x0001, 0x0151, 0x0001, 0x0153, 0x0001, 0x0155, 0x0001, 0x0157,
+        0x0001, 0x0159, 0x0001, 0x015b, 0x0001, 0x015d, 0x0001, 0x015f,
+        0x0001, 0x0161, 0x0001, 0x0163, 0x0001, 0x0165, 0x0001, 0x0167,
+        0x0001, 0x0169, 0x0001, 0x016b, 0x0001, 0x016d, 0x0001, 0x016f,
+        0x0001, 0x0171, 0x0001, 0x0173, 0x0001, 0x0175, 0x0001, 0x0177,
+        0x0001, 0x00ff, 0x0001, 0x017a, 0x0001, 0x017c, 0x0001, 0x017e,
+        0x0001, 0x0253, 0x0001, 0x0183, 0x0001, 0x0185, 0x0001, 0x0254,
+        0x0001, 0x0188, 0x0001, 0x0256, 0x0001, 0x0257, 0x0001, 0x018c,
+        0x0001, 0x01dd, 0x0001, 0x0259, 0x0001, 0x025b, 0x0001, 0x0192,
+        0x0001, 0x0260, 0x0001, 0x0263, 0x0001, 0x0269, 0x0001, 0x0268,
+        0x0001, 0x0199, 0x0001, 0x026f, 0x0001, 0x0272, 0x0001, 0x0275,
+        0x0001, 0x01a1, 0x0001, 0x01a3, 0x0001, 0x01a5, 0x0001, 0x0280,
+        0x0001, 0x01a8, 0x0001, 0x0283, 0x0001, 0x01ad, 0x0001, 0x0288,
+        0x0001, 0x01b0, 0x0001, 0x028a, 0x0001, 0x028b, 0x0001, 0x01b4,
+        0x0001, 0x01b6, 0x0001, 0x0292, 0x0001, 0x01b9, 0x0001, 0x01bd,
+        0x0001, 0x01c6, 0x0001, 0x01c9, 0x0001, 0x01cc, 0x0001, 0x01ce,
+        0x0001, 0x01d0, 0x0001, 0x01d2, 0x0001, 0x01d4, 0x0001, 0x01d6,
+        0x0001, 0x01d8, 0x0001, 0x01da, 0x0001, 0x01dc, 0x0001, 0x01df,
+        0x0001, 0x01e1, 0x0001, 0x01e3, 0x0001, 0x01e5, 0x0001, 0x01e7,
+        0x0001, 0x01e9, 0x0001, 0x01eb, 0x0001, 0x01ed, 0x0001, 0x01ef,
+        0x0002, 0x006a, 0x030c, 0x0001, 0x01f3, 0x0001, 0x01f5, 0x0001,
+        0x0195, 0x0001, 0x01bf, 0x0001, 0x01f9, 0x0001, 0x01fb, 0x0001,
+        0x01fd, 0x0001, 0x01ff, 0x0001, 0x0201, 0x0001, 0x0203, 0x0001,
+        0x0205, 0x0001, 0x0207, 0x0001, 0x0209, 0x0001, 0x020b, 0x0001,
+        0x020d, 0x0001, 0x020f, 0x0001, 0x0211, 0x0001, 0x0213, 0x0001,
+        0x0215, 0x0001, 0x0217, 0x0001, 0x0219, 0x0001, 0x021b, 0x0001,
+        0x021d, 0x0001, 0x021f, 0x0001, 0x019e, 0x0001, 0x0223, 0x0001,
+        0x0225, 0x0001, 0x0227, 0x0001, 0x0229, 0x0001, 0x022b, 0x0001,
+        0x022d, 0x0001, 0x022f, 0x0001, 0x0231, 0x0001, 0x0233, 0x0001,
+        0x2c65, 0x0001, 0x023c, 0x0001, 0x019a, 0x0001, 0x2c66, 0x0001,
+        0x0242, 0x0001, 0x0180, 0x0001, 0x0289, 0x0001, 0x028c, 0x0001,
+        0x0247, 0x0001, 0x0249, 0x0001, 0x024b, 0x0001, 0x024d, 0x0001,
+        0x024f, 0x0001, 0x03b9, 0x0001, 0x0371, 0x0001, 0x0373, 0x0001,
+        0x0377, 0x0001, 0x03f3, 0x0001, 0x03ac, 0x0001, 0x03ad, 0x0001,
+        0x03ae, 0x0001, 0x03af, 0x0001, 0x03cc, 0x0001, 0x03cd, 0x0001,
+        0x03ce, 0x0003, 0x03b9, 0x0308, 0x0301, 0x0001, 0x03b1, 0x0001,
+        0x03b2, 0x0001, 0x03b3, 0x0001, 0x03b4, 0x0001, 0x03b5, 0x0001,
+        0x03b6, 0x0001, 0x03b7, 0x0001, 0x03b8, 0x0001, 0x03ba, 0x0001,
+        0x03bb, 0x0001, 0x03bd, 0x0001, 0x03be, 0x0001, 0x03bf, 0x0001,
+        0x03c0, 0x0001, 0x03c1, 0x0001, 0x03c3, 0x0001, 0x03c4, 0x0001,
+        0x03c5, 0x0001, 0x03c6, 0x0001, 0x03c7, 0x0001, 0x03c8, 0x0001,
+        0x03c9, 0x0001, 0x03ca, 0x0001, 0x03cb, 0x0003, 0x03c5, 0x0308,
+        0x0301, 0x0001, 0x03d7, 0x0001, 0x03d9, 0x0001, 0x03db, 0x0001,
+        0x03dd, 0x0001, 0x03df, 0x0001, 0x03e1, 0x0001, 0x03e3, 0x0001,
+        0x03e5, 0x0001, 0x03e7, 0x0001, 0x03e9, 0x0001, 0x03eb, 0x0001,
+        0x03ed, 0x0001, 0x03ef, 0x0001, 0x03f8, 0x0001, 0x03f2, 0x0001,
+        0x03fb, 0x0001, 0x037b, 0x0001, 0x037c, 0x0001, 0x037d, 0x0001,
+        0x0450, 0x0001, 0x0451, 0x0001, 0x0452, 0x0001, 0x0453, 0x0001,
+        0x0454, 0x0001, 0x0455, 0x0001, 0x0456, 0x0001, 0x0457, 0x0001,
+        0x0458, 0x0001, 0x0459, 0x0001, 0x045a, 0x0001, 0x045b, 0x0001,
+        0x045c, 0x0001, 0x045d, 0x0001, 0x045e, 0x0001, 0x045f, 0x0001,
+        0x0430, 0x0001, 0x0431, 0x0001, 0x0432, 0x0001, 0x0433, 0x0001,
+        0x0434, 0x0001, 0x0435, 0x0001, 0x0436, 0x0001, 0x0437, 0x0001,
+        0x0438, 0x0001, 0x0439, 0x0001, 0x043a, 0x0001, 0x043b, 0x0001,
+        0x043c, 0x0001, 0x043d, 0x0001, 0x043e, 0x0001, 0x043f, 0x0001,
+        0x0440, 0x0001, 0x0441, 0x0001, 0x0442, 0x0001, 0x0443, 0x0001,
+        0x0444, 0x0001, 0x0445, 0x0001, 0x0446, 0x0001, 0x0447, 0x0001,
+        0x0448, 0x0001, 0x0449, 0x0001, 0x044a, 0x0001, 0x044b, 0x0001,
+        0x044c, 0x0001, 0x044d, 0x0001, 0x044e, 0x0001, 0x044f, 0x0001,
+        0x0461, 0x0001, 0x0463, 0x0001, 0x0465, 0x0001, 0x0467, 0x0001,
+        0x0469, 0x0001, 0x046b, 0x0001, 0x046d, 0x0001, 0x046f, 0x0001,
+        0x0471, 0x0001, 0x0473, 0x0001, 0x0475, 0x0001, 0x0477, 0x0001,
+        0x0479, 0x0001, 0x047b, 0x0001, 0x047d, 0x0001, 0x047f, 0x0001,
+        0x0481, 0x0001, 0x048b, 0x0001, 0x048d, 0x0001, 0x048f, 0x0001,
+        0x0491, 0x0001, 0x0493, 0x0001, 0x0495, 0x0001, 0x0497, 0x0001,
+        0x0499, 0x0001, 0x049b, 0x0001, 0x049d, 0x0001, 0x049f, 0x0001,
+        0x04a1, 0x0001, 0x04a3, 0x0001, 0x04a5, 0x0001, 0x04a7, 0x0001,
+        0x04a9, 0x0001, 0x04ab, 0x0001, 0x04ad, 0x0001, 0x04af, 0x0001,
+        0x04b1, 0x0001, 0x04b3, 0x0001, 0x04b5, 0x0001, 0x04b7, 0x0001,
+        0x04b9, 0x0001, 0x04bb, 0x0001, 0x04bd, 0x0001, 0x04bf, 0x0001,
+        0x04cf, 0x0001, 0x04c2, 0x0001, 0x04c4, 0x0001, 0x04c6, 0x0001,
+        0x04c8, 0x0001, 0x04ca, 0x0001, 0x04cc, 0x0001, 0x04ce, 0x0001,
+        0x04d1, 0x0001, 0x04d3, 0x0001, 0x04d5, 0x0001, 0x04d7, 0x0001,
+        0x04d9, 0x0001, 0x04db, 0x0001, 0x04dd, 0x0001, 0x04df, 0x0001,
+        0x04e1, 0x0001, 0x04e3, 0x0001, 0x04e5, 0x0001, 0x04e7, 0x0001,
+        0x04e9, 0x0001, 0x04eb, 0x0001, 0x04ed, 0x0001, 0x04ef, 0x0001,
+        0x04f1, 0x0001, 0x04f3, 0x0001, 0x04f5, 0x0001, 0x04f7, 0x0001,
+        0x04f9, 0x0001, 0x04fb, 0x0001, 0x04fd, 0x0001, 0x04ff, 0x0001,
+        0x0501, 0x0001, 0x0503, 0x0001, 0x0505, 0x0001, 0x0507, 0x0001,
+        0x0509, 0x0001, 0x050b, 0x0001, 0x050d, 0x0001, 0x050f, 0x0001,
+        0x0511, 0x0001, 0x0513, 0x0001, 0x0515, 0x0001, 0x0517, 0x0001,
+        0x0519, 0x0001, 0x051b, 0x0001, 0x051d, 0x0001, 0x051f, 0x0001,
+        0x0521, 0x0001, 0x0523, 0x0001, 0x0525, 0x0001, 0x0527, 0x0001,
+        0x0529, 0x0001, 0x052b, 0x0001, 0x052d, 0x0001, 0x052f, 0x0001,
+        0x0561, 0x0001, 0x0562, 0x0001, 0x0563, 0x0001, 0x0564, 0x0001,
+        0x0565, 0x0001, 0x0566, 0x0001, 0x0567, 0x0001, 0x0568, 0x0001,
+        0x0569, 0x0001, 0x056a, 0x0001, 0x056b, 0x0001, 0x056c, 0x0001,
+        0x056d, 0x0001, 0x056e, 0x0001, 0x056f, 0x0001, 0x0570, 0x0001,
+        0x0571, 0x0001, 0x0572, 0x0001, 0x0573, 0x0001, 0x0574, 0x0001,
+        0x0575, 0x0001, 0x0576, 0x0001, 0x0577, 0x0001, 0x0578, 0x0001,
+        0x0579, 0x0001, 0x057a, 0x0001, 0x057b, 0x0001, 0x057c, 0x0001,
+        0x057d, 0x0001, 0x057e, 0x0001, 0x057f, 0x0001, 0x0580, 0x0001,
+        0x0581, 0x0001, 0x0582, 0x0001, 0x0583, 0x0001, 0x0584, 0x0001,
+        0x0585, 0x0001, 0x0586, 0x0002, 0x0565, 0x0582, 0x0001, 0x2d00,
+        0x0001, 0x2d01, 0x0001, 0x2d02, 0x0001, 0x2d03, 0x0001, 0x2d04,
+        0x0001, 0x2d05, 0x0001, 0x2d06, 0x0001, 0x2d07, 0x0001, 0x2d08,
+        0x0001, 0x2d09, 0x0001, 0x2d0a, 0x0001, 0x2d0b, 0x0001, 0x2d0c,
+        0x0001, 0x2d0d, 0x0001, 0x2d0e, 0x0001, 0x2d0f, 0x0001, 0x2d10,
+        0x0001, 0x2d11, 0x0001, 0x2d12, 0x0001, 0x2d13, 0x0001, 0x2d14,
+        0x0001, 0x2d15, 0x0001, 0x2d16, 0x0001, 0x2d17, 0x0001, 0x2d18,
+        0x0001, 0x2d19, 0x0001, 0x2d1a, 0x0001, 0x2d1b, 0x0001, 0x2d1c,
+        0x0001, 0x2d1d, 0x0001, 0x2d1e, 0x0001, 0x2d1f, 0x0001, 0x2d20,
+        0x0001, 0x2d21, 0x0001, 0x2d22, 0x0001, 0x2d23, 0x0001, 0x2d24,
+        0x0001, 0x2d25, 0x0001, 0x2d27, 0x0001, 0x2d2d, 0x0001, 0x13f0,
+        0x0001, 0x13f1, 0x0001, 0x13f2, 0x0001, 0x13f3, 0x0001, 0x13f4,
+        0x0001, 0x13f5, 0x0001, 0xa64b, 0x0001, 0x10d0, 0x0001, 0x10d1,
+        0x0001, 0x10d2, 0x0001, 0x10d3, 0x0001, 0x10d4, 0x0001, 0x10d5,
+        0x0001, 0x10d6, 0x0001, 0x10d7, 0x0001, 0x10d8, 0x0001, 0x10d9,
+        0x0001, 0x10da, 0x0001, 0x10db, 0x0001, 0x10dc, 0x0001, 0x10dd,
+        0x0001, 0x10de, 0x0001, 0x10df, 0x0001, 0x10e0, 0x0001, 0x10e1,
+        0x0001, 0x10e2, 0x0001, 0x10e3, 0x0001, 0x10e4, 0x0001, 0x10e5,
+        0x0001, 0x10e6, 0x0001, 0x10e7, 0x0001, 0x10e8, 0x0001, 0x10e9,
+        0x0001, 0x10ea, 0x0001, 0x10eb, 0x0001, 0x10ec, 0x0001, 0x10ed,
+        0x0001, 0x10ee, 0x0001, 0x10ef, 0x0001, 0x10f0, 0x0001, 0x10f1,
+        0x0001, 0x10f2, 0x0001, 0x10f3, 0x0001, 0x10f4, 0x0001, 0x10f5,
+        0x0001, 0x10f6, 0x0001, 0x10f7, 0x0001, 0x10f8, 0x0001, 0x10f9,
+        0x0001, 0x10fa, 0x0001, 0x10fd, 0x0001, 0x10fe, 0x0001, 0x10ff,
+        0x0001, 0x1e01, 0x0001, 0x1e03, 0x0001, 0x1e05, 0x0001, 0x1e07,
+        0x0001, 0x1e09, 0x0001, 0x1e0b, 0x0001, 0x1e0d, 0x0001, 0x1e0f,
+        0x0001, 0x1e11, 0x0001, 0x1e13, 0x0001, 0x1e15, 0x0001, 0x1e17,
+        0x0001, 0x1e19, 0x0001, 0x1e1b, 0x0001, 0x1e1d, 0x0001, 0x1e1f,
+        0x0001, 0x1e21, 0x0001, 0x1e23, 0x0001, 0x1e25, 0x0001, 0x1e27,
+        0x0001, 0x1e29, 0x0001, 0x1e2b, 0x0001, 0x1e2d, 0x0001, 0x1e2f,
+        0x0001, 0x1e31, 0x0001, 0x1e33, 0x0001, 0x1e35, 0x0001, 0x1e37,
+        0x0001, 0x1e39, 0x0001, 0x1e3b, 0x0001, 0x1e3d, 0x0001, 0x1e3f,
+        0x0001, 0x1e41, 0x0001, 0x1e43, 0x0001, 0x1e45, 0x0001, 0x1e47,
+        0x0001, 0x1e49, 0x0001, 0x1e4b, 0x0001, 0x1e4d, 0x0001, 0x1e4f,
+        0x0001, 0x1e51, 0x0001, 0x1e53, 0x0001, 0x1e55, 0x0001, 0x1e57,
+        0x0001, 0x1e59, 0x0001, 0x1e5b, 0x0001, 0x1e5d, 0x0001, 0x1e5f,
+        0x0001, 0x1e61, 0x0001, 0x1e63, 0x0001, 0x1e65, 0x0001, 0x1e67,
+        0x0001, 0x1e69, 0x0001, 0x1e6b, 0x0001, 0x1e6d, 0x0001, 0x1e6f,
+        0x0001, 0x1e71, 0x0001, 0x1e73, 0x0001, 0x1e75, 0x0001, 0x1e77,
+        0x0001, 0x1e79, 0x0001, 0x1e7b, 0x0001, 0x1e7d, 0x0001, 0x1e7f,
+        0x0001, 0x1e81, 0x0001, 0x1e83, 0x0001, 0x1e85, 0x0001, 0x1e87,
+        0x0001, 0x1e89, 0x0001, 0x1e8b, 0x0001, 0x1e8d, 0x0001, 0x1e8f,
+        0x0001, 0x1e91, 0x0001, 0x1e93, 0x0001, 0x1e95, 0x0002, 0x0068,
+        0x0331, 0x0002, 0x0074, 0x0308, 0x0002, 0x0077, 0x030a, 0x0002,
+        0x0079, 0x030a, 0x0002, 0x0061, 0x02be, 0x0001, 0x1ea1, 0x0001,
+        0x1ea3, 0x0001, 0x1ea5, 0x0001, 0x1ea7, 0x0001, 0x1ea9, 0x0001,
+        0x1eab, 0x0001, 0x1ead, 0x0001, 0x1eaf, 0x0001, 0x1eb1, 0x0001,
+        0x1eb3, 0x0001, 0x1eb5, 0x0001, 0x1eb7, 0x0001, 0x1eb9, 0x0001,
+        0x1ebb, 0x0001, 0x1ebd, 0x0001, 0x1ebf, 0x0001, 0x1ec1, 0x0001,
+        0x1ec3, 0x0001, 0x1ec5, 0x0001, 0x1ec7, 0x0001, 0x1ec9, 0x0001,
+        0x1ecb, 0x0001, 0x1ecd, 0x0001, 0x1ecf, 0x0001, 0x1ed1, 0x0001,
+        0x1ed3, 0x0001, 0x1ed5, 0x0001, 0x1ed7, 0x0001, 0x1ed9, 0x0001,
+        0x1edb, 0x0001, 0x1edd, 0x0001, 0x1edf, 0x0001, 0x1ee1, 0x0001,
+        0x1ee3, 0x0001, 0x1ee5, 0x0001, 0x1ee7, 0x0001, 0x1ee9, 0x0001,
+        0x1eeb, 0x0001, 0x1eed, 0x0001, 0x1eef, 0x0001, 0x1ef1, 0x0001,
+        0x1ef3, 0x0001, 0x1ef5, 0x0001, 0x1ef7, 0x0001, 0x1ef9, 0x0001,
+        0x1efb, 0x0001, 0x1efd, 0x0001, 0x1eff, 0x0001, 0x1f00, 0x0001,
+        0x1f01, 0x0001, 0x1f02, 0x0001, 0x1f03, 0x0001, 0x1f04, 0x0001,
+        0x1f05, 0x0001, 0x1f06, 0x0001, 0x1f07, 0x0001, 0x1f10, 0x0001,
+        0x1f11, 0x0001, 0x1f12, 0x0001, 0x1f13, 0x0001, 0x1f14, 0x0001,
+        0x1f15, 0x0001, 0x1f20, 0x0001, 0x1f21, 0x0001, 0x1f22, 0x0001,
+        0x1f23, 0x0001, 0x1f24, 0x0001, 0x1f25, 0x0001, 0x1f26, 0x0001,
+        0x1f27, 0x0001, 0x1f30, 0x0001, 0x1f31, 0x0001, 0x1f32, 0x0001,
+        0x1f33, 0x0001, 0x1f34, 0x0001, 0x1f35, 0x0001, 0x1f36, 0x0001,
+        0x1f37, 0x0001, 0x1f40, 0x0001, 0x1f41, 0x0001, 0x1f42, 0x0001,
+        0x1f43, 0x0001, 0x1f44, 0x0001, 0x1f45, 0x0002, 0x03c5, 0x0313,
+        0x0003, 0x03c5, 0x0313, 0x0300, 0x0003, 0x03c5, 0x0313, 0x0301,
+        0x0003, 0x03c5, 0x0313, 0x0342, 0x0001, 0x1f51, 0x0001, 0x1f53,
+        0x0001, 0x1f55, 0x0001, 0x1f57, 0x0001, 0x1f60, 0x0001, 0x1f61,
+        0x0001, 0x1f62, 0x0001, 0x1f63, 0x0001, 0x1f64, 0x0001, 0x1f65,
+        0x0001, 0x1f66, 0x0001, 0x1f67, 0x0002, 0x1f00, 0x03b9, 0x0002,
+        0x1f01, 0x03b9, 0x0002, 0x1f02, 0x03b9, 0x0002, 0x1f03, 0x03b9,
+        0x0002, 0x1f04, 0x03b9, 0x0002, 0x1f05, 0x03b9, 0x0002, 0x1f06,
+        0x03b9, 0x0002, 0x1f07, 0x03b9, 0x0002, 0x1f20, 0x03b9, 0x0002,
+        0x1f21, 0x03b9, 0x0002, 0x1f22, 0x03b9, 0x0002, 0x1f23, 0x03b9,
+        0x0002, 0x1f24, 0x03b9, 0x0002, 0x1f25, 0x03b9, 0x0002, 0x1f26,
+        0x03b9, 0x0002, 0x1f27, 0x03b9, 0x0002, 0x1f60, 0x03b9, 0x0002,
+        0x1f61, 0x03b9, 0x0002, 0x1f62, 0x03b9, 0x0002, 0x1f63, 0x03b9,
+        0x0002, 0x1f64, 0x03b9, 0x0002, 0x1f65, 0x03b9, 0x0002, 0x1f66,
+        0x03b9, 0x0002, 0x1f67, 0x03b9, 0x0002, 0x1f70, 0x03b9, 0x0002,
+        0x03b1, 0x03b9, 0x0002, 0x03ac, 0x03b9, 0x0002, 0x03b1, 0x0342,
+        0x0003, 0x03b1, 0x0342, 0x03b9, 0x0001, 0x1fb0, 0x0001, 0x1fb1,
+        0x0001, 0x1f70, 0x0001, 0x1f71, 0x0002, 0x1f74, 0x03b9, 0x0002,
+        0x03b7, 0x03b9, 0x0002, 0x03ae, 0x03b9, 0x0002, 0x03b7, 0x0342,
+        0x0003, 0x03b7, 0x0342, 0x03b9, 0x0001, 0x1f72, 0x0001, 0x1f73,
+        0x0001, 0x1f74, 0x0001, 0x1f75, 0x0003, 0x03b9, 0x0308, 0x0300,
+        0x0002, 0x03b9, 0x0342, 0x0003, 0x03b9, 0x0308, 0x0342, 0x0001,
+        0x1fd0, 0x0001, 0x1fd1, 0x0001, 0x1f76, 0x0001, 0x1f77, 0x0003,
+        0x03c5, 0x0308, 0x0300, 0x0002, 0x03c1, 0x0313, 0x0002, 0x03c5,
+        0x0342, 0x0003, 0x03c5, 0x0308, 0x0342, 0x0001, 0x1fe0, 0x0001,
+        0x1fe1, 0x0001, 0x1f7a, 0x0001, 0x1f7b, 0x0001, 0x1fe5, 0x0002,
+        0x1f7c, 0x03b9, 0x0002, 0x03c9, 0x03b9, 0x0002, 0x03ce, 0x03b9,
+        0x0002, 0x03c9, 0x0342, 0x0003, 0x03c9, 0x0342, 0x03b9, 0x0001,
+        0x1f78, 0x0001, 0x1f79, 0x0001, 0x1f7c, 0x0001, 0x1f7d, 0x0001,
+        0x214e, 0x0001, 0x2170, 0x0001, 0x2171, 0x0001, 0x2172, 0x0001,
+        0x2173, 0x0001, 0x2174, 0x0001, 0x2175, 0x0001, 0x2176, 0x0001,
+        0x2177, 0x0001, 0x2178, 0x0001, 0x2179, 0x0001, 0x217a, 0x0001,
+        0x217b, 0x0001, 0x217c, 0x0001, 0x217d, 0x0001, 0x217e, 0x0001,
+        0x217f, 0x0001, 0x2184, 0x0001, 0x24d0, 0x0001, 0x24d1, 0x0001,
+        0x24d2, 0x0001, 0x24d3, 0x0001, 0x24d4, 0x0001, 0x24d5, 0x0001,
+        0x24d6, 0x0001, 0x24d7, 0x0001, 0x24d8, 0x0001, 0x24d9, 0x0001,
+        0x24da, 0x0001, 0x24db, 0x0001, 0x24dc, 0x0001, 0x24dd, 0x0001,
+        0x24de, 0x0001, 0x24df, 0x0001, 0x24e0, 0x0001, 0x24e1, 0x0001,
+        0x24e2, 0x0001, 0x24e3, 0x0001, 0x24e4, 0x0001, 0x24e5, 0x0001,
+        0x24e6, 0x0001, 0x24e7, 0x0001, 0x24e8, 0x0001, 0x24e9, 0x0001,
+        0x2c30, 0x0001, 0x2c31, 0x0001, 0x2c32, 0x0001, 0x2c33, 0x0001,
+        0x2c34, 0x0001, 0x2c35, 0x0001, 0x2c36, 0x0001, 0x2c37, 0x0001,
+        0x2c38, 0x0001, 0x2c39, 0x0001, 0x2c3a, 0x0001, 0x2c3b, 0x0001,
+        0x2c3c, 0x0001, 0x2c3d, 0x0001, 0x2c3e, 0x0001, 0x2c3f, 0x0001,
+        0x2c40, 0x0001, 0x2c41, 0x0001, 0x2c42, 0x0001, 0x2c43, 0x0001,
+        0x2c44, 0x0001, 0x2c45, 0x0001, 0x2c46, 0x0001, 0x2c47, 0x0001,
+        0x2c48, 0x0001, 0x2c49, 0x0001, 0x2c4a, 0x0001, 0x2c4b, 0x0001,
+        0x2c4c, 0x0001, 0x2c4d, 0x0001, 0x2c4e, 0x0001, 0x2c4f, 0x0001,
+        0x2c50, 0x0001, 0x2c51, 0x0001, 0x2c52, 0x0001, 0x2c53, 0x0001,
+        0x2c54, 0x0001, 0x2c55, 0x0001, 0x2c56, 0x0001, 0x2c57, 0x0001,
+        0x2c58, 0x0001, 0x2c59, 0x0001, 0x2c5a, 0x0001, 0x2c5b, 0x0001,
+        0x2c5c, 0x0001, 0x2c5d, 0x0001, 0x2c5e, 0x0001, 0x2c5f, 0x0001,
+        0x2c61, 0x0001, 0x026b, 0x0001, 0x1d7d, 0x0001, 0x027d, 0x0001,
+        0x2c68, 0x0001, 0x2c6a, 0x0001, 0x2c6c, 0x0001, 0x0251, 0x0001,
+        0x0271, 0x0001, 0x0250, 0x0001, 0x0252, 0x0001, 0x2c73, 0x0001,
+        0x2c76, 0x0001, 0x023f, 0x0001, 0x0240, 0x0001, 0x2c81, 0x0001,
+        0x2c83, 0x0001, 0x2c85, 0x0001, 0x2c87, 0x0001, 0x2c89, 0x0001,
+        0x2c8b, 0x0001, 0x2c8d, 0x0001, 0x2c8f, 0x0001, 0x2c91, 0x0001,
+        0x2c93, 0x0001, 0x2c95, 0x0001, 0x2c97, 0x0001, 0x2c99, 0x0001,
+        0x2c9b, 0x0001, 0x2c9d, 0x0001, 0x2c9f, 0x0001, 0x2ca1, 0x0001,
+        0x2ca3, 0x0001, 0x2ca5, 0x0001, 0x2ca7, 0x0001, 0x2ca9, 0x0001,
+        0x2cab, 0x0001, 0x2cad, 0x0001, 0x2caf, 0x0001, 0x2cb1, 0x0001,
+        0x2cb3, 0x0001, 0x2cb5, 0x0001, 0x2cb7, 0x0001, 0x2cb9, 0x0001,
+        0x2cbb, 0x0001, 0x2cbd, 0x0001, 0x2cbf, 0x0001, 0x2cc1, 0x0001,
+        0x2cc3, 0x0001, 0x2cc5, 0x0001, 0x2cc7, 0x0001, 0x2cc9, 0x0001,
+        0x2ccb, 0x0001, 0x2ccd, 0x0001, 0x2ccf, 0x0001, 0x2cd1, 0x0001,
+        0x2cd3, 0x0001, 0x2cd5, 0x0001, 0x2cd7, 0x0001, 0x2cd9, 0x0001,
+        0x2cdb, 0x0001, 0x2cdd, 0x0001, 0x2cdf, 0x0001, 0x2ce1, 0x0001,
+        0x2ce3, 0x0001, 0x2cec, 0x0001, 0x2cee, 0x0001, 0x2cf3, 0x0001,
+        0xa641, 0x0001, 0xa643, 0x0001, 0xa645, 0x0001, 0xa647, 0x0001,
+        0xa649, 0x0001, 0xa64d, 0x0001, 0xa64f, 0x0001, 0xa651, 0x0001,
+        0xa653, 0x0001, 0xa655, 0x0001, 0xa657, 0x0001, 0xa659, 0x0001,
+        0xa65b, 0x0001, 0xa65d, 0x0001, 0xa65f, 0x0001, 0xa661, 0x0001,
+        0xa663, 0x0001, 0xa665, 0x0001, 0xa667, 0x0001, 0xa669, 0x0001,
+        0xa66b, 0x0001, 0xa66d, 0x0001, 0xa681, 0x0001, 0xa683, 0x0001,
+        0xa685, 0x0001, 0xa687, 0x0001, 0xa689, 0x0001, 0xa68b, 0x0001,
+        0xa68d, 0x0001, 0xa68f, 0x0001, 0xa691, 0x0001, 0xa693, 0x0001,
+        0xa695, 0x0001, 0xa697, 0x0001, 0xa699, 0x0001, 0xa69b, 0x0001,
+        0xa723, 0x0001, 0xa725, 0x0001, 0xa727, 0x0001, 0xa729, 0x0001,
+        0xa72b, 0x0001, 0xa72d, 0x0001, 0xa72f, 0x0001, 0xa733, 0x0001,
+        0xa735, 0x0001, 0xa737, 0x0001, 0xa739, 0x0001, 0xa73b, 0x0001,
+        0xa73d, 0x0001, 0xa73f, 0x0001, 0xa741, 0x0001, 0xa743, 0x0001,
+        0xa745, 0x0001, 0xa747, 0x0001, 0xa749, 0x0001, 0xa74b, 0x0001,
+        0xa74d, 0x0001, 0xa74f, 0x0001, 0xa751, 0x0001, 0xa753, 0x0001,
+        0xa755, 0x0001, 0xa757, 0x0001, 0xa759, 0x0001, 0xa75b, 0x0001,
+        0xa75d, 0x0001, 0xa75f, 0x0001, 0xa761, 0x0001, 0xa763, 0x0001,
+        0xa765, 0x0001, 0xa767, 0x0001, 0xa769, 0x0001, 0xa76b, 0x0001,
+        0xa76d, 0x0001, 0xa76f, 0x0001, 0xa77a, 0x0001, 0xa77c, 0x0001,
+        0x1d79, 0x0001, 0xa77f, 0x0001, 0xa781, 0x0001, 0xa783, 0x0001,
+        0xa785, 0x0001, 0xa787, 0x0001, 0xa78c, 0x0001, 0x0265, 0x0001,
+        0xa791, 0x0001, 0xa793, 0x0001, 0xa797, 0x0001, 0xa799, 0x0001,
+        0xa79b, 0x0001, 0xa79d, 0x0001, 0xa79f, 0x0001, 0xa7a1, 0x0001,
+        0xa7a3, 0x0001, 0xa7a5, 0x0001, 0xa7a7, 0x0001, 0xa7a9, 0x0001,
+        0x0266, 0x0001, 0x025c, 0x0001, 0x0261, 0x0001, 0x026c, 0x0001,
+        0x026a, 0x0001, 0x029e, 0x0001, 0x0287, 0x0001, 0x029d, 0x0001,
+        0xab53, 0x0001, 0xa7b5, 0x0001, 0xa7b7, 0x0001, 0xa7b9, 0x0001,
+        0xa7bb, 0x0001, 0xa7bd, 0x0001, 0xa7bf, 0x0001, 0xa7c1, 0x0001,
+        0xa7c3, 0x0001, 0xa794, 0x0001, 0x0282, 0x0001, 0x1d8e, 0x0001,
+        0xa7c8, 0x0001, 0xa7ca, 0x0001, 0xa7d1, 0x0001, 0xa7d7, 0x0001,
+        0xa7d9, 0x0001, 0xa7f6, 0x0001, 0x13a0, 0x0001, 0x13a1, 0x0001,
+        0x13a2, 0x0001, 0x13a3, 0x0001, 0x13a4, 0x0001, 0x13a5, 0x0001,
+        0x13a6, 0x0001, 0x13a7, 0x0001, 0x13a8, 0x0001, 0x13a9, 0x0001,
+        0x13aa, 0x0001, 0x13ab, 0x0001, 0x13ac, 0x0001, 0x13ad, 0x0001,
+        0x13ae, 0x0001, 0x13af, 0x0001, 0x13b0, 0x0001, 0x13b1, 0x0001,
+        0x13b2, 0x0001, 0x13b3, 0x0001, 0x13b4, 0x0001, 0x13b5, 0x0001,
+        0x13b6, 0x0001, 0x13b7, 0x0001, 0x13b8, 0x0001, 0x13b9, 0x0001,
+        0x13ba, 0x0001, 0x13bb, 0x0001, 0x13bc, 0x0001, 0x13bd, 0x0001,
+        0x13be, 0x0001, 0x13bf, 0x0001, 0x13c0, 0x0001, 0x13c1, 0x0001,
+        0x13c2, 0x0001, 0x13c3, 0x0001, 0x13c4, 0x0001, 0x13c5, 0x0001,
+        0x13c6, 0x0001, 0x13c7, 0x0001, 0x13c8, 0x0001, 0x13c9, 0x0001,
+        0x13ca, 0x0001, 0x13cb, 0x0001, 0x13cc, 0x0001, 0x13cd, 0x0001,
+        0x13ce, 0x0001, 0x13cf, 0x0001, 0x13d0, 0x0001, 0x13d1, 0x0001,
+        0x13d2, 0x0001, 0x13d3, 0x0001, 0x13d4, 0x0001, 0x13d5, 0x0001,
+        0x13d6, 0x0001, 0x13d7, 0x0001, 0x13d8, 0x0001, 0x13d9, 0x0001,
+        0x13da, 0x0001, 0x13db, 0x0001, 0x13dc, 0x0001, 0x13dd, 0x0001,
+        0x13de, 0x0001, 0x13df, 0x0001, 0x13e0, 0x0001, 0x13e1, 0x0001,
+        0x13e2, 0x0001, 0x13e3, 0x0001, 0x13e4, 0x0001, 0x13e5, 0x0001,
+        0x13e6, 0x0001, 0x13e7, 0x0001, 0x13e8, 0x0001, 0x13e9, 0x0001,
+        0x13ea, 0x0001, 0x13eb, 0x0001, 0x13ec, 0x0001, 0x13ed, 0x0001,
+        0x13ee, 0x0001, 0x13ef, 0x0002, 0x0066, 0x0066, 0x0002, 0x0066,
+        0x0069, 0x0002, 0x0066, 0x006c, 0x0003, 0x0066, 0x0066, 0x0069,
+        0x0003, 0x0066, 0x0066, 0x006c, 0x0002, 0x0073, 0x0074, 0x0002,
+        0x0574, 0x0576, 0x0002, 0x0574, 0x0565, 0x0002, 0x0574, 0x056b,
+        0x0002, 0x057e, 0x0576, 0x0002, 0x0574, 0x056d, 0x0001, 0xff41,
+        0x0001, 0xff42, 0x0001, 0xff43, 0x0001, 0xff44, 0x0001, 0xff45,
+        0x0001, 0xff46, 0x0001, 0xff47, 0x0001, 0xff48, 0x0001, 0xff49,
+        0x0001, 0xff4a, 0x0001, 0xff4b, 0x0001, 0xff4c, 0x0001, 0xff4d,
+        0x0001, 0xff4e, 0x0001, 0xff4f, 0x0001, 0xff50, 0x0001, 0xff51,
+        0x0001, 0xff52, 0x0001, 0xff53, 0x0001, 0xff54, 0x0001, 0xff55,
+        0x0001, 0xff56, 0x0001, 0xff57, 0x0001, 0xff58, 0x0001, 0xff59,
+        0x0001, 0xff5a, 0x0001, 0x10428, 0x0001, 0x10429, 0x0001, 0x1042a,
+        0x0001, 0x1042b, 0x0001, 0x1042c, 0x0001, 0x1042d, 0x0001, 0x1042e,
+        0x0001, 0x1042f, 0x0001, 0x10430, 0x0001, 0x10431, 0x0001, 0x10432,
+        0x0001, 0x10433, 0x0001, 0x10434, 0x0001, 0x10435, 0x0001, 0x10436,
+        0x0001, 0x10437, 0x0001, 0x10438, 0x0001, 0x10439, 0x0001, 0x1043a,
+        0x0001, 0x1043b, 0x0001, 0x1043c, 0x0001, 0x1043d, 0x0001, 0x1043e,
+        0x0001, 0x1043f, 0x0001, 0x10440, 0x0001, 0x10441, 0x0001, 0x10442,
+        0x0001, 0x10443, 0x0001, 0x10444, 0x0001, 0x10445, 0x0001, 0x10446,
+        0x0001, 0x10447, 0x0001, 0x10448, 0x0001, 0x10449, 0x0001, 0x1044a,
+        0x0001, 0x1044b, 0x0001, 0x1044c, 0x0001, 0x1044d, 0x0001, 0x1044e,
+        0x0001, 0x1044f, 0x0001, 0x104d8, 0x0001, 0x104d9, 0x0001, 0x104da,
+        0x0001, 0x104db, 0x0001, 0x104dc, 0x0001, 0x104dd, 0x0001, 0x104de,
+        0x0001, 0x104df, 0x0001, 0x104e0, 0x0001, 0x104e1, 0x0001, 0x104e2,
+        0x0001, 0x104e3, 0x0001, 0x104e4, 0x0001, 0x104e5, 0x0001, 0x104e6,
+        0x0001, 0x104e7, 0x0001, 0x104e8, 0x0001, 0x104e9, 0x0001, 0x104ea,
+        0x0001, 0x104eb, 0x0001, 0x104ec, 0x0001, 0x104ed, 0x0001, 0x104ee,
+        0x0001, 0x104ef, 0x0001, 0x104f0, 0x0001, 0x104f1, 0x0001, 0x104f2,
+        0x0001, 0x104f3, 0x0001, 0x104f4, 0x0001, 0x104f5, 0x0001, 0x104f6,
+        0x0001, 0x104f7, 0x0001, 0x104f8, 0x0001, 0x104f9, 0x0001, 0x104fa,
+        0x0001, 0x104fb, 0x0001, 0x10597, 0x0001, 0x10598, 0x0001, 0x10599,
+        0x0001, 0x1059a, 0x0001, 0x1059b, 0x0001, 0x1059c, 0x0001, 0x1059d,
+        0x0001, 0x1059e, 0x0001, 0x1059f, 0x0001, 0x105a0, 0x0001, 0x105a1,
+        0x0001, 0x105a3, 0x0001, 0x105a4, 0x0001, 0x105a5, 0x0001, 0x105a6,
+        0x0001, 0x105a7, 0x0001, 0x105a8, 0x0001, 0x105a9, 0x0001, 0x105aa,
+        0x0001, 0x105ab, 0x0001, 0x105ac, 0x0001, 0x105ad, 0x0001, 0x105ae,
+        0x0001, 0x105af, 0x0001, 0x105b0, 0x0001, 0x105b1, 0x0001, 0x105b3,
+        0x0001, 0x105b4, 0x0001, 0x105b5, 0x0001, 0x105b6, 0x0001, 0x105b7,
+        0x0001, 0x105b8, 0x0001, 0x105b9, 0x0001, 0x105bb, 0x0001, 0x105bc,
+        0x0001, 0x10cc0, 0x0001, 0x10cc1, 0x0001, 0x10cc2, 0x0001, 0x10cc3,
+        0x0001, 0x10cc4, 0x0001, 0x10cc5, 0x0001, 0x10cc6, 0x0001, 0x10cc7,
+        0x0001, 0x10cc8, 0x0001, 0x10cc9, 0x0001, 0x10cca, 0x0001, 0x10ccb,
+        0x0001, 0x10ccc, 0x0001, 0x10ccd, 0x0001, 0x10cce, 0x0001, 0x10ccf,
+        0x0001, 0x10cd0, 0x0001, 0x10cd1, 0x0001, 0x10cd2, 0x0001, 0x10cd3,
+        0x0001, 0x10cd4, 0x0001, 0x10cd5, 0x0001, 0x10cd6, 0x0001, 0x10cd7,
+        0x0001, 0x10cd8, 0x0001, 0x10cd9, 0x0001, 0x10cda, 0x0001, 0x10cdb,
+        0x0001, 0x10cdc, 0x0001, 0x10cdd, 0x0001, 0x10cde, 0x0001, 0x10cdf,
+        0x0001, 0x10ce0, 0x0001, 0x10ce1, 0x0001, 0x10ce2, 0x0001, 0x10ce3,
+        0x0001, 0x10ce4, 0x0001, 0x10ce5, 0x0001, 0x10ce6, 0x0001, 0x10ce7,
+        0x0001, 0x10ce8, 0x0001, 0x10ce9, 0x0001, 0x10cea, 0x0001, 0x10ceb,
+        0x0001, 0x10cec, 0x0001, 0x10ced, 0x0001, 0x10cee, 0x0001, 0x10cef,
+        0x0001, 0x10cf0, 0x0001, 0x10cf1, 0x0001, 0x10cf2, 0x0001, 0x118c0,
+        0x0001, 0x118c1, 0x0001, 0x118c2, 0x0001, 0x118c3, 0x0001, 0x118c4,
+        0x0001, 0x118c5, 0x0001, 0x118c6, 0x0001, 0x118c7, 0x0001, 0x118c8,
+        0x0001, 0x118c9, 0x0001, 0x118ca, 0x0001, 0x118cb, 0x0001, 0x118cc,
+        0x0001, 0x118cd, 0x0001, 0x118ce, 0x0001, 0x118cf, 0x0001, 0x118d0,
+        0x0001, 0x118d1, 0x0001, 0x118d2, 0x0001, 0x118d3, 0x0001, 0x118d4,
+        0x0001, 0x118d5, 0x0001, 0x118d6, 0x0001, 0x118d7, 0x0001, 0x118d8,
+        0x0001, 0x118d9, 0x0001, 0x118da, 0x0001, 0x118db, 0x0001, 0x118dc,
+        0x0001, 0x118dd, 0x0001, 0x118de, 0x0001, 0x118df, 0x0001, 0x16e60,
+        0x0001, 0x16e61, 0x0001, 0x16e62, 0x0001, 0x16e63, 0x0001, 0x16e64,
+        0x0001, 0x16e65, 0x0001, 0x16e66, 0x0001, 0x16e67, 0x0001, 0x16e68,
+        0x0001, 0x16e69, 0x0001, 0x16e6a, 0x0001, 0x16e6b, 0x0001, 0x16e6c,
+        0x0001, 0x16e6d, 0x0001, 0x16e6e, 0x0001, 0x16e6f, 0x0001, 0x16e70,
+        0x0001, 0x16e71, 0x0001, 0x16e72, 0x0001, 0x16e73, 0x0001, 0x16e74,
+        0x0001, 0x16e75, 0x0001, 0x16e76, 0x0001, 0x16e77, 0x0001, 0x16e78,
+        0x0001, 0x16e79, 0x0001, 0x16e7a, 0x0001, 0x16e7b, 0x0001, 0x16e7c,
+        0x0001, 0x16e7d, 0x0001, 0x16e7e, 0x0001, 0x16e7f, 0x0001, 0x1e922,
+        0x0001, 0x1e923, 0x0001, 0x1e924, 0x0001, 0x1e925, 0x0001, 0x1e926,
+        0x0001, 0x1e927, 0x0001, 0x1e928, 0x0001, 0x1e929, 0x0001, 0x1e92a,
+        0x0001, 0x1e92b, 0x0001, 0x1e92c, 0x0001, 0x1e92d, 0x0001, 0x1e92e,
+        0x0001, 0x1e92f, 0x0001, 0x1e930, 0x0001, 0x1e931, 0x0001, 0x1e932,
+        0x0001, 0x1e933, 0x0001, 0x1e934, 0x0001, 0x1e935, 0x0001, 0x1e936,
+        0x0001, 0x1e937, 0x0001, 0x1e938, 0x0001, 0x1e939, 0x0001, 0x1e93a,
+        0x0001, 0x1e93b, 0x0001, 0x1e93c, 0x0001, 0x1e93d, 0x0001, 0x1e93e,
+        0x0001, 0x1e93f, 0x0001, 0x1e940, 0x0001, 0x1e941, 0x0001, 0x1e942,
+        0x0001, 0x1e943,
+};
+
+/// 一级表，按 cp >> 10 索引
+static const uint8_t CaseFoldStage1[1088] = {
+        0, 1, 2, 2, 3, 2, 2, 4, 5, 6, 2, 7, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 8, 9, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 10, 11,
+        2, 12, 2, 13, 2, 2, 14, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 15, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 16, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+};
+
+/// 二级表，每块 64 项，按 (cp >> 4) & 63 索引
+static const uint16_t CaseFoldStage2[1088] = {
+        0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 4, 5, 0, 0,
+        6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21,
+        22, 23, 24, 25, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 27, 0, 0, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+        37, 38, 39, 0, 0, 0, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49,
+        50, 51, 52, 53, 54, 55, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 58, 59, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60,
+        0, 0, 0, 0, 0, 0, 0, 0, 61, 62, 63, 64, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+        81, 82, 83, 84, 85, 86, 87, 0, 88, 89, 90, 91, 92, 93, 94, 95,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 96, 97, 0, 0, 98, 0, 99, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 101, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        102, 103, 104, 0, 0, 0, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 115, 116, 117, 0, 118, 119, 0, 0, 0, 0, 0, 0,
+        0, 0, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 0, 132,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 133, 134, 135, 136, 137, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        138, 139, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 140, 141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        142, 143, 144, 0, 0, 0, 0, 0, 0, 0, 0, 145, 146, 147, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 148, 149, 150, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 151, 152, 153, 154, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 155, 156, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 157, 158, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        159, 160, 161, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/// 三级表，每块 16 个码点，值为 CaseFoldPool 中的位置，0 表示不变
+static const uint16_t CaseFoldStage3[2592] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29,
+        31, 33, 35, 37, 39, 41, 43, 45, 47, 49, 51, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        55, 57, 59, 61, 63, 65, 67, 69, 71, 73, 75, 77, 79, 81, 83, 85,
+        87, 89, 91, 93, 95, 97, 99, 0, 101, 103, 105, 107, 109, 111, 113, 115,
+        118, 0, 120, 0, 122, 0, 124, 0, 126, 0, 128, 0, 130, 0, 132, 0,
+        134, 0, 136, 0, 138, 0, 140, 0, 142, 0, 144, 0, 146, 0, 148, 0,
+        150, 0, 152, 0, 154, 0, 156, 0, 158, 0, 160, 0, 162, 0, 164, 0,
+        166, 0, 169, 0, 171, 0, 173, 0, 0, 175, 0, 177, 0, 179, 0, 181,
+        0, 183, 0, 185, 0, 187, 0, 189, 0, 191, 194, 0, 196, 0, 198, 0,
+        200, 0, 202, 0, 204, 0, 206, 0, 208, 0, 210, 0, 212, 0, 214, 0,
+        216, 0, 218, 0, 220, 0, 222, 0, 224, 0, 226, 0, 228, 0, 230, 0,
+        232, 0, 234, 0, 236, 0, 238, 0, 240, 242, 0, 244, 0, 246, 0, 37,
+        0, 248, 250, 0, 252, 0, 254, 256, 0, 258, 260, 262, 0, 0, 264, 266,
+        268, 270, 0, 272, 274, 0, 276, 278, 280, 0, 0, 0, 282, 284, 0, 286,
+        288, 0, 290, 0, 292, 0, 294, 296, 0, 298, 0, 0, 300, 0, 302, 304,
+        0, 306, 308, 310, 0, 312, 0, 314, 316, 0, 0, 0, 318, 0, 0, 0,
+        0, 0, 0, 0, 320, 320, 0, 322, 322, 0, 324, 324, 0, 326, 0, 328,
+        0, 330, 0, 332, 0, 334, 0, 336, 0, 338, 0, 340, 0, 0, 342, 0,
+        344, 0, 346, 0, 348, 0, 350, 0, 352, 0, 354, 0, 356, 0, 358, 0,
+        360, 363, 363, 0, 365, 0, 367, 369, 371, 0, 373, 0, 375, 0, 377, 0,
+        379, 0, 381, 0, 383, 0, 385, 0, 387, 0, 389, 0, 391, 0, 393, 0,
+        395, 0, 397, 0, 399, 0, 401, 0, 403, 0, 405, 0, 407, 0, 409, 0,
+        411, 0, 413, 0, 415, 0, 417, 0, 419, 0, 421, 0, 423, 0, 425, 0,
+        427, 0, 429, 0, 0, 0, 0, 0, 0, 0, 431, 433, 0, 435, 437, 0,
+        0, 439, 0, 441, 443, 445, 447, 0, 449, 0, 451, 0, 453, 0, 455, 0,
+        0, 0, 0, 0, 0, 457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        459, 0, 461, 0, 0, 0, 463, 0, 0, 0, 0, 0, 0, 0, 0, 465,
+        0, 0, 0, 0, 0, 0, 467, 0, 469, 471, 473, 0, 475, 0, 477, 479,
+        481, 485, 487, 489, 491, 493, 495, 497, 499, 457, 501, 503, 53, 505, 507, 509,
+        511, 513, 0, 515, 517, 519, 521, 523, 525, 527, 529, 531, 0, 0, 0, 0,
+        533, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 515, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 537,
+        487, 499, 0, 0, 0, 521, 511, 0, 539, 0, 541, 0, 543, 0, 545, 0,
+        547, 0, 549, 0, 551, 0, 553, 0, 555, 0, 557, 0, 559, 0, 561, 0,
+        501, 513, 0, 0, 499, 493, 0, 563, 0, 565, 567, 0, 0, 569, 571, 573,
+        575, 577, 579, 581, 583, 585, 587, 589, 591, 593, 595, 597, 599, 601, 603, 605,
+        607, 609, 611, 613, 615, 617, 619, 621, 623, 625, 627, 629, 631, 633, 635, 637,
+        639, 641, 643, 645, 647, 649, 651, 653, 655, 657, 659, 661, 663, 665, 667, 669,
+        671, 0, 673, 0, 675, 0, 677, 0, 679, 0, 681, 0, 683, 0, 685, 0,
+        687, 0, 689, 0, 691, 0, 693, 0, 695, 0, 697, 0, 699, 0, 701, 0,
+        703, 0, 0, 0, 0, 0, 0, 0, 0, 0, 705, 0, 707, 0, 709, 0,
+        711, 0, 713, 0, 715, 0, 717, 0, 719, 0, 721, 0, 723, 0, 725, 0,
+        727, 0, 729, 0, 731, 0, 733, 0, 735, 0, 737, 0, 739, 0, 741, 0,
+        743, 0, 745, 0, 747, 0, 749, 0, 751, 0, 753, 0, 755, 0, 757, 0,
+        759, 761, 0, 763, 0, 765, 0, 767, 0, 769, 0, 771, 0, 773, 0, 0,
+        775, 0, 777, 0, 779, 0, 781, 0, 783, 0, 785, 0, 787, 0, 789, 0,
+        791, 0, 793, 0, 795, 0, 797, 0, 799, 0, 801, 0, 803, 0, 805, 0,
+        807, 0, 809, 0, 811, 0, 813, 0, 815, 0, 817, 0, 819, 0, 821, 0,
+        823, 0, 825, 0, 827, 0, 829, 0, 831, 0, 833, 0, 835, 0, 837, 0,
+        839, 0, 841, 0, 843, 0, 845, 0, 847, 0, 849, 0, 851, 0, 853, 0,
+        855, 0, 857, 0, 859, 0, 861, 0, 863, 0, 865, 0, 867, 0, 869, 0,
+        0, 871, 873, 875, 877, 879, 881, 883, 885, 887, 889, 891, 893, 895, 897, 899,
+        901, 903, 905, 907, 909, 911, 913, 915, 917, 919, 921, 923, 925, 927, 929, 931,
+        933, 935, 937, 939, 941, 943, 945, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 947, 0, 0, 0, 0, 0, 0, 0, 0,
+        950, 952, 954, 956, 958, 960, 962, 964, 966, 968, 970, 972, 974, 976, 978, 980,
+        982, 984, 986, 988, 990, 992, 994, 996, 998, 1000, 1002, 1004, 1006, 1008, 1010, 1012,
+        1014, 1016, 1018, 1020, 1022, 1024, 0, 1026, 0, 0, 0, 0, 0, 1028, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1030, 1032, 1034, 1036, 1038, 1040, 0, 0,
+        611, 615, 635, 641, 643, 643, 659, 673, 1042, 0, 0, 0, 0, 0, 0, 0,
+        1044, 1046, 1048, 1050, 1052, 1054, 1056, 1058, 1060, 1062, 1064, 1066, 1068, 1070, 1072, 1074,
+        1076, 1078, 1080, 1082, 1084, 1086, 1088, 1090, 1092, 1094, 1096, 1098, 1100, 1102, 1104, 1106,
+        1108, 1110, 1112, 1114, 1116, 1118, 1120, 1122, 1124, 1126, 1128, 0, 0, 1130, 1132, 1134,
+        1136, 0, 1138, 0, 1140, 0, 1142, 0, 1144, 0, 1146, 0, 1148, 0, 1150, 0,
+        1152, 0, 1154, 0, 1156, 0, 1158, 0, 1160, 0, 1162, 0, 1164, 0, 1166, 0,
+        1168, 0, 1170, 0, 1172, 0, 1174, 0, 1176, 0, 1178, 0, 1180, 0, 1182, 0,
+        1184, 0, 1186, 0, 1188, 0, 1190, 0, 1192, 0, 1194, 0, 1196, 0, 1198, 0,
+        1200, 0, 1202, 0, 1204, 0, 1206, 0, 1208, 0, 1210, 0, 1212, 0, 1214, 0,
+        1216, 0, 1218, 0, 1220, 0, 1222, 0, 1224, 0, 1226, 0, 1228, 0, 1230, 0,
+        1232, 0, 1234, 0, 1236, 0, 1238, 0, 1240, 0, 1242, 0, 1244, 0, 1246, 0,
+        1248, 0, 1250, 0, 1252, 0, 1254, 0, 1256, 0, 1258, 0, 1260, 0, 1262, 0,
+        1264, 0, 1266, 0, 1268, 0, 1270, 0, 1272, 0, 1274, 0, 1276, 0, 1278, 0,
+        1280, 0, 1282, 0, 1284, 0, 1286, 1289, 1292, 1295, 1298, 1232, 0, 0, 115, 0,
+        1301, 0, 1303, 0, 1305, 0, 1307, 0, 1309, 0, 1311, 0, 1313, 0, 1315, 0,
+        1317, 0, 1319, 0, 1321, 0, 1323, 0, 1325, 0, 1327, 0, 1329, 0, 1331, 0,
+        1333, 0, 1335, 0, 1337, 0, 1339, 0, 1341, 0, 1343, 0, 1345, 0, 1347, 0,
+        1349, 0, 1351, 0, 1353, 0, 1355, 0, 1357, 0, 1359, 0, 1361, 0, 1363, 0,
+        1365, 0, 1367, 0, 1369, 0, 1371, 0, 1373, 0, 1375, 0, 1377, 0, 1379, 0,
+        1381, 0, 1383, 0, 1385, 0, 1387, 0, 1389, 0, 1391, 0, 1393, 0, 1395, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1397, 1399, 1401, 1403, 1405, 1407, 1409, 1411,
+        0, 0, 0, 0, 0, 0, 0, 0, 1413, 1415, 1417, 1419, 1421, 1423, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 1425, 1427, 1429, 1431, 1433, 1435, 1437, 1439,
+        0, 0, 0, 0, 0, 0, 0, 0, 1441, 1443, 1445, 1447, 1449, 1451, 1453, 1455,
+        0, 0, 0, 0, 0, 0, 0, 0, 1457, 1459, 1461, 1463, 1465, 1467, 0, 0,
+        1469, 0, 1472, 0, 1476, 0, 1480, 0, 0, 1484, 0, 1486, 0, 1488, 0, 1490,
+        0, 0, 0, 0, 0, 0, 0, 0, 1492, 1494, 1496, 1498, 1500, 1502, 1504, 1506,
+        1508, 1511, 1514, 1517, 1520, 1523, 1526, 1529, 1508, 1511, 1514, 1517, 1520, 1523, 1526, 1529,
+        1532, 1535, 1538, 1541, 1544, 1547, 1550, 1553, 1532, 1535, 1538, 1541, 1544, 1547, 1550, 1553,
+        1556, 1559, 1562, 1565, 1568, 1571, 1574, 1577, 1556, 1559, 1562, 1565, 1568, 1571, 1574, 1577,
+        0, 0, 1580, 1583, 1586, 0, 1589, 1592, 1596, 1598, 1600, 1602, 1583, 0, 457, 0,
+        0, 0, 1604, 1607, 1610, 0, 1613, 1616, 1620, 1622, 1624, 1626, 1607, 0, 0, 0,
+        0, 0, 1628, 481, 0, 0, 1632, 1635, 1639, 1641, 1643, 1645, 0, 0, 0, 0,
+        0, 0, 1647, 533, 1651, 0, 1654, 1657, 1661, 1663, 1665, 1667, 1669, 0, 0, 0,
+        0, 0, 1671, 1674, 1677, 0, 1680, 1683, 1687, 1689, 1691, 1693, 1674, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 527, 0, 0, 0, 21, 65, 0, 0, 0, 0,
+        0, 0, 1695, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1697, 1699, 1701, 1703, 1705, 1707, 1709, 1711, 1713, 1715, 1717, 1719, 1721, 1723, 1725, 1727,
+        0, 0, 0, 1729, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1731, 1733, 1735, 1737, 1739, 1741, 1743, 1745, 1747, 1749,
+        1751, 1753, 1755, 1757, 1759, 1761, 1763, 1765, 1767, 1769, 1771, 1773, 1775, 1777, 1779, 1781,
+        1783, 1785, 1787, 1789, 1791, 1793, 1795, 1797, 1799, 1801, 1803, 1805, 1807, 1809, 1811, 1813,
+        1815, 1817, 1819, 1821, 1823, 1825, 1827, 1829, 1831, 1833, 1835, 1837, 1839, 1841, 1843, 1845,
+        1847, 1849, 1851, 1853, 1855, 1857, 1859, 1861, 1863, 1865, 1867, 1869, 1871, 1873, 1875, 1877,
+        1879, 0, 1881, 1883, 1885, 0, 0, 1887, 0, 1889, 0, 1891, 0, 1893, 1895, 1897,
+        1899, 0, 1901, 0, 0, 1903, 0, 0, 0, 0, 0, 0, 0, 0, 1905, 1907,
+        1909, 0, 1911, 0, 1913, 0, 1915, 0, 1917, 0, 1919, 0, 1921, 0, 1923, 0,
+        1925, 0, 1927, 0, 1929, 0, 1931, 0, 1933, 0, 1935, 0, 1937, 0, 1939, 0,
+        1941, 0, 1943, 0, 1945, 0, 1947, 0, 1949, 0, 1951, 0, 1953, 0, 1955, 0,
+        1957, 0, 1959, 0, 1961, 0, 1963, 0, 1965, 0, 1967, 0, 1969, 0, 1971, 0,
+        1973, 0, 1975, 0, 1977, 0, 1979, 0, 1981, 0, 1983, 0, 1985, 0, 1987, 0,
+        1989, 0, 1991, 0, 1993, 0, 1995, 0, 1997, 0, 1999, 0, 2001, 0, 2003, 0,
+        2005, 0, 2007, 0, 0, 0, 0, 0, 0, 0, 0, 2009, 0, 2011, 0, 0,
+        0, 0, 2013, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2015, 0, 2017, 0, 2019, 0, 2021, 0, 2023, 0, 1042, 0, 2025, 0, 2027, 0,
+        2029, 0, 2031, 0, 2033, 0, 2035, 0, 2037, 0, 2039, 0, 2041, 0, 2043, 0,
+        2045, 0, 2047, 0, 2049, 0, 2051, 0, 2053, 0, 2055, 0, 2057, 0, 0, 0,
+        2059, 0, 2061, 0, 2063, 0, 2065, 0, 2067, 0, 2069, 0, 2071, 0, 2073, 0,
+        2075, 0, 2077, 0, 2079, 0, 2081, 0, 2083, 0, 2085, 0, 0, 0, 0, 0,
+        0, 0, 2087, 0, 2089, 0, 2091, 0, 2093, 0, 2095, 0, 2097, 0, 2099, 0,
+        0, 0, 2101, 0, 2103, 0, 2105, 0, 2107, 0, 2109, 0, 2111, 0, 2113, 0,
+        2115, 0, 2117, 0, 2119, 0, 2121, 0, 2123, 0, 2125, 0, 2127, 0, 2129, 0,
+        2131, 0, 2133, 0, 2135, 0, 2137, 0, 2139, 0, 2141, 0, 2143, 0, 2145, 0,
+        2147, 0, 2149, 0, 2151, 0, 2153, 0, 2155, 0, 2157, 0, 2159, 0, 2161, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 2163, 0, 2165, 0, 2167, 2169, 0,
+        2171, 0, 2173, 0, 2175, 0, 2177, 0, 0, 0, 0, 2179, 0, 2181, 0, 0,
+        2183, 0, 2185, 0, 0, 0, 2187, 0, 2189, 0, 2191, 0, 2193, 0, 2195, 0,
+        2197, 0, 2199, 0, 2201, 0, 2203, 0, 2205, 0, 2207, 2209, 2211, 2213, 2215, 0,
+        2217, 2219, 2221, 2223, 2225, 0, 2227, 0, 2229, 0, 2231, 0, 2233, 0, 2235, 0,
+        2237, 0, 2239, 0, 2241, 2243, 2245, 2247, 0, 2249, 0, 0, 0, 0, 0, 0,
+        2251, 0, 0, 0, 0, 0, 2253, 0, 2255, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 2257, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2259, 2261, 2263, 2265, 2267, 2269, 2271, 2273, 2275, 2277, 2279, 2281, 2283, 2285, 2287, 2289,
+        2291, 2293, 2295, 2297, 2299, 2301, 2303, 2305, 2307, 2309, 2311, 2313, 2315, 2317, 2319, 2321,
+        2323, 2325, 2327, 2329, 2331, 2333, 2335, 2337, 2339, 2341, 2343, 2345, 2347, 2349, 2351, 2353,
+        2355, 2357, 2359, 2361, 2363, 2365, 2367, 2369, 2371, 2373, 2375, 2377, 2379, 2381, 2383, 2385,
+        2387, 2389, 2391, 2393, 2395, 2397, 2399, 2401, 2403, 2405, 2407, 2409, 2411, 2413, 2415, 2417,
+        2419, 2422, 2425, 2428, 2432, 2436, 2436, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 2439, 2442, 2445, 2448, 2451, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 2454, 2456, 2458, 2460, 2462, 2464, 2466, 2468, 2470, 2472, 2474, 2476, 2478, 2480, 2482,
+        2484, 2486, 2488, 2490, 2492, 2494, 2496, 2498, 2500, 2502, 2504, 0, 0, 0, 0, 0,
+        2506, 2508, 2510, 2512, 2514, 2516, 2518, 2520, 2522, 2524, 2526, 2528, 2530, 2532, 2534, 2536,
+        2538, 2540, 2542, 2544, 2546, 2548, 2550, 2552, 2554, 2556, 2558, 2560, 2562, 2564, 2566, 2568,
+        2570, 2572, 2574, 2576, 2578, 2580, 2582, 2584, 0, 0, 0, 0, 0, 0, 0, 0,
+        2586, 2588, 2590, 2592, 2594, 2596, 2598, 2600, 2602, 2604, 2606, 2608, 2610, 2612, 2614, 2616,
+        2618, 2620, 2622, 2624, 2626, 2628, 2630, 2632, 2634, 2636, 2638, 2640, 2642, 2644, 2646, 2648,
+        2650, 2652, 2654, 2656, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2658, 2660, 2662, 2664, 2666, 2668, 2670, 2672, 2674, 2676, 2678, 0, 2680, 2682, 2684, 2686,
+        2688, 2690, 2692, 2694, 2696, 2698, 2700, 2702, 2704, 2706, 2708, 0, 2710, 2712, 2714, 2716,
+        2718, 2720, 2722, 0, 2724, 2726, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2728, 2730, 2732, 2734, 2736, 2738, 2740, 2742, 2744, 2746, 2748, 2750, 2752, 2754, 2756, 2758,
+        2760, 2762, 2764, 2766, 2768, 2770, 2772, 2774, 2776, 2778, 2780, 2782, 2784, 2786, 2788, 2790,
+        2792, 2794, 2796, 2798, 2800, 2802, 2804, 2806, 2808, 2810, 2812, 2814, 2816, 2818, 2820, 2822,
+        2824, 2826, 2828, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2830, 2832, 2834, 2836, 2838, 2840, 2842, 2844, 2846, 2848, 2850, 2852, 2854, 2856, 2858, 2860,
+        2862, 2864, 2866, 2868, 2870, 2872, 2874, 2876, 2878, 2880, 2882, 2884, 2886, 2888, 2890, 2892,
+        2894, 2896, 2898, 2900, 2902, 2904, 2906, 2908, 2910, 2912, 2914, 2916, 2918, 2920, 2922, 2924,
+        2926, 2928, 2930, 2932, 2934, 2936, 2938, 2940, 2942, 2944, 2946, 2948, 2950, 2952, 2954, 2956,
+        2958, 2960, 2962, 2964, 2966, 2968, 2970, 2972, 2974, 2976, 2978, 2980, 2982, 2984, 2986, 2988,
+        2990, 2992, 2994, 2996, 2998, 3000, 3002, 3004, 3006, 3008, 3010, 3012, 3014, 3016, 3018, 3020,
+        3022, 3024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+#pragma endregion
+
+static inline const NormRecord &getNormRecord(uint32_t code) {
+    if (code > 0x10ffff) return NormRecords[0];
+    auto block = NormStage2[(NormStage1[code >> 10] << 6) + ((code >> 4) & 63)];
+    return NormRecords[NormStage3[(block << 4) + (code & 15)]];
+}
+
+/// 各规范化形式的参数
+struct NormForm {
+    /// 快速检查结果不为 Yes 的标志
+    uint8_t check;
+    /// 快速检查结果为 No 的标志
+    uint8_t no;
+    bool compat;
+    bool compose;
+};
+
+static NormForm getNormForm(SNormalForm form) {
+    switch (form) {
+        case SNormalForm::NFC:
+            return {NFC_NO | NFC_MAYBE, NFC_NO, false, true};
+        case SNormalForm::NFD:
+            return {NFD_NO, NFD_NO, false, false};
+        case SNormalForm::NFKC:
+            return {NFKC_NO | NFKC_MAYBE, NFKC_NO, true, true};
+        default:
+            return {NFKD_NO, NFKD_NO, true, false};
+    }
+}
+
+static inline void appendBytes(SString &out, const char *data, size_t size) {
+    if (0 == size) return;
+    auto old = out.size();
+    // 按倍数扩容，避免逐段追加时反复拷贝
+    if (old + size + 1 > out.cap()) out.reserve(std::max(old + size, out.cap() * 2));
+    out.resize(old + size);
+    memcpy(out.data() + old, data, size);
+}
+
+/// 跳过连续的 ASCII 字节，ASCII 字符在任何形式下都已规范化且可作为边界
+static size_t skipASCII(const char *str, size_t i, size_t size) {
+#ifdef SSTR_SSE2
+    for (; i + 16 <= size; i += 16) {
+        auto mask = (uint32_t) _mm_movemask_epi8(_mm_loadu_si128((const __m128i *) (str + i)));
+        if (mask) return i + sstr::CountTrailingZeros(mask);
+    }
+#endif
+    while (i < size && (unsigned char) str[i] < 0x80) i++;
+    return i;
+}
+
+/// 完全分解一个字符
+static void decompose(uint32_t code, bool compat, std::vector<uint32_t> &buffer) {
+    if (code >= HANGUL_S_BASE && code < HANGUL_S_BASE + HANGUL_S_COUNT) {
+        auto index = code - HANGUL_S_BASE;
+        buffer.push_back(HANGUL_L_BASE + index / HANGUL_N_COUNT);
+        buffer.push_back(HANGUL_V_BASE + index % HANGUL_N_COUNT / HANGUL_T_COUNT);
+        if (index % HANGUL_T_COUNT) buffer.push_back(HANGUL_T_BASE + index % HANGUL_T_COUNT);
+        return;
+    }
+    auto &record = getNormRecord(code);
+    auto offset = compat ? record.compat : record.canonical;
+    if (0 == offset) {
+        buffer.push_back(code);
+        return;
+    }
+    auto len = DecompositionPool[offset];
+    buffer.insert(buffer.end(), DecompositionPool + offset + 1, DecompositionPool + offset + 1 + len);
+}
+
+/// 获取两个字符的规范组合，不存在返回 0
+static uint32_t compose(uint32_t first, uint32_t second) {
+    // 韩文 LV 与 LVT 音节
+    if (first >= HANGUL_L_BASE && first < HANGUL_L_BASE + HANGUL_L_COUNT &&
+        second >= HANGUL_V_BASE && second < HANGUL_V_BASE + HANGUL_V_COUNT) {
+        return HANGUL_S_BASE + ((first - HANGUL_L_BASE) * HANGUL_V_COUNT + second - HANGUL_V_BASE) * HANGUL_T_COUNT;
+    }
+    if (first >= HANGUL_S_BASE && first < HANGUL_S_BASE + HANGUL_S_COUNT && 0 == (first - HANGUL_S_BASE) % HANGUL_T_COUNT &&
+        second > HANGUL_T_BASE && second < HANGUL_T_BASE + HANGUL_T_COUNT) {
+        return first + second - HANGUL_T_BASE;
+    }
+    auto end = CompositionPairs + sizeof(CompositionPairs) / sizeof(CompositionPairs[0]);
+    auto it = std::lower_bound(CompositionPairs, end, std::make_pair(first, second),
+                               [](const CompositionPair &pair, const std::pair<uint32_t, uint32_t> &key) {
+                                   return pair.first < key.first || (pair.first == key.first && pair.second < key.second);
+                               });
+    if (it != end && it->first == first && it->second == second) return it->composite;
+    return 0;
+}
+
+/// 规范排序，并在 compose 为 true 时进行规范组合
+static void reorder(std::vector<uint32_t> &buffer, bool compose) {
+    // 规范排序：连续的非起始字符按组合类稳定排序
+    auto size = buffer.size();
+    for (size_t i = 1; i < size; i++) {
+        auto ccc = getNormRecord(buffer[i]).ccc;
+        if (0 == ccc) continue;
+        auto code = buffer[i];
+        auto j = i;
+        while (j > 0) {
+            auto prev = getNormRecord(buffer[j - 1]).ccc;
+            if (0 == prev || prev <= ccc) break;
+            buffer[j] = buffer[j - 1];
+            j--;
+        }
+        buffer[j] = code;
+    }
+
+    // 规范组合：与最近的起始字符组合，中间字符的组合类不小于自身时被阻断
+    if (compose && size > 1) {
+        size_t starter = 0;
+        bool hasStarter = 0 == getNormRecord(buffer[0]).ccc;
+        uint8_t lastCcc = 0;
+        size_t count = 1;
+        for (size_t i = 1; i < size; i++) {
+            auto code = buffer[i];
+            auto ccc = getNormRecord(code).ccc;
+            if (hasStarter && (count == starter + 1 || (0 != lastCcc && lastCcc < ccc))) {
+                auto composite = ::compose(buffer[starter], code);
+                if (composite) {
+                    buffer[starter] = composite;
+                    continue;
+                }
+            }
+            if (0 == ccc) {
+                starter = count;
+                hasStarter = true;
+            }
+            lastCcc = ccc;
+            buffer[count++] = code;
+        }
+        buffer.resize(count);
+    }
+}
+
+/// 规范化 [begin, end) 并追加到 out
+/// \param buffer 复用的码点缓冲区
+static void normalizeSegment(const char *begin, const char *end, const NormForm &form,
+                             std::vector<uint32_t> &buffer, SString &out) {
+    buffer.clear();
+    int n;
+    for (auto p = begin; p < end; p += n) {
+        decompose(sstr::DecodeUTF8(p, end, n), form.compat, buffer);
+    }
+    reorder(buffer, form.compose);
+
+    auto old = out.size();
+    size_t bytes = 0;
+    for (auto code: buffer) {
+        bytes += code < 0x80 ? 1 : code < 0x800 ? 2 : code < 0x10000 ? 3 : 4;
+    }
+    if (old + bytes + 1 > out.cap()) out.reserve(std::max(old + bytes, out.cap() * 2));
+    out.resize(old + bytes);
+    auto dst = out.data() + old;
+    for (auto code: buffer) {
+        dst += sstr::putUTF8FromUnicodeChar(sstr::SChar(code), dst);
+    }
+}
+
+enum QuickCheck {
+    QC_Yes,
+    QC_No,
+    QC_Maybe,
+};
+
+/// 快速检查（UAX #15 第 9 节）
+static QuickCheck quickCheck(const char *str, size_t size, const NormForm &form) {
+    auto end = str + size;
+    auto result = QC_Yes;
+    uint8_t lastCcc = 0;
+    size_t i = 0;
+    while (true) {
+        auto ascii = skipASCII(str, i, size);
+        if (ascii != i) lastCcc = 0;
+        i = ascii;
+        if (i >= size) break;
+
+        int n;
+        auto &record = getNormRecord(sstr::DecodeUTF8(str + i, end, n));
+        if (0 != record.ccc && record.ccc < lastCcc) return QC_No;
+        if (record.flags & form.no) return QC_No;
+        if (record.flags & form.check) result = QC_Maybe;
+        lastCcc = record.ccc;
+        i += n;
+    }
+    return result;
+}
+
+/// 规范化并把结果追加到 out，已规范化的片段直接拷贝
+static void normalizeInto(const char *str, size_t size, const NormForm &form, SString &out) {
+    auto end = str + size;
+    std::vector<uint32_t> buffer;
+    // 已输出到的位置
+    size_t copied = 0;
+    // 最近一个可安全断开的起始字符位置
+    size_t boundary = 0;
+    uint8_t lastCcc = 0;
+    size_t i = 0;
+    while (true) {
+        auto ascii = skipASCII(str, i, size);
+        if (ascii != i) {
+            boundary = ascii - 1;
+            lastCcc = 0;
+        }
+        i = ascii;
+        if (i >= size) break;
+
+        int n;
+        auto &record = getNormRecord(sstr::DecodeUTF8(str + i, end, n));
+        if (0 == (record.flags & form.check) && (0 == record.ccc || record.ccc >= lastCcc)) {
+            if (0 == record.ccc) boundary = i;
+            lastCcc = record.ccc;
+            i += n;
+            continue;
+        }
+
+        // 从上一个边界处理到下一个边界
+        auto next = i + n;
+        while (next < size) {
+            auto &r = getNormRecord(sstr::DecodeUTF8(str + next, end, n));
+            if (0 == r.ccc && 0 == (r.flags & form.check)) break;
+            next += n;
+        }
+        appendBytes(out, str + copied, boundary - copied);
+        normalizeSegment(str + boundary, str + next, form, buffer, out);
+        copied = boundary = i = next;
+        lastCcc = 0;
+    }
+    appendBytes(out, str + copied, size - copied);
+}
+
+uint8_t sstr::SChar::combiningClass() const {
+    return getNormRecord(code).ccc;
+}
+
+bool SStringView::isNormalized(SNormalForm form) const {
+    if (null()) return true;
+    auto nf = getNormForm(form);
+    switch (quickCheck(_data, _size, nf)) {
+        case QC_Yes:
+            return true;
+        case QC_No:
+            return false;
+        default: {
+            SString res;
+            normalizeInto(_data, _size, nf, res);
+            return res == *this;
+        }
+    }
+}
+
+SString SStringView::normalize(SNormalForm form) const {
+    SString res;
+    if (null()) return res;
+    auto nf = getNormForm(form);
+    if (QC_Yes == quickCheck(_data, _size, nf)) return {_data, _size};
+    res.reserve(_size);
+    normalizeInto(_data, _size, nf, res);
+    return res;
+}
+
+bool SStringView::normalize(SNormalForm form, SString &out) const {
+    if (null()) return false;
+    auto nf = getNormForm(form);
+    if (QC_Yes == quickCheck(_data, _size, nf)) return false;
+    out.resize(0);
+    out.reserve(_size);
+    normalizeInto(_data, _size, nf, out);
+    return true;
+}
+
+void SString::normalize(SNormalForm form) {
+    if (null()) return;
+    auto nf = getNormForm(form);
+    if (QC_Yes == quickCheck(_data, _size, nf)) return;
+    SString res;
+    res.reserve(_size);
+    normalizeInto(_data, _size, nf, res);
+    *this = std::move(res);
+}
+
+#pragma region SNormalizer
+
+SNormalizer::SNormalizer(SNormalForm form) noexcept : _form(form) {}
+
+SNormalForm SNormalizer::form() const {
+    return _form;
+}
+
+void SNormalizer::append(const SStringView &chunk, SString &out) {
+    if (chunk.null() || 0 == chunk.size()) return;
+    _pending.insert(_pending.end(), chunk.data(), chunk.data() + chunk.size());
+
+    // 从后向前寻找最后一个完整且可安全断开的起始字符
+    auto nf = getNormForm(_form);
+    auto data = _pending.data();
+    auto size = _pending.size();
+    auto end = data + size;
+    size_t boundary = 0;
+    for (auto i = size; i > 0; i--) {
+        auto ch = (unsigned char) data[i - 1];
+        if ((ch & 0b11000000) == 0b10000000) continue;
+        int n;
+        auto code = sstr::DecodeUTF8(data + i - 1, end, n);
+        // 截断的序列需等待后续输入
+        if (1 == n && ch >= 0x80 && (size_t) sstr::getSizeFromUTF8Char((char) ch) > size - (i - 1)) continue;
+        auto &record = getNormRecord(code);
+        if (0 == record.ccc && 0 == (record.flags & nf.check)) {
+            boundary = i - 1;
+            break;
+        }
+    }
+    if (0 == boundary) return;
+
+    normalizeInto(data, boundary, nf, out);
+    _pending.erase(_pending.begin(), _pending.begin() + boundary);
+}
+
+void SNormalizer::finish(SString &out) {
+    if (_pending.empty()) return;
+    normalizeInto(_pending.data(), _pending.size(), getNormForm(_form), out);
+    _pending.clear();
+}
+
+#pragma endregion
+
+#pragma region SSearchNormalizer
+
+/// ASCII 处理结果：删除
+#define SEARCH_DROP 0xff
+/// ASCII 处理结果：可合并的空白
+#define SEARCH_SPACE 0x80
+
+using sstr::SSearchStage;
+
+static inline uint16_t getCaseFold(uint32_t code) {
+    if (code > 0x10ffff) return 0;
+    auto block = CaseFoldStage2[(CaseFoldStage1[code >> 10] << 6) + ((code >> 4) & 63)];
+    return CaseFoldStage3[(block << 4) + (code & 15)];
+}
+
+/// 单遍搜索规范化的状态，结果直接写入输出缓冲区
+/// \note 需要组合时分两级缓冲：decomposed 保存两个起始字符之间已分解的码点，排序后再折叠与过滤，
+///       保证折叠作用于规范顺序（如 U+0345 折叠为起始字符）；composing 保存待组合的码点，
+///       遇到不会向前组合的起始字符时输出
+struct SearchState {
+    SearchState(uint32_t stages, SString &out)
+        : fold(0 != (stages & sstr::SSearchCaseFold)), compat(0 != (stages & sstr::SSearchNFKC)),
+          // 删除组合符需要先规范分解，输出时再组合回去
+          compose(0 != (stages & (sstr::SSearchNFKC | sstr::SSearchStripDiacritics))),
+          stripMarks(0 != (stages & sstr::SSearchStripDiacritics)),
+          collapse(0 != (stages & sstr::SSearchCollapseWhitespace)),
+          stripPunct(0 != (stages & sstr::SSearchStripPunctuation)), out(out) {}
+
+    /// 保证还能写入 n 个字节，按倍数扩容
+    void reserve(size_t n) {
+        if (size + n + 1 <= out.cap()) return;
+        out.resize(size);
+        out.reserve(std::max(size + n, out.cap() * 2));
+    }
+
+    void put(uint32_t code) {
+        sstr::SChar ch(code);
+        if (collapse && ch.isSpace()) {
+            space = started;
+            return;
+        }
+        reserve(5);
+        auto dst = out.data() + size;
+        if (space) {
+            *dst++ = ' ';
+            size++;
+            space = false;
+        }
+        auto written = sstr::putUTF8FromUnicodeChar(ch, dst);
+        // 超出 Unicode 范围的码点无法编码，输出 U+FFFD
+        if (written < 0) written = sstr::putUTF8FromUnicodeChar(sstr::SChar(0xfffd), dst);
+        size += written;
+        started = true;
+    }
+
+    /// 是否被删除
+    bool dropped(uint32_t code) const {
+        if (!stripPunct && !stripMarks) return false;
+        auto category = sstr::SChar(code).category();
+        return (stripPunct && (sstr::getCategoryBit(category) & sstr::PunctuationMask)) ||
+               (stripMarks && sstr::SCategory::Mn == category);
+    }
+
+    /// 折叠并过滤后的码点，不需要组合时直接输出
+    void accept(uint32_t code) {
+        if (dropped(code)) return;
+        if (!compose) {
+            put(code);
+            return;
+        }
+        auto &record = getNormRecord(code);
+        if (0 == record.ccc && 0 == (record.flags & NFC_MAYBE)) flushComposing();
+        composing.push_back(code);
+    }
+
+    void flushComposing() {
+        if (composing.empty()) return;
+        reorder(composing, true);
+        for (auto code: composing) put(code);
+        composing.clear();
+    }
+
+    void flushDecomposed() {
+        if (decomposed.empty()) return;
+        reorder(decomposed, false);
+        for (auto code: decomposed) {
+            auto offset = fold ? getCaseFold(code) : 0;
+            if (0 == offset) {
+                accept(code);
+                continue;
+            }
+            // 折叠结果可能是预组合字符，需要再次分解
+            folded.clear();
+            for (uint32_t i = 1; i <= CaseFoldPool[offset]; i++) decompose(CaseFoldPool[offset + i], compat, folded);
+            for (auto c: folded) accept(c);
+        }
+        decomposed.clear();
+    }
+
+    /// 处理一个解码后的码点
+    void push(uint32_t code) {
+        if (!compose) {
+            auto offset = fold ? getCaseFold(code) : 0;
+            if (0 == offset) {
+                accept(code);
+                return;
+            }
+            for (uint32_t i = 1; i <= CaseFoldPool[offset]; i++) accept(CaseFoldPool[offset + i]);
+            return;
+        }
+        scratch.clear();
+        decompose(code, compat, scratch);
+        // 起始字符之前的码点不再参与排序
+        if (0 == getNormRecord(scratch[0]).ccc) flushDecomposed();
+        decomposed.insert(decomposed.end(), scratch.begin(), scratch.end());
+    }
+
+    /// 处理 ASCII 字符，后面不会跟随组合符
+    void pushASCII(uint8_t action) {
+        if (SEARCH_DROP == action) return;
+        flushDecomposed();
+        flushComposing();
+        if (SEARCH_SPACE == action) {
+            space = started;
+            return;
+        }
+        reserve(2);
+        if (space) {
+            out.data()[size++] = ' ';
+            space = false;
+        }
+        out.data()[size++] = (char) action;
+        started = true;
+    }
+
+    void finish() {
+        flushDecomposed();
+        flushComposing();
+        out.resize(size);
+    }
+
+    bool fold;
+    bool compat;
+    bool compose;
+    bool stripMarks;
+    bool collapse;
+    bool stripPunct;
+
+    SString &out;
+    size_t size = 0;
+    /// 已输出过非空白字符
+    bool started = false;
+    /// 有待输出的空格，遇到下一个输出字符时写入，从而去除结尾空白
+    bool space = false;
+    /// 尚未排序的分解结果
+    std::vector<uint32_t> decomposed;
+    /// 尚未组合的码点
+    std::vector<uint32_t> composing;
+    std::vector<uint32_t> folded;
+    std::vector<uint32_t> scratch;
+};
+
+SSearchNormalizer::SSearchNormalizer(uint32_t stages) noexcept : _stages(stages & sstr::SSearchAllStages) {
+    for (uint32_t ch = 0; ch < 128; ch++) {
+        sstr::SChar c(ch);
+        auto action = (uint8_t) ch;
+        if ((_stages & sstr::SSearchCaseFold) && ch >= 'A' && ch <= 'Z') action = (uint8_t) (ch + 32);
+        if ((_stages & sstr::SSearchCollapseWhitespace) && c.isSpace()) action = SEARCH_SPACE;
+        if ((_stages & sstr::SSearchStripPunctuation) && c.isPunct()) action = SEARCH_DROP;
+        _ascii[ch] = action;
+    }
+}
+
+uint32_t SSearchNormalizer::stages() const {
+    return _stages;
+}
+
+SString SSearchNormalizer::normalize(const SStringView &str) const {
+    SString res;
+    normalize(str, res);
+    return res;
+}
+
+void SSearchNormalizer::normalize(const SStringView &str, SString &out) const {
+    out.resize(0);
+    if (str.null()) return;
+    out.reserve(str.size());
+
+    SearchState state(_stages, out);
+    auto data = str.data();
+    auto size = str.size();
+    auto end = data + size;
+    size_t i = 0;
+    while (i < size) {
+        auto ascii = skipASCII(data, i, size);
+        // 需要组合时，非 ASCII 字符前最后一个保留的 ASCII 字符可能与其后的组合符组合
+        auto safe = ascii;
+        if (state.compose && ascii < size) {
+            while (safe > i && SEARCH_DROP == _ascii[(uint8_t) data[safe - 1]]) safe--;
+            if (safe > i) safe--;
+        }
+        for (; i < safe; i++) state.pushASCII(_ascii[(uint8_t) data[i]]);
+        if (i >= size) break;
+
+        int n;
+        state.push(sstr::DecodeUTF8(data + i, end, n));
+        i += n;
+    }
+    state.finish();
+}
+
+#pragma endregion
@@ -0,0 +1,213 @@
+#include <SString/rolling.h>
+#include <cstring>
+
+using sstr::SRabinKarpMatcher;
+using sstr::SStringView;
+
+/// Rabin-Karp 的底数，取奇数使其在 mod 2^64 下可逆
+static const uint64_t RollingBase = 0x100000001b3ull;
+/// 并行滚动的段数
+static const size_t RollingLanes = 4;
+
+static inline uint64_t getPower(uint64_t base, size_t exponent) {
+    uint64_t res = 1;
+    while (exponent) {
+        if (exponent & 1) res *= base;
+        base *= base;
+        exponent >>= 1;
+    }
+    return res;
+}
+
+static inline uint64_t hashBlock(const uint8_t *p, size_t size) {
+    uint64_t h = 0;
+    for (size_t i = 0; i < size; i++) h = h * RollingBase + p[i];
+    return h;
+}
+
+uint64_t sstr::getRabinKarpHash(const SStringView &str) {
+    return hashBlock((const uint8_t *) str.data(), str.null() ? 0 : str.size());
+}
+
+size_t sstr::getRollingHashes(const SStringView &str, size_t window, uint64_t *hashes) {
+    auto size = str.null() ? 0 : str.size();
+    if (0 == window || window > size) return 0;
+    auto p = (const uint8_t *) str.data();
+    auto count = size - window + 1;
+    // 移出窗口的字节的权重
+    auto outWeight = getPower(RollingBase, window);
+    // 每段的窗口个数，段数不足以抵消初始计算的开销时只用一段
+    auto lanes = count >= RollingLanes * window * 4 ? RollingLanes : 1;
+    auto span = count / lanes;
+    uint64_t h[RollingLanes];
+    for (size_t l = 0; l < lanes; l++) {
+        h[l] = hashBlock(p + l * span, window);
+        hashes[l * span] = h[l];
+    }
+    // 各段步调一致地滚动，循环内没有跨段依赖
+    for (size_t i = 1; i < span; i++) {
+        for (size_t l = 0; l < lanes; l++) {
+            auto start = l * span + i;
+            h[l] = h[l] * RollingBase + p[start + window - 1] - outWeight * p[start - 1];
+            hashes[start] = h[l];
+        }
+    }
+    // 最后一段补上不能均分的部分
+    auto last = lanes - 1;
+    for (size_t start = lanes * span; start < count; start++) {
+        h[last] = h[last] * RollingBase + p[start + window - 1] - outWeight * p[start - 1];
+        hashes[start] = h[last];
+    }
+    return count;
+}
+
+std::vector<uint64_t> sstr::getRollingHashes(const SStringView &str, size_t window) {
+    auto size = str.null() ? 0 : str.size();
+    std::vector<uint64_t> res(0 == window || window > size ? 0 : size - window + 1);
+    if (!res.empty()) getRollingHashes(str, window, res.data());
+    return res;
+}
+
+#pragma region GearTable
+
+/// Gear 哈希的字节映射，由 splitmix64 以 0 为种子生成
+struct GearTable {
+    uint64_t data[256];
+
+    GearTable() {
+        uint64_t state = 0;
+        for (auto &value: data) {
+            auto z = (state += 0x9e3779b97f4a7c15ull);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+            value = z ^ (z >> 31);
+        }
+    }
+};
+
+static const uint64_t *getGearTable() {
+    static const GearTable table;
+    return table.data;
+}
+
+#pragma endregion
+
+/// 取哈希高位的掩码，Gear 哈希的高位受窗口内更多字节影响
+static inline uint64_t getChunkMask(int bits) {
+    if (bits <= 0) return 0;
+    if (bits >= 64) return ~0ull;
+    return ~0ull << (64 - bits);
+}
+
+size_t sstr::getNextChunkBoundary(const SStringView &str, size_t pos, size_t minSize, size_t avgSize, size_t maxSize) {
+    auto size = str.null() ? 0 : str.size();
+    if (pos >= size) return size;
+    if (0 == maxSize) maxSize = 1;
+    if (minSize > maxSize) minSize = maxSize;
+    auto end = size - pos > maxSize ? pos + maxSize : size;
+    if (end - pos <= minSize) return end;
+
+    int bits = 0;
+    while (bits < 63 && (1ull << bits) < avgSize) bits++;
+    // 归一化分块：期望块长之前多检查 1 位，之后少检查 1 位
+    auto strictMask = getChunkMask(bits + 1), looseMask = getChunkMask(bits - 1);
+    auto normal = pos + (avgSize > minSize ? avgSize : minSize);
+    if (normal > end) normal = end;
+
+    auto gear = getGearTable();
+    auto p = (const uint8_t *) str.data();
+    auto i = pos + minSize;
+    // 哈希只由最近 64 字节决定，从断点前 64 字节开始预热，使判断与块的起点无关
+    auto warm = i - pos > 64 ? i - 64 : pos;
+    uint64_t h = 0;
+    for (auto k = warm; k < i; k++) h = (h << 1) + gear[p[k]];
+    for (; i < normal; i++) {
+        h = (h << 1) + gear[p[i]];
+        if (!(h & strictMask)) return i + 1;
+    }
+    for (; i < end; i++) {
+        h = (h << 1) + gear[p[i]];
+        if (!(h & looseMask)) return i + 1;
+    }
+    return end;
+}
+
+std::vector<SStringView> sstr::splitChunks(const SStringView &str, size_t minSize, size_t avgSize, size_t maxSize) {
+    std::vector<SStringView> res;
+    auto size = str.null() ? 0 : str.size();
+    for (size_t pos = 0; pos < size;) {
+        auto next = getNextChunkBoundary(str, pos, minSize, avgSize, maxSize);
+        res.emplace_back(str.data() + pos, next - pos);
+        pos = next;
+    }
+    return res;
+}
+
+SRabinKarpMatcher::SRabinKarpMatcher(const std::vector<SStringView> &patterns) {
+    if (patterns.empty() || patterns.size() >= UINT32_MAX) return;
+    auto window = patterns[0].null() ? 0 : patterns[0].size();
+    if (0 == window) return;
+    for (auto &pattern: patterns) {
+        if ((pattern.null() ? 0 : pattern.size()) != window) return;
+    }
+    _window = window;
+    _count = patterns.size();
+    _patterns.resize(_count * _window);
+    size_t capacity = 16;
+    while (capacity < _count * 2) capacity <<= 1;
+    _slots.assign(capacity, 0);
+    _hashes.assign(capacity, 0);
+    for (size_t i = 0; i < _count; i++) {
+        memcpy(_patterns.data() + i * _window, patterns[i].data(), _window);
+        auto h = hashBlock((const uint8_t *) patterns[i].data(), _window);
+        // 线性探测，内容相同的模式按序号依次排列
+        auto slot = (size_t) (h * 0x9e3779b97f4a7c15ull >> 32) & (capacity - 1);
+        while (_slots[slot]) slot = (slot + 1) & (capacity - 1);
+        _slots[slot] = (uint32_t) (i + 1);
+        _hashes[slot] = h;
+    }
+}
+
+bool SRabinKarpMatcher::valid() const {
+    return 0 != _window;
+}
+
+size_t SRabinKarpMatcher::size() const {
+    return _count;
+}
+
+size_t SRabinKarpMatcher::window() const {
+    return _window;
+}
+
+int64_t SRabinKarpMatcher::find(const SStringView &text, size_t pos, uint32_t *pattern) const {
+    int64_t res = -1;
+    auto size = text.null() ? 0 : text.size();
+    if (pos > size) return -1;
+    forEachMatch(SStringView(text.data() + pos, size - pos), [&](size_t offset, uint32_t index) {
+        res = (int64_t) (pos + offset);
+        if (pattern) *pattern = index;
+        return false;
+    });
+    return res;
+}
+
+void SRabinKarpMatcher::forEachMatch(const SStringView &text, const std::function<bool(size_t, uint32_t)> &callback) const {
+    auto size = text.null() ? 0 : text.size();
+    if (!valid() || size < _window) return;
+    auto p = (const uint8_t *) text.data();
+    auto count = size - _window + 1;
+    auto mask = _slots.size() - 1;
+    auto outWeight = getPower(RollingBase, _window);
+    // 只计算一次首个窗口，之后沿整个文本滚动，总代价与窗口长度无关
+    auto h = hashBlock(p, _window);
+    for (size_t start = 0; start < count; start++) {
+        if (start) h = h * RollingBase + p[start + _window - 1] - outWeight * p[start - 1];
+        for (auto slot = (size_t) (h * 0x9e3779b97f4a7c15ull >> 32) & mask; _slots[slot]; slot = (slot + 1) & mask) {
+            if (_hashes[slot] != h) continue;
+            auto index = _slots[slot] - 1;
+            if (memcmp(p + start, _patterns.data() + index * _window, _window)) continue;
+            if (!callback(start, index)) return;
+        }
+    }
+}
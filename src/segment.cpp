@@ -0,0 +1,2446 @@
+#include <SString/segment.h>
+#include <SString/algorithm.h>
+#include <cstring>
+#include <vector>
+#ifdef _WIN32
+#pragma warning(disable : 4267)
+#endif
+
+using sstr::SGraphemeIterator;
+using sstr::SString;
+using sstr::SSentenceIterator;
+using sstr::SStringView;
+using sstr::SWordIterator;
+
+/// 字素簇断行属性（Grapheme_Cluster_Break），Extended_Pictographic 合并为单独取值
+enum GraphemeBreak : uint8_t {
+    GB_Other,
+    GB_CR,
+    GB_LF,
+    GB_Control,
+    GB_Extend,
+    GB_ZWJ,
+    GB_RegionalIndicator,
+    GB_Prepend,
+    GB_SpacingMark,
+    GB_L,
+    GB_V,
+    GB_T,
+    GB_LV,
+    GB_LVT,
+    GB_ExtPict,
+};
+
+#pragma region GraphemeBreakTable
+
+// 由 Unicode 14.0 GraphemeBreakProperty.txt 与 emoji-data.txt 生成的三级查找表
+
+/// 一级表，按 cp >> 11 索引
+static const uint8_t GraphemeStage1[544] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 8, 9, 10, 11, 12, 13, 14, 7, 7, 7, 7, 15,
+        16, 17, 18, 19, 7, 7, 20, 7, 7, 7, 7, 7, 7, 21, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 22, 7, 23, 24, 25, 26, 27, 28, 29,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        30, 31, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+};
+
+/// 二级表，每块 32 项，按 (cp >> 6) & 31 索引
+static const uint8_t GraphemeStage2[1024] = {
+        0, 1, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 5, 3, 3,
+        3, 3, 6, 3, 3, 3, 7, 8, 9, 10, 3, 11, 12, 13, 14, 15,
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 24, 26, 27, 28, 29, 30,
+        31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46,
+        47, 48, 49, 3, 50, 51, 52, 53, 3, 3, 3, 3, 3, 54, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 55, 56, 57, 58,
+        59, 3, 60, 3, 61, 3, 3, 3, 62, 63, 64, 65, 66, 67, 68, 69,
+        70, 3, 3, 71, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 3, 3,
+        72, 73, 3, 74, 75, 3, 76, 3, 3, 3, 3, 3, 77, 3, 78, 79,
+        3, 3, 3, 80, 3, 3, 81, 82, 83, 84, 85, 84, 86, 87, 88, 3,
+        3, 3, 3, 3, 89, 3, 3, 3, 3, 3, 3, 3, 90, 91, 3, 3,
+        3, 3, 3, 92, 3, 93, 3, 94, 3, 3, 3, 3, 3, 3, 3, 3,
+        95, 3, 96, 3, 3, 3, 3, 3, 3, 3, 97, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 98, 99, 100, 3, 3, 3, 3,
+        101, 3, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 3, 3, 3, 112,
+        113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114,
+        115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116,
+        117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118,
+        119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113,
+        114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115,
+        116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117,
+        118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119,
+        113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114,
+        115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116,
+        117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118,
+        119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 120, 121,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 122, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 123, 3, 3, 1, 3, 3, 99, 124,
+        3, 3, 3, 3, 3, 3, 3, 125, 3, 3, 3, 126, 3, 127, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 128, 3, 3, 129, 3, 3, 3, 3,
+        3, 3, 3, 3, 130, 3, 3, 3, 3, 3, 131, 3, 3, 132, 133, 3,
+        134, 135, 136, 137, 138, 139, 140, 141, 142, 3, 3, 143, 35, 144, 3, 3,
+        145, 146, 147, 148, 3, 3, 149, 150, 151, 152, 153, 3, 154, 3, 3, 3,
+        155, 3, 3, 3, 156, 157, 3, 158, 159, 160, 161, 3, 3, 3, 3, 3,
+        162, 3, 163, 3, 164, 165, 166, 3, 3, 3, 3, 167, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        168, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 169, 170, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 171, 172, 173,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 174, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 175, 176, 3, 3,
+        3, 3, 3, 3, 3, 177, 178, 3, 3, 179, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 180, 181, 182, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        183, 3, 3, 3, 170, 3, 3, 3, 3, 3, 184, 185, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 186, 3, 187, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        84, 84, 84, 84, 188, 189, 190, 191, 192, 193, 84, 84, 84, 84, 84, 194,
+        84, 84, 84, 84, 195, 196, 84, 84, 84, 197, 84, 84, 3, 198, 3, 199,
+        200, 201, 202, 84, 203, 204, 84, 84, 84, 84, 84, 84, 3, 3, 3, 3,
+        84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 195,
+        205, 4, 206, 206, 4, 4, 4, 207, 206, 206, 206, 206, 206, 206, 206, 206,
+        206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206,
+        206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206,
+        206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206, 206,
+};
+
+/// 三级表，每块 64 个码点，每字节存放两个 4 位属性值
+static const uint8_t GraphemeStage3[6656] = {
+        51, 51, 51, 51, 51, 50, 19, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48,
+        51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+        0, 0, 0, 0, 224, 0, 48, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+        68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+        68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+        68, 68, 68, 68, 68, 68, 68, 68, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 64, 68, 68, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 64, 68, 68, 68, 68, 68, 68, 68,
+        68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 64,
+        64, 4, 68, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        119, 119, 119, 0, 0, 0, 0, 0, 68, 68, 68, 68, 68, 4, 3, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 64, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+        0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 68, 68, 116, 64,
+        68, 68, 4, 64, 4, 68, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 112, 64, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 68, 68, 68, 68, 68, 68, 68, 68,
+        68, 68, 68, 68, 68, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 68, 68, 68, 68, 68, 4, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 64, 68, 68, 68, 68, 0, 0, 0, 0, 64, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 68, 64, 68, 68,
+        68, 68, 64, 68, 64, 68, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 68, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 119, 0, 0, 0, 68, 68, 68, 68,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+        68, 71, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+        68, 132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 132, 4, 136,
+        72, 68, 68, 68, 132, 136, 72, 136, 64, 68, 68, 68, 0, 0, 0, 0,
+        0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        64, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 132,
+        72, 68, 4, 128, 8, 128, 72, 0, 0, 0, 0, 64, 0, 0, 0, 0,
+        0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+        64, 132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 136,
+        72, 4, 0, 64, 4, 64, 68, 0, 64, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 68, 0, 64, 0, 0, 0, 0, 0,
+        72, 68, 68, 64, 132, 128, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 68, 68,
+        64, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 68,
+        72, 68, 4, 128, 8, 128, 72, 0, 0, 0, 64, 68, 0, 0, 0, 0,
+        0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 132,
+        132, 8, 0, 136, 8, 136, 72, 0, 0, 0, 0, 64, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        132, 136, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 68,
+        132, 136, 8, 68, 4, 68, 68, 0, 0, 0, 64, 4, 0, 0, 0, 0,
+        0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        64, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 72,
+        136, 132, 8, 132, 8, 136, 68, 0, 0, 0, 64, 4, 0, 0, 0, 0,
+        0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        68, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 4, 132,
+        72, 68, 4, 136, 8, 136, 72, 7, 0, 0, 0, 64, 0, 0, 0, 0,
+        0, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        64, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 4, 0, 64, 136, 68, 4, 4, 136, 136, 136, 72,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 64, 128, 68, 68, 68, 4, 0, 0,
+        0, 0, 0, 64, 68, 68, 68, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 64, 128, 68, 68, 68, 68, 4, 0,
+        0, 0, 0, 0, 68, 68, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 64, 64, 0, 0, 136,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 64, 68, 68, 68, 68, 68, 68, 132,
+        68, 68, 4, 68, 0, 0, 64, 68, 68, 68, 68, 68, 64, 68, 68, 68,
+        68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 4, 0,
+        0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 64, 68, 132, 68, 68, 68, 64, 132, 72, 4,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 68, 0, 0, 68,
+        4, 0, 0, 0, 0, 0, 0, 0, 64, 68, 4, 0, 0, 0, 0, 0,
+        0, 4, 72, 4, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 64, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+        153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+        170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+        170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+        170, 170, 170, 170, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+        187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+        187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 68,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 132, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 8, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 72, 68, 68, 68, 136,
+        136, 136, 136, 132, 72, 68, 68, 68, 68, 68, 0, 0, 0, 0, 64, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 64, 68, 67, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 64, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        68, 132, 136, 72, 132, 136, 0, 0, 136, 132, 136, 136, 72, 68, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 132, 72, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 132, 68, 68, 68, 4,
+        4, 4, 64, 68, 68, 68, 132, 136, 136, 72, 68, 68, 68, 68, 4, 64,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 68, 68, 68, 68, 68, 68, 68, 68,
+        68, 68, 68, 68, 68, 68, 68, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        68, 68, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 68, 68, 132, 132, 136,
+        136, 132, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 64, 68, 68, 68, 68, 0, 0, 0, 0, 0, 0,
+        68, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        128, 68, 68, 136, 68, 72, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 132, 68, 136, 72, 72, 68, 136, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 136, 136, 136, 136, 68, 68, 68, 68, 136, 68, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 68, 4, 68, 68, 68, 68, 68, 68,
+        132, 68, 68, 68, 4, 0, 64, 0, 0, 0, 4, 128, 68, 0, 0, 0,
+        0, 0, 0, 0, 0, 48, 84, 51, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 51, 51, 51, 3, 0, 0, 0, 0, 0, 0, 14, 0,
+        0, 0, 0, 0, 224, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        51, 51, 51, 51, 51, 51, 51, 51, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 68, 68, 68, 68, 68, 68, 68, 68,
+        68, 68, 68, 68, 68, 68, 68, 68, 4, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 238, 238, 238, 0, 0, 0,
+        0, 0, 0, 0, 224, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 238, 0, 0,
+        0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 224, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 224, 238, 238, 238, 238, 238, 0, 0, 238, 14, 0, 0,
+        0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 238, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0,
+        14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 238, 14,
+        238, 238, 238, 224, 238, 238, 238, 238, 238, 14, 238, 238, 238, 238, 238, 238,
+        238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+        238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+        238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+        238, 238, 238, 0, 0, 0, 0, 0, 238, 238, 238, 238, 238, 238, 238, 238,
+        238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+        238, 238, 238, 0, 238, 238, 238, 238, 238, 14, 14, 14, 0, 0, 224, 0,
+        224, 0, 0, 0, 14, 0, 0, 0, 0, 224, 14, 0, 0, 0, 0, 0,
+        0, 0, 14, 224, 0, 0, 14, 14, 0, 224, 238, 224, 0, 0, 0, 0,
+        0, 224, 238, 238, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 238, 0, 0, 0, 0,
+        224, 0, 0, 0, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 224,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 238, 0, 0, 0, 0, 0,
+        0, 0, 224, 238, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 14, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 14, 0, 224, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 64, 68, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 68, 68, 68, 14, 0, 0, 0, 0, 0, 224, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 4, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 224, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 64, 68, 4, 68, 68, 68, 68, 68, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 68, 0, 0, 0, 0, 0, 0, 0,
+        0, 4, 0, 4, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 128, 72, 132, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 136, 136, 136, 136, 136, 136,
+        136, 136, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        68, 68, 68, 68, 68, 68, 68, 68, 68, 0, 0, 0, 0, 0, 0, 64,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 68, 68, 68, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 64, 68, 68, 68, 68, 68, 136, 0, 0, 0, 0, 0, 0,
+        153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 9, 0,
+        68, 132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 136, 68, 68, 136, 68, 136,
+        8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 64, 68, 68, 132, 72, 132, 72, 4, 0, 0, 0, 0,
+        0, 64, 0, 0, 0, 0, 132, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4, 68, 4, 64, 4, 0, 0, 68,
+        64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 128, 68, 136, 0, 0, 128, 4, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 128, 72, 136, 132, 8, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        220, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 220, 221,
+        221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 220, 221, 221, 221,
+        221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 220, 221, 221, 221, 221, 221,
+        221, 221, 221, 221, 221, 221, 221, 221, 220, 221, 221, 221, 221, 221, 221, 221,
+        221, 221, 221, 221, 221, 221, 220, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+        221, 221, 221, 221, 220, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+        221, 221, 220, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+        220, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 220, 221,
+        221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 220, 221, 221, 221,
+        221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 220, 221, 221, 221, 221, 221,
+        221, 221, 221, 221, 221, 221, 221, 221, 220, 221, 221, 221, 221, 221, 221, 221,
+        221, 221, 221, 221, 221, 221, 220, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+        221, 221, 221, 221, 220, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+        221, 221, 220, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+        221, 221, 221, 221, 220, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+        221, 221, 0, 0, 0, 0, 0, 0, 170, 170, 170, 170, 170, 170, 170, 170,
+        170, 170, 170, 10, 0, 176, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+        187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        68, 68, 68, 68, 68, 68, 68, 68, 0, 0, 0, 0, 0, 0, 0, 0,
+        68, 68, 68, 68, 68, 68, 68, 68, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 51, 51, 51, 51, 51, 51, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 68, 4, 0, 0,
+        64, 68, 64, 4, 0, 0, 68, 68, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 4, 0, 64,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 64, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 68, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 64, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 68, 68, 68, 68, 68, 4, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 68, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        72, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 68, 68, 68,
+        68, 68, 68, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 4, 64, 4, 0, 0, 0, 0, 64,
+        68, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 136, 72, 68, 132, 72, 4, 112, 0,
+        0, 4, 0, 0, 0, 0, 112, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        68, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 64, 68, 68, 72, 68, 68, 68, 4, 0, 0, 0, 0, 0,
+        0, 0, 128, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0,
+        68, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 136, 68, 68, 68, 68, 132,
+        8, 119, 0, 0, 64, 68, 4, 72, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 136, 72, 68, 136, 132, 68, 0, 0, 0, 4,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64,
+        136, 72, 68, 68, 68, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        132, 136, 8, 128, 8, 128, 136, 0, 0, 0, 0, 64, 0, 0, 0, 0,
+        0, 136, 0, 68, 68, 68, 4, 0, 68, 68, 4, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 136, 68, 68, 68, 68,
+        136, 68, 132, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 132, 72, 68, 68, 132, 132, 72, 72,
+        132, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 64, 136, 68, 68, 0, 136, 136, 68, 72,
+        4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 136, 72, 68, 68, 68, 132, 72, 72,
+        4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 64, 72, 136, 68, 68, 68, 72, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 68,
+        0, 68, 68, 72, 68, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 136, 72, 68, 68, 68, 68, 72, 4, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 132, 136, 136, 128, 8, 64, 132, 116,
+        120, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 128, 136, 68, 68, 0, 68, 136, 136,
+        4, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        64, 68, 68, 68, 68, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 68, 68, 132, 71, 68, 4,
+        0, 0, 0, 64, 0, 0, 0, 0, 64, 68, 68, 132, 72, 68, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 119, 119, 119, 68, 68, 68, 68, 68, 68, 132, 68, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 128, 68, 68, 68, 4, 68, 68, 68, 72,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 68, 68, 68, 68, 68, 68,
+        68, 68, 68, 68, 128, 68, 68, 68, 132, 68, 72, 4, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 64, 68, 68, 4, 0, 4, 68, 64,
+        68, 68, 68, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 136, 136, 8, 68, 128, 72, 72, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 132, 8, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 51, 51, 51, 51, 3, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 68, 68, 4, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 68, 68, 68, 4, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 64, 128, 136, 136, 136, 136, 136, 136, 136,
+        136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136, 136,
+        136, 136, 136, 136, 0, 0, 0, 64, 68, 4, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 4, 0, 0, 0, 0, 0, 136, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 4,
+        51, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+        68, 68, 68, 68, 68, 68, 68, 0, 68, 68, 68, 68, 68, 68, 68, 68,
+        68, 68, 68, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 64, 72, 68, 0, 128, 68, 68, 52, 51, 51, 51, 67, 68, 68,
+        68, 4, 64, 68, 68, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 68, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 68, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+        68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 4, 0, 64, 68, 68,
+        68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+        68, 68, 68, 68, 68, 68, 4, 0, 0, 0, 64, 0, 0, 0, 0, 0,
+        0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 68, 68,
+        64, 68, 68, 68, 68, 68, 68, 68, 0, 0, 0, 0, 0, 0, 0, 0,
+        68, 68, 68, 4, 68, 68, 68, 68, 68, 68, 68, 68, 4, 64, 68, 68,
+        68, 64, 4, 68, 68, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 68, 68, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 68, 68, 68, 4, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 68, 68, 68, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 224, 238, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 224, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 238, 238, 238, 0, 0, 0, 0, 0, 0, 238,
+        0, 0, 0, 0, 0, 0, 0, 14, 224, 238, 238, 238, 238, 14, 0, 0,
+        0, 0, 0, 0, 0, 0, 224, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+        238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+        238, 238, 238, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+        224, 238, 238, 238, 238, 238, 238, 238, 0, 0, 0, 0, 0, 14, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 224, 0, 238, 238, 238, 238, 14, 238, 238,
+        0, 0, 0, 0, 224, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+        238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+        238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+        238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 78, 68, 68,
+        238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+        238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 0,
+        0, 0, 0, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+        238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+        238, 238, 238, 238, 238, 238, 238, 238, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 238, 238, 238, 238, 238, 238,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 224, 238, 238, 238, 238, 238,
+        238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+        0, 0, 0, 0, 0, 0, 238, 238, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 238, 238, 238, 238, 0, 0, 0, 0, 0, 238, 238, 238,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 238, 238, 238, 238, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+        0, 0, 0, 0, 0, 0, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+        238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 14, 238, 238,
+        238, 238, 238, 224, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+        238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+        51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+        68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+        51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+        51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+        68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+        68, 68, 68, 68, 68, 68, 68, 68, 51, 51, 51, 51, 51, 51, 51, 51,
+};
+
+#pragma endregion
+
+/// 单词断行属性（Word_Break）
+enum WordBreak : uint8_t {
+    WB_Other,
+    WB_CR,
+    WB_LF,
+    WB_Newline,
+    WB_Extend,
+    WB_ZWJ,
+    WB_RegionalIndicator,
+    WB_Format,
+    WB_Katakana,
+    WB_HebrewLetter,
+    WB_ALetter,
+    WB_SingleQuote,
+    WB_DoubleQuote,
+    WB_MidNumLet,
+    WB_MidLetter,
+    WB_MidNum,
+    WB_Numeric,
+    WB_ExtendNumLet,
+    WB_WSegSpace,
+};
+
+/// 句子断行属性（Sentence_Break）
+enum SentenceBreak : uint8_t {
+    SB_Other,
+    SB_CR,
+    SB_LF,
+    SB_Sep,
+    SB_Extend,
+    SB_Format,
+    SB_Sp,
+    SB_Lower,
+    SB_Upper,
+    SB_OLetter,
+    SB_Numeric,
+    SB_ATerm,
+    SB_SContinue,
+    SB_STerm,
+    SB_Close,
+};
+
+struct SegmentProperty {
+    WordBreak word;
+    SentenceBreak sentence;
+};
+
+#pragma region SegmentTable
+
+// 由 Unicode 14.0 WordBreakProperty.txt 与 SentenceBreakProperty.txt 生成的三级查找表，
+// 两种属性只有 38 种组合，共用一张表
+
+/// 属性组合，阶段表中存放该数组的索引
+static const SegmentProperty SegmentProperties[38] = {
+        {WB_Other, SB_Other},
+        {WB_Other, SB_Format},
+        {WB_Other, SB_Sp},
+        {WB_Other, SB_OLetter},
+        {WB_Other, SB_SContinue},
+        {WB_Other, SB_STerm},
+        {WB_Other, SB_Close},
+        {WB_CR, SB_CR},
+        {WB_LF, SB_LF},
+        {WB_Newline, SB_Sep},
+        {WB_Newline, SB_Sp},
+        {WB_Extend, SB_Other},
+        {WB_Extend, SB_Extend},
+        {WB_ZWJ, SB_Extend},
+        {WB_RegionalIndicator, SB_Other},
+        {WB_Format, SB_Format},
+        {WB_Katakana, SB_Other},
+        {WB_Katakana, SB_OLetter},
+        {WB_HebrewLetter, SB_OLetter},
+        {WB_ALetter, SB_Other},
+        {WB_ALetter, SB_Lower},
+        {WB_ALetter, SB_Upper},
+        {WB_ALetter, SB_OLetter},
+        {WB_SingleQuote, SB_Close},
+        {WB_DoubleQuote, SB_Close},
+        {WB_MidNumLet, SB_Other},
+        {WB_MidNumLet, SB_ATerm},
+        {WB_MidNumLet, SB_Close},
+        {WB_MidLetter, SB_Other},
+        {WB_MidLetter, SB_SContinue},
+        {WB_MidNum, SB_Other},
+        {WB_MidNum, SB_Numeric},
+        {WB_MidNum, SB_SContinue},
+        {WB_MidNum, SB_STerm},
+        {WB_Numeric, SB_Numeric},
+        {WB_ExtendNumLet, SB_Other},
+        {WB_ExtendNumLet, SB_Sp},
+        {WB_WSegSpace, SB_Sp},
+};
+
+/// 一级表，按 cp >> 10 索引
+static const uint8_t SegmentStage1[1088] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 13, 13,
+        13, 13, 13, 14, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 15, 16, 17, 15, 15, 15, 15, 15,
+        15, 15, 15, 15, 15, 18, 19, 19, 19, 19, 19, 19, 19, 19, 20, 21,
+        22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 19, 32, 15, 33, 19, 19,
+        19, 34, 19, 19, 19, 19, 19, 19, 19, 19, 35, 36, 13, 13, 13, 13,
+        13, 37, 13, 38, 19, 19, 19, 19, 19, 19, 19, 39, 40, 19, 19, 41,
+        19, 19, 19, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 19,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 54, 13, 13, 13, 55, 56, 13,
+        13, 13, 13, 57, 13, 13, 13, 13, 13, 13, 58, 19, 19, 19, 59, 19,
+        13, 13, 13, 13, 60, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        61, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+};
+
+/// 二级表，每块 32 项，按 (cp >> 5) & 31 索引
+static const uint16_t SegmentStage2[1984] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+        8, 16, 17, 18, 19, 20, 21, 22, 23, 23, 23, 24, 25, 26, 27, 28,
+        29, 30, 18, 8, 31, 8, 32, 8, 8, 33, 34, 18, 35, 36, 37, 38,
+        39, 40, 41, 42, 40, 40, 43, 44, 45, 46, 47, 40, 40, 48, 49, 50,
+        51, 52, 53, 54, 55, 40, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65,
+        66, 67, 68, 69, 70, 71, 72, 73, 74, 71, 75, 76, 77, 78, 79, 80,
+        81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96,
+        97, 98, 99, 100, 101, 102, 103, 100, 104, 105, 106, 107, 108, 109, 110, 100,
+        111, 112, 113, 114, 115, 29, 116, 117, 40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 118, 40, 119, 120, 121, 40, 122, 40, 123, 124, 125, 29, 29, 126,
+        127, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 128, 129, 40, 40, 130, 131, 132, 133, 134, 111, 135, 136, 137,
+        138, 40, 40, 139, 140, 141, 40, 142, 143, 144, 145, 146, 111, 147, 148, 100,
+        149, 111, 150, 151, 152, 153, 154, 100, 155, 156, 157, 158, 159, 160, 40, 161,
+        40, 162, 163, 164, 165, 166, 167, 168, 18, 18, 18, 18, 18, 18, 23, 23,
+        8, 8, 8, 8, 169, 8, 8, 8, 170, 171, 172, 173, 171, 174, 175, 176,
+        177, 178, 179, 180, 181, 100, 182, 183, 184, 185, 186, 30, 187, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 188, 189, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 190, 30, 191, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 192, 193, 100, 100, 194, 195,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 196, 100, 197, 198,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        29, 30, 18, 199, 8, 8, 8, 200, 18, 201, 40, 202, 203, 204, 204, 23,
+        205, 206, 207, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        208, 209, 97, 111, 210, 211, 212, 213, 214, 215, 40, 40, 216, 40, 100, 217,
+        100, 100, 100, 100, 100, 100, 218, 219, 220, 220, 221, 100, 100, 100, 100, 100,
+        111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+        111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+        111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 100, 100,
+        111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+        40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 222, 100, 223, 224, 40, 40, 40, 40, 40, 40, 40, 40,
+        225, 226, 8, 227, 228, 40, 40, 229, 230, 231, 8, 232, 233, 234, 235, 236,
+        237, 238, 40, 239, 240, 156, 241, 242, 49, 243, 244, 245, 58, 246, 247, 248,
+        40, 249, 250, 251, 111, 252, 253, 254, 255, 256, 257, 258, 18, 18, 40, 259,
+        40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 260, 261, 262,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 111, 111, 111, 111, 111, 111, 111, 111,
+        111, 111, 111, 263, 111, 111, 264, 100, 265, 266, 267, 40, 40, 268, 269, 40,
+        40, 40, 40, 40, 40, 40, 40, 40, 40, 270, 223, 40, 271, 40, 272, 273,
+        274, 275, 276, 277, 40, 40, 40, 278, 279, 2, 280, 281, 282, 143, 283, 284,
+        285, 286, 287, 100, 40, 40, 40, 288, 100, 100, 40, 289, 100, 100, 100, 290,
+        100, 100, 100, 100, 245, 40, 291, 292, 40, 293, 54, 294, 295, 40, 296, 100,
+        29, 297, 298, 40, 295, 299, 300, 301, 40, 302, 40, 303, 304, 305, 100, 100,
+        40, 40, 40, 40, 40, 40, 40, 40, 40, 203, 142, 272, 306, 307, 100, 100,
+        308, 309, 142, 203, 143, 100, 100, 310, 142, 311, 100, 100, 40, 312, 100, 100,
+        313, 314, 315, 245, 245, 100, 106, 316, 40, 142, 142, 317, 268, 100, 100, 100,
+        40, 40, 318, 100, 29, 319, 18, 320, 40, 321, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 40, 322, 100, 100, 245, 323, 324, 223, 325, 223, 326, 203,
+        159, 327, 328, 329, 159, 330, 331, 332, 159, 333, 334, 335, 159, 246, 336, 100,
+        337, 338, 100, 100, 339, 340, 341, 342, 343, 344, 345, 346, 100, 100, 100, 100,
+        40, 347, 348, 349, 40, 46, 350, 100, 100, 100, 100, 100, 40, 351, 352, 100,
+        40, 46, 353, 100, 40, 354, 137, 100, 355, 356, 357, 100, 100, 100, 100, 100,
+        40, 358, 100, 100, 100, 29, 18, 359, 360, 361, 362, 100, 100, 363, 364, 365,
+        366, 367, 368, 40, 369, 223, 40, 139, 100, 100, 100, 100, 100, 100, 100, 100,
+        370, 371, 372, 373, 374, 375, 100, 100, 376, 377, 378, 379, 380, 137, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 381, 100, 100, 100, 100, 100, 382, 100, 100,
+        40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 311, 100, 100, 100,
+        40, 40, 40, 216, 40, 40, 40, 40, 40, 40, 383, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 223, 40, 40, 291,
+        40, 384, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+        40, 40, 385, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+        40, 139, 143, 386, 40, 143, 387, 388, 40, 389, 390, 391, 125, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 29, 18, 392, 100, 100, 100, 40, 40, 393, 23, 394, 100, 100, 395,
+        111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+        111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 396,
+        111, 111, 111, 111, 111, 111, 397, 100, 398, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 399,
+        400, 111, 111, 111, 111, 111, 111, 111, 111, 401, 402, 403, 111, 111, 111, 111,
+        111, 111, 111, 111, 111, 111, 111, 404, 100, 100, 100, 100, 100, 100, 100, 100,
+        40, 40, 40, 405, 406, 407, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 23, 408, 409, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 410, 411, 412, 100, 100,
+        100, 100, 413, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        414, 415, 416, 417, 418, 419, 420, 421, 422, 423, 424, 425, 426, 414, 415, 427,
+        417, 428, 429, 430, 421, 431, 432, 433, 434, 435, 436, 437, 438, 439, 440, 441,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        23, 442, 23, 443, 444, 445, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 446, 100, 100, 100, 100, 100, 100, 100,
+        447, 448, 100, 100, 100, 100, 100, 100, 40, 449, 450, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 223, 451, 40, 452, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 453,
+        40, 40, 40, 40, 40, 40, 454, 100, 29, 455, 456, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        457, 458, 459, 460, 461, 462, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 463, 464, 464, 465, 100, 100, 466,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 467,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 468, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 469,
+        111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+        111, 111, 111, 111, 111, 111, 111, 100, 111, 111, 111, 111, 111, 111, 111, 111,
+        111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+        111, 111, 111, 111, 111, 111, 111, 111, 111, 470, 111, 111, 111, 111, 111, 111,
+        471, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+        111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+        111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+        111, 111, 111, 111, 111, 472, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+        111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+        111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 473,
+        111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+        471, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+        111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+        111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 474, 100, 100, 100, 100, 100,
+        475, 23, 23, 23, 100, 100, 100, 100, 23, 23, 23, 23, 23, 23, 23, 476,
+        100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100, 100,
+};
+
+/// 三级表，每块 32 个码点
+static const uint8_t SegmentStage3[15264] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 8, 10, 10, 7, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        37, 5, 24, 0, 0, 0, 0, 23, 6, 6, 0, 0, 32, 4, 26, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 29, 30, 0, 0, 0, 5,
+        0, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 6, 0, 6, 0, 35,
+        0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 6, 0, 6, 0, 0,
+        0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 6, 0, 15, 0, 0,
+        0, 0, 0, 0, 0, 20, 0, 28, 0, 0, 20, 6, 0, 0, 0, 0,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 0, 21, 21, 21, 21, 21, 21, 21, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 20,
+        21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20,
+        21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20,
+        21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20,
+        21, 20, 21, 20, 21, 20, 21, 20, 20, 21, 20, 21, 20, 21, 20, 21,
+        20, 21, 20, 21, 20, 21, 20, 21, 20, 20, 21, 20, 21, 20, 21, 20,
+        21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20,
+        21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20,
+        21, 20, 21, 20, 21, 20, 21, 20, 21, 21, 20, 21, 20, 21, 20, 20,
+        20, 21, 21, 20, 21, 20, 21, 21, 20, 21, 21, 21, 20, 20, 21, 21,
+        21, 21, 20, 21, 21, 20, 21, 21, 21, 20, 20, 20, 21, 21, 20, 21,
+        21, 20, 21, 20, 21, 20, 21, 21, 20, 21, 20, 20, 21, 20, 21, 21,
+        20, 21, 21, 21, 20, 21, 20, 21, 21, 20, 20, 22, 21, 20, 20, 20,
+        22, 22, 22, 22, 21, 21, 20, 21, 21, 20, 21, 21, 20, 21, 20, 21,
+        20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 20, 21, 20,
+        21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20,
+        20, 21, 21, 20, 21, 20, 21, 21, 21, 20, 21, 20, 21, 20, 21, 20,
+        21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20,
+        21, 20, 21, 20, 20, 20, 20, 20, 20, 20, 21, 21, 20, 21, 21, 20,
+        20, 21, 20, 21, 21, 21, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 22, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 22, 22, 22, 22, 22, 22, 22,
+        20, 20, 19, 19, 19, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 19, 19, 19, 19, 19, 19, 0, 0, 0, 0, 0, 0, 19, 19,
+        20, 20, 20, 20, 20, 19, 19, 19, 19, 19, 19, 19, 22, 19, 22, 19,
+        19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        21, 20, 21, 20, 22, 0, 21, 20, 0, 0, 20, 20, 20, 20, 30, 21,
+        0, 0, 0, 0, 0, 0, 21, 28, 21, 21, 21, 0, 21, 0, 21, 21,
+        20, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 0, 21, 21, 21, 21, 21, 21, 21, 21, 21, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 21,
+        20, 20, 21, 21, 21, 20, 20, 20, 21, 20, 21, 20, 21, 20, 21, 20,
+        21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20,
+        20, 20, 20, 20, 21, 20, 0, 21, 20, 21, 21, 20, 20, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        21, 20, 0, 12, 12, 12, 12, 12, 12, 12, 21, 20, 21, 20, 21, 20,
+        21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20,
+        21, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 20,
+        21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20,
+        21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20,
+        0, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 0, 0, 22, 19, 19, 19, 4, 19, 28,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 33, 19, 0, 0, 0, 0, 0,
+        0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 12,
+        0, 12, 12, 0, 12, 12, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 18,
+        18, 18, 18, 22, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        15, 15, 15, 15, 15, 15, 0, 0, 0, 0, 0, 0, 32, 32, 0, 0,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 15, 5, 5, 5,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 34, 31, 0, 22, 22,
+        12, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 5, 22, 12, 12, 12, 12, 12, 12, 12, 15, 0, 12,
+        12, 12, 12, 12, 12, 22, 22, 12, 12, 0, 12, 12, 12, 12, 22, 22,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 22, 22, 22, 0, 0, 22,
+        5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15,
+        22, 12, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 22, 22, 0, 0, 32, 5, 22, 0, 0, 12, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 12, 12, 12, 12, 22, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 22, 12, 12, 12, 22, 12, 12, 12, 12, 12, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 5, 0, 5, 0, 0, 0, 5, 5, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 12, 12, 12, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22, 0,
+        15, 15, 0, 0, 0, 0, 0, 0, 12, 12, 12, 12, 12, 12, 12, 12,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 15, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 12, 12, 12, 22, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        22, 12, 12, 12, 12, 12, 12, 12, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 12, 12, 5, 5, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 12, 12, 12, 0, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 22,
+        22, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22,
+        22, 0, 22, 0, 0, 0, 22, 22, 22, 22, 0, 0, 12, 22, 12, 12,
+        12, 12, 12, 12, 12, 0, 0, 12, 12, 0, 0, 12, 12, 12, 22, 0,
+        0, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 22, 22, 0, 22,
+        22, 22, 12, 12, 0, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 12, 0,
+        0, 12, 12, 12, 0, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 22,
+        22, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22,
+        22, 0, 22, 22, 0, 22, 22, 0, 22, 22, 0, 0, 12, 0, 12, 12,
+        12, 12, 12, 0, 0, 0, 0, 12, 12, 0, 0, 12, 12, 12, 0, 0,
+        0, 12, 0, 0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 0, 22, 0,
+        0, 0, 0, 0, 0, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        12, 12, 22, 22, 22, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 12, 12, 12, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22,
+        22, 22, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22,
+        22, 0, 22, 22, 0, 22, 22, 22, 22, 22, 0, 0, 12, 22, 12, 12,
+        12, 12, 12, 12, 12, 12, 0, 12, 12, 12, 0, 12, 12, 12, 0, 0,
+        22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 12, 12, 0, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 12, 12, 12, 12, 12, 12,
+        0, 12, 12, 12, 0, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 22,
+        22, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        12, 12, 12, 12, 12, 0, 0, 12, 12, 0, 0, 12, 12, 12, 0, 0,
+        0, 0, 0, 0, 0, 12, 12, 12, 0, 0, 0, 0, 22, 22, 0, 22,
+        22, 22, 12, 12, 0, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 12, 22, 0, 22, 22, 22, 22, 22, 22, 0, 0, 0, 22, 22,
+        22, 0, 22, 22, 22, 22, 0, 0, 0, 22, 22, 0, 22, 0, 22, 22,
+        0, 0, 0, 22, 22, 0, 0, 0, 22, 22, 22, 0, 0, 0, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 12, 12,
+        12, 12, 12, 0, 0, 0, 12, 12, 12, 0, 12, 12, 12, 12, 0, 0,
+        22, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        12, 12, 12, 12, 12, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22,
+        22, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 12, 22, 12, 12,
+        12, 12, 12, 12, 12, 0, 12, 12, 12, 0, 12, 12, 12, 12, 0, 0,
+        0, 0, 0, 0, 0, 12, 12, 0, 22, 22, 22, 0, 0, 22, 0, 0,
+        22, 22, 12, 12, 0, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 12, 12, 12, 0, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22,
+        22, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 0, 0, 12, 22, 12, 12,
+        12, 12, 12, 12, 12, 0, 12, 12, 12, 0, 12, 12, 12, 12, 0, 0,
+        0, 0, 0, 0, 0, 12, 12, 0, 0, 0, 0, 0, 0, 22, 22, 0,
+        22, 22, 12, 12, 0, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        0, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        12, 12, 12, 12, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22,
+        22, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 12, 12, 22, 12, 12,
+        12, 12, 12, 12, 12, 0, 12, 12, 12, 0, 12, 12, 12, 12, 22, 0,
+        0, 0, 0, 0, 22, 22, 22, 12, 0, 0, 0, 0, 0, 0, 0, 22,
+        22, 22, 12, 12, 0, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22,
+        0, 12, 12, 12, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 12, 0, 0, 0, 0, 12,
+        12, 12, 12, 12, 12, 0, 12, 0, 12, 12, 12, 12, 12, 12, 12, 12,
+        0, 0, 0, 0, 0, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        0, 0, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 12, 3, 3, 12, 12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 12, 12, 12, 12, 12, 12, 12, 12, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 3, 3, 0, 3, 0, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 0, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 12, 3, 3, 12, 12, 12, 12, 12, 12, 12, 12, 12, 3, 0, 0,
+        3, 3, 3, 3, 3, 0, 3, 0, 12, 12, 12, 12, 12, 12, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 3, 3, 3, 3,
+        22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 12, 12, 0, 0, 0, 0, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 12, 0, 12, 0, 12, 6, 6, 6, 6, 12, 12,
+        22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0,
+        0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 0, 12, 12, 22, 22, 22, 22, 22, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 0, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 3,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 5, 5, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 12, 12, 12, 12, 3, 3, 3, 3, 12, 12,
+        12, 3, 12, 12, 12, 3, 3, 12, 12, 12, 12, 12, 12, 12, 3, 3,
+        3, 12, 12, 12, 12, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 3, 12,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 12, 12, 12, 12, 0, 0,
+        21, 21, 21, 21, 21, 21, 0, 21, 0, 0, 0, 0, 0, 21, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 0, 22, 0, 22, 22, 22, 22, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 0, 22, 22, 22, 22, 0, 0, 22, 22, 22, 22, 22, 22, 22, 0,
+        22, 0, 22, 22, 22, 22, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 0, 22, 22, 22, 22, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 12, 12, 12,
+        0, 0, 5, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 0, 0, 20, 20, 20, 20, 20, 20, 0, 0,
+        0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 5, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        37, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 6, 6, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 12, 12, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 12, 12, 12, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22,
+        22, 0, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 0, 0, 0, 3, 0, 0, 0, 0, 3, 12, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 4, 5, 0, 0, 0, 0, 4, 5, 0, 12, 12, 12, 15, 12,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 12, 12, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 12, 22, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0, 0, 0,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0, 0, 0,
+        0, 0, 0, 0, 5, 5, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0,
+        3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 12, 12, 12, 12, 12, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0, 12,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 3, 5, 5, 5, 5, 0, 0, 0, 0,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        12, 12, 12, 12, 12, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 5, 5, 0, 0, 5, 5,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0,
+        12, 12, 12, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 22, 22,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 0, 0, 0, 5, 5, 0, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 22, 22, 22,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 5, 5,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 22, 22, 22,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        12, 12, 12, 0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 22, 22, 22, 22, 12, 22, 22,
+        22, 22, 22, 22, 12, 22, 22, 12, 12, 12, 22, 0, 0, 0, 0, 0,
+        21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20,
+        21, 20, 21, 20, 21, 20, 20, 20, 20, 20, 20, 20, 20, 20, 21, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21,
+        20, 20, 20, 20, 20, 20, 0, 0, 21, 21, 21, 21, 21, 21, 0, 0,
+        20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21,
+        20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21,
+        20, 20, 20, 20, 20, 20, 0, 0, 21, 21, 21, 21, 21, 21, 0, 0,
+        20, 20, 20, 20, 20, 20, 20, 20, 0, 21, 0, 21, 0, 21, 0, 21,
+        20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0,
+        20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21,
+        20, 20, 20, 20, 20, 0, 20, 20, 21, 21, 21, 21, 21, 0, 20, 0,
+        0, 0, 20, 20, 20, 0, 20, 20, 21, 21, 21, 21, 21, 0, 0, 0,
+        20, 20, 20, 20, 0, 0, 20, 20, 21, 21, 21, 21, 0, 0, 0, 0,
+        20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 0, 0, 0,
+        0, 0, 20, 20, 20, 0, 20, 20, 21, 21, 21, 21, 21, 0, 0, 0,
+        37, 37, 37, 37, 37, 37, 37, 2, 37, 37, 37, 1, 12, 13, 15, 15,
+        0, 0, 0, 4, 4, 0, 0, 0, 27, 27, 6, 6, 6, 6, 6, 6,
+        0, 0, 0, 0, 26, 0, 0, 28, 9, 9, 15, 15, 15, 15, 15, 36,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 5, 5, 0, 35,
+        35, 0, 0, 0, 30, 6, 6, 5, 5, 5, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37,
+        15, 15, 15, 15, 15, 0, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 20,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 21, 0, 0, 0, 0, 21, 0, 0, 20, 21, 21, 21, 20, 20,
+        21, 21, 21, 20, 0, 21, 0, 0, 0, 21, 21, 21, 21, 21, 0, 0,
+        0, 0, 0, 0, 21, 0, 21, 0, 21, 0, 21, 21, 21, 21, 0, 20,
+        21, 21, 21, 21, 20, 22, 22, 22, 22, 20, 0, 0, 20, 20, 21, 21,
+        0, 0, 0, 0, 0, 21, 20, 20, 20, 20, 0, 0, 0, 0, 20, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 21, 20, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6,
+        6, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 0,
+        21, 20, 21, 21, 21, 20, 20, 21, 20, 21, 20, 21, 20, 21, 21, 21,
+        21, 20, 21, 20, 20, 21, 20, 20, 20, 20, 20, 20, 20, 20, 21, 21,
+        21, 20, 21, 20, 20, 0, 0, 0, 0, 0, 0, 21, 20, 21, 20, 12,
+        12, 12, 21, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        20, 20, 20, 20, 20, 20, 0, 20, 0, 0, 0, 0, 0, 20, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 22,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22, 22, 0,
+        22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22, 22, 0,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 0,
+        6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 5, 22,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0,
+        0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0,
+        37, 4, 5, 0, 0, 22, 3, 3, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6, 0, 6, 6, 6,
+        0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 12, 12, 12, 12, 12, 12,
+        0, 17, 17, 17, 17, 17, 0, 0, 3, 3, 3, 22, 22, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 0, 0, 12, 12, 16, 16, 3, 3, 3,
+        16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 0, 17, 17, 17, 17,
+        0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+        16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 5,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 5, 5,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 22, 22, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 22, 12,
+        12, 12, 12, 0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 22,
+        21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20,
+        21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 20, 20, 12, 12,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        12, 12, 0, 5, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 19, 19, 19, 19, 19, 19, 19, 19,
+        19, 19, 19, 19, 19, 19, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        19, 19, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20,
+        20, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20,
+        21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 21, 20, 21, 20, 21, 21, 20,
+        21, 20, 21, 20, 21, 20, 21, 20, 22, 19, 19, 21, 20, 21, 20, 22,
+        21, 20, 21, 20, 20, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20,
+        21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 21, 21, 21, 21, 20,
+        21, 21, 21, 21, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20, 21, 20,
+        21, 20, 21, 20, 21, 21, 21, 21, 20, 21, 20, 0, 0, 0, 0, 0,
+        21, 20, 0, 20, 0, 20, 21, 20, 21, 20, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 22, 22, 22, 21, 20, 22, 20, 20, 20, 22, 22, 22, 22, 22,
+        22, 22, 12, 22, 22, 22, 12, 22, 22, 22, 22, 12, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 12, 12, 12, 12, 12, 0, 0, 0, 0, 12, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+        12, 12, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 22, 22, 22, 22, 22, 22, 0, 0, 0, 22, 0, 22, 22, 12,
+        22, 22, 22, 22, 22, 22, 12, 12, 12, 12, 12, 12, 12, 12, 0, 5,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 22,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 12, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 3, 3, 3, 3, 3, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 12, 22, 22, 22, 22, 22, 22, 22, 22, 12, 12, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 5, 5, 5,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 3, 12, 12, 12, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        12, 3, 12, 12, 12, 3, 3, 12, 12, 3, 3, 3, 3, 3, 12, 12,
+        3, 12, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 12, 12, 12, 12, 12,
+        5, 5, 22, 22, 22, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 22, 22, 22, 22, 22, 22, 0, 0, 22, 22, 22, 22, 22, 22, 0,
+        0, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22, 22, 0,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 19, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 22, 0, 0, 0, 0, 0, 0,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        22, 22, 22, 12, 12, 12, 12, 12, 12, 12, 12, 5, 12, 12, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
+        20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 18, 12, 18,
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18, 18, 18, 18, 0, 18, 18, 18, 18, 18, 0, 18, 0,
+        18, 18, 0, 18, 18, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 6, 6,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        32, 4, 0, 29, 30, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        0, 4, 4, 35, 35, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+        6, 6, 6, 6, 6, 0, 0, 6, 6, 0, 0, 0, 0, 35, 35, 35,
+        32, 4, 26, 0, 30, 29, 5, 5, 4, 6, 6, 6, 6, 6, 6, 0,
+        0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 15,
+        0, 5, 0, 0, 0, 0, 0, 25, 6, 6, 0, 0, 32, 4, 26, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 29, 30, 0, 0, 0, 5,
+        0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 6, 0, 6, 0, 6,
+        6, 5, 6, 6, 4, 0, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 12, 12,
+        0, 0, 22, 22, 22, 22, 22, 22, 0, 0, 22, 22, 22, 22, 22, 22,
+        0, 0, 22, 22, 22, 22, 22, 22, 0, 0, 22, 22, 22, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 0, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0,
+        22, 22, 22, 22, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22,
+        0, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 21, 21, 21, 21, 21, 21, 21, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 0, 0, 0, 0, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 0, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 0, 21, 21, 21, 21,
+        21, 21, 21, 0, 21, 21, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 0, 20, 20, 0, 0, 0,
+        20, 22, 22, 20, 20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 0, 0, 22, 0, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 0, 22, 22, 0, 0, 0, 22, 0, 0, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 0, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 22, 22,
+        22, 12, 12, 12, 0, 12, 12, 0, 0, 0, 0, 0, 12, 12, 12, 12,
+        22, 22, 22, 22, 0, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 0, 0, 12, 12, 12, 0, 0, 0, 0, 12,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 12, 12, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 12, 12, 0, 0, 0,
+        22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 0, 0, 0, 0, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0,
+        22, 22, 12, 12, 12, 12, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 5, 5, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        12, 22, 22, 12, 12, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0, 15, 5, 5,
+        5, 5, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        0, 5, 5, 5, 22, 12, 12, 22, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 12, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        12, 22, 22, 22, 22, 5, 5, 0, 0, 12, 12, 12, 12, 5, 12, 12,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 22, 0, 22, 0, 5, 5,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 5, 5, 0, 5, 5, 0, 12, 0,
+        22, 22, 22, 22, 22, 22, 22, 0, 22, 0, 22, 22, 22, 22, 0, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 5, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        12, 12, 12, 12, 0, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 22,
+        22, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22,
+        22, 0, 22, 22, 0, 22, 22, 22, 22, 22, 0, 12, 12, 22, 12, 12,
+        12, 12, 12, 12, 12, 0, 0, 12, 12, 0, 0, 12, 12, 12, 0, 0,
+        22, 0, 0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 22, 22, 22,
+        22, 22, 12, 12, 0, 0, 12, 12, 12, 12, 12, 12, 12, 0, 0, 0,
+        12, 12, 12, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 22, 22, 22, 22, 5, 5, 0, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 12, 22,
+        22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        12, 12, 12, 12, 22, 22, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 12,
+        12, 12, 12, 12, 12, 12, 0, 0, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 0, 5, 5, 0, 0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 22, 22, 22, 22, 12, 12, 0, 0,
+        12, 5, 5, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 22, 0, 0, 0, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 5, 5, 5, 0,
+        3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22,
+        22, 22, 22, 22, 22, 22, 22, 0, 0, 22, 0, 0, 22, 22, 22, 22,
+        22, 22, 22, 22, 0, 22, 22, 0, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        12, 12, 12, 12, 12, 12, 0, 12, 12, 0, 0, 12, 12, 12, 12, 22,
+        12, 22, 12, 12, 5, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 12, 12, 12, 12, 12, 12, 12, 0, 0, 12, 12, 12, 12, 12, 12,
+        12, 22, 0, 22, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 12, 12, 12, 12, 12, 12, 12, 22, 12, 12, 12, 12, 0,
+        0, 0, 5, 5, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 5, 5, 22, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 12,
+        12, 12, 12, 12, 12, 12, 12, 0, 12, 12, 12, 12, 12, 12, 12, 12,
+        22, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        0, 0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 0, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 0, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 12, 12, 12, 12, 12, 12, 0, 0, 0, 12, 0, 12, 12, 0, 12,
+        12, 12, 12, 12, 12, 12, 22, 12, 0, 0, 0, 0, 0, 0, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 0, 22, 22, 0, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 12, 12, 12, 12, 12, 0,
+        12, 12, 0, 12, 12, 12, 12, 12, 22, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 12, 12, 12, 12, 5, 5, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0,
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 5, 5,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0,
+        12, 12, 12, 12, 12, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        12, 12, 12, 12, 12, 12, 12, 5, 5, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 22, 22, 22,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 12,
+        22, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0, 0, 0, 12,
+        12, 12, 12, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 0, 22, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        17, 17, 17, 17, 0, 17, 17, 17, 17, 17, 17, 17, 0, 17, 17, 0,
+        17, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 12, 12, 5,
+        15, 15, 15, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 12, 12, 12, 12, 12, 0, 0, 0, 12, 12, 12,
+        12, 12, 12, 15, 15, 15, 15, 15, 15, 15, 15, 12, 12, 12, 12, 12,
+        12, 12, 12, 0, 0, 12, 12, 12, 12, 12, 12, 12, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 12, 12, 12, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 12, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 20, 20,
+        20, 20, 20, 20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 21, 0, 21, 21,
+        0, 0, 21, 0, 0, 21, 21, 0, 0, 21, 21, 21, 21, 0, 21, 21,
+        21, 21, 21, 21, 21, 21, 20, 20, 20, 20, 0, 20, 0, 20, 20, 20,
+        20, 20, 20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 21, 21, 0, 21, 21, 21, 21, 0, 0, 21, 21, 21,
+        21, 21, 21, 21, 21, 0, 21, 21, 21, 21, 21, 21, 21, 0, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 0, 21, 21, 21, 21, 0,
+        21, 21, 21, 21, 21, 0, 21, 0, 0, 0, 21, 21, 21, 21, 21, 21,
+        21, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        21, 21, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        20, 20, 20, 20, 20, 20, 0, 0, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 20, 20, 20, 20,
+        20, 20, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 0, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 0, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0,
+        20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 0,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 20, 20, 20, 20, 20, 20,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 0, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 0, 20, 20, 20, 20, 20, 20, 21, 20, 0, 0, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0, 0,
+        0, 0, 0, 0, 0, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 12, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 12, 12, 12, 12,
+        0, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 22, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0,
+        12, 12, 12, 12, 12, 12, 12, 0, 12, 12, 12, 12, 12, 12, 12, 12,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 0, 0, 12, 12, 12, 12, 12,
+        12, 12, 0, 12, 12, 0, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0,
+        12, 12, 12, 12, 12, 12, 12, 22, 22, 22, 22, 22, 22, 22, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 22, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 12, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 12, 12, 12, 12,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 0, 22, 22, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0,
+        22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        12, 12, 12, 12, 12, 12, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 21, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+        20, 20, 20, 20, 12, 12, 12, 12, 12, 12, 12, 22, 0, 0, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+        0, 22, 22, 0, 22, 0, 0, 22, 0, 22, 22, 22, 22, 22, 22, 22,
+        22, 22, 22, 0, 22, 22, 22, 22, 0, 22, 0, 22, 0, 0, 0, 0,
+        0, 0, 22, 0, 0, 0, 0, 22, 0, 22, 0, 22, 0, 22, 22, 22,
+        0, 22, 22, 0, 22, 0, 0, 22, 0, 22, 0, 22, 0, 22, 0, 22,
+        0, 22, 22, 0, 22, 0, 0, 22, 22, 22, 22, 0, 22, 22, 22, 22,
+        22, 22, 22, 0, 22, 22, 22, 22, 0, 22, 22, 22, 22, 0, 22, 0,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0,
+        0, 22, 22, 22, 0, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22,
+        22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 0, 0, 0, 0, 0, 0,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+        21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0,
+        3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+#pragma endregion
+
+static inline GraphemeBreak getGraphemeBreak(uint32_t code) {
+    if (code > 0x10ffff) return GB_Other;
+    auto block = GraphemeStage2[(GraphemeStage1[code >> 11] << 5) + ((code >> 6) & 31)];
+    auto value = GraphemeStage3[(block << 5) + ((code & 63) >> 1)];
+    return (GraphemeBreak) ((value >> ((code & 1) << 2)) & 0xf);
+}
+
+/// 是否为快速路径可直接处理的字符：可打印 ASCII、平假名、片假名与 CJK 统一表意文字
+/// \note 这些字符的属性均为 Other，其后只要不是 Extend/ZWJ/SpacingMark 就一定是边界
+static inline bool isSimpleChar(uint32_t code) {
+    if (code < 0x80) return code >= 0x20 && code < 0x7f;
+    return (code >= 0x4e00 && code <= 0x9fff) || (code >= 0x3400 && code <= 0x4dbf) ||
+           (code >= 0x3041 && code <= 0x3096) || (code >= 0x30a1 && code <= 0x30fa);
+}
+
+/// 两个字素簇属性之间是否不可断开（GB3 ~ GB9b，GB11 与 GB12/13 需额外状态）
+static inline bool isGraphemeJoined(GraphemeBreak prev, GraphemeBreak next) {
+    if (GB_CR == prev) return GB_LF == next;
+    if (GB_LF == prev || GB_Control == prev) return false;
+    if (GB_CR == next || GB_LF == next || GB_Control == next) return false;
+    if (GB_Extend == next || GB_ZWJ == next || GB_SpacingMark == next) return true;
+    if (GB_Prepend == prev) return true;
+    switch (prev) {
+        case GB_L:
+            return GB_L == next || GB_V == next || GB_LV == next || GB_LVT == next;
+        case GB_LV:
+        case GB_V:
+            return GB_V == next || GB_T == next;
+        case GB_LVT:
+        case GB_T:
+            return GB_T == next;
+        default:
+            return false;
+    }
+}
+
+static size_t nextGraphemeBreak(const char *data, size_t size, size_t pos) {
+    if (pos >= size) return size;
+    auto end = data + size;
+    auto p = data + pos;
+
+    int n;
+    auto code = sstr::DecodeUTF8(p, end, n);
+    auto i = pos + n;
+    if (i >= size) return size;
+
+    // 快速路径：常见字符后紧跟 ASCII 或另一个常见字符时必然断开
+    if (isSimpleChar(code)) {
+        auto ch = (unsigned char) data[i];
+        if (ch < 0x80) return i;
+        int m;
+        if (isSimpleChar(sstr::DecodeUTF8(data + i, end, m))) return i;
+    }
+
+    auto prev = getGraphemeBreak(code);
+    // GB11：ExtPict Extend* ZWJ × ExtPict
+    bool pict = GB_ExtPict == prev;
+    bool zwjAfterPict = false;
+    // GB12/13：连续区域指示符的个数
+    size_t regional = GB_RegionalIndicator == prev ? 1 : 0;
+    while (i < size) {
+        auto next = getGraphemeBreak(sstr::DecodeUTF8(data + i, end, n));
+        bool joined;
+        if (GB_ZWJ == prev && GB_ExtPict == next) {
+            joined = zwjAfterPict;
+        } else if (GB_RegionalIndicator == prev && GB_RegionalIndicator == next) {
+            joined = 1 == regional % 2;
+        } else {
+            joined = isGraphemeJoined(prev, next);
+        }
+        if (!joined) break;
+
+        zwjAfterPict = GB_ZWJ == next && pict;
+        if (GB_ExtPict == next) {
+            pict = true;
+        } else if (GB_Extend != next) {
+            pict = false;
+        }
+        regional = GB_RegionalIndicator == next ? regional + 1 : 0;
+        prev = next;
+        i += n;
+    }
+    return i;
+}
+
+size_t sstr::getNextGraphemeBreak(const SStringView &str, size_t pos) {
+    if (str.null()) return 0;
+    return nextGraphemeBreak(str.data(), str.size(), pos);
+}
+
+size_t sstr::getGraphemeCount(const SStringView &str) {
+    if (str.null()) return 0;
+    auto data = str.data();
+    auto size = str.size();
+    size_t count = 0;
+    size_t i = 0;
+    while (i < size) {
+#ifdef SSTR_SSE2
+        // 连续 17 字节均为 ASCII 时，前 16 字节中除 CR LF 外每个字节都是一个字素簇
+        if (i + 17 <= size) {
+            auto x = _mm_loadu_si128((const __m128i *) (data + i));
+            auto y = _mm_loadu_si128((const __m128i *) (data + i + 1));
+            if (0 == _mm_movemask_epi8(_mm_or_si128(x, y))) {
+                auto cr = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(x, _mm_set1_epi8('\r')));
+                auto lf = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(y, _mm_set1_epi8('\n')));
+                count += 16 - sstr::PopCount(cr & lf);
+                i += 16;
+                continue;
+            }
+        }
+#endif
+        i = nextGraphemeBreak(data, size, i);
+        count++;
+    }
+    return count;
+}
+
+SStringView sstr::truncateGraphemes(const SStringView &str, size_t count) {
+    if (str.null()) return {};
+    auto data = str.data();
+    auto size = str.size();
+    size_t i = 0;
+    for (size_t k = 0; k < count && i < size; k++) {
+        i = nextGraphemeBreak(data, size, i);
+    }
+    return {data, i};
+}
+
+SString sstr::reverseGraphemes(const SStringView &str) {
+    SString res;
+    if (str.null()) return res;
+    auto data = str.data();
+    auto size = str.size();
+    std::vector<size_t> breaks;
+    for (size_t i = 0; i < size; i = nextGraphemeBreak(data, size, i)) {
+        breaks.push_back(i);
+    }
+    breaks.push_back(size);
+
+    res.resize(size);
+    auto dst = res.data();
+    for (size_t k = breaks.size() - 1; k > 0; k--) {
+        auto n = breaks[k] - breaks[k - 1];
+        memcpy(dst, data + breaks[k - 1], n);
+        dst += n;
+    }
+    return res;
+}
+
+static inline SegmentProperty getSegmentProperty(uint32_t code) {
+    if (code > 0x10ffff) return SegmentProperties[0];
+    auto block = SegmentStage2[(SegmentStage1[code >> 10] << 5) + ((code >> 5) & 31)];
+    return SegmentProperties[SegmentStage3[(block << 5) + (code & 31)]];
+}
+
+static inline bool isASCIIAlnum(unsigned char ch) {
+    return (ch >= '0' && ch <= '9') || ((ch | 0x20) >= 'a' && (ch | 0x20) <= 'z');
+}
+
+/// 扫描连续的 ASCII 字母与数字
+/// \return 首个其他字节的位置
+static size_t scanASCIIAlnum(const char *data, size_t i, size_t size) {
+#ifdef SSTR_SSE2
+    for (; i + 16 <= size; i += 16) {
+        auto x = _mm_loadu_si128((const __m128i *) (data + i));
+        // 大小写字母合并后统一判断
+        auto letter = _mm_or_si128(x, _mm_set1_epi8(0x20));
+        auto isLetter = _mm_and_si128(_mm_cmpgt_epi8(letter, _mm_set1_epi8('a' - 1)),
+                                      _mm_cmplt_epi8(letter, _mm_set1_epi8('z' + 1)));
+        auto isDigit = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8('0' - 1)),
+                                     _mm_cmplt_epi8(x, _mm_set1_epi8('9' + 1)));
+        auto mask = ~(uint32_t) _mm_movemask_epi8(_mm_or_si128(isLetter, isDigit)) & 0xffff;
+        if (mask) return i + sstr::CountTrailingZeros(mask);
+    }
+#endif
+    while (i < size && isASCIIAlnum((unsigned char) data[i])) i++;
+    return i;
+}
+
+/// 扫描不会引起句子断开的 ASCII 字节，即除 '.'、'?'、'!'、CR、LF 以外的字节
+/// \return 首个其他字节的位置
+static size_t scanSentencePlain(const char *data, size_t i, size_t size) {
+#ifdef SSTR_SSE2
+    for (; i + 16 <= size; i += 16) {
+        auto x = _mm_loadu_si128((const __m128i *) (data + i));
+        auto special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8('.')),
+                                                 _mm_cmpeq_epi8(x, _mm_set1_epi8('?'))),
+                                    _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8('!')),
+                                                 _mm_cmpeq_epi8(x, _mm_set1_epi8('\r'))));
+        special = _mm_or_si128(special, _mm_cmpeq_epi8(x, _mm_set1_epi8('\n')));
+        // 非 ASCII 字节最高位为 1
+        auto mask = (uint32_t) _mm_movemask_epi8(_mm_or_si128(special, x));
+        if (mask) return i + sstr::CountTrailingZeros(mask);
+    }
+#endif
+    for (; i < size; i++) {
+        auto ch = (unsigned char) data[i];
+        if (ch >= 0x80 || '.' == ch || '?' == ch || '!' == ch || '\r' == ch || '\n' == ch) break;
+    }
+    return i;
+}
+
+static inline bool isAHLetter(WordBreak prop) {
+    return WB_ALetter == prop || WB_HebrewLetter == prop;
+}
+
+static inline bool isMidLetterOrQuote(WordBreak prop) {
+    return WB_MidLetter == prop || WB_MidNumLet == prop || WB_SingleQuote == prop;
+}
+
+static inline bool isMidNumOrQuote(WordBreak prop) {
+    return WB_MidNum == prop || WB_MidNumLet == prop || WB_SingleQuote == prop;
+}
+
+static inline bool isWordIgnored(WordBreak prop) {
+    return WB_Extend == prop || WB_Format == prop || WB_ZWJ == prop;
+}
+
+/// 获取 i 之后首个不被 WB4 忽略的字符属性，不存在时返回 WB_Other
+static WordBreak peekWordBreak(const char *data, size_t i, size_t size) {
+    auto end = data + size;
+    int n;
+    while (i < size) {
+        auto prop = getSegmentProperty(sstr::DecodeUTF8(data + i, end, n)).word;
+        if (!isWordIgnored(prop)) return prop;
+        i += n;
+    }
+    return WB_Other;
+}
+
+/// WB5 ~ WB16，prev 与 prevPrev 为忽略 WB4 附着字符后的属性
+/// \param regional prev 结尾的连续区域指示符个数
+/// \param after next 之后的字节位置，用于 WB6/7b/12 的向后查看
+static bool isWordJoined(WordBreak prevPrev, WordBreak prev, WordBreak next, size_t regional,
+                         const char *data, size_t after, size_t size) {
+    if (isAHLetter(prev)) {
+        if (isAHLetter(next) || WB_Numeric == next || WB_ExtendNumLet == next) return true;// WB5/9/13a
+        if (WB_HebrewLetter == prev && WB_SingleQuote == next) return true;// WB7a
+        if (isMidLetterOrQuote(next) && isAHLetter(peekWordBreak(data, after, size))) return true;// WB6
+        if (WB_HebrewLetter == prev && WB_DoubleQuote == next) {
+            return WB_HebrewLetter == peekWordBreak(data, after, size);// WB7b
+        }
+        return false;
+    }
+    switch (prev) {
+        case WB_Numeric:
+            if (WB_Numeric == next || isAHLetter(next) || WB_ExtendNumLet == next) return true;// WB8/10/13a
+            return isMidNumOrQuote(next) && WB_Numeric == peekWordBreak(data, after, size);// WB12
+        case WB_Katakana:
+            return WB_Katakana == next || WB_ExtendNumLet == next;// WB13/13a
+        case WB_ExtendNumLet:
+            return isAHLetter(next) || WB_Numeric == next || WB_Katakana == next || WB_ExtendNumLet == next;// WB13a/b
+        case WB_RegionalIndicator:
+            return WB_RegionalIndicator == next && 1 == regional % 2;// WB15/16
+        default:
+            break;
+    }
+    if (isAHLetter(prevPrev) && isMidLetterOrQuote(prev) && isAHLetter(next)) return true;// WB7
+    if (WB_HebrewLetter == prevPrev && WB_DoubleQuote == prev && WB_HebrewLetter == next) return true;// WB7c
+    return WB_Numeric == prevPrev && isMidNumOrQuote(prev) && WB_Numeric == next;// WB11
+}
+
+static size_t nextWordBreak(const char *data, size_t size, size_t pos) {
+    if (pos >= size) return size;
+    auto end = data + size;
+
+    int n;
+    auto i = pos;
+    WordBreak prevPrev = WB_Other;
+    WordBreak prev;
+    // 快速路径：ASCII 字母与数字之间由 WB5/8/9/10 连接，整段跳过
+    if (isASCIIAlnum((unsigned char) data[i])) {
+        i = scanASCIIAlnum(data, i + 1, size);
+        if (i >= size) return size;
+        auto ch = (unsigned char) data[i];
+        // 其后是空白或普通标点时必然断开，只有引号、中缀标点与连接符需要完整规则
+        auto next = getSegmentProperty(ch).word;
+        if (ch < 0x80 && !isMidLetterOrQuote(next) && !isMidNumOrQuote(next) &&
+            WB_DoubleQuote != next && WB_ExtendNumLet != next) {
+            return i;
+        }
+        if (i - pos >= 2) prevPrev = getSegmentProperty((unsigned char) data[i - 2]).word;
+        prev = getSegmentProperty((unsigned char) data[i - 1]).word;
+    } else {
+        prev = getSegmentProperty(sstr::DecodeUTF8(data + i, end, n)).word;
+        i += n;
+    }
+
+    // 未被 WB4 忽略的实际前一字符属性
+    auto raw = prev;
+    size_t regional = WB_RegionalIndicator == prev ? 1 : 0;
+    while (i < size) {
+        auto code = sstr::DecodeUTF8(data + i, end, n);
+        auto next = getSegmentProperty(code).word;
+
+        if (WB_CR == raw && WB_LF == next) {
+            // WB3
+        } else if (WB_Newline == raw || WB_CR == raw || WB_LF == raw ||
+                   WB_Newline == next || WB_CR == next || WB_LF == next) {
+            break;// WB3a/3b
+        } else if (WB_ZWJ == raw && GB_ExtPict == getGraphemeBreak(code)) {
+            // WB3c
+        } else if (WB_WSegSpace == raw && WB_WSegSpace == next) {
+            // WB3d
+        } else if (isWordIgnored(next)) {
+            // WB4：附着在前一字符上，不更新 prev
+            raw = next;
+            i += n;
+            continue;
+        } else {
+            if (!isWordJoined(prevPrev, prev, next, regional, data, i + n, size)) break;
+        }
+
+        regional = WB_RegionalIndicator == next ? regional + 1 : 0;
+        prevPrev = prev;
+        prev = raw = next;
+        i += n;
+    }
+    return i;
+}
+
+/// 跳过 SB5 中附着的 Extend 与 Format
+static size_t skipSentenceExtend(const char *data, size_t i, size_t size) {
+    auto end = data + size;
+    int n;
+    while (i < size) {
+        auto prop = getSegmentProperty(sstr::DecodeUTF8(data + i, end, n)).sentence;
+        if (SB_Extend != prop && SB_Format != prop) break;
+        i += n;
+    }
+    return i;
+}
+
+/// SB8：ATerm Close* Sp* 之后，跳过非字母、非终止符的字符后是否为小写字母
+static bool isLowerFollowing(const char *data, size_t i, size_t size) {
+    auto end = data + size;
+    int n;
+    while (i < size) {
+        switch (getSegmentProperty(sstr::DecodeUTF8(data + i, end, n)).sentence) {
+            case SB_Lower:
+                return true;
+            case SB_OLetter:
+            case SB_Upper:
+            case SB_Sep:
+            case SB_CR:
+            case SB_LF:
+            case SB_ATerm:
+            case SB_STerm:
+                return false;
+            default:
+                i += n;
+        }
+    }
+    return false;
+}
+
+static size_t nextSentenceBreak(const char *data, size_t size, size_t pos) {
+    auto end = data + size;
+    auto i = pos;
+    int n;
+    // 前一个有效字符属性，用于 SB7
+    SentenceBreak before = SB_Other;
+    while (i < size) {
+        // 快速路径：普通 ASCII 文本不会引起断开，只需记下最后一个字符
+        auto plain = scanSentencePlain(data, i, size);
+        if (plain != i) {
+            before = getSegmentProperty((unsigned char) data[plain - 1]).sentence;
+            i = plain;
+            if (i >= size) break;
+        }
+
+        auto prop = getSegmentProperty(sstr::DecodeUTF8(data + i, end, n)).sentence;
+        i += n;
+        if (SB_CR == prop) {
+            if (i < size && '\n' == data[i]) i++;
+            return i;// SB3/4
+        }
+        if (SB_LF == prop || SB_Sep == prop) return i;// SB4
+        if (SB_Extend == prop || SB_Format == prop) continue;// SB5
+        if (SB_ATerm != prop && SB_STerm != prop) {
+            before = prop;
+            continue;
+        }
+
+        i = skipSentenceExtend(data, i, size);
+        if (i >= size) return size;
+        auto next = getSegmentProperty(sstr::DecodeUTF8(data + i, end, n)).sentence;
+        if (SB_ATerm == prop && SB_Numeric == next) {
+            before = prop;
+            continue;// SB6
+        }
+        if (SB_ATerm == prop && SB_Upper == next && (SB_Upper == before || SB_Lower == before)) {
+            before = prop;
+            continue;// SB7
+        }
+
+        auto last = prop;
+        // SB9：SATerm Close* × Close
+        while (SB_Close == next) {
+            last = next;
+            i = skipSentenceExtend(data, i + n, size);
+            if (i >= size) return size;
+            next = getSegmentProperty(sstr::DecodeUTF8(data + i, end, n)).sentence;
+        }
+        // SB10：SATerm Close* Sp* × Sp
+        while (SB_Sp == next) {
+            last = next;
+            i = skipSentenceExtend(data, i + n, size);
+            if (i >= size) return size;
+            next = getSegmentProperty(sstr::DecodeUTF8(data + i, end, n)).sentence;
+        }
+        // SB9/10：段落分隔符归入当前句子
+        if (SB_CR == next) {
+            i += n;
+            if (i < size && '\n' == data[i]) i++;
+            return i;
+        }
+        if (SB_LF == next || SB_Sep == next) return i + n;
+        if ((SB_ATerm == prop && isLowerFollowing(data, i, size)) ||
+            SB_SContinue == next || SB_ATerm == next || SB_STerm == next) {
+            before = last;
+            continue;// SB8/8a
+        }
+        return i;// SB11
+    }
+    return size;
+}
+
+/// 单词片段是否包含字母、数字或表意文字，而非空白与标点
+static bool isWordLike(const char *p, const char *end) {
+    int n;
+    auto prop = getSegmentProperty(sstr::DecodeUTF8(p, end, n));
+    switch (prop.word) {
+        case WB_ALetter:
+        case WB_HebrewLetter:
+        case WB_Numeric:
+        case WB_Katakana:
+        case WB_ExtendNumLet:
+            return true;
+        default:
+            return SB_OLetter == prop.sentence || SB_Upper == prop.sentence || SB_Lower == prop.sentence;
+    }
+}
+
+size_t sstr::getNextWordBreak(const SStringView &str, size_t pos) {
+    if (str.null()) return 0;
+    return nextWordBreak(str.data(), str.size(), pos);
+}
+
+size_t sstr::getNextSentenceBreak(const SStringView &str, size_t pos) {
+    if (str.null()) return 0;
+    return nextSentenceBreak(str.data(), str.size(), pos);
+}
+
+std::vector<SStringView> sstr::splitWords(const SStringView &str) {
+    std::vector<SStringView> words;
+    if (str.null()) return words;
+    auto data = str.data();
+    auto size = str.size();
+    for (size_t i = 0; i < size;) {
+        auto next = nextWordBreak(data, size, i);
+        if (isWordLike(data + i, data + size)) words.emplace_back(data + i, next - i);
+        i = next;
+    }
+    return words;
+}
+
+size_t sstr::getWordCount(const SStringView &str) {
+    if (str.null()) return 0;
+    auto data = str.data();
+    auto size = str.size();
+    size_t count = 0;
+    for (size_t i = 0; i < size;) {
+        auto next = nextWordBreak(data, size, i);
+        if (isWordLike(data + i, data + size)) count++;
+        i = next;
+    }
+    return count;
+}
+
+#pragma region SGraphemeIterator
+
+SGraphemeIterator::SGraphemeIterator(const SStringView &str, size_t pos)
+    : _data(str.data()), _size(str.null() ? 0 : str.size()) {
+    _pos = pos < _size ? pos : _size;
+    _next = nextGraphemeBreak(_data, _size, _pos);
+}
+
+SGraphemeIterator &SGraphemeIterator::operator++() {
+    _pos = _next;
+    _next = nextGraphemeBreak(_data, _size, _pos);
+    return *this;
+}
+
+SGraphemeIterator SGraphemeIterator::operator++(int) {
+    auto tmp = *this;
+    ++*this;
+    return tmp;
+}
+
+bool SGraphemeIterator::operator==(const SGraphemeIterator &other) const {
+    return _data == other._data && _pos == other._pos;
+}
+
+bool SGraphemeIterator::operator!=(const SGraphemeIterator &other) const {
+    return !(*this == other);
+}
+
+SStringView SGraphemeIterator::operator*() const {
+    return {_data + _pos, _next - _pos};
+}
+
+SGraphemeIterator SGraphemeIterator::begin() const {
+    return *this;
+}
+
+SGraphemeIterator SGraphemeIterator::end() const {
+    auto it = *this;
+    it._pos = it._next = _size;
+    return it;
+}
+
+size_t SGraphemeIterator::position() const {
+    return _pos;
+}
+
+#pragma endregion
+
+#pragma region SWordIterator
+
+SWordIterator::SWordIterator(const SStringView &str, size_t pos)
+    : _data(str.data()), _size(str.null() ? 0 : str.size()) {
+    _pos = pos < _size ? pos : _size;
+    _next = nextWordBreak(_data, _size, _pos);
+}
+
+SWordIterator &SWordIterator::operator++() {
+    _pos = _next;
+    _next = nextWordBreak(_data, _size, _pos);
+    return *this;
+}
+
+SWordIterator SWordIterator::operator++(int) {
+    auto tmp = *this;
+    ++*this;
+    return tmp;
+}
+
+bool SWordIterator::operator==(const SWordIterator &other) const {
+    return _data == other._data && _pos == other._pos;
+}
+
+bool SWordIterator::operator!=(const SWordIterator &other) const {
+    return !(*this == other);
+}
+
+SStringView SWordIterator::operator*() const {
+    return {_data + _pos, _next - _pos};
+}
+
+SWordIterator SWordIterator::begin() const {
+    return *this;
+}
+
+SWordIterator SWordIterator::end() const {
+    auto it = *this;
+    it._pos = it._next = _size;
+    return it;
+}
+
+size_t SWordIterator::position() const {
+    return _pos;
+}
+
+bool SWordIterator::isWord() const {
+    return _pos < _size && isWordLike(_data + _pos, _data + _size);
+}
+
+#pragma endregion
+
+#pragma region SSentenceIterator
+
+SSentenceIterator::SSentenceIterator(const SStringView &str, size_t pos)
+    : _data(str.data()), _size(str.null() ? 0 : str.size()) {
+    _pos = pos < _size ? pos : _size;
+    _next = nextSentenceBreak(_data, _size, _pos);
+}
+
+SSentenceIterator &SSentenceIterator::operator++() {
+    _pos = _next;
+    _next = nextSentenceBreak(_data, _size, _pos);
+    return *this;
+}
+
+SSentenceIterator SSentenceIterator::operator++(int) {
+    auto tmp = *this;
+    ++*this;
+    return tmp;
+}
+
+bool SSentenceIterator::operator==(const SSentenceIterator &other) const {
+    return _data == other._data && _pos == other._pos;
+}
+
+bool SSentenceIterator::operator!=(const SSentenceIterator &other) const {
+    return !(*this == other);
+}
+
+SStringView SSentenceIterator::operator*() const {
+    return {_data + _pos, _next - _pos};
+}
+
+SSentenceIterator SSentenceIterator::begin() const {
+    return *this;
+}
+
+SSentenceIterator SSentenceIterator::end() const {
+    auto it = *this;
+    it._pos = it._next = _size;
+    return it;
+}
+
+size_t SSentenceIterator::position() const {
+    return _pos;
+}
+
+#pragma endregion
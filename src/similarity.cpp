@@ -0,0 +1,167 @@
+#include <SString/similarity.h>
+#include <SString/algorithm.h>
+#include <algorithm>
+#include <cstring>
+
+using sstr::SLSHIndex;
+using sstr::SStringView;
+
+/// 每块同时计算的置换个数
+static const size_t MinHashLanes = 16;
+
+/// 依次访问每个片段的哈希
+/// \note 片段的首尾两个指针各自按码点前进，片段始终是原字符串中连续的字节
+template<typename Callback>
+static void forEachShingle(const SStringView &str, size_t shingle, Callback &&callback) {
+    auto size = str.null() ? 0 : str.size();
+    if (0 == size) return;
+    if (0 == shingle) shingle = 1;
+    auto begin = str.data(), end = begin + size;
+    auto head = begin, tail = begin;
+    int n;
+    size_t count = 0;
+    while (tail < end && count < shingle) {
+        sstr::DecodeUTF8(tail, end, n);
+        tail += n;
+        count++;
+    }
+    callback(sstr::getHashFromBytes(head, tail - head));
+    while (tail < end) {
+        sstr::DecodeUTF8(tail, end, n);
+        tail += n;
+        sstr::DecodeUTF8(head, end, n);
+        head += n;
+        callback(sstr::getHashFromBytes(head, tail - head));
+    }
+}
+
+static inline uint64_t splitMix(uint64_t &state) {
+    auto z = (state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+uint64_t sstr::getSimHash(const SStringView &str, size_t shingle) {
+    // 每一位为 1 的片段个数
+    uint32_t ones[64] = {};
+    uint32_t total = 0;
+    forEachShingle(str, shingle, [&](uint64_t h) {
+        for (int bit = 0; bit < 64; bit++) ones[bit] += (uint32_t) (h >> bit) & 1;
+        total++;
+    });
+    uint64_t res = 0;
+    for (int bit = 0; bit < 64; bit++) {
+        if (ones[bit] * 2 > total) res |= 1ull << bit;
+    }
+    return res;
+}
+
+int sstr::getSimHashDistance(uint64_t a, uint64_t b) {
+    auto x = a ^ b;
+    return PopCount((uint32_t) x) + PopCount((uint32_t) (x >> 32));
+}
+
+void sstr::getMinHash(const SStringView &str, uint64_t *signature, size_t count, size_t shingle, uint64_t seed) {
+    std::vector<uint64_t> hashes;
+    hashes.reserve(str.null() ? 0 : str.size());
+    forEachShingle(str, shingle, [&](uint64_t h) { hashes.push_back(h); });
+    // 相同片段只需计算一次
+    std::sort(hashes.begin(), hashes.end());
+    hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+
+    auto state = seed;
+    for (size_t base = 0; base < count; base += MinHashLanes) {
+        // 第 i 组置换为 ((h ^ b[i]) * a[i]) 后再折叠高位，a[i] 为奇数时是 64 位上的双射
+        uint64_t a[MinHashLanes], b[MinHashLanes], mins[MinHashLanes];
+        for (size_t i = 0; i < MinHashLanes; i++) {
+            a[i] = splitMix(state) | 1;
+            b[i] = splitMix(state);
+            mins[i] = UINT64_MAX;
+        }
+        for (auto h: hashes) {
+            for (size_t i = 0; i < MinHashLanes; i++) {
+                auto v = (h ^ b[i]) * a[i];
+                v ^= v >> 29;
+                mins[i] = v < mins[i] ? v : mins[i];
+            }
+        }
+        auto n = count - base < MinHashLanes ? count - base : MinHashLanes;
+        memcpy(signature + base, mins, n * sizeof(uint64_t));
+    }
+}
+
+std::vector<uint64_t> sstr::getMinHash(const SStringView &str, size_t count, size_t shingle, uint64_t seed) {
+    std::vector<uint64_t> res(count);
+    if (count) getMinHash(str, res.data(), count, shingle, seed);
+    return res;
+}
+
+double sstr::getMinHashSimilarity(const uint64_t *a, const uint64_t *b, size_t count) {
+    if (0 == count) return 0;
+    size_t same = 0;
+    for (size_t i = 0; i < count; i++) same += a[i] == b[i];
+    return (double) same / (double) count;
+}
+
+SLSHIndex::SLSHIndex(size_t bands, size_t rows) : _bands(bands ? bands : 1), _rows(rows ? rows : 1), _tables(_bands) {}
+
+size_t SLSHIndex::signatureSize() const {
+    return _bands * _rows;
+}
+
+size_t SLSHIndex::size() const {
+    return _tables[0].keys.size();
+}
+
+uint64_t SLSHIndex::getBandKey(const uint64_t *signature, size_t band) const {
+    return getHashFromBytes((const char *) (signature + band * _rows), _rows * sizeof(uint64_t), band);
+}
+
+uint32_t SLSHIndex::insert(const uint64_t *signature) {
+    auto id = (uint32_t) size();
+    for (size_t band = 0; band < _bands; band++) {
+        auto &table = _tables[band];
+        auto key = getBandKey(signature, band);
+        table.keys.push_back(key);
+        table.next.push_back(0);
+        if (table.keys.size() * 2 > table.heads.size()) {
+            // 负载超过 1/2 时扩容并重建链表
+            table.heads.assign(table.heads.empty() ? 64 : table.heads.size() * 2, 0);
+            auto mask = table.heads.size() - 1;
+            for (size_t i = 0; i < table.keys.size(); i++) {
+                auto &head = table.heads[table.keys[i] & mask];
+                table.next[i] = head;
+                head = (uint32_t) (i + 1);
+            }
+        } else {
+            auto &head = table.heads[key & (table.heads.size() - 1)];
+            table.next[id] = head;
+            head = id + 1;
+        }
+    }
+    return id;
+}
+
+std::vector<uint32_t> SLSHIndex::query(const uint64_t *signature) const {
+    std::vector<uint32_t> res;
+    if (0 == size()) return res;
+    for (size_t band = 0; band < _bands; band++) {
+        auto &table = _tables[band];
+        auto key = getBandKey(signature, band);
+        for (auto i = table.heads[key & (table.heads.size() - 1)]; i; i = table.next[i - 1]) {
+            if (table.keys[i - 1] == key) res.push_back(i - 1);
+        }
+    }
+    std::sort(res.begin(), res.end());
+    res.erase(std::unique(res.begin(), res.end()), res.end());
+    return res;
+}
+
+void SLSHIndex::clear() {
+    for (auto &table: _tables) {
+        table.heads.clear();
+        table.next.clear();
+        table.keys.clear();
+    }
+}
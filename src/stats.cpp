@@ -0,0 +1,261 @@
+#include <SString/SString.h>
+#include <SString/algorithm.h>
+#include <SString/segment.h>
+#include <thread>
+#include <vector>
+
+using sstr::SStringStats;
+using sstr::SStringView;
+
+/// 每次处理的字节数，各类掩码恰好占满 32 位
+static const size_t BlockSize = 32;
+/// 并行统计时每段的最小字节数
+static const size_t MinChunkSize = 1 << 20;
+
+/// 字节的分类
+enum : uint8_t {
+    Letter = 1,
+    Digit = 2,
+    Underscore = 4,
+    Word = Letter | Digit | Underscore,
+    /// ':'，连接两侧的字母（WB6、WB7）
+    Colon = 8,
+    /// '.' 与 '\''，连接两侧的字母或两侧的数字（WB6、WB7、WB11、WB12）
+    MidNumLet = 16,
+    /// ',' 与 ';'，连接两侧的数字（WB11、WB12）
+    MidNum = 32,
+    Space = 64,
+    NonASCII = 128,
+};
+
+struct ClassTable {
+    uint8_t data[256];
+
+    ClassTable() {
+        for (int i = 0; i < 256; i++) {
+            uint8_t c = 0;
+            if (i >= 0x80) c = NonASCII;
+            else if ((i >= 'a' && i <= 'z') || (i >= 'A' && i <= 'Z')) c = Letter;
+            else if (i >= '0' && i <= '9') c = Digit;
+            else if ('_' == i) c = Underscore;
+            else if (':' == i) c = Colon;
+            else if ('.' == i || '\'' == i) c = MidNumLet;
+            else if (',' == i || ';' == i) c = MidNum;
+            else if (' ' == i || (i >= '\t' && i <= '\r')) c = Space;
+            data[i] = c;
+        }
+    }
+};
+
+static const ClassTable Classes;
+
+/// 一块中各类字节的掩码，第 i 位对应第 i 个字节
+struct Masks {
+    uint32_t letter = 0, digit = 0, underscore = 0, colon = 0, midNumLet = 0, midNum = 0, space = 0, nonASCII = 0;
+    uint32_t newline = 0;
+    /// 非续字节
+    uint32_t lead = 0;
+};
+
+/// 统计 [begin, end) 中的字符、换行与单词，单词的上下文可读到整个字节串
+class Counter {
+public:
+    Counter() = default;
+
+    Counter(const char *data, size_t begin, size_t end, size_t size)
+        : _data(data), _begin(begin), _end(end), _size(size), _wordPos(begin), _tokenStart(begin) {}
+
+    void run() {
+        for (auto b = _begin; b < _end; b += BlockSize) {
+            block(b, _end - b < BlockSize ? _end - b : BlockSize);
+        }
+    }
+
+    size_t chars = 0;
+    size_t newlines = 0;
+    size_t words = 0;
+
+private:
+    uint8_t classAt(size_t i) const {
+        // i 由 0 减一时回绕，同样视为越界
+        return i < _size ? Classes.data[(uint8_t) _data[i]] : 0;
+    }
+
+    /// 第 i 个字节是否为两侧可连接的标点
+    bool joinedAt(size_t i) const {
+        auto c = classAt(i);
+        if (!(c & (Colon | MidNumLet | MidNum))) return false;
+        auto prev = classAt(i - 1), next = classAt(i + 1);
+        bool letters = (prev & Letter) && (next & Letter);
+        bool digits = (prev & Digit) && (next & Digit);
+        return (c & Colon) ? letters : (c & MidNumLet) ? letters || digits : digits;
+    }
+
+    void load(size_t b, size_t n, Masks &m) const {
+        auto p = _data + b;
+#ifdef SSTR_SSE2
+        if (BlockSize == n) {
+            for (int half = 0; half < 2; half++) {
+                auto x = _mm_loadu_si128((const __m128i *) (p + half * 16));
+                auto lower = _mm_or_si128(x, _mm_set1_epi8(0x20));
+                // 非 ASCII 字节作为有符号数为负，不会落入以下任何区间
+                auto letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                            _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+                auto digit = _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8('0' - 1)),
+                                           _mm_cmplt_epi8(x, _mm_set1_epi8('9' + 1)));
+                auto space = _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(' ')),
+                                          _mm_and_si128(_mm_cmpgt_epi8(x, _mm_set1_epi8('\t' - 1)),
+                                                        _mm_cmplt_epi8(x, _mm_set1_epi8('\r' + 1))));
+                auto midNumLet = _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8('.')),
+                                              _mm_cmpeq_epi8(x, _mm_set1_epi8('\'')));
+                auto midNum = _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(',')),
+                                           _mm_cmpeq_epi8(x, _mm_set1_epi8(';')));
+                auto shift = half * 16;
+                m.letter |= (uint32_t) _mm_movemask_epi8(letter) << shift;
+                m.digit |= (uint32_t) _mm_movemask_epi8(digit) << shift;
+                m.underscore |= (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(x, _mm_set1_epi8('_'))) << shift;
+                m.colon |= (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(x, _mm_set1_epi8(':'))) << shift;
+                m.midNumLet |= (uint32_t) _mm_movemask_epi8(midNumLet) << shift;
+                m.midNum |= (uint32_t) _mm_movemask_epi8(midNum) << shift;
+                m.space |= (uint32_t) _mm_movemask_epi8(space) << shift;
+                m.nonASCII |= (uint32_t) _mm_movemask_epi8(x) << shift;
+                m.newline |= (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(x, _mm_set1_epi8('\n'))) << shift;
+                // 续字节 0x80~0xBF 作为有符号数落在 [-128, -65]
+                m.lead |= (uint32_t) _mm_movemask_epi8(_mm_cmpgt_epi8(x, _mm_set1_epi8(-65))) << shift;
+            }
+            return;
+        }
+#endif
+        for (size_t i = 0; i < n; i++) {
+            auto ch = (uint8_t) p[i];
+            auto c = Classes.data[ch];
+            auto bit = 1u << i;
+            if (c & Letter) m.letter |= bit;
+            if (c & Digit) m.digit |= bit;
+            if (c & Underscore) m.underscore |= bit;
+            if (c & Colon) m.colon |= bit;
+            if (c & MidNumLet) m.midNumLet |= bit;
+            if (c & MidNum) m.midNum |= bit;
+            if (c & Space) m.space |= bit;
+            if (c & NonASCII) m.nonASCII |= bit;
+            if ('\n' == ch) m.newline |= bit;
+            if ((ch & 0xc0) != 0x80) m.lead |= bit;
+        }
+    }
+
+    /// 掩码中 [lo, hi) 位为 1
+    static uint32_t range(size_t lo, size_t hi) {
+        if (lo >= 32) return 0;
+        auto high = hi >= 32 ? ~0u : (1u << hi) - 1;
+        return high & ~((1u << lo) - 1);
+    }
+
+    void block(size_t b, size_t n) {
+        Masks m;
+        load(b, n, m);
+        chars += sstr::PopCount(m.lead);
+        newlines += sstr::PopCount(m.newline);
+
+        // 按位计算纯 ASCII 文本中每个词的起点：
+        // 词字符前一字节既不是词字符，也不是两侧可连接的标点
+        auto prev = classAt(b - 1), next = classAt(b + n);
+        auto top = (uint32_t) (n - 1);
+        auto letterPrev = m.letter << 1 | (prev & Letter ? 1u : 0);
+        auto letterNext = m.letter >> 1 | (next & Letter ? 1u << top : 0);
+        auto digitPrev = m.digit << 1 | (prev & Digit ? 1u : 0);
+        auto digitNext = m.digit >> 1 | (next & Digit ? 1u << top : 0);
+        auto letters = letterPrev & letterNext, digits = digitPrev & digitNext;
+        auto joined = (m.colon & letters) | (m.midNumLet & (letters | digits)) | (m.midNum & digits);
+        auto word = m.letter | m.digit | m.underscore;
+        auto wordPrev = word << 1 | (prev & Word ? 1u : 0);
+        auto joinedPrev = joined << 1 | (joinedAt(b - 1) ? 1u : 0);
+        auto starts = word & ~wordPrev & ~joinedPrev;
+
+        auto pos = _wordPos > b ? _wordPos : b;
+        while (pos < b + n) {
+            auto lo = pos - b;
+            auto rest = m.nonASCII & range(lo, n);
+            auto hi = rest ? (size_t) sstr::CountTrailingZeros(rest) : n;
+            auto fast = starts & range(lo, hi);
+            auto spaces = m.space & range(lo, hi);
+            words += sstr::PopCount(fast);
+            if (spaces) {
+                auto last = (size_t) (31 - sstr::CountLeadingZeros(spaces));
+                _tokenStart = b + last + 1;
+                _tokenWords = sstr::PopCount(fast & range(last + 1, hi));
+            } else {
+                _tokenWords += sstr::PopCount(fast);
+            }
+            if (hi == n) break;
+            // 含非 ASCII 字节的词：撤销已计入的部分，整词按 UAX #29 重新计数
+            auto e = b + hi;
+            while (e < _end && !(classAt(e) & Space)) e++;
+            words -= _tokenWords;
+            words += sstr::getWordCount(SStringView(_data + _tokenStart, e - _tokenStart));
+            _tokenStart = e;
+            _tokenWords = 0;
+            pos = e;
+        }
+        _wordPos = pos > b + n ? pos : b + n;
+    }
+
+    const char *_data = nullptr;
+    size_t _begin = 0;
+    size_t _end = 0;
+    size_t _size = 0;
+    /// 单词已处理到的位置，慢速路径可能越过当前块
+    size_t _wordPos = 0;
+    /// 当前词（ASCII 空白之后）的起始位置
+    size_t _tokenStart = 0;
+    /// 当前词中按掩码计入的单词数
+    size_t _tokenWords = 0;
+};
+
+static SStringStats finish(const char *data, size_t size, size_t chars, size_t newlines, size_t words) {
+    SStringStats res;
+    res.bytes = size;
+    res.chars = chars;
+    res.lines = newlines + (size && '\n' != data[size - 1] ? 1 : 0);
+    res.words = words;
+    return res;
+}
+
+SStringStats SStringView::stats() const {
+    auto data = this->data();
+    auto size = null() ? 0 : this->size();
+    Counter counter(data, 0, size, size);
+    counter.run();
+    return finish(data, size, counter.chars, counter.newlines, counter.words);
+}
+
+SStringStats SStringView::statsParallel(size_t threads) const {
+    auto data = this->data();
+    auto size = null() ? 0 : this->size();
+    if (0 == threads) threads = std::thread::hardware_concurrency();
+    if (threads > size / MinChunkSize) threads = size / MinChunkSize;
+    if (threads <= 1) return stats();
+    // 分段点取在 ASCII 空白之后，单词不会跨段
+    std::vector<Counter> counters(threads);
+    size_t begin = 0;
+    for (size_t i = 0; i < threads; i++) {
+        auto end = i + 1 == threads ? size : (i + 1) * (size / threads);
+        if (end < begin) end = begin;
+        while (end < size && !(Classes.data[(uint8_t) data[end - 1]] & Space)) end++;
+        counters[i] = Counter(data, begin, end, size);
+        begin = end;
+    }
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (size_t i = 1; i < threads; i++) {
+        workers.emplace_back(&Counter::run, &counters[i]);
+    }
+    counters[0].run();
+    for (auto &worker: workers) worker.join();
+    size_t chars = 0, newlines = 0, words = 0;
+    for (auto &counter: counters) {
+        chars += counter.chars;
+        newlines += counter.newlines;
+        words += counter.words;
+    }
+    return finish(data, size, chars, newlines, words);
+}
@@ -0,0 +1,193 @@
+#include <SString/url.h>
+#include <SString/algorithm.h>
+#include <cstring>
+#ifdef _WIN32
+#pragma warning(disable : 4267)
+#endif
+
+using sstr::SString;
+using sstr::SStringView;
+
+static const char HexDigits[] = "0123456789ABCDEF";
+
+static inline bool isUnreserved(unsigned char ch) {
+    return (ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z') || (ch >= '0' && ch <= '9') ||
+           '-' == ch || '.' == ch || '_' == ch || '~' == ch;
+}
+
+static inline bool isPathChar(unsigned char ch) {
+    return isUnreserved(ch) || (0 != ch && nullptr != strchr("/:@!$&'()*+,;=", ch));
+}
+
+static inline bool isKept(unsigned char ch, bool path) {
+    return path ? isPathChar(ch) : isUnreserved(ch);
+}
+
+/// 扫描无需编码的连续字节
+/// \note SIMD 部分只识别非保留字符（路径模式下另加 '/'），其余由调用方逐字节判断
+/// \param p 起始位置
+/// \param n 剩余字节数
+/// \param path 是否为路径模式
+/// \return 连续的非保留字符字节数
+static size_t scanUnreserved(const char *p, size_t n, bool path) {
+    size_t i = 0;
+#ifdef SSTR_SSE2
+    // 有符号比较下 >= 0x80 的字节为负数，不会落入任何区间
+    const __m128i upperLo = _mm_set1_epi8('A' - 1), upperHi = _mm_set1_epi8('Z' + 1);
+    const __m128i lowerLo = _mm_set1_epi8('a' - 1), lowerHi = _mm_set1_epi8('z' + 1);
+    const __m128i digitLo = _mm_set1_epi8('0' - 1), digitHi = _mm_set1_epi8('9' + 1);
+    const __m128i dash = _mm_set1_epi8('-'), dot = _mm_set1_epi8('.');
+    const __m128i underline = _mm_set1_epi8('_'), tilde = _mm_set1_epi8('~');
+    const __m128i slash = path ? _mm_set1_epi8('/') : _mm_set1_epi8('-');
+    for (; i + 16 <= n; i += 16) {
+        auto x = _mm_loadu_si128((const __m128i *) (p + i));
+        auto upper = _mm_and_si128(_mm_cmpgt_epi8(x, upperLo), _mm_cmplt_epi8(x, upperHi));
+        auto lower = _mm_and_si128(_mm_cmpgt_epi8(x, lowerLo), _mm_cmplt_epi8(x, lowerHi));
+        auto digit = _mm_and_si128(_mm_cmpgt_epi8(x, digitLo), _mm_cmplt_epi8(x, digitHi));
+        auto mark = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(x, dash), _mm_cmpeq_epi8(x, dot)),
+                                 _mm_or_si128(_mm_cmpeq_epi8(x, underline), _mm_cmpeq_epi8(x, tilde)));
+        mark = _mm_or_si128(mark, _mm_cmpeq_epi8(x, slash));
+        auto keep = _mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, mark));
+        auto mask = (uint32_t) ~_mm_movemask_epi8(keep) & 0xffff;
+        if (mask) return i + sstr::CountTrailingZeros(mask);
+    }
+#endif
+    for (; i < n; i++) {
+        auto ch = (unsigned char) p[i];
+        if (!isUnreserved(ch) && !(path && '/' == ch)) return i;
+    }
+    return n;
+}
+
+static SString encode(const SStringView &str, bool path) {
+    SString res;
+    if (str.null()) return res;
+    auto p = str.data();
+    auto size = str.size();
+
+    // 预先计算结果大小
+    auto newSize = size;
+    size_t i = 0;
+    while (true) {
+        i += scanUnreserved(p + i, size - i, path);
+        if (i == size) break;
+        if (!isKept((unsigned char) p[i], path)) newSize += 2;
+        i++;
+    }
+
+    res.resize(newSize);
+    if (newSize == size) {
+        memcpy(res.data(), p, size);
+        return res;
+    }
+
+    auto dst = res.data();
+    i = 0;
+    while (i < size) {
+        auto n = scanUnreserved(p + i, size - i, path);
+        memcpy(dst, p + i, n);
+        dst += n;
+        i += n;
+        if (i == size) break;
+        auto ch = (unsigned char) p[i++];
+        if (isKept(ch, path)) {
+            *dst++ = (char) ch;
+        } else {
+            dst[0] = '%';
+            dst[1] = HexDigits[ch >> 4];
+            dst[2] = HexDigits[ch & 0xf];
+            dst += 3;
+        }
+    }
+    return res;
+}
+
+static inline int hexValue(char ch) {
+    if (ch >= '0' && ch <= '9') return ch - '0';
+    if (ch >= 'a' && ch <= 'f') return ch - 'a' + 10;
+    if (ch >= 'A' && ch <= 'F') return ch - 'A' + 10;
+    return -1;
+}
+
+/// 解码百分号序列
+/// \note 允许 dst 与 src 相同（原地解码）
+/// \param src 编码字节串
+/// \param size 编码字节数
+/// \param dst 写入位置，不小于 size
+/// \param plus 是否将 '+' 视为空格
+/// \return 解码后字节数，失败返回 -1
+static int64_t decode(const char *src, size_t size, char *dst, bool plus) {
+    auto begin = dst;
+    size_t i = 0;
+    while (i < size) {
+        auto percent = (const char *) memchr(src + i, '%', size - i);
+        auto n = percent ? (size_t) (percent - src) - i : size - i;
+        if (plus) {
+            for (size_t j = 0; j < n; j++) {
+                auto ch = src[i + j];
+                dst[j] = '+' == ch ? ' ' : ch;
+            }
+        } else if (dst != src + i) {
+            memmove(dst, src + i, n);
+        }
+        dst += n;
+        i += n;
+        if (i == size) break;
+
+        if (i + 3 > size) return -1;
+        auto hi = hexValue(src[i + 1]);
+        auto lo = hexValue(src[i + 2]);
+        if (-1 == hi || -1 == lo) return -1;
+        *dst++ = (char) (hi << 4 | lo);
+        i += 3;
+    }
+    return dst - begin;
+}
+
+static bool decodeTo(const SStringView &str, SString &out, bool validate, bool plus) {
+    if (str.null()) {
+        out.resize(0);
+        return true;
+    }
+    auto size = str.size();
+    out.resize(size);
+    auto n = decode(str.data(), size, out.data(), plus);
+    if (-1 != n) {
+        out.resize((size_t) n);
+        if (!validate || sstr::isValidUTF8String(out.data(), out.size())) return true;
+    }
+    out.resize(0);
+    return false;
+}
+
+static bool decodeInPlace(SString &str, bool validate, bool plus) {
+    if (str.null()) return true;
+    auto n = decode(str.data(), str.size(), str.data(), plus);
+    if (-1 == n) return false;
+    str.resize((size_t) n);
+    return !validate || sstr::isValidUTF8String(str.data(), str.size());
+}
+
+SString sstr::urlEncode(const SStringView &str) {
+    return encode(str, false);
+}
+
+SString sstr::urlEncodePath(const SStringView &str) {
+    return encode(str, true);
+}
+
+bool sstr::urlDecode(const SStringView &str, SString &out, bool validate) {
+    return decodeTo(str, out, validate, true);
+}
+
+bool sstr::urlDecode(SString &str, bool validate) {
+    return decodeInPlace(str, validate, true);
+}
+
+bool sstr::urlDecodePath(const SStringView &str, SString &out, bool validate) {
+    return decodeTo(str, out, validate, false);
+}
+
+bool sstr::urlDecodePath(SString &str, bool validate) {
+    return decodeInPlace(str, validate, false);
+}
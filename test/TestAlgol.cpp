@@ -1,5 +1,6 @@
 #include <SString/algorithm.h>
 #include <cstdio>
+#include <cstring>
 
 #define Test(str, sub, func) printf("func: " #func " & index: %d\n", func(str, sub))
 
@@ -22,6 +23,15 @@ int main() {
     Test(str, sub2, sstr::NORMAL);
     Test(str, sub2, sstr::KMP);
     Test(str, sub2, sstr::BM);
+    puts("");
+
+    // 过长编码、代理项与超范围字符按非法处理
+    const char *sequences[] = {"\xc3\xa9", "\xc0\x80", "\xed\xa0\x80", "\xf4\x8f\xbf\xbf", "\xf4\x90\x80\x80"};
+    for (auto seq: sequences) {
+        int n;
+        auto code = sstr::DecodeUTF8(seq, seq + strlen(seq), n);
+        printf("decode: U+%04X, %d bytes\n", code, n);
+    }
 
     return 0;
 }
@@ -0,0 +1,42 @@
+#include <SString/diff.h>
+#include <cstdio>
+
+using sstr::SDiffUnit;
+using sstr::SString;
+using sstr::SStringBuilder;
+using sstr::SStringView;
+
+static void printEdits(const std::vector<sstr::SEdit> &edits) {
+    for (auto &edit: edits) {
+        printf("  replace [%lu, +%lu) with \"%s\"\n", edit.begin, edit.len, edit.text.data());
+    }
+}
+
+int main() {
+    SStringView original("今天天气很好，我们去公园散步。");
+    SStringBuilder document(64);
+    document.append(original);
+    // 模拟编辑
+    document.replace(2, 2, SStringView("的天气"));
+    document.append("明天见！");
+
+    auto edits = sstr::getDiff(original, document);
+    printf("char edits = %lu\n", edits.size());
+    printEdits(edits);
+
+    // 另一端对原文应用编辑脚本
+    SStringBuilder replica(64);
+    replica.append(original);
+    sstr::applyDiff(replica, edits);
+    printf("replica = %s\n", replica.toString().data());
+    printf("same = %s\n", replica.toString() == document.toString() ? "true" : "false");
+
+    SStringView before("alpha\nbeta\ngamma\ndelta\n");
+    SStringView after("alpha\nBETA\ngamma\ndelta\nepsilon\n");
+    auto lineEdits = sstr::getDiff(before, after, SDiffUnit::Line);
+    printf("line edits = %lu\n", lineEdits.size());
+    printEdits(lineEdits);
+    printf("applied = %s", sstr::applyDiff(before, lineEdits).data());
+    printf("identical = %lu\n", sstr::getDiff(before, before).size());
+    return 0;
+}
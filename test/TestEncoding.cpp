@@ -0,0 +1,34 @@
+#include <SString/encoding.h>
+#include <cstdio>
+
+using sstr::SString;
+using sstr::SStringView;
+
+int main() {
+    auto text = SStringView("你好 SString");
+    auto b64 = sstr::base64Encode(text);
+    auto url = sstr::base64UrlEncode(text);
+    printf("base64 = %s\n", b64.data());
+    printf("base64url = %s\n", url.data());
+
+    SString decoded;
+    printf("decode ok = %s\n", sstr::base64Decode(b64, decoded) ? "true" : "false");
+    printf("round trip = %s\n", decoded == text ? "true" : "false");
+    printf("url decode ok = %s\n", sstr::base64UrlDecode(url, decoded) ? "true" : "false");
+    printf("url round trip = %s\n", decoded == text ? "true" : "false");
+
+    sstr::base64Decode(SStringView("5L2g 5aW9\r\nIFNT\n dHJp bmc="), decoded);
+    printf("whitespace decode = %s\n", decoded.data());
+    printf("decoded size = %lu\n", sstr::getBase64DecodedSize(b64));
+    printf("bad char ok = %s\n", sstr::base64Decode(SStringView("5L2g*"), decoded) ? "true" : "false");
+
+    const char bytes[] = {0x00, 0x01, (char) 0x7f, (char) 0x80, (char) 0xff};
+    auto binary = SStringView(bytes, sizeof(bytes));
+    auto hex = sstr::hexEncode(binary);
+    printf("hex = %s\n", hex.data());
+    printf("HEX = %s\n", sstr::hexEncode(binary, true).data());
+    printf("hex decode ok = %s\n", sstr::hexDecode(SStringView("00 01 7F 80 ff"), decoded) ? "true" : "false");
+    printf("hex round trip = %s\n", decoded == binary ? "true" : "false");
+    printf("odd hex ok = %s\n", sstr::hexDecode(SStringView("abc"), decoded) ? "true" : "false");
+    return 0;
+}
@@ -0,0 +1,27 @@
+#include <SString/html.h>
+#include <cstdio>
+
+using sstr::SString;
+using sstr::SStringView;
+
+int main() {
+    auto raw = SStringView("<a href=\"x?a=1&b=2\">It's 你好</a>");
+    auto escaped = sstr::escapeHtml(raw);
+    printf("escaped = %s\n", escaped.data());
+    printf("round trip = %s\n", sstr::unescapeHtml(escaped) == raw ? "true" : "false");
+
+    auto clean = SString::fromUTF8("こんにちは SString, nothing to escape here at all");
+    auto data = clean.data();
+    printf("clean changed = %s\n", sstr::escapeHtmlInPlace(clean) ? "true" : "false");
+    printf("clean same buffer = %s\n", data == clean.data() ? "true" : "false");
+
+    auto entities = SStringView("&copy; &eacute;t&eacute; &hearts; &#x1F600; &#65; &apos; &unknown; & &amp");
+    printf("unescaped = %s\n", sstr::unescapeHtml(entities).data());
+
+    auto inPlace = SString::fromUTF8("1 &lt; 2 &amp;&amp; 3 &gt; 2");
+    sstr::unescapeHtmlInPlace(inPlace);
+    printf("in place = %s\n", inPlace.data());
+    sstr::escapeHtmlInPlace(inPlace);
+    printf("escape in place = %s\n", inPlace.data());
+    return 0;
+}
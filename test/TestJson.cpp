@@ -0,0 +1,48 @@
+#include <SString/json.h>
+#include <cstdio>
+
+using sstr::SString;
+using sstr::SStringBuilder;
+using sstr::SStringView;
+
+int main() {
+    auto raw = SStringView("你好 \"SString\"\n\tpath: C:\\temp \x01 こんにちは, this line is long enough for simd");
+    auto escaped = sstr::escapeJson(raw);
+    printf("escaped = %s\n", escaped.data());
+    printf("escaped.size = %lu, precomputed = %lu\n", escaped.size(), sstr::getEscapedJsonSize(raw));
+
+    SString unescaped;
+    auto ok = sstr::unescapeJson(escaped, unescaped);
+    printf("unescape ok = %s\n", ok ? "true" : "false");
+    printf("round trip equal = %s\n", unescaped == raw ? "true" : "false");
+
+    SStringBuilder builder(16);
+    sstr::escapeJson(raw, builder);
+    printf("builder equal = %s\n", builder.toString() == escaped ? "true" : "false");
+
+    SString emoji;
+    sstr::unescapeJson(SStringView("\\u4f60\\u597d \\ud83d\\ude00"), emoji);
+    printf("surrogate pair = %s\n", emoji.data());
+
+    SString bad;
+    printf("lone surrogate ok = %s\n", sstr::unescapeJson(SStringView("\\udc00"), bad) ? "true" : "false");
+    printf("bad escape ok = %s\n", sstr::unescapeJson(SStringView("\\x"), bad) ? "true" : "false");
+    printf("partial escape ok = %s, size = %lu\n", sstr::unescapeJson(SStringView("abc\\q"), bad) ? "true" : "false",
+           bad.size());
+
+    // 非法 UTF-8 替换为 U+FFFD 后继续转义
+    SStringBuilder invalid(16);
+    sstr::escapeJson(SStringView("a\xff\"\xe4\xbd"), invalid);
+    printf("invalid = %s\n", invalid.toString().data());
+
+    // 过长编码与超范围字符同样替换，两种重载结果一致
+    const char *malformed[] = {"\xf4\x90\x80\x80", "a\xc0\x80" "z"};
+    for (auto str: malformed) {
+        auto res = sstr::escapeJson(SStringView(str));
+        SStringBuilder appended(16);
+        sstr::escapeJson(SStringView(str), appended);
+        printf("malformed = %s, size = %lu, same = %s\n", res.data(), res.size(),
+               appended.toString() == res ? "true" : "false");
+    }
+    return 0;
+}
@@ -0,0 +1,66 @@
+#include <SString/SNormalizer.h>
+#include <SString/SSearchNormalizer.h>
+#include <cstdio>
+
+using sstr::SNormalForm;
+using sstr::SNormalizer;
+using sstr::SSearchNormalizer;
+using sstr::SString;
+using sstr::SStringView;
+
+int main() {
+    // 预组合的 é 与 e + U+0301
+    auto composed = SStringView("café");
+    auto decomposed = SStringView("café");
+    printf("raw equal = %s\n", composed == decomposed ? "true" : "false");
+    printf("NFC equal = %s\n", composed.normalize(SNormalForm::NFC) == decomposed.normalize(SNormalForm::NFC) ? "true" : "false");
+    printf("NFD size = %lu\n", composed.normalize(SNormalForm::NFD).size());
+    printf("isNormalized(NFC) = %s, %s\n",
+           composed.isNormalized(SNormalForm::NFC) ? "true" : "false",
+           decomposed.isNormalized(SNormalForm::NFC) ? "true" : "false");
+
+    // 兼容分解：连字、全角、带圈数字
+    auto compat = SStringView("ﬁ ＡＢ ① 각");
+    printf("NFKC = %s\n", compat.normalize(SNormalForm::NFKC).data());
+
+    auto ascii = SString::fromUTF8("already normalized ascii text");
+    auto data = ascii.data();
+    ascii.normalize(SNormalForm::NFC);
+    printf("in place same buffer = %s\n", data == ascii.data() ? "true" : "false");
+
+    // 已是该形式时不写入，const 对象同样可用
+    const SString &constant = ascii;
+    SString normalized;
+    auto written = constant.normalize(SNormalForm::NFC, normalized);
+    printf("written = %s, out.null = %s\n", written ? "true" : "false", normalized.null() ? "true" : "false");
+    written = decomposed.normalize(SNormalForm::NFC, normalized);
+    printf("written = %s, NFC = %lu bytes\n", written ? "true" : "false", normalized.size());
+
+    SNormalizer normalizer(SNormalForm::NFC);
+    SString out;
+    const char *chunks[] = {"Ame\xcc", "\x81lie ", "å", "̣ fin"};
+    for (auto chunk: chunks) {
+        normalizer.append(SStringView(chunk), out);
+    }
+    normalizer.finish(out);
+    printf("stream = %s, %s\n", out.data(), out == SStringView("Amélie ạ̊ fin") ? "true" : "false");
+
+    SSearchNormalizer search;
+    printf("search = [%s]\n", search.normalize(SStringView("  Crème   Brûlée, STRASSE & Straße! ＡＢＣ ")).data());
+    SSearchNormalizer caseOnly(sstr::SSearchCaseFold | sstr::SSearchCollapseWhitespace);
+    printf("case only = [%s]\n", caseOnly.normalize(SStringView(" Ǆemal\t\tΣΑΣ ")).data());
+    // 批量处理时复用输出缓冲区
+    const char *titles[] = {"Ａpple", "Ęxample   Title", "ﬁnal.Cut"};
+    SString key;
+    for (auto title: titles) {
+        search.normalize(SStringView(title), key);
+        printf("key = [%s]\n", key.data());
+    }
+    // 超范围与过长编码按 U+FFFD 处理，不影响前后字符
+    const char *invalid[] = {"a\xf4\x90\x80\x80" "b", "a\xc0\x80" "b"};
+    for (auto str: invalid) {
+        auto res = search.normalize(SStringView(str));
+        printf("invalid = [%s], %lu bytes\n", res.data(), res.size());
+    }
+    return 0;
+}
@@ -0,0 +1,50 @@
+#include <SString/rolling.h>
+#include <cstdio>
+#include <string>
+
+using sstr::SRabinKarpMatcher;
+using sstr::SString;
+using sstr::SStringView;
+
+int main() {
+    SStringView text("the cat sat on the mat with the hat");
+    // 窗口哈希与直接计算的结果一致
+    auto hashes = sstr::getRollingHashes(text, 3);
+    printf("windows = %lu, [4] == hash(\"cat\") = %s\n", hashes.size(),
+           hashes[4] == sstr::getRabinKarpHash(SStringView("cat")) ? "true" : "false");
+
+    SRabinKarpMatcher matcher({SStringView("cat"), SStringView("mat"), SStringView("hat"), SStringView("dog")});
+    printf("valid = %s, window = %lu\n", matcher.valid() ? "true" : "false", matcher.window());
+    matcher.forEachMatch(text, [](size_t offset, uint32_t pattern) {
+        printf("match %u at %lu\n", pattern, offset);
+        return true;
+    });
+    uint32_t pattern = 0;
+    auto pos = matcher.find(text, 5, &pattern);
+    printf("find from 5 = %ld, pattern = %u\n", (long) pos, pattern);
+    SRabinKarpMatcher mixed({SStringView("ab"), SStringView("abc")});
+    printf("mixed lengths valid = %s\n", mixed.valid() ? "true" : "false");
+
+    // 在中间插入内容后，之后的块边界重新对齐
+    std::string blob;
+    uint32_t seed = 1;
+    for (int i = 0; i < 200000; i++) {
+        seed = seed * 1103515245 + 12345;
+        blob.push_back((char) ('a' + (seed >> 16) % 26));
+    }
+    auto edited = blob;
+    edited.insert(100000, "inserted passage");
+    auto a = sstr::splitChunks(SStringView(blob.data(), blob.size()), 512, 2048, 8192);
+    auto b = sstr::splitChunks(SStringView(edited.data(), edited.size()), 512, 2048, 8192);
+    size_t shared = 0;
+    for (auto &x: a) {
+        for (auto &y: b) {
+            if (x == y) {
+                shared++;
+                break;
+            }
+        }
+    }
+    printf("chunks = %lu, %lu, shared = %s\n", a.size(), b.size(), shared + 2 >= a.size() ? "all but the edited" : "too few");
+    return 0;
+}
@@ -0,0 +1,36 @@
+#include <SString/SString.h>
+#include <cstdio>
+#include <vector>
+
+using sstr::SCategory;
+using sstr::SChar;
+using sstr::SScript;
+using sstr::SStringView;
+
+static_assert(SCategory::Lu == sstr::getCategoryFromASCII('A'), "compile time category");
+static_assert(SCategory::Ps == sstr::getCategoryFromASCII('('), "compile time category");
+
+int main() {
+    SChar chars[] = {SChar('a'), SChar(0x0416), SChar(0x4f60), SChar(0x0661), SChar(0x3000), SChar(0x3002), SChar(0x1f600)};
+    for (auto ch: chars) {
+        printf("U+%04X alpha = %d, digit = %d, space = %d, punct = %d, category = %d, script = %s (%s)\n",
+               (uint32_t) ch, ch.isAlpha(), ch.isDigit(), ch.isSpace(), ch.isPunct(), (int) ch.category(),
+               sstr::getScriptName(ch.script()), sstr::getScriptCode(ch.script()));
+    }
+
+    auto str = SStringView("Hello, 世界! Привет 123 مرحبا");
+    std::vector<SScript> scripts(str.size());
+    auto count = sstr::getScriptsFromUTF8String(str.data(), str.size(), scripts.data());
+    printf("count = %lu, scripts =", count);
+    for (size_t i = 0; i < count; i++) {
+        if (0 == i || scripts[i] != scripts[i - 1]) printf(" %s", sstr::getScriptCode(scripts[i]));
+    }
+    puts("");
+
+    auto mask = sstr::getCategoryMaskFromUTF8String(str.data(), str.size());
+    printf("has letter = %s, has punct = %s, has symbol = %s\n",
+           mask & sstr::LetterMask ? "true" : "false",
+           mask & sstr::PunctuationMask ? "true" : "false",
+           mask & sstr::SymbolMask ? "true" : "false");
+    return 0;
+}
@@ -0,0 +1,51 @@
+#include <SString/SCollator.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+using sstr::SCollationStrength;
+using sstr::SCollator;
+using sstr::SString;
+using sstr::SStringColumn;
+using sstr::SStringView;
+
+static bool lessKey(const SStringView &a, const SStringView &b) {
+    auto res = memcmp(a.data(), b.data(), std::min(a.size(), b.size()));
+    return res < 0 || (0 == res && a.size() < b.size());
+}
+
+int main() {
+    SStringColumn names;
+    const char *values[] = {"zebra", "Ångström", "apple", "Zoë", "angstrom", "Apple", "éclair", "eclair", "de luca", "DeLuca"};
+    for (auto value: values) {
+        names.append(value);
+    }
+
+    // 键只生成一次，之后按字节序排序
+    SCollator collator;
+    auto keys = collator.getSortKeys(names);
+    std::vector<size_t> order;
+    for (size_t i = 0; i < names.size(); i++) {
+        order.push_back(i);
+    }
+    std::sort(order.begin(), order.end(), [&keys](size_t a, size_t b) { return lessKey(keys[a], keys[b]); });
+    printf("tertiary:");
+    for (auto i: order) {
+        printf(" %s,", names[i].data());
+    }
+    printf("\n");
+
+    SCollator primary(SCollationStrength::Primary);
+    printf("primary: Ångström == angstrom = %s\n", 0 == primary.compare(names[1], names[4]) ? "true" : "false");
+    printf("tertiary: apple < Apple = %s\n", collator.compare(names[2], names[5]) < 0 ? "true" : "false");
+
+    // shifted 时空白与标点只在第四级起作用
+    SCollator shifted(SCollationStrength::Tertiary, true);
+    printf("shifted: de luca == DeLuca (primary) = %s\n",
+           0 == SCollator(SCollationStrength::Primary, true).compare(names[8], names[9]) ? "true" : "false");
+    printf("shifted: de luca < DeLuca = %s\n", shifted.compare(names[8], names[9]) < 0 ? "true" : "false");
+
+    auto key = collator.getSortKey(SStringView("a"));
+    printf("key(a) size = %lu\n", key.size());
+    return 0;
+}
@@ -0,0 +1,46 @@
+#include <SString/SLineIndex.h>
+#include <cstdio>
+#include <cstring>
+
+using sstr::SLineIndex;
+using sstr::SString;
+using sstr::SStringBuilder;
+using sstr::SStringView;
+
+int main() {
+    SStringView source("int main() {\n    return 0;\n}\n// 结束：注释\n");
+    SLineIndex index(source);
+    printf("lines = %lu, size = %lu\n", index.lineCount(), index.size());
+
+    // 字节偏移换算为行列，列以字符计
+    size_t line, column;
+    auto offset = (size_t) (strstr(source.data(), "注释") - source.data());
+    index.getPosition(source, offset, line, column);
+    printf("offset %lu -> line %lu, column %lu\n", offset, line, column);
+    printf("line %lu, column %lu -> offset %lu\n", line, column, index.getOffset(source, line, column));
+    printf("line 1 = [%lu, %lu)\n", index.getLineStart(1), index.getLineEnd(1));
+    printf("out of range = %s\n", index.getPosition(source, source.size() + 1, line, column) ? "true" : "false");
+
+    // 与 SStringBuilder 同步编辑，偏移以字符计
+    SStringBuilder document(64);
+    document.append(source);
+    SLineIndex charIndex(document);
+    document.replace(17, 9, SStringView("int x = 1;\n    return x;"));
+    charIndex.replace(17, 9, SStringView("int x = 1;\n    return x;"));
+    document.append("// 完\n");
+    charIndex.append(SStringView("// 完\n"));
+    printf("%s", document.toString().data());
+    for (size_t i = 0; i < charIndex.lineCount(); i++) {
+        printf("line %lu starts at %lu\n", i, charIndex.getLineStart(i));
+    }
+    auto rebuilt = SLineIndex(document);
+    bool same = rebuilt.lineCount() == charIndex.lineCount();
+    for (size_t i = 0; same && i < rebuilt.lineCount(); i++) {
+        same = rebuilt.getLineStart(i) == charIndex.getLineStart(i);
+    }
+    printf("same as rebuilt = %s\n", same ? "true" : "false");
+    // SStringBuilder::replace 在末尾不做修改，索引同样拒绝
+    printf("replace at end = %s\n", charIndex.replace(charIndex.size(), 0, SStringView("x\n")) ? "true" : "false");
+    printf("lines = %lu, size = %lu\n", charIndex.lineCount(), charIndex.size());
+    return 0;
+}
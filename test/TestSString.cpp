@@ -1,5 +1,7 @@
 #include <SString/SString.h>
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <iostream>
 
 using sstr::SChar;
@@ -112,8 +114,93 @@ void testV1_1() {
     printf("upper.toLower = %s\n", upper.data());
 }
 
+void testTrim() {
+    // U+3000 与 U+00A0 同样视为空白
+    SStringView str = SStringView("\u3000 \t你好 Hello\u00a0\n");
+    auto trimmed = str.trim();
+    printf("trim = [%.*s]\n", (int) trimmed.size(), trimmed.data());
+    auto start = str.trimStart();
+    printf("trimStart = [%.*s]\n", (int) start.size(), start.data());
+    printf("trimEnd.endsWith = %s\n", str.trimEnd().endsWith(SStringView("Hello")) ? "true" : "false");
+
+    SStringView quoted = SStringView("「“你好”」");
+    auto unquoted = quoted.trim(SStringView("「」“”"));
+    printf("trim chars = [%.*s]\n", (int) unquoted.size(), unquoted.data());
+
+    SString padding = SString::fromUTF8("                    padded text                    ");
+    padding.trimInPlace();
+    printf("in place trim = [%s], size = %lu\n", padding.data(), padding.size());
+    padding.trimEndInPlace(SStringView("xet"));
+    printf("in place trimEnd = [%s]\n", padding.data());
+
+    SString blank = SString::fromUTF8(" \u2003 ");
+    blank.trimInPlace();
+    printf("blank.empty = %s\n", blank.empty() ? "true" : "false");
+
+    // 不带 InPlace 的版本继承自 SStringView，返回视图
+    auto view = padding.trimEnd(SStringView(" d"));
+    printf("view trimEnd = [%.*s]\n", (int) view.size(), view.data());
+}
+
+void testDisplayWidth() {
+    // 汉字与全角字符占 2 列，组合符与零宽空格占 0 列
+    SStringView mixed = SStringView("中文 ＡＢ cafe\u0301\u200b");
+    printf("len = %lu, displayWidth = %lu\n", mixed.len(), mixed.displayWidth());
+    // U+00B1 为宽度不定字符
+    SStringView ambiguous = SStringView("±1");
+    printf("ambiguous = %lu, %lu\n", ambiguous.displayWidth(), ambiguous.displayWidth(true));
+
+    // 宽字符放不下时不会被切断
+    auto head = mixed.truncateWidth(3);
+    printf("truncateWidth(3) = [%.*s]\n", (int) head.size(), head.data());
+    auto cafe = SStringView("cafe\u0301!").truncateWidth(4);
+    printf("truncateWidth keeps marks = [%.*s]\n", (int) cafe.size(), cafe.data());
+
+    const char *names[] = {"名前", "Name", "長い名前です"};
+    for (auto name: names) {
+        auto cell = SStringView(name).truncateWidth(8);
+        printf("|%s|%s|\n", cell.padWidthEnd(8).data(), cell.padWidthStart(8).data());
+    }
+}
+
+void testNatural() {
+    const char *pairs[][2] = {
+            {"item2", "item10"},
+            {"v1.9.3", "v1.10.0"},
+            {"file007", "file7"},
+            {"a", "a0"},
+            {"x99y", "x100"},
+    };
+    for (auto &pair: pairs) {
+        SStringView a(pair[0]), b(pair[1]);
+        // 排序键按字节比较的结果与 compareNatural 一致
+        auto keyA = a.naturalSortKey(), keyB = b.naturalSortKey();
+        auto n = std::min(keyA.size(), keyB.size());
+        auto res = memcmp(keyA.data(), keyB.data(), n);
+        if (!res) res = keyA.size() < keyB.size() ? -1 : keyA.size() > keyB.size();
+        printf("compareNatural(%s, %s) = %d, key = %d\n", pair[0], pair[1], a.compareNatural(b), res < 0 ? -1 : res > 0);
+    }
+}
+
+void testStats() {
+    SStringView text("The quick brown fox can't jump 3.14 metres.\n"
+                     "敏捷的棕色狐狸跳过了懒狗。\n"
+                     "naïve café, e.g. x:y");
+    auto stats = text.stats();
+    printf("bytes = %lu, chars = %lu, lines = %lu, words = %lu\n",
+           stats.bytes, stats.chars, stats.lines, stats.words);
+    printf("len = %lu\n", text.len());
+    // 输入不足 1MB 时退化为单线程
+    auto parallel = text.statsParallel(4);
+    printf("parallel words = %lu\n", parallel.words);
+}
+
 int main() {
     // testV1_0();
     testV1_1();
+    testTrim();
+    testDisplayWidth();
+    testNatural();
+    testStats();
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,52 @@
+#include <SString/SStringBloomFilter.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using sstr::SStringBloomFilter;
+using sstr::SStringColumn;
+using sstr::SStringView;
+
+int main() {
+    SStringBloomFilter filter(10000, 0.01);
+    printf("bits = %lu, hashes = %d\n", filter.bits(), filter.hashes());
+
+    SStringColumn seen;
+    for (int i = 0; i < 10000; i++) {
+        seen.append(SStringView(("user:" + std::to_string(i)).c_str()));
+    }
+    filter.insert(seen);
+
+    // 加入过的键一定能查到
+    auto hits = filter.mayContain(seen);
+    printf("inserted found = %lu / %lu\n", hits.count(), seen.size());
+
+    SStringColumn unseen;
+    for (int i = 0; i < 100000; i++) {
+        unseen.append(SStringView(("guest:" + std::to_string(i)).c_str()));
+    }
+    auto fp = filter.mayContain(unseen).count();
+    printf("false positive rate below 2%% = %s\n", fp < 2000 ? "true" : "false");
+    printf("single = %s, %s\n", filter.mayContain(SStringView("user:42")) ? "true" : "false",
+           filter.mayContain(SStringView("user:-1")) ? "true" : "false");
+
+    // 拷贝的缓冲区对齐位置可能不同，加入过的键仍需全部查到
+    size_t missing = 0;
+    for (int trial = 0; trial < 50; trial++) {
+        SStringBloomFilter small(20 + trial);
+        SStringColumn keys;
+        for (int i = 0; i < 20 + trial; i++) {
+            keys.append(SStringView(("key:" + std::to_string(trial) + ":" + std::to_string(i)).c_str()));
+        }
+        small.insert(keys);
+        // 穿插不同大小的分配，使拷贝的缓冲区落在不同的对齐位置
+        std::vector<char> padding(trial * 8);
+        SStringBloomFilter copied(small);
+        SStringBloomFilter assigned(1);
+        assigned = small;
+        missing += keys.size() - copied.mayContain(keys).count();
+        missing += keys.size() - assigned.mayContain(keys).count();
+    }
+    printf("copy missing = %lu\n", missing);
+    return 0;
+}
@@ -0,0 +1,60 @@
+#include <SString/SStringColumn.h>
+#include <cstdio>
+
+using sstr::SBitmap;
+using sstr::SStringColumn;
+using sstr::SStringView;
+
+int main() {
+    SStringColumn column;
+    column.append("Hello SString");
+    column.append("你好 World");
+    column.append("");
+    column.append("HELLO");
+    column.append("hello");
+    printf("column.size = %lu, column.bytes = %lu\n", column.size(), column.bytes());
+
+    auto lens = column.len();
+    for (size_t i = 0; i < column.size(); i++) {
+        printf("[%lu] = \"%s\" len = %u\n", i, column[i].data(), lens[i]);
+    }
+
+    auto lower = column.toLower();
+    printf("lower[0] = %s, lower[3] = %s\n", lower[0].data(), lower[3].data());
+    auto upper = column.toUpper();
+    printf("upper[1] = %s\n", upper[1].data());
+
+    auto pos = column.find(SStringView("World"));
+    printf("find World = %d %d %d %d %d\n", pos[0], pos[1], pos[2], pos[3], pos[4]);
+
+    auto eq = lower.equals(SStringView("hello"));
+    printf("equals hello: count = %lu, [3] = %s, [4] = %s\n", eq.count(), eq[3] ? "true" : "false", eq[4] ? "true" : "false");
+    auto empty = column.equals(SStringView(""));
+    printf("equals empty: [2] = %s\n", empty[2] ? "true" : "false");
+    auto has = column.contains(SStringView("llo"));
+    printf("contains llo: count = %lu\n", has.count());
+
+    auto hashes = lower.hash();
+    printf("hash[3] == hash[4] = %s\n", hashes[3] == hashes[4] ? "true" : "false");
+    printf("hash[4] == view hash = %s\n", hashes[4] == SStringView("hello").hash() ? "true" : "false");
+
+    SStringColumn names;
+    names.append("张三");
+    names.append("Alexander");
+    names.append("ｍｉｘ混合");
+    auto widths = names.displayWidth();
+    printf("displayWidth = %u %u %u\n", widths[0], widths[1], widths[2]);
+    auto cells = names.fitWidth(7);
+    for (size_t i = 0; i < cells.size(); i++) {
+        printf("|%s|\n", cells[i].data());
+    }
+
+    SStringColumn files;
+    const char *fileNames[] = {"img12.png", "img10.png", "img2.png", "IMG1.png", "img02.png", "img1.png"};
+    for (auto name: fileNames) files.append(name);
+    for (auto i: files.sortNatural()) {
+        printf("%s ", files[i].data());
+    }
+    printf("\n");
+    return 0;
+}
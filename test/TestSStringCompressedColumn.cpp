@@ -0,0 +1,41 @@
+#include <SString/SStringCompressedColumn.h>
+#include <cstdio>
+#include <string>
+
+using sstr::SString;
+using sstr::SStringCompressedColumn;
+using sstr::SStringSymbolTable;
+using sstr::SStringView;
+
+int main() {
+    std::vector<SString> urls;
+    size_t rawBytes = 0;
+    for (int i = 0; i < 200; i++) {
+        auto url = "https://www.example.com/api/v1/users/" + std::to_string(i * 7919) + "/profile?lang=zh-CN&from=你好";
+        urls.emplace_back(url.data(), url.size());
+        rawBytes += url.size();
+    }
+
+    auto table = SStringSymbolTable::train(urls);
+    printf("symbols = %lu\n", table.size());
+
+    SStringCompressedColumn column(table);
+    for (auto &url: urls) {
+        column.append(url);
+    }
+    printf("raw bytes = %lu, compressed bytes = %lu\n", rawBytes, column.bytes());
+
+    bool same = true;
+    for (size_t i = 0; i < urls.size(); i++) {
+        same = same && column[i] == urls[i] && column.size(i) == urls[i].size();
+    }
+    printf("round trip = %s\n", same ? "true" : "false");
+    printf("column[42] = %s\n", column[42].data());
+    printf("equals = %s\n", column.equals(42, urls[42]) ? "true" : "false");
+    printf("find = %ld\n", (long) column.find(urls[100]));
+    printf("find missing = %ld\n", (long) column.find(SStringView("https://www.example.com/")));
+
+    column.append("未见过的内容 unseen text");
+    printf("unseen = %s\n", column[column.size() - 1].data());
+    return 0;
+}
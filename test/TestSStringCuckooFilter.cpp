@@ -0,0 +1,37 @@
+#include <SString/SStringCuckooFilter.h>
+#include <cstdio>
+#include <string>
+
+using sstr::SStringColumn;
+using sstr::SStringCuckooFilter;
+using sstr::SStringView;
+
+int main() {
+    SStringCuckooFilter filter(10000);
+    printf("capacity = %lu\n", filter.capacity());
+
+    SStringColumn keys;
+    for (int i = 0; i < 10000; i++) {
+        keys.append(SStringView(("session:" + std::to_string(i)).c_str()));
+    }
+    size_t inserted = 0;
+    for (size_t i = 0; i < keys.size(); i++) {
+        inserted += filter.insert(keys[i]);
+    }
+    printf("inserted = %lu, size = %lu\n", inserted, filter.size());
+    printf("found = %lu\n", filter.mayContain(keys).count());
+
+    // 删除前一半后只剩假阳性
+    for (size_t i = 0; i < keys.size() / 2; i++) {
+        filter.erase(keys[i]);
+    }
+    auto found = filter.mayContain(keys);
+    size_t front = 0;
+    for (size_t i = 0; i < keys.size() / 2; i++) {
+        front += found[i];
+    }
+    printf("after erase: size = %lu, erased still found < 10 = %s, rest found = %lu\n", filter.size(),
+           front < 10 ? "true" : "false", found.count() - front);
+    printf("erase missing = %s\n", filter.erase(SStringView("missing")) ? "true" : "false");
+    return 0;
+}
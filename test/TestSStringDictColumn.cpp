@@ -0,0 +1,35 @@
+#include <SString/SStringDictColumn.h>
+#include <cstdio>
+#include <string>
+
+using sstr::SBitmap;
+using sstr::SStringDictColumn;
+using sstr::SStringView;
+
+int main() {
+    SStringDictColumn column;
+    const char *countries[] = {"中国", "日本", "France", "中国", "日本", "中国"};
+    for (auto country: countries) {
+        column.append(country);
+    }
+    printf("column.size = %lu, dictionary.size = %lu, width = %lu\n", column.size(), column.dictionary().size(), column.width());
+    printf("column[3] = %s, code = %ld\n", column[3].data(), (long) column.codeAt(3));
+    printf("row 0 == row 5 = %s\n", column.equals(0, 5) ? "true" : "false");
+
+    auto china = column.equals(SStringView("中国"));
+    printf("equals 中国 count = %lu\n", china.count());
+    auto asia = column.in({SStringView("中国"), SStringView("日本"), SStringView("Korea")});
+    printf("in asia count = %lu\n", asia.count());
+
+    auto counts = column.countByCode();
+    for (size_t code = 0; code < counts.size(); code++) {
+        printf("group %s = %lu\n", column.dictionary()[code].data(), counts[code]);
+    }
+
+    for (int i = 0; i < 300; i++) {
+        column.append(SStringView(std::to_string(i).c_str()));
+    }
+    printf("after widen: width = %lu, column[0] = %s, column[305] = %s\n", column.width(), column[0].data(), column[305].data());
+    printf("equals 中国 count = %lu\n", column.equals(SStringView("中国")).count());
+    return 0;
+}
@@ -0,0 +1,57 @@
+#include <SString/SStringFrontCodedDict.h>
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+using sstr::SString;
+using sstr::SStringFrontCodedDict;
+using sstr::SStringView;
+
+int main() {
+    std::vector<std::string> words = {"apple", "application", "apply", "banana", "band", "bandana", "can",
+                                      "candle", "こんにちは", "こんばんは", "你好", "你们"};
+    for (int i = 0; i < 100; i++) {
+        words.push_back("id-" + std::to_string(10000 + i));
+    }
+    std::sort(words.begin(), words.end());
+    std::vector<SStringView> sorted;
+    for (auto &word: words) {
+        sorted.emplace_back(word.data(), word.size());
+    }
+
+    SStringFrontCodedDict dict;
+    printf("build ok = %s\n", dict.build(sorted, 8) ? "true" : "false");
+    printf("dict.size = %lu, image bytes = %lu\n", dict.size(), dict.image().size());
+
+    bool same = true;
+    for (size_t i = 0; i < sorted.size(); i++) {
+        same = same && dict.lookup(sorted[i]) == (int64_t) i && dict.locate(i) == sorted[i];
+    }
+    printf("lookup/locate all = %s\n", same ? "true" : "false");
+    printf("lookup missing = %ld\n", (long) dict.lookup(SStringView("bandanas")));
+
+    size_t begin, end;
+    dict.prefixRange(SStringView("band"), begin, end);
+    printf("prefix band = [%lu, %lu)\n", begin, end);
+    dict.forEachPrefix(SStringView("app"), [](size_t id, const SStringView &str) {
+        printf("  %lu: %s\n", id, str.data());
+        return true;
+    });
+    size_t ids = 0;
+    dict.forEachPrefix(SStringView("id-100"), [&ids](size_t, const SStringView &) {
+        ids++;
+        return true;
+    });
+    printf("prefix id-100 count = %lu\n", ids);
+
+    const char *path = "SStringFrontCodedDict.bin";
+    printf("write ok = %s\n", dict.write(path) ? "true" : "false");
+    SStringFrontCodedDict mapped;
+    printf("map ok = %s\n", mapped.map(path, true) ? "true" : "false");
+    printf("mapped lookup 你好 = %ld, locate = %s\n", (long) mapped.lookup(SStringView("你好")), mapped.locate(mapped.size() - 1).data());
+    remove(path);
+
+    std::vector<SStringView> unsorted = {SStringView("b"), SStringView("a")};
+    printf("unsorted build ok = %s\n", dict.build(unsorted) ? "true" : "false");
+    return 0;
+}
@@ -0,0 +1,44 @@
+#include <SString/SStringTable.h>
+#include <cstdio>
+
+using sstr::SString;
+using sstr::SStringTable;
+using sstr::SStringView;
+
+int main() {
+    auto parts = SStringView("你好,こんにちは,,Hello,SString").split(",");
+    const char *path = "SStringTable.bin";
+
+    auto bytes = SStringTable::serialize(parts, true);
+    printf("serialized size = %lu\n", bytes.size());
+
+    SStringTable memory;
+    printf("open ok = %s\n", memory.open(bytes.data(), bytes.size()) ? "true" : "false");
+    printf("memory.size = %lu, checksummed = %s\n", memory.size(), memory.checksummed() ? "true" : "false");
+
+    printf("write ok = %s\n", SStringTable::write(path, parts, true) ? "true" : "false");
+    SStringTable loaded;
+    printf("load ok = %s\n", loaded.load(path) ? "true" : "false");
+    SStringTable mapped;
+    printf("map ok = %s\n", mapped.map(path) ? "true" : "false");
+
+    bool same = parts.size() == loaded.size() && parts.size() == mapped.size();
+    for (size_t i = 0; same && i < parts.size(); i++) {
+        same = parts[i] == loaded[i] && parts[i] == mapped[i] && parts[i] == memory[i];
+    }
+    printf("all equal = %s\n", same ? "true" : "false");
+    for (size_t i = 0; i < mapped.size(); i++) {
+        printf("[%lu] = \"%s\" (%lu bytes)\n", i, mapped[i].data(), mapped[i].size());
+    }
+
+    bytes.data()[bytes.size() - 9] ^= 1;
+    printf("corrupted open ok = %s\n", memory.open(bytes.data(), bytes.size()) ? "true" : "false");
+
+    // 不带校验和时同样检查每项的结尾 '\0'
+    auto plain = SStringTable::serialize(parts);
+    auto strings = 24 + (parts.size() + 1) * sizeof(uint64_t);
+    plain.data()[strings + parts[0].size()] = 'x';
+    printf("unterminated open ok = %s\n", memory.open(plain.data(), plain.size()) ? "true" : "false");
+    remove(path);
+    return 0;
+}
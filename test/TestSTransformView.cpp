@@ -0,0 +1,50 @@
+#include <SString/STransformView.h>
+#include <cstdio>
+#include <string>
+
+using sstr::SChar;
+using sstr::SString;
+using sstr::SStringView;
+using sstr::STransformView;
+
+int main() {
+    SStringView title("   The Quick Brown Fox Jumps Over The Lazy Dog   ");
+    // 链式调用只记录步骤，materialize 时一次遍历写入结果
+    auto view = STransformView(title).trim().toLower().substring(4, 11);
+    printf("[%s]\n", view.materialize().data());
+
+    auto replaced = STransformView(SStringView("aaa-abab-aab")).replace(SStringView("aab"), SStringView("X")).materialize();
+    printf("replace = %s\n", replaced.data());
+
+    // substring 之后的 replace 仍输出未完成的匹配
+    auto cut = STransformView(SStringView("abcdef")).substring(0, 3).replace(SStringView("abcd"), SStringView("?")).materialize();
+    printf("cut = %s\n", cut.data());
+
+    auto digits = STransformView(SStringView(" 电话：010-8888 6666 ")).filter([](SChar ch) { return ch.isDigit(); }).materialize();
+    printf("digits = %s\n", digits.data());
+
+    SStringView words("  你好，  世界  ");
+    auto inner = STransformView(words).replace(SStringView("，"), SStringView(",")).trim();
+    printf("inner = [%s]\n", inner.materialize().data());
+    size_t count = 0;
+    inner.forEach([&count](SChar ch) {
+        count++;
+        return 'x' != ch.code;
+    });
+    printf("forEach count = %lu\n", count);
+
+    SString out;
+    STransformView(SStringView("Hello")).toUpper().materialize(out);
+    printf("upper = %s\n", out.data());
+
+    // 过长编码与超范围字符同样按非法字节原样保留
+    const char *invalid[] = {"A\xf4\x90\x80\x80" "B", "A\xc0\x80" "B"};
+    for (auto str: invalid) {
+        std::string expected(str);
+        expected.front() = 'a';
+        expected.back() = 'b';
+        auto lower = STransformView(SStringView(str)).toLower().materialize();
+        printf("raw kept = %s\n", std::string(lower.data(), lower.size()) == expected ? "true" : "false");
+    }
+    return 0;
+}
@@ -0,0 +1,41 @@
+#include <SString/segment.h>
+#include <cstdio>
+
+using sstr::SGraphemeIterator;
+using sstr::SString;
+using sstr::SSentenceIterator;
+using sstr::SStringView;
+using sstr::SWordIterator;
+
+int main() {
+    // e + 组合尖音符、家庭表情（ZWJ 序列）、国旗、韩文音节块
+    auto str = SStringView("héllo 👨‍👩‍👧 🇯🇵🇨🇳 각 你好\r\n");
+    printf("len = %lu, graphemes = %lu\n", str.len(), sstr::getGraphemeCount(str));
+
+    printf("clusters =");
+    for (auto cluster: SGraphemeIterator(str)) {
+        printf(" [%.*s]", (int) cluster.size(), cluster.data());
+    }
+    puts("");
+
+    auto head = sstr::truncateGraphemes(str, 7);
+    printf("truncate(7) = %.*s\n", (int) head.size(), head.data());
+
+    auto reversed = sstr::reverseGraphemes(SStringView("aé👍🏽z"));
+    printf("reverse = %s\n", reversed.data());
+
+    auto text = SStringView("He said \"can't stop\" at 3.14 o'clock. 東京タワーに行く。Next!");
+    printf("segments =");
+    for (auto it = SWordIterator(text); it != it.end(); ++it) {
+        auto segment = *it;
+        printf(it.isWord() ? " [%.*s]" : " %.*s", (int) segment.size(), segment.data());
+    }
+    puts("");
+    printf("words = %lu\n", sstr::splitWords(text).size());
+
+    auto paragraph = SStringView("Mr. Smith arrived. It was 5 p.m. He left!  \"Really?\" she asked.\n新しい文です。");
+    for (auto sentence: SSentenceIterator(paragraph)) {
+        printf("sentence = [%.*s]\n", (int) sentence.size(), sentence.data());
+    }
+    return 0;
+}
@@ -0,0 +1,44 @@
+#include <SString/similarity.h>
+#include <cstdio>
+
+using sstr::SLSHIndex;
+using sstr::SStringView;
+
+int main() {
+    const char *messages[] = {
+            "限时优惠！点击链接领取你的专属红包，先到先得",
+            "限时优惠!!点击链接领取您的专属红包，先到先得",
+            "The quick brown fox jumps over the lazy dog",
+            "The quick brown fox jumped over the lazy dog.",
+            "明天下午三点在会议室开周会，请准时参加",
+    };
+    const size_t count = sizeof(messages) / sizeof(messages[0]);
+
+    uint64_t simhashes[count];
+    for (size_t i = 0; i < count; i++) {
+        simhashes[i] = sstr::getSimHash(SStringView(messages[i]));
+    }
+    printf("simhash distance: 0-1 = %d, 2-3 = %d, 0-4 = %d\n",
+           sstr::getSimHashDistance(simhashes[0], simhashes[1]),
+           sstr::getSimHashDistance(simhashes[2], simhashes[3]),
+           sstr::getSimHashDistance(simhashes[0], simhashes[4]));
+
+    // 32 段，每段 4 项
+    SLSHIndex index(32, 4);
+    std::vector<std::vector<uint64_t>> signatures;
+    for (auto message: messages) {
+        signatures.push_back(sstr::getMinHash(SStringView(message), index.signatureSize()));
+        index.insert(signatures.back().data());
+    }
+    printf("minhash similarity: 0-1 = %.2f, 0-4 = %.2f\n",
+           sstr::getMinHashSimilarity(signatures[0].data(), signatures[1].data(), index.signatureSize()),
+           sstr::getMinHashSimilarity(signatures[0].data(), signatures[4].data(), index.signatureSize()));
+
+    auto query = sstr::getMinHash(SStringView("限时优惠！点击链接领取你的专属红包，先到先得！"), index.signatureSize());
+    printf("candidates:");
+    for (auto id: index.query(query.data())) {
+        printf(" %u", id);
+    }
+    printf("\n");
+    return 0;
+}
@@ -0,0 +1,35 @@
+#include <SString/url.h>
+#include <cstdio>
+
+using sstr::SString;
+using sstr::SStringView;
+
+int main() {
+    auto raw = SStringView("你好 SString/path?q=a+b&lang=ja こんにちは");
+    auto component = sstr::urlEncode(raw);
+    auto path = sstr::urlEncodePath(raw);
+    printf("component = %s\n", component.data());
+    printf("path = %s\n", path.data());
+
+    SString decoded;
+    printf("decode ok = %s\n", sstr::urlDecode(component, decoded, true) ? "true" : "false");
+    printf("component round trip = %s\n", decoded == raw ? "true" : "false");
+    printf("path decode ok = %s\n", sstr::urlDecodePath(path, decoded, true) ? "true" : "false");
+    printf("path round trip = %s\n", decoded == raw ? "true" : "false");
+
+    auto query = SString::fromUTF8("a+b%20c%2Fd");
+    sstr::urlDecode(query);
+    printf("in place = %s\n", query.data());
+
+    auto plus = SString::fromUTF8("/a+b/%E4%BD%A0");
+    sstr::urlDecodePath(plus);
+    printf("path in place = %s\n", plus.data());
+
+    printf("truncated ok = %s\n", sstr::urlDecode(SStringView("%E4%B"), decoded) ? "true" : "false");
+    printf("truncated size = %zu\n", decoded.size());
+    printf("invalid utf-8 ok = %s\n", sstr::urlDecode(SStringView("%E4%BD"), decoded, true) ? "true" : "false");
+    printf("invalid utf-8 size = %zu\n", decoded.size());
+    printf("bad escape ok = %s\n", sstr::urlDecodePath(SStringView("abc%zz"), decoded) ? "true" : "false");
+    printf("bad escape size = %zu\n", decoded.size());
+    return 0;
+}
@@ -12,6 +12,9 @@ end
 target("SString")
     set_kind("static")
     add_files("src/*.cpp")
+    if is_os("linux") then
+        add_syslinks("pthread", {public = true})
+    end
 
 target("TestSString")
     set_enabled(false)
@@ -30,3 +33,123 @@ target("TestAlgol")
     set_kind("binary")
     add_deps("SString")
     add_files("test/TestAlgol.cpp")
+
+target("TestJson")
+    set_enabled(false)
+    set_kind("binary")
+    add_deps("SString")
+    add_files("test/TestJson.cpp")
+
+target("TestUrl")
+    set_enabled(false)
+    set_kind("binary")
+    add_deps("SString")
+    add_files("test/TestUrl.cpp")
+
+target("TestEncoding")
+    set_enabled(false)
+    set_kind("binary")
+    add_deps("SString")
+    add_files("test/TestEncoding.cpp")
+
+target("TestHtml")
+    set_enabled(false)
+    set_kind("binary")
+    add_deps("SString")
+    add_files("test/TestHtml.cpp")
+
+target("TestSStringTable")
+    set_enabled(false)
+    set_kind("binary")
+    add_deps("SString")
+    add_files("test/TestSStringTable.cpp")
+
+target("TestSStringColumn")
+    set_enabled(false)
+    set_kind("binary")
+    add_deps("SString")
+    add_files("test/TestSStringColumn.cpp")
+
+target("TestSStringDictColumn")
+    set_enabled(false)
+    set_kind("binary")
+    add_deps("SString")
+    add_files("test/TestSStringDictColumn.cpp")
+
+target("TestSStringCompressedColumn")
+    set_enabled(false)
+    set_kind("binary")
+    add_deps("SString")
+    add_files("test/TestSStringCompressedColumn.cpp")
+
+target("TestSStringFrontCodedDict")
+    set_enabled(false)
+    set_kind("binary")
+    add_deps("SString")
+    add_files("test/TestSStringFrontCodedDict.cpp")
+
+target("TestSegment")
+    set_enabled(false)
+    set_kind("binary")
+    add_deps("SString")
+    add_files("test/TestSegment.cpp")
+
+target("TestSCharProperty")
+    set_enabled(false)
+    set_kind("binary")
+    add_deps("SString")
+    add_files("test/TestSCharProperty.cpp")
+
+target("TestNormalizer")
+    set_enabled(false)
+    set_kind("binary")
+    add_deps("SString")
+    add_files("test/TestNormalizer.cpp")
+
+target("TestSCollator")
+    set_enabled(false)
+    set_kind("binary")
+    add_deps("SString")
+    add_files("test/TestSCollator.cpp")
+
+target("TestSTransformView")
+    set_enabled(false)
+    set_kind("binary")
+    add_deps("SString")
+    add_files("test/TestSTransformView.cpp")
+
+target("TestRolling")
+    set_enabled(false)
+    set_kind("binary")
+    add_deps("SString")
+    add_files("test/TestRolling.cpp")
+
+target("TestSimilarity")
+    set_enabled(false)
+    set_kind("binary")
+    add_deps("SString")
+    add_files("test/TestSimilarity.cpp")
+
+target("TestSStringBloomFilter")
+    set_enabled(false)
+    set_kind("binary")
+    add_deps("SString")
+    add_files("test/TestSStringBloomFilter.cpp")
+
+target("TestSStringCuckooFilter")
+    set_enabled(false)
+    set_kind("binary")
+    add_deps("SString")
+    add_files("test/TestSStringCuckooFilter.cpp")
+
+target("TestDiff")
+    set_enabled(false)
+    set_kind("binary")
+    add_deps("SString")
+    add_files("test/TestDiff.cpp")
+
+target("TestSLineIndex")
+    set_enabled(false)
+    set_kind("binary")
+    add_deps("SString")
+    add_files("test/TestSLineIndex.cpp")